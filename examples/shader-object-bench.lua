@@ -0,0 +1,167 @@
+#!/usr/bin/env lua
+-- MoonVulkan example: shader-object-bench.lua
+--
+-- Compares the CPU cost of recording state changes with the pipeline path (one pipeline
+-- per state combination, switched with cmd_bind_pipeline) and with the shader object
+-- path (shaders bound once, state changed with the cmd_set_xxx dynamic state commands).
+--
+-- No presentation is needed, so it can be run on any implementation, including
+-- software ones (e.g. lavapipe or SwiftShader), by pointing VK_ICD_FILENAMES to it.
+-- The shader object path requires VK_EXT_shader_object on both the device and the
+-- headers MoonVulkan was compiled with, and is skipped otherwise.
+--
+-- Usage: lua shader-object-bench.lua [iterations]
+-- (glslangValidator must be in the executables PATH)
+
+vk = require("moonvulkan")
+
+local N = tonumber(arg[1]) or 100000 -- number of state changes to record
+
+local function glsl_to_spirv(filename)
+   local tmpfile = 'tmp.spv'
+   assert(os.execute("glslangValidator -s -V "..filename.." -o "..tmpfile))
+   local f = assert(io.open(tmpfile, 'rb'))
+   local code = f:read('a')
+   f:close()
+   os.remove(tmpfile)
+   return code
+end
+
+local vert_code = glsl_to_spirv("vulkan-tutorial/shaders/base.vert")
+local frag_code = glsl_to_spirv("vulkan-tutorial/shaders/base.frag")
+
+-- Instance, device and command buffer -----------------------------------------
+
+local instance = vk.create_instance({
+   application_info = { application_name = 'ShaderObjectBench', api_version = vk.make_version(1,2,0) },
+})
+local gpu = vk.enumerate_physical_devices(instance)[1]
+assert(gpu, "no physical devices")
+print("Device name: "..vk.get_physical_device_properties(gpu).device_name)
+
+local family
+for i, qf in ipairs(vk.get_physical_device_queue_family_properties(gpu)) do
+   if (qf.queue_flags & vk.QUEUE_GRAPHICS_BIT) ~= 0 then family = i-1 break end
+end
+assert(family, "no graphics queue family")
+
+local available = vk.enumerate_device_extension_properties(gpu, nil, true)
+local extensions = {}
+local dynamic_state = available['VK_EXT_extended_dynamic_state']
+local shader_object = available['VK_EXT_shader_object'] and
+                      available['VK_KHR_dynamic_rendering'] and dynamic_state
+if dynamic_state then extensions[#extensions+1] = 'VK_EXT_extended_dynamic_state' end
+if shader_object then
+   extensions[#extensions+1] = 'VK_EXT_shader_object'
+   extensions[#extensions+1] = 'VK_KHR_dynamic_rendering'
+end
+
+local device = vk.create_device(gpu, {
+   queue_create_infos = { { queue_family_index = family, queue_priorities = { 1.0 } } },
+   enabled_extension_names = extensions,
+   enabled_features = shader_object and
+      { shader_object = true, dynamic_rendering = true, extended_dynamic_state = true } or nil,
+})
+
+local command_pool = vk.create_command_pool(device, 0, family)
+local cb = vk.allocate_command_buffers(command_pool, 'primary', 1)[1]
+
+-- The state combinations (one pipeline per combination on the pipeline path)
+
+local variants = {}
+for _, cull_mode in ipairs({ 'none', 'back' }) do
+for _, front_face in ipairs({ 'clockwise', 'counter clockwise' }) do
+for _, topology in ipairs({ 'triangle list', 'triangle strip' }) do
+for _, depth_test in ipairs({ false, true }) do
+   variants[#variants+1] = { cull_mode = vk.cullmodeflags(cull_mode), front_face = front_face,
+                             topology = topology, depth_test = depth_test }
+end end end end
+print(string.format("%d state combinations, %d state changes", #variants, N))
+
+-- Pipeline path ----------------------------------------------------------------
+
+local render_pass = vk.create_render_pass(device, {
+   attachments = { { format = 'b8g8r8a8 unorm', samples = 1, load_op = 'clear', store_op = 'store',
+      stencil_load_op = 'dont care', stencil_store_op = 'dont care',
+      initial_layout = 'undefined', final_layout = 'color attachment optimal' } },
+   subpasses = { { pipeline_bind_point = 'graphics',
+      color_attachments = { { attachment = 0, layout = 'color attachment optimal' } } } },
+})
+local layout = vk.create_pipeline_layout(device, 0, nil, nil)
+local vert_module = vk.create_shader_module(device, 0, vert_code)
+local frag_module = vk.create_shader_module(device, 0, frag_code)
+
+local infos = {}
+for i, v in ipairs(variants) do
+   infos[i] = {
+      stages = {
+         { module = vert_module, stage = vk.SHADER_STAGE_VERTEX_BIT, name = 'main' },
+         { module = frag_module, stage = vk.SHADER_STAGE_FRAGMENT_BIT, name = 'main' },
+      },
+      vertex_input_state = {},
+      input_assembly_state = { topology = v.topology },
+      viewport_state = { viewport_count = 1, scissor_count = 1 },
+      rasterization_state = { polygon_mode = 'fill', line_width = 1.0,
+                              cull_mode = v.cull_mode, front_face = v.front_face },
+      multisample_state = { rasterization_samples = 1 },
+      depth_stencil_state = { depth_test_enable = v.depth_test, depth_compare_op = 'less' },
+      color_blend_state = { attachments = {
+         { color_write_mask = vk.colorcomponentflags('r','g','b','a'), blend_enable = false } } },
+      dynamic_state = { dynamic_states = { 'viewport', 'scissor' } },
+      layout = layout,
+      render_pass = render_pass,
+   }
+end
+
+local t = vk.now()
+local pipelines = vk.create_graphics_pipelines(device, nil, infos)
+local pipeline_creation = vk.since(t)
+
+vk.begin_command_buffer(cb, vk.COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT)
+t = vk.now()
+for i = 1, N do
+   vk.cmd_bind_pipeline(cb, 'graphics', pipelines[i % #pipelines + 1])
+end
+local pipeline_record = vk.since(t)
+vk.end_command_buffer(cb)
+vk.reset_command_pool(command_pool, 0)
+
+print(string.format("pipeline path:      creation %8.3f ms, recording %8.3f ms (%.3f us/change)",
+   pipeline_creation*1e3, pipeline_record*1e3, pipeline_record*1e6/N))
+
+-- Shader object path -----------------------------------------------------------
+
+if not shader_object then
+   print("shader object path: skipped (VK_EXT_shader_object not supported by the device)")
+   return
+end
+
+t = vk.now()
+local ok, shaders = pcall(vk.create_shaders, device, {
+   { stage = vk.SHADER_STAGE_VERTEX_BIT, next_stage = vk.SHADER_STAGE_FRAGMENT_BIT,
+     code_type = 'spirv', code = vert_code },
+   { stage = vk.SHADER_STAGE_FRAGMENT_BIT, code_type = 'spirv', code = frag_code },
+})
+local shader_creation = vk.since(t)
+if not ok then
+   print("shader object path: skipped ("..shaders..")")
+   return
+end
+
+vk.begin_command_buffer(cb, vk.COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT)
+vk.cmd_bind_shaders(cb, { vk.SHADER_STAGE_VERTEX_BIT, vk.SHADER_STAGE_FRAGMENT_BIT }, shaders)
+t = vk.now()
+for i = 1, N do
+   local v = variants[i % #variants + 1]
+   vk.cmd_set_cull_mode(cb, v.cull_mode)
+   vk.cmd_set_front_face(cb, v.front_face)
+   vk.cmd_set_primitive_topology(cb, v.topology)
+   vk.cmd_set_depth_test_enable(cb, v.depth_test)
+end
+local shader_record = vk.since(t)
+vk.end_command_buffer(cb)
+
+print(string.format("shader object path: creation %8.3f ms, recording %8.3f ms (%.3f us/change)",
+   shader_creation*1e3, shader_record*1e3, shader_record*1e6/N))
+
+-- Note: objects are automatically destroyed at exit so there is no need for cleanup
@@ -0,0 +1,370 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Stefano Trettel
+ *
+ * Software repository: MoonVulkan, https://github.com/stetre/moonvulkan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "internal.h"
+
+/* Pooled allocator (NONVK).
+ *
+ * A VkAllocationCallbacks implementation that serves small allocations from 
+ * per-scope pools of power-of-two size classes, and larger (or over-aligned) 
+ * allocations directly from malloc(). Each block is preceded by a small header
+ * that records its size, class and scope, so that frees and reallocations need
+ * not search for it.
+ *
+ * The callbacks may be called by the Vulkan implementation from any thread, so
+ * they use the C library's malloc() (not the Lua allocator), protect the pools'
+ * free lists with spinlocks, and update the stats atomically.
+ * Allocators are never destroyed until exit, since objects may still refer to them.
+ */
+
+#define NUM_SCOPES 5 /* VK_SYSTEM_ALLOCATION_SCOPE_COMMAND ... _INSTANCE */
+#define MIN_CLASS_SHIFT 4 /* smallest class = 16 bytes */
+#define MAX_CLASSES 13 /* largest class = 64 KiB */
+#define DEFAULT_MAX_POOLED 4096
+#define DEFAULT_CHUNK_SIZE (64*1024)
+#define MIN_SLOTS_PER_CHUNK 8
+#define HEADER_SIZE 16 /* this is also the alignment of pooled blocks */
+#define LARGE 0xffff /* class of non pooled blocks */
+
+#define ClassSize(cls) ((size_t)1 << ((cls) + MIN_CLASS_SHIFT))
+#define Header(mem) ((header_t*)((char*)(mem) - HEADER_SIZE))
+#define Lock(l) do { while(__atomic_test_and_set(&(l), __ATOMIC_ACQUIRE)) { /* spin */ } } while(0)
+#define Unlock(l) __atomic_clear(&(l), __ATOMIC_RELEASE)
+
+typedef struct {
+    size_t size; /* requested size */
+    uint32_t offset; /* offset from the start of the malloc'd area (non pooled only) */
+    uint16_t cls; /* size class, or LARGE */
+    uint8_t scope;
+} header_t;
+
+typedef struct {
+    char lock;
+    void *freelist; /* free blocks (the first word of each block links to the next) */
+    void *chunks; /* malloc'd chunks (the first word of each chunk links to the next) */
+} pool_t;
+
+typedef struct {
+    size_t bytes; /* currently allocated bytes */
+    size_t peak; /* high-water mark of bytes */
+    size_t count; /* currently allocated blocks */
+    size_t allocations; /* total number of allocations */
+    size_t pooled; /* total number of allocations served by the pools */
+    size_t internal; /* bytes of internal allocations notified by the implementation */
+} stats_t;
+
+typedef struct allocator_s {
+    VkAllocationCallbacks callbacks; /* must be the first field */
+    struct allocator_s *next;
+    size_t max_pooled; /* largest pooled size */
+    size_t chunk_size;
+    uint16_t nclasses;
+    pool_t pool[NUM_SCOPES][MAX_CLASSES];
+    stats_t stats[NUM_SCOPES];
+} allocator_t;
+
+static allocator_t *Allocators = NULL; /* list of all the allocators */
+
+/*------------------------------------------------------------------------------*
+ | Stats                                                                        |
+ *------------------------------------------------------------------------------*/
+
+static void statsadd(stats_t *stats, size_t bytes)
+    {
+    size_t peak, val = __atomic_add_fetch(&stats->bytes, bytes, __ATOMIC_RELAXED);
+    peak = __atomic_load_n(&stats->peak, __ATOMIC_RELAXED);
+    while(val > peak)
+        {
+        if(__atomic_compare_exchange_n(&stats->peak, &peak, val, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            break;
+        }
+    }
+
+static void statssub(stats_t *stats, size_t bytes)
+    {
+    __atomic_sub_fetch(&stats->bytes, bytes, __ATOMIC_RELAXED);
+    }
+
+/*------------------------------------------------------------------------------*
+ | Allocation                                                                   |
+ *------------------------------------------------------------------------------*/
+
+static void *poolalloc(allocator_t *a, pool_t *pool, uint16_t cls)
+    {
+    char *chunk, *block, *list = NULL, *tail = NULL;
+    size_t i, nslots;
+    size_t slotsize = HEADER_SIZE + ClassSize(cls);
+    void *mem;
+    Lock(pool->lock);
+    mem = pool->freelist;
+    if(mem) pool->freelist = *(void**)mem;
+    Unlock(pool->lock);
+    if(mem) return mem;
+
+    /* refill the pool with a new chunk (outside of the lock) */
+    nslots = (a->chunk_size - HEADER_SIZE) / slotsize;
+    if(nslots < MIN_SLOTS_PER_CHUNK) nslots = MIN_SLOTS_PER_CHUNK;
+    chunk = (char*)malloc(HEADER_SIZE + nslots * slotsize);
+    if(!chunk) return NULL;
+    /* keep the first block for us, and link the others */
+    for(i = nslots - 1; i > 0; i--)
+        {
+        block = chunk + HEADER_SIZE + i * slotsize + HEADER_SIZE;
+        *(void**)block = list;
+        if(!list) tail = block;
+        list = block;
+        }
+    mem = chunk + HEADER_SIZE + HEADER_SIZE;
+    Lock(pool->lock);
+    *(void**)chunk = pool->chunks;
+    pool->chunks = chunk;
+    if(list)
+        {
+        *(void**)tail = pool->freelist;
+        pool->freelist = list;
+        }
+    Unlock(pool->lock);
+    return mem;
+    }
+
+static void *allocate(allocator_t *a, size_t size, size_t alignment, unsigned scope)
+    {
+    header_t *h;
+    char *raw, *mem;
+    uint16_t cls;
+    if(scope >= NUM_SCOPES) scope = VK_SYSTEM_ALLOCATION_SCOPE_OBJECT;
+    if(alignment <= HEADER_SIZE && size <= a->max_pooled)
+        {
+        for(cls = 0; ClassSize(cls) < size; cls++);
+        mem = (char*)poolalloc(a, &a->pool[scope][cls], cls);
+        if(!mem) return NULL;
+        h = Header(mem);
+        h->offset = 0;
+        __atomic_add_fetch(&a->stats[scope].pooled, 1, __ATOMIC_RELAXED);
+        }
+    else
+        {
+        cls = LARGE;
+        if(alignment < HEADER_SIZE) alignment = HEADER_SIZE;
+        raw = (char*)malloc(size + alignment + HEADER_SIZE);
+        if(!raw) return NULL;
+        mem = (char*)(((uintptr_t)raw + HEADER_SIZE + alignment - 1) & ~((uintptr_t)alignment - 1));
+        h = Header(mem);
+        h->offset = (uint32_t)(mem - raw);
+        }
+    h->size = size;
+    h->cls = cls;
+    h->scope = (uint8_t)scope;
+    statsadd(&a->stats[scope], size);
+    __atomic_add_fetch(&a->stats[scope].count, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&a->stats[scope].allocations, 1, __ATOMIC_RELAXED);
+    return mem;
+    }
+
+static void deallocate(allocator_t *a, void *mem)
+    {
+    pool_t *pool;
+    header_t *h = Header(mem);
+    statssub(&a->stats[h->scope], h->size);
+    __atomic_sub_fetch(&a->stats[h->scope].count, 1, __ATOMIC_RELAXED);
+    if(h->cls == LARGE)
+        { free((char*)mem - h->offset); return; }
+    pool = &a->pool[h->scope][h->cls];
+    Lock(pool->lock);
+    *(void**)mem = pool->freelist;
+    pool->freelist = mem;
+    Unlock(pool->lock);
+    }
+
+/*------------------------------------------------------------------------------*
+ | Callbacks                                                                    |
+ *------------------------------------------------------------------------------*/
+
+static VKAPI_ATTR void* VKAPI_CALL Allocation
+    (void *ud, size_t size, size_t alignment, VkSystemAllocationScope scope)
+    {
+    return allocate((allocator_t*)ud, size, alignment, (unsigned)scope);
+    }
+
+static VKAPI_ATTR void* VKAPI_CALL Reallocation
+    (void *ud, void *original, size_t size, size_t alignment, VkSystemAllocationScope scope)
+    {
+    allocator_t *a = (allocator_t*)ud;
+    header_t *h;
+    void *mem;
+    if(!original) return allocate(a, size, alignment, (unsigned)scope);
+    if(size == 0) { deallocate(a, original); return NULL; }
+    h = Header(original);
+    if(h->cls != LARGE && size <= ClassSize(h->cls) && alignment <= HEADER_SIZE)
+        { /* it still fits in its block */
+        if(size > h->size)
+            statsadd(&a->stats[h->scope], size - h->size);
+        else
+            statssub(&a->stats[h->scope], h->size - size);
+        h->size = size;
+        return original;
+        }
+    /* on failure, the original block must be left untouched */
+    mem = allocate(a, size, alignment, (unsigned)scope);
+    if(!mem) return NULL;
+    memcpy(mem, original, size < h->size ? size : h->size);
+    deallocate(a, original);
+    return mem;
+    }
+
+static VKAPI_ATTR void VKAPI_CALL Deallocation(void *ud, void *mem)
+    {
+    if(mem) deallocate((allocator_t*)ud, mem);
+    }
+
+static VKAPI_ATTR void VKAPI_CALL InternalAllocation
+    (void* ud, size_t size, VkInternalAllocationType type, VkSystemAllocationScope scope)
+    {
+    allocator_t *a = (allocator_t*)ud;
+    (void)type;
+    if((unsigned)scope < NUM_SCOPES)
+        __atomic_add_fetch(&a->stats[scope].internal, size, __ATOMIC_RELAXED);
+    }
+
+static VKAPI_ATTR void VKAPI_CALL InternalFree
+    (void* ud, size_t size, VkInternalAllocationType type, VkSystemAllocationScope scope)
+    {
+    allocator_t *a = (allocator_t*)ud;
+    (void)type;
+    if((unsigned)scope < NUM_SCOPES)
+        __atomic_sub_fetch(&a->stats[scope].internal, size, __ATOMIC_RELAXED);
+    }
+
+/*------------------------------------------------------------------------------*
+ | Functions                                                                    |
+ *------------------------------------------------------------------------------*/
+
+static allocator_t *checkallocator(lua_State *L, int arg)
+    {
+    allocator_t *a;
+    void *p = checklightuserdata(L, arg);
+    for(a = Allocators; a != NULL; a = a->next)
+        if(p == (void*)&a->callbacks) return a;
+    luaL_argerror(L, arg, "not a moonvulkan allocator");
+    return NULL;
+    }
+
+static int Create(lua_State *L)
+    {
+    allocator_t *a;
+    size_t max_pooled = DEFAULT_MAX_POOLED;
+    size_t chunk_size = DEFAULT_CHUNK_SIZE;
+    lua_Integer n;
+    if(!lua_isnoneornil(L, 1))
+        {
+        luaL_checktype(L, 1, LUA_TTABLE);
+        lua_getfield(L, 1, "max_pooled_size");
+        max_pooled = luaL_optinteger(L, -1, DEFAULT_MAX_POOLED);
+        lua_pop(L, 1);
+        lua_getfield(L, 1, "chunk_size");
+        n = luaL_optinteger(L, -1, DEFAULT_CHUNK_SIZE);
+        lua_pop(L, 1);
+        /* a chunk must hold at least its header and one block of the smallest class */
+        if(n < (lua_Integer)(2*HEADER_SIZE + ClassSize(0)))
+            return argerrorc(L, 1, ERR_VALUE);
+        chunk_size = (size_t)n;
+        if(max_pooled > ClassSize(MAX_CLASSES - 1))
+            return luaL_argerror(L, 1, "max_pooled_size is too large");
+        }
+    a = (allocator_t*)calloc(1, sizeof(allocator_t));
+    if(!a) return errmemory(L);
+    a->max_pooled = max_pooled;
+    a->chunk_size = chunk_size;
+    a->callbacks.pUserData = a;
+    a->callbacks.pfnAllocation = Allocation;
+    a->callbacks.pfnReallocation = Reallocation;
+    a->callbacks.pfnFree = Deallocation;
+    a->callbacks.pfnInternalAllocation = InternalAllocation;
+    a->callbacks.pfnInternalFree = InternalFree;
+    a->next = Allocators;
+    Allocators = a;
+    lua_pushlightuserdata(L, &a->callbacks);
+    return 1;
+    }
+
+static int Stats(lua_State *L)
+    {
+    unsigned scope;
+    stats_t *stats;
+    allocator_t *a = checkallocator(L, 1);
+    lua_newtable(L);
+    for(scope = 0; scope < NUM_SCOPES; scope++)
+        {
+        stats = &a->stats[scope];
+        lua_newtable(L);
+#define Set(name, field) do {                                               \
+    lua_pushinteger(L, __atomic_load_n(&stats->field, __ATOMIC_RELAXED));   \
+    lua_setfield(L, -2, name);                                              \
+} while(0)
+        Set("bytes", bytes);
+        Set("peak", peak);
+        Set("count", count);
+        Set("allocations", allocations);
+        Set("pooled", pooled);
+        Set("internal", internal);
+#undef Set
+        pushsystemallocationscope(L, scope);
+        lua_insert(L, -2);
+        lua_settable(L, -3);
+        }
+    return 1;
+    }
+
+void moonvulkan_atexit_allocator(void)
+    {
+    allocator_t *a;
+    void *chunk;
+    unsigned scope, cls;
+    while((a = Allocators))
+        {
+        Allocators = a->next;
+        for(scope = 0; scope < NUM_SCOPES; scope++)
+            for(cls = 0; cls < MAX_CLASSES; cls++)
+                while((chunk = a->pool[scope][cls].chunks))
+                    {
+                    a->pool[scope][cls].chunks = *(void**)chunk;
+                    free(chunk);
+                    }
+        free(a);
+        }
+    }
+
+static const struct luaL_Reg Functions[] = 
+    {
+        { "allocator", Create },
+        { "allocator_stats", Stats },
+        { NULL, NULL } /* sentinel */
+    };
+
+void moonvulkan_open_allocator(lua_State *L)
+    {
+    luaL_setfuncs(L, Functions, 0);
+    }
+
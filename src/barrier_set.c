@@ -0,0 +1,329 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Stefano Trettel
+ *
+ * Software repository: MoonVulkan, https://github.com/stetre/moonvulkan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "internal.h"
+
+/* Barrier sets (NONVK).
+ *
+ * A barrier set holds a VkDependencyInfo, with its memory, buffer and image barriers,
+ * converted once at creation. The resources and layouts of its buffer and image
+ * barriers can be patched in place, and the set is recorded with a single call to
+ * vkCmdPipelineBarrier2 with no conversion, so that barrier patterns that repeat
+ * every frame do not need to be rebuilt from Lua tables each time.
+ * On devices without synchronization2, the set is converted to synchronization1
+ * barriers when recorded (see cmdbarrier1).
+ *
+ * The set is a child of the device, so it is destroyed together with it.
+ */
+
+static int freebarrier_set(lua_State *L, ud_t *ud)
+    {
+    uint64_t handle = ud->handle;
+    VkDependencyInfoKHR *info = (VkDependencyInfoKHR*)ud->info;
+    if(!IsValid(ud)) return 0; /* double call */
+    zfreeVkDependencyInfoKHR(L, info, 0);
+    freeuserdata(L, ud); /* this also frees the info */
+    TRACE_DELETE(handle, "barrier_set");
+    return 0;
+    }
+
+static int Create(lua_State *L)
+/* create_barrier_set(device, dependencyinfo) */
+    {
+    int err;
+    ud_t *ud, *device_ud;
+    VkDependencyInfoKHR *info;
+    VkDevice device = checkdevice(L, 1, &device_ud);
+    info = zcheckVkDependencyInfoKHR(L, 2, &err);
+    if(err) { zfreeVkDependencyInfoKHR(L, info, 1); return argerror(L, 2); }
+    TRACE_CREATE(info, "barrier_set");
+    ud = newuserdata_nondispatchable(L, (uintptr_t)info, BARRIER_SET_MT);
+    ud->parent_ud = device_ud;
+    ud->device = device;
+    ud->instance = device_ud->instance;
+    ud->destructor = freebarrier_set;
+    ud->ddt = device_ud->ddt;
+    ud->info = info;
+    return 1;
+    }
+
+static VkDependencyInfoKHR *checkset(lua_State *L, int arg, ud_t **udp)
+    {
+    ud_t *ud;
+    (void)checkbarrier_set(L, arg, &ud);
+    if(udp) *udp = ud;
+    return (VkDependencyInfoKHR*)ud->info;
+    }
+
+static uint32_t checkindex(lua_State *L, int arg, uint32_t count)
+/* Checks the (1-based) position of a barrier in its list, and returns its index */
+    {
+    lua_Integer index = luaL_checkinteger(L, arg);
+    if(index < 1 || (lua_Integer)count < index) return (uint32_t)argerrorc(L, arg, ERR_VALUE);
+    return (uint32_t)(index - 1);
+    }
+
+static int SetImage(lua_State *L)
+/* barrier_set_image(set, index, [image], [old_layout], [new_layout], [subresource_range]) */
+    {
+    int err;
+    VkImageSubresourceRange *range;
+    VkDependencyInfoKHR *info = checkset(L, 1, NULL);
+    uint32_t i = checkindex(L, 2, info->imageMemoryBarrierCount);
+    VkImageMemoryBarrier2KHR *p = (VkImageMemoryBarrier2KHR*)&info->pImageMemoryBarriers[i];
+    /* check all the arguments before changing the barrier */
+    VkImage image = lua_isnoneornil(L, 3) ? p->image : checkimage(L, 3, NULL);
+    VkImageLayout old_layout = lua_isnoneornil(L, 4) ? p->oldLayout : checkimagelayout(L, 4);
+    VkImageLayout new_layout = lua_isnoneornil(L, 5) ? p->newLayout : checkimagelayout(L, 5);
+    if(!lua_isnoneornil(L, 6))
+        {
+        range = zcheckVkImageSubresourceRange(L, 6, &err);
+        if(err) { zfreeVkImageSubresourceRange(L, range, 1); return argerror(L, 6); }
+        p->subresourceRange = *range;
+        zfreeVkImageSubresourceRange(L, range, 1);
+        }
+    p->image = image;
+    p->oldLayout = old_layout;
+    p->newLayout = new_layout;
+    return 0;
+    }
+
+static int SetBuffer(lua_State *L)
+/* barrier_set_buffer(set, index, [buffer], [offset], [size]) */
+    {
+    VkDependencyInfoKHR *info = checkset(L, 1, NULL);
+    uint32_t i = checkindex(L, 2, info->bufferMemoryBarrierCount);
+    VkBufferMemoryBarrier2KHR *p = (VkBufferMemoryBarrier2KHR*)&info->pBufferMemoryBarriers[i];
+    /* check all the arguments before changing the barrier */
+    VkBuffer buffer = lua_isnoneornil(L, 3) ? p->buffer : checkbuffer(L, 3, NULL);
+    VkDeviceSize offset = lua_isnoneornil(L, 4) ? p->offset : (VkDeviceSize)luaL_checkinteger(L, 4);
+    VkDeviceSize size = lua_isnoneornil(L, 5) ? p->size : checksizeorwholesize(L, 5);
+    p->buffer = buffer;
+    p->offset = offset;
+    p->size = size;
+    return 0;
+    }
+
+static int Count(lua_State *L)
+/* memory_count, buffer_count, image_count = barrier_set_count(set) */
+    {
+    VkDependencyInfoKHR *info = checkset(L, 1, NULL);
+    lua_pushinteger(L, info->memoryBarrierCount);
+    lua_pushinteger(L, info->bufferMemoryBarrierCount);
+    lua_pushinteger(L, info->imageMemoryBarrierCount);
+    return 3;
+    }
+
+#define SYNC2_ONLY 0xFFFFFFFF00000000ULL /* stage and access bits with no synchronization1 equivalent */
+
+static int sync1masks(const VkDependencyInfoKHR *info, VkPipelineStageFlags *src, VkPipelineStageFlags *dst)
+/* ORs the stage masks of all the barriers, and checks that they and the access masks
+ * can be expressed with synchronization1. Returns 0 on success, or ERR_VALUE. */
+    {
+    uint32_t i;
+    VkFlags64 srcmask = 0, dstmask = 0, access = 0;
+    for(i = 0; i < info->memoryBarrierCount; i++)
+        {
+        srcmask |= info->pMemoryBarriers[i].srcStageMask;
+        dstmask |= info->pMemoryBarriers[i].dstStageMask;
+        access |= info->pMemoryBarriers[i].srcAccessMask | info->pMemoryBarriers[i].dstAccessMask;
+        }
+    for(i = 0; i < info->bufferMemoryBarrierCount; i++)
+        {
+        srcmask |= info->pBufferMemoryBarriers[i].srcStageMask;
+        dstmask |= info->pBufferMemoryBarriers[i].dstStageMask;
+        access |= info->pBufferMemoryBarriers[i].srcAccessMask | info->pBufferMemoryBarriers[i].dstAccessMask;
+        }
+    for(i = 0; i < info->imageMemoryBarrierCount; i++)
+        {
+        srcmask |= info->pImageMemoryBarriers[i].srcStageMask;
+        dstmask |= info->pImageMemoryBarriers[i].dstStageMask;
+        access |= info->pImageMemoryBarriers[i].srcAccessMask | info->pImageMemoryBarriers[i].dstAccessMask;
+        }
+    if((srcmask | dstmask | access) & SYNC2_ONLY) return ERR_VALUE;
+    /* a zero mask (VK_PIPELINE_STAGE_2_NONE) is not allowed in synchronization1 */
+    *src = srcmask ? (VkPipelineStageFlags)srcmask : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    *dst = dstmask ? (VkPipelineStageFlags)dstmask : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+    return 0;
+    }
+
+static int cmdbarrier1(lua_State *L, ud_t *ud, VkCommandBuffer cb, const VkDependencyInfoKHR *info)
+/* Records the set with vkCmdPipelineBarrier, for devices without synchronization2.
+ * Synchronization1 has a single pair of stage masks for the whole command, so the
+ * per-barrier stage masks are OR'ed together: this is correct, but may synchronize
+ * more than the set would with synchronization2. */
+    {
+    uint32_t i;
+    int err;
+    VkPipelineStageFlags src, dst;
+    VkMemoryBarrier *mb = NULL;
+    VkBufferMemoryBarrier *bb = NULL;
+    VkImageMemoryBarrier *ib = NULL;
+    err = sync1masks(info, &src, &dst);
+    if(err) return argerrorc(L, 2, err);
+#define CLEANUP do {                \
+    if(mb) Free(L, mb);             \
+    if(bb) Free(L, bb);             \
+    if(ib) Free(L, ib);             \
+} while(0)
+    if(info->memoryBarrierCount > 0)
+        {
+        mb = (VkMemoryBarrier*)MallocNoErr(L, info->memoryBarrierCount*sizeof(VkMemoryBarrier));
+        if(!mb) { CLEANUP; return errmemory(L); }
+        }
+    if(info->bufferMemoryBarrierCount > 0)
+        {
+        bb = (VkBufferMemoryBarrier*)MallocNoErr(L, info->bufferMemoryBarrierCount*sizeof(VkBufferMemoryBarrier));
+        if(!bb) { CLEANUP; return errmemory(L); }
+        }
+    if(info->imageMemoryBarrierCount > 0)
+        {
+        ib = (VkImageMemoryBarrier*)MallocNoErr(L, info->imageMemoryBarrierCount*sizeof(VkImageMemoryBarrier));
+        if(!ib) { CLEANUP; return errmemory(L); }
+        }
+    for(i = 0; i < info->memoryBarrierCount; i++)
+        {
+        const VkMemoryBarrier2KHR *p = &info->pMemoryBarriers[i];
+        mb[i].sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        mb[i].pNext = p->pNext;
+        mb[i].srcAccessMask = (VkAccessFlags)p->srcAccessMask;
+        mb[i].dstAccessMask = (VkAccessFlags)p->dstAccessMask;
+        }
+    for(i = 0; i < info->bufferMemoryBarrierCount; i++)
+        {
+        const VkBufferMemoryBarrier2KHR *p = &info->pBufferMemoryBarriers[i];
+        bb[i].sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        bb[i].pNext = p->pNext;
+        bb[i].srcAccessMask = (VkAccessFlags)p->srcAccessMask;
+        bb[i].dstAccessMask = (VkAccessFlags)p->dstAccessMask;
+        bb[i].srcQueueFamilyIndex = p->srcQueueFamilyIndex;
+        bb[i].dstQueueFamilyIndex = p->dstQueueFamilyIndex;
+        bb[i].buffer = p->buffer;
+        bb[i].offset = p->offset;
+        bb[i].size = p->size;
+        }
+    for(i = 0; i < info->imageMemoryBarrierCount; i++)
+        {
+        const VkImageMemoryBarrier2KHR *p = &info->pImageMemoryBarriers[i];
+        ib[i].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        ib[i].pNext = p->pNext;
+        ib[i].srcAccessMask = (VkAccessFlags)p->srcAccessMask;
+        ib[i].dstAccessMask = (VkAccessFlags)p->dstAccessMask;
+        ib[i].oldLayout = p->oldLayout;
+        ib[i].newLayout = p->newLayout;
+        ib[i].srcQueueFamilyIndex = p->srcQueueFamilyIndex;
+        ib[i].dstQueueFamilyIndex = p->dstQueueFamilyIndex;
+        ib[i].image = p->image;
+        ib[i].subresourceRange = p->subresourceRange;
+        }
+    ud->ddt->CmdPipelineBarrier(cb, src, dst, info->dependencyFlags,
+        info->memoryBarrierCount, mb, info->bufferMemoryBarrierCount, bb, info->imageMemoryBarrierCount, ib);
+    CLEANUP;
+#undef CLEANUP
+    return 0;
+    }
+
+static int CmdBarrierSet(lua_State *L)
+/* cmd_barrier_set(cb, set) */
+    {
+    ud_t *ud;
+    VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
+    VkDependencyInfoKHR *info = checkset(L, 2, NULL);
+    if(!ud->ddt->CmdPipelineBarrier2KHR)
+        return cmdbarrier1(L, ud, cb, info);
+    ud->ddt->CmdPipelineBarrier2KHR(cb, info);
+    return 0;
+    }
+
+static int Type(lua_State *L)
+    {
+    (void)checkbarrier_set(L, 1, NULL);
+    lua_pushstring(L, "barrier_set");
+    return 1;
+    }
+
+static int Instance(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkbarrier_set(L, 1, &ud);
+    return pushinstance(L, ud->instance);
+    }
+
+static int Device(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkbarrier_set(L, 1, &ud);
+    return pushdevice(L, ud->device);
+    }
+
+static int Delete(lua_State *L)
+    {
+    ud_t *ud;
+    (void)testbarrier_set(L, 1, &ud);
+    if(!ud) return 0; /* already deleted */
+    return ud->destructor(L, ud);
+    }
+
+static int Destroy(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkbarrier_set(L, 1, &ud);
+    return ud->destructor(L, ud);
+    }
+
+static const struct luaL_Reg Methods[] = 
+    {
+        { "type", Type },
+        { "instance", Instance },
+        { "device", Device },
+        { "image", SetImage },
+        { "buffer", SetBuffer },
+        { "count", Count },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg MetaMethods[] = 
+    {
+        { "__gc",  Delete },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg Functions[] = 
+    {
+        { "create_barrier_set",  Create },
+        { "destroy_barrier_set",  Destroy },
+        { "barrier_set_image", SetImage },
+        { "barrier_set_buffer", SetBuffer },
+        { "barrier_set_count", Count },
+        { "cmd_barrier_set", CmdBarrierSet },
+        { NULL, NULL } /* sentinel */
+    };
+
+void moonvulkan_open_barrier_set(lua_State *L)
+    {
+    udata_define(L, BARRIER_SET_MT, Methods, MetaMethods);
+    luaL_setfuncs(L, Functions, 0);
+    }
+
@@ -0,0 +1,521 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Stefano Trettel
+ *
+ * Software repository: MoonVulkan, https://github.com/stetre/moonvulkan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "internal.h"
+
+/* Bindless tables (NONVK).
+ *
+ * A bindless table manages the array elements ('slots') of the bindings of a large,
+ * typically update-after-bind, descriptor set. Slots are allocated from per-binding
+ * free-lists, and the descriptors written in them are queued and submitted all
+ * together with a single vkUpdateDescriptorSets() on flush. Released slots are not
+ * reused until the frame they were released in is retired, i.e. until the device is
+ * known to be no longer using them.
+ *
+ * The table is a child of the descriptor set, so it is destroyed together with it
+ * (i.e. also when the set is freed, or its pool is reset or destroyed).
+ */
+
+#define KIND_IMAGE  1
+#define KIND_BUFFER 2
+#define KIND_VIEW   3
+
+#define ISALLOCATED(b, slot) ((b)->allocated[(slot)/32] & (1U << ((slot)%32)))
+#define SETALLOCATED(b, slot) do { (b)->allocated[(slot)/32] |= (1U << ((slot)%32)); } while(0)
+#define CLRALLOCATED(b, slot) do { (b)->allocated[(slot)/32] &= ~(1U << ((slot)%32)); } while(0)
+
+typedef struct {
+    uint32_t slot;
+    uint64_t frame; /* the slot can be reused when this frame is retired */
+} deferred_t;
+
+typedef struct {
+    uint32_t binding;
+    VkDescriptorType type;
+    int kind;
+    uint32_t count; /* number of slots (descriptorCount) */
+    uint32_t next; /* slots >= next have never been allocated */
+    uint32_t used;
+    uint32_t *allocated; /* bitmap of the allocated (i.e. registered and not released) slots */
+    uint32_t *free; /* stack of free slots (below next) */
+    uint32_t nfree, maxfree;
+    deferred_t *deferred;
+    uint32_t ndeferred, maxdeferred;
+} bbinding_t;
+
+typedef struct {
+    uint32_t b; /* index in table->binding */
+    uint32_t slot;
+    union {
+        VkDescriptorImageInfo image;
+        VkDescriptorBufferInfo buffer;
+        VkBufferView view;
+    } info;
+} pending_t;
+
+typedef struct {
+    VkDescriptorSet descriptor_set;
+    bbinding_t *binding;
+    uint32_t nbindings;
+    pending_t *pending;
+    uint32_t npending, maxpending;
+    VkWriteDescriptorSet *write;
+    uint32_t maxwrites;
+    uint64_t flushes, writes; /* statistics */
+} table_t;
+
+static int kindof(VkDescriptorType type)
+    {
+    switch(type)
+        {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: return KIND_IMAGE;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: return KIND_VIEW;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: return KIND_BUFFER;
+        default: return 0;
+        }
+    }
+
+static int grow(lua_State *L, void **array, uint32_t *max, uint32_t needed, size_t elsize)
+/* Grows the array (doubling its size) so that it can contain at least 'needed'
+ * elements, preserving its contents. Returns ERR_MEMORY on failure. */
+    {
+    void *p;
+    uint32_t n = *max > 0 ? *max : 16;
+    if(needed <= *max) return 0;
+    while(n < needed) n *= 2;
+    p = MallocNoErr(L, n*elsize);
+    if(!p) return ERR_MEMORY;
+    if(*array)
+        {
+        memcpy(p, *array, (*max)*elsize);
+        Free(L, *array);
+        }
+    *array = p;
+    *max = n;
+    return 0;
+    }
+
+static void freetable(lua_State *L, table_t *table)
+    {
+    uint32_t i;
+    if(table->binding)
+        {
+        for(i = 0; i < table->nbindings; i++)
+            {
+            Free(L, table->binding[i].allocated);
+            Free(L, table->binding[i].free);
+            Free(L, table->binding[i].deferred);
+            }
+        Free(L, table->binding);
+        }
+    Free(L, table->pending);
+    Free(L, table->write);
+    }
+
+static int freebindless_table(lua_State *L, ud_t *ud)
+    {
+    uint64_t handle = ud->handle;
+    table_t *table = (table_t*)ud->info;
+    if(!IsValid(ud)) return 0; /* double call */
+    freetable(L, table);
+    freeuserdata(L, ud); /* this also frees the table_t */
+    TRACE_DELETE(handle, "bindless_table");
+    return 0;
+    }
+
+static int freeifpool(lua_State *L, const void *mem, const char *mt, const void *pool_ud)
+/* callback for udata_scan */
+    {
+    ud_t *ud = (ud_t*)mem;
+    (void)mt;
+    if(IsValid(ud) && (ud->parent_ud->parent_ud == pool_ud))
+        ud->destructor(L, ud);
+    return 0;
+    }
+
+void freebindless_tables(lua_State *L, ud_t *pool_ud)
+/* Destroys the tables of all the descriptor sets allocated from the given pool
+ * (called when the pool is reset, since the set userdata survive the reset) */
+    {
+    udata_scan(L, BINDLESS_TABLE_MT, pool_ud, freeifpool);
+    }
+
+static int checkbindings(lua_State *L, int arg, table_t *table)
+/* {{ binding=integer, descriptor_type=descriptortype, descriptor_count=integer }}
+ * Returns an ERR_XXX code (does not raise errors, since table->binding is allocated) */
+    {
+    int err;
+    uint32_t i, j;
+    bbinding_t *b;
+    if(!lua_istable(L, arg)) return ERR_TABLE;
+    table->nbindings = luaL_len(L, arg);
+    if(table->nbindings == 0) return ERR_EMPTY;
+    table->binding = (bbinding_t*)MallocNoErr(L, table->nbindings*sizeof(bbinding_t));
+    if(!table->binding) return ERR_MEMORY;
+    for(i = 0; i < table->nbindings; i++)
+        {
+        b = &table->binding[i];
+        lua_rawgeti(L, arg, i+1);
+        if(!lua_istable(L, -1)) { lua_pop(L, 1); return ERR_TABLE; }
+        lua_getfield(L, -1, "binding");
+        b->binding = testinteger(L, -1, i, &err);
+        if(err) { lua_pop(L, 2); return err; }
+        lua_getfield(L, -2, "descriptor_count");
+        b->count = testinteger(L, -1, 0, &err);
+        if(err) { lua_pop(L, 3); return err; }
+        lua_getfield(L, -3, "descriptor_type");
+        b->type = testdescriptortype(L, -1, &err);
+        lua_pop(L, 4);
+        if(err) return err;
+        b->kind = kindof(b->type);
+        if(b->kind == 0 || b->count == 0) return ERR_VALUE;
+        for(j = 0; j < i; j++)
+            if(table->binding[j].binding == b->binding) return ERR_VALUE; /* duplicate */
+        b->allocated = (uint32_t*)MallocNoErr(L, ((b->count + 31)/32)*sizeof(uint32_t));
+        if(!b->allocated) return ERR_MEMORY;
+        }
+    return 0;
+    }
+
+static int Create(lua_State *L)
+/* create_bindless_table(descriptor_set, {bindlessbinding}) */
+    {
+    int err;
+    ud_t *ud, *set_ud;
+    table_t *table;
+    VkDescriptorSet descriptor_set = checkdescriptor_set(L, 1, &set_ud);
+    table = (table_t*)Malloc(L, sizeof(table_t));
+    table->descriptor_set = descriptor_set;
+    err = checkbindings(L, 2, table);
+    if(err) { freetable(L, table); Free(L, table); return argerrorc(L, 2, err); }
+    TRACE_CREATE(table, "bindless_table");
+    ud = newuserdata_nondispatchable(L, (uintptr_t)table, BINDLESS_TABLE_MT);
+    ud->parent_ud = set_ud;
+    ud->device = set_ud->device;
+    ud->instance = set_ud->instance;
+    ud->destructor = freebindless_table;
+    ud->ddt = set_ud->ddt;
+    ud->info = table;
+    return 1;
+    }
+
+static table_t *checktable(lua_State *L, int arg, ud_t **udp)
+    {
+    ud_t *ud;
+    (void)checkbindless_table(L, arg, &ud);
+    if(udp) *udp = ud;
+    return (table_t*)ud->info;
+    }
+
+static uint32_t checkbinding(lua_State *L, int arg, table_t *table)
+/* Returns the index in table->binding of the binding at arg */
+    {
+    uint32_t i;
+    uint32_t binding = luaL_checkinteger(L, arg);
+    for(i = 0; i < table->nbindings; i++)
+        if(table->binding[i].binding == binding) return i;
+    return (uint32_t)argerrorc(L, arg, ERR_VALUE);
+    }
+
+static uint32_t checkslot(lua_State *L, int arg, bbinding_t *b)
+/* Checks that the slot at arg is allocated */
+    {
+    uint32_t slot = luaL_checkinteger(L, arg);
+    if(slot >= b->count || !ISALLOCATED(b, slot)) return (uint32_t)argerrorc(L, arg, ERR_VALUE);
+    return slot;
+    }
+
+static int queuewrite(lua_State *L, int arg, table_t *table, uint32_t i, uint32_t slot)
+/* Queues the write of the descriptor info at arg in the given slot */
+    {
+    int err = 0;
+    pending_t *p;
+    bbinding_t *b = &table->binding[i];
+    if(grow(L, (void**)&table->pending, &table->maxpending, table->npending + 1, sizeof(pending_t)))
+        return errmemory(L);
+    p = &table->pending[table->npending];
+    p->b = i;
+    p->slot = slot;
+    switch(b->kind)
+        {
+        case KIND_IMAGE: err = descriptorimageinfo(L, arg, &p->info.image); break;
+        case KIND_BUFFER: err = descriptorbufferinfo(L, arg, &p->info.buffer); break;
+        case KIND_VIEW: 
+            p->info.view = testbuffer_view(L, arg, NULL);
+            if(!p->info.view) err = ERR_TYPE;
+            break;
+        }
+    if(err) return argerrorc(L, arg, err);
+    table->npending++;
+    return 0;
+    }
+
+static int Register(lua_State *L)
+/* slot = bindless_table_register(table, binding, info)
+ * Allocates a slot and queues the write of the descriptor in it.
+ * Returns nil if there are no free slots for the binding. */
+    {
+    uint32_t slot;
+    bbinding_t *b;
+    table_t *table = checktable(L, 1, NULL);
+    uint32_t i = checkbinding(L, 2, table);
+    b = &table->binding[i];
+    if(b->nfree > 0)
+        slot = b->free[b->nfree - 1];
+    else if(b->next < b->count)
+        slot = b->next;
+    else
+        { lua_pushnil(L); return 1; }
+    queuewrite(L, 3, table, i, slot); /* may raise an error, so commit after it */
+    if(b->nfree > 0) b->nfree--; else b->next++;
+    SETALLOCATED(b, slot);
+    b->used++;
+    lua_pushinteger(L, slot);
+    return 1;
+    }
+
+static int Update(lua_State *L)
+/* bindless_table_update(table, binding, slot, info) */
+    {
+    table_t *table = checktable(L, 1, NULL);
+    uint32_t i = checkbinding(L, 2, table);
+    uint32_t slot = checkslot(L, 3, &table->binding[i]);
+    return queuewrite(L, 4, table, i, slot);
+    }
+
+static int Release(lua_State *L)
+/* bindless_table_release(table, binding, slot, frame)
+ * The slot will be reused only after the given frame has been retired. */
+    {
+    uint32_t j, k;
+    deferred_t *d;
+    bbinding_t *b;
+    table_t *table = checktable(L, 1, NULL);
+    uint32_t i = checkbinding(L, 2, table);
+    uint32_t slot = checkslot(L, 3, &table->binding[i]);
+    uint64_t frame = luaL_checkinteger(L, 4);
+    b = &table->binding[i];
+    if(grow(L, (void**)&b->deferred, &b->maxdeferred, b->ndeferred + 1, sizeof(deferred_t)))
+        return errmemory(L);
+    d = &b->deferred[b->ndeferred++];
+    d->slot = slot;
+    d->frame = frame;
+    CLRALLOCATED(b, slot);
+    b->used--;
+    /* drop the writes still queued for the slot, so that a flush does not write
+     * a released slot (that may meanwhile be reused) */
+    for(j = k = 0; j < table->npending; j++)
+        {
+        if(table->pending[j].b == i && table->pending[j].slot == slot) continue;
+        table->pending[k++] = table->pending[j];
+        }
+    table->npending = k;
+    return 0;
+    }
+
+static int Retire(lua_State *L)
+/* bindless_table_retire(table, completed_frame)
+ * Makes the slots released in frames up to completed_frame available for reuse. */
+    {
+    uint32_t i, j, k;
+    bbinding_t *b;
+    table_t *table = checktable(L, 1, NULL);
+    uint64_t completed = luaL_checkinteger(L, 2);
+    for(i = 0; i < table->nbindings; i++)
+        {
+        b = &table->binding[i];
+        if(b->ndeferred == 0) continue;
+        if(grow(L, (void**)&b->free, &b->maxfree, b->nfree + b->ndeferred, sizeof(uint32_t)))
+            return errmemory(L);
+        for(j = 0, k = 0; j < b->ndeferred; j++)
+            {
+            if(b->deferred[j].frame <= completed)
+                b->free[b->nfree++] = b->deferred[j].slot;
+            else
+                b->deferred[k++] = b->deferred[j];
+            }
+        b->ndeferred = k;
+        }
+    return 0;
+    }
+
+static int Flush(lua_State *L)
+/* n = bindless_table_flush(table)
+ * Writes all the queued descriptors with a single vkUpdateDescriptorSets(). */
+    {
+    ud_t *ud;
+    uint32_t i, n;
+    pending_t *p;
+    VkWriteDescriptorSet *w;
+    table_t *table = checktable(L, 1, &ud);
+    n = table->npending;
+    if(n > 0)
+        {
+        if(grow(L, (void**)&table->write, &table->maxwrites, n, sizeof(VkWriteDescriptorSet)))
+            return errmemory(L);
+        for(i = 0; i < n; i++)
+            {
+            p = &table->pending[i];
+            w = &table->write[i];
+            memset(w, 0, sizeof(VkWriteDescriptorSet));
+            w->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            w->dstSet = table->descriptor_set;
+            w->dstBinding = table->binding[p->b].binding;
+            w->dstArrayElement = p->slot;
+            w->descriptorCount = 1;
+            w->descriptorType = table->binding[p->b].type;
+            switch(table->binding[p->b].kind)
+                {
+                case KIND_IMAGE: w->pImageInfo = &p->info.image; break;
+                case KIND_BUFFER: w->pBufferInfo = &p->info.buffer; break;
+                case KIND_VIEW: w->pTexelBufferView = &p->info.view; break;
+                }
+            }
+        ud->ddt->UpdateDescriptorSets(ud->device, n, table->write, 0, NULL);
+        table->npending = 0;
+        table->flushes++;
+        table->writes += n;
+        }
+    lua_pushinteger(L, n);
+    return 1;
+    }
+
+static int Stats(lua_State *L)
+    {
+    uint32_t i;
+    bbinding_t *b;
+    table_t *table = checktable(L, 1, NULL);
+    lua_newtable(L);
+    lua_pushinteger(L, table->npending); lua_setfield(L, -2, "pending");
+    lua_pushinteger(L, table->flushes); lua_setfield(L, -2, "flushes");
+    lua_pushinteger(L, table->writes); lua_setfield(L, -2, "writes");
+    lua_createtable(L, table->nbindings, 0);
+    for(i = 0; i < table->nbindings; i++)
+        {
+        b = &table->binding[i];
+        lua_createtable(L, 0, 5);
+        lua_pushinteger(L, b->binding); lua_setfield(L, -2, "binding");
+        lua_pushinteger(L, b->count); lua_setfield(L, -2, "capacity");
+        lua_pushinteger(L, b->used); lua_setfield(L, -2, "used");
+        lua_pushinteger(L, b->nfree + (b->count - b->next)); lua_setfield(L, -2, "free");
+        lua_pushinteger(L, b->ndeferred); lua_setfield(L, -2, "deferred");
+        lua_rawseti(L, -2, i+1);
+        }
+    lua_setfield(L, -2, "bindings");
+    return 1;
+    }
+
+static int DescriptorSet(lua_State *L)
+    {
+    table_t *table = checktable(L, 1, NULL);
+    lua_pushinteger(L, (lua_Integer)(uintptr_t)table->descriptor_set); /* raw handle */
+    return 1;
+    }
+
+static int Type(lua_State *L)
+    {
+    (void)checkbindless_table(L, 1, NULL);
+    lua_pushstring(L, "bindless_table");
+    return 1;
+    }
+
+static int Instance(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkbindless_table(L, 1, &ud);
+    return pushinstance(L, ud->instance);
+    }
+
+static int Device(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkbindless_table(L, 1, &ud);
+    return pushdevice(L, ud->device);
+    }
+
+static int Delete(lua_State *L)
+    {
+    ud_t *ud;
+    (void)testbindless_table(L, 1, &ud);
+    if(!ud) return 0; /* already deleted */
+    return ud->destructor(L, ud);
+    }
+
+static int Destroy(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkbindless_table(L, 1, &ud);
+    return ud->destructor(L, ud);
+    }
+
+static const struct luaL_Reg Methods[] = 
+    {
+        { "type", Type },
+        { "instance", Instance },
+        { "device", Device },
+        { "register", Register },
+        { "update", Update },
+        { "release", Release },
+        { "retire", Retire },
+        { "flush", Flush },
+        { "stats", Stats },
+        { "descriptor_set", DescriptorSet },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg MetaMethods[] = 
+    {
+        { "__gc",  Delete },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg Functions[] = 
+    {
+        { "create_bindless_table",  Create },
+        { "destroy_bindless_table",  Destroy },
+        { "bindless_table_register", Register },
+        { "bindless_table_update", Update },
+        { "bindless_table_release", Release },
+        { "bindless_table_retire", Retire },
+        { "bindless_table_flush", Flush },
+        { "bindless_table_stats", Stats },
+        { "bindless_table_descriptor_set", DescriptorSet },
+        { NULL, NULL } /* sentinel */
+    };
+
+void moonvulkan_open_bindless_table(lua_State *L)
+    {
+    udata_define(L, BINDLESS_TABLE_MT, Methods, MetaMethods);
+    luaL_setfuncs(L, Functions, 0);
+    }
+
@@ -24,13 +24,136 @@
  */
 
 #include "internal.h"
-    
+
+/*------------------------------------------------------------------------------*
+ | Redundant state filtering (see cbstate_t in objects.h)                       |
+ *------------------------------------------------------------------------------*/
+
+/* The filterxxx() functions are called only if the filter is enabled on the command buffer.
+ * They return 1 if the call is redundant (and must be skipped), otherwise they update the
+ * tracked state as the call will do, and return 0.
+ */
+
+#define BIT(i) (1U << (i))
+#define RANGE(first, count) ((((count) >= 32) ? 0xffffffffU : (BIT(count) - 1)) << (first))
+
+static int bindpointindex(VkPipelineBindPoint bindpoint)
+    {
+    switch(bindpoint)
+        {
+        case VK_PIPELINE_BIND_POINT_GRAPHICS: return 0;
+        case VK_PIPELINE_BIND_POINT_COMPUTE: return 1;
+        case VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR: return 2;
+        default: return -1;
+        }
+    return -1;
+    }
+
+static int filterpipeline(cbstate_t *state, VkPipelineBindPoint bindpoint, VkPipeline pipeline)
+    {
+    int i = bindpointindex(bindpoint);
+    if(i >= 0 && state->pipeline[i] == pipeline)
+        { state->skipped++; return 1; }
+    if(i >= 0) state->pipeline[i] = pipeline;
+    /* the static state of a graphics pipeline overwrites the dynamic one, and we don't
+     * know which viewport and scissor state is static in the pipeline */
+    if(i == 0) state->viewports = state->scissors = 0;
+    state->issued++;
+    return 0;
+    }
+
+static int filterdescriptorsets(cbstate_t *state, VkPipelineBindPoint bindpoint, VkPipelineLayout layout,
+            uint32_t first, uint32_t count, const VkDescriptorSet *sets, uint32_t offsets_count)
+    {
+    uint32_t i;
+    int bp = bindpointindex(bindpoint);
+    state->issued++;
+    if(bp < 0) return 0;
+    if(offsets_count > 0 || first + count > CBSTATE_MAX_SETS || count == 0)
+        { /* dynamic offsets are not tracked */
+        state->sets[bp] = 0;
+        return 0;
+        }
+    if(state->layout[bp] == layout && (state->sets[bp] & RANGE(first, count)) == RANGE(first, count))
+        {
+        for(i = 0; i < count; i++)
+            if(state->set[bp][first + i] != sets[i]) break;
+        if(i == count)
+            { state->issued--; state->skipped++; return 1; }
+        }
+    if(state->layout[bp] != layout)
+        { /* sets bound with a different layout may be disturbed */
+        state->layout[bp] = layout;
+        state->sets[bp] = 0;
+        }
+    for(i = 0; i < count; i++)
+        state->set[bp][first + i] = sets[i];
+    state->sets[bp] |= RANGE(first, count);
+    return 0;
+    }
+
+static int filterviewports(cbstate_t *state, uint32_t first, uint32_t count, const VkViewport *viewports)
+    {
+    uint32_t i;
+    state->issued++;
+    if(first + count > CBSTATE_MAX_VIEWPORTS || count == 0)
+        { state->viewports = 0; return 0; }
+    if((state->viewports & RANGE(first, count)) == RANGE(first, count) &&
+            memcmp(&state->viewport[first], viewports, count*sizeof(VkViewport)) == 0)
+        { state->issued--; state->skipped++; return 1; }
+    for(i = 0; i < count; i++)
+        state->viewport[first + i] = viewports[i];
+    state->viewports |= RANGE(first, count);
+    return 0;
+    }
+
+static int filterscissors(cbstate_t *state, uint32_t first, uint32_t count, const VkRect2D *scissors)
+    {
+    uint32_t i;
+    state->issued++;
+    if(first + count > CBSTATE_MAX_VIEWPORTS || count == 0)
+        { state->scissors = 0; return 0; }
+    if((state->scissors & RANGE(first, count)) == RANGE(first, count) &&
+            memcmp(&state->scissor[first], scissors, count*sizeof(VkRect2D)) == 0)
+        { state->issued--; state->skipped++; return 1; }
+    for(i = 0; i < count; i++)
+        state->scissor[first + i] = scissors[i];
+    state->scissors |= RANGE(first, count);
+    return 0;
+    }
+
+static int filtervertexbuffers(cbstate_t *state, uint32_t first, uint32_t count, const VkBuffer *buffers, const VkDeviceSize *offsets)
+    {
+    uint32_t i;
+    state->issued++;
+    if(first + count > CBSTATE_MAX_VERTEX_BUFFERS || count == 0)
+        { state->vertex_buffers = 0; return 0; }
+    if((state->vertex_buffers & RANGE(first, count)) == RANGE(first, count))
+        {
+        for(i = 0; i < count; i++)
+            if(state->vertex_buffer[first + i] != buffers[i] || state->vertex_offset[first + i] != offsets[i])
+                break;
+        if(i == count)
+            { state->issued--; state->skipped++; return 1; }
+        }
+    for(i = 0; i < count; i++)
+        {
+        state->vertex_buffer[first + i] = buffers[i];
+        state->vertex_offset[first + i] = offsets[i];
+        }
+    state->vertex_buffers |= RANGE(first, count);
+    return 0;
+    }
+
+/*------------------------------------------------------------------------------*/
+
 static int CmdBindPipeline(lua_State *L)
     {
     ud_t *ud;
     VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
     VkPipelineBindPoint pipelineBindPoint = checkpipelinebindpoint(L, 2);
     VkPipeline pipeline = checkpipeline(L, 3, NULL);
+    if(ud->info && filterpipeline(CBSTATE(ud), pipelineBindPoint, pipeline)) return 0;
     ud->ddt->CmdBindPipeline(cb, pipelineBindPoint, pipeline);
     return 0;
     }
@@ -40,11 +163,13 @@ static int CmdSetViewport(lua_State *L)
     int err;
     uint32_t count;
     ud_t *ud;
+    VkViewport buf[SMALL_LIST];
     VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
     uint32_t firstViewport = luaL_checkinteger(L, 2);
-#define CLEANUP zfreearrayVkViewport (L, viewports, count, 1)
-    VkViewport *viewports = zcheckarrayVkViewport(L, 3, &count, &err);
+#define CLEANUP zfreearrayVkViewport (L, viewports, count, viewports != buf)
+    VkViewport *viewports = zcheckarraybufVkViewport(L, 3, buf, SMALL_LIST, &count, &err);
     if(err) { CLEANUP; return argerror(L, 3); }
+    if(ud->info && filterviewports(CBSTATE(ud), firstViewport, count, viewports)) { CLEANUP; return 0; }
     ud->ddt->CmdSetViewport(cb, firstViewport, count, viewports);
     CLEANUP;
 #undef CLEANUP
@@ -56,11 +181,13 @@ static int CmdSetScissor(lua_State *L)
     int err;
     uint32_t count;
     ud_t *ud;
+    VkRect2D buf[SMALL_LIST];
     VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
     uint32_t first = luaL_checkinteger(L, 2);
-#define CLEANUP zfreearrayVkRect2D(L, scissors, count, 1)
-    VkRect2D* scissors = zcheckarrayVkRect2D(L, 3, &count, &err);
+#define CLEANUP zfreearrayVkRect2D(L, scissors, count, scissors != buf)
+    VkRect2D* scissors = zcheckarraybufVkRect2D(L, 3, buf, SMALL_LIST, &count, &err);
     if(err) { CLEANUP; return argerror(L, 3); }
+    if(ud->info && filterscissors(CBSTATE(ud), first, count, scissors)) { CLEANUP; return 0; }
     ud->ddt->CmdSetScissor(cb, first, count, scissors);
     CLEANUP;
 #undef CLEANUP
@@ -146,21 +273,26 @@ static int CmdBindDescriptorSets(lua_State *L)
     uint32_t sets_count, offsets_count = 0;
     VkDescriptorSet* sets; 
     uint32_t* offsets;
+    VkDescriptorSet setsbuf[SMALL_LIST];
+    uint32_t offsetsbuf[SMALL_LIST];
     ud_t *ud;
     VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
     VkPipelineBindPoint bindpoint = checkpipelinebindpoint(L, 2);
     VkPipelineLayout layout = checkpipeline_layout(L, 3, NULL);
     uint32_t firstSet = luaL_checkinteger(L, 4);
 
-    sets = checkdescriptor_setlist(L, 5, &sets_count, &err, NULL);
+    sets = checkdescriptor_sethandlelistbuf(L, 5, setsbuf, SMALL_LIST, &sets_count, &err);
     if(err) return argerrorc(L, 5, err);
     
-    offsets = checkuint32list(L, 6, &offsets_count, &err);
-    if(err < 0) { Free(L, sets); return argerrorc(L, 6, err); }
+    offsets = checkuint32listbuf(L, 6, offsetsbuf, SMALL_LIST, &offsets_count, &err);
+    if(err < 0) { FreeBuf(L, sets, setsbuf); return argerrorc(L, 6, err); }
 
+#define CLEANUP do { FreeBuf(L, sets, setsbuf); FreeBuf(L, offsets, offsetsbuf); } while(0)
+    if(ud->info && filterdescriptorsets(CBSTATE(ud), bindpoint, layout, firstSet, sets_count, sets, offsets_count))
+        { CLEANUP; return 0; }
     ud->ddt->CmdBindDescriptorSets(cb, bindpoint, layout, firstSet, sets_count, sets, offsets_count, offsets);
-    Free(L, sets); 
-    if(offsets) Free(L, offsets);
+    CLEANUP;
+#undef CLEANUP
     return 0;
     }
 
@@ -184,25 +316,30 @@ static int CmdBindVertexBuffers(lua_State *L)
     VkDeviceSize *offsets = NULL;
     VkDeviceSize *sizes = NULL;
     VkDeviceSize *strides = NULL;
+    VkBuffer buffersbuf[SMALL_LIST];
+    VkDeviceSize offsetsbuf[SMALL_LIST], sizesbuf[SMALL_LIST], stridesbuf[SMALL_LIST];
     ud_t *ud;
     VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
     uint32_t first = luaL_checkinteger(L, 2);
-#define CLEANUP do {                    \
-        if(buffers) Free(L, buffers);   \
-        if(offsets) Free(L, offsets);   \
-        if(sizes) Free(L, sizes);       \
-        if(strides) Free(L, strides);   \
+#define CLEANUP do {                            \
+        FreeBuf(L, buffers, buffersbuf);        \
+        FreeBuf(L, offsets, offsetsbuf);        \
+        FreeBuf(L, sizes, sizesbuf);            \
+        FreeBuf(L, strides, stridesbuf);        \
 } while(0)
 
-    buffers = checkbufferlist(L, 3, &count, &err);
+    buffers = checkbufferlistbuf(L, 3, buffersbuf, SMALL_LIST, &count, &err);
     if(err) { CLEANUP; return argerrorc(L, 3, err); }
     
-    offsets = checkdevicesizelist(L, 4, &count1, &err);
+    offsets = checkdevicesizelistbuf(L, 4, offsetsbuf, SMALL_LIST, &count1, &err);
     if(err) { CLEANUP; return argerrorc(L, 4, err); }
     if(count1 != count) { CLEANUP; return argerrorc(L, 4, ERR_LENGTH); }
 
     if(lua_isnoneornil(L, 5) && lua_isnoneornil(L, 6))
-        ud->ddt->CmdBindVertexBuffers(cb, first, count, buffers, offsets);
+        {
+        if(!ud->info || !filtervertexbuffers(CBSTATE(ud), first, count, buffers, offsets))
+            ud->ddt->CmdBindVertexBuffers(cb, first, count, buffers, offsets);
+        }
     else
         {
         if(!TestDevicePfn(L, ud, CmdBindVertexBuffers2EXT))
@@ -213,12 +350,13 @@ static int CmdBindVertexBuffers(lua_State *L)
             }
         else
             {
-            sizes = checkdevicesizelist(L, 5, &count1, &err);
+            sizes = checkdevicesizelistbuf(L, 5, sizesbuf, SMALL_LIST, &count1, &err);
             if(err < 0) { CLEANUP; return argerrorc(L, 5, err); }
             if((count1 != 0) && (count1 != count)) { CLEANUP; return argerrorc(L, 5, ERR_LENGTH); }
-            strides = checkdevicesizelist(L, 6, &count1, &err);
+            strides = checkdevicesizelistbuf(L, 6, stridesbuf, SMALL_LIST, &count1, &err);
             if(err < 0) { CLEANUP; return argerrorc(L, 6, err); }
             if((count1 != 0) && (count1 != count)) { CLEANUP; return argerrorc(L, 6, ERR_LENGTH); }
+            if(ud->info) { CBSTATE(ud)->vertex_buffers = 0; CBSTATE(ud)->issued++; } /* sizes and strides are not tracked */
             ud->ddt->CmdBindVertexBuffers2EXT(cb, first, count, buffers, offsets, sizes, strides);
             }
         }
@@ -623,30 +761,34 @@ static int CmdWaitEvents1(lua_State *L)
     ud_t *ud;
     uint32_t eventCount, mCount=0, bCount=0, iCount=0;
     VkEvent* pEvents = NULL;
+    VkEvent ebuf[SMALL_LIST];
     VkMemoryBarrier* pMemoryBarriers = NULL;
     VkBufferMemoryBarrier* pBufferMemoryBarriers = NULL;
     VkImageMemoryBarrier* pImageMemoryBarriers = NULL;
+    VkMemoryBarrier mbuf[SMALL_LIST];
+    VkBufferMemoryBarrier bbuf[SMALL_LIST];
+    VkImageMemoryBarrier ibuf[SMALL_LIST];
     VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
     VkPipelineStageFlags srcStageMask = checkflags(L, 2);
     VkPipelineStageFlags dstStageMask = checkflags(L, 3);
 #define CLEANUP do {                                                        \
-    Free(L, pEvents);                                                       \
-    zfreearrayVkMemoryBarrier(L, pMemoryBarriers, mCount, 1);               \
-    zfreearrayVkBufferMemoryBarrier(L, pBufferMemoryBarriers, bCount, 1);   \
-    zfreearrayVkImageMemoryBarrier(L, pImageMemoryBarriers, iCount, 1);     \
+    FreeBuf(L, pEvents, ebuf);                                              \
+    zfreearrayVkMemoryBarrier(L, pMemoryBarriers, mCount, pMemoryBarriers != mbuf);                 \
+    zfreearrayVkBufferMemoryBarrier(L, pBufferMemoryBarriers, bCount, pBufferMemoryBarriers != bbuf); \
+    zfreearrayVkImageMemoryBarrier(L, pImageMemoryBarriers, iCount, pImageMemoryBarriers != ibuf);    \
 } while(0)
-    pEvents = checkeventlist(L, 4, &eventCount, &err, NULL);
+    pEvents = checkeventlistbuf(L, 4, ebuf, SMALL_LIST, &eventCount, &err);
     if(err) { CLEANUP; return argerrorc(L, 4, err); }
 
-    pMemoryBarriers = zcheckarrayVkMemoryBarrier(L, 5, &mCount, &err);
+    pMemoryBarriers = zcheckarraybufVkMemoryBarrier(L, 5, mbuf, SMALL_LIST, &mCount, &err);
     if(err < 0) { CLEANUP; return argerror(L, 5); }
     if(err) lua_pop(L, 1);
 
-    pBufferMemoryBarriers = zcheckarrayVkBufferMemoryBarrier(L, 6, &bCount, &err);
+    pBufferMemoryBarriers = zcheckarraybufVkBufferMemoryBarrier(L, 6, bbuf, SMALL_LIST, &bCount, &err);
     if(err < 0) { CLEANUP; return argerror(L, 6); }
     if(err) lua_pop(L, 1);
 
-    pImageMemoryBarriers = zcheckarrayVkImageMemoryBarrier(L, 7, &iCount, &err);
+    pImageMemoryBarriers = zcheckarraybufVkImageMemoryBarrier(L, 7, ibuf, SMALL_LIST, &iCount, &err);
     if(err < 0) { CLEANUP; return argerror(L, 7); }
     if(err) lua_pop(L, 1);
 
@@ -698,24 +840,27 @@ static int CmdPipelineBarrier1(lua_State *L)
     VkMemoryBarrier* pMemoryBarriers = NULL;
     VkBufferMemoryBarrier* pBufferMemoryBarriers = NULL;
     VkImageMemoryBarrier* pImageMemoryBarriers = NULL;
+    VkMemoryBarrier mbuf[SMALL_LIST];
+    VkBufferMemoryBarrier bbuf[SMALL_LIST];
+    VkImageMemoryBarrier ibuf[SMALL_LIST];
     VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
     VkPipelineStageFlags srcStageMask = checkflags(L, 2);
     VkPipelineStageFlags dstStageMask = checkflags(L, 3);
     VkDependencyFlags dependencyFlags = checkflags(L, 4);
 #define CLEANUP do {                                                        \
-    zfreearrayVkMemoryBarrier(L, pMemoryBarriers, mCount, 1);               \
-    zfreearrayVkBufferMemoryBarrier(L, pBufferMemoryBarriers, bCount, 1);   \
-    zfreearrayVkImageMemoryBarrier(L, pImageMemoryBarriers, iCount, 1);     \
+    zfreearrayVkMemoryBarrier(L, pMemoryBarriers, mCount, pMemoryBarriers != mbuf);                 \
+    zfreearrayVkBufferMemoryBarrier(L, pBufferMemoryBarriers, bCount, pBufferMemoryBarriers != bbuf); \
+    zfreearrayVkImageMemoryBarrier(L, pImageMemoryBarriers, iCount, pImageMemoryBarriers != ibuf);    \
 } while(0)
-    pMemoryBarriers = zcheckarrayVkMemoryBarrier(L, 5, &mCount, &err);
+    pMemoryBarriers = zcheckarraybufVkMemoryBarrier(L, 5, mbuf, SMALL_LIST, &mCount, &err);
     if(err < 0) { CLEANUP; return argerror(L, 5); }
     if(err) lua_pop(L, 1);
 
-    pBufferMemoryBarriers = zcheckarrayVkBufferMemoryBarrier(L, 6, &bCount, &err);
+    pBufferMemoryBarriers = zcheckarraybufVkBufferMemoryBarrier(L, 6, bbuf, SMALL_LIST, &bCount, &err);
     if(err < 0) { CLEANUP; return argerror(L, 6); }
     if(err) lua_pop(L, 1);
 
-    pImageMemoryBarriers = zcheckarrayVkImageMemoryBarrier(L, 7, &iCount, &err);
+    pImageMemoryBarriers = zcheckarraybufVkImageMemoryBarrier(L, 7, ibuf, SMALL_LIST, &iCount, &err);
     if(err < 0) { CLEANUP; return argerror(L, 7); }
     if(err) lua_pop(L, 1);
 
@@ -929,6 +1074,7 @@ static int CmdExecuteCommands(lua_State *L)
     if(err) return argerrorc(L, 2, err);
 
     ud->ddt->CmdExecuteCommands(cb, count, buffers);
+    if(ud->info) resetcbstate(CBSTATE(ud)); /* the state is undefined after executing secondaries */
     Free(L, buffers);
     return 0;
     }
@@ -1009,6 +1155,7 @@ static int CmdPushDescriptorSet(lua_State *L)
     writes = zcheckarrayVkWriteDescriptorSet(L, 5, &count, &err);
     if(err) { CLEANUP; return argerror(L, 5); }
     ud->ddt->CmdPushDescriptorSetKHR(cb, pipelineBindPoint, layout, set, count, writes);
+    if(ud->info) memset(CBSTATE(ud)->sets, 0, sizeof(CBSTATE(ud)->sets));
     CLEANUP;
 #undef CLEANUP
     return 0;
@@ -1025,6 +1172,7 @@ static int CmdPushDescriptorSetWithTemplate(lua_State *L)
     const void* data = luaL_checklstring(L, 5, &len);
     CheckDevicePfn(L, ud, CmdPushDescriptorSetWithTemplateKHR);
     ud->ddt->CmdPushDescriptorSetWithTemplateKHR(cb, desc_template, layout, set, data);
+    if(ud->info) memset(CBSTATE(ud)->sets, 0, sizeof(CBSTATE(ud)->sets));
     return 0;
     }
 
@@ -1392,6 +1540,7 @@ static int CmdSetViewportWithCount(lua_State *L)
     viewports = zcheckarrayVkViewport(L, 2, &count, &err);
     if(err) { CLEANUP; return argerror(L, 2); }
     ud->ddt->CmdSetViewportWithCountEXT(cb, count, viewports);
+    if(ud->info) CBSTATE(ud)->viewports = 0;
     CLEANUP;
 #undef CLEANUP
     return 0;
@@ -1409,6 +1558,7 @@ static int CmdSetScissorWithCount(lua_State *L)
     scissors = zcheckarrayVkRect2D(L, 2, &count, &err);
     if(err) { CLEANUP; return argerror(L, 2); }
     ud->ddt->CmdSetScissorWithCountEXT(cb, count, scissors);
+    if(ud->info) CBSTATE(ud)->scissors = 0;
     CLEANUP;
 #undef CLEANUP
     return 0;
@@ -1551,17 +1701,56 @@ static int CmdSetVertexInput(lua_State *L)
     return 0;
     }
 
+static const void *checkpackeddraws(lua_State *L, int arg, size_t elsize, uint32_t stride, int stridearg, int countarg, uint32_t *count)
+/* Checks the draws at arg, passed as packed structs stride bytes apart, either in a
+ * binary string or in memory pointed to by a lightuserdata (e.g. a mapped area).
+ * The stride is given at stridearg, and the number of draws is optionally given at
+ * countarg (mandatory for lightuserdata).
+ * Returns NULL if arg is neither a string nor a lightuserdata.
+ */
+    {
+    size_t len;
+    uint32_t n;
+    const void *data;
+    if(lua_type(L, arg) == LUA_TSTRING)
+        {
+        data = lua_tolstring(L, arg, &len);
+        if(stride < elsize) { argerrorc(L, stridearg, ERR_VALUE); return NULL; }
+        *count = (len < elsize) ? 0 : (len - elsize)/stride + 1;
+        if(lua_isnoneornil(L, countarg)) return data;
+        n = luaL_checkinteger(L, countarg);
+        if(n > *count) { argerrorc(L, countarg, ERR_LENGTH); return NULL; }
+        *count = n;
+        return data;
+        }
+    if(lua_type(L, arg) == LUA_TLIGHTUSERDATA)
+        {
+        if(stride < elsize) { argerrorc(L, stridearg, ERR_VALUE); return NULL; }
+        *count = luaL_checkinteger(L, countarg);
+        return lua_touserdata(L, arg);
+        }
+    return NULL;
+    }
+
 static int CmdDrawMulti(lua_State *L)
     {
     int err;
     uint32_t count;
     ud_t *ud;
     VkMultiDrawInfoEXT *info = NULL;
+    const void *packed;
     VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
     uint32_t instanceCount = luaL_checkinteger(L, 3);
     uint32_t firstInstance = luaL_checkinteger(L, 4);
     uint32_t stride = luaL_checkinteger(L, 5);
     CheckDevicePfn(L, ud, CmdDrawMultiEXT);
+    packed = checkpackeddraws(L, 2, sizeof(VkMultiDrawInfoEXT), stride, 5, 6, &count);
+    if(packed)
+        {
+        if(count > 0)
+            ud->ddt->CmdDrawMultiEXT(cb, count, (const VkMultiDrawInfoEXT*)packed, instanceCount, firstInstance, stride);
+        return 0;
+        }
 #define CLEANUP do {                                            \
     if(info) zfreearrayVkMultiDrawInfoEXT(L, info, count, 1);   \
 } while(0)
@@ -1581,6 +1770,7 @@ static int CmdDrawMultiIndexed(lua_State *L)
     int32_t *pVertexOffset = NULL;
     int32_t vertex_offset;
     VkMultiDrawIndexedInfoEXT *info = NULL;
+    const void *packed;
     VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
     uint32_t instanceCount = luaL_checkinteger(L, 3);
     uint32_t firstInstance = luaL_checkinteger(L, 4);
@@ -1591,6 +1781,14 @@ static int CmdDrawMultiIndexed(lua_State *L)
         pVertexOffset = &vertex_offset;
         }
     CheckDevicePfn(L, ud, CmdDrawMultiIndexedEXT);
+    packed = checkpackeddraws(L, 2, sizeof(VkMultiDrawIndexedInfoEXT), stride, 5, 7, &count);
+    if(packed)
+        {
+        if(count > 0)
+            ud->ddt->CmdDrawMultiIndexedEXT(cb, count, (const VkMultiDrawIndexedInfoEXT*)packed, 
+                    instanceCount, firstInstance, stride, pVertexOffset);
+        return 0;
+        }
 #define CLEANUP do {                                                    \
     if(info) zfreearrayVkMultiDrawIndexedInfoEXT(L, info, count, 1);    \
 } while(0)
@@ -1647,6 +1845,177 @@ static int CmdEndRendering(lua_State *L)
     }
 
 
+/*------------------------------------------------------------------------------*
+ | Shader objects and extended dynamic state 3                                  |
+ *------------------------------------------------------------------------------*/
+
+#ifdef VK_EXT_shader_object
+static int CmdBindShaders(lua_State *L)
+/* cmd_bind_shaders(cb, {stage}, {shader|false}) (false unbinds the stage) */
+    {
+    int err;
+    uint32_t count, i;
+    ud_t *ud;
+    VkShaderEXT *shaders;
+    VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
+    VkShaderStageFlagBits *stages;
+    CheckDevicePfn(L, ud, CmdBindShadersEXT);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    luaL_checktype(L, 3, LUA_TTABLE);
+    count = (uint32_t)luaL_len(L, 2);
+    if(count == 0) return argerrorc(L, 2, ERR_EMPTY);
+    for(i = 0; i < count; i++) /* validate everything before allocating */
+        {
+        lua_rawgeti(L, 3, i+1);
+        if(lua_toboolean(L, -1) && !testshader(L, -1, NULL)) return argerrorc(L, 3, ERR_TYPE);
+        lua_pop(L, 1);
+        }
+    stages = (VkShaderStageFlagBits*)checkflagslist(L, 2, &count, &err);
+    if(err) return argerrorc(L, 2, err);
+    shaders = (VkShaderEXT*)MallocNoErr(L, count*sizeof(VkShaderEXT));
+    if(!shaders) { Free(L, stages); return errmemory(L); }
+    for(i = 0; i < count; i++)
+        {
+        lua_rawgeti(L, 3, i+1);
+        shaders[i] = lua_toboolean(L, -1) ? (VkShaderEXT)testshader(L, -1, NULL) : VK_NULL_HANDLE;
+        lua_pop(L, 1);
+        }
+    ud->ddt->CmdBindShadersEXT(cb, count, stages, shaders);
+    if(ud->info) memset(CBSTATE(ud)->pipeline, 0, sizeof(CBSTATE(ud)->pipeline)); /* shaders replace pipelines */
+    Free(L, stages);
+    Free(L, shaders);
+    return 0;
+    }
+#else
+static int CmdBindShaders(lua_State *L)
+    { return notavailable(L); }
+#endif
+
+#ifdef VK_EXT_extended_dynamic_state3
+static int CmdSetPolygonMode(lua_State *L)
+    {
+    ud_t *ud;
+    VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
+    VkPolygonMode polygonMode = checkpolygonmode(L, 2);
+    CheckDevicePfn(L, ud, CmdSetPolygonModeEXT);
+    ud->ddt->CmdSetPolygonModeEXT(cb, polygonMode);
+    return 0;
+    }
+
+static int CmdSetRasterizationSamples(lua_State *L)
+    {
+    ud_t *ud;
+    VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
+    VkSampleCountFlagBits rasterizationSamples = (VkSampleCountFlagBits)checkflags(L, 2);
+    CheckDevicePfn(L, ud, CmdSetRasterizationSamplesEXT);
+    ud->ddt->CmdSetRasterizationSamplesEXT(cb, rasterizationSamples);
+    return 0;
+    }
+
+static int CmdSetSampleMask(lua_State *L)
+    {
+    int err;
+    uint32_t count;
+    ud_t *ud;
+    VkSampleMask *mask;
+    VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
+    VkSampleCountFlagBits samples = (VkSampleCountFlagBits)checkflags(L, 2);
+    CheckDevicePfn(L, ud, CmdSetSampleMaskEXT);
+    mask = checkuint32list(L, 3, &count, &err);
+    if(err) return argerrorc(L, 3, err);
+    if(count < ((uint32_t)samples + 31)/32)
+        { Free(L, mask); return argerrorc(L, 3, ERR_VALUE); }
+    ud->ddt->CmdSetSampleMaskEXT(cb, samples, mask);
+    Free(L, mask);
+    return 0;
+    }
+
+static int CmdSetAlphaToCoverageEnable(lua_State *L)
+    {
+    ud_t *ud;
+    VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
+    VkBool32 alphaToCoverageEnable = checkboolean(L, 2);
+    CheckDevicePfn(L, ud, CmdSetAlphaToCoverageEnableEXT);
+    ud->ddt->CmdSetAlphaToCoverageEnableEXT(cb, alphaToCoverageEnable);
+    return 0;
+    }
+
+static int CmdSetColorBlendEnable(lua_State *L)
+    {
+    int err;
+    uint32_t count;
+    ud_t *ud;
+    VkBool32 *enables;
+    VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
+    uint32_t first = luaL_checkinteger(L, 2);
+    CheckDevicePfn(L, ud, CmdSetColorBlendEnableEXT);
+    enables = checkbooleanlist(L, 3, &count, &err);
+    if(err) return argerrorc(L, 3, err);
+    ud->ddt->CmdSetColorBlendEnableEXT(cb, first, count, enables);
+    Free(L, enables);
+    return 0;
+    }
+
+static int CmdSetColorBlendEquation(lua_State *L)
+/* The equations are given as pipelinecolorblendattachmentstate tables (only the
+ * blend factors and ops are used) */
+    {
+    int err;
+    uint32_t count, i;
+    ud_t *ud;
+    VkColorBlendEquationEXT *eq;
+    VkPipelineColorBlendAttachmentState *state;
+    VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
+    uint32_t first = luaL_checkinteger(L, 2);
+    CheckDevicePfn(L, ud, CmdSetColorBlendEquationEXT);
+#define CLEANUP do { zfreearrayVkPipelineColorBlendAttachmentState(L, state, count, 1); if(eq) Free(L, eq); } while(0)
+    eq = NULL;
+    state = zcheckarrayVkPipelineColorBlendAttachmentState(L, 3, &count, &err);
+    if(err) { CLEANUP; return argerror(L, 3); }
+    eq = (VkColorBlendEquationEXT*)MallocNoErr(L, count*sizeof(VkColorBlendEquationEXT));
+    if(!eq) { CLEANUP; return errmemory(L); }
+    for(i = 0; i < count; i++)
+        {
+        eq[i].srcColorBlendFactor = state[i].srcColorBlendFactor;
+        eq[i].dstColorBlendFactor = state[i].dstColorBlendFactor;
+        eq[i].colorBlendOp = state[i].colorBlendOp;
+        eq[i].srcAlphaBlendFactor = state[i].srcAlphaBlendFactor;
+        eq[i].dstAlphaBlendFactor = state[i].dstAlphaBlendFactor;
+        eq[i].alphaBlendOp = state[i].alphaBlendOp;
+        }
+    ud->ddt->CmdSetColorBlendEquationEXT(cb, first, count, eq);
+    CLEANUP;
+#undef CLEANUP
+    return 0;
+    }
+
+static int CmdSetColorWriteMask(lua_State *L)
+    {
+    int err;
+    uint32_t count;
+    ud_t *ud;
+    VkColorComponentFlags *masks;
+    VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
+    uint32_t first = luaL_checkinteger(L, 2);
+    CheckDevicePfn(L, ud, CmdSetColorWriteMaskEXT);
+    masks = checkflagslist(L, 3, &count, &err);
+    if(err) return argerrorc(L, 3, err);
+    ud->ddt->CmdSetColorWriteMaskEXT(cb, first, count, masks);
+    Free(L, masks);
+    return 0;
+    }
+#else
+static int NotAvailable(lua_State *L)
+    { return notavailable(L); }
+#define CmdSetPolygonMode NotAvailable
+#define CmdSetRasterizationSamples NotAvailable
+#define CmdSetSampleMask NotAvailable
+#define CmdSetAlphaToCoverageEnable NotAvailable
+#define CmdSetColorBlendEnable NotAvailable
+#define CmdSetColorBlendEquation NotAvailable
+#define CmdSetColorWriteMask NotAvailable
+#endif
+
 
 #if 0 // 10yy
         { "",  },
@@ -1755,6 +2124,14 @@ static const struct luaL_Reg Functions[] =
         { "cmd_set_fragment_shading_rate", CmdSetFragmentShadingRate },
         { "cmd_begin_rendering", CmdBeginRendering },
         { "cmd_end_rendering", CmdEndRendering },
+        { "cmd_bind_shaders", CmdBindShaders },
+        { "cmd_set_polygon_mode", CmdSetPolygonMode },
+        { "cmd_set_rasterization_samples", CmdSetRasterizationSamples },
+        { "cmd_set_sample_mask", CmdSetSampleMask },
+        { "cmd_set_alpha_to_coverage_enable", CmdSetAlphaToCoverageEnable },
+        { "cmd_set_color_blend_enable", CmdSetColorBlendEnable },
+        { "cmd_set_color_blend_equation", CmdSetColorBlendEquation },
+        { "cmd_set_color_write_mask", CmdSetColorWriteMask },
         { NULL, NULL } /* sentinel */
     };
 
@@ -148,6 +148,7 @@ static int BeginCommandBuffer(lua_State *L)
     CLEANUP;
     CheckError(L, ec);
 #undef CLEANUP
+    if(ud->info) resetcbstate(CBSTATE(ud));
     return 0;
     }
 
@@ -167,9 +168,57 @@ static int ResetCommandBuffer(lua_State *L)
     VkCommandBufferResetFlags flags = optflags(L, 2, 0);
     VkResult ec = ud->ddt->ResetCommandBuffer(command_buffer, flags);
     CheckError(L, ec);
+    if(ud->info) resetcbstate(CBSTATE(ud));
     return 0;
     }
 
+/*------------------------------------------------------------------------------*
+ | Redundant state filtering (NONVK)                                            |
+ *------------------------------------------------------------------------------*/
+
+void resetcbstate(cbstate_t *state)
+/* Forgets the tracked state (e.g. when recording begins), keeping the counters */
+    {
+    size_t issued = state->issued, skipped = state->skipped;
+    memset(state, 0, sizeof(cbstate_t));
+    state->issued = issued;
+    state->skipped = skipped;
+    }
+
+static int EnableStateFilter(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkcommand_buffer(L, 1, &ud);
+    if(lua_isnoneornil(L, 2) || lua_toboolean(L, 2))
+        {
+        if(!ud->info)
+            ud->info = Malloc(L, sizeof(cbstate_t));
+        }
+    else if(ud->info)
+        {
+        Free(L, ud->info);
+        ud->info = NULL;
+        }
+    return 0;
+    }
+
+static int StateFilterStats(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkcommand_buffer(L, 1, &ud);
+    if(!ud->info)
+        {
+        lua_pushinteger(L, 0);
+        lua_pushinteger(L, 0);
+        return 2;
+        }
+    lua_pushinteger(L, CBSTATE(ud)->issued);
+    lua_pushinteger(L, CBSTATE(ud)->skipped);
+    if(optboolean(L, 2, 0))
+        CBSTATE(ud)->issued = CBSTATE(ud)->skipped = 0;
+    return 2;
+    }
+
 
 RAW_FUNC_DISPATCHABLE(command_buffer)
 TYPE_FUNC(command_buffer)
@@ -198,6 +247,8 @@ static const struct luaL_Reg Functions[] =
     {
         { "allocate_command_buffers",  Create },
         { "free_command_buffers",  FreeCmdBuffers },
+        { "enable_state_filter",  EnableStateFilter },
+        { "state_filter_stats",  StateFilterStats },
         { "begin_command_buffer", BeginCommandBuffer },
         { "end_command_buffer", EndCommandBuffer },
         { "reset_command_buffer", ResetCommandBuffer },
@@ -0,0 +1,400 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Stefano Trettel
+ *
+ * Software repository: MoonVulkan, https://github.com/stetre/moonvulkan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "internal.h"
+
+/* Descriptor buffers (VK_EXT_descriptor_buffer).
+ *
+ * Descriptors are written with vkGetDescriptorEXT() directly in the mapped memory
+ * backing a descriptor buffer, at the offsets given by the set layout queries, and
+ * the buffers are bound to command buffers without any descriptor set or pool.
+ *
+ * The descriptorgetinfo tables are parsed into structs on the C stack, so that
+ * writing large batches of descriptors does not allocate memory.
+ */
+
+#ifdef VK_EXT_descriptor_buffer
+
+static VkPhysicalDeviceDescriptorBufferPropertiesEXT *getproperties(lua_State *L, ud_t *device_ud)
+/* Queries the properties on first use, and caches them in the device's info */
+    {
+    VkPhysicalDeviceProperties2 props;
+    devinfo_t *devinfo = DEVINFO(device_ud);
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT *p = 
+                (VkPhysicalDeviceDescriptorBufferPropertiesEXT*)devinfo->descriptor_buffer;
+    if(p) return p;
+    if(!device_ud->idt->GetPhysicalDeviceProperties2)
+        { luaL_error(L, "vkGetPhysicalDeviceProperties2 address not loaded"); return NULL; }
+    p = (VkPhysicalDeviceDescriptorBufferPropertiesEXT*)Malloc(L, sizeof(VkPhysicalDeviceDescriptorBufferPropertiesEXT));
+    p->sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+    memset(&props, 0, sizeof(props));
+    props.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    props.pNext = p;
+    device_ud->idt->GetPhysicalDeviceProperties2(devinfo->physical_device, &props);
+    p->pNext = NULL;
+    devinfo->descriptor_buffer = p;
+    return p;
+    }
+
+static size_t descriptorsize(VkPhysicalDeviceDescriptorBufferPropertiesEXT *p, VkDescriptorType type, int robust)
+/* Returns the size of a descriptor of the given type (0 if not supported) */
+    {
+    switch(type)
+        {
+        case VK_DESCRIPTOR_TYPE_SAMPLER: return p->samplerDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER: return p->combinedImageSamplerDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE: return p->sampledImageDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE: return p->storageImageDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: return p->inputAttachmentDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            return robust ? p->robustUniformTexelBufferDescriptorSize : p->uniformTexelBufferDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            return robust ? p->robustStorageTexelBufferDescriptorSize : p->storageTexelBufferDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            return robust ? p->robustUniformBufferDescriptorSize : p->uniformBufferDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            return robust ? p->robustStorageBufferDescriptorSize : p->storageBufferDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: return p->accelerationStructureDescriptorSize;
+        default: return 0;
+        }
+    }
+
+typedef struct {
+    VkDescriptorGetInfoEXT info;
+    union {
+        VkSampler sampler;
+        VkDescriptorImageInfo image;
+        VkDescriptorAddressInfoEXT address;
+    } data;
+} getinfo_t;
+
+static int checkgetinfo(lua_State *L, int arg, getinfo_t *g)
+/* Parses the descriptorgetinfo at arg, returns an ERR_XXX code (does not raise errors) */
+    {
+    int err;
+    int top = lua_gettop(L);
+    if(!lua_istable(L, arg)) return ERR_TABLE;
+    memset(g, 0, sizeof(getinfo_t));
+    g->info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    lua_getfield(L, arg, "type");
+    g->info.type = testdescriptortype(L, -1, &err);
+    if(err) { lua_settop(L, top); return err; }
+#define CLEANUP lua_settop(L, top)
+    switch(g->info.type)
+        {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+            lua_getfield(L, arg, "sampler");
+            g->data.sampler = testsampler(L, -1, NULL);
+            if(!g->data.sampler) { CLEANUP; return ERR_NOTPRESENT; }
+            g->info.data.pSampler = &g->data.sampler;
+            break;
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            if(lua_getfield(L, arg, "image_info") != LUA_TTABLE) { CLEANUP; return ERR_NOTPRESENT; }
+            lua_getfield(L, -1, "sampler");
+            g->data.image.sampler = testsampler(L, -1, NULL);
+            lua_getfield(L, -2, "image_view");
+            g->data.image.imageView = testimage_view(L, -1, NULL);
+            lua_getfield(L, -3, "image_layout");
+            if(!lua_isnoneornil(L, -1))
+                {
+                g->data.image.imageLayout = testimagelayout(L, -1, &err);
+                if(err) { CLEANUP; return err; }
+                }
+            /* a null image descriptor is written if image_view is missing (nullDescriptor feature) */
+            if(g->info.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)
+                g->info.data.pCombinedImageSampler = &g->data.image;
+            else if(!g->data.image.imageView)
+                g->info.data.pSampledImage = NULL; /* same member for all the image types */
+            else
+                g->info.data.pSampledImage = &g->data.image;
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            if(lua_getfield(L, arg, "address_info") != LUA_TTABLE)
+                { g->info.data.pUniformBuffer = NULL; break; } /* null descriptor */
+            g->data.address.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+            lua_getfield(L, -1, "address");
+            g->data.address.address = testinteger(L, -1, 0, &err);
+            if(err) { CLEANUP; return err; }
+            lua_getfield(L, -2, "range");
+            g->data.address.range = testinteger(L, -1, 0, &err);
+            if(err) { CLEANUP; return err; }
+            lua_getfield(L, -3, "format");
+            if(!lua_isnoneornil(L, -1))
+                {
+                g->data.address.format = testformat(L, -1, &err);
+                if(err) { CLEANUP; return err; }
+                }
+            g->info.data.pUniformBuffer = &g->data.address; /* same member for all the buffer types */
+            break;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+            lua_getfield(L, arg, "acceleration_structure");
+            g->info.data.accelerationStructure = testinteger(L, -1, 0, &err);
+            if(err) { CLEANUP; return err; }
+            break;
+        default:
+            CLEANUP;
+            return ERR_VALUE;
+        }
+    CLEANUP;
+#undef CLEANUP
+    return 0;
+    }
+
+static int GetDescriptorBufferProperties(lua_State *L)
+    {
+    ud_t *ud;
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT *p;
+    (void)checkdevice(L, 1, &ud);
+    p = getproperties(L, ud);
+    lua_newtable(L);
+#define Set(name, sname) do { lua_pushinteger(L, p->name); lua_setfield(L, -2, sname); } while(0)
+    Set(descriptorBufferOffsetAlignment, "descriptor_buffer_offset_alignment");
+    Set(maxDescriptorBufferBindings, "max_descriptor_buffer_bindings");
+    Set(maxResourceDescriptorBufferBindings, "max_resource_descriptor_buffer_bindings");
+    Set(maxSamplerDescriptorBufferBindings, "max_sampler_descriptor_buffer_bindings");
+    Set(maxSamplerDescriptorBufferRange, "max_sampler_descriptor_buffer_range");
+    Set(maxResourceDescriptorBufferRange, "max_resource_descriptor_buffer_range");
+    Set(samplerDescriptorBufferAddressSpaceSize, "sampler_descriptor_buffer_address_space_size");
+    Set(resourceDescriptorBufferAddressSpaceSize, "resource_descriptor_buffer_address_space_size");
+    Set(descriptorBufferAddressSpaceSize, "descriptor_buffer_address_space_size");
+    Set(samplerDescriptorSize, "sampler_descriptor_size");
+    Set(combinedImageSamplerDescriptorSize, "combined_image_sampler_descriptor_size");
+    Set(sampledImageDescriptorSize, "sampled_image_descriptor_size");
+    Set(storageImageDescriptorSize, "storage_image_descriptor_size");
+    Set(uniformTexelBufferDescriptorSize, "uniform_texel_buffer_descriptor_size");
+    Set(robustUniformTexelBufferDescriptorSize, "robust_uniform_texel_buffer_descriptor_size");
+    Set(storageTexelBufferDescriptorSize, "storage_texel_buffer_descriptor_size");
+    Set(robustStorageTexelBufferDescriptorSize, "robust_storage_texel_buffer_descriptor_size");
+    Set(uniformBufferDescriptorSize, "uniform_buffer_descriptor_size");
+    Set(robustUniformBufferDescriptorSize, "robust_uniform_buffer_descriptor_size");
+    Set(storageBufferDescriptorSize, "storage_buffer_descriptor_size");
+    Set(robustStorageBufferDescriptorSize, "robust_storage_buffer_descriptor_size");
+    Set(inputAttachmentDescriptorSize, "input_attachment_descriptor_size");
+    Set(accelerationStructureDescriptorSize, "acceleration_structure_descriptor_size");
+#undef Set
+    return 1;
+    }
+
+static int GetDescriptorSetLayoutSize(lua_State *L)
+    {
+    ud_t *ud;
+    VkDeviceSize size;
+    VkDescriptorSetLayout layout = checkdescriptor_set_layout(L, 1, &ud);
+    CheckDevicePfn(L, ud, GetDescriptorSetLayoutSizeEXT);
+    ud->ddt->GetDescriptorSetLayoutSizeEXT(ud->device, layout, &size);
+    lua_pushinteger(L, size);
+    return 1;
+    }
+
+static int GetDescriptorSetLayoutBindingOffset(lua_State *L)
+    {
+    ud_t *ud;
+    VkDeviceSize offset;
+    VkDescriptorSetLayout layout = checkdescriptor_set_layout(L, 1, &ud);
+    uint32_t binding = luaL_checkinteger(L, 2);
+    CheckDevicePfn(L, ud, GetDescriptorSetLayoutBindingOffsetEXT);
+    ud->ddt->GetDescriptorSetLayoutBindingOffsetEXT(ud->device, layout, binding, &offset);
+    lua_pushinteger(L, offset);
+    return 1;
+    }
+
+static int GetDescriptor(lua_State *L)
+/* Returns the descriptor as a binary string */
+    {
+    int err;
+    ud_t *ud;
+    size_t size;
+    getinfo_t g;
+    char buf[256];
+    VkDevice device = checkdevice(L, 1, &ud);
+    CheckDevicePfn(L, ud, GetDescriptorEXT);
+    err = checkgetinfo(L, 2, &g);
+    if(err) return argerrorc(L, 2, err);
+    size = descriptorsize(getproperties(L, ud), g.info.type, DEVINFO(ud)->robust_buffer_access);
+    if(size == 0 || size > sizeof(buf)) return argerrorc(L, 2, ERR_VALUE);
+    ud->ddt->GetDescriptorEXT(device, &g.info, size, buf);
+    lua_pushlstring(L, buf, size);
+    return 1;
+    }
+
+static int WriteDescriptors(lua_State *L) /* NONVK */
+/* write_descriptors(memory, offset, {descriptorgetinfo}, [stride])
+ * Writes the descriptors in the mapped memory, starting from offset, either packed
+ * or stride bytes apart. Returns the offset past the last descriptor written.
+ */
+    {
+    int err;
+    ud_t *ud, *device_ud;
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT *props;
+    getinfo_t *g;
+    uint32_t count, i;
+    size_t size, total, pos;
+    char *ptr;
+    VkDeviceSize offset, stride;
+    int robust;
+
+    (void)checkdevice_memory(L, 1, &ud);
+    offset = luaL_checkinteger(L, 2);
+    luaL_checktype(L, 3, LUA_TTABLE);
+    stride = luaL_optinteger(L, 4, 0);
+    device_ud = ud->parent_ud;
+    CheckDevicePfn(L, device_ud, GetDescriptorEXT);
+    props = getproperties(L, device_ud);
+    robust = DEVINFO(device_ud)->robust_buffer_access;
+    count = luaL_len(L, 3);
+    if(count == 0) { lua_pushinteger(L, offset); return 1; }
+
+    /* first pass: parse all the infos, and compute the extent of the written range,
+     * so that nothing is written (and the range is not marked dirty) on errors */
+    g = (getinfo_t*)MallocNoErr(L, count*sizeof(getinfo_t));
+    if(!g) return errmemory(L);
+#define CLEANUP Free(L, g)
+    total = 0;
+    for(i = 0; i < count; i++)
+        {
+        lua_rawgeti(L, 3, i+1);
+        err = checkgetinfo(L, lua_gettop(L), &g[i]);
+        lua_pop(L, 1);
+        if(err) { CLEANUP; return argerrorc(L, 3, err); }
+        size = descriptorsize(props, g[i].info.type, robust);
+        if(size == 0) { CLEANUP; return argerrorc(L, 3, ERR_VALUE); }
+        if(stride > 0 && size > stride) { CLEANUP; return argerrorc(L, 4, ERR_VALUE); }
+        total = (stride > 0) ? i*stride + size : total + size;
+        }
+
+    ptr = mappedrange(ud, offset, total);
+    if(!ptr) { CLEANUP; return argerrorc(L, 3, ERR_LENGTH); } /* or the memory is not mapped */
+
+    /* second pass: write the descriptors */
+    pos = 0;
+    for(i = 0; i < count; i++)
+        {
+        size = descriptorsize(props, g[i].info.type, robust);
+        if(stride > 0) pos = i*stride;
+        device_ud->ddt->GetDescriptorEXT(device_ud->device, &g[i].info, size, ptr + pos);
+        pos += size;
+        }
+    CLEANUP;
+#undef CLEANUP
+    lua_pushinteger(L, offset + total);
+    return 1;
+    }
+
+static int CmdBindDescriptorBuffers(lua_State *L)
+/* cmd_bind_descriptor_buffers(cb, {descriptorbufferbindinginfo}) */
+    {
+    uint32_t count, i;
+    ud_t *ud;
+    VkDescriptorBufferBindingInfoEXT *info;
+    VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
+    CheckDevicePfn(L, ud, CmdBindDescriptorBuffersEXT);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    count = luaL_len(L, 2);
+    if(count == 0) return argerrorc(L, 2, ERR_EMPTY);
+    info = (VkDescriptorBufferBindingInfoEXT*)MallocNoErr(L, count*sizeof(VkDescriptorBufferBindingInfoEXT));
+    if(!info) return errmemory(L);
+    for(i = 0; i < count; i++)
+        {
+        info[i].sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+        lua_rawgeti(L, 2, i+1);
+        if(!lua_istable(L, -1))
+            { Free(L, info); return argerrorc(L, 2, ERR_TABLE); }
+        lua_getfield(L, -1, "address");
+        lua_getfield(L, -2, "usage");
+        /* address (VkDeviceAddress) and usage (bufferusageflags) are both mandatory integers */
+        if(!lua_isinteger(L, -2) || !lua_isinteger(L, -1))
+            { Free(L, info); return argerrorc(L, 2, ERR_TYPE); }
+        info[i].address = (VkDeviceAddress)lua_tointeger(L, -2);
+        info[i].usage = (VkBufferUsageFlags)lua_tointeger(L, -1);
+        lua_pop(L, 3);
+        }
+    ud->ddt->CmdBindDescriptorBuffersEXT(cb, count, info);
+    if(ud->info) memset(CBSTATE(ud)->sets, 0, sizeof(CBSTATE(ud)->sets));
+    Free(L, info);
+    return 0;
+    }
+
+static int CmdSetDescriptorBufferOffsets(lua_State *L)
+/* cmd_set_descriptor_buffer_offsets(cb, pipelinebindpoint, layout, firstset, {bufferindex}, {offset}) */
+    {
+    int err;
+    uint32_t count, count1;
+    ud_t *ud;
+    uint32_t *indices;
+    VkDeviceSize *offsets;
+    VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
+    VkPipelineBindPoint bindpoint = checkpipelinebindpoint(L, 2);
+    VkPipelineLayout layout = checkpipeline_layout(L, 3, NULL);
+    uint32_t firstset = luaL_checkinteger(L, 4);
+    CheckDevicePfn(L, ud, CmdSetDescriptorBufferOffsetsEXT);
+    indices = checkuint32list(L, 5, &count, &err);
+    if(err) return argerrorc(L, 5, err);
+    offsets = checkdevicesizelist(L, 6, &count1, &err);
+    if(err) { Free(L, indices); return argerrorc(L, 6, err); }
+    if(count1 != count) { Free(L, indices); Free(L, offsets); return argerrorc(L, 6, ERR_LENGTH); }
+    ud->ddt->CmdSetDescriptorBufferOffsetsEXT(cb, bindpoint, layout, firstset, count, indices, offsets);
+    if(ud->info) memset(CBSTATE(ud)->sets, 0, sizeof(CBSTATE(ud)->sets));
+    Free(L, indices);
+    Free(L, offsets);
+    return 0;
+    }
+
+#else
+
+static int NotAvailable(lua_State *L)
+    { return notavailable(L); }
+#define GetDescriptorBufferProperties NotAvailable
+#define GetDescriptorSetLayoutSize NotAvailable
+#define GetDescriptorSetLayoutBindingOffset NotAvailable
+#define GetDescriptor NotAvailable
+#define WriteDescriptors NotAvailable
+#define CmdBindDescriptorBuffers NotAvailable
+#define CmdSetDescriptorBufferOffsets NotAvailable
+
+#endif
+
+static const struct luaL_Reg Functions[] = 
+    {
+        { "get_descriptor_buffer_properties", GetDescriptorBufferProperties },
+        { "get_descriptor_set_layout_size", GetDescriptorSetLayoutSize },
+        { "get_descriptor_set_layout_binding_offset", GetDescriptorSetLayoutBindingOffset },
+        { "get_descriptor", GetDescriptor },
+        { "write_descriptors", WriteDescriptors },
+        { "cmd_bind_descriptor_buffers", CmdBindDescriptorBuffers },
+        { "cmd_set_descriptor_buffer_offsets", CmdSetDescriptorBufferOffsets },
+        { NULL, NULL } /* sentinel */
+    };
+
+void moonvulkan_open_descriptor_buffer(lua_State *L)
+    {
+    luaL_setfuncs(L, Functions, 0);
+    }
+
@@ -30,6 +30,7 @@ static int freedescriptor_pool(lua_State *L, ud_t *ud)
     VkDescriptorPool descriptor_pool = (VkDescriptorPool)ud->handle;
     const VkAllocationCallbacks *allocator = ud->allocator;
     VkDevice device = ud->device;
+    freechildren(L, DESCRIPTOR_SET_CACHE_MT, ud);
     freechildren(L, DESCRIPTOR_SET_MT, ud);
     if(!freeuserdata(L, ud))
         return 0; /* double call */
@@ -90,11 +91,382 @@ static int ResetDescriptorPool(lua_State *L)
     VkDescriptorPool descriptor_pool = checkdescriptor_pool(L, 1, &ud);
     VkDevice device = ud->device;
     VkDescriptorPoolResetFlags flags = optflags(L, 2, 0);
-    VkResult ec = ud->ddt->ResetDescriptorPool(device, descriptor_pool, flags);
+    VkResult ec;
+    freebindless_tables(L, ud);
+    freechildren(L, DESCRIPTOR_SET_CACHE_MT, ud); /* their sets are being freed */
+    ec = ud->ddt->ResetDescriptorPool(device, descriptor_pool, flags);
     CheckError(L, ec);
     return 0;
     }
 
+/*------------------------------------------------------------------------------*
+ | Descriptor allocators (NONVK)                                                |
+ *------------------------------------------------------------------------------*/
+
+/* A descriptor allocator owns a list of descriptor pools, all created with pool
+ * sizes proportional to their maxSets according to the configured ratios. Sets are
+ * allocated from the current pool and, when it is exhausted, from the next one (a
+ * new pool is created when there are no more, each larger than the previous up to
+ * a maximum). Sets are not freed individually: the pools are all reset together,
+ * typically once per frame.
+ * In handle-only mode the sets are returned as raw handles (integers) instead of
+ * descriptor_set objects, which saves the cost of creating the userdata. */
+
+typedef struct {
+    VkDescriptorType type;
+    float ratio; /* descriptors per set */
+} ratio_t;
+
+typedef struct {
+    VkDescriptorPool pool;
+    uint32_t max_sets;
+    uint32_t sets; /* allocated sets */
+    int full; /* set when an allocation fails */
+} dpool_t;
+
+typedef struct {
+    ratio_t *ratio;
+    uint32_t nratios;
+    VkDescriptorPoolCreateFlags flags;
+    uint32_t sets_per_pool; /* maxSets for the next pool */
+    uint32_t max_sets_per_pool;
+    float growth;
+    int handle_only;
+    dpool_t *pool;
+    uint32_t npools, maxpools;
+    uint32_t current; /* pool being allocated from */
+    uint64_t allocated, retries, resets; /* statistics */
+} dalloc_t;
+
+static const ratio_t DefaultRatios[] = {
+    { VK_DESCRIPTOR_TYPE_SAMPLER, 0.5f },
+    { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 4.0f },
+    { VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 4.0f },
+    { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1.0f },
+    { VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, 1.0f },
+    { VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, 1.0f },
+    { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2.0f },
+    { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2.0f },
+    { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1.0f },
+    { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1.0f },
+    { VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 0.5f },
+};
+#define NDEFAULTRATIOS (sizeof(DefaultRatios)/sizeof(ratio_t))
+#define MAX_RATIOS 32
+
+static void freedalloc(lua_State *L, ud_t *device_ud, dalloc_t *dalloc)
+    {
+    uint32_t i;
+    for(i = 0; i < dalloc->npools; i++)
+        device_ud->ddt->DestroyDescriptorPool(device_ud->device, dalloc->pool[i].pool, NULL);
+    Free(L, dalloc->pool);
+    Free(L, dalloc->ratio);
+    }
+
+static int freedescriptor_allocator(lua_State *L, ud_t *ud)
+    {
+    uint64_t handle = ud->handle;
+    dalloc_t *dalloc = (dalloc_t*)ud->info;
+    ud_t *device_ud = ud->parent_ud;
+    freechildren(L, DESCRIPTOR_SET_MT, ud);
+    if(!IsValid(ud)) return 0; /* double call */
+    freedalloc(L, device_ud, dalloc);
+    freeuserdata(L, ud); /* this also frees the dalloc_t */
+    TRACE_DELETE(handle, "descriptor_allocator");
+    return 0;
+    }
+
+static int checkratios(lua_State *L, int arg, dalloc_t *dalloc)
+/* pool_ratios = { { type = descriptortype, ratio = number }, ... } */
+    {
+    int err;
+    uint32_t i, n;
+    if(lua_isnoneornil(L, arg))
+        {
+        dalloc->ratio = (ratio_t*)MallocNoErr(L, sizeof(DefaultRatios));
+        if(!dalloc->ratio) return ERR_MEMORY;
+        memcpy(dalloc->ratio, DefaultRatios, sizeof(DefaultRatios));
+        dalloc->nratios = NDEFAULTRATIOS;
+        return 0;
+        }
+    if(!lua_istable(L, arg)) return ERR_TABLE;
+    n = luaL_len(L, arg);
+    if(n == 0) return ERR_EMPTY;
+    if(n > MAX_RATIOS) return ERR_LENGTH;
+    dalloc->ratio = (ratio_t*)MallocNoErr(L, n*sizeof(ratio_t));
+    if(!dalloc->ratio) return ERR_MEMORY;
+    dalloc->nratios = n;
+    for(i = 0; i < n; i++)
+        {
+        lua_rawgeti(L, arg, i+1);
+        if(!lua_istable(L, -1)) { lua_pop(L, 1); return ERR_TABLE; }
+        lua_getfield(L, -1, "type");
+        dalloc->ratio[i].type = testdescriptortype(L, -1, &err);
+        lua_getfield(L, -2, "ratio");
+        dalloc->ratio[i].ratio = lua_tonumber(L, -1);
+        lua_pop(L, 3);
+        if(err) return err;
+        if(dalloc->ratio[i].ratio <= 0) return ERR_VALUE;
+        }
+    return 0;
+    }
+
+static int CreateAllocator(lua_State *L)
+/* create_descriptor_allocator(device, [options]) */
+    {
+    int err;
+    ud_t *ud, *device_ud;
+    dalloc_t *dalloc;
+    VkDevice device = checkdevice(L, 1, &device_ud);
+    if(!lua_isnoneornil(L, 2)) luaL_checktype(L, 2, LUA_TTABLE);
+    dalloc = (dalloc_t*)Malloc(L, sizeof(dalloc_t));
+    dalloc->sets_per_pool = 64;
+    dalloc->max_sets_per_pool = 4096;
+    dalloc->growth = 2.0f;
+#define CLEANUP do { freedalloc(L, device_ud, dalloc); Free(L, dalloc); } while(0)
+    if(lua_istable(L, 2))
+        {
+        lua_getfield(L, 2, "sets_per_pool");
+        dalloc->sets_per_pool = luaL_optinteger(L, -1, dalloc->sets_per_pool);
+        lua_getfield(L, 2, "max_sets_per_pool");
+        dalloc->max_sets_per_pool = luaL_optinteger(L, -1, dalloc->max_sets_per_pool);
+        lua_getfield(L, 2, "growth");
+        dalloc->growth = luaL_optnumber(L, -1, dalloc->growth);
+        lua_getfield(L, 2, "flags");
+        /* sets are never freed individually, so the free bit is useless */
+        dalloc->flags = lua_tointeger(L, -1) & ~VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+        lua_getfield(L, 2, "handle_only");
+        dalloc->handle_only = lua_toboolean(L, -1);
+        lua_pop(L, 5);
+        if(dalloc->sets_per_pool == 0 || dalloc->growth < 1.0f)
+            { CLEANUP; return argerrorc(L, 2, ERR_VALUE); }
+        if(dalloc->max_sets_per_pool < dalloc->sets_per_pool)
+            dalloc->max_sets_per_pool = dalloc->sets_per_pool;
+        lua_getfield(L, 2, "pool_ratios");
+        err = checkratios(L, lua_gettop(L), dalloc);
+        lua_pop(L, 1);
+        }
+    else
+        err = checkratios(L, 0, dalloc);
+    if(err) { CLEANUP; return argerrorc(L, 2, err); }
+#undef CLEANUP
+    TRACE_CREATE(dalloc, "descriptor_allocator");
+    ud = newuserdata_nondispatchable(L, (uintptr_t)dalloc, DESCRIPTOR_ALLOCATOR_MT);
+    ud->parent_ud = device_ud;
+    ud->device = device;
+    ud->instance = device_ud->instance;
+    ud->destructor = freedescriptor_allocator;
+    ud->ddt = device_ud->ddt;
+    ud->info = dalloc;
+    return 1;
+    }
+
+static dalloc_t *checkdalloc(lua_State *L, int arg, ud_t **udp)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_allocator(L, arg, &ud);
+    if(udp) *udp = ud;
+    return (dalloc_t*)ud->info;
+    }
+
+static VkResult newpool(lua_State *L, ud_t *ud, dalloc_t *dalloc)
+/* Appends a new pool to the list */
+    {
+    VkResult ec;
+    uint32_t i, n;
+    float d;
+    dpool_t *p;
+    VkDescriptorPoolSize sizes[MAX_RATIOS];
+    VkDescriptorPoolCreateInfo info;
+    if(dalloc->npools == dalloc->maxpools)
+        {
+        n = dalloc->maxpools > 0 ? 2*dalloc->maxpools : 4;
+        p = (dpool_t*)MallocNoErr(L, n*sizeof(dpool_t));
+        if(!p) return VK_ERROR_OUT_OF_HOST_MEMORY;
+        if(dalloc->pool)
+            {
+            memcpy(p, dalloc->pool, dalloc->npools*sizeof(dpool_t));
+            Free(L, dalloc->pool);
+            }
+        dalloc->pool = p;
+        dalloc->maxpools = n;
+        }
+    p = &dalloc->pool[dalloc->npools];
+    memset(p, 0, sizeof(dpool_t));
+    p->max_sets = dalloc->sets_per_pool;
+    for(i = 0; i < dalloc->nratios; i++)
+        {
+        sizes[i].type = dalloc->ratio[i].type;
+        d = dalloc->ratio[i].ratio * p->max_sets;
+        n = (uint32_t)d;
+        sizes[i].descriptorCount = n < d ? n + 1 : n; /* ceil */
+        }
+    memset(&info, 0, sizeof(info));
+    info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    info.flags = dalloc->flags;
+    info.maxSets = p->max_sets;
+    info.poolSizeCount = dalloc->nratios;
+    info.pPoolSizes = sizes;
+    ec = ud->ddt->CreateDescriptorPool(ud->device, &info, NULL, &p->pool);
+    if(ec) return ec;
+    dalloc->npools++;
+    /* the next pool will be larger */
+    n = (uint32_t)(dalloc->sets_per_pool * dalloc->growth);
+    dalloc->sets_per_pool = n < dalloc->max_sets_per_pool ? n : dalloc->max_sets_per_pool;
+    return VK_SUCCESS;
+    }
+
+static int Allocate(lua_State *L)
+/* descriptor_allocator_allocate(allocator, {descriptor_set_layout}) */
+    {
+    int err;
+    ud_t *ud;
+    dalloc_t *dalloc;
+    dpool_t *p;
+    VkResult ec;
+    uint32_t count, i;
+    VkDescriptorSetLayout *layouts;
+    VkDescriptorSet *sets;
+    VkDescriptorSetAllocateInfo info;
+
+    dalloc = checkdalloc(L, 1, &ud);
+    layouts = checkdescriptor_set_layoutlist(L, 2, &count, &err, NULL);
+    if(err) return argerrorc(L, 2, err);
+    sets = (VkDescriptorSet*)MallocNoErr(L, count*sizeof(VkDescriptorSet));
+    if(!sets) { Free(L, layouts); return errmemory(L); }
+#define CLEANUP do { Free(L, layouts); Free(L, sets); } while(0)
+    memset(&info, 0, sizeof(info));
+    info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    info.descriptorSetCount = count;
+    info.pSetLayouts = layouts;
+    while(1)
+        {
+        if(dalloc->current == dalloc->npools)
+            {
+            if(dalloc->sets_per_pool < count) dalloc->sets_per_pool = count;
+            ec = newpool(L, ud, dalloc);
+            if(ec) { CLEANUP; CheckError(L, ec); return 0; }
+            }
+        p = &dalloc->pool[dalloc->current];
+        if(!p->full && (p->sets + count <= p->max_sets))
+            {
+            info.descriptorPool = p->pool;
+            ec = ud->ddt->AllocateDescriptorSets(ud->device, &info, sets);
+            if(ec == VK_SUCCESS)
+                break;
+            if(ec != VK_ERROR_OUT_OF_POOL_MEMORY && ec != VK_ERROR_FRAGMENTED_POOL)
+                { CLEANUP; CheckError(L, ec); return 0; }
+            if(p->sets == 0) /* the sets do not fit even in an empty pool */
+                { CLEANUP; CheckError(L, ec); return 0; }
+            dalloc->retries++;
+            }
+        p->full = 1;
+        dalloc->current++;
+        }
+    p->sets += count;
+    dalloc->allocated += count;
+
+    lua_createtable(L, count, 0);
+    for(i = 0; i < count; i++)
+        {
+        if(dalloc->handle_only)
+            lua_pushinteger(L, (lua_Integer)(uintptr_t)sets[i]);
+        else
+            {
+            newdescriptor_set(L, sets[i], ud); /* freed only on reset */
+            }
+        lua_rawseti(L, -2, i+1);
+        }
+    CLEANUP;
+#undef CLEANUP
+    return 1;
+    }
+
+static int ResetAllocator(lua_State *L)
+/* Resets all the pools, invalidating all the sets allocated from them */
+    {
+    ud_t *ud;
+    uint32_t i;
+    VkResult ec;
+    dpool_t *p;
+    dalloc_t *dalloc = checkdalloc(L, 1, &ud);
+    if(!dalloc->handle_only)
+        freechildren(L, DESCRIPTOR_SET_MT, ud);
+    for(i = 0; i < dalloc->npools; i++)
+        {
+        p = &dalloc->pool[i];
+        if(p->sets == 0 && !p->full) continue;
+        ec = ud->ddt->ResetDescriptorPool(ud->device, p->pool, 0);
+        CheckError(L, ec);
+        p->sets = 0;
+        p->full = 0;
+        }
+    dalloc->current = 0;
+    dalloc->resets++;
+    return 0;
+    }
+
+static int AllocatorStats(lua_State *L)
+    {
+    uint32_t i;
+    dpool_t *p;
+    dalloc_t *dalloc = checkdalloc(L, 1, NULL);
+    lua_newtable(L);
+    lua_pushinteger(L, dalloc->allocated); lua_setfield(L, -2, "allocated");
+    lua_pushinteger(L, dalloc->retries); lua_setfield(L, -2, "retries");
+    lua_pushinteger(L, dalloc->resets); lua_setfield(L, -2, "resets");
+    lua_pushinteger(L, dalloc->current); lua_setfield(L, -2, "current");
+    lua_createtable(L, dalloc->npools, 0);
+    for(i = 0; i < dalloc->npools; i++)
+        {
+        p = &dalloc->pool[i];
+        lua_createtable(L, 0, 4);
+        lua_pushinteger(L, p->max_sets); lua_setfield(L, -2, "max_sets");
+        lua_pushinteger(L, p->sets); lua_setfield(L, -2, "sets");
+        lua_pushnumber(L, (double)p->sets/p->max_sets); lua_setfield(L, -2, "utilization");
+        lua_pushboolean(L, p->full); lua_setfield(L, -2, "full");
+        lua_rawseti(L, -2, i+1);
+        }
+    lua_setfield(L, -2, "pools");
+    return 1;
+    }
+
+static int AllocatorType(lua_State *L)
+    {
+    (void)checkdescriptor_allocator(L, 1, NULL);
+    lua_pushstring(L, "descriptor_allocator");
+    return 1;
+    }
+
+static int AllocatorInstance(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_allocator(L, 1, &ud);
+    return pushinstance(L, ud->instance);
+    }
+
+static int AllocatorDevice(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_allocator(L, 1, &ud);
+    return pushdevice(L, ud->device);
+    }
+
+static int AllocatorDelete(lua_State *L)
+    {
+    ud_t *ud;
+    (void)testdescriptor_allocator(L, 1, &ud);
+    if(!ud) return 0; /* already deleted */
+    return ud->destructor(L, ud);
+    }
+
+static int AllocatorDestroy(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_allocator(L, 1, &ud);
+    return ud->destructor(L, ud);
+    }
+
 RAW_FUNC(descriptor_pool)
 TYPE_FUNC(descriptor_pool)
 INSTANCE_FUNC(descriptor_pool)
@@ -119,11 +491,34 @@ static const struct luaL_Reg MetaMethods[] =
         { NULL, NULL } /* sentinel */
     };
 
+static const struct luaL_Reg AllocatorMethods[] = 
+    {
+        { "type", AllocatorType },
+        { "instance", AllocatorInstance },
+        { "device", AllocatorDevice },
+        { "parent", AllocatorDevice },
+        { "allocate", Allocate },
+        { "reset", ResetAllocator },
+        { "stats", AllocatorStats },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg AllocatorMetaMethods[] = 
+    {
+        { "__gc",  AllocatorDelete },
+        { NULL, NULL } /* sentinel */
+    };
+
 static const struct luaL_Reg Functions[] = 
     {
         { "create_descriptor_pool",  Create },
         { "destroy_descriptor_pool",  Destroy },
         { "reset_descriptor_pool", ResetDescriptorPool },
+        { "create_descriptor_allocator",  CreateAllocator },
+        { "destroy_descriptor_allocator",  AllocatorDestroy },
+        { "descriptor_allocator_allocate", Allocate },
+        { "descriptor_allocator_reset", ResetAllocator },
+        { "descriptor_allocator_stats", AllocatorStats },
         { NULL, NULL } /* sentinel */
     };
 
@@ -131,6 +526,7 @@ static const struct luaL_Reg Functions[] =
 void moonvulkan_open_descriptor_pool(lua_State *L)
     {
     udata_define(L, DESCRIPTOR_POOL_MT, Methods, MetaMethods);
+    udata_define(L, DESCRIPTOR_ALLOCATOR_MT, AllocatorMethods, AllocatorMetaMethods);
     luaL_setfuncs(L, Functions, 0);
     }
 
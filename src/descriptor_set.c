@@ -32,6 +32,7 @@ static int freedescriptor_set(lua_State *L, ud_t *ud)
     VkDevice device = ud->device;
     VkDescriptorPool descriptor_pool = (VkDescriptorPool)ud->parent_ud->handle;
     int free_allowed = IsFreeDescriptorSetAllowed(ud->parent_ud);
+    freechildren(L, BINDLESS_TABLE_MT, ud);
     freeuserdata(L, ud);
     TRACE_DELETE(descriptor_set, "descriptor_set");
     if(!free_allowed)
@@ -41,9 +42,66 @@ static int freedescriptor_set(lua_State *L, ud_t *ud)
     return 0;
     }
 
+ud_t *newdescriptor_set(lua_State *L, VkDescriptorSet descriptor_set, ud_t *parent_ud)
+/* Creates the userdata for a descriptor set allocated from parent_ud (a descriptor_pool
+ * or a descriptor_allocator) and leaves it on top of the stack. */
+    {
+    ud_t *ud;
+    TRACE_CREATE(descriptor_set, "descriptor_set");
+    ud = newuserdata_nondispatchable(L, descriptor_set, DESCRIPTOR_SET_MT);
+    ud->parent_ud = parent_ud;
+    ud->device = parent_ud->device;
+    ud->instance = parent_ud->instance;
+    ud->destructor = freedescriptor_set;
+    ud->ddt = parent_ud->ddt;
+    return ud;
+    }
+
+VkDescriptorSet checkdescriptor_sethandle(lua_State *L, int arg)
+/* Accepts either a descriptor_set object or a raw handle (e.g. from a descriptor
+ * allocator in handle-only mode). */
+    {
+    if(lua_type(L, arg) == LUA_TNUMBER)
+        return (VkDescriptorSet)(uintptr_t)luaL_checkinteger(L, arg);
+    return checkdescriptor_set(L, arg, NULL);
+    }
+
+VkDescriptorSet *checkdescriptor_sethandlelistbuf(lua_State *L, int arg, VkDescriptorSet *buf, uint32_t bufcount, uint32_t *count, int *err)
+/* Same as checkdescriptor_setlist(), but the elements may also be raw handles, and buf is
+ * used if the list has no more than bufcount elements (release the list with FreeBuf()) */
+    {
+    uint32_t i;
+    VkDescriptorSet *list;
+    *count = 0;
+    *err = 0;
+    if(lua_isnoneornil(L, arg)) { *err = ERR_NOTPRESENT; return NULL; }
+    if(lua_type(L, arg) != LUA_TTABLE) { *err = ERR_TABLE; return NULL; }
+    *count = luaL_len(L, arg);
+    if(*count == 0) { *err = ERR_EMPTY; return NULL; }
+    if(buf && *count <= bufcount)
+        list = buf;
+    else
+        list = (VkDescriptorSet*)MallocNoErr(L, sizeof(VkDescriptorSet) * (*count));
+    if(!list) { *count = 0; *err = ERR_MEMORY; return NULL; }
+    for(i = 0; i < *count; i++)
+        {
+        lua_rawgeti(L, arg, i+1);
+        if(lua_type(L, -1) == LUA_TNUMBER)
+            list[i] = (VkDescriptorSet)(uintptr_t)lua_tointeger(L, -1);
+        else
+            list[i] = testdescriptor_set(L, -1, NULL);
+        lua_pop(L, 1);
+        if(!list[i]) { FreeBuf(L, list, buf); *count = 0; *err = ERR_TYPE; return NULL; }
+        }
+    return list;
+    }
+
+VkDescriptorSet *checkdescriptor_sethandlelist(lua_State *L, int arg, uint32_t *count, int *err)
+    { return checkdescriptor_sethandlelistbuf(L, arg, NULL, 0, count, err); }
+
 static int Create(lua_State *L)
     {
-    ud_t *ud, *descriptor_pool_ud;
+    ud_t *descriptor_pool_ud;
     int err, isinfo;
     uint32_t count, i;
     VkResult ec;
@@ -91,14 +149,8 @@ static int Create(lua_State *L)
     lua_newtable(L);
     for(i=0; i < count; i++)
         {
-        TRACE_CREATE(descriptor_set[i], "descriptor_set");
-        ud = newuserdata_nondispatchable(L, descriptor_set[i], DESCRIPTOR_SET_MT);
-        ud->parent_ud = descriptor_pool_ud;
-        ud->device = device;
-        ud->instance = UD(device)->instance;
-        ud->destructor = freedescriptor_set;
+        newdescriptor_set(L, descriptor_set[i], descriptor_pool_ud);
         lua_rawseti(L, -2, i+1);
-        ud->ddt = descriptor_pool_ud->ddt;
         }
 
     Free(L, descriptor_set);
@@ -114,7 +166,7 @@ static int FreeDescriptorSets(lua_State *L)
     VkDescriptorPool descriptor_pool;
     VkDescriptorSet *descriptor_set = checkdescriptor_setlist(L, 1, &count, &err, &ud);
     if(err) return argerrorc(L, 1, err);
-    free_allowed = IsFreeDescriptorSetAllowed(ud[1]->parent_ud);
+    free_allowed = IsFreeDescriptorSetAllowed(ud[0]->parent_ud);
 #define CLEANUP do {  Free(L, descriptor_set); Free(L, ud); } while(0)
     /* check that they all are from the same pool */
     for(i = 1; i < count; i++)
@@ -126,6 +178,7 @@ static int FreeDescriptorSets(lua_State *L)
     descriptor_pool = (VkDescriptorPool)ud[0]->parent_ud->handle;
     for(i = 0; i < count; i++)
         {
+        freechildren(L, BINDLESS_TABLE_MT, ud[i]);
         freeuserdata(L, ud[i]);
         TRACE_DELETE(descriptor_set[i], "descriptor_set");
         }
@@ -174,6 +227,374 @@ static int UpdateDescriptorSets(lua_State *L)
 #undef CLEANUP
     }
 
+/*------------------------------------------------------------------------------*
+ | Descriptor info helpers                                                      |
+ *------------------------------------------------------------------------------*/
+
+/* These parse a descriptorimageinfo or descriptorbufferinfo in a caller's struct,
+ * without allocating memory, and return an ERR_XXX code. */
+
+int descriptorimageinfo(lua_State *L, int arg, VkDescriptorImageInfo *p)
+    {
+    int err = 0;
+    int top = lua_gettop(L);
+    if(!lua_istable(L, arg)) return ERR_TABLE;
+    lua_getfield(L, arg, "sampler");
+    p->sampler = testsampler(L, -1, NULL);
+    lua_getfield(L, arg, "image_view");
+    p->imageView = testimage_view(L, -1, NULL);
+    lua_getfield(L, arg, "image_layout");
+    p->imageLayout = lua_isnoneornil(L, -1) ? VK_IMAGE_LAYOUT_UNDEFINED : testimagelayout(L, -1, &err);
+    lua_settop(L, top);
+    return err;
+    }
+
+int descriptorbufferinfo(lua_State *L, int arg, VkDescriptorBufferInfo *p)
+    {
+    int err = 0;
+    int top = lua_gettop(L);
+    if(!lua_istable(L, arg)) return ERR_TABLE;
+    lua_getfield(L, arg, "buffer");
+    p->buffer = testbuffer(L, -1, NULL);
+    lua_getfield(L, arg, "offset");
+    p->offset = luaL_optinteger(L, -1, 0);
+    lua_getfield(L, arg, "range");
+    if(lua_isnoneornil(L, -1) || 
+            (lua_type(L, -1) == LUA_TSTRING && strcmp(lua_tostring(L, -1), "whole size") == 0))
+        p->range = VK_WHOLE_SIZE;
+    else if(lua_isinteger(L, -1))
+        p->range = lua_tointeger(L, -1);
+    else
+        err = ERR_VALUE;
+    lua_settop(L, top);
+    return err;
+    }
+
+/*------------------------------------------------------------------------------*
+ | Descriptor writers (NONVK)                                                   |
+ *------------------------------------------------------------------------------*/
+
+/* A descriptor writer accumulates descriptor writes and copies in arrays that are
+ * reused from one flush to the next, so that many small updates are converted
+ * without allocating memory and submitted with a single vkUpdateDescriptorSets().
+ * While accumulating, the pImageInfo/pBufferInfo/pTexelBufferView of a write hold
+ * the index+1 of its first info in the corresponding array (the arrays may move when
+ * they grow), and they are resolved to pointers on flush. */
+
+typedef struct {
+    VkWriteDescriptorSet *write;
+    uint32_t nwrites, maxwrites;
+    VkCopyDescriptorSet *copy;
+    uint32_t ncopies, maxcopies;
+    VkDescriptorImageInfo *image;
+    uint32_t nimages, maximages;
+    VkDescriptorBufferInfo *buffer;
+    uint32_t nbuffers, maxbuffers;
+    VkBufferView *view;
+    uint32_t nviews, maxviews;
+    uint64_t flushes, updates; /* statistics */
+} writer_t;
+
+#define WRITER_MIN 16 /* initial size of the arrays */
+
+static int grow(lua_State *L, void **array, uint32_t *max, uint32_t needed, size_t elsize)
+/* Grows the array (doubling its size) so that it can contain at least 'needed'
+ * elements, preserving its contents. Returns ERR_MEMORY on failure. */
+    {
+    void *p;
+    uint32_t n = *max > 0 ? *max : WRITER_MIN;
+    if(needed <= *max) return 0;
+    while(n < needed) n *= 2;
+    p = MallocNoErr(L, n*elsize);
+    if(!p) return ERR_MEMORY;
+    if(*array)
+        {
+        memcpy(p, *array, (*max)*elsize);
+        Free(L, *array);
+        }
+    *array = p;
+    *max = n;
+    return 0;
+    }
+#define Grow(L, array, max, needed, T) grow((L), (void**)&(array), &(max), (needed), sizeof(T))
+
+static int freewriter(lua_State *L, ud_t *ud)
+    {
+    uint64_t handle = ud->handle;
+    writer_t *writer = (writer_t*)ud->info;
+    Free(L, writer->write);
+    Free(L, writer->copy);
+    Free(L, writer->image);
+    Free(L, writer->buffer);
+    Free(L, writer->view);
+    if(!freeuserdata(L, ud)) /* this also frees the writer_t */
+        return 0; /* double call */
+    TRACE_DELETE(handle, "descriptor_writer");
+    return 0;
+    }
+
+static int CreateWriter(lua_State *L)
+    {
+    ud_t *ud, *device_ud;
+    writer_t *writer;
+    VkDevice device = checkdevice(L, 1, &device_ud);
+    writer = (writer_t*)Malloc(L, sizeof(writer_t));
+    TRACE_CREATE(writer, "descriptor_writer");
+    ud = newuserdata_nondispatchable(L, (uintptr_t)writer, DESCRIPTOR_WRITER_MT);
+    ud->parent_ud = device_ud;
+    ud->device = device;
+    ud->instance = device_ud->instance;
+    ud->destructor = freewriter;
+    ud->ddt = device_ud->ddt;
+    ud->info = writer;
+    return 1;
+    }
+
+static writer_t *checkwriter(lua_State *L, int arg, ud_t **udp)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_writer(L, arg, &ud);
+    if(udp) *udp = ud;
+    return (writer_t*)ud->info;
+    }
+
+#define IMAGES 0
+#define BUFFERS 1
+#define VIEWS 2
+static int kindof(VkDescriptorType type)
+/* Returns the kind of info used to write descriptors of the given type, or -1 */
+    {
+    switch(type)
+        {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: return IMAGES;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: return VIEWS;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: return BUFFERS;
+        default: return -1;
+        }
+    }
+
+static int Write(lua_State *L, int what)
+/* descriptor_writer_write_xxx(writer, dst_set, dst_binding, dst_array_element, descriptortype, info|{info}) */
+    {
+    int err = 0, islist;
+    uint32_t count, i;
+    VkWriteDescriptorSet *w;
+    writer_t *writer = checkwriter(L, 1, NULL);
+    VkDescriptorSet dst_set = checkdescriptor_sethandle(L, 2);
+    uint32_t binding = luaL_checkinteger(L, 3);
+    uint32_t element = luaL_checkinteger(L, 4);
+    VkDescriptorType type = checkdescriptortype(L, 5);
+    if(kindof(type) != what) return argerrorc(L, 5, ERR_VALUE);
+
+    if(what == VIEWS)
+        islist = lua_istable(L, 6);
+    else
+        {
+        if(!lua_istable(L, 6)) return argerrorc(L, 6, ERR_TABLE);
+        islist = (lua_rawgeti(L, 6, 1) != LUA_TNIL);
+        lua_pop(L, 1);
+        }
+    count = islist ? luaL_len(L, 6) : 1;
+    if(count == 0) return argerrorc(L, 6, ERR_EMPTY);
+    
+    if(Grow(L, writer->write, writer->maxwrites, writer->nwrites + 1, VkWriteDescriptorSet)) return errmemory(L);
+    switch(what)
+        {
+        case IMAGES: err = Grow(L, writer->image, writer->maximages, writer->nimages + count, VkDescriptorImageInfo); break;
+        case BUFFERS: err = Grow(L, writer->buffer, writer->maxbuffers, writer->nbuffers + count, VkDescriptorBufferInfo); break;
+        case VIEWS: err = Grow(L, writer->view, writer->maxviews, writer->nviews + count, VkBufferView); break;
+        }
+    if(err) return errmemory(L);
+
+    for(i = 0; i < count; i++)
+        {
+        if(islist) lua_rawgeti(L, 6, i+1); else lua_pushvalue(L, 6);
+        switch(what)
+            {
+            case IMAGES: 
+                err = descriptorimageinfo(L, lua_gettop(L), &writer->image[writer->nimages + i]);
+                break;
+            case BUFFERS: 
+                err = descriptorbufferinfo(L, lua_gettop(L), &writer->buffer[writer->nbuffers + i]);
+                break;
+            case VIEWS: 
+                writer->view[writer->nviews + i] = testbuffer_view(L, -1, NULL);
+                if(!writer->view[writer->nviews + i]) err = ERR_TYPE;
+                break;
+            }
+        lua_pop(L, 1);
+        if(err) return argerrorc(L, 6, err); /* nothing has been committed yet */
+        }
+
+    w = &writer->write[writer->nwrites++];
+    memset(w, 0, sizeof(VkWriteDescriptorSet));
+    w->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    w->dstSet = dst_set;
+    w->dstBinding = binding;
+    w->dstArrayElement = element;
+    w->descriptorCount = count;
+    w->descriptorType = type;
+    switch(what) /* store the indices+1 of the first infos, resolved on flush */
+        {
+        case IMAGES: 
+            w->pImageInfo = (VkDescriptorImageInfo*)(uintptr_t)(writer->nimages + 1);
+            writer->nimages += count; 
+            break;
+        case BUFFERS: 
+            w->pBufferInfo = (VkDescriptorBufferInfo*)(uintptr_t)(writer->nbuffers + 1);
+            writer->nbuffers += count; 
+            break;
+        case VIEWS: 
+            w->pTexelBufferView = (VkBufferView*)(uintptr_t)(writer->nviews + 1);
+            writer->nviews += count; 
+            break;
+        }
+    return 0;
+    }
+
+static int WriteImages(lua_State *L)
+    { return Write(L, IMAGES); }
+
+static int WriteBuffers(lua_State *L)
+    { return Write(L, BUFFERS); }
+
+static int WriteTexelBuffers(lua_State *L)
+    { return Write(L, VIEWS); }
+
+#undef IMAGES
+#undef BUFFERS
+#undef VIEWS
+
+static int Copy(lua_State *L)
+/* descriptor_writer_copy(writer, src_set, src_binding, src_array_element,
+ *                                dst_set, dst_binding, dst_array_element, count) */
+    {
+    VkCopyDescriptorSet *c;
+    writer_t *writer = checkwriter(L, 1, NULL);
+    VkDescriptorSet src_set = checkdescriptor_sethandle(L, 2);
+    uint32_t src_binding = luaL_checkinteger(L, 3);
+    uint32_t src_element = luaL_checkinteger(L, 4);
+    VkDescriptorSet dst_set = checkdescriptor_sethandle(L, 5);
+    uint32_t dst_binding = luaL_checkinteger(L, 6);
+    uint32_t dst_element = luaL_checkinteger(L, 7);
+    uint32_t count = luaL_optinteger(L, 8, 1);
+    if(Grow(L, writer->copy, writer->maxcopies, writer->ncopies + 1, VkCopyDescriptorSet)) return errmemory(L);
+    c = &writer->copy[writer->ncopies++];
+    memset(c, 0, sizeof(VkCopyDescriptorSet));
+    c->sType = VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET;
+    c->srcSet = src_set;
+    c->srcBinding = src_binding;
+    c->srcArrayElement = src_element;
+    c->dstSet = dst_set;
+    c->dstBinding = dst_binding;
+    c->dstArrayElement = dst_element;
+    c->descriptorCount = count;
+    return 0;
+    }
+
+static void reset(writer_t *writer)
+    {
+    writer->nwrites = writer->ncopies = 0;
+    writer->nimages = writer->nbuffers = writer->nviews = 0;
+    }
+
+static int Flush(lua_State *L)
+/* Issues all the accumulated writes and copies with a single vkUpdateDescriptorSets()
+ * and resets the writer, keeping its arrays. Returns the number of writes and copies. */
+    {
+    ud_t *ud;
+    uint32_t i;
+    VkWriteDescriptorSet *w;
+    writer_t *writer = checkwriter(L, 1, &ud);
+    uint32_t nwrites = writer->nwrites, ncopies = writer->ncopies;
+    if(nwrites + ncopies > 0)
+        {
+        for(i = 0; i < nwrites; i++)
+            {
+            w = &writer->write[i];
+            if(w->pImageInfo)
+                w->pImageInfo = &writer->image[(uintptr_t)w->pImageInfo - 1];
+            else if(w->pBufferInfo)
+                w->pBufferInfo = &writer->buffer[(uintptr_t)w->pBufferInfo - 1];
+            else if(w->pTexelBufferView)
+                w->pTexelBufferView = &writer->view[(uintptr_t)w->pTexelBufferView - 1];
+            }
+        ud->ddt->UpdateDescriptorSets(ud->device, nwrites, writer->write, ncopies, writer->copy);
+        writer->flushes++;
+        writer->updates += nwrites + ncopies;
+        }
+    reset(writer);
+    lua_pushinteger(L, nwrites);
+    lua_pushinteger(L, ncopies);
+    return 2;
+    }
+
+static int Reset(lua_State *L)
+/* Discards the accumulated writes and copies */
+    {
+    reset(checkwriter(L, 1, NULL));
+    return 0;
+    }
+
+static int WriterStats(lua_State *L)
+    {
+    writer_t *writer = checkwriter(L, 1, NULL);
+    lua_newtable(L);
+    lua_pushinteger(L, writer->nwrites); lua_setfield(L, -2, "pending_writes");
+    lua_pushinteger(L, writer->ncopies); lua_setfield(L, -2, "pending_copies");
+    lua_pushinteger(L, writer->flushes); lua_setfield(L, -2, "flushes");
+    lua_pushinteger(L, writer->updates); lua_setfield(L, -2, "updates");
+    return 1;
+    }
+
+static int WriterType(lua_State *L)
+    {
+    (void)checkdescriptor_writer(L, 1, NULL);
+    lua_pushstring(L, "descriptor_writer");
+    return 1;
+    }
+
+static int WriterInstance(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_writer(L, 1, &ud);
+    return pushinstance(L, ud->instance);
+    }
+
+static int WriterDevice(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_writer(L, 1, &ud);
+    return pushdevice(L, ud->device);
+    }
+
+static int WriterDelete(lua_State *L)
+    {
+    ud_t *ud;
+    (void)testdescriptor_writer(L, 1, &ud);
+    if(!ud) return 0; /* already deleted */
+    return ud->destructor(L, ud);
+    }
+
+static int WriterDestroy(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_writer(L, 1, &ud);
+    return ud->destructor(L, ud);
+    }
+
+/*------------------------------------------------------------------------------*
+ | Registration                                                                 |
+ *------------------------------------------------------------------------------*/
+
 static const struct luaL_Reg Methods[] = 
     {
         { "raw", Raw },
@@ -190,11 +611,42 @@ static const struct luaL_Reg MetaMethods[] =
         { NULL, NULL } /* sentinel */
     };
 
+static const struct luaL_Reg WriterMethods[] = 
+    {
+        { "type", WriterType },
+        { "instance", WriterInstance },
+        { "device", WriterDevice },
+        { "parent", WriterDevice },
+        { "write_images", WriteImages },
+        { "write_buffers", WriteBuffers },
+        { "write_texel_buffers", WriteTexelBuffers },
+        { "copy", Copy },
+        { "flush", Flush },
+        { "reset", Reset },
+        { "stats", WriterStats },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg WriterMetaMethods[] = 
+    {
+        { "__gc",  WriterDelete },
+        { NULL, NULL } /* sentinel */
+    };
+
 static const struct luaL_Reg Functions[] = 
     {
         { "allocate_descriptor_sets",  Create },
         { "free_descriptor_sets",  FreeDescriptorSets },
         { "update_descriptor_sets", UpdateDescriptorSets },
+        { "create_descriptor_writer", CreateWriter },
+        { "destroy_descriptor_writer", WriterDestroy },
+        { "descriptor_writer_write_images", WriteImages },
+        { "descriptor_writer_write_buffers", WriteBuffers },
+        { "descriptor_writer_write_texel_buffers", WriteTexelBuffers },
+        { "descriptor_writer_copy", Copy },
+        { "descriptor_writer_flush", Flush },
+        { "descriptor_writer_reset", Reset },
+        { "descriptor_writer_stats", WriterStats },
         { NULL, NULL } /* sentinel */
     };
 
@@ -202,6 +654,7 @@ static const struct luaL_Reg Functions[] =
 void moonvulkan_open_descriptor_set(lua_State *L)
     {
     udata_define(L, DESCRIPTOR_SET_MT, Methods, MetaMethods);
+    udata_define(L, DESCRIPTOR_WRITER_MT, WriterMethods, WriterMetaMethods);
     luaL_setfuncs(L, Functions, 0);
     }
 
@@ -0,0 +1,502 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Stefano Trettel
+ *
+ * Software repository: MoonVulkan, https://github.com/stetre/moonvulkan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "internal.h"
+
+/* Descriptor set caches (NONVK).
+ *
+ * A descriptor set cache returns descriptor sets given their layout and contents,
+ * allocating and writing a new set only if there is no set in the cache with the
+ * same layout and contents. The key is the layout handle followed by the ordered
+ * bindings and the objects (and offsets, ranges, layouts) they contain, and the map
+ * from keys to entries is a Lua table (with map[key] = index and map[index] = key).
+ * Objects are identified in the key by the address of their userdata, not by their
+ * handles, and each entry keeps references to them in refs[index] (ud->ref2) until
+ * it is evicted, so that the userdata can not be recycled: an object destroyed and
+ * replaced by a new one (possibly with the same handle) can not match a stale entry.
+ *
+ * Sets are allocated from a descriptor pool, and they are never freed while the
+ * cache exists: entries that have not been used for max_age frames are evicted,
+ * and their sets are reused (rewritten) for new entries with the same layout.
+ * max_age must be at least the number of frames in flight, so that a set is never
+ * rewritten while the device may still be using it.
+ */
+
+#define KIND_IMAGE  1
+#define KIND_BUFFER 2
+#define KIND_VIEW   3
+
+typedef struct {
+    VkDescriptorSet set;
+    VkDescriptorSetLayout layout;
+    uint64_t frame; /* last frame the entry was used in */
+    int used; /* 0 if evicted (the set can be reused) */
+} entry_t;
+
+typedef struct {
+    entry_t *entry;
+    uint32_t nentries, maxentries;
+    uint64_t frame;
+    uint32_t max_age;
+    /* scratch space for parsing the contents, reused from one call to the next */
+    VkWriteDescriptorSet *write;
+    uint32_t nwrites, maxwrites;
+    VkDescriptorImageInfo *image;
+    uint32_t nimages, maximages;
+    VkDescriptorBufferInfo *buffer;
+    uint32_t nbuffers, maxbuffers;
+    VkBufferView *view;
+    uint32_t nviews, maxviews;
+    char *key;
+    uint32_t keylen, maxkey;
+    uint64_t hits, misses, evictions, allocations; /* statistics */
+} cache_t;
+
+static int kindof(VkDescriptorType type)
+    {
+    switch(type)
+        {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: return KIND_IMAGE;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: return KIND_VIEW;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: return KIND_BUFFER;
+        default: return 0;
+        }
+    }
+
+static int grow(lua_State *L, void **array, uint32_t *max, uint32_t needed, size_t elsize)
+/* Grows the array (doubling its size) so that it can contain at least 'needed'
+ * elements, preserving its contents. Returns ERR_MEMORY on failure. */
+    {
+    void *p;
+    uint32_t n = *max > 0 ? *max : 16;
+    if(needed <= *max) return 0;
+    while(n < needed) n *= 2;
+    p = MallocNoErr(L, n*elsize);
+    if(!p) return ERR_MEMORY;
+    if(*array)
+        {
+        memcpy(p, *array, (*max)*elsize);
+        Free(L, *array);
+        }
+    *array = p;
+    *max = n;
+    return 0;
+    }
+
+static int keyadd(lua_State *L, cache_t *cache, const void *data, uint32_t len)
+    {
+    if(grow(L, (void**)&cache->key, &cache->maxkey, cache->keylen + len, 1)) return ERR_MEMORY;
+    memcpy(cache->key + cache->keylen, data, len);
+    cache->keylen += len;
+    return 0;
+    }
+
+static int freedescriptor_set_cache(lua_State *L, ud_t *ud)
+    {
+    uint32_t i;
+    uint64_t handle = ud->handle;
+    cache_t *cache = (cache_t*)ud->info;
+    ud_t *pool_ud = ud->parent_ud;
+    if(!IsValid(ud)) return 0; /* double call */
+    if(IsFreeDescriptorSetAllowed(pool_ud))
+        {
+        for(i = 0; i < cache->nentries; i++)
+            pool_ud->ddt->FreeDescriptorSets(pool_ud->device, (VkDescriptorPool)pool_ud->handle, 
+                            1, &cache->entry[i].set);
+        }
+    Free(L, cache->entry);
+    Free(L, cache->write);
+    Free(L, cache->image);
+    Free(L, cache->buffer);
+    Free(L, cache->view);
+    Free(L, cache->key);
+    freeuserdata(L, ud); /* this also frees the cache_t and unreferences the map */
+    TRACE_DELETE(handle, "descriptor_set_cache");
+    return 0;
+    }
+
+static int Create(lua_State *L)
+/* create_descriptor_set_cache(descriptor_pool, [max_age]) */
+    {
+    ud_t *ud, *pool_ud;
+    cache_t *cache;
+    uint32_t max_age;
+    (void)checkdescriptor_pool(L, 1, &pool_ud);
+    max_age = luaL_optinteger(L, 2, 3);
+    if(max_age == 0) return argerrorc(L, 2, ERR_VALUE);
+    cache = (cache_t*)Malloc(L, sizeof(cache_t));
+    cache->max_age = max_age;
+    TRACE_CREATE(cache, "descriptor_set_cache");
+    ud = newuserdata_nondispatchable(L, (uintptr_t)cache, DESCRIPTOR_SET_CACHE_MT);
+    ud->parent_ud = pool_ud;
+    ud->device = pool_ud->device;
+    ud->instance = pool_ud->instance;
+    ud->destructor = freedescriptor_set_cache;
+    ud->ddt = pool_ud->ddt;
+    ud->info = cache;
+    lua_newtable(L);
+    ud->ref1 = luaL_ref(L, LUA_REGISTRYINDEX); /* the map */
+    lua_newtable(L);
+    ud->ref2 = luaL_ref(L, LUA_REGISTRYINDEX); /* the objects referenced by the entries */
+    return 1;
+    }
+
+static cache_t *checkcache(lua_State *L, int arg, ud_t **udp)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_set_cache(L, arg, &ud);
+    if(udp) *udp = ud;
+    return (cache_t*)ud->info;
+    }
+
+static int keyobject(lua_State *L, cache_t *cache, int arg, const char *field, int refs)
+/* Adds to the key the identity of the object in the given field of the table at arg
+ * (or at arg itself, if field is NULL), and appends the object to the refs table */
+    {
+    void *p;
+    if(field) lua_getfield(L, arg, field); else lua_pushvalue(L, arg);
+    p = lua_touserdata(L, -1);
+    if(p)
+        lua_rawseti(L, refs, (lua_Integer)lua_rawlen(L, refs) + 1);
+    else
+        lua_pop(L, 1);
+    return keyadd(L, cache, &p, sizeof(p));
+    }
+
+static int checkinfo(lua_State *L, int arg, cache_t *cache, int kind, int refs)
+/* Parses the info at arg in the scratch arrays and adds it to the key */
+    {
+    int err;
+    VkDescriptorImageInfo *image;
+    VkDescriptorBufferInfo *buffer;
+    VkBufferView *view;
+    switch(kind)
+        {
+        case KIND_IMAGE:
+            if(grow(L, (void**)&cache->image, &cache->maximages, cache->nimages + 1, sizeof(VkDescriptorImageInfo)))
+                return ERR_MEMORY;
+            image = &cache->image[cache->nimages++];
+            err = descriptorimageinfo(L, arg, image);
+            if(!err) err = keyobject(L, cache, arg, "sampler", refs);
+            if(!err) err = keyobject(L, cache, arg, "image_view", refs);
+            if(!err) err = keyadd(L, cache, &image->imageLayout, sizeof(image->imageLayout));
+            return err;
+        case KIND_BUFFER:
+            if(grow(L, (void**)&cache->buffer, &cache->maxbuffers, cache->nbuffers + 1, sizeof(VkDescriptorBufferInfo)))
+                return ERR_MEMORY;
+            buffer = &cache->buffer[cache->nbuffers++];
+            err = descriptorbufferinfo(L, arg, buffer);
+            if(!err) err = keyobject(L, cache, arg, "buffer", refs);
+            if(!err) err = keyadd(L, cache, &buffer->offset, sizeof(buffer->offset));
+            if(!err) err = keyadd(L, cache, &buffer->range, sizeof(buffer->range));
+            return err;
+        case KIND_VIEW:
+            if(grow(L, (void**)&cache->view, &cache->maxviews, cache->nviews + 1, sizeof(VkBufferView)))
+                return ERR_MEMORY;
+            view = &cache->view[cache->nviews++];
+            *view = testbuffer_view(L, arg, NULL);
+            if(!*view) return ERR_TYPE;
+            return keyobject(L, cache, arg, NULL, refs);
+        }
+    return ERR_VALUE;
+    }
+
+static const char *InfoField[] = { NULL, "image_info", "buffer_info", "texel_buffer_view" };
+
+static int checkwrite(lua_State *L, int arg, cache_t *cache, int refs)
+/* Parses the writedescriptorset at arg (without dst_set) and adds it to the key */
+    {
+    int err, kind;
+    uint32_t i, first, count;
+    VkWriteDescriptorSet *w;
+    int top = lua_gettop(L);
+    if(!lua_istable(L, arg)) return ERR_TABLE;
+    if(grow(L, (void**)&cache->write, &cache->maxwrites, cache->nwrites + 1, sizeof(VkWriteDescriptorSet)))
+        return ERR_MEMORY;
+    w = &cache->write[cache->nwrites++];
+    memset(w, 0, sizeof(VkWriteDescriptorSet));
+    w->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    lua_getfield(L, arg, "dst_binding");
+    w->dstBinding = luaL_optinteger(L, -1, 0);
+    lua_getfield(L, arg, "dst_array_element");
+    w->dstArrayElement = luaL_optinteger(L, -1, 0);
+    lua_getfield(L, arg, "descriptor_type");
+    w->descriptorType = testdescriptortype(L, -1, &err);
+    if(err) { lua_settop(L, top); return err; }
+    kind = kindof(w->descriptorType);
+    if(kind == 0) { lua_settop(L, top); return ERR_VALUE; }
+    if(lua_getfield(L, arg, InfoField[kind]) != LUA_TTABLE) { lua_settop(L, top); return ERR_TABLE; }
+    count = luaL_len(L, -1);
+    if(count == 0) { lua_settop(L, top); return ERR_EMPTY; }
+    w->descriptorCount = count;
+    err = keyadd(L, cache, &w->dstBinding, sizeof(uint32_t));
+    if(!err) err = keyadd(L, cache, &w->dstArrayElement, sizeof(uint32_t));
+    if(!err) err = keyadd(L, cache, &w->descriptorType, sizeof(VkDescriptorType));
+    if(!err) err = keyadd(L, cache, &count, sizeof(uint32_t));
+    /* the index of the first info is resolved to a pointer after parsing */
+    first = kind == KIND_IMAGE ? cache->nimages : kind == KIND_BUFFER ? cache->nbuffers : cache->nviews;
+    for(i = 0; i < count && !err; i++)
+        {
+        lua_rawgeti(L, -1, i+1);
+        err = checkinfo(L, lua_gettop(L), cache, kind, refs);
+        lua_pop(L, 1);
+        }
+    switch(kind)
+        {
+        case KIND_IMAGE: w->pImageInfo = (VkDescriptorImageInfo*)(uintptr_t)(first + 1); break;
+        case KIND_BUFFER: w->pBufferInfo = (VkDescriptorBufferInfo*)(uintptr_t)(first + 1); break;
+        case KIND_VIEW: w->pTexelBufferView = (VkBufferView*)(uintptr_t)(first + 1); break;
+        }
+    lua_settop(L, top);
+    return err;
+    }
+
+static int getentry(lua_State *L, ud_t *ud, cache_t *cache, VkDescriptorSetLayout layout, uint32_t *index)
+/* Gets an evicted entry with the same layout, or a new one with a newly allocated set */
+    {
+    uint32_t i;
+    VkResult ec;
+    entry_t *e;
+    VkDescriptorSetAllocateInfo info;
+    ud_t *pool_ud = ud->parent_ud;
+    for(i = 0; i < cache->nentries; i++)
+        {
+        e = &cache->entry[i];
+        if(!e->used && e->layout == layout) { *index = i; return 0; }
+        }
+    if(grow(L, (void**)&cache->entry, &cache->maxentries, cache->nentries + 1, sizeof(entry_t)))
+        return errmemory(L);
+    e = &cache->entry[cache->nentries];
+    memset(e, 0, sizeof(entry_t));
+    memset(&info, 0, sizeof(info));
+    info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    info.descriptorPool = (VkDescriptorPool)pool_ud->handle;
+    info.descriptorSetCount = 1;
+    info.pSetLayouts = &layout;
+    ec = pool_ud->ddt->AllocateDescriptorSets(pool_ud->device, &info, &e->set);
+    CheckError(L, ec);
+    e->layout = layout;
+    cache->allocations++;
+    *index = cache->nentries++;
+    return 0;
+    }
+
+static int Get(lua_State *L)
+/* handle = descriptor_set_cache_get(cache, descriptor_set_layout, {writedescriptorset}) */
+    {
+    int err, map;
+    uint32_t i, n, index = 0;
+    ud_t *ud;
+    entry_t *e;
+    VkWriteDescriptorSet *w;
+    cache_t *cache = checkcache(L, 1, &ud);
+    VkDescriptorSetLayout layout = checkdescriptor_set_layout(L, 2, NULL);
+    luaL_checktype(L, 3, LUA_TTABLE);
+    lua_settop(L, 3);
+    lua_rawgeti(L, LUA_REGISTRYINDEX, ud->ref1);
+    map = 4;
+    lua_newtable(L); /* refs, at 5 */
+
+    /* parse the contents and build the key */
+    cache->nwrites = cache->nimages = cache->nbuffers = cache->nviews = cache->keylen = 0;
+    if(keyadd(L, cache, &layout, sizeof(layout))) return errmemory(L);
+    n = luaL_len(L, 3);
+    for(i = 0; i < n; i++)
+        {
+        lua_rawgeti(L, 3, i+1);
+        err = checkwrite(L, 6, cache, 5);
+        lua_pop(L, 1);
+        if(err) return argerrorc(L, 3, err);
+        }
+    lua_pushlstring(L, cache->key, cache->keylen); /* 6 */
+
+    lua_pushvalue(L, 6);
+    if(lua_rawget(L, map) == LUA_TNUMBER)
+        { /* hit */
+        e = &cache->entry[lua_tointeger(L, -1)];
+        e->frame = cache->frame;
+        cache->hits++;
+        lua_pushinteger(L, (lua_Integer)(uintptr_t)e->set);
+        return 1;
+        }
+    lua_pop(L, 1);
+
+    /* miss: write the contents in a reused or new set */
+    cache->misses++;
+    getentry(L, ud, cache, layout, &index);
+    e = &cache->entry[index];
+    for(i = 0; i < cache->nwrites; i++)
+        {
+        w = &cache->write[i];
+        w->dstSet = e->set;
+        if(w->pImageInfo) w->pImageInfo = &cache->image[(uintptr_t)w->pImageInfo - 1];
+        else if(w->pBufferInfo) w->pBufferInfo = &cache->buffer[(uintptr_t)w->pBufferInfo - 1];
+        else if(w->pTexelBufferView) w->pTexelBufferView = &cache->view[(uintptr_t)w->pTexelBufferView - 1];
+        }
+    if(cache->nwrites > 0)
+        ud->ddt->UpdateDescriptorSets(ud->device, cache->nwrites, cache->write, 0, NULL);
+    e->used = 1;
+    e->frame = cache->frame;
+    lua_pushvalue(L, 6);
+    lua_pushinteger(L, index);
+    lua_rawset(L, map); /* map[key] = index */
+    lua_pushvalue(L, 6);
+    lua_rawseti(L, map, index); /* map[index] = key */
+    lua_rawgeti(L, LUA_REGISTRYINDEX, ud->ref2);
+    lua_pushvalue(L, 5);
+    lua_rawseti(L, -2, index); /* refs[index] = objects */
+    lua_pop(L, 1);
+    lua_pushinteger(L, (lua_Integer)(uintptr_t)e->set);
+    return 1;
+    }
+
+static int NextFrame(lua_State *L)
+/* n = descriptor_set_cache_next_frame(cache)
+ * Starts a new frame, and evicts the entries not used in the last max_age frames. */
+    {
+    ud_t *ud;
+    uint32_t i, n = 0;
+    entry_t *e;
+    cache_t *cache = checkcache(L, 1, &ud);
+    cache->frame++;
+    lua_rawgeti(L, LUA_REGISTRYINDEX, ud->ref2);
+    lua_rawgeti(L, LUA_REGISTRYINDEX, ud->ref1);
+    for(i = 0; i < cache->nentries; i++)
+        {
+        e = &cache->entry[i];
+        if(!e->used || cache->frame - e->frame < cache->max_age) continue;
+        if(lua_rawgeti(L, -1, i) == LUA_TSTRING)
+            {
+            lua_pushnil(L);
+            lua_rawset(L, -3); /* map[key] = nil */
+            }
+        else
+            lua_pop(L, 1);
+        lua_pushnil(L);
+        lua_rawseti(L, -2, i); /* map[index] = nil */
+        lua_pushnil(L);
+        lua_rawseti(L, -3, i); /* refs[index] = nil */
+        e->used = 0;
+        n++;
+        }
+    cache->evictions += n;
+    lua_pushinteger(L, n);
+    return 1;
+    }
+
+static int Stats(lua_State *L)
+    {
+    uint32_t i, used = 0;
+    cache_t *cache = checkcache(L, 1, NULL);
+    for(i = 0; i < cache->nentries; i++)
+        if(cache->entry[i].used) used++;
+    lua_newtable(L);
+    lua_pushinteger(L, cache->hits); lua_setfield(L, -2, "hits");
+    lua_pushinteger(L, cache->misses); lua_setfield(L, -2, "misses");
+    lua_pushinteger(L, cache->evictions); lua_setfield(L, -2, "evictions");
+    lua_pushinteger(L, cache->allocations); lua_setfield(L, -2, "allocations");
+    lua_pushinteger(L, used); lua_setfield(L, -2, "entries");
+    lua_pushinteger(L, cache->nentries - used); lua_setfield(L, -2, "free");
+    lua_pushinteger(L, cache->frame); lua_setfield(L, -2, "frame");
+    return 1;
+    }
+
+static int Type(lua_State *L)
+    {
+    (void)checkdescriptor_set_cache(L, 1, NULL);
+    lua_pushstring(L, "descriptor_set_cache");
+    return 1;
+    }
+
+static int Instance(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_set_cache(L, 1, &ud);
+    return pushinstance(L, ud->instance);
+    }
+
+static int Device(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_set_cache(L, 1, &ud);
+    return pushdevice(L, ud->device);
+    }
+
+static int Delete(lua_State *L)
+    {
+    ud_t *ud;
+    (void)testdescriptor_set_cache(L, 1, &ud);
+    if(!ud) return 0; /* already deleted */
+    return ud->destructor(L, ud);
+    }
+
+static int Destroy(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_set_cache(L, 1, &ud);
+    return ud->destructor(L, ud);
+    }
+
+static const struct luaL_Reg Methods[] = 
+    {
+        { "type", Type },
+        { "instance", Instance },
+        { "device", Device },
+        { "get", Get },
+        { "next_frame", NextFrame },
+        { "stats", Stats },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg MetaMethods[] = 
+    {
+        { "__gc",  Delete },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg Functions[] = 
+    {
+        { "create_descriptor_set_cache",  Create },
+        { "destroy_descriptor_set_cache",  Destroy },
+        { "descriptor_set_cache_get", Get },
+        { "descriptor_set_cache_next_frame", NextFrame },
+        { "descriptor_set_cache_stats", Stats },
+        { NULL, NULL } /* sentinel */
+    };
+
+void moonvulkan_open_descriptor_set_cache(lua_State *L)
+    {
+    udata_define(L, DESCRIPTOR_SET_CACHE_MT, Methods, MetaMethods);
+    luaL_setfuncs(L, Functions, 0);
+    }
+
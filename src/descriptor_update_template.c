@@ -25,11 +25,82 @@
 
 #include "internal.h"
 
+/* The template's ud->info is a copy of its update entries (entries_t), from which
+ * template writers are created. */
+typedef struct {
+    uint32_t count;
+    VkDescriptorUpdateTemplateEntry *entry;
+    size_t size; /* size of the data block needed to update with the template */
+    int unsupported; /* some entry has a descriptor type not supported by writers */
+} entries_t;
+
+/* A template writer (NONVK) holds the data block for the template it was created
+ * from, and writes the descriptor infos directly in it at the offsets and strides
+ * given by the update entries. The handle is the pointer to the writer_t, which is
+ * also ud->info, and entries and data are allocated in the same block. */
+typedef struct {
+    VkDescriptorUpdateTemplate du_template;
+    uint32_t count;
+    VkDescriptorUpdateTemplateEntry *entry;
+    size_t size;
+    char *data;
+} writer_t;
+
+static size_t elemsize(VkDescriptorType type)
+/* Size of an element in the data block (0 if not supported) */
+    {
+    switch(type)
+        {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: return sizeof(VkDescriptorImageInfo);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: return sizeof(VkBufferView);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: return sizeof(VkDescriptorBufferInfo);
+        case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT: return 1; /* count is in bytes */
+        default: return 0;
+        }
+    }
+
+static entries_t *newentries(lua_State *L, const VkDescriptorUpdateTemplateCreateInfoKHR *info)
+    {
+    uint32_t i;
+    size_t end;
+    VkDescriptorUpdateTemplateEntry *e;
+    entries_t *entries = (entries_t*)MallocNoErr(L, sizeof(entries_t) +
+                info->descriptorUpdateEntryCount*sizeof(VkDescriptorUpdateTemplateEntry));
+    if(!entries) return NULL;
+    entries->count = info->descriptorUpdateEntryCount;
+    entries->entry = (VkDescriptorUpdateTemplateEntry*)(entries + 1);
+    entries->size = 0;
+    entries->unsupported = 0;
+    for(i = 0; i < entries->count; i++)
+        {
+        e = &entries->entry[i];
+        memcpy(e, &info->pDescriptorUpdateEntries[i], sizeof(VkDescriptorUpdateTemplateEntry));
+        if(e->descriptorCount == 0) continue;
+        if(e->descriptorType == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT)
+            end = e->offset + e->descriptorCount;
+        else if(elemsize(e->descriptorType) == 0)
+            { entries->unsupported = 1; continue; } /* size unknown */
+        else
+            end = e->offset + (e->descriptorCount - 1)*e->stride + elemsize(e->descriptorType);
+        if(end > entries->size) entries->size = end;
+        }
+    return entries;
+    }
+
 static int freedescriptor_update_template(lua_State *L, ud_t *ud)
     {
     VkDescriptorUpdateTemplate du_template = (VkDescriptorUpdateTemplate)ud->handle;
     const VkAllocationCallbacks *allocator = ud->allocator;
     VkDevice device = ud->device;
+    freechildren(L, DESCRIPTOR_TEMPLATE_WRITER_MT, ud);
     if(!freeuserdata(L, ud))
         return 0; /* double call */
     TRACE_DELETE(du_template, "descriptor_update_template");
@@ -44,15 +115,19 @@ static int Create(lua_State *L)
     VkResult ec;
     VkDescriptorUpdateTemplate du_template;
     VkDescriptorUpdateTemplateCreateInfoKHR* info;
+    entries_t *entries;
     VkDevice device = checkdevice(L, 1, &device_ud);
     const VkAllocationCallbacks *allocator = optallocator(L, 3);
     CheckDevicePfn(L, device_ud, CreateDescriptorUpdateTemplate);
 #define CLEANUP zfreeVkDescriptorUpdateTemplateCreateInfoKHR(L, info, 1)
     info = zcheckVkDescriptorUpdateTemplateCreateInfoKHR(L, 2, &err);
     if(err) { CLEANUP; return argerror(L, 2); }
+    entries = newentries(L, info);
+    if(!entries) { CLEANUP; return errmemory(L); }
     ec = device_ud->ddt->CreateDescriptorUpdateTemplate(device, info, allocator, &du_template);
     CLEANUP;
 #undef CLEANUP
+    if(ec) Free(L, entries);
     CheckError(L, ec);
     TRACE_CREATE(du_template, "descriptor_update_template");
     ud = newuserdata_nondispatchable(L, du_template, DESCRIPTOR_UPDATE_TEMPLATE_MT);
@@ -62,6 +137,7 @@ static int Create(lua_State *L)
     ud->allocator = allocator;
     ud->destructor = freedescriptor_update_template;
     ud->ddt = device_ud->ddt;
+    ud->info = entries;
     return 1;
     }
 
@@ -81,6 +157,202 @@ static int UpdateDescriptorSetWithTemplate(lua_State *L)
     return 0;
     }
 
+/*------------------------------------------------------------------------------*
+ | Template writers (NONVK)                                                     |
+ *------------------------------------------------------------------------------*/
+
+static int freewriter(lua_State *L, ud_t *ud)
+    {
+    uint64_t handle = ud->handle;
+    if(!freeuserdata(L, ud)) /* this also frees the writer_t */
+        return 0; /* double call */
+    TRACE_DELETE(handle, "descriptor_template_writer");
+    return 0;
+    }
+
+static int CreateWriter(lua_State *L)
+    {
+    ud_t *ud, *template_ud;
+    writer_t *writer;
+    entries_t *entries;
+    VkDescriptorUpdateTemplate du_template = checkdescriptor_update_template(L, 1, &template_ud);
+    entries = (entries_t*)template_ud->info;
+    /* the data block would be too small for the entries of unknown size */
+    if(entries->unsupported) return argerrorc(L, 1, ERR_VALUE);
+    writer = (writer_t*)MallocNoErr(L, sizeof(writer_t) +
+                entries->count*sizeof(VkDescriptorUpdateTemplateEntry) + entries->size);
+    if(!writer) return errmemory(L);
+    writer->du_template = du_template;
+    writer->count = entries->count;
+    writer->entry = (VkDescriptorUpdateTemplateEntry*)(writer + 1);
+    memcpy(writer->entry, entries->entry, entries->count*sizeof(VkDescriptorUpdateTemplateEntry));
+    writer->size = entries->size;
+    writer->data = (char*)(writer->entry + writer->count);
+    memset(writer->data, 0, writer->size);
+    TRACE_CREATE(writer, "descriptor_template_writer");
+    ud = newuserdata_nondispatchable(L, (uintptr_t)writer, DESCRIPTOR_TEMPLATE_WRITER_MT);
+    ud->parent_ud = template_ud;
+    ud->device = template_ud->device;
+    ud->instance = template_ud->instance;
+    ud->destructor = freewriter;
+    ud->ddt = template_ud->ddt;
+    ud->info = writer;
+    return 1;
+    }
+
+static int writeelem(lua_State *L, int arg, VkDescriptorType type, char *dst)
+/* Writes the descriptor info at arg in dst, returns an ERR_XXX code */
+    {
+    switch(type)
+        {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            return descriptorimageinfo(L, arg, (VkDescriptorImageInfo*)dst);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            *(VkBufferView*)dst = testbuffer_view(L, arg, NULL);
+            return 0;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            return descriptorbufferinfo(L, arg, (VkDescriptorBufferInfo*)dst);
+        default:
+            return ERR_VALUE;
+        }
+    }
+
+static int WriterSet(lua_State *L)
+/* descriptor_template_writer_set(writer, entry, value|{value}, [arrayelement])
+ * entry is the position of the entry in the descriptor_update_entries of the template
+ * (1-based), and arrayelement is relative to the entry's dst_array_element (or, for
+ * inline uniform blocks, the byte offset in the block). */
+    {
+    int err;
+    ud_t *ud;
+    writer_t *writer;
+    VkDescriptorUpdateTemplateEntry *e;
+    uint32_t i, n, first;
+    size_t len;
+    const char *s;
+    (void)checkdescriptor_template_writer(L, 1, &ud);
+    writer = (writer_t*)ud->info;
+    i = luaL_checkinteger(L, 2);
+    if(i < 1 || i > writer->count) return argerrorc(L, 2, ERR_VALUE);
+    e = &writer->entry[i-1];
+    first = luaL_optinteger(L, 4, 0);
+    if(first >= e->descriptorCount) return argerrorc(L, 4, ERR_VALUE);
+    if(e->descriptorType == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT)
+        {
+        s = luaL_checklstring(L, 3, &len);
+        if(len > e->descriptorCount - first) return argerrorc(L, 3, ERR_LENGTH);
+        memcpy(writer->data + e->offset + first, s, len);
+        return 0;
+        }
+    if(elemsize(e->descriptorType) == 0) return argerrorc(L, 2, ERR_VALUE);
+    if(lua_istable(L, 3) && lua_rawgeti(L, 3, 1) != LUA_TNIL)
+        { /* list of values for consecutive array elements */
+        lua_pop(L, 1);
+        n = luaL_len(L, 3);
+        if(n > e->descriptorCount - first) return argerrorc(L, 3, ERR_LENGTH);
+        for(i = 0; i < n; i++)
+            {
+            lua_rawgeti(L, 3, i+1);
+            err = writeelem(L, lua_gettop(L), e->descriptorType, writer->data + e->offset + (first+i)*e->stride);
+            lua_pop(L, 1);
+            if(err) return argerrorc(L, 3, err);
+            }
+        return 0;
+        }
+    lua_settop(L, 3);
+    err = writeelem(L, 3, e->descriptorType, writer->data + e->offset + first*e->stride);
+    if(err) return argerrorc(L, 3, err);
+    return 0;
+    }
+
+static int WriterClear(lua_State *L)
+    {
+    ud_t *ud;
+    writer_t *writer;
+    (void)checkdescriptor_template_writer(L, 1, &ud);
+    writer = (writer_t*)ud->info;
+    memset(writer->data, 0, writer->size);
+    return 0;
+    }
+
+static int WriterUpdate(lua_State *L)
+/* descriptor_template_writer_update(writer, descriptor_set) */
+    {
+    ud_t *ud;
+    writer_t *writer;
+    VkDescriptorSet descriptor_set;
+    (void)checkdescriptor_template_writer(L, 1, &ud);
+    descriptor_set = checkdescriptor_sethandle(L, 2);
+    writer = (writer_t*)ud->info;
+    CheckDevicePfn(L, ud, UpdateDescriptorSetWithTemplate);
+    ud->ddt->UpdateDescriptorSetWithTemplate(ud->device, descriptor_set, writer->du_template, writer->data);
+    return 0;
+    }
+
+static int WriterData(lua_State *L)
+/* Returns the data block as a binary string (e.g. to be used with push descriptors) */
+    {
+    ud_t *ud;
+    writer_t *writer;
+    (void)checkdescriptor_template_writer(L, 1, &ud);
+    writer = (writer_t*)ud->info;
+    lua_pushlstring(L, writer->data, writer->size);
+    return 1;
+    }
+
+static int WriterType(lua_State *L)
+    {
+    (void)checkdescriptor_template_writer(L, 1, NULL);
+    lua_pushstring(L, "descriptor_template_writer");
+    return 1;
+    }
+
+static int WriterInstance(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_template_writer(L, 1, &ud);
+    return pushinstance(L, ud->instance);
+    }
+
+static int WriterDevice(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_template_writer(L, 1, &ud);
+    return pushdevice(L, ud->device);
+    }
+
+static int WriterParent(lua_State *L)
+    {
+    ud_t *ud;
+    writer_t *writer;
+    (void)checkdescriptor_template_writer(L, 1, &ud);
+    writer = (writer_t*)ud->info;
+    return pushdescriptor_update_template(L, writer->du_template);
+    }
+
+static int WriterDelete(lua_State *L)
+    {
+    ud_t *ud;
+    (void)testdescriptor_template_writer(L, 1, &ud);
+    if(!ud) return 0; /* already deleted */
+    return ud->destructor(L, ud);
+    }
+
+static int WriterDestroy(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdescriptor_template_writer(L, 1, &ud);
+    return ud->destructor(L, ud);
+    }
+
 /*------------------------------------------------------------------------------*
  | Methods                                                                      |
  *------------------------------------------------------------------------------*/
@@ -113,11 +385,36 @@ static const struct luaL_Reg MetaMethods[] =
         { NULL, NULL } /* sentinel */
     };
 
+static const struct luaL_Reg WriterMethods[] = 
+    {
+        { "type", WriterType },
+        { "instance", WriterInstance },
+        { "device", WriterDevice },
+        { "parent", WriterParent },
+        { "set", WriterSet },
+        { "clear", WriterClear },
+        { "update", WriterUpdate },
+        { "data", WriterData },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg WriterMetaMethods[] = 
+    {
+        { "__gc",  WriterDelete },
+        { NULL, NULL } /* sentinel */
+    };
+
 static const struct luaL_Reg Functions[] = 
     {
         { "create_descriptor_update_template",  Create },
         { "destroy_descriptor_update_template",  Destroy },
         { "update_descriptor_set_with_template", UpdateDescriptorSetWithTemplate },
+        { "create_descriptor_template_writer",  CreateWriter },
+        { "destroy_descriptor_template_writer",  WriterDestroy },
+        { "descriptor_template_writer_set", WriterSet },
+        { "descriptor_template_writer_clear", WriterClear },
+        { "descriptor_template_writer_update", WriterUpdate },
+        { "descriptor_template_writer_data", WriterData },
         { NULL, NULL } /* sentinel */
     };
 
@@ -125,6 +422,7 @@ static const struct luaL_Reg Functions[] =
 void moonvulkan_open_descriptor_update_template(lua_State *L)
     {
     udata_define(L, DESCRIPTOR_UPDATE_TEMPLATE_MT, Methods, MetaMethods);
+    udata_define(L, DESCRIPTOR_TEMPLATE_WRITER_MT, WriterMethods, WriterMetaMethods);
     luaL_setfuncs(L, Functions, 0);
     }
 
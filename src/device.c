@@ -36,12 +36,18 @@ static int freedevice(lua_State *L, ud_t *ud)
         DeviceWaitIdle = ud->ddt->DeviceWaitIdle;
         DestroyDevice = ud->ddt->DestroyDevice;
         }
+    freechildren(L, PIPELINE_FUTURE_MT, ud);
+    freechildren(L, DESCRIPTOR_WRITER_MT, ud);
+    freechildren(L, DESCRIPTOR_ALLOCATOR_MT, ud);
+    freechildren(L, STAGING_RING_MT, ud);
+    freechildren(L, BARRIER_SET_MT, ud);
     freechildren(L, SAMPLER_YCBCR_CONVERSION_MT, ud);
     freechildren(L, VALIDATION_CACHE_MT, ud);
     freechildren(L, DESCRIPTOR_UPDATE_TEMPLATE_MT, ud);
     freechildren(L, SWAPCHAIN_MT, ud);
     freechildren(L, COMMAND_POOL_MT, ud);
     freechildren(L, PIPELINE_CACHE_MT, ud);
+    freechildren(L, SHADER_MT, ud);
     freechildren(L, PIPELINE_MT, ud);
     freechildren(L, SAMPLER_MT, ud);
     freechildren(L, SEMAPHORE_MT, ud);
@@ -59,6 +65,16 @@ static int freedevice(lua_State *L, ud_t *ud)
     freechildren(L, QUERY_POOL_MT, ud);
     freechildren(L, QUEUE_MT, ud);
     if(ud->ddt) Free(L, ud->ddt);
+    if(ud->info)
+        {
+        Unreference(L, DEVINFO(ud)->pipeline_map);
+        Unreference(L, DEVINFO(ud)->shader_map);
+        Unreference(L, DEVINFO(ud)->link_map);
+        Unreference(L, DEVINFO(ud)->sampler_map);
+        Unreference(L, DEVINFO(ud)->render_pass_map);
+        Unreference(L, DEVINFO(ud)->framebuffer_map);
+        if(DEVINFO(ud)->descriptor_buffer) Free(L, DEVINFO(ud)->descriptor_buffer);
+        }
     if(!freeuserdata(L, ud))
         return 0; /* double call */
     TRACE_DELETE(device, "device");
@@ -67,6 +83,20 @@ static int freedevice(lua_State *L, ud_t *ud)
     return 0;
     }
 
+static int robustbufferaccess(const VkDeviceCreateInfo *info)
+/* Checks if the robustBufferAccess feature is enabled (it affects the descriptor sizes) */
+    {
+    const VkBaseInStructure *p = (const VkBaseInStructure*)info->pNext;
+    if(info->pEnabledFeatures) return info->pEnabledFeatures->robustBufferAccess;
+    while(p)
+        {
+        if(p->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2)
+            return ((const VkPhysicalDeviceFeatures2*)p)->features.robustBufferAccess;
+        p = p->pNext;
+        }
+    return 0;
+    }
+
 static int Create(lua_State *L)
     {
     int err;
@@ -74,6 +104,8 @@ static int Create(lua_State *L)
     VkResult ec;
     VkDevice device;
     VkDeviceCreateInfo* info;
+    uint32_t i;
+    devinfo_t *devinfo;
     VkPhysicalDevice physical_device = checkphysical_device(L, 1, &physdev_ud);
     const VkAllocationCallbacks *allocator = optallocator(L, 3);
 #define CLEANUP zfreeVkDeviceCreateInfo(L, info, 1)
@@ -85,9 +117,32 @@ static int Create(lua_State *L)
     ud = newuserdata_dispatchable(L, device, DEVICE_MT);
     ud->parent_ud = UD(physical_device)->parent_ud; /* instance ud */
     ud->instance = UD(physical_device)->instance;
+    ud->device = device;
     ud->allocator = allocator;
     ud->destructor = freedevice;
+    ud->idt = physdev_ud->idt;
     ud->ddt = getproc_device(L, device, info);
+    devinfo = (devinfo_t*)Malloc(L, sizeof(devinfo_t));
+    devinfo->physical_device = physical_device;
+    devinfo->pipeline_map = LUA_NOREF;
+    devinfo->shader_map = LUA_NOREF;
+    devinfo->link_map = LUA_NOREF;
+    devinfo->sampler_map = LUA_NOREF;
+    devinfo->render_pass_map = LUA_NOREF;
+    devinfo->framebuffer_map = LUA_NOREF;
+    physdev_ud->idt->GetPhysicalDeviceProperties(physical_device, &devinfo->properties);
+    physdev_ud->idt->GetPhysicalDeviceMemoryProperties(physical_device, &devinfo->memory_properties);
+    for(i = 0; i < info->enabledExtensionCount; i++)
+        {
+        if(strcmp(info->ppEnabledExtensionNames[i], VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) == 0)
+            devinfo->memory_budget = 1;
+        else if(strcmp(info->ppEnabledExtensionNames[i], VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME) == 0)
+            devinfo->creation_feedback = 1;
+        }
+    if(devinfo->properties.apiVersion >= VK_MAKE_API_VERSION(0, 1, 3, 0))
+        devinfo->creation_feedback = 1; /* promoted to core in Vulkan 1.3 */
+    devinfo->robust_buffer_access = robustbufferaccess(info);
+    ud->info = devinfo;
     CLEANUP;
 #undef CLEANUP
     return 1;
@@ -25,19 +25,193 @@
 
 #include "internal.h"
 
+#define MAX_DIRTY_RANGES 16
+
+typedef struct {
+    VkDeviceSize offset;
+    VkDeviceSize end;
+} range_t;
+
 typedef struct {
     char *memp;    /* start of mapped area (=NULL if not mapped) */
     size_t memsz;  /* size of mapped area (=0 if not mapped) */
     size_t maxsz; /* max size (allocationSize) */
+    VkDeviceSize mapoffset; /* offset of the mapped area */
+    uint32_t memory_type_index;
+    int coherent; /* the memory type is host coherent */
+    uint32_t ndirty; /* number of dirty ranges (used only if not coherent) */
+    range_t dirty[MAX_DIRTY_RANGES]; /* dirty ranges of the mapped area (offsets are absolute) */
 } ud_info_t;
 
+/*------------------------------------------------------------------------------*
+ | Dirty ranges tracking (NONVK)                                                |
+ *------------------------------------------------------------------------------*/
+
+static int cmprange(const void *p1, const void *p2)
+    {
+    const range_t *r1 = (const range_t*)p1;
+    const range_t *r2 = (const range_t*)p2;
+    return r1->offset < r2->offset ? -1 : (r1->offset > r2->offset ? 1 : 0);
+    }
+
+static uint32_t mergeranges(range_t *r, uint32_t n)
+/* sorts the ranges and merges those that overlap or are adjacent, returns the new count */
+    {
+    uint32_t i, j = 0;
+    if(n < 2) return n;
+    qsort(r, n, sizeof(range_t), cmprange);
+    for(i = 1; i < n; i++)
+        {
+        if(r[i].offset <= r[j].end)
+            { if(r[i].end > r[j].end) r[j].end = r[i].end; }
+        else
+            r[++j] = r[i];
+        }
+    return j + 1;
+    }
+
+static void markdirty(ud_info_t *ud_info, VkDeviceSize offset, VkDeviceSize size)
+/* marks a range of the mapped area as dirty (offset is relative to the mapped area) */
+    {
+    range_t *last;
+    VkDeviceSize start, end;
+    if(ud_info->coherent || size == 0) return;
+    start = ud_info->mapoffset + offset;
+    end = start + size;
+    if(ud_info->ndirty > 0)
+        {
+        /* the common case of sequential writes extends the last range */
+        last = &ud_info->dirty[ud_info->ndirty - 1];
+        if(start <= last->end && end >= last->offset)
+            {
+            if(start < last->offset) last->offset = start;
+            if(end > last->end) last->end = end;
+            return;
+            }
+        }
+    if(ud_info->ndirty == MAX_DIRTY_RANGES)
+        {
+        ud_info->ndirty = mergeranges(ud_info->dirty, ud_info->ndirty);
+        if(ud_info->ndirty == MAX_DIRTY_RANGES)
+            { /* still full: collapse them in a single range */
+            ud_info->dirty[0].end = ud_info->dirty[MAX_DIRTY_RANGES - 1].end;
+            ud_info->ndirty = 1;
+            }
+        }
+    ud_info->dirty[ud_info->ndirty].offset = start;
+    ud_info->dirty[ud_info->ndirty].end = end;
+    ud_info->ndirty++;
+    }
+
+static uint32_t alignranges(ud_t *ud, range_t *r, uint32_t n)
+/* Aligns the ranges of the mapped area to nonCoherentAtomSize, and merges them.
+ * Returns the new count. */
+    {
+    uint32_t i;
+    ud_info_t *ud_info = (ud_info_t*)ud->info;
+    VkDeviceSize atom = DEVINFO(UD(ud->device))->properties.limits.nonCoherentAtomSize;
+    VkDeviceSize mapend = ud_info->mapoffset + ud_info->memsz;
+    if(atom == 0) atom = 1;
+    for(i = 0; i < n; i++)
+        {
+        r[i].offset -= r[i].offset % atom;
+        if(r[i].offset < ud_info->mapoffset) r[i].offset = ud_info->mapoffset;
+        r[i].end = ((r[i].end + atom - 1) / atom) * atom;
+        if(r[i].end > mapend) r[i].end = mapend;
+        }
+    return mergeranges(r, n);
+    }
+
+static uint32_t pushranges(ud_t *ud, range_t *r, uint32_t n, VkMappedMemoryRange *ranges)
+/* Converts the aligned ranges to VkMappedMemoryRange.
+ * Ranges that extend to the end of the mapped area are converted to VK_WHOLE_SIZE
+ * ranges, so that a non-aligned end of mapping is not a concern.
+ */
+    {
+    uint32_t i;
+    ud_info_t *ud_info = (ud_info_t*)ud->info;
+    VkDeviceSize mapend = ud_info->mapoffset + ud_info->memsz;
+    for(i = 0; i < n; i++)
+        {
+        memset(&ranges[i], 0, sizeof(VkMappedMemoryRange));
+        ranges[i].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        ranges[i].memory = (VkDeviceMemory)ud->handle;
+        ranges[i].offset = r[i].offset;
+        ranges[i].size = (r[i].end == mapend) ? VK_WHOLE_SIZE : r[i].end - r[i].offset;
+        }
+    return n;
+    }
+
+static VkResult flushdirty(ud_t *ud, uint32_t *count)
+/* flushes the dirty ranges of a single memory */
+    {
+    VkResult ec;
+    uint32_t n;
+    ud_info_t *ud_info = (ud_info_t*)ud->info;
+    VkMappedMemoryRange ranges[MAX_DIRTY_RANGES];
+    *count = 0;
+    if(ud_info->ndirty == 0) return VK_SUCCESS;
+    n = alignranges(ud, ud_info->dirty, ud_info->ndirty);
+    n = pushranges(ud, ud_info->dirty, n, ranges);
+    ec = ud->ddt->FlushMappedMemoryRanges(ud->device, n, ranges);
+    if(ec) { ud_info->ndirty = n; return ec; }
+    ud_info->ndirty = 0;
+    *count = n;
+    return VK_SUCCESS;
+    }
+
+/*------------------------------------------------------------------------------*
+ | Memory usage accounting (NONVK)                                              |
+ *------------------------------------------------------------------------------*/
+
+static void counteradd(memcounter_t *counter, VkDeviceSize bytes)
+    {
+    counter->bytes += bytes;
+    counter->count++;
+    if(counter->bytes > counter->peak) counter->peak = counter->bytes;
+    }
+
+static void countersub(memcounter_t *counter, VkDeviceSize bytes)
+    {
+    counter->bytes -= bytes;
+    counter->count--;
+    }
+
+static void countallocation(ud_t *device_ud, ud_info_t *ud_info, int allocated)
+    {
+    devinfo_t *devinfo = DEVINFO(device_ud);
+    uint32_t type = ud_info->memory_type_index;
+    uint32_t heap;
+    if(type >= devinfo->memory_properties.memoryTypeCount) return;
+    heap = devinfo->memory_properties.memoryTypes[type].heapIndex;
+    if(allocated)
+        {
+        counteradd(&devinfo->type_usage[type], ud_info->maxsz);
+        counteradd(&devinfo->heap_usage[heap], ud_info->maxsz);
+        }
+    else
+        {
+        countersub(&devinfo->type_usage[type], ud_info->maxsz);
+        countersub(&devinfo->heap_usage[heap], ud_info->maxsz);
+        }
+    }
+
+/*------------------------------------------------------------------------------*/
 
 static int freedevice_memory(lua_State *L, ud_t *ud)
     {
     VkDeviceMemory device_memory = (VkDeviceMemory)ud->handle;
     VkDevice device = ud->device;
     const VkAllocationCallbacks *allocator = ud->allocator;
+    ud_info_t *ud_info = (ud_info_t*)ud->info;
 
+    freechildren(L, DRAW_WRITER_MT, ud);
+    if(IsValid(ud))
+        {
+        countallocation(ud->parent_ud, ud_info, 0);
+        if(ud_info->memp) /* freeing the memory implicitly unmaps it */
+            countersub(&DEVINFO(ud->parent_ud)->mapped, ud_info->memsz);
+        }
     if(!freeuserdata(L, ud))
         return 0; /* double call */
     TRACE_DELETE(device_memory, "device_memory");
@@ -89,6 +263,11 @@ static int Allocate(lua_State *L)
     ud->ddt = device_ud->ddt;
     ud->info = ud_info;
     ud_info->maxsz = info->allocationSize;
+    ud_info->memory_type_index = info->memoryTypeIndex;
+    if(info->memoryTypeIndex < DEVINFO(device_ud)->memory_properties.memoryTypeCount)
+        ud_info->coherent = (DEVINFO(device_ud)->memory_properties.memoryTypes[info->memoryTypeIndex].propertyFlags 
+                                & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+    countallocation(device_ud, ud_info, 1);
     CLEANUP;
 #undef CLEANUP
     return 1;
@@ -128,12 +307,17 @@ static int MapMemory(lua_State *L)
     CheckError(L, ec);
     ud_info->memp = (char*)data;
     ud_info->memsz = (size == VK_WHOLE_SIZE) ? ud_info->maxsz - offset : size;
+    ud_info->mapoffset = offset;
+    ud_info->ndirty = 0;
+    counteradd(&DEVINFO(ud->parent_ud)->mapped, ud_info->memsz);
     lua_pushlightuserdata(L, data);
     return 1;
     }
 
 static int UnmapMemory(lua_State *L)
     {
+    VkResult ec;
+    uint32_t count;
     ud_t *ud;
     VkDeviceMemory memory = checkdevice_memory(L, 1, &ud);
     ud_info_t *ud_info = (ud_info_t*)ud->info;
@@ -142,7 +326,10 @@ static int UnmapMemory(lua_State *L)
     if(ud_info->memp == NULL)
         return luaL_error(L, "memory is not mapped");
 
+    ec = flushdirty(ud, &count); /* don't lose pending writes */
+    CheckError(L, ec);
     ud->ddt->UnmapMemory(device, memory);
+    countersub(&DEVINFO(ud->parent_ud)->mapped, ud_info->memsz);
     ud_info->memp = NULL;
     ud_info->memsz = 0;
     return 0;
@@ -166,6 +353,7 @@ static int Write(lua_State *L) /* NONVK */
     if(size > (ud_info->memsz - offset))
         return argerrorc(L, 3, ERR_LENGTH);
     memcpy(ud_info->memp + offset, data, size);
+    markdirty(ud_info, offset, size);
     return 0;
     }
 
@@ -191,6 +379,274 @@ static int Read(lua_State *L) /* NONVK */
     return 1;
     }
 
+static int UploadFile(lua_State *L) /* NONVK */
+    {
+    int ec;
+    ud_t *ud;
+    ud_info_t *ud_info;
+    uint64_t fsize;
+    VkDeviceSize size;
+    double t;
+    const char *path = luaL_checkstring(L, 1);
+    VkDeviceSize offset = luaL_checkinteger(L, 3);
+    uint64_t file_offset = luaL_optinteger(L, 4, 0);
+    unsigned nthreads = luaL_optinteger(L, 6, 1);
+
+    (void)checkdevice_memory(L, 2, &ud);
+    ud_info = (ud_info_t*)ud->info;
+    if(!ud_info->memp)
+        return luaL_error(L, "memory is not mapped");
+    ec = filesize(path, &fsize);
+    if(ec) return luaL_error(L, "%s: %s", path, strerror(ec));
+    if(file_offset > fsize)
+        return argerrorc(L, 4, ERR_VALUE);
+    size = lua_isnoneornil(L, 5) ? fsize - file_offset : (VkDeviceSize)luaL_checkinteger(L, 5);
+    if(size > fsize - file_offset)
+        return argerrorc(L, 5, ERR_LENGTH);
+    /* boundary checks */
+    if(offset > ud_info->memsz || size > (ud_info->memsz - offset))
+        return argerrorc(L, 5, ERR_LENGTH);
+    t = now();
+    ec = readfile(path, file_offset, ud_info->memp + offset, size, nthreads);
+    t = since(t);
+    if(ec) return luaL_error(L, "%s: %s", path, strerror(ec));
+    markdirty(ud_info, offset, size);
+    lua_pushinteger(L, size);
+    lua_pushnumber(L, t);
+    return 2;
+    }
+
+static int MarkDirty(lua_State *L) /* NONVK */
+    {
+    ud_t *ud;
+    ud_info_t *ud_info;
+    VkDeviceSize offset, size;
+    (void)checkdevice_memory(L, 1, &ud);
+    ud_info = (ud_info_t*)ud->info;
+    offset = luaL_checkinteger(L, 2);
+    size = checksizeorwholesize(L, 3);
+    if(!ud_info->memp)
+        return luaL_error(L, "memory is not mapped");
+    /* boundary checks */
+    if(offset > ud_info->memsz)
+        return argerrorc(L, 2, ERR_VALUE);
+    if(size == VK_WHOLE_SIZE)
+        size = ud_info->memsz - offset;
+    else if(size > (ud_info->memsz - offset))
+        return argerrorc(L, 3, ERR_LENGTH);
+    markdirty(ud_info, offset, size);
+    return 0;
+    }
+
+char *mappedrange(ud_t *ud, VkDeviceSize offset, VkDeviceSize size)
+/* Returns a pointer to the given range of the mapped area (offset is relative to the
+ * mapped area) and marks it as dirty, or NULL if the memory is not mapped or the range
+ * does not fit in the mapped area. For C code that writes directly to the memory. */
+    {
+    ud_info_t *ud_info = (ud_info_t*)ud->info;
+    if(!ud_info->memp) return NULL;
+    if(offset > ud_info->memsz || size > (ud_info->memsz - offset)) return NULL;
+    markdirty(ud_info, offset, size);
+    return ud_info->memp + offset;
+    }
+
+VkDeviceSize memorysize(ud_t *ud)
+/* Returns the allocation size of the memory */
+    {
+    return ((ud_info_t*)ud->info)->maxsz;
+    }
+
+typedef struct {
+    ud_t *device_ud;
+    VkMappedMemoryRange *ranges; /* NULL when counting */
+    uint32_t count;
+} dirtyscan_t;
+
+static int scandirty(lua_State *L, const void *mem, const char *mt, const void *info)
+/* udata_scan callback: counts or collects the dirty ranges of a device's memories */
+    {
+    ud_t *ud = (ud_t*)mem;
+    ud_info_t *ud_info = (ud_info_t*)ud->info;
+    dirtyscan_t *scan = (dirtyscan_t*)info;
+    (void)L; (void)mt;
+    if(!IsValid(ud) || ud->parent_ud != scan->device_ud) return 0;
+    if(!ud_info->memp || ud_info->ndirty == 0) return 0;
+    if(!scan->ranges)
+        scan->count += ud_info->ndirty;
+    else
+        {
+        ud_info->ndirty = alignranges(ud, ud_info->dirty, ud_info->ndirty);
+        scan->count += pushranges(ud, ud_info->dirty, ud_info->ndirty, scan->ranges + scan->count);
+        }
+    return 0;
+    }
+
+static int cleardirty(lua_State *L, const void *mem, const char *mt, const void *info)
+    {
+    ud_t *ud = (ud_t*)mem;
+    (void)L; (void)mt;
+    if(IsValid(ud) && ud->parent_ud == (ud_t*)info)
+        ((ud_info_t*)ud->info)->ndirty = 0;
+    return 0;
+    }
+
+static int FlushDirty(lua_State *L) /* NONVK */
+    {
+    ud_t *ud;
+    VkResult ec;
+    VkDevice device;
+    dirtyscan_t scan;
+    if(testdevice_memory(L, 1, &ud))
+        {
+        ec = flushdirty(ud, &scan.count);
+        CheckError(L, ec);
+        lua_pushinteger(L, scan.count);
+        return 1;
+        }
+    device = checkdevice(L, 1, &ud);
+    /* first count the ranges, then collect them (merged and aligned) */
+    scan.device_ud = ud;
+    scan.ranges = NULL;
+    scan.count = 0;
+    udata_scan(L, DEVICE_MEMORY_MT, &scan, scandirty);
+    if(scan.count == 0)
+        { lua_pushinteger(L, 0); return 1; }
+    scan.ranges = (VkMappedMemoryRange*)Malloc(L, scan.count * sizeof(VkMappedMemoryRange));
+    scan.count = 0;
+    udata_scan(L, DEVICE_MEMORY_MT, &scan, scandirty);
+    ec = ud->ddt->FlushMappedMemoryRanges(device, scan.count, scan.ranges);
+    Free(L, scan.ranges);
+    CheckError(L, ec);
+    udata_scan(L, DEVICE_MEMORY_MT, ud, cleardirty);
+    lua_pushinteger(L, scan.count);
+    return 1;
+    }
+
+static VkResult flushoverlapping(ud_t *ud, const range_t *r)
+/* Flushes the dirty ranges that overlap the aligned range r, and removes them from
+ * the dirty list, so that invalidating r does not discard pending host writes
+ * (invalidation rounds the range outwards, so it may cover writes outside it). */
+    {
+    VkResult ec;
+    uint32_t i, j, n, k = 0;
+    ud_info_t *ud_info = (ud_info_t*)ud->info;
+    range_t flush[MAX_DIRTY_RANGES];
+    VkMappedMemoryRange ranges[MAX_DIRTY_RANGES];
+    if(ud_info->ndirty == 0) return VK_SUCCESS;
+    n = ud_info->ndirty = alignranges(ud, ud_info->dirty, ud_info->ndirty);
+    for(i = 0; i < n; i++)
+        if(ud_info->dirty[i].offset < r->end && ud_info->dirty[i].end > r->offset)
+            flush[k++] = ud_info->dirty[i];
+    if(k == 0) return VK_SUCCESS;
+    (void)pushranges(ud, flush, k, ranges);
+    ec = ud->ddt->FlushMappedMemoryRanges(ud->device, k, ranges);
+    if(ec) return ec; /* the dirty list is left unchanged */
+    for(i = j = 0; i < n; i++)
+        if(!(ud_info->dirty[i].offset < r->end && ud_info->dirty[i].end > r->offset))
+            ud_info->dirty[j++] = ud_info->dirty[i];
+    ud_info->ndirty = j;
+    return VK_SUCCESS;
+    }
+
+static int InvalidateMemory(lua_State *L) /* NONVK */
+    {
+    ud_t *ud;
+    VkResult ec;
+    ud_info_t *ud_info;
+    range_t r;
+    VkMappedMemoryRange range;
+    VkDeviceSize offset, size;
+    (void)checkdevice_memory(L, 1, &ud);
+    ud_info = (ud_info_t*)ud->info;
+    offset = luaL_optinteger(L, 2, 0);
+    size = lua_isnoneornil(L, 3) ? VK_WHOLE_SIZE : checksizeorwholesize(L, 3);
+    if(!ud_info->memp)
+        return luaL_error(L, "memory is not mapped");
+    /* boundary checks */
+    if(offset > ud_info->memsz)
+        return argerrorc(L, 2, ERR_VALUE);
+    if(size == VK_WHOLE_SIZE)
+        size = ud_info->memsz - offset;
+    else if(size > (ud_info->memsz - offset))
+        return argerrorc(L, 3, ERR_LENGTH);
+    if(ud_info->coherent || size == 0) return 0;
+    r.offset = ud_info->mapoffset + offset;
+    r.end = r.offset + size;
+    (void)alignranges(ud, &r, 1);
+    ec = flushoverlapping(ud, &r);
+    CheckError(L, ec);
+    (void)pushranges(ud, &r, 1, &range);
+    ec = ud->ddt->InvalidateMappedMemoryRanges(ud->device, 1, &range);
+    CheckError(L, ec);
+    return 0;
+    }
+
+static void pushcounter(lua_State *L, memcounter_t *counter)
+/* sets the counter's fields in the table at the top of the stack */
+    {
+    lua_pushinteger(L, counter->bytes); lua_setfield(L, -2, "bytes");
+    lua_pushinteger(L, counter->count); lua_setfield(L, -2, "count");
+    lua_pushinteger(L, counter->peak); lua_setfield(L, -2, "peak");
+    }
+
+static int GetMemoryStats(lua_State *L) /* NONVK */
+    {
+    ud_t *ud;
+    uint32_t i, count = 0;
+    int hasbudget = 0;
+    devinfo_t *devinfo;
+    VkPhysicalDeviceMemoryProperties *props;
+    VkPhysicalDeviceMemoryProperties2 props2;
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budget;
+    (void)checkdevice(L, 1, &ud);
+    devinfo = DEVINFO(ud);
+    props = &devinfo->memory_properties;
+    if(devinfo->memory_budget && ud->idt->GetPhysicalDeviceMemoryProperties2)
+        {
+        memset(&props2, 0, sizeof(props2));
+        memset(&budget, 0, sizeof(budget));
+        props2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+        props2.pNext = &budget;
+        budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+        ud->idt->GetPhysicalDeviceMemoryProperties2(devinfo->physical_device, &props2);
+        hasbudget = 1;
+        }
+    lua_newtable(L);
+    lua_newtable(L);
+    for(i = 0; i < props->memoryTypeCount; i++)
+        {
+        lua_newtable(L);
+        lua_pushinteger(L, i); lua_setfield(L, -2, "memory_type_index");
+        lua_pushinteger(L, props->memoryTypes[i].heapIndex); lua_setfield(L, -2, "heap_index");
+        pushcounter(L, &devinfo->type_usage[i]);
+        lua_rawseti(L, -2, i+1);
+        count += devinfo->type_usage[i].count;
+        }
+    lua_setfield(L, -2, "memory_types");
+    lua_newtable(L);
+    for(i = 0; i < props->memoryHeapCount; i++)
+        {
+        lua_newtable(L);
+        lua_pushinteger(L, i); lua_setfield(L, -2, "memory_heap_index");
+        lua_pushinteger(L, props->memoryHeaps[i].size); lua_setfield(L, -2, "size");
+        pushcounter(L, &devinfo->heap_usage[i]);
+        if(hasbudget)
+            {
+            lua_pushinteger(L, budget.heapBudget[i]); lua_setfield(L, -2, "budget");
+            lua_pushinteger(L, budget.heapUsage[i]); lua_setfield(L, -2, "usage");
+            }
+        lua_rawseti(L, -2, i+1);
+        }
+    lua_setfield(L, -2, "memory_heaps");
+    lua_pushinteger(L, count); lua_setfield(L, -2, "allocation_count");
+    lua_pushinteger(L, devinfo->properties.limits.maxMemoryAllocationCount);
+    lua_setfield(L, -2, "max_allocation_count");
+    lua_pushinteger(L, devinfo->mapped.bytes); lua_setfield(L, -2, "mapped_bytes");
+    lua_pushinteger(L, devinfo->mapped.count); lua_setfield(L, -2, "mapped_count");
+    lua_pushinteger(L, devinfo->mapped.peak); lua_setfield(L, -2, "mapped_peak");
+    return 1;
+    }
+
 static int FlushMappedMemoryRanges(lua_State *L)
     {
     int err;
@@ -699,6 +1155,11 @@ static const struct luaL_Reg Functions[] =
         { "invalidate_mapped_memory_ranges", InvalidateMappedMemoryRanges },
         { "write_memory", Write },
         { "read_memory", Read },
+        { "upload_file", UploadFile },
+        { "mark_dirty", MarkDirty },
+        { "flush_dirty", FlushDirty },
+        { "invalidate_memory", InvalidateMemory },
+        { "get_memory_stats", GetMemoryStats },
         { "get_buffer_memory_requirements", GetBufferMemoryRequirements },
         { "get_image_memory_requirements", GetImageMemoryRequirements },
         { "get_image_sparse_memory_requirements", GetImageSparseMemoryRequirements },
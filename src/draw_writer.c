@@ -0,0 +1,271 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Stefano Trettel
+ *
+ * Software repository: MoonVulkan, https://github.com/stetre/moonvulkan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "internal.h"
+
+/* Draw writers (NONVK).
+ *
+ * A draw writer appends VkDrawIndirectCommand or VkDrawIndexedIndirectCommand
+ * structs to a region of a mapped device memory, so that the arguments of indirect
+ * draws can be built without packing them in Lua strings. The written ranges are
+ * marked dirty as for write_memory().
+ *
+ * The writer is a child of the device memory, so it is destroyed together with it.
+ */
+
+typedef struct {
+    VkDeviceSize offset; /* of the first command, relative to the mapped area */
+    uint32_t stride; /* size of a command */
+    uint32_t max; /* max number of commands */
+    uint32_t count; /* number of commands written */
+    int indexed;
+} writer_t;
+
+static int freedraw_writer(lua_State *L, ud_t *ud)
+    {
+    uint64_t handle = ud->handle;
+    if(!freeuserdata(L, ud)) return 0; /* double call */
+    TRACE_DELETE(handle, "draw_writer");
+    return 0;
+    }
+
+static int Create(lua_State *L)
+/* create_draw_writer(memory, offset, max_draws, [indexed]) */
+    {
+    ud_t *ud, *memory_ud;
+    writer_t *writer;
+    VkDeviceMemory memory = checkdevice_memory(L, 1, &memory_ud);
+    VkDeviceSize offset = luaL_checkinteger(L, 2);
+    uint32_t max = luaL_checkinteger(L, 3);
+    int indexed = optboolean(L, 4, 0);
+    uint32_t stride = indexed ? sizeof(VkDrawIndexedIndirectCommand) : sizeof(VkDrawIndirectCommand);
+    (void)memory;
+    if((offset % 4) != 0) return argerrorc(L, 2, ERR_VALUE);
+    if(max == 0) return argerrorc(L, 3, ERR_VALUE);
+    if(offset > memorysize(memory_ud) || (VkDeviceSize)max*stride > memorysize(memory_ud) - offset)
+        return argerrorc(L, 3, ERR_LENGTH);
+    writer = (writer_t*)Malloc(L, sizeof(writer_t));
+    writer->offset = offset;
+    writer->stride = stride;
+    writer->max = max;
+    writer->indexed = indexed;
+    TRACE_CREATE(writer, "draw_writer");
+    ud = newuserdata_nondispatchable(L, (uintptr_t)writer, DRAW_WRITER_MT);
+    ud->parent_ud = memory_ud;
+    ud->device = memory_ud->device;
+    ud->instance = memory_ud->instance;
+    ud->destructor = freedraw_writer;
+    ud->ddt = memory_ud->ddt;
+    ud->info = writer;
+    return 1;
+    }
+
+static writer_t *checkwriter(lua_State *L, int arg, ud_t **udp)
+    {
+    ud_t *ud;
+    (void)checkdraw_writer(L, arg, &ud);
+    if(udp) *udp = ud;
+    return (writer_t*)ud->info;
+    }
+
+static char *reserve(lua_State *L, ud_t *ud, writer_t *writer, uint32_t n)
+/* Returns a pointer to the space for the next n commands in the mapped area,
+ * or NULL if the writer is full */
+    {
+    char *ptr;
+    if(n > writer->max - writer->count) return NULL;
+    ptr = mappedrange(ud->parent_ud, writer->offset + (VkDeviceSize)writer->count*writer->stride, 
+                        (VkDeviceSize)n*writer->stride);
+    if(!ptr) { luaL_error(L, "memory is not mapped or too small"); return NULL; }
+    return ptr;
+    }
+
+static int Add(lua_State *L)
+/* index = draw_writer_add(writer, vertex_count, instance_count, first_vertex, first_instance)
+ * index = draw_writer_add(writer, index_count, instance_count, first_index, vertex_offset, first_instance)
+ * Appends a command and returns its index, or nil if the writer is full.
+ */
+    {
+    char *ptr;
+    ud_t *ud;
+    VkDrawIndirectCommand cmd;
+    VkDrawIndexedIndirectCommand icmd;
+    writer_t *writer = checkwriter(L, 1, &ud);
+    if(writer->indexed)
+        {
+        icmd.indexCount = luaL_checkinteger(L, 2);
+        icmd.instanceCount = luaL_checkinteger(L, 3);
+        icmd.firstIndex = luaL_checkinteger(L, 4);
+        icmd.vertexOffset = luaL_checkinteger(L, 5);
+        icmd.firstInstance = luaL_checkinteger(L, 6);
+        }
+    else
+        {
+        cmd.vertexCount = luaL_checkinteger(L, 2);
+        cmd.instanceCount = luaL_checkinteger(L, 3);
+        cmd.firstVertex = luaL_checkinteger(L, 4);
+        cmd.firstInstance = luaL_checkinteger(L, 5);
+        }
+    ptr = reserve(L, ud, writer, 1);
+    if(!ptr) { lua_pushnil(L); return 1; }
+    if(writer->indexed)
+        memcpy(ptr, &icmd, sizeof(icmd));
+    else
+        memcpy(ptr, &cmd, sizeof(cmd));
+    lua_pushinteger(L, writer->count++);
+    return 1;
+    }
+
+static int AddPacked(lua_State *L)
+/* n = draw_writer_add_packed(writer, data)
+ * Appends the commands packed in the binary string data, and returns their number.
+ */
+    {
+    size_t len;
+    char *ptr;
+    ud_t *ud;
+    uint32_t n;
+    writer_t *writer = checkwriter(L, 1, &ud);
+    const char *data = luaL_checklstring(L, 2, &len);
+    if((len % writer->stride) != 0) return argerrorc(L, 2, ERR_LENGTH);
+    if(len / writer->stride > writer->max - writer->count) return argerrorc(L, 2, ERR_LENGTH);
+    n = len / writer->stride;
+    if(n > 0)
+        {
+        ptr = reserve(L, ud, writer, n);
+        memcpy(ptr, data, len);
+        writer->count += n;
+        }
+    lua_pushinteger(L, n);
+    return 1;
+    }
+
+static int Reset(lua_State *L)
+    {
+    writer_t *writer = checkwriter(L, 1, NULL);
+    writer->count = 0;
+    return 0;
+    }
+
+static int Count(lua_State *L)
+/* count, stride = draw_writer_count(writer) */
+    {
+    writer_t *writer = checkwriter(L, 1, NULL);
+    lua_pushinteger(L, writer->count);
+    lua_pushinteger(L, writer->stride);
+    return 2;
+    }
+
+static int CmdDrawWriter(lua_State *L)
+/* cmd_draw_writer(cb, writer, buffer, offset)
+ * Records a single indirect draw of all the commands written so far, whose space
+ * in the memory is bound to buffer at offset.
+ */
+    {
+    ud_t *ud;
+    VkCommandBuffer cb = checkcommand_buffer(L, 1, &ud);
+    writer_t *writer = checkwriter(L, 2, NULL);
+    VkBuffer buffer = checkbuffer(L, 3, NULL);
+    VkDeviceSize offset = luaL_checkinteger(L, 4);
+    if(writer->count == 0) return 0;
+    if(writer->indexed)
+        ud->ddt->CmdDrawIndexedIndirect(cb, buffer, offset, writer->count, writer->stride);
+    else
+        ud->ddt->CmdDrawIndirect(cb, buffer, offset, writer->count, writer->stride);
+    return 0;
+    }
+
+static int Type(lua_State *L)
+    {
+    (void)checkdraw_writer(L, 1, NULL);
+    lua_pushstring(L, "draw_writer");
+    return 1;
+    }
+
+static int Instance(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdraw_writer(L, 1, &ud);
+    return pushinstance(L, ud->instance);
+    }
+
+static int Device(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdraw_writer(L, 1, &ud);
+    return pushdevice(L, ud->device);
+    }
+
+static int Delete(lua_State *L)
+    {
+    ud_t *ud;
+    (void)testdraw_writer(L, 1, &ud);
+    if(!ud) return 0; /* already deleted */
+    return ud->destructor(L, ud);
+    }
+
+static int Destroy(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkdraw_writer(L, 1, &ud);
+    return ud->destructor(L, ud);
+    }
+
+static const struct luaL_Reg Methods[] = 
+    {
+        { "type", Type },
+        { "instance", Instance },
+        { "device", Device },
+        { "add", Add },
+        { "add_packed", AddPacked },
+        { "reset", Reset },
+        { "count", Count },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg MetaMethods[] = 
+    {
+        { "__gc",  Delete },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg Functions[] = 
+    {
+        { "create_draw_writer",  Create },
+        { "destroy_draw_writer",  Destroy },
+        { "draw_writer_add", Add },
+        { "draw_writer_add_packed", AddPacked },
+        { "draw_writer_reset", Reset },
+        { "draw_writer_count", Count },
+        { "cmd_draw_writer", CmdDrawWriter },
+        { NULL, NULL } /* sentinel */
+    };
+
+void moonvulkan_open_draw_writer(lua_State *L)
+    {
+    udata_define(L, DRAW_WRITER_MT, Methods, MetaMethods);
+    luaL_setfuncs(L, Functions, 0);
+    }
+
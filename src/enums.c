@@ -350,6 +350,7 @@ static int Enum(lua_State *L)
     CASE(accelerationstructurebuildtype);
     CASE(accelerationstructurecompatibility);
     CASE(shadergroupshader);
+    CASE(shadercodetype);
 #undef CASE
     return 0;
     }
@@ -1342,6 +1343,12 @@ void moonvulkan_open_enums(lua_State *L)
     ADD(SHADER_GROUP_SHADER_CLOSEST_HIT, "closest hit");
     ADD(SHADER_GROUP_SHADER_ANY_HIT, "any hit");
     ADD(SHADER_GROUP_SHADER_INTERSECTION, "intersection");
+
+#ifdef VK_EXT_shader_object
+    domain = DOMAIN_SHADER_CODE_TYPE; /* VkShaderCodeTypeEXT */
+    ADD(SHADER_CODE_TYPE_BINARY_EXT, "binary");
+    ADD(SHADER_CODE_TYPE_SPIRV_EXT, "spirv");
+#endif
 #undef ADD
     }
 
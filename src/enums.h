@@ -122,6 +122,7 @@ void enums_freelist(lua_State *L, uint32_t *list);
 #define DOMAIN_ACCELERATION_STRUCTURE_BUILD_TYPE 75
 #define DOMAIN_ACCELERATION_STRUCTURE_COMPATIBILITY 76
 #define DOMAIN_SHADER_GROUP_SHADER              77
+#define DOMAIN_SHADER_CODE_TYPE                 78
 
 /* NONVK additions */
 #define DOMAIN_NONVK_TYPE                       101
@@ -158,6 +159,10 @@ void enums_freelist(lua_State *L, uint32_t *list);
 #define pushresult(L, val) enums_push((L), DOMAIN_RESULT, (uint32_t)(val))
 #define valuesresult(L) enums_values((L), DOMAIN_RESULT)
 
+#define testsystemallocationscope(L, arg, err) (VkSystemAllocationScope)enums_test((L), DOMAIN_SYSTEM_ALLOCATION_SCOPE, (arg), (err))
+#define checksystemallocationscope(L, arg) (VkSystemAllocationScope)enums_check((L), DOMAIN_SYSTEM_ALLOCATION_SCOPE, (arg))
+#define pushsystemallocationscope(L, val) enums_push((L), DOMAIN_SYSTEM_ALLOCATION_SCOPE, (uint32_t)(val))
+#define valuessystemallocationscope(L) enums_values((L), DOMAIN_SYSTEM_ALLOCATION_SCOPE)
 
 #define testsubpasscontents(L, arg, err) (VkSubpassContents)enums_test((L), DOMAIN_SUBPASS_CONTENTS, (arg), (err))
 #define checksubpasscontents(L, arg) (VkSubpassContents)enums_check((L), DOMAIN_SUBPASS_CONTENTS, (arg))
@@ -610,6 +615,11 @@ void enums_freelist(lua_State *L, uint32_t *list);
 #define checkshadergroupshaderlist(L, arg, count, err) (VkShaderGroupShaderKHR*)enums_checklist((L), DOMAIN_SHADER_GROUP_SHADER, (arg), (count), (err))
 #define freeshadergroupshaderlist(L, list) enums_freelist((L), (uint32_t*)(list))
 
+#define testshadercodetype(L, arg, err) (VkShaderCodeTypeEXT)enums_test((L), DOMAIN_SHADER_CODE_TYPE, (arg), (err))
+#define checkshadercodetype(L, arg) (VkShaderCodeTypeEXT)enums_check((L), DOMAIN_SHADER_CODE_TYPE, (arg))
+#define pushshadercodetype(L, val) enums_push((L), DOMAIN_SHADER_CODE_TYPE, (uint32_t)(val))
+#define valuesshadercodetype(L) enums_values((L), DOMAIN_SHADER_CODE_TYPE)
+
 #if 0 /* scaffolding 9yy */
 #define testxxx(L, arg, err) (VkXxx)enums_test((L), DOMAIN_XXX, (arg), (err))
 #define checkxxx(L, arg) (VkXxx)enums_check((L), DOMAIN_XXX, (arg))
@@ -0,0 +1,245 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Stefano Trettel
+ *
+ * Software repository: MoonVulkan, https://github.com/stetre/moonvulkan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "internal.h"
+#include <errno.h>
+
+/* File utilities (NONVK).
+ *
+ * These functions read files directly into caller provided memory (typically mapped
+ * device memory), or map them, so that large assets need not be loaded in Lua strings first.
+ * They return 0 on success or an errno value on error, and are safe to be used
+ * in worker threads.
+ */
+
+#define CHUNK_SIZE (8*1024*1024) /* size of single reads */
+
+#if defined(LINUX)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+int filesize(const char *path, uint64_t *size)
+    {
+    struct stat st;
+    if(stat(path, &st) != 0) return errno;
+    *size = (uint64_t)st.st_size;
+    return 0;
+    }
+
+typedef struct {
+    int fd;
+    uint64_t offset; /* file offset */
+    char *dst;
+    size_t size;
+    int ec; /* first error encountered, if any */
+} readjob_t;
+
+static void readchunk(void *data, unsigned index)
+    {
+    readjob_t *job = (readjob_t*)data;
+    size_t pos = (size_t)index * CHUNK_SIZE;
+    size_t len = job->size - pos < CHUNK_SIZE ? job->size - pos : CHUNK_SIZE;
+    ssize_t n;
+    while(len > 0)
+        {
+        n = pread(job->fd, job->dst + pos, len, (off_t)(job->offset + pos));
+        if(n < 0)
+            {
+            if(errno == EINTR) continue;
+            __atomic_store_n(&job->ec, errno, __ATOMIC_RELAXED);
+            return;
+            }
+        if(n == 0) /* unexpected end of file */
+            { __atomic_store_n(&job->ec, EIO, __ATOMIC_RELAXED); return; }
+        pos += (size_t)n;
+        len -= (size_t)n;
+        }
+    }
+
+int readfile(const char *path, uint64_t offset, void *dst, size_t size, unsigned nthreads)
+/* Reads size bytes from the file, starting from offset, and stores them at dst.
+ * The reads are split in chunks, and distributed on up to nthreads threads.
+ */
+    {
+    readjob_t job;
+    unsigned nchunks = (unsigned)((size + CHUNK_SIZE - 1) / CHUNK_SIZE);
+    job.fd = open(path, O_RDONLY);
+    if(job.fd < 0) return errno;
+    job.offset = offset;
+    job.dst = (char*)dst;
+    job.size = size;
+    job.ec = 0;
+#if defined(POSIX_FADV_SEQUENTIAL)
+    (void)posix_fadvise(job.fd, (off_t)offset, (off_t)size, POSIX_FADV_SEQUENTIAL);
+#endif
+    parallel_for(nthreads, nchunks, readchunk, &job);
+    close(job.fd);
+    return job.ec;
+    }
+
+int mapfile(const char *path, void **data, size_t *size)
+/* Maps the whole file read-only. The mapping must be released with unmapfile() */
+    {
+    struct stat st;
+    void *p;
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) return errno;
+    if(fstat(fd, &st) != 0) { close(fd); return errno; }
+    if(st.st_size == 0) { close(fd); *data = NULL; *size = 0; return 0; }
+    p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(p == MAP_FAILED) return errno;
+    *data = p;
+    *size = (size_t)st.st_size;
+    return 0;
+    }
+
+void unmapfile(void *data, size_t size)
+    {
+    if(data) munmap(data, size);
+    }
+
+int writefile(const char *path, const void *data, size_t size)
+/* Writes the file atomically, i.e. writes a temporary file in the same directory
+ * and then renames it, so that readers never see a partially written file.
+ */
+    {
+    int fd, ec = 0;
+    ssize_t n;
+    const char *p = (const char*)data;
+    size_t len = strlen(path) + 32;
+    char *tmp = (char*)malloc(len);
+    if(!tmp) return ENOMEM;
+    snprintf(tmp, len, "%s.%ld.tmp", path, (long)getpid());
+    fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(fd < 0) { ec = errno; free(tmp); return ec; }
+    while(size > 0)
+        {
+        n = write(fd, p, size);
+        if(n < 0)
+            {
+            if(errno == EINTR) continue;
+            ec = errno; break;
+            }
+        p += n;
+        size -= (size_t)n;
+        }
+    if(!ec && fsync(fd) != 0) ec = errno;
+    if(close(fd) != 0 && !ec) ec = errno;
+    if(!ec && rename(tmp, path) != 0) ec = errno;
+    if(ec) unlink(tmp);
+    free(tmp);
+    return ec;
+    }
+
+#else /* stdio fallback (no threads) */
+
+#include <stdio.h>
+
+int filesize(const char *path, uint64_t *size)
+    {
+    long long pos;
+    FILE *f = fopen(path, "rb");
+    if(!f) return errno;
+    if(_fseeki64(f, 0, SEEK_END) != 0) { fclose(f); return EIO; }
+    pos = _ftelli64(f);
+    fclose(f);
+    if(pos < 0) return EIO;
+    *size = (uint64_t)pos;
+    return 0;
+    }
+
+int readfile(const char *path, uint64_t offset, void *dst, size_t size, unsigned nthreads)
+    {
+    size_t n, len;
+    char *p = (char*)dst;
+    FILE *f = fopen(path, "rb");
+    (void)nthreads;
+    if(!f) return errno;
+    if(_fseeki64(f, (long long)offset, SEEK_SET) != 0) { fclose(f); return EIO; }
+    while(size > 0)
+        {
+        len = size < CHUNK_SIZE ? size : CHUNK_SIZE;
+        n = fread(p, 1, len, f);
+        if(n != len) { fclose(f); return EIO; }
+        p += n;
+        size -= n;
+        }
+    fclose(f);
+    return 0;
+    }
+
+int mapfile(const char *path, void **data, size_t *size)
+/* No mapping here: the file is read in malloc'd memory */
+    {
+    int ec;
+    uint64_t len;
+    void *p;
+    ec = filesize(path, &len);
+    if(ec) return ec;
+    if(len == 0) { *data = NULL; *size = 0; return 0; }
+    p = malloc((size_t)len);
+    if(!p) return ENOMEM;
+    ec = readfile(path, 0, p, (size_t)len, 1);
+    if(ec) { free(p); return ec; }
+    *data = p;
+    *size = (size_t)len;
+    return 0;
+    }
+
+void unmapfile(void *data, size_t size)
+    {
+    (void)size;
+    if(data) free(data);
+    }
+
+int writefile(const char *path, const void *data, size_t size)
+/* Writes a temporary file and then replaces the destination with it
+ * (rename() does not replace existing files here, so this is not atomic) */
+    {
+    int ec = 0;
+    FILE *f;
+    size_t len = strlen(path) + 32;
+    char *tmp = (char*)malloc(len);
+    if(!tmp) return ENOMEM;
+    snprintf(tmp, len, "%s.tmp", path);
+    f = fopen(tmp, "wb");
+    if(!f) { ec = errno; free(tmp); return ec; }
+    if(size > 0 && fwrite(data, 1, size, f) != size) ec = EIO;
+    if(fclose(f) != 0 && !ec) ec = EIO;
+    if(!ec) 
+        {
+        remove(path);
+        if(rename(tmp, path) != 0) ec = errno;
+        }
+    if(ec) remove(tmp);
+    free(tmp);
+    return ec;
+    }
+
+#endif
@@ -37,15 +37,84 @@ static int freeframebuffer(lua_State *L, ud_t *ud)
     return 0;
     }
 
+/* Framebuffer cache (NONVK).
+ * When enabled on a device, create_framebuffer() looks up the create info in a device-level
+ * map before converting it, and returns the existing framebuffer on a hit. Entries are keyed
+ * and stored as in the render pass cache (see render_pass.c), so the key includes the
+ * identity of the render pass and of the attachment views.
+ * For each image view referenced by a cached framebuffer, the map also has an index entry
+ * map[view] = { [key] = true, ... }, with view being the light userdata of the view's ud,
+ * that is used to destroy the framebuffers when the view is destroyed (the key includes the
+ * view's address, so it can not match a framebuffer created with a different view).
+ * Imageless framebuffers reference no views, and are never invalidated.
+ * Cached framebuffers are reference counted as cached render passes are. The map holds
+ * strong references, so a cached framebuffer and the views it references stay alive until
+ * it is destroyed by all the callers that got it, until one of its views is destroyed, or
+ * until the cache is disabled.
+ */
+
+void invalidateframebuffers(lua_State *L, VkDevice device, ud_t *image_view_ud)
+/* Called when an image view is destroyed */
+    {
+    int map, index, top = lua_gettop(L);
+    ud_t *ud;
+    ud_t *device_ud = UD(device);
+    if(!device_ud || !IsValid(device_ud) || !device_ud->info) return;
+    if(DEVINFO(device_ud)->framebuffer_map == LUA_NOREF) return;
+    lua_rawgeti(L, LUA_REGISTRYINDEX, DEVINFO(device_ud)->framebuffer_map);
+    map = lua_gettop(L);
+    lua_pushlightuserdata(L, image_view_ud);
+    if(lua_rawget(L, map) != LUA_TTABLE) { lua_settop(L, top); return; }
+    index = lua_gettop(L);
+    lua_pushlightuserdata(L, image_view_ud);
+    lua_pushnil(L);
+    lua_rawset(L, map); /* map[view] = nil */
+    lua_pushnil(L);
+    while(lua_next(L, index) != 0)
+        {
+        lua_pop(L, 1);
+        lua_pushvalue(L, -1); /* key */
+        if(lua_rawget(L, map) == LUA_TTABLE && lua_rawgeti(L, -1, 0) && testframebuffer(L, -1, &ud))
+            {
+            lua_pop(L, 2);
+            lua_pushvalue(L, -1);
+            lua_pushnil(L);
+            lua_rawset(L, map); /* map[key] = nil */
+            ud->destructor(L, ud);
+            }
+        lua_settop(L, index + 1);
+        }
+    lua_settop(L, top);
+    }
+
 static int Create(lua_State *L)
     {
-    int err;
-    ud_t *ud, *device_ud;
+    int err, cached = 0;
+    ud_t *ud, *device_ud, *view_ud;
     VkResult ec;
     VkFramebuffer framebuffer;
     VkFramebufferCreateInfo* info;
+    devinfo_t *devinfo;
+    lua_Integer i, n;
     VkDevice device = checkdevice(L, 1, &device_ud);
     const VkAllocationCallbacks *allocator = optallocator(L, 3);
+    devinfo = DEVINFO(device_ud);
+    lua_settop(L, 3);
+    if(devinfo->framebuffer_map != LUA_NOREF && lua_istable(L, 2) &&
+            pushinfokey(L, 2, "F", allocator) == 0)
+        { /* key at 4, refs at 5 */
+        lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->framebuffer_map);
+        lua_pushvalue(L, 4);
+        if(lua_rawget(L, -2) == LUA_TTABLE && lua_rawgeti(L, -1, 0) && testframebuffer(L, -1, &ud) && ud->info)
+            { /* hit */
+            (*(int*)ud->info)++;
+            devinfo->framebuffer_hits++;
+            return 1;
+            }
+        lua_settop(L, 5);
+        devinfo->framebuffer_misses++;
+        cached = 1;
+        }
 #define CLEANUP zfreeVkFramebufferCreateInfo(L, info, 1)
     info = zcheckVkFramebufferCreateInfo(L, 2, &err);
     if(err) { CLEANUP; return argerror(L, 2); }
@@ -61,6 +130,91 @@ static int Create(lua_State *L)
     ud->allocator = allocator;
     ud->destructor = freeframebuffer;
     ud->ddt = device_ud->ddt;
+    if(cached)
+        {
+        ud->info = Malloc(L, sizeof(int));
+        *(int*)ud->info = 1;
+        lua_pushvalue(L, 4);
+        ud->ref1 = luaL_ref(L, LUA_REGISTRYINDEX);
+        lua_pushvalue(L, -1);
+        lua_rawseti(L, 5, 0); /* refs[0] = framebuffer, so refs is the entry */
+        lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->framebuffer_map);
+        lua_pushvalue(L, 4);
+        lua_pushvalue(L, 5);
+        lua_rawset(L, -3); /* map[key] = entry */
+        n = (lua_Integer)lua_rawlen(L, 5);
+        for(i = 1; i <= n; i++)
+            {
+            lua_rawgeti(L, 5, i);
+            if(testimage_view(L, -1, &view_ud))
+                {
+                lua_pushlightuserdata(L, view_ud);
+                if(lua_rawget(L, -3) != LUA_TTABLE)
+                    {
+                    lua_pop(L, 1);
+                    lua_newtable(L);
+                    lua_pushlightuserdata(L, view_ud);
+                    lua_pushvalue(L, -2);
+                    lua_rawset(L, -5); /* map[view] = index */
+                    }
+                lua_pushvalue(L, 4);
+                lua_pushboolean(L, 1);
+                lua_rawset(L, -3); /* index[key] = true */
+                lua_pop(L, 1);
+                }
+            lua_pop(L, 1);
+            }
+        lua_pop(L, 1);
+        }
+    return 1;
+    }
+
+static int EnableFramebufferCache(lua_State *L)
+    {
+    ud_t *device_ud;
+    devinfo_t *devinfo;
+    (void)checkdevice(L, 1, &device_ud);
+    devinfo = DEVINFO(device_ud);
+    if(lua_isnoneornil(L, 2) || lua_toboolean(L, 2))
+        {
+        if(devinfo->framebuffer_map == LUA_NOREF)
+            {
+            lua_newtable(L);
+            devinfo->framebuffer_map = luaL_ref(L, LUA_REGISTRYINDEX);
+            }
+        }
+    else /* disable, and release the map */
+        Unreference(L, devinfo->framebuffer_map);
+    return 0;
+    }
+
+static int FramebufferCacheStats(lua_State *L)
+    {
+    ud_t *device_ud;
+    devinfo_t *devinfo;
+    lua_Integer entries = 0;
+    (void)checkdevice(L, 1, &device_ud);
+    devinfo = DEVINFO(device_ud);
+    if(devinfo->framebuffer_map != LUA_NOREF)
+        {
+        lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->framebuffer_map);
+        lua_pushnil(L);
+        while(lua_next(L, -2) != 0)
+            {
+            if(lua_type(L, -2) == LUA_TSTRING)
+                {
+                lua_rawgeti(L, -1, 0);
+                if(testframebuffer(L, -1, NULL)) entries++;
+                lua_pop(L, 1);
+                }
+            lua_pop(L, 1);
+            }
+        lua_pop(L, 1);
+        }
+    lua_newtable(L);
+    lua_pushinteger(L, devinfo->framebuffer_hits); lua_setfield(L, -2, "hits");
+    lua_pushinteger(L, devinfo->framebuffer_misses); lua_setfield(L, -2, "misses");
+    lua_pushinteger(L, entries); lua_setfield(L, -2, "entries");
     return 1;
     }
 
@@ -70,7 +224,53 @@ INSTANCE_FUNC(framebuffer)
 DEVICE_FUNC(framebuffer)
 PARENT_FUNC(framebuffer)
 DELETE_FUNC(framebuffer)
-DESTROY_FUNC(framebuffer)
+
+static int Destroy(lua_State *L)
+/* Cached framebuffers are destroyed only when the last reference is released */
+    {
+    int map, entry;
+    lua_Integer i, n;
+    ud_t *ud, *view_ud;
+    devinfo_t *devinfo;
+    (void)checkframebuffer(L, 1, &ud);
+    if(ud->info)
+        {
+        if(--(*(int*)ud->info) > 0) return 0;
+        devinfo = DEVINFO(ud->parent_ud);
+        if(devinfo->framebuffer_map != LUA_NOREF)
+            {
+            lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->framebuffer_map);
+            map = lua_gettop(L);
+            lua_rawgeti(L, LUA_REGISTRYINDEX, ud->ref1); /* key */
+            lua_pushvalue(L, -1);
+            if(lua_rawget(L, map) == LUA_TTABLE && lua_rawgeti(L, -1, 0) &&
+                    lua_touserdata(L, -1) == lua_touserdata(L, 1))
+                {
+                lua_pop(L, 1);
+                entry = lua_gettop(L);
+                n = (lua_Integer)lua_rawlen(L, entry);
+                for(i = 1; i <= n; i++)
+                    {
+                    lua_rawgeti(L, entry, i);
+                    if(!testimage_view(L, -1, &view_ud)) { lua_pop(L, 1); continue; }
+                    lua_pushlightuserdata(L, view_ud);
+                    if(lua_rawget(L, map) == LUA_TTABLE)
+                        {
+                        lua_pushvalue(L, entry - 1);
+                        lua_pushnil(L);
+                        lua_rawset(L, -3); /* index[key] = nil */
+                        }
+                    lua_settop(L, entry);
+                    }
+                lua_pop(L, 1);
+                lua_pushnil(L);
+                lua_rawset(L, map); /* map[key] = nil */
+                }
+            lua_settop(L, 1);
+            }
+        }
+    return ud->destructor(L, ud);
+    }
 
 static const struct luaL_Reg Methods[] = 
     {
@@ -92,6 +292,8 @@ static const struct luaL_Reg Functions[] =
     {
         { "create_framebuffer",  Create },
         { "destroy_framebuffer",  Destroy },
+        { "enable_framebuffer_cache",  EnableFramebufferCache },
+        { "framebuffer_cache_stats",  FramebufferCacheStats },
         { NULL, NULL } /* sentinel */
     };
 
@@ -527,6 +527,28 @@ device_dt_t* getproc_device(lua_State *L, VkDevice device, VkDeviceCreateInfo *c
     GET(GetDeviceImageMemoryRequirementsKHR);
     GET(GetDeviceImageSparseMemoryRequirementsKHR);
     GET(SetDeviceMemoryPriorityEXT);
+#ifdef VK_EXT_shader_object
+    GET(CreateShadersEXT);
+    GET(DestroyShaderEXT);
+    GET(GetShaderBinaryDataEXT);
+    GET(CmdBindShadersEXT);
+#endif
+#ifdef VK_EXT_descriptor_buffer
+    GET(GetDescriptorSetLayoutSizeEXT);
+    GET(GetDescriptorSetLayoutBindingOffsetEXT);
+    GET(GetDescriptorEXT);
+    GET(CmdBindDescriptorBuffersEXT);
+    GET(CmdSetDescriptorBufferOffsetsEXT);
+#endif
+#ifdef VK_EXT_extended_dynamic_state3
+    GET(CmdSetPolygonModeEXT);
+    GET(CmdSetRasterizationSamplesEXT);
+    GET(CmdSetSampleMaskEXT);
+    GET(CmdSetAlphaToCoverageEnableEXT);
+    GET(CmdSetColorBlendEnableEXT);
+    GET(CmdSetColorBlendEquationEXT);
+    GET(CmdSetColorWriteMaskEXT);
+#endif
 #undef GET
 #undef PGET
     return dt;
@@ -420,6 +420,28 @@ typedef struct {
     F(GetDeviceImageMemoryRequirementsKHR);
     F(GetDeviceImageSparseMemoryRequirementsKHR);
     F(SetDeviceMemoryPriorityEXT);
+#ifdef VK_EXT_shader_object
+    F(CreateShadersEXT);
+    F(DestroyShaderEXT);
+    F(GetShaderBinaryDataEXT);
+    F(CmdBindShadersEXT);
+#endif
+#ifdef VK_EXT_descriptor_buffer
+    F(GetDescriptorSetLayoutSizeEXT);
+    F(GetDescriptorSetLayoutBindingOffsetEXT);
+    F(GetDescriptorEXT);
+    F(CmdBindDescriptorBuffersEXT);
+    F(CmdSetDescriptorBufferOffsetsEXT);
+#endif
+#ifdef VK_EXT_extended_dynamic_state3
+    F(CmdSetPolygonModeEXT);
+    F(CmdSetRasterizationSamplesEXT);
+    F(CmdSetSampleMaskEXT);
+    F(CmdSetAlphaToCoverageEnableEXT);
+    F(CmdSetColorBlendEnableEXT);
+    F(CmdSetColorBlendEquationEXT);
+    F(CmdSetColorWriteMaskEXT);
+#endif
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     F(GetMemoryWin32HandleKHR);
     F(GetMemoryWin32HandlePropertiesKHR);
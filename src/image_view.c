@@ -32,6 +32,7 @@ static int freeimage_view(lua_State *L, ud_t *ud)
     VkDevice device = ud->device;
     if(!freeuserdata(L, ud))
         return 0; /* double call */
+    invalidateframebuffers(L, device, ud); /* ud is used only as key */
     TRACE_DELETE(image_view, "image_view");
     UD(device)->ddt->DestroyImageView(device, image_view, allocator);
     return 0;
@@ -80,6 +80,11 @@ void *MallocNoErr(lua_State *L, size_t size);
 char *Strdup(lua_State *L, const char *s);
 #define Free moonvulkan_Free
 void Free(lua_State *L, void *ptr);
+/* Small lists: the checkxxxlistbuf() functions use a caller-provided buffer (typically
+ * an array of SMALL_LIST elements on the stack) if the list fits in it, and allocate the
+ * list only otherwise. The returned list must then be released with FreeBuf(). */
+#define SMALL_LIST 16
+#define FreeBuf(L, p, buf) do { if((p) && (void*)(p) != (void*)(buf)) Free((L), (p)); } while(0)
 #define checkboolean moonvulkan_checkboolean
 int checkboolean(lua_State *L, int arg);
 #define testboolean moonvulkan_testboolean
@@ -114,28 +119,40 @@ void freestringlist(lua_State *L, char** list, uint32_t count);
 void pushstringlist(lua_State *L, char** list, uint32_t count);
 #define checkbooleanlist moonvulkan_checkbooleanlist
 VkBool32* checkbooleanlist(lua_State *L, int arg, uint32_t *count, int *err);
+#define checkbooleanlistbuf moonvulkan_checkbooleanlistbuf
+VkBool32* checkbooleanlistbuf(lua_State *L, int arg, VkBool32 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define pushbooleanlist moonvulkan_pushbooleanlist
 void pushbooleanlist(lua_State *L, VkBool32 *list, uint32_t count);
 #define checkuint32list moonvulkan_checkuint32list
 uint32_t* checkuint32list(lua_State *L, int arg, uint32_t *count, int *err);
+#define checkuint32listbuf moonvulkan_checkuint32listbuf
+uint32_t* checkuint32listbuf(lua_State *L, int arg, uint32_t *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define pushuint32list moonvulkan_pushuint32list
 void pushuint32list(lua_State *L, uint32_t *list, uint32_t count);
 #define checkint32list moonvulkan_checkint32list
 int32_t* checkint32list(lua_State *L, int arg, uint32_t *count, int *err);
+#define checkint32listbuf moonvulkan_checkint32listbuf
+int32_t* checkint32listbuf(lua_State *L, int arg, int32_t *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define pushint32list moonvulkan_pushint32list
 void pushint32list(lua_State *L, int32_t *list, uint32_t count);
 #define checkuint64list moonvulkan_checkuint64list
 uint64_t* checkuint64list(lua_State *L, int arg, uint32_t *count, int *err);
+#define checkuint64listbuf moonvulkan_checkuint64listbuf
+uint64_t* checkuint64listbuf(lua_State *L, int arg, uint64_t *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define pushuint64list moonvulkan_pushuint64list
 void pushuint64list(lua_State *L, uint64_t *list, uint32_t count);
 #define checkdevicesize moonvulkan_checkdevicesize
 VkDeviceSize checkdevicesize(lua_State *L, int arg);
 #define checkdevicesizelist moonvulkan_checkdevicesizelist
 VkDeviceSize* checkdevicesizelist(lua_State *L, int arg, uint32_t *count, int *err);
+#define checkdevicesizelistbuf moonvulkan_checkdevicesizelistbuf
+VkDeviceSize* checkdevicesizelistbuf(lua_State *L, int arg, VkDeviceSize *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define pushdevicesizelist moonvulkan_pushdevicesizelist
 void pushdevicesizelist(lua_State *L, VkDeviceSize *list, uint32_t count);
 #define checkfloatlist moonvulkan_checkfloatlist
 float* checkfloatlist(lua_State *L, int arg, uint32_t *count, int *err);
+#define checkfloatlistbuf moonvulkan_checkfloatlistbuf
+float* checkfloatlistbuf(lua_State *L, int arg, float *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define pushfloatlist moonvulkan_pushfloatlist
 void pushfloatlist(lua_State *L, float *list, uint32_t count);
 #define testflags moonvulkan_testflags
@@ -153,10 +170,14 @@ void pushflagslist(lua_State *L, VkFlags *list, uint32_t count);
 
 #define checksizeorwholesize moonvulkan_checksizeorwholesize
 VkDeviceSize checksizeorwholesize(lua_State *L, int arg);
+#define pushinfokey moonvulkan_pushinfokey
+int pushinfokey(lua_State *L, int arg, const char *tag, const VkAllocationCallbacks *allocator);
 #define checktimeout moonvulkan_checktimeout
 uint64_t checktimeout(lua_State *L, int arg);
 #define testtimeout moonvulkan_testtimeout
 uint64_t testtimeout(lua_State *L, int arg, int *err);
+#define testinteger moonvulkan_testinteger
+lua_Integer testinteger(lua_State *L, int arg, lua_Integer defval, int *err);
 
 #define optallocator(L, arg) (VkAllocationCallbacks*)optlightuserdata((L), (arg))
 
@@ -179,6 +200,34 @@ const char* errstring(int err);
 #define trace_objects moonvulkan_trace_objects
 extern int trace_objects;
 
+/* parallel.c */
+#define parallel_func_t moonvulkan_parallel_func_t
+typedef void (parallel_func_t)(void *data, unsigned index);
+#define ncpus moonvulkan_ncpus
+unsigned ncpus(void);
+#define parallel_for moonvulkan_parallel_for
+void parallel_for(unsigned nthreads, unsigned count, parallel_func_t *func, void *data);
+#define task_t moonvulkan_task_t
+typedef struct moonvulkan_task_s task_t;
+#define task_start moonvulkan_task_start
+task_t *task_start(unsigned nthreads, unsigned count, parallel_func_t *func, void *data);
+#define task_done moonvulkan_task_done
+int task_done(task_t *task);
+#define task_wait moonvulkan_task_wait
+void task_wait(task_t *task);
+
+/* fileio.c */
+#define filesize moonvulkan_filesize
+int filesize(const char *path, uint64_t *size);
+#define readfile moonvulkan_readfile
+int readfile(const char *path, uint64_t offset, void *dst, size_t size, unsigned nthreads);
+#define mapfile moonvulkan_mapfile
+int mapfile(const char *path, void **data, size_t *size);
+#define unmapfile moonvulkan_unmapfile
+void unmapfile(void *data, size_t size);
+#define writefile moonvulkan_writefile
+int writefile(const char *path, const void *data, size_t size);
+
 /* main.c */
 extern lua_State *moonvulkan_L;
 int luaopen_moonvulkan(lua_State *L);
@@ -191,6 +240,8 @@ void moonvulkan_open_cmd(lua_State *L);
 void moonvulkan_open_versions(lua_State *L);
 void moonvulkan_open_tracing(lua_State *L);
 void moonvulkan_open_datahandling(lua_State *L);
+void moonvulkan_open_allocator(lua_State *L);
+void moonvulkan_atexit_allocator(void);
 
 
 /*------------------------------------------------------------------------------*
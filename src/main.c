@@ -33,6 +33,7 @@ static void AtExit(void)
         {
         enums_free_all(moonvulkan_L);
         moonvulkan_atexit_getproc();
+        moonvulkan_atexit_allocator();
         moonvulkan_L = NULL;
         }
     }
@@ -52,6 +53,7 @@ int luaopen_moonvulkan(lua_State *L)
     moonvulkan_open_versions(L);
     moonvulkan_open_tracing(L);
     moonvulkan_open_datahandling(L);
+    moonvulkan_open_allocator(L);
     moonvulkan_open_enums(L);
     moonvulkan_open_flags(L);
     moonvulkan_open_instance(L);
@@ -70,6 +72,7 @@ int luaopen_moonvulkan(lua_State *L)
     moonvulkan_open_buffer_view(L);
     moonvulkan_open_image_view(L);
     moonvulkan_open_shader_module(L);
+    moonvulkan_open_shader(L);
     moonvulkan_open_sampler(L);
     moonvulkan_open_render_pass(L);
     moonvulkan_open_framebuffer(L);
@@ -90,6 +93,12 @@ int luaopen_moonvulkan(lua_State *L)
     moonvulkan_open_validation_cache(L);
     moonvulkan_open_sampler_ycbcr_conversion(L);
     moonvulkan_open_debug_utils_messenger(L);
+    moonvulkan_open_staging(L);
+    moonvulkan_open_descriptor_buffer(L);
+    moonvulkan_open_bindless_table(L);
+    moonvulkan_open_descriptor_set_cache(L);
+    moonvulkan_open_draw_writer(L);
+    moonvulkan_open_barrier_set(L);
 
     /* Add functions implemented in Lua */
     lua_pushvalue(L, -1); lua_setglobal(L, "moonvulkan");
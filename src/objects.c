@@ -163,7 +163,9 @@ int pushxxx(lua_State *L, uint64_t handle)  /* dispatchable objects only */
  * On error, sets *err to ERR_XXX, *count to 0, and returns NULL. 
  */
 
-void** checkxxxlist_dispatchable(lua_State *L, int arg, uint32_t *count, int *err, const char *mt)
+void** checkxxxlist_dispatchablebuf(lua_State *L, int arg, void **buf, uint32_t bufcount, uint32_t *count, int *err, const char *mt)
+/* Same as checkxxxlist_dispatchable(), but uses buf if the list has no more than bufcount
+ * elements (see SMALL_LIST). The returned list must be released with FreeBuf(). */
     {
     void** list;
     uint32_t i;
@@ -177,7 +179,10 @@ void** checkxxxlist_dispatchable(lua_State *L, int arg, uint32_t *count, int *er
     *count = luaL_len(L, arg);
     if(*count == 0)
         { *err = ERR_EMPTY; return NULL; }
-    list = (void**)MallocNoErr(L, sizeof(void*) * (*count));
+    if(buf && *count <= bufcount)
+        list = buf;
+    else
+        list = (void**)MallocNoErr(L, sizeof(void*) * (*count));
 
     if(!list)
         { *count = 0; *err = ERR_MEMORY; return NULL; }
@@ -187,17 +192,16 @@ void** checkxxxlist_dispatchable(lua_State *L, int arg, uint32_t *count, int *er
         lua_rawgeti(L, arg, i+1);
         list[i] = (void*)(uintptr_t)testxxx(L, -1, NULL, mt);
         if(!list[i])
-            { Free(L, list); *count = 0; *err = ERR_TYPE; return NULL; }
+            { FreeBuf(L, list, buf); *count = 0; *err = ERR_TYPE; return NULL; }
         lua_pop(L, 1);
         }
     return list;
     }
 
+void** checkxxxlist_dispatchable(lua_State *L, int arg, uint32_t *count, int *err, const char *mt)
+    { return checkxxxlist_dispatchablebuf(L, arg, NULL, 0, count, err, mt); }
 
-uint64_t* checkxxxlist_nondispatchable(lua_State *L, int arg, uint32_t *count, int *err, ud_t ***ud, const char *mt)
-/* if ud != NULL, at return it will point to the array of ud_t* for the elements
- * i.e. ud[i] = the ud for element i  (also this array must be Free'd by the caller).
- */
+static uint64_t* nondispatchablelist(lua_State *L, int arg, uint64_t *buf, uint32_t bufcount, uint32_t *count, int *err, ud_t ***ud, const char *mt)
     {
     uint64_t* list;
     uint32_t i;
@@ -212,14 +216,17 @@ uint64_t* checkxxxlist_nondispatchable(lua_State *L, int arg, uint32_t *count, i
     *count = luaL_len(L, arg);
     if(*count == 0)
         { *err = ERR_EMPTY; return NULL; }
-    list = (uint64_t*)MallocNoErr(L, sizeof(uint64_t) * (*count));
+    if(buf && *count <= bufcount)
+        list = buf;
+    else
+        list = (uint64_t*)MallocNoErr(L, sizeof(uint64_t) * (*count));
     if(!list)
         { *count = 0; *err = ERR_MEMORY; return NULL; }
     if(ud)
         {
         *ud = (ud_t**)MallocNoErr(L, sizeof(ud_t*) *(*count));
         if(!*ud)
-            { Free(L, list); *count = 0; *err = ERR_MEMORY; return NULL; }
+            { FreeBuf(L, list, buf); *count = 0; *err = ERR_MEMORY; return NULL; }
         }
     
     if(ud)
@@ -227,10 +234,10 @@ uint64_t* checkxxxlist_nondispatchable(lua_State *L, int arg, uint32_t *count, i
         for(i=0; i<*count; i++)
             {
             lua_rawgeti(L, arg, i+1);
-            (void)testxxx(L, -1, ud[i], mt);
-            if(!*ud[i])
-                {  Free(L, list); Free(L, *ud); *count = 0; *err = ERR_TYPE; return NULL; }
-            list[i] = (*ud[i])->handle;
+            (void)testxxx(L, -1, &(*ud)[i], mt);
+            if(!(*ud)[i])
+                {  FreeBuf(L, list, buf); Free(L, *ud); *ud = NULL; *count = 0; *err = ERR_TYPE; return NULL; }
+            list[i] = (*ud)[i]->handle;
             lua_pop(L, 1);
             }
         }
@@ -241,10 +248,21 @@ uint64_t* checkxxxlist_nondispatchable(lua_State *L, int arg, uint32_t *count, i
             lua_rawgeti(L, arg, i+1);
             list[i] = (uint64_t)testxxx(L, -1, NULL, mt);
             if(!list[i])
-                { Free(L, list); *count = 0; *err = ERR_TYPE; return NULL; }
+                { FreeBuf(L, list, buf); *count = 0; *err = ERR_TYPE; return NULL; }
             lua_pop(L, 1);
             }
         }
     return list;
     }
 
+uint64_t* checkxxxlist_nondispatchable(lua_State *L, int arg, uint32_t *count, int *err, ud_t ***ud, const char *mt)
+/* if ud != NULL, at return it will point to the array of ud_t* for the elements
+ * i.e. (*ud)[i] = the ud for element i  (also this array must be Free'd by the caller).
+ */
+    { return nondispatchablelist(L, arg, NULL, 0, count, err, ud, mt); }
+
+uint64_t* checkxxxlist_nondispatchablebuf(lua_State *L, int arg, uint64_t *buf, uint32_t bufcount, uint32_t *count, int *err, const char *mt)
+/* Same as checkxxxlist_nondispatchable(), but uses buf if the list has no more than
+ * bufcount elements (see SMALL_LIST). The returned list must be released with FreeBuf(). */
+    { return nondispatchablelist(L, arg, buf, bufcount, count, err, NULL, mt); }
+
@@ -65,6 +65,16 @@
 #define VALIDATION_CACHE_MT "moonvulkan_validation_cache" /* EXT */
 #define SAMPLER_YCBCR_CONVERSION_MT "moonvulkan_sampler_ycbcr_conversion"
 #define DEBUG_UTILS_MESSENGER_MT "moonvulkan_debug_utils_messenger" /* EXT */
+#define SHADER_MT "moonvulkan_shader" /* EXT */
+#define STAGING_RING_MT "moonvulkan_staging_ring" /* NONVK */
+#define PIPELINE_FUTURE_MT "moonvulkan_pipeline_future" /* NONVK */
+#define DESCRIPTOR_TEMPLATE_WRITER_MT "moonvulkan_descriptor_template_writer" /* NONVK */
+#define DESCRIPTOR_WRITER_MT "moonvulkan_descriptor_writer" /* NONVK */
+#define DESCRIPTOR_ALLOCATOR_MT "moonvulkan_descriptor_allocator" /* NONVK */
+#define BINDLESS_TABLE_MT "moonvulkan_bindless_table" /* NONVK */
+#define DESCRIPTOR_SET_CACHE_MT "moonvulkan_descriptor_set_cache" /* NONVK */
+#define DRAW_WRITER_MT "moonvulkan_draw_writer" /* NONVK */
+#define BARRIER_SET_MT "moonvulkan_barrier_set" /* NONVK */
 
 /* Userdata memory associated with objects */
 #define ud_t moonvulkan_ud_t
@@ -83,6 +93,45 @@ struct moonvulkan_ud_s {
     device_dt_t *ddt; /* device dispatch table */
     void *info; /* object specific info (ud_info_t, subject to Free() at destruction, if not NULL) */
 };
+
+/* Memory usage counter (see device_memory.c) */
+#define memcounter_t moonvulkan_memcounter_t
+typedef struct {
+    VkDeviceSize bytes; /* currently allocated (or mapped) bytes */
+    VkDeviceSize peak; /* high-water mark of bytes */
+    uint32_t count; /* current number of allocations (or mappings) */
+} memcounter_t;
+
+/* Device specific info (ud->info of device objects) */
+#define devinfo_t moonvulkan_devinfo_t
+typedef struct {
+    VkPhysicalDevice physical_device; /* the physical device the device was created from */
+    VkPhysicalDeviceProperties properties;
+    VkPhysicalDeviceMemoryProperties memory_properties;
+    int memory_budget; /* VK_EXT_memory_budget is enabled */
+    int creation_feedback; /* VK_EXT_pipeline_creation_feedback is enabled (or core) */
+    memcounter_t type_usage[VK_MAX_MEMORY_TYPES];
+    memcounter_t heap_usage[VK_MAX_MEMORY_HEAPS];
+    memcounter_t mapped;
+    int pipeline_map; /* pipeline dedupe map (LUA_NOREF if disabled, see pipeline.c) */
+    size_t pipeline_hits, pipeline_misses;
+    int pipeline_feedback; /* record pipeline creation feedback (see pipeline.c) */
+    int link_map; /* linked pipeline libraries (LUA_NOREF if empty, see pipeline.c) */
+    size_t link_hits, link_misses;
+    int shader_map; /* shader module cache (LUA_NOREF if empty, see shader_module.c) */
+    size_t shader_hits, shader_misses;
+    int sampler_map; /* sampler cache (LUA_NOREF if disabled, see sampler.c) */
+    size_t sampler_hits, sampler_misses;
+    uint32_t sampler_count; /* live samplers, to be compared with maxSamplerAllocationCount */
+    int render_pass_map; /* render pass cache (LUA_NOREF if disabled, see render_pass.c) */
+    size_t render_pass_hits, render_pass_misses;
+    int framebuffer_map; /* framebuffer cache (LUA_NOREF if disabled, see framebuffer.c) */
+    size_t framebuffer_hits, framebuffer_misses;
+    int robust_buffer_access; /* the robustBufferAccess feature is enabled */
+    void *descriptor_buffer; /* descriptor buffer properties (NULL until queried, see descriptor_buffer.c) */
+} devinfo_t;
+
+#define DEVINFO(device_ud) ((devinfo_t*)(device_ud)->info)
     
 /* NOTE1: ud->handle is an uint64_t both for dispatchable and non-dispatchable
  *        objects, but for dispatchable objects it actually holds a pointer, 
@@ -147,6 +196,10 @@ int pushnondispatchable(lua_State *L, uint64_t handle, ud_t *parent_ud, const ch
 void** checkxxxlist_dispatchable(lua_State *L, int arg, uint32_t *count, int *err, const char *mt);
 #define checkxxxlist_nondispatchable moonvulkan_checkxxxlist_nondispatchable
 uint64_t* checkxxxlist_nondispatchable(lua_State *L, int arg, uint32_t *count, int *err, ud_t ***ud, const char *mt);
+#define checkxxxlist_dispatchablebuf moonvulkan_checkxxxlist_dispatchablebuf
+void** checkxxxlist_dispatchablebuf(lua_State *L, int arg, void **buf, uint32_t bufcount, uint32_t *count, int *err, const char *mt);
+#define checkxxxlist_nondispatchablebuf moonvulkan_checkxxxlist_nondispatchablebuf
+uint64_t* checkxxxlist_nondispatchablebuf(lua_State *L, int arg, uint64_t *buf, uint32_t bufcount, uint32_t *count, int *err, const char *mt);
 
 #define userdata_unref(L, handle) udata_unref((L),(handle))
 
@@ -195,6 +248,34 @@ int pushphysical_device(lua_State *L, VkPhysicalDevice p, VkInstance instance);
 #define checkcommand_bufferlist(L, arg, count, err, notused) \
     (VkCommandBuffer*)checkxxxlist_dispatchable((L), (arg), (count), (err), COMMAND_BUFFER_MT)
 
+/* Shadow state for redundant state filtering (NONVK, see command_buffer.c).
+ * When enabled on a command buffer, its ud->info points to a cbstate_t, and the cmd_xxx()
+ * functions that bind or set the state tracked here skip the driver call if it would not
+ * change it. Only the first CBSTATE_MAX_XXX slots are tracked, calls involving others are
+ * always issued. A zero bit in a xxx mask means that the slot's state is unknown.
+ */
+#define CBSTATE_BIND_POINTS     3 /* graphics, compute, ray tracing */
+#define CBSTATE_MAX_SETS        8
+#define CBSTATE_MAX_VIEWPORTS   16
+#define CBSTATE_MAX_VERTEX_BUFFERS 32
+typedef struct {
+    VkPipeline pipeline[CBSTATE_BIND_POINTS]; /* VK_NULL_HANDLE if unknown */
+    VkPipelineLayout layout[CBSTATE_BIND_POINTS]; /* layout of the bound sets */
+    VkDescriptorSet set[CBSTATE_BIND_POINTS][CBSTATE_MAX_SETS];
+    uint32_t sets[CBSTATE_BIND_POINTS]; /* mask of known sets */
+    VkViewport viewport[CBSTATE_MAX_VIEWPORTS];
+    uint32_t viewports; /* mask of known viewports */
+    VkRect2D scissor[CBSTATE_MAX_VIEWPORTS];
+    uint32_t scissors; /* mask of known scissors */
+    VkBuffer vertex_buffer[CBSTATE_MAX_VERTEX_BUFFERS];
+    VkDeviceSize vertex_offset[CBSTATE_MAX_VERTEX_BUFFERS];
+    uint32_t vertex_buffers; /* mask of known vertex buffer bindings */
+    size_t issued, skipped; /* counters (not reset by resetcbstate) */
+} cbstate_t;
+#define CBSTATE(ud) ((cbstate_t*)(ud)->info)
+#define resetcbstate moonvulkan_resetcbstate
+void resetcbstate(cbstate_t *state);
+
 /* command_pool.c (nondispatchable) */
 #define checkcommand_pool(L, arg, udp) (VkCommandPool)checkxxx((L), (arg), (udp), COMMAND_POOL_MT)
 #define testcommand_pool(L, arg, udp) (VkCommandPool)testxxx((L), (arg), (udp), COMMAND_POOL_MT)
@@ -222,12 +303,18 @@ int pushqueue(lua_State *L, VkQueue p, VkDevice device);
 /* device_memory.c (nondispatchable) */
 #define checkdevice_memory(L, arg, udp) (VkDeviceMemory)checkxxx((L), (arg), (udp), DEVICE_MEMORY_MT)
 #define testdevice_memory(L, arg, udp) (VkDeviceMemory)testxxx((L), (arg), (udp), DEVICE_MEMORY_MT)
+#define mappedrange moonvulkan_mappedrange
+char *mappedrange(ud_t *ud, VkDeviceSize offset, VkDeviceSize size);
+#define memorysize moonvulkan_memorysize
+VkDeviceSize memorysize(ud_t *ud);
 
 /* event.c (nondispatchable) */
 #define checkevent(L, arg, udp) (VkEvent)checkxxx((L), (arg), (udp), EVENT_MT)
 #define testevent(L, arg, udp) (VkEvent)testxxx((L), (arg), (udp), EVENT_MT)
 #define checkeventlist(L, arg, count, err, ud) \
     (VkEvent*)checkxxxlist_nondispatchable((L), (arg), (count), (err), (ud), EVENT_MT)
+#define checkeventlistbuf(L, arg, buf, bufcount, count, err) \
+    (VkEvent*)checkxxxlist_nondispatchablebuf((L), (arg), (uint64_t*)(buf), (bufcount), (count), (err), EVENT_MT)
 
 /* buffer_view.c (nondispatchable) */
 #define checkbuffer_view(L, arg, udp) (VkBufferView)checkxxx((L), (arg), (udp), BUFFER_VIEW_MT)
@@ -240,10 +327,14 @@ int pushqueue(lua_State *L, VkQueue p, VkDevice device);
 #define testbuffer(L, arg, udp) (VkBuffer)testxxx((L), (arg), (udp), BUFFER_MT)
 #define checkbufferlist(L, arg, count, err) \
     (VkBuffer*)checkxxxlist_dispatchable((L), (arg), (count), (err), BUFFER_MT)
+#define checkbufferlistbuf(L, arg, buf, bufcount, count, err) \
+    (VkBuffer*)checkxxxlist_dispatchablebuf((L), (arg), (void**)(buf), (bufcount), (count), (err), BUFFER_MT)
 
 /* framebuffer.c (nondispatchable) */
 #define checkframebuffer(L, arg, udp) (VkFramebuffer)checkxxx((L), (arg), (udp), FRAMEBUFFER_MT)
 #define testframebuffer(L, arg, udp) (VkFramebuffer)testxxx((L), (arg), (udp), FRAMEBUFFER_MT)
+#define invalidateframebuffers moonvulkan_invalidateframebuffers
+void invalidateframebuffers(lua_State *L, VkDevice device, ud_t *image_view_ud);
 
 /* image_view.c (nondispatchable) */
 #define checkimage_view(L, arg, udp) (VkImageView)checkxxx((L), (arg), (udp), IMAGE_VIEW_MT)
@@ -261,6 +352,10 @@ int pushimage_swapchain(lua_State *L, VkImage image, ud_t *swapchain_ud);
 #define checkshader_module(L, arg, udp) (VkShaderModule)checkxxx((L), (arg), (udp), SHADER_MODULE_MT)
 #define testshader_module(L, arg, udp) (VkShaderModule)testxxx((L), (arg), (udp), SHADER_MODULE_MT)
 
+/* shader.c (nondispatchable, EXT, no casts because VkShaderEXT may be not defined) */
+#define checkshader(L, arg, udp) checkxxx((L), (arg), (udp), SHADER_MT)
+#define testshader(L, arg, udp) testxxx((L), (arg), (udp), SHADER_MT)
+
 /* sampler.c (nondispatchable) */
 #define checksampler(L, arg, udp) (VkSampler)checkxxx((L), (arg), (udp), SAMPLER_MT)
 #define testsampler(L, arg, udp) (VkSampler)testxxx((L), (arg), (udp), SAMPLER_MT)
@@ -290,6 +385,18 @@ int pushimage_swapchain(lua_State *L, VkImage image, ud_t *swapchain_ud);
 #define testdescriptor_set(L, arg, udp) (VkDescriptorSet)testxxx((L), (arg), (udp), DESCRIPTOR_SET_MT)
 #define checkdescriptor_setlist(L, arg, count, err, ud) \
     (VkDescriptorSet*)checkxxxlist_nondispatchable((L), (arg), (count), (err), (ud), DESCRIPTOR_SET_MT)
+#define newdescriptor_set moonvulkan_newdescriptor_set
+ud_t *newdescriptor_set(lua_State *L, VkDescriptorSet descriptor_set, ud_t *parent_ud);
+#define checkdescriptor_sethandle moonvulkan_checkdescriptor_sethandle
+VkDescriptorSet checkdescriptor_sethandle(lua_State *L, int arg);
+#define checkdescriptor_sethandlelist moonvulkan_checkdescriptor_sethandlelist
+VkDescriptorSet *checkdescriptor_sethandlelist(lua_State *L, int arg, uint32_t *count, int *err);
+#define checkdescriptor_sethandlelistbuf moonvulkan_checkdescriptor_sethandlelistbuf
+VkDescriptorSet *checkdescriptor_sethandlelistbuf(lua_State *L, int arg, VkDescriptorSet *buf, uint32_t bufcount, uint32_t *count, int *err);
+#define descriptorimageinfo moonvulkan_descriptorimageinfo
+int descriptorimageinfo(lua_State *L, int arg, VkDescriptorImageInfo *p);
+#define descriptorbufferinfo moonvulkan_descriptorbufferinfo
+int descriptorbufferinfo(lua_State *L, int arg, VkDescriptorBufferInfo *p);
 
 /* pipeline_cache.c (nondispatchable) */
 #define checkpipeline_cache(L, arg, udp) (VkPipelineCache)checkxxx((L), (arg), (udp), PIPELINE_CACHE_MT)
@@ -348,6 +455,44 @@ int pushimage_swapchain(lua_State *L, VkImage image, ud_t *swapchain_ud);
 #define testsampler_ycbcr_conversion(L, arg, udp) (VkSamplerYcbcrConversion)testxxx((L), (arg), (udp), SAMPLER_YCBCR_CONVERSION_MT)
 #define pushsampler_ycbcr_conversion(L, handle) pushxxx((L), (uint64_t)(handle))
 
+/* staging.c (NONVK, nondispatchable, the handle is that of the staging buffer) */
+#define checkstaging_ring(L, arg, udp) (VkBuffer)checkxxx((L), (arg), (udp), STAGING_RING_MT)
+#define teststaging_ring(L, arg, udp) (VkBuffer)testxxx((L), (arg), (udp), STAGING_RING_MT)
+
+/* pipeline.c (NONVK, nondispatchable, the handle is a pointer to the batch being created) */
+#define checkpipeline_future(L, arg, udp) checkxxx((L), (arg), (udp), PIPELINE_FUTURE_MT)
+#define testpipeline_future(L, arg, udp) testxxx((L), (arg), (udp), PIPELINE_FUTURE_MT)
+
+/* descriptor_update_template.c (NONVK, nondispatchable, the handle is a pointer to the writer) */
+#define checkdescriptor_template_writer(L, arg, udp) checkxxx((L), (arg), (udp), DESCRIPTOR_TEMPLATE_WRITER_MT)
+#define testdescriptor_template_writer(L, arg, udp) testxxx((L), (arg), (udp), DESCRIPTOR_TEMPLATE_WRITER_MT)
+
+/* descriptor_set.c (NONVK, nondispatchable, the handle is a pointer to the writer) */
+#define checkdescriptor_writer(L, arg, udp) checkxxx((L), (arg), (udp), DESCRIPTOR_WRITER_MT)
+#define testdescriptor_writer(L, arg, udp) testxxx((L), (arg), (udp), DESCRIPTOR_WRITER_MT)
+
+/* descriptor_pool.c (NONVK, nondispatchable, the handle is a pointer to the allocator) */
+#define checkdescriptor_allocator(L, arg, udp) checkxxx((L), (arg), (udp), DESCRIPTOR_ALLOCATOR_MT)
+#define testdescriptor_allocator(L, arg, udp) testxxx((L), (arg), (udp), DESCRIPTOR_ALLOCATOR_MT)
+
+/* bindless_table.c (NONVK, nondispatchable, the handle is a pointer to the table) */
+#define checkbindless_table(L, arg, udp) checkxxx((L), (arg), (udp), BINDLESS_TABLE_MT)
+#define testbindless_table(L, arg, udp) testxxx((L), (arg), (udp), BINDLESS_TABLE_MT)
+#define freebindless_tables moonvulkan_freebindless_tables
+void freebindless_tables(lua_State *L, ud_t *pool_ud);
+
+/* descriptor_set_cache.c (NONVK, nondispatchable, the handle is a pointer to the cache) */
+#define checkdescriptor_set_cache(L, arg, udp) checkxxx((L), (arg), (udp), DESCRIPTOR_SET_CACHE_MT)
+#define testdescriptor_set_cache(L, arg, udp) testxxx((L), (arg), (udp), DESCRIPTOR_SET_CACHE_MT)
+
+/* draw_writer.c (NONVK, nondispatchable, the handle is a pointer to the writer) */
+#define checkdraw_writer(L, arg, udp) checkxxx((L), (arg), (udp), DRAW_WRITER_MT)
+#define testdraw_writer(L, arg, udp) testxxx((L), (arg), (udp), DRAW_WRITER_MT)
+
+/* barrier_set.c (NONVK, nondispatchable, the handle is a pointer to the dependency info) */
+#define checkbarrier_set(L, arg, udp) checkxxx((L), (arg), (udp), BARRIER_SET_MT)
+#define testbarrier_set(L, arg, udp) testxxx((L), (arg), (udp), BARRIER_SET_MT)
+
 /* used in main.c */
 void moonvulkan_open_instance(lua_State *L);
 void moonvulkan_open_physical_device(lua_State *L);
@@ -365,6 +510,7 @@ void moonvulkan_open_event(lua_State *L);
 void moonvulkan_open_buffer_view(lua_State *L);
 void moonvulkan_open_image_view(lua_State *L);
 void moonvulkan_open_shader_module(lua_State *L);
+void moonvulkan_open_shader(lua_State *L);
 void moonvulkan_open_sampler(lua_State *L);
 void moonvulkan_open_render_pass(lua_State *L);
 void moonvulkan_open_framebuffer(lua_State *L);
@@ -384,6 +530,12 @@ void moonvulkan_open_descriptor_update_template(lua_State *L);
 void moonvulkan_open_validation_cache(lua_State *L);
 void moonvulkan_open_sampler_ycbcr_conversion(lua_State *L);
 void moonvulkan_open_debug_utils_messenger(lua_State *L);
+void moonvulkan_open_staging(lua_State *L);
+void moonvulkan_open_descriptor_buffer(lua_State *L);
+void moonvulkan_open_bindless_table(lua_State *L);
+void moonvulkan_open_descriptor_set_cache(lua_State *L);
+void moonvulkan_open_draw_writer(lua_State *L);
+void moonvulkan_open_barrier_set(lua_State *L);
 
 
 #define RAW_FUNC(xxx)                       \
@@ -0,0 +1,166 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Stefano Trettel
+ *
+ * Software repository: MoonVulkan, https://github.com/stetre/moonvulkan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "internal.h"
+
+/* Multithreading utilities (NONVK).
+ *
+ * The functions passed to parallel_for() are executed in worker threads, so they 
+ * must not touch the Lua state, nor use Malloc() and Free() (which rely on the 
+ * Lua allocator and thus are not thread-safe).
+ */
+
+#if defined(LINUX)
+
+#include <pthread.h>
+#include <unistd.h>
+
+#define MAX_THREADS 64
+
+typedef struct {
+    parallel_func_t *func;
+    void *data;
+    unsigned count;
+    unsigned next; /* next index to be processed (atomically incremented) */
+} job_t;
+
+static void *worker(void *arg)
+    {
+    job_t *job = (job_t*)arg;
+    unsigned index;
+    while((index = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED)) < job->count)
+        job->func(job->data, index);
+    return NULL;
+    }
+
+unsigned ncpus(void)
+    {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (unsigned)n : 1;
+    }
+
+void parallel_for(unsigned nthreads, unsigned count, parallel_func_t *func, void *data)
+    {
+    unsigned i, n = 0;
+    pthread_t tid[MAX_THREADS];
+    job_t job;
+    job.func = func;
+    job.data = data;
+    job.count = count;
+    job.next = 0;
+    if(nthreads == 0) nthreads = ncpus();
+    if(nthreads > MAX_THREADS) nthreads = MAX_THREADS;
+    if(nthreads > count) nthreads = count;
+    /* the calling thread is one of the workers, so we spawn nthreads-1 threads
+     * (if a thread can not be created, the job is just done by fewer workers) */
+    for(i = 1; i < nthreads; i++)
+        {
+        if(pthread_create(&tid[n], NULL, worker, &job) == 0) n++;
+        }
+    worker(&job);
+    for(i = 0; i < n; i++)
+        pthread_join(tid[i], NULL);
+    }
+
+struct moonvulkan_task_s {
+    pthread_t tid;
+    unsigned nthreads;
+    unsigned count;
+    parallel_func_t *func;
+    void *data;
+    int threaded; /* 0 if the job was executed synchronously */
+    int done;
+};
+
+static void *taskmain(void *arg)
+    {
+    task_t *task = (task_t*)arg;
+    parallel_for(task->nthreads, task->count, task->func, task->data);
+    __atomic_store_n(&task->done, 1, __ATOMIC_RELEASE);
+    return NULL;
+    }
+
+task_t *task_start(unsigned nthreads, unsigned count, parallel_func_t *func, void *data)
+/* Executes parallel_for() in a background thread. Returns NULL if out of memory.
+ * The task must be eventually released with task_wait() */
+    {
+    task_t *task = (task_t*)malloc(sizeof(task_t));
+    if(!task) return NULL;
+    task->nthreads = nthreads;
+    task->count = count;
+    task->func = func;
+    task->data = data;
+    task->done = 0;
+    task->threaded = pthread_create(&task->tid, NULL, taskmain, task) == 0;
+    if(!task->threaded) /* no background thread, do it here */
+        taskmain(task);
+    return task;
+    }
+
+int task_done(task_t *task)
+    {
+    return __atomic_load_n(&task->done, __ATOMIC_ACQUIRE);
+    }
+
+void task_wait(task_t *task)
+    {
+    if(task->threaded)
+        pthread_join(task->tid, NULL);
+    free(task);
+    }
+
+#else /* no threads, execute sequentially */
+
+unsigned ncpus(void)
+    { return 1; }
+
+void parallel_for(unsigned nthreads, unsigned count, parallel_func_t *func, void *data)
+    {
+    unsigned i;
+    (void)nthreads;
+    for(i = 0; i < count; i++)
+        func(data, i);
+    }
+
+struct moonvulkan_task_s {
+    int done;
+};
+
+task_t *task_start(unsigned nthreads, unsigned count, parallel_func_t *func, void *data)
+    {
+    task_t *task = (task_t*)malloc(sizeof(task_t));
+    if(!task) return NULL;
+    parallel_for(nthreads, count, func, data);
+    task->done = 1;
+    return task;
+    }
+
+int task_done(task_t *task)
+    { return task->done; }
+
+void task_wait(task_t *task)
+    { free(task); }
+
+#endif
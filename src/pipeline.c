@@ -39,7 +39,7 @@ static int freepipeline(lua_State *L, ud_t *ud)
     return 0;
     }
 
-static int newpipeline(lua_State *L, VkPipeline  pipeline, VkDevice device, const VkAllocationCallbacks *allocator)
+static ud_t *newpipeline(lua_State *L, VkPipeline  pipeline, VkDevice device, const VkAllocationCallbacks *allocator)
     {
     ud_t *ud;
     TRACE_CREATE(pipeline, "pipeline");
@@ -50,41 +50,557 @@ static int newpipeline(lua_State *L, VkPipeline  pipeline, VkDevice device, cons
     ud->allocator = allocator;
     ud->destructor = freepipeline;
     ud->ddt = UD(device)->ddt;
+    return ud;
+    }
+
+/*------------------------------------------------------------------------------*
+ | Creation feedback (NONVK)                                                    |
+ *------------------------------------------------------------------------------*/
+
+/* When enabled on a device, a VkPipelineCreationFeedbackCreateInfoEXT is chained to
+ * each create info (unless the application already chained one), and the feedback
+ * is recorded, together with the wall-clock creation time, in the ud->info of the
+ * created pipeline.
+ */
+
+#define MAX_STAGES 8
+
+typedef struct {
+    VkPipelineCreationFeedbackCreateInfoEXT info; /* ours, if linked */
+    VkPipelineCreationFeedbackEXT pipeline;
+    VkPipelineCreationFeedbackEXT stages[MAX_STAGES];
+    const void **pnext; /* where info is linked (NULL if not linked) */
+    VkPipelineCreationFeedbackCreateInfoEXT *used; /* ours or the application's (NULL if none) */
+} fbslot_t;
+
+typedef struct {
+    double seconds; /* wall-clock time (of the whole vkCreateXxxPipelines call) */
+    VkPipelineCreationFeedbackEXT feedback;
+    uint32_t stage_count;
+    struct {
+        VkShaderStageFlagBits stage;
+        VkShaderModule shader_module;
+        VkPipelineCreationFeedbackEXT feedback;
+    } stages[MAX_STAGES];
+    int recorded; /* 1 if the fields above are set */
+    int refcount; /* > 0 if the pipeline is shared (see sharepipeline) */
+    int shared; /* SHARED_DEDUPED or SHARED_LINKED */
+} feedback_t;
+
+#define SHARED_DEDUPED  1
+#define SHARED_LINKED   2
+
+static VkPipelineCreationFeedbackCreateInfoEXT *findfeedback(const void *pnext)
+    {
+    const VkBaseInStructure *p = (const VkBaseInStructure*)pnext;
+    for( ; p != NULL; p = p->pNext)
+        {
+        if(p->sType == VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT)
+            return (VkPipelineCreationFeedbackCreateInfoEXT*)p;
+        }
+    return NULL;
+    }
+
+static fbslot_t *feedbackbegin(lua_State *L, ud_t *device_ud, uint32_t count, 
+            VkGraphicsPipelineCreateInfo *graphics, VkComputePipelineCreateInfo *compute)
+/* Links the feedback structs to the create infos, if feedback is enabled. 
+ * Returns the Malloc'd slots, or NULL if feedback is disabled. */
+    {
+    uint32_t i, stage_count;
+    fbslot_t *slot;
+    const void **pnext;
+    if(!DEVINFO(device_ud)->pipeline_feedback || count == 0) return NULL;
+    slot = (fbslot_t*)MallocNoErr(L, count*sizeof(fbslot_t));
+    if(!slot) return NULL; /* no feedback, no harm */
+    for(i = 0; i < count; i++)
+        {
+        pnext = compute ? &compute[i].pNext : &graphics[i].pNext;
+        stage_count = compute ? 1 : graphics[i].stageCount;
+        slot[i].used = findfeedback(*pnext);
+        if(slot[i].used || stage_count > MAX_STAGES) continue;
+        slot[i].info.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT;
+        slot[i].info.pNext = *pnext;
+        slot[i].info.pPipelineCreationFeedback = &slot[i].pipeline;
+        slot[i].info.pipelineStageCreationFeedbackCount = stage_count;
+        slot[i].info.pPipelineStageCreationFeedbacks = slot[i].stages;
+        *pnext = &slot[i].info;
+        slot[i].pnext = pnext;
+        slot[i].used = &slot[i].info;
+        }
+    return slot;
+    }
+
+static void feedbackend(lua_State *L, fbslot_t *slot, uint32_t count)
+/* Unlinks the feedback structs (this must be done before freeing the create infos) */
+    {
+    uint32_t i;
+    if(!slot) return;
+    for(i = 0; i < count; i++)
+        if(slot[i].pnext) *(slot[i].pnext) = slot[i].info.pNext;
+    Free(L, slot);
+    }
+
+static void feedbackrecord(lua_State *L, ud_t *ud, fbslot_t *slot, double seconds,
+            VkGraphicsPipelineCreateInfo *graphics, VkComputePipelineCreateInfo *compute)
+    {
+    uint32_t j;
+    feedback_t *fb;
+    VkPipelineCreationFeedbackCreateInfoEXT *used = slot->used;
+    if(!used) return;
+    fb = ud->info ? (feedback_t*)ud->info : (feedback_t*)MallocNoErr(L, sizeof(feedback_t));
+    if(!fb) return;
+    fb->recorded = 1;
+    fb->seconds = seconds;
+    fb->feedback = *(used->pPipelineCreationFeedback);
+    fb->stage_count = used->pipelineStageCreationFeedbackCount;
+    if(fb->stage_count > MAX_STAGES) fb->stage_count = MAX_STAGES;
+    for(j = 0; j < fb->stage_count; j++)
+        {
+        const VkPipelineShaderStageCreateInfo *stage = compute ? &compute->stage : &graphics->pStages[j];
+        fb->stages[j].stage = stage->stage;
+        fb->stages[j].shader_module = stage->module;
+        fb->stages[j].feedback = used->pPipelineStageCreationFeedbacks[j];
+        }
+    ud->info = fb;
+    }
+
+static int sharepipeline(lua_State *L, ud_t *ud, int shared, int key)
+/* Marks the pipeline as shared, with a reference count of 1, by the cache selected
+ * by 'shared' under the key at the given index. Returns 0 if out of memory, in which
+ * case the pipeline must not be added to the cache.
+ */
+    {
+    feedback_t *fb = (feedback_t*)ud->info;
+    if(!fb)
+        {
+        fb = (feedback_t*)MallocNoErr(L, sizeof(feedback_t));
+        if(!fb) return 0;
+        ud->info = fb;
+        }
+    fb->refcount = 1;
+    fb->shared = shared;
+    lua_pushvalue(L, key);
+    ud->ref1 = luaL_ref(L, LUA_REGISTRYINDEX);
+    return 1;
+    }
+
+static void refpipeline(ud_t *ud)
+/* Adds a reference to a shared pipeline */
+    {
+    feedback_t *fb = (feedback_t*)ud->info;
+    if(fb && fb->refcount > 0) fb->refcount++;
+    }
+
+static void pushfeedback(lua_State *L, VkPipelineCreationFeedbackEXT *feedback)
+/* adds the feedback fields to the table on top of the stack */
+    {
+    lua_pushboolean(L, (feedback->flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT) != 0);
+    lua_setfield(L, -2, "valid");
+    lua_pushboolean(L, (feedback->flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT_EXT) != 0);
+    lua_setfield(L, -2, "cache_hit");
+    lua_pushboolean(L, (feedback->flags & VK_PIPELINE_CREATION_FEEDBACK_BASE_PIPELINE_ACCELERATION_BIT_EXT) != 0);
+    lua_setfield(L, -2, "base_pipeline_acceleration");
+    lua_pushnumber(L, feedback->duration * 1.0e-9);
+    lua_setfield(L, -2, "duration");
+    }
+
+static void pushstagefeedback(lua_State *L, ud_t *device_ud, feedback_t *fb, uint32_t j)
+    {
+    lua_newtable(L);
+    pushflags(L, fb->stages[j].stage);
+    lua_setfield(L, -2, "stage");
+    if(pushnondispatchable(L, (uint64_t)fb->stages[j].shader_module, device_ud, SHADER_MODULE_MT))
+        lua_setfield(L, -2, "shader_module");
+    pushfeedback(L, &fb->stages[j].feedback);
+    }
+
+static int EnablePipelineFeedback(lua_State *L)
+    {
+    ud_t *device_ud;
+    int enable;
+    (void)checkdevice(L, 1, &device_ud);
+    enable = lua_isnoneornil(L, 2) || lua_toboolean(L, 2);
+    /* the feedback struct may be chained only if the extension is enabled */
+    if(enable && !DEVINFO(device_ud)->creation_feedback)
+        return luaL_error(L, VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME" is not enabled");
+    DEVINFO(device_ud)->pipeline_feedback = enable;
+    return 0;
+    }
+
+static int GetPipelineFeedback(lua_State *L)
+    {
+    uint32_t j;
+    ud_t *ud;
+    feedback_t *fb;
+    (void)checkpipeline(L, 1, &ud);
+    fb = (feedback_t*)ud->info;
+    if(!fb || !fb->recorded) return 0;
+    lua_newtable(L);
+    lua_pushnumber(L, fb->seconds);
+    lua_setfield(L, -2, "seconds");
+    pushfeedback(L, &fb->feedback);
+    lua_newtable(L);
+    for(j = 0; j < fb->stage_count; j++)
+        {
+        pushstagefeedback(L, ud->parent_ud, fb, j);
+        lua_rawseti(L, -2, j+1);
+        }
+    lua_setfield(L, -2, "stages");
+    return 1;
+    }
+
+typedef struct {
+    ud_t *device_ud;
+    ud_t **ud; /* NULL while counting */
+    size_t count;
+} collect_t;
+
+static int collect(lua_State *L, const void *mem, const char *mt, const void *info)
+/* callback for udata_scan: collects the pipelines of a device that have feedback */
+    {
+    ud_t *ud = (ud_t*)mem;
+    collect_t *c = (collect_t*)info;
+    (void)L; (void)mt;
+    if(IsValid(ud) && ud->parent_ud == c->device_ud && ud->info && ((feedback_t*)ud->info)->recorded)
+        {
+        if(c->ud) c->ud[c->count] = ud;
+        c->count++;
+        }
+    return 0;
+    }
+
+static double pipelinecost(const feedback_t *fb)
+/* the driver's duration, if valid, or the measured time */
+    {
+    if(fb->feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT)
+        return fb->feedback.duration * 1.0e-9;
+    return fb->seconds;
+    }
+
+static int cmppipelines(const void *a, const void *b)
+    {
+    double ca = pipelinecost((feedback_t*)(*(ud_t**)a)->info);
+    double cb = pipelinecost((feedback_t*)(*(ud_t**)b)->info);
+    return ca < cb ? 1 : (ca > cb ? -1 : 0);
+    }
+
+typedef struct {
+    feedback_t *fb;
+    uint32_t j;
+} stageref_t;
+
+static int cmpstages(const void *a, const void *b)
+    {
+    const stageref_t *sa = (const stageref_t*)a, *sb = (const stageref_t*)b;
+    uint64_t da = sa->fb->stages[sa->j].feedback.duration;
+    uint64_t db = sb->fb->stages[sb->j].feedback.duration;
+    return da < db ? 1 : (da > db ? -1 : 0);
+    }
+
+static int PipelineFeedbackReport(lua_State *L)
+    {
+    size_t i, nstages, hits = 0;
+    uint32_t j;
+    double seconds = 0, duration = 0;
+    feedback_t *fb;
+    collect_t c;
+    stageref_t *stages;
+    ud_t *device_ud;
+    lua_Integer n;
+    (void)checkdevice(L, 1, &device_ud);
+    n = luaL_optinteger(L, 2, 10);
+    c.device_ud = device_ud;
+    c.ud = NULL;
+    c.count = 0;
+    udata_scan(L, PIPELINE_MT, &c, collect);
+    c.ud = (ud_t**)Malloc(L, (c.count+1)*sizeof(ud_t*));
+    c.count = 0;
+    udata_scan(L, PIPELINE_MT, &c, collect);
+    nstages = 0;
+    for(i = 0; i < c.count; i++)
+        {
+        fb = (feedback_t*)c.ud[i]->info;
+        seconds += fb->seconds;
+        duration += pipelinecost(fb);
+        if(fb->feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT_EXT) hits++;
+        nstages += fb->stage_count;
+        }
+    stages = (stageref_t*)MallocNoErr(L, (nstages+1)*sizeof(stageref_t));
+    if(!stages) { Free(L, c.ud); return errmemory(L); }
+    nstages = 0;
+    for(i = 0; i < c.count; i++)
+        {
+        fb = (feedback_t*)c.ud[i]->info;
+        for(j = 0; j < fb->stage_count; j++)
+            {
+            if(!(fb->stages[j].feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT)) continue;
+            stages[nstages].fb = fb;
+            stages[nstages].j = j;
+            nstages++;
+            }
+        }
+    qsort(c.ud, c.count, sizeof(ud_t*), cmppipelines);
+    qsort(stages, nstages, sizeof(stageref_t), cmpstages);
+
+    lua_newtable(L);
+    lua_pushinteger(L, c.count);
+    lua_setfield(L, -2, "pipelines");
+    lua_pushnumber(L, seconds);
+    lua_setfield(L, -2, "seconds");
+    lua_pushnumber(L, duration);
+    lua_setfield(L, -2, "duration");
+    lua_pushinteger(L, hits);
+    lua_setfield(L, -2, "cache_hits");
+    lua_pushnumber(L, c.count > 0 ? (double)hits/c.count : 0);
+    lua_setfield(L, -2, "cache_hit_rate");
+    lua_newtable(L);
+    for(i = 0; i < c.count && (lua_Integer)i < n; i++)
+        {
+        lua_newtable(L);
+        pushuserdata(L, c.ud[i]);
+        lua_setfield(L, -2, "pipeline");
+        lua_pushnumber(L, pipelinecost((feedback_t*)c.ud[i]->info));
+        lua_setfield(L, -2, "duration");
+        lua_rawseti(L, -2, i+1);
+        }
+    lua_setfield(L, -2, "slowest_pipelines");
+    lua_newtable(L);
+    for(i = 0; i < nstages && (lua_Integer)i < n; i++)
+        {
+        pushstagefeedback(L, device_ud, stages[i].fb, stages[i].j);
+        lua_rawseti(L, -2, i+1);
+        }
+    lua_setfield(L, -2, "slowest_shaders");
+    Free(L, stages);
+    Free(L, c.ud);
     return 1;
     }
 
 
+/*------------------------------------------------------------------------------*
+ | Deduplication (NONVK)                                                        |
+ *------------------------------------------------------------------------------*/
+
+/* When enabled on a device, create_graphics/compute_pipelines() look up each create info
+ * in a device-level map before converting it, and return the existing pipeline on a hit.
+ * The key is a canonical serialization of the create info table (see pushinfokey() in
+ * utils.c), so equal keys mean identical create infos and no further comparison is needed.
+ * Each entry holds the pipeline and the objects referenced by its create info, so that
+ * their userdata (that identify them in the key) can not be recycled while the entry exists.
+ */
+
+static int CreateDeduped(lua_State *L, int compute)
+/* create_xxx_pipelines() with dedupe enabled */
+    {
+    int err;
+    uint32_t count, i, j, n, hits, misses;
+    int map, results, missed, keys, dups;
+    VkResult ec;
+    VkPipeline *pipeline = NULL;
+    VkGraphicsPipelineCreateInfo *graphics = NULL;
+    VkComputePipelineCreateInfo *compute_info = NULL;
+    fbslot_t *feedback = NULL;
+    double t;
+    ud_t *ud, *device_ud;
+    devinfo_t *devinfo;
+    VkDevice device = checkdevice(L, 1, &device_ud);
+    VkPipelineCache cache = testpipeline_cache(L, 2, NULL);
+    const VkAllocationCallbacks *allocator = optallocator(L, 4);
+    devinfo = DEVINFO(device_ud);
+    luaL_checktype(L, 3, LUA_TTABLE);
+    n = (uint32_t)lua_rawlen(L, 3);
+    lua_settop(L, 4);
+    lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->pipeline_map);
+    map = lua_gettop(L);
+    lua_newtable(L); results = lua_gettop(L);
+    lua_newtable(L); missed = lua_gettop(L); /* create infos not found in the map */
+    lua_newtable(L); keys = lua_gettop(L); /* keys and refs of missed create infos, and key -> i */
+    lua_newtable(L); dups = lua_gettop(L); /* i -> first element with the same (missed) key */
+    count = hits = misses = 0;
+    for(i = 1; i <= n; i++)
+        {
+        lua_rawgeti(L, 3, i);
+        /* derivatives refer to other elements by index, so they are not deduplicated */
+        if(!lua_istable(L, -1) || lua_getfield(L, -1, "base_pipeline_index") != LUA_TNIL ||
+                pushinfokey(L, lua_gettop(L) - 1, compute ? "C" : "G", allocator) != 0)
+            { lua_settop(L, 4); return 0; } /* not dedupable, create them as usual */
+        lua_pushvalue(L, -2); /* key */
+        if(lua_rawget(L, map) == LUA_TTABLE && lua_rawgeti(L, -1, 0) && testpipeline(L, -1, &ud))
+            { /* hit */
+            refpipeline(ud);
+            lua_rawseti(L, results, i);
+            lua_settop(L, dups);
+            hits++;
+            continue;
+            }
+        lua_settop(L, dups + 4); /* info, base_pipeline_index, key, refs */
+        lua_pushvalue(L, dups + 3);
+        if(lua_rawget(L, keys) == LUA_TNUMBER)
+            { /* same as a previous element of this call */
+            lua_rawseti(L, dups, i);
+            lua_settop(L, dups);
+            hits++;
+            continue;
+            }
+        lua_pop(L, 1);
+        lua_pushvalue(L, dups + 3);
+        lua_pushinteger(L, i);
+        lua_rawset(L, keys); /* keys[key] = i */
+        lua_rawseti(L, keys, 2*i);
+        lua_rawseti(L, keys, 2*i - 1);
+        lua_pop(L, 1);
+        lua_rawseti(L, missed, ++count);
+        misses++;
+        }
+    /* count the lookups only now that the elements are known to be dedupable */
+    devinfo->pipeline_hits += hits;
+    devinfo->pipeline_misses += misses;
+    if(count == 0) { lua_pushvalue(L, results); return 1; }
+
+#define CLEANUP do {                                                                    \
+    feedbackend(L, feedback, count);                                                    \
+    if(compute) zfreearrayVkComputePipelineCreateInfo(L, compute_info, count, 1);       \
+    else zfreearrayVkGraphicsPipelineCreateInfo(L, graphics, count, 1);                 \
+    if(pipeline) Free(L, pipeline);                                                     \
+} while(0)
+    if(compute)
+        compute_info = zcheckarrayVkComputePipelineCreateInfo(L, missed, &count, &err);
+    else
+        graphics = zcheckarrayVkGraphicsPipelineCreateInfo(L, missed, &count, &err);
+    if(err) { CLEANUP; return argerror(L, 3); }
+    pipeline = (VkPipeline*)MallocNoErr(L, count*sizeof(VkPipeline));
+    if(!pipeline) { CLEANUP; return errmemory(L); }
+    feedback = feedbackbegin(L, device_ud, count, graphics, compute_info);
+    t = now();
+    if(compute)
+        ec = device_ud->ddt->CreateComputePipelines(device, cache, count, compute_info, allocator, pipeline);
+    else
+        ec = device_ud->ddt->CreateGraphicsPipelines(device, cache, count, graphics, allocator, pipeline);
+    t = since(t);
+    if(ec) { CLEANUP; CheckError(L, ec); }
+    j = 0;
+    for(i = 1; i <= n; i++)
+        {
+        if(lua_rawgeti(L, keys, 2*i - 1) == LUA_TNIL) { lua_pop(L, 1); continue; } /* hit */
+        lua_rawgeti(L, keys, 2*i); /* refs */
+        ud = newpipeline(L, pipeline[j], device, allocator);
+        if(feedback)
+            feedbackrecord(L, ud, &feedback[j], t, graphics ? &graphics[j] : NULL, compute_info ? &compute_info[j] : NULL);
+        j++;
+        lua_pushvalue(L, -1);
+        lua_rawseti(L, results, i);
+        if(!sharepipeline(L, ud, SHARED_DEDUPED, -3))
+            { lua_pop(L, 3); continue; } /* out of memory: not cached */
+        lua_rawseti(L, -2, 0); /* refs[0] = pipeline, so refs is the entry */
+        lua_rawset(L, map); /* map[key] = entry */
+        }
+    for(i = 1; i <= n; i++)
+        {
+        if(lua_rawgeti(L, dups, i) == LUA_TNUMBER)
+            {
+            lua_rawgeti(L, results, (lua_Integer)lua_tointeger(L, -1));
+            if(testpipeline(L, -1, &ud)) refpipeline(ud);
+            lua_rawseti(L, results, i);
+            }
+        lua_pop(L, 1);
+        }
+    CLEANUP;
+#undef CLEANUP
+    lua_pushvalue(L, results);
+    return 1;
+    }
+
+static int EnablePipelineDedupe(lua_State *L)
+    {
+    ud_t *device_ud;
+    devinfo_t *devinfo;
+    (void)checkdevice(L, 1, &device_ud);
+    devinfo = DEVINFO(device_ud);
+    if(lua_isnoneornil(L, 2) || lua_toboolean(L, 2))
+        {
+        if(devinfo->pipeline_map == LUA_NOREF)
+            {
+            lua_newtable(L);
+            devinfo->pipeline_map = luaL_ref(L, LUA_REGISTRYINDEX);
+            }
+        }
+    else /* disable, and release the map */
+        Unreference(L, devinfo->pipeline_map);
+    return 0;
+    }
+
+static int PipelineDedupeStats(lua_State *L)
+    {
+    ud_t *device_ud;
+    devinfo_t *devinfo;
+    lua_Integer entries = 0;
+    (void)checkdevice(L, 1, &device_ud);
+    devinfo = DEVINFO(device_ud);
+    if(devinfo->pipeline_map != LUA_NOREF)
+        {
+        lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->pipeline_map);
+        lua_pushnil(L);
+        while(lua_next(L, -2) != 0)
+            {
+            lua_rawgeti(L, -1, 0);
+            if(testpipeline(L, -1, NULL)) entries++;
+            lua_pop(L, 2);
+            }
+        lua_pop(L, 1);
+        }
+    lua_newtable(L);
+    lua_pushinteger(L, devinfo->pipeline_hits); lua_setfield(L, -2, "hits");
+    lua_pushinteger(L, devinfo->pipeline_misses); lua_setfield(L, -2, "misses");
+    lua_pushinteger(L, entries); lua_setfield(L, -2, "entries");
+    return 1;
+    }
+
 static int CreateGraphics(lua_State *L)
     {
     int err;
     uint32_t count, i;
     VkResult ec;
     VkPipeline *pipeline;
-
-    VkDevice device = checkdevice(L, 1, NULL);
-    VkPipelineCache cache = testpipeline_cache(L, 2, NULL);
-    const VkAllocationCallbacks *allocator = optallocator(L, 4);
+    fbslot_t *feedback;
+    double t;
+    VkDevice device;
+    VkPipelineCache cache;
+    const VkAllocationCallbacks *allocator;
+    VkGraphicsPipelineCreateInfo *info;
+    ud_t *ud, *device_ud;
+    device = checkdevice(L, 1, &device_ud);
+    if(DEVINFO(device_ud)->pipeline_map != LUA_NOREF && CreateDeduped(L, 0))
+        return 1;
+    cache = testpipeline_cache(L, 2, NULL);
+    allocator = optallocator(L, 4);
 #define CLEANUP zfreearrayVkGraphicsPipelineCreateInfo(L, info, count, 1)
-    VkGraphicsPipelineCreateInfo *info = zcheckarrayVkGraphicsPipelineCreateInfo(L, 3, &count, &err);
+    info = zcheckarrayVkGraphicsPipelineCreateInfo(L, 3, &count, &err);
     if(err) { CLEANUP; return argerror(L, 3); }
 
     pipeline = (VkPipeline*)MallocNoErr(L, count*sizeof(VkPipeline));
     if(!pipeline) { CLEANUP; return errmemory(L); }
 
+    feedback = feedbackbegin(L, device_ud, count, info, NULL);
+    t = now();
     ec = UD(device)->ddt->CreateGraphicsPipelines(device, cache, count, info, allocator, pipeline);
-    CLEANUP;
-#undef CLEANUP
+    t = since(t);
     if(ec)
         {
+        feedbackend(L, feedback, count);
+        CLEANUP;
         Free(L, pipeline);
         CheckError(L, ec);
         }
     lua_newtable(L);
     for(i = 0; i < count; i++)
         {
-        newpipeline(L, pipeline[i], device, allocator);
+        ud = newpipeline(L, pipeline[i], device, allocator);
+        if(feedback) feedbackrecord(L, ud, &feedback[i], t, &info[i], NULL);
         lua_rawseti(L, -2, i+1);
         }
+    feedbackend(L, feedback, count);
+    CLEANUP;
+#undef CLEANUP
     Free(L, pipeline);
     return 1;
     }
@@ -95,37 +611,523 @@ static int CreateCompute(lua_State *L)
     uint32_t count, i;
     VkResult ec;
     VkPipeline *pipeline;
-
-    VkDevice device = checkdevice(L, 1, NULL);
-    VkPipelineCache cache = testpipeline_cache(L, 2, NULL);
-    const VkAllocationCallbacks *allocator = optallocator(L, 4);
+    fbslot_t *feedback;
+    double t;
+    VkDevice device;
+    VkPipelineCache cache;
+    const VkAllocationCallbacks *allocator;
+    VkComputePipelineCreateInfo *info;
+    ud_t *ud, *device_ud;
+    device = checkdevice(L, 1, &device_ud);
+    if(DEVINFO(device_ud)->pipeline_map != LUA_NOREF && CreateDeduped(L, 1))
+        return 1;
+    cache = testpipeline_cache(L, 2, NULL);
+    allocator = optallocator(L, 4);
 #define CLEANUP zfreearrayVkComputePipelineCreateInfo(L, info, count, 1)
-    VkComputePipelineCreateInfo *info = zcheckarrayVkComputePipelineCreateInfo(L, 3, &count, &err);
+    info = zcheckarrayVkComputePipelineCreateInfo(L, 3, &count, &err);
     if(err) { CLEANUP; return argerror(L, 3); }
 
     pipeline = (VkPipeline*)MallocNoErr(L, count*sizeof(VkPipeline));
     if(!pipeline) { CLEANUP; return errmemory(L); }
 
+    feedback = feedbackbegin(L, device_ud, count, NULL, info);
+    t = now();
     ec = UD(device)->ddt->CreateComputePipelines(device, cache, count, info, allocator, pipeline);
-    CLEANUP;
-#undef CLEANUP
-
+    t = since(t);
     if(ec)
         {
+        feedbackend(L, feedback, count);
+        CLEANUP;
         Free(L, pipeline);
         CheckError(L, ec);
         }
     lua_newtable(L);
     for(i = 0; i < count; i++)
         {
-        newpipeline(L, pipeline[i], device, allocator);
+        ud = newpipeline(L, pipeline[i], device, allocator);
+        if(feedback) feedbackrecord(L, ud, &feedback[i], t, NULL, &info[i]);
         lua_rawseti(L, -2, i+1);
         }
+    feedbackend(L, feedback, count);
+    CLEANUP;
+#undef CLEANUP
     Free(L, pipeline);
     return 1;
     }
 
 
+/*------------------------------------------------------------------------------*
+ | Pipeline libraries                                                           |
+ *------------------------------------------------------------------------------*/
+
+#if defined(VK_EXT_graphics_pipeline_library)
+static int CreateLibrary(lua_State *L)
+/* Creates a pipeline library with the given parts (VkGraphicsPipelineLibraryFlagsEXT) */
+    {
+    int err;
+    VkResult ec;
+    VkPipeline pipeline;
+    VkGraphicsPipelineLibraryCreateInfoEXT libinfo;
+    VkGraphicsPipelineCreateInfo *info;
+    ud_t *device_ud;
+    VkDevice device = checkdevice(L, 1, &device_ud);
+    VkPipelineCache cache = testpipeline_cache(L, 2, NULL);
+    VkGraphicsPipelineLibraryFlagsEXT parts = checkflags(L, 3);
+    const VkAllocationCallbacks *allocator = optallocator(L, 5);
+    VkPipelineCreateFlags flags;
+    luaL_checktype(L, 4, LUA_TTABLE);
+    lua_settop(L, 5);
+    /* Convert a copy of the create info with the library flags added, so that the
+     * checker relaxes the requirements that do not apply to library parts */
+    lua_newtable(L);
+    lua_pushnil(L);
+    while(lua_next(L, 4) != 0)
+        {
+        lua_pushvalue(L, -2);
+        lua_insert(L, -2);
+        lua_rawset(L, 6);
+        }
+    lua_getfield(L, 4, "flags");
+    flags = (VkPipelineCreateFlags)optflags(L, -1, 0);
+    lua_pop(L, 1);
+    flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+    pushflags(L, flags);
+    lua_setfield(L, 6, "flags");
+#define CLEANUP zfreeVkGraphicsPipelineCreateInfo(L, info, 1)
+    info = zcheckVkGraphicsPipelineCreateInfo(L, 6, &err);
+    if(err) { CLEANUP; return argerror(L, 4); }
+    memset(&libinfo, 0, sizeof(libinfo));
+    libinfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+    libinfo.pNext = (void*)info->pNext;
+    libinfo.flags = parts;
+    info->pNext = &libinfo;
+    ec = device_ud->ddt->CreateGraphicsPipelines(device, cache, 1, info, allocator, &pipeline);
+    info->pNext = libinfo.pNext;
+    CLEANUP;
+#undef CLEANUP
+    CheckError(L, ec);
+    newpipeline(L, pipeline, device, allocator);
+    return 1;
+    }
+#else
+static int CreateLibrary(lua_State *L)
+    { return notavailable(L); }
+#endif
+
+/* Linked pipelines are cached in a device-level map, keyed by the libraries, the layout,
+ * the flags and the allocator, so that a combination is linked only once. As in the
+ * deduplication map, the objects are identified in the key by their userdata, and each
+ * entry holds the pipeline (at index 0), the libraries and the layout, so that their
+ * userdata can not be recycled while the entry exists. Linked pipelines are shared, and
+ * reference counted as deduplicated ones (see sharepipeline). */
+
+static int LinkLibraries(lua_State *L)
+    {
+    uint32_t i, count;
+    VkResult ec;
+    VkPipeline pipeline, *libraries;
+    VkPipelineLibraryCreateInfoKHR libinfo;
+    VkGraphicsPipelineCreateInfo info;
+    ud_t *ud, *device_ud;
+    devinfo_t *devinfo;
+    int map;
+    void *id;
+    char *key;
+    size_t keysize;
+    VkDevice device = checkdevice(L, 1, &device_ud);
+    VkPipelineCache cache = testpipeline_cache(L, 2, NULL);
+    VkPipelineLayout layout = testpipeline_layout(L, 4, NULL);
+    VkPipelineCreateFlags flags = optflags(L, 5, 0);
+    const VkAllocationCallbacks *allocator = optallocator(L, 6);
+    devinfo = DEVINFO(device_ud);
+    luaL_checktype(L, 3, LUA_TTABLE);
+    count = (uint32_t)lua_rawlen(L, 3);
+    if(count == 0) return argerrorc(L, 3, ERR_EMPTY);
+    lua_settop(L, 6);
+    if(devinfo->link_map == LUA_NOREF)
+        {
+        lua_newtable(L);
+        devinfo->link_map = luaL_ref(L, LUA_REGISTRYINDEX);
+        }
+    lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->link_map);
+    map = lua_gettop(L);
+    /* entry = { libraries..., layout = layout }, key = libraries, layout, flags, allocator */
+    lua_newtable(L);
+    keysize = (count+1)*sizeof(void*) + sizeof(flags) + sizeof(allocator);
+    libraries = (VkPipeline*)Malloc(L, count*sizeof(VkPipeline) + keysize);
+    key = (char*)(libraries + count);
+    for(i = 0; i < count; i++)
+        {
+        lua_rawgeti(L, 3, i+1);
+        libraries[i] = testpipeline(L, -1, NULL);
+        if(!libraries[i]) { Free(L, libraries); return argerrorc(L, 3, ERR_TYPE); }
+        id = lua_touserdata(L, -1);
+        memcpy(key + i*sizeof(void*), &id, sizeof(void*));
+        lua_rawseti(L, map + 1, i+1);
+        }
+    id = layout ? lua_touserdata(L, 4) : NULL;
+    memcpy(key + count*sizeof(void*), &id, sizeof(void*));
+    memcpy(key + (count+1)*sizeof(void*), &flags, sizeof(flags));
+    memcpy(key + (count+1)*sizeof(void*) + sizeof(flags), &allocator, sizeof(allocator));
+    if(layout)
+        {
+        lua_pushvalue(L, 4);
+        lua_setfield(L, map + 1, "layout");
+        }
+    lua_pushlstring(L, key, keysize);
+    lua_pushvalue(L, -1);
+    if(lua_rawget(L, map) == LUA_TTABLE && lua_rawgeti(L, -1, 0) && testpipeline(L, -1, &ud))
+        { /* already linked */
+        Free(L, libraries);
+        refpipeline(ud);
+        devinfo->link_hits++;
+        return 1;
+        }
+    lua_settop(L, map + 2); /* map, entry, key */
+    devinfo->link_misses++;
+    memset(&libinfo, 0, sizeof(libinfo));
+    libinfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    libinfo.libraryCount = count;
+    libinfo.pLibraries = libraries;
+    memset(&info, 0, sizeof(info));
+    info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    info.pNext = &libinfo;
+    info.flags = flags;
+    info.layout = layout;
+    info.basePipelineIndex = -1;
+    ec = device_ud->ddt->CreateGraphicsPipelines(device, cache, 1, &info, allocator, &pipeline);
+    Free(L, libraries);
+    CheckError(L, ec);
+    ud = newpipeline(L, pipeline, device, allocator);
+    if(!sharepipeline(L, ud, SHARED_LINKED, map + 2))
+        return 1; /* out of memory: not cached */
+    lua_pushvalue(L, -1);
+    lua_rawseti(L, map + 1, 0);
+    lua_insert(L, -3); /* pipeline, entry, key */
+    lua_insert(L, -2); /* pipeline, key, entry */
+    lua_rawset(L, map);
+    return 1;
+    }
+
+static int LinkCacheStats(lua_State *L)
+    {
+    ud_t *device_ud;
+    devinfo_t *devinfo;
+    (void)checkdevice(L, 1, &device_ud);
+    devinfo = DEVINFO(device_ud);
+    lua_newtable(L);
+    lua_pushinteger(L, devinfo->link_hits); lua_setfield(L, -2, "hits");
+    lua_pushinteger(L, devinfo->link_misses); lua_setfield(L, -2, "misses");
+    return 1;
+    }
+
+static int ClearLinkCache(lua_State *L)
+    {
+    ud_t *device_ud;
+    (void)checkdevice(L, 1, &device_ud);
+    Unreference(L, DEVINFO(device_ud)->link_map);
+    return 0;
+    }
+
+/*------------------------------------------------------------------------------*
+ | Parallel and asynchronous creation (NONVK)                                   |
+ *------------------------------------------------------------------------------*/
+
+/* The create infos are converted up front on the Lua thread, then each pipeline
+ * is created with a separate vkCreateXxxPipelines() call on one of the worker
+ * threads, all sharing the same pipeline cache (which is internally synchronized).
+ * The worker threads only touch the batch arrays, which are allocated and freed
+ * on the Lua thread.
+ */
+
+typedef struct {
+    ud_t *device_ud;
+    VkPipelineCache cache;
+    const VkAllocationCallbacks *allocator;
+    int compute;
+    uint32_t count;
+    unsigned nthreads;
+    VkGraphicsPipelineCreateInfo *graphics; /* either this ... */
+    VkComputePipelineCreateInfo *compute_info; /* ... or this */
+    VkPipeline *pipeline;
+    VkResult *result;
+    double *time;
+    fbslot_t *feedback;
+    task_t *task; /* async only */
+} batch_t;
+
+static void createone(void *data, unsigned i)
+    {
+    batch_t *batch = (batch_t*)data;
+    ud_t *device_ud = batch->device_ud;
+    double t = now();
+    if(batch->compute)
+        batch->result[i] = device_ud->ddt->CreateComputePipelines(device_ud->device, batch->cache, 
+                    1, &batch->compute_info[i], batch->allocator, &batch->pipeline[i]);
+    else
+        batch->result[i] = device_ud->ddt->CreateGraphicsPipelines(device_ud->device, batch->cache, 
+                    1, &batch->graphics[i], batch->allocator, &batch->pipeline[i]);
+    batch->time[i] = since(t);
+    }
+
+static void freebatch(lua_State *L, batch_t *batch)
+    {
+    feedbackend(L, batch->feedback, batch->count);
+    if(batch->compute)
+        zfreearrayVkComputePipelineCreateInfo(L, batch->compute_info, batch->count, 1);
+    else
+        zfreearrayVkGraphicsPipelineCreateInfo(L, batch->graphics, batch->count, 1);
+    if(batch->pipeline) Free(L, batch->pipeline);
+    if(batch->result) Free(L, batch->result);
+    if(batch->time) Free(L, batch->time);
+    memset(batch, 0, sizeof(batch_t));
+    }
+
+static int derivative(batch_t *batch)
+/* Returns 1 if any create info refers to a base pipeline by index. Since each pipeline
+ * is created with a separate call, the index would refer to an element of that call. */
+    {
+    uint32_t i;
+    for(i = 0; i < batch->count; i++)
+        {
+        if((batch->compute ? batch->compute_info[i].basePipelineIndex : batch->graphics[i].basePipelineIndex) >= 0)
+            return 1;
+        }
+    return 0;
+    }
+
+static void checkbatch(lua_State *L, batch_t *batch, int compute)
+/* device, [pipeline_cache], {createinfo}, [allocator], [threads] */
+    {
+    int err;
+    ud_t *device_ud;
+    memset(batch, 0, sizeof(batch_t));
+    (void)checkdevice(L, 1, &device_ud);
+    batch->device_ud = device_ud;
+    batch->cache = testpipeline_cache(L, 2, NULL);
+    batch->allocator = optallocator(L, 4);
+    batch->nthreads = luaL_optinteger(L, 5, 0);
+    batch->compute = compute;
+    if(compute)
+        batch->compute_info = zcheckarrayVkComputePipelineCreateInfo(L, 3, &batch->count, &err);
+    else
+        batch->graphics = zcheckarrayVkGraphicsPipelineCreateInfo(L, 3, &batch->count, &err);
+    if(err) { freebatch(L, batch); argerror(L, 3); return; }
+    if(derivative(batch)) { freebatch(L, batch); argerrorc(L, 3, ERR_VALUE); return; }
+    batch->pipeline = (VkPipeline*)MallocNoErr(L, batch->count*sizeof(VkPipeline));
+    batch->result = (VkResult*)MallocNoErr(L, batch->count*sizeof(VkResult));
+    batch->time = (double*)MallocNoErr(L, batch->count*sizeof(double));
+    if(!batch->pipeline || !batch->result || !batch->time) { freebatch(L, batch); errmemory(L); }
+    batch->feedback = feedbackbegin(L, device_ud, batch->count, batch->graphics, batch->compute_info);
+    }
+
+static int pushbatch(lua_State *L, batch_t *batch)
+/* Pushes the created pipelines and their creation times, and frees the batch.
+ * If any creation failed, destroys the others and raises the first error. */
+    {
+    uint32_t i;
+    VkResult ec = VK_SUCCESS;
+    ud_t *ud, *device_ud = batch->device_ud;
+    VkDevice device = device_ud->device;
+    for(i = 0; i < batch->count; i++)
+        if(batch->result[i] != VK_SUCCESS) { ec = batch->result[i]; break; }
+    if(ec)
+        {
+        for(i = 0; i < batch->count; i++)
+            {
+            if(batch->result[i] == VK_SUCCESS)
+                device_ud->ddt->DestroyPipeline(device, batch->pipeline[i], batch->allocator);
+            }
+        freebatch(L, batch);
+        CheckError(L, ec);
+        }
+    lua_newtable(L);
+    for(i = 0; i < batch->count; i++)
+        {
+        ud = newpipeline(L, batch->pipeline[i], device, batch->allocator);
+        if(batch->feedback)
+            feedbackrecord(L, ud, &batch->feedback[i], batch->time[i], 
+                batch->graphics ? &batch->graphics[i] : NULL, batch->compute_info ? &batch->compute_info[i] : NULL);
+        lua_rawseti(L, -2, i+1);
+        }
+    lua_newtable(L);
+    for(i = 0; i < batch->count; i++)
+        {
+        lua_pushnumber(L, batch->time[i]);
+        lua_rawseti(L, -2, i+1);
+        }
+    freebatch(L, batch);
+    return 2;
+    }
+
+static int CreateParallel(lua_State *L, int compute)
+    {
+    batch_t batch;
+    checkbatch(L, &batch, compute);
+    parallel_for(batch.nthreads, batch.count, createone, &batch);
+    return pushbatch(L, &batch);
+    }
+
+static int CreateGraphicsParallel(lua_State *L)
+    { return CreateParallel(L, 0); }
+
+static int CreateComputeParallel(lua_State *L)
+    { return CreateParallel(L, 1); }
+
+/* Pipeline futures: the handle is the batch pointer, and the batch is ud->info
+ * until the result is retrieved. The pipeline cache and the create infos table
+ * (and thus the objects they reference) are anchored in ud->ref1 and ud->ref2
+ * until the worker threads are done with them. */
+
+static int freepipeline_future(lua_State *L, ud_t *ud)
+    {
+    uint32_t i;
+    uint64_t handle = ud->handle;
+    batch_t *batch = (batch_t*)ud->info;
+    if(!IsValid(ud)) return 0; /* double call */
+    if(batch && batch->task) task_wait(batch->task); /* before releasing the refs */
+    ud->info = NULL; /* we free it here */
+    freeuserdata(L, ud);
+    TRACE_DELETE(handle, "pipeline_future");
+    if(!batch) return 0; /* result already retrieved */
+    for(i = 0; i < batch->count; i++)
+        {
+        if(batch->result[i] == VK_SUCCESS)
+            batch->device_ud->ddt->DestroyPipeline(batch->device_ud->device, batch->pipeline[i], batch->allocator);
+        }
+    freebatch(L, batch);
+    Free(L, batch);
+    return 0;
+    }
+
+static int CreateAsync(lua_State *L, int compute)
+    {
+    ud_t *ud;
+    batch_t tmp, *batch;
+    checkbatch(L, &tmp, compute);
+    batch = (batch_t*)MallocNoErr(L, sizeof(batch_t));
+    if(!batch) { freebatch(L, &tmp); return errmemory(L); }
+    memcpy(batch, &tmp, sizeof(batch_t));
+    batch->task = task_start(batch->nthreads, batch->count, createone, batch);
+    if(!batch->task) { freebatch(L, batch); Free(L, batch); return errmemory(L); }
+    TRACE_CREATE(batch, "pipeline_future");
+    ud = newuserdata_nondispatchable(L, (uintptr_t)batch, PIPELINE_FUTURE_MT);
+    ud->parent_ud = batch->device_ud;
+    ud->device = batch->device_ud->device;
+    ud->instance = batch->device_ud->instance;
+    ud->allocator = batch->allocator;
+    ud->destructor = freepipeline_future;
+    ud->ddt = batch->device_ud->ddt;
+    ud->info = batch;
+    lua_pushvalue(L, 2);
+    ud->ref1 = luaL_ref(L, LUA_REGISTRYINDEX); /* pipeline cache */
+    lua_pushvalue(L, 3);
+    ud->ref2 = luaL_ref(L, LUA_REGISTRYINDEX); /* create infos */
+    return 1;
+    }
+
+static int CreateGraphicsAsync(lua_State *L)
+    { return CreateAsync(L, 0); }
+
+static int CreateComputeAsync(lua_State *L)
+    { return CreateAsync(L, 1); }
+
+static int FutureReady(lua_State *L)
+    {
+    ud_t *ud;
+    batch_t *batch;
+    (void)checkpipeline_future(L, 1, &ud);
+    batch = (batch_t*)ud->info;
+    lua_pushboolean(L, !batch || !batch->task || task_done(batch->task));
+    return 1;
+    }
+
+static int FutureWait(lua_State *L)
+    {
+    ud_t *ud;
+    batch_t *batch;
+    (void)checkpipeline_future(L, 1, &ud);
+    batch = (batch_t*)ud->info;
+    if(batch && batch->task)
+        {
+        task_wait(batch->task);
+        batch->task = NULL;
+        }
+    return 0;
+    }
+
+static int FutureResult(lua_State *L)
+    {
+    ud_t *ud;
+    batch_t *batch, tmp;
+    (void)checkpipeline_future(L, 1, &ud);
+    batch = (batch_t*)ud->info;
+    if(!batch) return luaL_error(L, "result already retrieved");
+    if(batch->task) task_wait(batch->task);
+    Unreference(L, ud->ref1);
+    Unreference(L, ud->ref2);
+    /* from now on the batch is on the stack, and the pipelines belong to Lua */
+    memcpy(&tmp, batch, sizeof(batch_t));
+    Free(L, batch);
+    ud->info = NULL;
+    return pushbatch(L, &tmp);
+    }
+
+static int FutureType(lua_State *L)
+    {
+    (void)checkpipeline_future(L, 1, NULL);
+    lua_pushstring(L, "pipeline_future");
+    return 1;
+    }
+
+static int FutureInstance(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkpipeline_future(L, 1, &ud);
+    return pushinstance(L, ud->instance);
+    }
+
+static int FutureDevice(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkpipeline_future(L, 1, &ud);
+    return pushdevice(L, ud->device);
+    }
+
+static int FutureDelete(lua_State *L)
+    {
+    ud_t *ud;
+    (void)testpipeline_future(L, 1, &ud);
+    if(!ud) return 0; /* already deleted */
+    return ud->destructor(L, ud);
+    }
+
+static int FutureDestroy(lua_State *L)
+    {
+    ud_t *ud;
+    (void)checkpipeline_future(L, 1, &ud);
+    return ud->destructor(L, ud);
+    }
+
+static const struct luaL_Reg FutureMethods[] = 
+    {
+        { "type", FutureType },
+        { "instance", FutureInstance },
+        { "device", FutureDevice },
+        { "parent", FutureDevice },
+        { "ready", FutureReady },
+        { "wait", FutureWait },
+        { "result", FutureResult },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg FutureMetaMethods[] = 
+    {
+        { "__gc",  FutureDelete },
+        { NULL, NULL } /* sentinel */
+    };
+
+
 
 #define N 32
 
@@ -267,7 +1269,35 @@ INSTANCE_FUNC(pipeline)
 DEVICE_FUNC(pipeline)
 PARENT_FUNC(pipeline)
 DELETE_FUNC(pipeline)
-DESTROY_FUNC(pipeline)
+static int Destroy(lua_State *L)
+/* Shared pipelines are destroyed only when the last reference is released */
+    {
+    ud_t *ud;
+    int map;
+    feedback_t *fb;
+    (void)checkpipeline(L, 1, &ud);
+    fb = (feedback_t*)ud->info;
+    if(fb && fb->refcount > 0)
+        {
+        if(--fb->refcount > 0) return 0;
+        map = fb->shared == SHARED_LINKED ? DEVINFO(ud->parent_ud)->link_map : DEVINFO(ud->parent_ud)->pipeline_map;
+        if(map != LUA_NOREF)
+            {
+            lua_rawgeti(L, LUA_REGISTRYINDEX, map);
+            lua_rawgeti(L, LUA_REGISTRYINDEX, ud->ref1); /* key */
+            lua_pushvalue(L, -1);
+            if(lua_rawget(L, -3) == LUA_TTABLE && lua_rawgeti(L, -1, 0) == LUA_TUSERDATA &&
+                    lua_touserdata(L, -1) == lua_touserdata(L, 1))
+                {
+                lua_pop(L, 2);
+                lua_pushnil(L);
+                lua_rawset(L, -3); /* map[key] = nil */
+                }
+            lua_settop(L, 1);
+            }
+        }
+    return ud->destructor(L, ud);
+    }
 
 static const struct luaL_Reg Methods[] = 
     {
@@ -289,6 +1319,20 @@ static const struct luaL_Reg Functions[] =
     {
         { "create_graphics_pipelines",  CreateGraphics },
         { "create_compute_pipelines",  CreateCompute },
+        { "enable_pipeline_dedupe",  EnablePipelineDedupe },
+        { "pipeline_dedupe_stats",  PipelineDedupeStats },
+        { "enable_pipeline_feedback",  EnablePipelineFeedback },
+        { "get_pipeline_feedback",  GetPipelineFeedback },
+        { "pipeline_feedback_report",  PipelineFeedbackReport },
+        { "create_graphics_pipeline_library",  CreateLibrary },
+        { "link_graphics_pipeline",  LinkLibraries },
+        { "pipeline_link_cache_stats",  LinkCacheStats },
+        { "clear_pipeline_link_cache",  ClearLinkCache },
+        { "create_graphics_pipelines_parallel",  CreateGraphicsParallel },
+        { "create_compute_pipelines_parallel",  CreateComputeParallel },
+        { "create_graphics_pipelines_async",  CreateGraphicsAsync },
+        { "create_compute_pipelines_async",  CreateComputeAsync },
+        { "destroy_pipeline_future",  FutureDestroy },
         { "get_pipeline_executable_properties", GetPipelineExecutableProperties },
         { "get_pipeline_executable_statistics", GetPipelineExecutableStatistics },
         { "get_pipeline_executable_internal_representations", GetPipelineExecutableInternalRepresentations },
@@ -300,6 +1344,7 @@ static const struct luaL_Reg Functions[] =
 void moonvulkan_open_pipeline(lua_State *L)
     {
     udata_define(L, PIPELINE_MT, Methods, MetaMethods);
+    udata_define(L, PIPELINE_FUTURE_MT, FutureMethods, FutureMetaMethods);
     luaL_setfuncs(L, Functions, 0);
     }
 
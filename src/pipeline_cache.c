@@ -24,6 +24,7 @@
  */
 
 #include "internal.h"
+#include <errno.h>
 
 static int freepipeline_cache(lua_State *L, ud_t *ud)
     {
@@ -37,10 +38,24 @@ static int freepipeline_cache(lua_State *L, ud_t *ud)
     return 0;
     }
 
+static ud_t *newpipeline_cache(lua_State *L, VkPipelineCache pipeline_cache, ud_t *device_ud, const VkAllocationCallbacks *allocator)
+    {
+    ud_t *ud;
+    TRACE_CREATE(pipeline_cache, "pipeline_cache");
+    ud = newuserdata_nondispatchable(L, pipeline_cache, PIPELINE_CACHE_MT);
+    ud->parent_ud = device_ud;
+    ud->device = device_ud->device;
+    ud->instance = device_ud->instance;
+    ud->allocator = allocator;
+    ud->destructor = freepipeline_cache;
+    ud->ddt = device_ud->ddt;
+    return ud;
+    }
+
 static int Create(lua_State *L)
     {
     int err;
-    ud_t *ud, *device_ud;
+    ud_t *device_ud;
     VkResult ec;
     VkPipelineCache pipeline_cache;
     VkPipelineCacheCreateInfo* info;
@@ -66,17 +81,128 @@ static int Create(lua_State *L)
     CLEANUP;
     CheckError(L, ec);
 #undef CLEANUP
-    TRACE_CREATE(pipeline_cache, "pipeline_cache");
-    ud = newuserdata_nondispatchable(L, pipeline_cache, PIPELINE_CACHE_MT);
-    ud->parent_ud = device_ud;
-    ud->device = device;
-    ud->instance = device_ud->instance;
-    ud->allocator = allocator;
-    ud->destructor = freepipeline_cache;
-    ud->ddt = device_ud->ddt;
+    newpipeline_cache(L, pipeline_cache, device_ud, allocator);
+    return 1;
+    }
+
+/*------------------------------------------------------------------------------*
+ | On-disk caches (NONVK)                                                       |
+ *------------------------------------------------------------------------------*/
+
+static int validheader(ud_t *device_ud, const void *data, size_t size)
+/* Checks that the cache data was created by the same driver for the same device,
+ * so that stale caches are discarded rather than fed to the implementation. */
+    {
+    VkPipelineCacheHeaderVersionOne header;
+    VkPhysicalDeviceProperties *props = &DEVINFO(device_ud)->properties;
+    if(size < sizeof(header)) return 0;
+    memcpy(&header, data, sizeof(header));
+    if(header.headerSize < sizeof(header) || header.headerSize > size) return 0;
+    if(header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE) return 0;
+    if(header.vendorID != props->vendorID || header.deviceID != props->deviceID) return 0;
+    if(memcmp(header.pipelineCacheUUID, props->pipelineCacheUUID, VK_UUID_SIZE) != 0) return 0;
     return 1;
     }
 
+static VkResult getdata(lua_State *L, ud_t *ud, VkPipelineCache pipeline_cache, char **data, size_t *size)
+/* Gets the cache data in a Malloc'd buffer (*data=NULL if the cache is empty) */
+    {
+    VkResult ec;
+    *data = NULL;
+    ec = ud->ddt->GetPipelineCacheData(ud->device, pipeline_cache, size, NULL);
+    if(ec || *size == 0) return ec;
+    *data = (char*)MallocNoErr(L, *size);
+    if(!*data) return VK_ERROR_OUT_OF_HOST_MEMORY;
+    ec = ud->ddt->GetPipelineCacheData(ud->device, pipeline_cache, size, *data);
+    if(ec) { Free(L, *data); *data = NULL; }
+    return ec;
+    }
+
+static int Open(lua_State *L)
+    {
+    int ec;
+    VkResult rc;
+    ud_t *ud, *device_ud;
+    void *data = NULL;
+    size_t size = 0, len;
+    int loaded = 0;
+    VkPipelineCache pipeline_cache;
+    VkPipelineCacheCreateInfo info;
+    VkDevice device = checkdevice(L, 1, &device_ud);
+    const char *path = luaL_checkstring(L, 2);
+    VkPipelineCacheCreateFlags flags = optflags(L, 3, 0);
+    const VkAllocationCallbacks *allocator = optallocator(L, 4);
+    ec = mapfile(path, &data, &size);
+    if(ec && ec != ENOENT) return luaL_error(L, "%s: %s", path, strerror(ec));
+    memset(&info, 0, sizeof(info));
+    info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    info.flags = flags;
+    if(!ec && validheader(device_ud, data, size))
+        {
+        /* create the cache straight from the mapping */
+        info.pInitialData = data;
+        info.initialDataSize = size;
+        loaded = 1;
+        }
+    rc = device_ud->ddt->CreatePipelineCache(device, &info, allocator, &pipeline_cache);
+    if(!ec) unmapfile(data, size);
+    CheckError(L, rc);
+    ud = newpipeline_cache(L, pipeline_cache, device_ud, allocator);
+    len = strlen(path);
+    ud->info = Malloc(L, len + 1); /* not Strdup(), which truncates long paths */
+    memcpy(ud->info, path, len + 1);
+    lua_pushboolean(L, loaded);
+    return 2;
+    }
+
+static int Save(lua_State *L)
+/* Saves the cache data, merged with the data currently in the file (if it was
+ * saved by the same device) so that concurrent processes do not lose each
+ * other's pipelines. The file is replaced atomically. */
+    {
+    int ec;
+    VkResult rc;
+    void *filedata;
+    size_t fsize, size;
+    char *data;
+    int merged = 0;
+    VkPipelineCache tmp;
+    VkPipelineCacheCreateInfo info;
+    ud_t *ud;
+    VkPipelineCache pipeline_cache = checkpipeline_cache(L, 1, &ud);
+    const char *path = luaL_optstring(L, 2, (const char*)ud->info);
+    if(!path) return luaL_argerror(L, 2, errstring(ERR_NOTPRESENT));
+    ec = mapfile(path, &filedata, &fsize);
+    if(ec && ec != ENOENT) return luaL_error(L, "%s: %s", path, strerror(ec));
+    if(!ec && validheader(ud->parent_ud, filedata, fsize))
+        {
+        memset(&info, 0, sizeof(info));
+        info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        info.pInitialData = filedata;
+        info.initialDataSize = fsize;
+        rc = ud->ddt->CreatePipelineCache(ud->device, &info, NULL, &tmp);
+        unmapfile(filedata, fsize);
+        CheckError(L, rc);
+        rc = ud->ddt->MergePipelineCaches(ud->device, tmp, 1, &pipeline_cache);
+        if(rc == VK_SUCCESS) rc = getdata(L, ud, tmp, &data, &size);
+        ud->ddt->DestroyPipelineCache(ud->device, tmp, NULL);
+        merged = 1;
+        }
+    else
+        {
+        if(!ec) unmapfile(filedata, fsize);
+        rc = getdata(L, ud, pipeline_cache, &data, &size);
+        }
+    CheckError(L, rc);
+    if(!data) { lua_pushinteger(L, 0); lua_pushboolean(L, merged); return 2; }
+    ec = writefile(path, data, size);
+    Free(L, data);
+    if(ec) return luaL_error(L, "%s: %s", path, strerror(ec));
+    lua_pushinteger(L, size);
+    lua_pushboolean(L, merged);
+    return 2;
+    }
+
 static int GetPipelineCacheData(lua_State *L)
     {
     VkResult ec;
@@ -146,6 +272,8 @@ static const struct luaL_Reg Functions[] =
         { "destroy_pipeline_cache",  Destroy },
         { "get_pipeline_cache_data", GetPipelineCacheData },
         { "merge_pipeline_caches", MergePipelineCaches },
+        { "open_pipeline_cache", Open },
+        { "save_pipeline_cache", Save },
         { NULL, NULL } /* sentinel */
     };
 
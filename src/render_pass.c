@@ -37,16 +37,45 @@ static int freerender_pass(lua_State *L, ud_t *ud)
     return 0;
     }
 
+/* Render pass cache (NONVK).
+ * When enabled on a device, create_render_pass() looks up the create info in a device-level
+ * map before converting it, and returns the existing render pass on a hit. The map is keyed
+ * as the pipeline dedupe map (see pushinfokey() in utils.c), and its entries are the tables
+ * of the objects referenced by the create info, with the render pass at index 0.
+ * Cached render passes are shared as in the sampler cache (see sampler.c): ud->info is a
+ * reference count and ud->ref1 references the key. The map holds strong references, so a
+ * cached render pass stays alive until it is destroyed by all the callers that got it,
+ * or until the cache is disabled.
+ */
+
 static int Create(lua_State *L)
     {
-    int err;
+    int err, cached = 0;
     ud_t *ud, *device_ud;
     VkResult ec;
     VkRenderPass render_pass;
     VkRenderPassCreateInfo* info;
     VkRenderPassCreateInfo2* info2;
+    devinfo_t *devinfo;
     VkDevice device = checkdevice(L, 1, &device_ud);
     const VkAllocationCallbacks *allocator = optallocator(L, 3);
+    devinfo = DEVINFO(device_ud);
+    lua_settop(L, 3);
+    if(devinfo->render_pass_map != LUA_NOREF && lua_istable(L, 2) &&
+            pushinfokey(L, 2, "R", allocator) == 0)
+        { /* key at 4, refs at 5 */
+        lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->render_pass_map);
+        lua_pushvalue(L, 4);
+        if(lua_rawget(L, -2) == LUA_TTABLE && lua_rawgeti(L, -1, 0) && testrender_pass(L, -1, &ud) && ud->info)
+            { /* hit */
+            (*(int*)ud->info)++;
+            devinfo->render_pass_hits++;
+            return 1;
+            }
+        lua_settop(L, 5);
+        devinfo->render_pass_misses++;
+        cached = 1;
+        }
 
     if(device_ud->ddt->CreateRenderPass2)
         {
@@ -76,6 +105,65 @@ static int Create(lua_State *L)
     ud->allocator = allocator;
     ud->destructor = freerender_pass;
     ud->ddt = device_ud->ddt;
+    if(cached)
+        {
+        ud->info = Malloc(L, sizeof(int));
+        *(int*)ud->info = 1;
+        lua_pushvalue(L, 4);
+        ud->ref1 = luaL_ref(L, LUA_REGISTRYINDEX);
+        lua_pushvalue(L, -1);
+        lua_rawseti(L, 5, 0); /* refs[0] = render_pass, so refs is the entry */
+        lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->render_pass_map);
+        lua_pushvalue(L, 4);
+        lua_pushvalue(L, 5);
+        lua_rawset(L, -3); /* map[key] = entry */
+        lua_pop(L, 1);
+        }
+    return 1;
+    }
+
+static int EnableRenderPassCache(lua_State *L)
+    {
+    ud_t *device_ud;
+    devinfo_t *devinfo;
+    (void)checkdevice(L, 1, &device_ud);
+    devinfo = DEVINFO(device_ud);
+    if(lua_isnoneornil(L, 2) || lua_toboolean(L, 2))
+        {
+        if(devinfo->render_pass_map == LUA_NOREF)
+            {
+            lua_newtable(L);
+            devinfo->render_pass_map = luaL_ref(L, LUA_REGISTRYINDEX);
+            }
+        }
+    else /* disable, and release the map */
+        Unreference(L, devinfo->render_pass_map);
+    return 0;
+    }
+
+static int RenderPassCacheStats(lua_State *L)
+    {
+    ud_t *device_ud;
+    devinfo_t *devinfo;
+    lua_Integer entries = 0;
+    (void)checkdevice(L, 1, &device_ud);
+    devinfo = DEVINFO(device_ud);
+    if(devinfo->render_pass_map != LUA_NOREF)
+        {
+        lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->render_pass_map);
+        lua_pushnil(L);
+        while(lua_next(L, -2) != 0)
+            {
+            lua_rawgeti(L, -1, 0);
+            if(testrender_pass(L, -1, NULL)) entries++;
+            lua_pop(L, 2);
+            }
+        lua_pop(L, 1);
+        }
+    lua_newtable(L);
+    lua_pushinteger(L, devinfo->render_pass_hits); lua_setfield(L, -2, "hits");
+    lua_pushinteger(L, devinfo->render_pass_misses); lua_setfield(L, -2, "misses");
+    lua_pushinteger(L, entries); lua_setfield(L, -2, "entries");
     return 1;
     }
 
@@ -97,7 +185,34 @@ INSTANCE_FUNC(render_pass)
 DEVICE_FUNC(render_pass)
 PARENT_FUNC(render_pass)
 DELETE_FUNC(render_pass)
-DESTROY_FUNC(render_pass)
+
+static int Destroy(lua_State *L)
+/* Cached render passes are destroyed only when the last reference is released */
+    {
+    ud_t *ud;
+    devinfo_t *devinfo;
+    (void)checkrender_pass(L, 1, &ud);
+    if(ud->info)
+        {
+        if(--(*(int*)ud->info) > 0) return 0;
+        devinfo = DEVINFO(ud->parent_ud);
+        if(devinfo->render_pass_map != LUA_NOREF)
+            {
+            lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->render_pass_map);
+            lua_rawgeti(L, LUA_REGISTRYINDEX, ud->ref1); /* key */
+            lua_pushvalue(L, -1);
+            if(lua_rawget(L, -3) == LUA_TTABLE && lua_rawgeti(L, -1, 0) &&
+                    lua_touserdata(L, -1) == lua_touserdata(L, 1))
+                {
+                lua_pop(L, 2);
+                lua_pushnil(L);
+                lua_rawset(L, -3); /* map[key] = nil */
+                }
+            lua_settop(L, 1);
+            }
+        }
+    return ud->destructor(L, ud);
+    }
 
 static const struct luaL_Reg Methods[] = 
     {
@@ -120,6 +235,8 @@ static const struct luaL_Reg Functions[] =
         { "create_render_pass",  Create },
         { "destroy_render_pass",  Destroy },
         { "get_render_area_granularity", GetRenderAreaGranularity },
+        { "enable_render_pass_cache", EnableRenderPassCache },
+        { "render_pass_cache_stats", RenderPassCacheStats },
         { NULL, NULL } /* sentinel */
     };
 
@@ -32,23 +32,103 @@ static int freesampler(lua_State *L, ud_t *ud)
     VkDevice device = ud->device;
     if(!freeuserdata(L, ud))
         return 0; /* double call */
+    DEVINFO(ud->parent_ud)->sampler_count--;
     TRACE_DELETE(sampler, "sampler");
     UD(device)->ddt->DestroySampler(device, sampler, allocator);
     return 0;
     }
 
+/* Sampler cache.
+ * When enabled, create_sampler() looks up a per-device map keyed by the converted
+ * VkSamplerCreateInfo (including the supported pNext chain) and returns the sampler
+ * already created with the same info, if any. Cached samplers are shared: their
+ * ud->info is a reference count incremented on each hit and decremented by
+ * destroy_sampler(), which actually destroys them only when it drops to zero, and
+ * their ud->ref1 references the key (map[key] = sampler). The map holds strong references,
+ * so cached samplers are never garbage collected while the cache is enabled.
+ */
+
+static int keystruct(lua_State *L, luaL_Buffer *b, const void *p, size_t size)
+/* Adds the contents of the struct (excluding sType and pNext) to the key */
+    {
+    const VkBaseInStructure *base = (const VkBaseInStructure*)p;
+    (void)L;
+    luaL_addlstring(b, (const char*)&base->sType, sizeof(base->sType));
+    luaL_addlstring(b, (const char*)p + sizeof(VkBaseInStructure), size - sizeof(VkBaseInStructure));
+    return 0;
+    }
+
+static int pushkey(lua_State *L, VkSamplerCreateInfo *info, const VkAllocationCallbacks *allocator)
+/* Pushes the key for the info, or returns ERR_VALUE (pushing nothing) if the pNext chain
+ * contains structs that are not supported by the cache. The structs are zeroed when
+ * allocated by zcheck, so their padding bytes are not garbage. */
+    {
+    luaL_Buffer b;
+    const VkBaseInStructure *next;
+    size_t size;
+    for(next = (const VkBaseInStructure*)info->pNext; next; next = next->pNext)
+        {
+        switch(next->sType)
+            {
+            case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+            case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT: break;
+            default: return ERR_VALUE;
+            }
+        }
+    luaL_buffinit(L, &b);
+    luaL_addlstring(&b, (const char*)&allocator, sizeof(allocator));
+    keystruct(L, &b, info, sizeof(VkSamplerCreateInfo));
+    for(next = (const VkBaseInStructure*)info->pNext; next; next = next->pNext)
+        {
+        switch(next->sType)
+            {
+            case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO:
+                size = sizeof(VkSamplerReductionModeCreateInfo); break;
+            case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+                size = sizeof(VkSamplerYcbcrConversionInfo); break;
+            case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT:
+                size = sizeof(VkSamplerCustomBorderColorCreateInfoEXT); break;
+            default:
+                size = sizeof(VkSamplerBorderColorComponentMappingCreateInfoEXT); break;
+            }
+        keystruct(L, &b, next, size);
+        }
+    luaL_pushresult(&b);
+    return 0;
+    }
+
 static int Create(lua_State *L)
     {
-    int err;
+    int err, cached = 0;
     ud_t *ud, *device_ud;
     VkResult ec;
     VkSampler sampler;
     VkSamplerCreateInfo* info;
+    devinfo_t *devinfo;
     VkDevice device = checkdevice(L, 1, &device_ud);
     const VkAllocationCallbacks *allocator = optallocator(L, 3);
+    devinfo = DEVINFO(device_ud);
 #define CLEANUP zfreeVkSamplerCreateInfo(L, info, 1)
     info = zcheckVkSamplerCreateInfo(L, 2, &err);
     if(err) { CLEANUP; return argerror(L, 2); }
+    lua_settop(L, 3);
+    if(devinfo->sampler_map != LUA_NOREF && pushkey(L, info, allocator) == 0)
+        {
+        cached = 1; /* key at index 4 */
+        lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->sampler_map);
+        lua_pushvalue(L, 4);
+        if(lua_rawget(L, 5) == LUA_TUSERDATA && testsampler(L, -1, &ud) && ud->info)
+            { /* hit */
+            CLEANUP;
+            (*(int*)ud->info)++;
+            devinfo->sampler_hits++;
+            return 1;
+            }
+        lua_pop(L, 1);
+        devinfo->sampler_misses++;
+        }
     ec = device_ud->ddt->CreateSampler(device, info, allocator, &sampler);
     CLEANUP;
     CheckError(L, ec);
@@ -61,6 +141,90 @@ static int Create(lua_State *L)
     ud->allocator = allocator;
     ud->destructor = freesampler;
     ud->ddt = device_ud->ddt;
+    devinfo->sampler_count++;
+    if(cached)
+        {
+        ud->info = Malloc(L, sizeof(int));
+        *(int*)ud->info = 1;
+        lua_pushvalue(L, 4);
+        ud->ref1 = luaL_ref(L, LUA_REGISTRYINDEX);
+        lua_pushvalue(L, 4);
+        lua_pushvalue(L, -2);
+        lua_rawset(L, 5); /* map[key] = sampler */
+        }
+    return 1;
+    }
+
+static int Destroy(lua_State *L)
+/* Cached samplers are destroyed only when the last reference is released */
+    {
+    ud_t *ud;
+    devinfo_t *devinfo;
+    (void)checksampler(L, 1, &ud);
+    if(ud->info)
+        {
+        if(--(*(int*)ud->info) > 0) return 0;
+        devinfo = DEVINFO(ud->parent_ud);
+        if(devinfo->sampler_map != LUA_NOREF)
+            {
+            lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->sampler_map);
+            lua_rawgeti(L, LUA_REGISTRYINDEX, ud->ref1); /* key */
+            lua_pushvalue(L, -1);
+            if(lua_rawget(L, -3) == LUA_TUSERDATA && lua_touserdata(L, -1) == lua_touserdata(L, 1))
+                {
+                lua_pop(L, 1);
+                lua_pushnil(L);
+                lua_rawset(L, -3); /* map[key] = nil */
+                }
+            lua_settop(L, 1);
+            }
+        }
+    return ud->destructor(L, ud);
+    }
+
+static int EnableSamplerCache(lua_State *L)
+    {
+    ud_t *device_ud;
+    devinfo_t *devinfo;
+    (void)checkdevice(L, 1, &device_ud);
+    devinfo = DEVINFO(device_ud);
+    if(lua_isnoneornil(L, 2) || lua_toboolean(L, 2))
+        {
+        if(devinfo->sampler_map == LUA_NOREF)
+            {
+            lua_newtable(L);
+            devinfo->sampler_map = luaL_ref(L, LUA_REGISTRYINDEX);
+            }
+        }
+    else /* disable, and release the map (the samplers already shared stay shared) */
+        Unreference(L, devinfo->sampler_map);
+    return 0;
+    }
+
+static int SamplerCacheStats(lua_State *L)
+    {
+    ud_t *device_ud, *ud;
+    devinfo_t *devinfo;
+    lua_Integer entries = 0;
+    (void)checkdevice(L, 1, &device_ud);
+    devinfo = DEVINFO(device_ud);
+    if(devinfo->sampler_map != LUA_NOREF)
+        {
+        lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->sampler_map);
+        lua_pushnil(L);
+        while(lua_next(L, -2) != 0)
+            {
+            if(testsampler(L, -1, &ud)) entries++;
+            lua_pop(L, 1);
+            }
+        lua_pop(L, 1);
+        }
+    lua_newtable(L);
+    lua_pushinteger(L, devinfo->sampler_hits); lua_setfield(L, -2, "hits");
+    lua_pushinteger(L, devinfo->sampler_misses); lua_setfield(L, -2, "misses");
+    lua_pushinteger(L, entries); lua_setfield(L, -2, "entries");
+    lua_pushinteger(L, devinfo->sampler_count); lua_setfield(L, -2, "samplers");
+    lua_pushinteger(L, devinfo->properties.limits.maxSamplerAllocationCount); lua_setfield(L, -2, "max_samplers");
     return 1;
     }
 
@@ -70,7 +234,6 @@ INSTANCE_FUNC(sampler)
 DEVICE_FUNC(sampler)
 PARENT_FUNC(sampler)
 DELETE_FUNC(sampler)
-DESTROY_FUNC(sampler)
 
 static const struct luaL_Reg Methods[] = 
     {
@@ -92,6 +255,8 @@ static const struct luaL_Reg Functions[] =
     {
         { "create_sampler",  Create },
         { "destroy_sampler",  Destroy },
+        { "enable_sampler_cache",  EnableSamplerCache },
+        { "sampler_cache_stats",  SamplerCacheStats },
         { NULL, NULL } /* sentinel */
     };
 
@@ -0,0 +1,180 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Stefano Trettel
+ *
+ * Software repository: MoonVulkan, https://github.com/stetre/moonvulkan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "internal.h"
+
+/* Shader objects (VK_EXT_shader_object).
+ * Shaders are bound directly to command buffers with cmd_bind_shaders(), and all the
+ * state otherwise baked in pipelines is set with the cmd_set_xxx() dynamic state
+ * commands, so that no pipeline needs to be compiled.
+ */
+
+#ifdef VK_EXT_shader_object
+
+static int freeshader(lua_State *L, ud_t *ud)
+    {
+    VkShaderEXT shader = (VkShaderEXT)ud->handle;
+    const VkAllocationCallbacks *allocator = ud->allocator;
+    PFN_vkDestroyShaderEXT DestroyShader = ud->ddt->DestroyShaderEXT;
+    VkDevice device = ud->device;
+    if(!freeuserdata(L, ud))
+        return 0; /* double call */
+    TRACE_DELETE(shader, "shader");
+    DestroyShader(device, shader, allocator);
+    return 0;
+    }
+
+static ud_t *newshader(lua_State *L, VkShaderEXT shader, ud_t *device_ud, const VkAllocationCallbacks *allocator)
+    {
+    ud_t *ud;
+    TRACE_CREATE(shader, "shader");
+    ud = newuserdata_nondispatchable(L, shader, SHADER_MT);
+    ud->parent_ud = device_ud;
+    ud->device = device_ud->device;
+    ud->instance = device_ud->instance;
+    ud->allocator = allocator;
+    ud->destructor = freeshader;
+    ud->ddt = device_ud->ddt;
+    return ud;
+    }
+
+static int Create(lua_State *L)
+/* Creates a set of shaders, possibly linked (VK_SHADER_CREATE_LINK_STAGE_BIT_EXT) */
+    {
+    int err;
+    uint32_t count, i;
+    size_t size;
+    VkResult ec;
+    VkShaderEXT *shader;
+    VkShaderCreateInfoEXT *info;
+    ud_t *device_ud;
+    VkDevice device = checkdevice(L, 1, &device_ud);
+    const VkAllocationCallbacks *allocator = optallocator(L, 3);
+    CheckDevicePfn(L, device_ud, CreateShadersEXT);
+#define CLEANUP zfreearrayVkShaderCreateInfoEXT(L, info, count, 1)
+    info = zcheckarrayVkShaderCreateInfoEXT(L, 2, &count, &err);
+    if(err) { CLEANUP; return argerror(L, 2); }
+    for(i = 0; i < count; i++)
+        {
+        /* the code strings are anchored in the info tables, that stay on the stack */
+        lua_rawgeti(L, 2, i+1);
+        lua_getfield(L, -1, "code");
+        info[i].pCode = luaL_optlstring(L, -1, NULL, &size);
+        info[i].codeSize = size;
+        lua_pop(L, 2);
+        if(!info[i].pCode || (size == 0))
+            { CLEANUP; return luaL_error(L, "missing shader code (shader %d)", (int)i+1); }
+        }
+
+    shader = (VkShaderEXT*)MallocNoErr(L, count*sizeof(VkShaderEXT));
+    if(!shader) { CLEANUP; return errmemory(L); }
+
+    ec = device_ud->ddt->CreateShadersEXT(device, count, info, allocator, shader);
+    CLEANUP;
+#undef CLEANUP
+    if(ec)
+        {
+        Free(L, shader);
+        CheckError(L, ec);
+        }
+    lua_newtable(L);
+    for(i = 0; i < count; i++)
+        {
+        newshader(L, shader[i], device_ud, allocator);
+        lua_rawseti(L, -2, i+1);
+        }
+    Free(L, shader);
+    return 1;
+    }
+
+static int GetBinaryData(lua_State *L)
+    {
+    VkResult ec;
+    size_t size;
+    void *data;
+    ud_t *ud;
+    VkShaderEXT shader = (VkShaderEXT)checkshader(L, 1, &ud);
+    CheckDevicePfn(L, ud, GetShaderBinaryDataEXT);
+    ec = ud->ddt->GetShaderBinaryDataEXT(ud->device, shader, &size, NULL);
+    CheckError(L, ec);
+    if(size == 0)
+        { lua_pushstring(L, ""); return 1; }
+    data = MallocNoErr(L, size);
+    if(!data) return errmemory(L);
+    ec = ud->ddt->GetShaderBinaryDataEXT(ud->device, shader, &size, data);
+    if(ec) { Free(L, data); CheckError(L, ec); }
+    lua_pushlstring(L, (char*)data, size);
+    Free(L, data);
+    return 1;
+    }
+
+#else
+
+static int Create(lua_State *L)
+    { return notavailable(L); }
+
+static int GetBinaryData(lua_State *L)
+    { return notavailable(L); }
+
+#endif
+
+RAW_FUNC(shader)
+TYPE_FUNC(shader)
+INSTANCE_FUNC(shader)
+DEVICE_FUNC(shader)
+PARENT_FUNC(shader)
+DELETE_FUNC(shader)
+DESTROY_FUNC(shader)
+
+static const struct luaL_Reg Methods[] = 
+    {
+        { "raw", Raw },
+        { "type", Type },
+        { "instance", Instance },
+        { "device", Device },
+        { "parent", Parent },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg MetaMethods[] = 
+    {
+        { "__gc",  Delete },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg Functions[] = 
+    {
+        { "create_shaders",  Create },
+        { "destroy_shader",  Destroy },
+        { "get_shader_binary_data",  GetBinaryData },
+        { NULL, NULL } /* sentinel */
+    };
+
+void moonvulkan_open_shader(lua_State *L)
+    {
+    udata_define(L, SHADER_MT, Methods, MetaMethods);
+    luaL_setfuncs(L, Functions, 0);
+    }
+
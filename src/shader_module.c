@@ -24,6 +24,7 @@
  */
 
 #include "internal.h"
+#include <errno.h>
 
 static int freeshader_module(lua_State *L, ud_t *ud)
     {
@@ -37,10 +38,24 @@ static int freeshader_module(lua_State *L, ud_t *ud)
     return 0;
     }
 
+static ud_t *newshader_module(lua_State *L, VkShaderModule shader_module, ud_t *device_ud, const VkAllocationCallbacks *allocator)
+    {
+    ud_t *ud;
+    TRACE_CREATE(shader_module, "shader_module");
+    ud = newuserdata_nondispatchable(L, shader_module, SHADER_MODULE_MT);
+    ud->parent_ud = device_ud;
+    ud->device = device_ud->device;
+    ud->instance = device_ud->instance;
+    ud->allocator = allocator;
+    ud->destructor = freeshader_module;
+    ud->ddt = device_ud->ddt;
+    return ud;
+    }
+
 static int Create(lua_State *L)
     {
     int err;
-    ud_t *ud, *device_ud;
+    ud_t *device_ud;
     VkResult ec;
     VkShaderModule shader_module;
     VkShaderModuleCreateInfo* info;
@@ -74,14 +89,292 @@ static int Create(lua_State *L)
     CLEANUP;
     CheckError(L, ec);
 #undef CLEANUP
-    TRACE_CREATE(shader_module, "shader_module");
-    ud = newuserdata_nondispatchable(L, shader_module, SHADER_MODULE_MT);
-    ud->parent_ud = device_ud;
-    ud->device = device;
-    ud->instance = device_ud->instance;
-    ud->allocator = allocator;
-    ud->destructor = freeshader_module;
-    ud->ddt = device_ud->ddt;
+    newshader_module(L, shader_module, device_ud, allocator);
+    return 1;
+    }
+
+/*------------------------------------------------------------------------------*
+ | Loading from files (NONVK)                                                   |
+ *------------------------------------------------------------------------------*/
+
+/* The files are mapped, validated and hashed in worker threads. The hashes are then
+ * looked up in a per-device cache (on the Lua thread), and only the modules not found
+ * there (and not duplicated in the same call) are created, again in worker threads.
+ * The cache maps the content (128 bit hash and size) and the allocator to the module.
+ * Cached modules keep a copy of their code in ud->info, and a hit is taken only if the
+ * code is identical: on a hash collision the module is created and not cached.
+ * Cached modules are shared, so ud->info also holds a reference count (one per module
+ * returned) and the module is destroyed only when the last reference is released.
+ */
+
+#define SPIRV_MAGIC 0x07230203
+#define SPIRV_HEADER_SIZE 20 /* 5 words */
+
+typedef struct {
+    const char *path;
+    void *code;
+    size_t size;
+    int ec; /* errno value, or -1 if not valid SPIR-V */
+    uint64_t hash[2];
+    int create; /* 1 if the module must be created, 2 if also not cached (hash collision) */
+    VkResult result;
+    VkShaderModule shader_module;
+} shaderfile_t;
+
+typedef struct {
+    ud_t *device_ud;
+    const VkAllocationCallbacks *allocator;
+    shaderfile_t *file;
+} loadjob_t;
+
+typedef struct {
+    int refcount;
+    size_t size;
+    /* followed by the code */
+} cached_t;
+
+#define CODE(cached) ((void*)((cached_t*)(cached) + 1))
+
+static void hashcode(const uint32_t *code, size_t nwords, uint64_t hash[2])
+    {
+    size_t i;
+    uint64_t h1 = 0xcbf29ce484222325ULL, h2 = 0x9e3779b97f4a7c15ULL;
+    for(i = 0; i < nwords; i++)
+        {
+        h1 = (h1 ^ code[i]) * 0x100000001b3ULL;
+        h2 = (h2 + code[i]) * 0xff51afd7ed558ccdULL;
+        h2 ^= h2 >> 29;
+        }
+    h1 ^= h1 >> 33; h1 *= 0xc4ceb9fe1a85ec53ULL; h1 ^= h1 >> 33;
+    hash[0] = h1;
+    hash[1] = h2;
+    }
+
+static void mapone(void *data, unsigned i)
+    {
+    shaderfile_t *file = &((loadjob_t*)data)->file[i];
+    file->ec = mapfile(file->path, &file->code, &file->size);
+    if(file->ec) return;
+    if(file->size < SPIRV_HEADER_SIZE || file->size % 4 != 0 || ((uint32_t*)file->code)[0] != SPIRV_MAGIC)
+        { unmapfile(file->code, file->size); file->ec = -1; return; }
+    hashcode((uint32_t*)file->code, file->size / 4, file->hash);
+    }
+
+static void createone(void *data, unsigned i)
+    {
+    loadjob_t *job = (loadjob_t*)data;
+    shaderfile_t *file = &job->file[i];
+    VkShaderModuleCreateInfo info;
+    if(!file->create) return;
+    memset(&info, 0, sizeof(info));
+    info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    info.codeSize = file->size;
+    info.pCode = (uint32_t*)file->code;
+    file->result = job->device_ud->ddt->CreateShaderModule(job->device_ud->device, &info, 
+                    job->allocator, &file->shader_module);
+    }
+
+static void pushfilekey(lua_State *L, shaderfile_t *file, const VkAllocationCallbacks *allocator)
+    {
+    char key[2*sizeof(uint64_t) + sizeof(size_t) + sizeof(void*)];
+    memcpy(key, file->hash, 2*sizeof(uint64_t));
+    memcpy(key + 2*sizeof(uint64_t), &file->size, sizeof(size_t));
+    memcpy(key + 2*sizeof(uint64_t) + sizeof(size_t), &allocator, sizeof(void*));
+    lua_pushlstring(L, key, sizeof(key));
+    }
+
+static int samecode(shaderfile_t *file, const void *code)
+    {
+    return code && memcmp(code, file->code, file->size) == 0;
+    }
+
+static int LoadFiles(lua_State *L, int arg, uint32_t count, unsigned nthreads, ud_t *device_ud, const VkAllocationCallbacks *allocator)
+/* Loads count files whose paths are at arg (a string or a table of strings), and
+ * leaves on the stack a table with the modules. */
+    {
+    uint32_t i, j;
+    int map, keys, t;
+    ud_t *ud;
+    VkResult ec = VK_SUCCESS;
+    shaderfile_t *failed = NULL;
+    loadjob_t job;
+    devinfo_t *devinfo = DEVINFO(device_ud);
+    job.device_ud = device_ud;
+    job.allocator = allocator;
+    job.file = (shaderfile_t*)Malloc(L, count*sizeof(shaderfile_t));
+    for(i = 0; i < count; i++)
+        {
+        if(lua_type(L, arg) == LUA_TTABLE)
+            {
+            lua_rawgeti(L, arg, i+1);
+            job.file[i].path = lua_tostring(L, -1); /* anchored in the table */
+            lua_pop(L, 1);
+            }
+        else
+            job.file[i].path = lua_tostring(L, arg);
+        if(!job.file[i].path) { Free(L, job.file); return argerrorc(L, arg, ERR_TYPE); }
+        }
+
+    parallel_for(nthreads, count, mapone, &job);
+
+#define CLEANUP do {                                            \
+    for(i = 0; i < count; i++)                                  \
+        if(job.file[i].ec == 0) unmapfile(job.file[i].code, job.file[i].size); \
+    Free(L, job.file);                                          \
+} while(0)
+    for(i = 0; i < count; i++)
+        if(job.file[i].ec) { failed = &job.file[i]; break; }
+    if(failed)
+        {
+        lua_pushfstring(L, "%s: %s", failed->path, 
+                failed->ec == -1 ? "not a valid SPIR-V file" : strerror(failed->ec));
+        CLEANUP;
+        return lua_error(L);
+        }
+
+    /* look up the cache, marking for creation the modules that are not found
+     * there (the first of each group of identical ones) */
+    if(devinfo->shader_map == LUA_NOREF)
+        {
+        lua_newtable(L);
+        devinfo->shader_map = luaL_ref(L, LUA_REGISTRYINDEX);
+        }
+    lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->shader_map);
+    map = lua_gettop(L);
+    lua_newtable(L);
+    keys = lua_gettop(L);
+    for(i = 0; i < count; i++)
+        {
+        pushfilekey(L, &job.file[i], allocator);
+        lua_pushvalue(L, -1);
+        lua_rawseti(L, keys, i+1);
+        lua_pushvalue(L, -1);
+        t = lua_rawget(L, map);
+        if(t == LUA_TUSERDATA && testshader_module(L, -1, &ud))
+            { /* cached */
+            lua_pop(L, 2);
+            if(ud->info && samecode(&job.file[i], CODE(ud->info))) { devinfo->shader_hits++; continue; }
+            job.file[i].create = 2;
+            devinfo->shader_misses++;
+            continue;
+            }
+        if(t == LUA_TBOOLEAN)
+            { /* being created by a previous file in this call */
+            lua_pop(L, 2);
+            for(j = 0; j < i; j++)
+                if(job.file[j].create == 1 && job.file[j].size == job.file[i].size &&
+                    memcmp(job.file[j].hash, job.file[i].hash, sizeof(job.file[i].hash)) == 0) break;
+            if(samecode(&job.file[i], job.file[j].code)) { devinfo->shader_hits++; continue; }
+            job.file[i].create = 2;
+            devinfo->shader_misses++;
+            continue;
+            }
+        lua_pop(L, 1);
+        lua_pushboolean(L, 0); /* placeholder, so that duplicates are not created twice */
+        lua_rawset(L, map);
+        job.file[i].create = 1;
+        devinfo->shader_misses++;
+        }
+
+    parallel_for(nthreads, count, createone, &job);
+
+    for(i = 0; i < count; i++)
+        if(job.file[i].create && job.file[i].result != VK_SUCCESS) { ec = job.file[i].result; break; }
+    for(i = 0; i < count; i++)
+        {
+        if(!job.file[i].create) continue;
+        if(job.file[i].create == 2)
+            { /* not cached: the module replaces the key */
+            if(ec == VK_SUCCESS)
+                newshader_module(L, job.file[i].shader_module, device_ud, allocator);
+            else
+                {
+                if(job.file[i].result == VK_SUCCESS)
+                    device_ud->ddt->DestroyShaderModule(device_ud->device, job.file[i].shader_module, allocator);
+                lua_pushnil(L);
+                }
+            lua_rawseti(L, keys, i+1);
+            continue;
+            }
+        lua_rawgeti(L, keys, i+1);
+        if(ec == VK_SUCCESS)
+            {
+            cached_t *cached;
+            ud = newshader_module(L, job.file[i].shader_module, device_ud, allocator);
+            cached = (cached_t*)MallocNoErr(L, sizeof(cached_t) + job.file[i].size);
+            if(cached) /* if NULL, it will just not be hit (and not be shared) */
+                {
+                cached->refcount = 0; /* incremented below */
+                cached->size = job.file[i].size;
+                memcpy(CODE(cached), job.file[i].code, job.file[i].size);
+                ud->info = cached;
+                lua_pushvalue(L, -2);
+                ud->ref1 = luaL_ref(L, LUA_REGISTRYINDEX); /* key */
+                }
+            }
+        else
+            {
+            if(job.file[i].result == VK_SUCCESS)
+                device_ud->ddt->DestroyShaderModule(device_ud->device, job.file[i].shader_module, allocator);
+            lua_pushnil(L);
+            }
+        lua_rawset(L, map);
+        }
+    CLEANUP;
+#undef CLEANUP
+    CheckError(L, ec);
+    lua_newtable(L);
+    for(i = 0; i < count; i++)
+        {
+        if(lua_rawgeti(L, keys, i+1) == LUA_TSTRING)
+            {
+            lua_rawget(L, map);
+            if(testshader_module(L, -1, &ud) && ud->info)
+                ((cached_t*)ud->info)->refcount++;
+            }
+        lua_rawseti(L, -2, i+1);
+        }
+    return 1;
+    }
+
+static int Load(lua_State *L)
+    {
+    ud_t *device_ud;
+    (void)checkdevice(L, 1, &device_ud);
+    (void)luaL_checkstring(L, 2);
+    LoadFiles(L, 2, 1, 1, device_ud, optallocator(L, 3));
+    lua_rawgeti(L, -1, 1);
+    return 1;
+    }
+
+static int LoadMany(lua_State *L)
+    {
+    ud_t *device_ud;
+    uint32_t count;
+    (void)checkdevice(L, 1, &device_ud);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    count = (uint32_t)lua_rawlen(L, 2);
+    if(count == 0) return argerrorc(L, 2, ERR_EMPTY);
+    return LoadFiles(L, 2, count, luaL_optinteger(L, 4, 0), device_ud, optallocator(L, 3));
+    }
+
+static int ClearCache(lua_State *L)
+    {
+    ud_t *device_ud;
+    (void)checkdevice(L, 1, &device_ud);
+    Unreference(L, DEVINFO(device_ud)->shader_map);
+    return 0;
+    }
+
+static int CacheStats(lua_State *L)
+    {
+    ud_t *device_ud;
+    devinfo_t *devinfo;
+    (void)checkdevice(L, 1, &device_ud);
+    devinfo = DEVINFO(device_ud);
+    lua_newtable(L);
+    lua_pushinteger(L, devinfo->shader_hits); lua_setfield(L, -2, "hits");
+    lua_pushinteger(L, devinfo->shader_misses); lua_setfield(L, -2, "misses");
     return 1;
     }
 
@@ -91,7 +384,32 @@ INSTANCE_FUNC(shader_module)
 DEVICE_FUNC(shader_module)
 PARENT_FUNC(shader_module)
 DELETE_FUNC(shader_module)
-DESTROY_FUNC(shader_module)
+static int Destroy(lua_State *L)
+/* Cached modules are destroyed only when the last reference is released */
+    {
+    ud_t *ud;
+    devinfo_t *devinfo;
+    (void)checkshader_module(L, 1, &ud);
+    if(ud->info)
+        {
+        if(--((cached_t*)ud->info)->refcount > 0) return 0;
+        devinfo = DEVINFO(ud->parent_ud);
+        if(devinfo->shader_map != LUA_NOREF)
+            {
+            lua_rawgeti(L, LUA_REGISTRYINDEX, devinfo->shader_map);
+            lua_rawgeti(L, LUA_REGISTRYINDEX, ud->ref1); /* key */
+            lua_pushvalue(L, -1);
+            if(lua_rawget(L, -3) == LUA_TUSERDATA && lua_touserdata(L, -1) == lua_touserdata(L, 1))
+                {
+                lua_pop(L, 1);
+                lua_pushnil(L);
+                lua_rawset(L, -3); /* map[key] = nil */
+                }
+            lua_settop(L, 1);
+            }
+        }
+    return ud->destructor(L, ud);
+    }
 
 static const struct luaL_Reg Methods[] = 
     {
@@ -113,6 +431,10 @@ static const struct luaL_Reg Functions[] =
     {
         { "create_shader_module",  Create },
         { "destroy_shader_module",  Destroy },
+        { "load_shader_module",  Load },
+        { "load_shader_modules",  LoadMany },
+        { "clear_shader_module_cache",  ClearCache },
+        { "shader_module_cache_stats",  CacheStats },
         { NULL, NULL } /* sentinel */
     };
 
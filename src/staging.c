@@ -0,0 +1,644 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Stefano Trettel
+ *
+ * Software repository: MoonVulkan, https://github.com/stetre/moonvulkan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "internal.h"
+
+/* Staging ring (NONVK).
+ *
+ * A persistently mapped, host coherent buffer used as a ring from which uploads
+ * sub-allocate their source space. The copy commands are recorded in a small set of
+ * transfer command buffers ('batches'), each with its own fence, that are submitted
+ * in round-robin order. The space held by a batch is given back to the ring as soon
+ * as its fence is signaled, so that uploads never need to create new buffers nor
+ * to wait for the device to be idle.
+ */
+
+#define DEFAULT_BATCHES 3
+#define RING_ALIGNMENT 16 /* alignment of sub-allocations (must be a power of 2) */
+#define ALIGN(x) (((x) + RING_ALIGNMENT - 1) & ~((VkDeviceSize)RING_ALIGNMENT - 1))
+
+/* same as CheckError(), for functions returning a pointer */
+#define CheckErrorNULL(L, ec) \
+    do { if(ec != VK_SUCCESS) { pushresult((L), (ec)); lua_error(L); return NULL; } } while(0)
+
+#define BATCH_FREE      0
+#define BATCH_RECORDING 1
+#define BATCH_PENDING   2
+
+typedef struct {
+    VkCommandBuffer command_buffer;
+    VkFence fence;
+    VkDeviceSize bytes; /* ring space held by the batch, including padding */
+    int state;
+} batch_t;
+
+typedef struct {
+    VkQueue queue;
+    VkDeviceMemory memory;
+    VkCommandPool command_pool;
+    char *ptr; /* mapped memory */
+    VkDeviceSize size; /* ring size */
+    VkDeviceSize head; /* next byte to be allocated */
+    VkDeviceSize used; /* bytes held by recording and pending batches */
+    uint32_t nbatches;
+    uint32_t current; /* batch being recorded (or to be recorded next) */
+    uint32_t oldest; /* oldest pending batch */
+    uint32_t npending;
+    batch_t *batch;
+    uint64_t uploads, uploaded, stalls; /* statistics */
+} ud_info_t;
+
+static int findmemorytype(ud_t *device_ud, uint32_t typebits, VkMemoryPropertyFlags flags)
+    {
+    uint32_t i;
+    VkPhysicalDeviceMemoryProperties *props = &DEVINFO(device_ud)->memory_properties;
+    for(i = 0; i < props->memoryTypeCount; i++)
+        {
+        if((typebits & (1U << i)) && ((props->memoryTypes[i].propertyFlags & flags) == flags))
+            return (int)i;
+        }
+    return -1;
+    }
+
+static void destroyring(VkDevice device, device_dt_t *ddt, VkBuffer buffer, ud_info_t *info)
+/* destroys whatever has been created (the fences must not be pending) */
+    {
+    uint32_t i;
+    for(i = 0; i < info->nbatches; i++)
+        {
+        if(info->batch[i].fence)
+            ddt->DestroyFence(device, info->batch[i].fence, NULL);
+        }
+    if(info->command_pool) /* this frees also the command buffers */
+        ddt->DestroyCommandPool(device, info->command_pool, NULL);
+    if(info->ptr)
+        ddt->UnmapMemory(device, info->memory);
+    if(buffer)
+        ddt->DestroyBuffer(device, buffer, NULL);
+    if(info->memory)
+        ddt->FreeMemory(device, info->memory, NULL);
+    }
+
+static VkResult createring(ud_t *device_ud, uint32_t queue_family_index, VkBuffer *buffer, ud_info_t *info)
+    {
+    VkResult ec;
+    uint32_t i;
+    int memtype;
+    void *ptr;
+    VkMemoryRequirements req;
+    VkBufferCreateInfo bufferinfo;
+    VkMemoryAllocateInfo allocinfo;
+    VkCommandPoolCreateInfo poolinfo;
+    VkCommandBufferAllocateInfo cbinfo;
+    VkFenceCreateInfo fenceinfo;
+    VkDevice device = (VkDevice)(uintptr_t)device_ud->handle;
+    device_dt_t *ddt = device_ud->ddt;
+
+    memset(&bufferinfo, 0, sizeof(bufferinfo));
+    bufferinfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferinfo.size = info->size;
+    bufferinfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    bufferinfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    ec = ddt->CreateBuffer(device, &bufferinfo, NULL, buffer);
+    if(ec) return ec;
+
+    ddt->GetBufferMemoryRequirements(device, *buffer, &req);
+    memtype = findmemorytype(device_ud, req.memoryTypeBits,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    if(memtype < 0) return VK_ERROR_FEATURE_NOT_PRESENT;
+    memset(&allocinfo, 0, sizeof(allocinfo));
+    allocinfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocinfo.allocationSize = req.size;
+    allocinfo.memoryTypeIndex = (uint32_t)memtype;
+    ec = ddt->AllocateMemory(device, &allocinfo, NULL, &info->memory);
+    if(ec) return ec;
+    ec = ddt->BindBufferMemory(device, *buffer, info->memory, 0);
+    if(ec) return ec;
+    ec = ddt->MapMemory(device, info->memory, 0, VK_WHOLE_SIZE, 0, &ptr);
+    if(ec) return ec;
+    info->ptr = (char*)ptr;
+
+    memset(&poolinfo, 0, sizeof(poolinfo));
+    poolinfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolinfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolinfo.queueFamilyIndex = queue_family_index;
+    ec = ddt->CreateCommandPool(device, &poolinfo, NULL, &info->command_pool);
+    if(ec) return ec;
+
+    memset(&cbinfo, 0, sizeof(cbinfo));
+    cbinfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cbinfo.commandPool = info->command_pool;
+    cbinfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    cbinfo.commandBufferCount = 1;
+    memset(&fenceinfo, 0, sizeof(fenceinfo));
+    fenceinfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    for(i = 0; i < info->nbatches; i++)
+        {
+        ec = ddt->AllocateCommandBuffers(device, &cbinfo, &info->batch[i].command_buffer);
+        if(ec) return ec;
+        ec = ddt->CreateFence(device, &fenceinfo, NULL, &info->batch[i].fence);
+        if(ec) return ec;
+        }
+    return VK_SUCCESS;
+    }
+
+static int freestaging_ring(lua_State *L, ud_t *ud)
+    {
+    uint32_t i;
+    VkBuffer buffer = (VkBuffer)ud->handle;
+    VkDevice device = ud->device;
+    device_dt_t *ddt = ud->ddt;
+    ud_info_t *info = (ud_info_t*)ud->info;
+    ud->info = NULL; /* we free it here */
+    if(!freeuserdata(L, ud))
+        return 0; /* double call */
+    TRACE_DELETE(buffer, "staging_ring");
+    for(i = 0; i < info->nbatches; i++)
+        {
+        if(info->batch[i].state == BATCH_PENDING)
+            ddt->WaitForFences(device, 1, &info->batch[i].fence, VK_TRUE, UINT64_MAX);
+        }
+    destroyring(device, ddt, buffer, info);
+    Free(L, info->batch);
+    Free(L, info);
+    return 0;
+    }
+
+static int Create(lua_State *L)
+    {
+    ud_t *ud, *queue_ud, *device_ud;
+    VkResult ec;
+    ud_info_t *info;
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkQueue queue = checkqueue(L, 1, &queue_ud);
+    uint32_t queue_family_index = luaL_checkinteger(L, 2);
+    VkDeviceSize size = (VkDeviceSize)luaL_checkinteger(L, 3);
+    uint32_t nbatches = luaL_optinteger(L, 4, DEFAULT_BATCHES);
+    VkDevice device = queue_ud->device;
+
+    device_ud = UD(device);
+    if(size == 0) return argerrorc(L, 3, ERR_VALUE);
+    if(nbatches == 0) return argerrorc(L, 4, ERR_VALUE);
+
+    info = (ud_info_t*)Malloc(L, sizeof(ud_info_t));
+    info->batch = (batch_t*)MallocNoErr(L, nbatches * sizeof(batch_t));
+    if(!info->batch) { Free(L, info); return errmemory(L); }
+    info->queue = queue;
+    info->size = size;
+    info->nbatches = nbatches;
+
+    ec = createring(device_ud, queue_family_index, &buffer, info);
+    if(ec)
+        {
+        destroyring(device, device_ud->ddt, buffer, info);
+        Free(L, info->batch);
+        Free(L, info);
+        if(ec == VK_ERROR_FEATURE_NOT_PRESENT)
+            return luaL_error(L, "no host visible and coherent memory type available for staging");
+        CheckError(L, ec);
+        return 0;
+        }
+
+    TRACE_CREATE(buffer, "staging_ring");
+    ud = newuserdata_nondispatchable(L, buffer, STAGING_RING_MT);
+    ud->parent_ud = device_ud;
+    ud->device = device;
+    ud->instance = device_ud->instance;
+    ud->destructor = freestaging_ring;
+    ud->ddt = device_ud->ddt;
+    ud->info = info;
+    return 1;
+    }
+
+/*------------------------------------------------------------------------------*
+ | Ring management                                                              |
+ *------------------------------------------------------------------------------*/
+
+static VkResult retire(ud_t *ud, ud_info_t *info, int blocking)
+/* Retires the pending batches whose fences are signaled, in submission order,
+ * giving their space back to the ring. If blocking=1, waits for at least the
+ * oldest pending batch to complete.
+ */
+    {
+    VkResult ec;
+    batch_t *batch;
+    uint64_t timeout = blocking ? UINT64_MAX : 0;
+    while(info->npending > 0)
+        {
+        batch = &info->batch[info->oldest];
+        ec = ud->ddt->WaitForFences(ud->device, 1, &batch->fence, VK_TRUE, timeout);
+        if(ec == VK_TIMEOUT) break;
+        if(ec) return ec;
+        ec = ud->ddt->ResetFences(ud->device, 1, &batch->fence);
+        if(ec) return ec;
+        info->used -= batch->bytes;
+        batch->bytes = 0;
+        batch->state = BATCH_FREE;
+        info->oldest = (info->oldest + 1) % info->nbatches;
+        info->npending--;
+        timeout = 0;
+        }
+    if(info->used == 0) info->head = 0; /* ring is empty, restart from the beginning */
+    return VK_SUCCESS;
+    }
+
+static VkResult submitbatch(ud_t *ud, ud_info_t *info, uint32_t nsemaphores, VkSemaphore *semaphores)
+/* ends and submits the current batch, if recording */
+    {
+    VkResult ec;
+    VkSubmitInfo submitinfo;
+    batch_t *batch = &info->batch[info->current];
+    if(batch->state != BATCH_RECORDING) return VK_SUCCESS;
+    ec = ud->ddt->EndCommandBuffer(batch->command_buffer);
+    if(ec) return ec;
+    memset(&submitinfo, 0, sizeof(submitinfo));
+    submitinfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitinfo.commandBufferCount = 1;
+    submitinfo.pCommandBuffers = &batch->command_buffer;
+    submitinfo.signalSemaphoreCount = nsemaphores;
+    submitinfo.pSignalSemaphores = semaphores;
+    ec = ud->ddt->QueueSubmit(info->queue, 1, &submitinfo, batch->fence);
+    if(ec) return ec;
+    batch->state = BATCH_PENDING;
+    if(info->npending == 0) info->oldest = info->current;
+    info->npending++;
+    info->current = (info->current + 1) % info->nbatches;
+    return VK_SUCCESS;
+    }
+
+static VkResult startbatch(ud_t *ud, ud_info_t *info, batch_t **batchp)
+/* same as beginbatch(), but returns the error instead of raising it */
+    {
+    VkResult ec;
+    VkCommandBufferBeginInfo begininfo;
+    batch_t *batch = &info->batch[info->current];
+    *batchp = batch;
+    if(batch->state == BATCH_RECORDING) return VK_SUCCESS;
+    if(batch->state == BATCH_PENDING)
+        {
+        /* all the batches are in flight, and this is the oldest one */
+        info->stalls++;
+        ec = retire(ud, info, 1);
+        if(ec != VK_SUCCESS) return ec;
+        }
+    memset(&begininfo, 0, sizeof(begininfo));
+    begininfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begininfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    ec = ud->ddt->BeginCommandBuffer(batch->command_buffer, &begininfo);
+    if(ec != VK_SUCCESS) return ec;
+    batch->state = BATCH_RECORDING;
+    return VK_SUCCESS;
+    }
+
+static batch_t *beginbatch(lua_State *L, ud_t *ud, ud_info_t *info)
+/* returns the current batch, ready for recording */
+    {
+    batch_t *batch;
+    VkResult ec = startbatch(ud, info, &batch);
+    CheckErrorNULL(L, ec);
+    return batch;
+    }
+
+static VkResult reservespace(ud_t *ud, ud_info_t *info, VkDeviceSize size, VkDeviceSize *offset, batch_t **batchp)
+/* Reserves size bytes (not exceeding the ring size) of staging space, and sets *batchp
+ * to the batch where to record the commands that use it. Does not raise errors, so
+ * that the caller can release its resources before raising.
+ */
+    {
+    VkResult ec;
+    VkDeviceSize off, need;
+    ec = retire(ud, info, 0);
+    if(ec != VK_SUCCESS) return ec;
+    for(;;)
+        {
+        off = ALIGN(info->head);
+        if(off + size > info->size) /* wrap around, wasting the tail of the ring */
+            { need = info->size - info->head + size; off = 0; }
+        else
+            need = off - info->head + size;
+        if(need <= info->size - info->used)
+            break;
+        /* not enough space: wait for the oldest batch to complete */
+        info->stalls++;
+        if(info->npending == 0)
+            {
+            ec = submitbatch(ud, info, 0, NULL);
+            if(ec != VK_SUCCESS) return ec;
+            }
+        ec = retire(ud, info, 1);
+        if(ec != VK_SUCCESS) return ec;
+        }
+    ec = startbatch(ud, info, batchp);
+    if(ec != VK_SUCCESS) return ec;
+    info->head = off + size;
+    info->used += need;
+    (*batchp)->bytes += need;
+    info->uploads++;
+    info->uploaded += size;
+    *offset = off;
+    return VK_SUCCESS;
+    }
+
+static batch_t *allocspace(lua_State *L, ud_t *ud, ud_info_t *info, VkDeviceSize size, VkDeviceSize *offset)
+/* Allocates size bytes of staging space, and returns the batch where to record
+ * the commands that use it.
+ */
+    {
+    VkResult ec;
+    batch_t *batch;
+    if(size > info->size)
+        { luaL_error(L, "data too large for the staging ring"); return NULL; }
+    ec = reservespace(ud, info, size, offset, &batch);
+    CheckErrorNULL(L, ec);
+    return batch;
+    }
+
+/*------------------------------------------------------------------------------*
+ | Functions                                                                    |
+ *------------------------------------------------------------------------------*/
+
+static int UploadBuffer(lua_State *L)
+    {
+    ud_t *ud;
+    size_t len;
+    batch_t *batch;
+    VkBufferCopy region;
+    VkBuffer staging_buffer = checkstaging_ring(L, 1, &ud);
+    VkBuffer buffer = checkbuffer(L, 2, NULL);
+    VkDeviceSize offset = (VkDeviceSize)luaL_checkinteger(L, 3);
+    const char *data = luaL_checklstring(L, 4, &len);
+    ud_info_t *info = (ud_info_t*)ud->info;
+    if(len == 0) return 0;
+    batch = allocspace(L, ud, info, len, &region.srcOffset);
+    memcpy(info->ptr + region.srcOffset, data, len);
+    region.dstOffset = offset;
+    region.size = len;
+    ud->ddt->CmdCopyBuffer(batch->command_buffer, staging_buffer, buffer, 1, &region);
+    return 0;
+    }
+
+static int UploadFile(lua_State *L)
+    {
+    int ec;
+    ud_t *ud;
+    uint64_t fsize;
+    batch_t *batch;
+    VkBufferCopy region;
+    VkDeviceSize size, chunk;
+    double t;
+    VkBuffer staging_buffer = checkstaging_ring(L, 1, &ud);
+    VkBuffer buffer = checkbuffer(L, 2, NULL);
+    VkDeviceSize offset = (VkDeviceSize)luaL_checkinteger(L, 3);
+    const char *path = luaL_checkstring(L, 4);
+    uint64_t file_offset = luaL_optinteger(L, 5, 0);
+    unsigned nthreads = luaL_optinteger(L, 7, 1);
+    ud_info_t *info = (ud_info_t*)ud->info;
+
+    ec = filesize(path, &fsize);
+    if(ec) return luaL_error(L, "%s: %s", path, strerror(ec));
+    if(file_offset > fsize)
+        return argerrorc(L, 5, ERR_VALUE);
+    size = lua_isnoneornil(L, 6) ? fsize - file_offset : (VkDeviceSize)luaL_checkinteger(L, 6);
+    if(size > fsize - file_offset)
+        return argerrorc(L, 6, ERR_LENGTH);
+
+    /* The file is read in chunks of at most half the ring, and each chunk is submitted
+     * as soon as it is read, so that the copy of a chunk overlaps the read of the next one */
+    t = now();
+    region.dstOffset = offset;
+    while(size > 0)
+        {
+        chunk = info->size > 1 ? info->size / 2 : info->size;
+        if(chunk > size) chunk = size;
+        batch = allocspace(L, ud, info, chunk, &region.srcOffset);
+        ec = readfile(path, file_offset, info->ptr + region.srcOffset, chunk, nthreads);
+        if(ec) return luaL_error(L, "%s: %s", path, strerror(ec));
+        region.size = chunk;
+        ud->ddt->CmdCopyBuffer(batch->command_buffer, staging_buffer, buffer, 1, &region);
+        file_offset += chunk;
+        region.dstOffset += chunk;
+        size -= chunk;
+        if(size > 0)
+            {
+            ec = submitbatch(ud, info, 0, NULL);
+            CheckError(L, ec);
+            }
+        }
+    lua_pushinteger(L, region.dstOffset - offset);
+    lua_pushnumber(L, since(t));
+    return 2;
+    }
+
+static void imagebarrier(ud_t *ud, batch_t *batch, VkImage image, VkImageAspectFlags aspect,
+        VkImageLayout old_layout, VkImageLayout new_layout)
+    {
+    VkImageMemoryBarrier barrier;
+    VkPipelineStageFlags srcstage, dststage;
+    memset(&barrier, 0, sizeof(barrier));
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.oldLayout = old_layout;
+    barrier.newLayout = new_layout;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange.aspectMask = aspect;
+    barrier.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+    barrier.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+    if(new_layout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
+        {
+        if(old_layout == VK_IMAGE_LAYOUT_UNDEFINED)
+            srcstage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        else
+            {
+            barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+            srcstage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+            }
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        dststage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        }
+    else
+        {
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        srcstage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        dststage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        }
+    ud->ddt->CmdPipelineBarrier(batch->command_buffer, srcstage, dststage, 0, 0, NULL, 0, NULL, 1, &barrier);
+    }
+
+static int UploadImage(lua_State *L)
+    {
+    int err, err1, err2;
+    ud_t *ud;
+    VkResult ec;
+    size_t len;
+    uint32_t i, count;
+    batch_t *batch;
+    VkDeviceSize offset;
+    VkImageAspectFlags aspect = 0;
+    VkBufferImageCopy *regions;
+    VkBufferImageCopy buf[SMALL_LIST];
+    VkBuffer staging_buffer = checkstaging_ring(L, 1, &ud);
+    VkImage image = checkimage(L, 2, NULL);
+    const char *data = luaL_checklstring(L, 4, &len);
+    VkImageLayout old_layout = testimagelayout(L, 5, &err);
+    VkImageLayout new_layout = testimagelayout(L, 6, &err1);
+    ud_info_t *info = (ud_info_t*)ud->info;
+    if(err < 0) return argerrorc(L, 5, err);
+    if(err1 < 0) return argerrorc(L, 6, err1);
+    if(len == 0) return argerrorc(L, 4, ERR_EMPTY);
+    if(len > info->size) return luaL_error(L, "data too large for the staging ring");
+    /* parse the regions before taking space from the ring, so that a bad argument
+     * does not leave it allocated (the list is on the stack unless it is long) */
+#define CLEANUP zfreearrayVkBufferImageCopy(L, regions, count, regions != buf)
+    regions = zcheckarraybufVkBufferImageCopy(L, 3, buf, SMALL_LIST, &count, &err2);
+    if(err2) { CLEANUP; return argerror(L, 3); }
+    ec = reservespace(ud, info, len, &offset, &batch);
+    if(ec != VK_SUCCESS) { CLEANUP; CheckError(L, ec); }
+    memcpy(info->ptr + offset, data, len);
+    for(i = 0; i < count; i++)
+        {
+        regions[i].bufferOffset += offset;
+        aspect |= regions[i].imageSubresource.aspectMask;
+        }
+    if(err == ERR_SUCCESS && old_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
+        imagebarrier(ud, batch, image, aspect, old_layout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    ud->ddt->CmdCopyBufferToImage(batch->command_buffer, staging_buffer, image,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, count, regions);
+    if(err1 == ERR_SUCCESS && new_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
+        imagebarrier(ud, batch, image, aspect, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, new_layout);
+    CLEANUP;
+#undef CLEANUP
+    return 0;
+    }
+
+static int Submit(lua_State *L)
+    {
+    int err;
+    ud_t *ud;
+    VkResult ec;
+    uint32_t count;
+    VkSemaphore *semaphores;
+    ud_info_t *info;
+    (void)checkstaging_ring(L, 1, &ud);
+    info = (ud_info_t*)ud->info;
+    semaphores = checksemaphorelist(L, 2, &count, &err, NULL);
+    if(err < 0) return argerrorc(L, 2, err);
+    if(count > 0 && info->batch[info->current].state != BATCH_RECORDING)
+        {
+        /* submit an empty batch, so to signal the semaphores anyway */
+        Free(L, semaphores);
+        (void)beginbatch(L, ud, info);
+        semaphores = checksemaphorelist(L, 2, &count, &err, NULL);
+        }
+    ec = submitbatch(ud, info, count, semaphores);
+    Free(L, semaphores);
+    CheckError(L, ec);
+    return 0;
+    }
+
+static int Wait(lua_State *L)
+    {
+    ud_t *ud;
+    VkResult ec = VK_SUCCESS;
+    ud_info_t *info;
+    (void)checkstaging_ring(L, 1, &ud);
+    info = (ud_info_t*)ud->info;
+    while(info->npending > 0 && ec == VK_SUCCESS)
+        ec = retire(ud, info, 1);
+    CheckError(L, ec);
+    return 0;
+    }
+
+static int Stats(lua_State *L)
+    {
+    ud_t *ud;
+    ud_info_t *info;
+    (void)checkstaging_ring(L, 1, &ud);
+    info = (ud_info_t*)ud->info;
+    (void)retire(ud, info, 0);
+    lua_newtable(L);
+#define Set(name, val) do { lua_pushinteger(L, (val)); lua_setfield(L, -2, name); } while(0)
+    Set("size", info->size);
+    Set("used", info->used);
+    Set("pending", info->npending);
+    Set("uploads", info->uploads);
+    Set("bytes", info->uploaded);
+    Set("stalls", info->stalls);
+#undef Set
+    return 1;
+    }
+
+/*------------------------------------------------------------------------------*
+ | Methods                                                                      |
+ *------------------------------------------------------------------------------*/
+
+RAW_FUNC(staging_ring)
+TYPE_FUNC(staging_ring)
+INSTANCE_FUNC(staging_ring)
+DEVICE_FUNC(staging_ring)
+PARENT_FUNC(staging_ring)
+DELETE_FUNC(staging_ring)
+DESTROY_FUNC(staging_ring)
+
+/*------------------------------------------------------------------------------*
+ | Registration                                                                 |
+ *------------------------------------------------------------------------------*/
+
+static const struct luaL_Reg Methods[] = 
+    {
+        { "raw", Raw },
+        { "type", Type },
+        { "instance", Instance },
+        { "device", Device },
+        { "parent", Parent },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg MetaMethods[] = 
+    {
+        { "__gc",  Delete },
+        { NULL, NULL } /* sentinel */
+    };
+
+static const struct luaL_Reg Functions[] = 
+    {
+        { "create_staging_ring",  Create },
+        { "destroy_staging_ring",  Destroy },
+        { "staging_upload_buffer", UploadBuffer },
+        { "staging_upload_image", UploadImage },
+        { "staging_upload_file", UploadFile },
+        { "staging_submit", Submit },
+        { "staging_wait", Wait },
+        { "staging_stats", Stats },
+        { NULL, NULL } /* sentinel */
+    };
+
+void moonvulkan_open_staging(lua_State *L)
+    {
+    udata_define(L, STAGING_RING_MT, Methods, MetaMethods);
+    luaL_setfuncs(L, Functions, 0);
+    }
+
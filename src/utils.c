@@ -304,7 +304,8 @@ void pushstringlist(lua_State *L, char** list, uint32_t count)
  | uint32_t List                                                                |
  *------------------------------------------------------------------------------*/
 
-uint32_t* checkuint32list(lua_State *L, int arg, uint32_t *count, int *err)
+uint32_t* checkuint32listbuf(lua_State *L, int arg, uint32_t *buf, uint32_t bufcount, uint32_t *count, int *err)
+/* Same as checkuint32list(), but uses buf if the list has no more than bufcount elements */
     {
     uint32_t* list;
     uint32_t i;
@@ -320,7 +321,10 @@ uint32_t* checkuint32list(lua_State *L, int arg, uint32_t *count, int *err)
     if(*count == 0)
         { *err = ERR_EMPTY; return NULL; }
 
-    list = (uint32_t*)MallocNoErr(L, sizeof(uint32_t) * (*count));
+    if(buf && *count <= bufcount)
+        list = buf;
+    else
+        list = (uint32_t*)MallocNoErr(L, sizeof(uint32_t) * (*count));
     if(!list)
         { *count = 0; *err = ERR_MEMORY; return NULL; }
 
@@ -328,13 +332,16 @@ uint32_t* checkuint32list(lua_State *L, int arg, uint32_t *count, int *err)
         {
         lua_rawgeti(L, arg, i+1);
         if(!lua_isinteger(L, -1))
-            { lua_pop(L, 1); Free(L, list); *count = 0; *err = ERR_TYPE; return NULL; }
+            { lua_pop(L, 1); FreeBuf(L, list, buf); *count = 0; *err = ERR_TYPE; return NULL; }
         list[i] = lua_tointeger(L, -1);
         lua_pop(L, 1);
         }
     return list;
     }
 
+uint32_t* checkuint32list(lua_State *L, int arg, uint32_t *count, int *err)
+    { return checkuint32listbuf(L, arg, NULL, 0, count, err); }
+
 void pushuint32list(lua_State *L, uint32_t *list, uint32_t count)
     {
     uint32_t i;
@@ -350,7 +357,8 @@ void pushuint32list(lua_State *L, uint32_t *list, uint32_t count)
  | VkBool32 List                                                                |
  *------------------------------------------------------------------------------*/
 
-VkBool32* checkbooleanlist(lua_State *L, int arg, uint32_t *count, int *err)
+VkBool32* checkbooleanlistbuf(lua_State *L, int arg, VkBool32 *buf, uint32_t bufcount, uint32_t *count, int *err)
+/* Same as checkbooleanlist(), but uses buf if the list has no more than bufcount elements */
     {
     VkBool32* list;
     uint32_t i;
@@ -366,7 +374,10 @@ VkBool32* checkbooleanlist(lua_State *L, int arg, uint32_t *count, int *err)
     if(*count == 0)
         { *err = ERR_EMPTY; return NULL; }
 
-    list = (VkBool32*)MallocNoErr(L, sizeof(VkBool32) * (*count));
+    if(buf && *count <= bufcount)
+        list = buf;
+    else
+        list = (VkBool32*)MallocNoErr(L, sizeof(VkBool32) * (*count));
     if(!list)
         { *count = 0; *err = ERR_MEMORY; return NULL; }
 
@@ -374,13 +385,16 @@ VkBool32* checkbooleanlist(lua_State *L, int arg, uint32_t *count, int *err)
         {
         lua_rawgeti(L, arg, i+1);
         if(!lua_isboolean(L, -1))
-            { lua_pop(L, 1); Free(L, list); *count = 0; *err = ERR_TYPE; return NULL; }
+            { lua_pop(L, 1); FreeBuf(L, list, buf); *count = 0; *err = ERR_TYPE; return NULL; }
         list[i] = lua_toboolean(L, -1);
         lua_pop(L, 1);
         }
     return list;
     }
 
+VkBool32* checkbooleanlist(lua_State *L, int arg, uint32_t *count, int *err)
+    { return checkbooleanlistbuf(L, arg, NULL, 0, count, err); }
+
 void pushbooleanlist(lua_State *L, VkBool32 *list, uint32_t count)
     {
     uint32_t i;
@@ -397,7 +411,8 @@ void pushbooleanlist(lua_State *L, VkBool32 *list, uint32_t count)
  | int32_t List                                                                 |
  *------------------------------------------------------------------------------*/
 
-int32_t* checkint32list(lua_State *L, int arg, uint32_t *count, int *err)
+int32_t* checkint32listbuf(lua_State *L, int arg, int32_t *buf, uint32_t bufcount, uint32_t *count, int *err)
+/* Same as checkint32list(), but uses buf if the list has no more than bufcount elements */
     {
     int32_t* list;
     uint32_t i;
@@ -413,7 +428,10 @@ int32_t* checkint32list(lua_State *L, int arg, uint32_t *count, int *err)
     if(*count == 0)
         { *err = ERR_EMPTY; return NULL; }
 
-    list = (int32_t*)MallocNoErr(L, sizeof(int32_t) * (*count));
+    if(buf && *count <= bufcount)
+        list = buf;
+    else
+        list = (int32_t*)MallocNoErr(L, sizeof(int32_t) * (*count));
     if(!list)
         { *count = 0; *err = ERR_MEMORY; return NULL; }
 
@@ -421,13 +439,16 @@ int32_t* checkint32list(lua_State *L, int arg, uint32_t *count, int *err)
         {
         lua_rawgeti(L, arg, i+1);
         if(!lua_isinteger(L, -1))
-            { lua_pop(L, 1); Free(L, list); *count = 0; *err = ERR_TYPE; return NULL; }
+            { lua_pop(L, 1); FreeBuf(L, list, buf); *count = 0; *err = ERR_TYPE; return NULL; }
         list[i] = lua_tointeger(L, -1);
         lua_pop(L, 1);
         }
     return list;
     }
 
+int32_t* checkint32list(lua_State *L, int arg, uint32_t *count, int *err)
+    { return checkint32listbuf(L, arg, NULL, 0, count, err); }
+
 void pushint32list(lua_State *L, int32_t *list, uint32_t count)
     {
     uint32_t i;
@@ -444,7 +465,8 @@ void pushint32list(lua_State *L, int32_t *list, uint32_t count)
  | uint64_t List                                                                |
  *------------------------------------------------------------------------------*/
 
-uint64_t* checkuint64list(lua_State *L, int arg, uint32_t *count, int *err)
+uint64_t* checkuint64listbuf(lua_State *L, int arg, uint64_t *buf, uint32_t bufcount, uint32_t *count, int *err)
+/* Same as checkuint64list(), but uses buf if the list has no more than bufcount elements */
     {
     uint64_t* list;
     uint32_t i;
@@ -460,7 +482,10 @@ uint64_t* checkuint64list(lua_State *L, int arg, uint32_t *count, int *err)
     if(*count == 0)
         { *err = ERR_EMPTY; return NULL; }
 
-    list = (uint64_t*)MallocNoErr(L, sizeof(uint64_t) * (*count));
+    if(buf && *count <= bufcount)
+        list = buf;
+    else
+        list = (uint64_t*)MallocNoErr(L, sizeof(uint64_t) * (*count));
     if(!list)
         { *count = 0; *err = ERR_MEMORY; return NULL; }
 
@@ -468,13 +493,16 @@ uint64_t* checkuint64list(lua_State *L, int arg, uint32_t *count, int *err)
         {
         lua_rawgeti(L, arg, i+1);
         if(!lua_isinteger(L, -1))
-            { lua_pop(L, 1); Free(L, list); *count = 0; *err = ERR_TYPE; return NULL; }
+            { lua_pop(L, 1); FreeBuf(L, list, buf); *count = 0; *err = ERR_TYPE; return NULL; }
         list[i] = lua_tointeger(L, -1);
         lua_pop(L, 1);
         }
     return list;
     }
 
+uint64_t* checkuint64list(lua_State *L, int arg, uint32_t *count, int *err)
+    { return checkuint64listbuf(L, arg, NULL, 0, count, err); }
+
 void pushuint64list(lua_State *L, uint64_t *list, uint32_t count)
     {
     uint32_t i;
@@ -504,7 +532,8 @@ VkDeviceSize checkdevicesize(lua_State *L, int arg)
     return (VkDeviceSize)luaL_checkinteger(L, arg);
     }
 
-VkDeviceSize* checkdevicesizelist(lua_State *L, int arg, uint32_t *count, int *err)
+VkDeviceSize* checkdevicesizelistbuf(lua_State *L, int arg, VkDeviceSize *buf, uint32_t bufcount, uint32_t *count, int *err)
+/* Same as checkdevicesizelist(), but uses buf if the list has no more than bufcount elements */
     {
     const char *s;
     VkDeviceSize* list;
@@ -521,7 +550,10 @@ VkDeviceSize* checkdevicesizelist(lua_State *L, int arg, uint32_t *count, int *e
     if(*count == 0)
         { *err = ERR_EMPTY; return NULL; }
 
-    list = (VkDeviceSize*)MallocNoErr(L, sizeof(VkDeviceSize) * (*count));
+    if(buf && *count <= bufcount)
+        list = buf;
+    else
+        list = (VkDeviceSize*)MallocNoErr(L, sizeof(VkDeviceSize) * (*count));
     if(!list)
         { *count = 0; *err = ERR_MEMORY; return NULL; }
 
@@ -541,11 +573,14 @@ VkDeviceSize* checkdevicesizelist(lua_State *L, int arg, uint32_t *count, int *e
             *err = ERR_TYPE;
         lua_pop(L, 1);
         if(*err)
-            { Free(L, list); *count = 0; return NULL; }
+            { FreeBuf(L, list, buf); *count = 0; return NULL; }
         }
     return list;
     }
 
+VkDeviceSize* checkdevicesizelist(lua_State *L, int arg, uint32_t *count, int *err)
+    { return checkdevicesizelistbuf(L, arg, NULL, 0, count, err); }
+
 void pushdevicesizelist(lua_State *L, VkDeviceSize *list, uint32_t count)
     {
     uint32_t i;
@@ -562,7 +597,8 @@ void pushdevicesizelist(lua_State *L, VkDeviceSize *list, uint32_t count)
  | float List                                                                   |
  *------------------------------------------------------------------------------*/
 
-float* checkfloatlist(lua_State *L, int arg, uint32_t *count, int *err)
+float* checkfloatlistbuf(lua_State *L, int arg, float *buf, uint32_t bufcount, uint32_t *count, int *err)
+/* Same as checkfloatlist(), but uses buf if the list has no more than bufcount elements */
     {
     float* list;
     uint32_t i;
@@ -578,7 +614,10 @@ float* checkfloatlist(lua_State *L, int arg, uint32_t *count, int *err)
     if(*count == 0)
         { *err = ERR_EMPTY; return NULL; }
 
-    list = (float*)MallocNoErr(L, sizeof(float) * (*count));
+    if(buf && *count <= bufcount)
+        list = buf;
+    else
+        list = (float*)MallocNoErr(L, sizeof(float) * (*count));
     if(!list)
         { *count = 0; *err = ERR_MEMORY; return NULL; }
 
@@ -586,13 +625,16 @@ float* checkfloatlist(lua_State *L, int arg, uint32_t *count, int *err)
         {
         lua_rawgeti(L, arg, i+1);
         if(!lua_isnumber(L, -1))
-            { lua_pop(L, 1); Free(L, list); *count = 0; *err = ERR_TYPE; return NULL; }
+            { lua_pop(L, 1); FreeBuf(L, list, buf); *count = 0; *err = ERR_TYPE; return NULL; }
         list[i] = lua_tonumber(L, -1);
         lua_pop(L, 1);
         }
     return list;
     }
 
+float* checkfloatlist(lua_State *L, int arg, uint32_t *count, int *err)
+    { return checkfloatlistbuf(L, arg, NULL, 0, count, err); }
+
 void pushfloatlist(lua_State *L, float *list, uint32_t count)
     {
     uint32_t i;
@@ -767,6 +809,174 @@ uint64_t checktimeout(lua_State *L, int arg)
     return (uint64_t)luaL_checkinteger(L, arg);
     }
 
+lua_Integer testinteger(lua_State *L, int arg, lua_Integer defval, int *err)
+/* Non-raising luaL_optinteger(), for use while memory is allocated */
+    {
+    int isnum;
+    lua_Integer val;
+    *err = 0;
+    if(lua_isnoneornil(L, arg)) return defval;
+    val = lua_tointegerx(L, arg, &isnum);
+    if(!isnum) *err = ERR_TYPE;
+    return val;
+    }
+
+/*------------------------------------------------------------------------------*
+ | Create info keys                                                             |
+ *------------------------------------------------------------------------------*/
+
+/* Keys for the NONVK object caches (pipeline dedupe, render pass and framebuffer caches).
+ * A key is a canonical serialization of a create info table: fields sorted by name, arrays
+ * in order, objects by identity (the address of their userdata), and including the pNext
+ * chain. Equal keys thus mean identical create infos. The referenced objects are collected
+ * in a table, which the caller is expected to keep in the cache entry so that their userdata
+ * can not be recycled (and their addresses reused) while the entry exists.
+ */
+
+#define MAX_DEPTH 32
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t size;
+    int refs; /* stack index of the table where referenced objects are collected */
+} keybuf_t;
+
+static int keyadd(lua_State *L, keybuf_t *kb, const void *data, size_t len)
+    {
+    char *p;
+    size_t size;
+    if(kb->len + len > kb->size)
+        {
+        size = kb->size ? kb->size : 256;
+        while(size < kb->len + len) size *= 2;
+        p = (char*)MallocNoErr(L, size);
+        if(!p) return ERR_MEMORY;
+        if(kb->data) { memcpy(p, kb->data, kb->len); Free(L, kb->data); }
+        kb->data = p;
+        kb->size = size;
+        }
+    memcpy(kb->data + kb->len, data, len);
+    kb->len += len;
+    return 0;
+    }
+
+static int cmpkeys(const void *a, const void *b)
+    { return strcmp(*(const char**)a, *(const char**)b); }
+
+static int keyvalue(lua_State *L, keybuf_t *kb, int arg, int depth);
+
+static int keytable(lua_State *L, keybuf_t *kb, int arg, int depth)
+    {
+    int err = 0;
+    size_t n, i, nkeys = 0;
+    const char **keys;
+    lua_Integer k;
+    if(depth > MAX_DEPTH) return ERR_VALUE;
+    n = lua_rawlen(L, arg);
+    /* collect the names of the fields, so to serialize them in a canonical order */
+    lua_pushnil(L);
+    while(lua_next(L, arg) != 0)
+        {
+        lua_pop(L, 1);
+        if(lua_type(L, -1) == LUA_TSTRING) nkeys++;
+        else if(lua_isinteger(L, -1) && (k = lua_tointeger(L, -1)) >= 1 && (size_t)k <= n) continue;
+        else { lua_pop(L, 1); return ERR_VALUE; }
+        }
+    keys = (const char**)MallocNoErr(L, (nkeys+1)*sizeof(char*));
+    if(!keys) return ERR_MEMORY;
+    i = 0;
+    lua_pushnil(L);
+    while(lua_next(L, arg) != 0)
+        {
+        lua_pop(L, 1);
+        if(lua_type(L, -1) == LUA_TSTRING) keys[i++] = lua_tostring(L, -1); /* anchored in the table */
+        }
+    qsort(keys, nkeys, sizeof(char*), cmpkeys);
+    err = keyadd(L, kb, "{", 1);
+    for(i = 0; i < nkeys && !err; i++)
+        {
+        err = keyadd(L, kb, keys[i], strlen(keys[i]) + 1);
+        lua_getfield(L, arg, keys[i]);
+        if(!err) err = keyvalue(L, kb, lua_gettop(L), depth + 1);
+        lua_pop(L, 1);
+        }
+    if(!err) err = keyadd(L, kb, "[", 1);
+    for(i = 1; i <= n && !err; i++)
+        {
+        lua_rawgeti(L, arg, i);
+        err = keyvalue(L, kb, lua_gettop(L), depth + 1);
+        lua_pop(L, 1);
+        }
+    if(!err) err = keyadd(L, kb, "}", 1);
+    Free(L, keys);
+    return err;
+    }
+
+static int keyvalue(lua_State *L, keybuf_t *kb, int arg, int depth)
+    {
+    int err;
+    const char *s;
+    size_t len;
+    lua_Integer i;
+    lua_Number x;
+    void *p;
+    switch(lua_type(L, arg))
+        {
+        case LUA_TBOOLEAN: return keyadd(L, kb, lua_toboolean(L, arg) ? "T" : "F", 1);
+        case LUA_TNUMBER:
+            if(lua_isinteger(L, arg))
+                {
+                i = lua_tointeger(L, arg);
+                err = keyadd(L, kb, "i", 1);
+                return err ? err : keyadd(L, kb, &i, sizeof(i));
+                }
+            x = lua_tonumber(L, arg);
+            err = keyadd(L, kb, "n", 1);
+            return err ? err : keyadd(L, kb, &x, sizeof(x));
+        case LUA_TSTRING:
+            s = lua_tolstring(L, arg, &len);
+            err = keyadd(L, kb, "s", 1);
+            if(!err) err = keyadd(L, kb, &len, sizeof(len));
+            return err ? err : keyadd(L, kb, s, len);
+        case LUA_TLIGHTUSERDATA:
+        case LUA_TUSERDATA:
+            p = lua_touserdata(L, arg);
+            err = keyadd(L, kb, "u", 1);
+            if(err) return err;
+            if(lua_type(L, arg) == LUA_TUSERDATA)
+                {
+                lua_pushvalue(L, arg);
+                lua_rawseti(L, kb->refs, lua_rawlen(L, kb->refs) + 1);
+                }
+            return keyadd(L, kb, &p, sizeof(p));
+        case LUA_TTABLE: return keytable(L, kb, arg, depth);
+        default: return ERR_VALUE;
+        }
+    return ERR_VALUE;
+    }
+
+int pushinfokey(lua_State *L, int arg, const char *tag, const VkAllocationCallbacks *allocator)
+/* Pushes the key for the create info at arg, followed by the table of the objects it
+ * references. Returns 0 on success, or an ERR_XXX code if the create info can not be
+ * serialized (in this case nothing is pushed). */
+    {
+    int err;
+    keybuf_t kb;
+    memset(&kb, 0, sizeof(kb));
+    lua_newtable(L);
+    kb.refs = lua_gettop(L);
+    err = keyadd(L, &kb, tag, strlen(tag) + 1);
+    if(!err) err = keyadd(L, &kb, &allocator, sizeof(allocator));
+    if(!err) err = keyvalue(L, &kb, arg, 0);
+    if(err)
+        { lua_pop(L, 1); if(kb.data) Free(L, kb.data); return err; }
+    lua_pushlstring(L, kb.data, kb.len);
+    Free(L, kb.data);
+    lua_insert(L, -2);
+    return 0;
+    }
+
 /*------------------------------------------------------------------------------*
  | Internal error codes                                                         |
  *------------------------------------------------------------------------------*/
@@ -78,6 +78,12 @@
  *        the Lua stack at index 'arg', allocates a fresh struct, sets it with
  *        the value and returns it. See ZCHECK for more details.
  *
+ * VkXxx* zcheckarraybufVkXxx(lua_State *L, int arg, VkXxx *buf, uint32_t bufcount, uint32_t *count, int *err);
+ *        Same as zcheckarrayVkXxx(), but uses the caller-provided buf (e.g. a small array
+ *        on the stack) if the list has no more than bufcount elements. The returned array
+ *        must be freed with zfreearrayVkXxx(L, p, count, p != buf), i.e. its contents are
+ *        always freed, but the array itself only if it is not buf.
+ *
  * int    zpushVkXxx(luaState *L, VkXxx *p);
  *        Similar to the standard lua_pushxxx() functions. Pushes on the Lua stack
  *        the value contained in the passed struct p. See ZPUSH for more details.
@@ -92,7 +98,7 @@
  *        The 'base' parameters controls the freeing of the base struct(s):
  *        - if base=0, the base struct is not freed (only its contents are)
  *        - if base!=0, the base struct is freed together with its contents.
- *        (Outside of this module always set base=1).
+ *        (Outside of this module always set base=1, except for zcheckarraybuf arrays).
  *
  * For internal use only:
  * void   zclearVkXxx(luaState *L, VkXxx *p);           --> see ZCLEAR
@@ -128,9 +134,17 @@ static int pushfield(lua_State *L, int arg, const char *sname)
 #define prependfield(name_) \
     do { lua_pushfstring(L, "%s.%s", (name_), lua_tostring(L, -1)); lua_remove(L, -2); } while(0)
 
-/* ZCHECK - Must be implemented for structs that have to be passed from Lua to C */
+/* ZCHECK - Must be implemented for structs that have to be passed from Lua to C.
+ * The body is actually that of zcheckintoVkXxx(), which sets the struct pointed to by p
+ * if p is not NULL (the struct must be zeroed and its sType set, as done by znewarray()
+ * and zinitarray()), or a fresh one otherwise. This allows the array versions to fill
+ * the elements in place, without allocating a temporary struct for each of them.
+ */
 #define ZCHECK_BEGIN(VkXxx) \
-    VkXxx* zcheck##VkXxx(lua_State *L, int arg, int *err) { VkXxx *p; int arg1;
+    static VkXxx* zcheckinto##VkXxx(lua_State *L, int arg, VkXxx *p, int *err);     \
+    VkXxx* zcheck##VkXxx(lua_State *L, int arg, int *err)                           \
+        { return zcheckinto##VkXxx(L, arg, NULL, err); }                            \
+    static VkXxx* zcheckinto##VkXxx(lua_State *L, int arg, VkXxx *p, int *err) { int arg1;
 #define ZCHECK_END  (void)arg1; *err=0; return p; }
 
 /* ZPUSH - Must be implemented for structs that have to be passed from C to Lua */
@@ -264,7 +278,7 @@ static int checktable_(lua_State *L, int arg)
         { lua_pushstring(L, errstring(ERR_TABLE)); return ERR_TABLE; }
     return 0;
     }
-#define newstruct(VkXxx) if((p = znew##VkXxx(L, err))==NULL) return NULL /* also sets sType */
+#define newstruct(VkXxx) if(!p && (p = znew##VkXxx(L, err))==NULL) return NULL /* also sets sType */
 
 static int ispresent_(lua_State *L, int arg, const char *sname)
 #define ispresent(sname_) ispresent_(L, arg, (sname_))
@@ -900,10 +914,10 @@ static const char *GetString_(lua_State *L, int arg, const char *sname, const ch
  */
 
 #define ZCHECKARRAY(VkXxx)                                                  \
-VkXxx* zcheckarray##VkXxx(lua_State *L, int arg, uint32_t *count, int *err) \
+VkXxx* zcheckarraybuf##VkXxx(lua_State *L, int arg, VkXxx *buf, uint32_t bufcount, uint32_t *count, int *err) \
     {                                                                       \
     int arg_;                                                               \
-    VkXxx *list, *tmp;                                                      \
+    VkXxx *list;                                                            \
     uint32_t i;                                                             \
     *count = 0;                                                             \
     *err = 0;                                                               \
@@ -914,20 +928,21 @@ VkXxx* zcheckarray##VkXxx(lua_State *L, int arg, uint32_t *count, int *err) \
     *count = lua_rawlen(L, arg);                                            \
     if(*count == 0)                                                         \
         { *err = ERR_EMPTY; lua_pushfstring(L, ": %s", errstring(*err)); return NULL; } \
-    list = znewarray##VkXxx(L, *count, err);                                \
+    if(buf && *count <= bufcount)                                           \
+        list = zinitarray##VkXxx(buf, *count);                              \
+    else                                                                    \
+        list = znewarray##VkXxx(L, *count, err);                            \
     if(!list)                                                               \
         { *count = 0; lua_pushfstring(L, ": %s", errstring(*err)); return NULL; }\
     for(i=0; i<*count; i++)                                                 \
         {                                                                   \
         lua_rawgeti(L, arg, i+1);                                           \
         arg_ = lua_gettop(L);                                               \
-        tmp = zcheck##VkXxx(L, arg_, err);                                  \
-        if(tmp)                                                             \
-            { memcpy(&list[i], tmp, sizeof(VkXxx)); Free(L, tmp); }         \
+        (void)zcheckinto##VkXxx(L, arg_, &list[i], err);                    \
         lua_remove(L, arg_);                                                \
         if(*err)                                                            \
             {                                                               \
-            zfreearray##VkXxx(L, list, *count, 1);                          \
+            zfreearray##VkXxx(L, list, *count, list != buf);                \
             *count = 0;                                                     \
             /* an error message has been already pushed by zcheckVkXxx() */ \
             lua_pushfstring(L, "%d.%s", i+1, lua_tostring(L, -1));          \
@@ -937,7 +952,9 @@ VkXxx* zcheckarray##VkXxx(lua_State *L, int arg, uint32_t *count, int *err) \
             }                                                               \
         }                                                                   \
     return list;                                                            \
-    }
+    }                                                                       \
+VkXxx* zcheckarray##VkXxx(lua_State *L, int arg, uint32_t *count, int *err) \
+    { return zcheckarraybuf##VkXxx(L, arg, NULL, 0, count, err); }
 
 /* Get a variable length list of VkXxxx elements, defined in the parent structure as:
  * uint32_t nameCount;
@@ -2170,6 +2187,19 @@ LOCALCHECK_END
 LOCALCHECK_BEGIN(PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT, VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT)
     GetBoolean(pageableDeviceLocalMemory, "pageable_device_local_memory");
 LOCALCHECK_END
+#ifdef VK_EXT_shader_object
+LOCALCHECK_BEGIN(PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT, VkPhysicalDeviceShaderObjectFeaturesEXT)
+    GetBoolean(shaderObject, "shader_object");
+LOCALCHECK_END
+#endif
+#ifdef VK_EXT_descriptor_buffer
+LOCALCHECK_BEGIN(PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT, VkPhysicalDeviceDescriptorBufferFeaturesEXT)
+    GetBoolean(descriptorBuffer, "descriptor_buffer");
+    GetBoolean(descriptorBufferCaptureReplay, "descriptor_buffer_capture_replay");
+    GetBoolean(descriptorBufferImageLayoutIgnored, "descriptor_buffer_image_layout_ignored");
+    GetBoolean(descriptorBufferPushDescriptors, "descriptor_buffer_push_descriptors");
+LOCALCHECK_END
+#endif
 
 #if 0 // 9yy scaffolding
 LOCALCHECK_BEGIN(, )
@@ -2262,6 +2292,12 @@ ZINIT_BEGIN(VkPhysicalDeviceFeatures2)
         ADDX(PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT, VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT);
         ADDX(PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT, VkPhysicalDeviceBorderColorSwizzleFeaturesEXT);
         ADDX(PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT, VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT);
+#ifdef VK_EXT_shader_object
+        ADDX(PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT, VkPhysicalDeviceShaderObjectFeaturesEXT);
+#endif
+#ifdef VK_EXT_descriptor_buffer
+        ADDX(PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT, VkPhysicalDeviceDescriptorBufferFeaturesEXT);
+#endif
     EXTENSIONS_END
 ZINIT_END
 
@@ -2358,6 +2394,12 @@ ZCHECK_BEGIN(VkPhysicalDeviceFeatures2)
         ADD(VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT);
         ADD(VkPhysicalDeviceBorderColorSwizzleFeaturesEXT);
         ADD(VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT);
+#ifdef VK_EXT_shader_object
+        ADD(VkPhysicalDeviceShaderObjectFeaturesEXT);
+#endif
+#ifdef VK_EXT_descriptor_buffer
+        ADD(VkPhysicalDeviceDescriptorBufferFeaturesEXT);
+#endif
     #undef ADD
     EXTENSIONS_END
 ZCHECK_END
@@ -2746,6 +2788,19 @@ LOCALPUSH_END
 LOCALPUSH_BEGIN(VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT)
     SetBoolean(pageableDeviceLocalMemory, "pageable_device_local_memory");
 LOCALPUSH_END
+#ifdef VK_EXT_shader_object
+LOCALPUSH_BEGIN(VkPhysicalDeviceShaderObjectFeaturesEXT)
+    SetBoolean(shaderObject, "shader_object");
+LOCALPUSH_END
+#endif
+#ifdef VK_EXT_descriptor_buffer
+LOCALPUSH_BEGIN(VkPhysicalDeviceDescriptorBufferFeaturesEXT)
+    SetBoolean(descriptorBuffer, "descriptor_buffer");
+    SetBoolean(descriptorBufferCaptureReplay, "descriptor_buffer_capture_replay");
+    SetBoolean(descriptorBufferImageLayoutIgnored, "descriptor_buffer_image_layout_ignored");
+    SetBoolean(descriptorBufferPushDescriptors, "descriptor_buffer_push_descriptors");
+LOCALPUSH_END
+#endif
 
 ZPUSH_BEGIN(VkPhysicalDeviceFeatures)
     lua_newtable(L);
@@ -2834,6 +2889,12 @@ ZPUSH_BEGIN(VkPhysicalDeviceFeatures2)
         XCASE(PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT, VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT);
         XCASE(PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT, VkPhysicalDeviceBorderColorSwizzleFeaturesEXT);
         XCASE(PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT, VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT);
+#ifdef VK_EXT_shader_object
+        XCASE(PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT, VkPhysicalDeviceShaderObjectFeaturesEXT);
+#endif
+#ifdef VK_EXT_descriptor_buffer
+        XCASE(PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT, VkPhysicalDeviceDescriptorBufferFeaturesEXT);
+#endif
     XPUSH_END
 ZPUSH_END
 
@@ -4179,7 +4240,7 @@ ZCLEAR_END
 
 //ZCHECK_BEGIN(VkDeviceCreateInfo)
 VkDeviceCreateInfo* zcheckVkDeviceCreateInfo(lua_State *L, int arg, int *err, ud_t *ud) { //non-standard
-    VkDeviceCreateInfo *p;
+    VkDeviceCreateInfo *p = NULL;
     int arg1;
     checktable(arg);
     newstruct(VkDeviceCreateInfo);
@@ -5463,7 +5524,7 @@ static ZCLEAR_BEGIN(VkPresentInfoKHR)
 ZCLEAR_END
 //ZCHECK_BEGIN(VkPresentInfoKHR)
 VkPresentInfoKHR* zcheckVkPresentInfoKHR(lua_State *L, int arg, int *err, int results) { //non-standard
-    VkPresentInfoKHR *p;
+    VkPresentInfoKHR *p = NULL;
     int arg1;
     uint32_t count;
     checktable(arg);
@@ -6333,6 +6394,38 @@ ZCHECK_BEGIN(VkPipelineShaderStageCreateInfo)
 ZCHECK_END
 ZCHECKARRAY(VkPipelineShaderStageCreateInfo)
 
+#ifdef VK_EXT_shader_object
+/*------------------------------------------------------------------------------*
+ | Shader Object                                                                |
+ *------------------------------------------------------------------------------*/
+
+static ZCLEAR_BEGIN(VkShaderCreateInfoEXT)
+    if(p->pName) Free(L, (void*)p->pName);
+    FreeObjectList(pSetLayouts);
+    FreeList(pPushConstantRanges, pushConstantRangeCount, VkPushConstantRange);
+    FreeStructp(pSpecializationInfo, VkSpecializationInfo);
+ZCLEAR_END
+ZCHECK_BEGIN(VkShaderCreateInfoEXT)
+    checktable(arg);
+    newstruct(VkShaderCreateInfoEXT);
+    GetFlags(flags, "flags");
+    GetBits(stage, "stage", VkShaderStageFlagBits);
+    GetFlags(nextStage, "next_stage");
+    GetEnumOpt(codeType, "code_type", testshadercodetype, VK_SHADER_CODE_TYPE_SPIRV_EXT);
+    /* p->pCode, p->codeSize: retrieved by the caller */
+    GetStringDef(pName, "name", "main");
+    GetObjectList(pSetLayouts, setLayoutCount, descriptor_set_layout, "set_layouts");
+    GetListOpt(pPushConstantRanges, pushConstantRangeCount, VkPushConstantRange, "push_constant_ranges");
+    GetStructp(pSpecializationInfo, VkSpecializationInfo, "specialization_info");
+    EXTENSIONS_BEGIN
+    if(ispresent("required_subgroup_size"))
+        ADD_EXTENSION_INLINE(VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT);
+    EXTENSIONS_END
+ZCHECK_END
+ZCHECKARRAY(VkShaderCreateInfoEXT)
+
+#endif /* VK_EXT_shader_object */
+
 /*------------------------------------------------------------------------------*
  | Compute Pipeline                                                             |
  *------------------------------------------------------------------------------*/
@@ -6726,12 +6819,23 @@ ZCHECK_BEGIN(VkGraphicsPipelineCreateInfo)
     checktable(arg);
     newstruct(VkGraphicsPipelineCreateInfo);
     GetFlags(flags, "flags");
-    GetPipelineLayout(layout, "layout");
-    GetRenderPass(renderPass, "render_pass");
+/* pipeline library parts (VK_EXT_graphics_pipeline_library) need only some of the states */
+#define LIBRARY ((p->flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR) != 0)
+    if(LIBRARY)
+        GetPipelineLayoutOpt(layout, "layout");
+    else
+        GetPipelineLayout(layout, "layout");
+    if(LIBRARY)
+        GetRenderPassOpt(renderPass, "render_pass");
+    else
+        GetRenderPass(renderPass, "render_pass");
     GetInteger(subpass, "subpass");
     GetPipelineOpt(basePipelineHandle, "base_pipeline_handle");
     GetIntegerOpt(basePipelineIndex, "base_pipeline_index", -1);
-    GetList(pStages, stageCount, VkPipelineShaderStageCreateInfo, "stages");
+    if(LIBRARY)
+        GetListOpt(pStages, stageCount, VkPipelineShaderStageCreateInfo, "stages");
+    else
+        GetList(pStages, stageCount, VkPipelineShaderStageCreateInfo, "stages");
 #define GET(name_, sname_, VkXxx, mandatory_)  do {            \
     arg1 = pushfield(L, arg, sname_);                        \
     p->name_ = zcheck##VkXxx(L, arg1, err);                  \
@@ -6739,16 +6843,17 @@ ZCHECK_BEGIN(VkGraphicsPipelineCreateInfo)
     if(*err<0) { prependfield(sname_); return p; }           \
     else if((mandatory_) && *err==ERR_NOTPRESENT) poperror();\
 } while(0)
-    GET(pVertexInputState, "vertex_input_state", VkPipelineVertexInputStateCreateInfo, 1);
-    GET(pInputAssemblyState, "input_assembly_state", VkPipelineInputAssemblyStateCreateInfo, 1);
+    GET(pVertexInputState, "vertex_input_state", VkPipelineVertexInputStateCreateInfo, !LIBRARY);
+    GET(pInputAssemblyState, "input_assembly_state", VkPipelineInputAssemblyStateCreateInfo, !LIBRARY);
     GET(pTessellationState, "tessellation_state", VkPipelineTessellationStateCreateInfo, 0);
     GET(pViewportState, "viewport_state", VkPipelineViewportStateCreateInfo, 0);
-    GET(pRasterizationState, "rasterization_state", VkPipelineRasterizationStateCreateInfo, 1);
+    GET(pRasterizationState, "rasterization_state", VkPipelineRasterizationStateCreateInfo, !LIBRARY);
     GET(pMultisampleState, "multisample_state", VkPipelineMultisampleStateCreateInfo, 0);
     GET(pDepthStencilState, "depth_stencil_state", VkPipelineDepthStencilStateCreateInfo, 0);
     GET(pColorBlendState, "color_blend_state", VkPipelineColorBlendStateCreateInfo, 0);
     GET(pDynamicState, "dynamic_state", VkPipelineDynamicStateCreateInfo, 0);
 #undef GET
+#undef LIBRARY
     EXTENSIONS_BEGIN
         ADD_EXTENSION_STRUCT("discard_rectangle_state", VkPipelineDiscardRectangleStateCreateInfoEXT);
         ADD_EXTENSION_STRUCT("creation_feedback_state", VkPipelineCreationFeedbackCreateInfoEXT);
@@ -6797,6 +6902,23 @@ void* znewarray(lua_State *L, VkStructureType sType, size_t sz, uint32_t count,
     return p;
     }
 
+void* zinitarray(void *p, VkStructureType sType, size_t sz, uint32_t count)
+/* Same as znewarray(), but for a caller-provided array (see zcheckarraybufVkXxx()) */
+    {
+    uint32_t i;
+    uintptr_t pp = (uintptr_t)p;
+    memset(p, 0, sz*count);
+    if(sType != (VkStructureType)-1)
+        {
+        for(i=0; i < count; i++)
+            {
+            ((VkBaseOutStructure*)pp)->sType = sType;
+            pp = pp + sz;
+            }
+        }
+    return p;
+    }
+
 void zfree_untyped(lua_State *L, const void *p, int base, void (*clearfunc)(lua_State *L, const void *p))
     { 
     if(!p) return;
@@ -6865,6 +6987,9 @@ static void zfreeaux(lua_State *L, void *pp)
         CASE(DESCRIPTOR_SET_ALLOCATE_INFO, VkDescriptorSetAllocateInfo);
         CASE(DESCRIPTOR_SET_LAYOUT_CREATE_INFO, VkDescriptorSetLayoutCreateInfo);
         CASE(PIPELINE_LAYOUT_CREATE_INFO, VkPipelineLayoutCreateInfo);
+#ifdef VK_EXT_shader_object
+        CASE(SHADER_CREATE_INFO_EXT, VkShaderCreateInfoEXT);
+#endif
         CASE(RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO_KHR, VkRenderPassInputAttachmentAspectCreateInfoKHR);
         CASE(RENDER_PASS_CREATE_INFO, VkRenderPassCreateInfo);
         CASE(FRAMEBUFFER_CREATE_INFO, VkFramebufferCreateInfo);
@@ -7,6 +7,8 @@
 void* znew(lua_State *L, VkStructureType sType /* or -1 */, size_t sz, int *err);
 #define znewarray moonvulkan_znewarray
 void* znewarray(lua_State *L, VkStructureType sType /* or -1 */, size_t sz, uint32_t count, int *err);
+#define zinitarray moonvulkan_zinitarray
+void* zinitarray(void *p, VkStructureType sType /* or -1 */, size_t sz, uint32_t count);
 
 /* Untyped structs only: */
 #define zfree_untyped moonvulkan_zfree_untyped
@@ -26,6 +28,7 @@ void zfreearray(lua_State *L, const void *p, size_t sz, uint32_t count, int base
 
 #define znewVkInstanceCreateInfo(L, err) (VkInstanceCreateInfo*)znew((L), VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO, sizeof(VkInstanceCreateInfo), (err))
 #define znewarrayVkInstanceCreateInfo(L, count, err) (VkInstanceCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO, sizeof(VkInstanceCreateInfo), (count), (err))
+#define zinitarrayVkInstanceCreateInfo(p, count) (VkInstanceCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO, sizeof(VkInstanceCreateInfo), (count))
 #define znewchainVkInstanceCreateInfo moonvulkan_znewchainVkInstanceCreateInfo
 VkInstanceCreateInfo* znewchainVkInstanceCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkInstanceCreateInfo moonvulkan_znewchainarrayVkInstanceCreateInfo
@@ -34,6 +37,8 @@ VkInstanceCreateInfo* znewchainarrayVkInstanceCreateInfo(lua_State *L, uint32_t
 VkInstanceCreateInfo* zcheckVkInstanceCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkInstanceCreateInfo moonvulkan_zcheckarrayVkInstanceCreateInfo
 VkInstanceCreateInfo* zcheckarrayVkInstanceCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkInstanceCreateInfo moonvulkan_zcheckarraybufVkInstanceCreateInfo
+VkInstanceCreateInfo* zcheckarraybufVkInstanceCreateInfo(lua_State *L, int arg, VkInstanceCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkInstanceCreateInfo moonvulkan_zinitVkInstanceCreateInfo
 int zinitVkInstanceCreateInfo(lua_State *L, VkInstanceCreateInfo* p, int *err);
 #define zfreeVkInstanceCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -43,6 +48,7 @@ int zpushVkInstanceCreateInfo(lua_State *L, const VkInstanceCreateInfo *p);
 
 #define znewVkApplicationInfo(L, err) (VkApplicationInfo*)znew((L), VK_STRUCTURE_TYPE_APPLICATION_INFO, sizeof(VkApplicationInfo), (err))
 #define znewarrayVkApplicationInfo(L, count, err) (VkApplicationInfo*)znewarray((L), VK_STRUCTURE_TYPE_APPLICATION_INFO, sizeof(VkApplicationInfo), (count), (err))
+#define zinitarrayVkApplicationInfo(p, count) (VkApplicationInfo*)zinitarray((p), VK_STRUCTURE_TYPE_APPLICATION_INFO, sizeof(VkApplicationInfo), (count))
 #define znewchainVkApplicationInfo moonvulkan_znewchainVkApplicationInfo
 VkApplicationInfo* znewchainVkApplicationInfo(lua_State *L, int *err);
 #define znewchainarrayVkApplicationInfo moonvulkan_znewchainarrayVkApplicationInfo
@@ -51,6 +57,8 @@ VkApplicationInfo* znewchainarrayVkApplicationInfo(lua_State *L, uint32_t count,
 VkApplicationInfo* zcheckVkApplicationInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkApplicationInfo moonvulkan_zcheckarrayVkApplicationInfo
 VkApplicationInfo* zcheckarrayVkApplicationInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkApplicationInfo moonvulkan_zcheckarraybufVkApplicationInfo
+VkApplicationInfo* zcheckarraybufVkApplicationInfo(lua_State *L, int arg, VkApplicationInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkApplicationInfo moonvulkan_zinitVkApplicationInfo
 int zinitVkApplicationInfo(lua_State *L, VkApplicationInfo* p, int *err);
 #define zfreeVkApplicationInfo(L, p, base) zfree((L), (p), (base))
@@ -60,6 +68,7 @@ int zpushVkApplicationInfo(lua_State *L, const VkApplicationInfo *p);
 
 #define znewVkValidationFlagsEXT(L, err) (VkValidationFlagsEXT*)znew((L), VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT, sizeof(VkValidationFlagsEXT), (err))
 #define znewarrayVkValidationFlagsEXT(L, count, err) (VkValidationFlagsEXT*)znewarray((L), VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT, sizeof(VkValidationFlagsEXT), (count), (err))
+#define zinitarrayVkValidationFlagsEXT(p, count) (VkValidationFlagsEXT*)zinitarray((p), VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT, sizeof(VkValidationFlagsEXT), (count))
 #define znewchainVkValidationFlagsEXT moonvulkan_znewchainVkValidationFlagsEXT
 VkValidationFlagsEXT* znewchainVkValidationFlagsEXT(lua_State *L, int *err);
 #define znewchainarrayVkValidationFlagsEXT moonvulkan_znewchainarrayVkValidationFlagsEXT
@@ -68,6 +77,8 @@ VkValidationFlagsEXT* znewchainarrayVkValidationFlagsEXT(lua_State *L, uint32_t
 VkValidationFlagsEXT* zcheckVkValidationFlagsEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkValidationFlagsEXT moonvulkan_zcheckarrayVkValidationFlagsEXT
 VkValidationFlagsEXT* zcheckarrayVkValidationFlagsEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkValidationFlagsEXT moonvulkan_zcheckarraybufVkValidationFlagsEXT
+VkValidationFlagsEXT* zcheckarraybufVkValidationFlagsEXT(lua_State *L, int arg, VkValidationFlagsEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkValidationFlagsEXT moonvulkan_zinitVkValidationFlagsEXT
 int zinitVkValidationFlagsEXT(lua_State *L, VkValidationFlagsEXT* p, int *err);
 #define zfreeVkValidationFlagsEXT(L, p, base) zfree((L), (p), (base))
@@ -77,6 +88,7 @@ int zpushVkValidationFlagsEXT(lua_State *L, const VkValidationFlagsEXT *p);
 
 #define znewVkDeviceCreateInfo(L, err) (VkDeviceCreateInfo*)znew((L), VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO, sizeof(VkDeviceCreateInfo), (err))
 #define znewarrayVkDeviceCreateInfo(L, count, err) (VkDeviceCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO, sizeof(VkDeviceCreateInfo), (count), (err))
+#define zinitarrayVkDeviceCreateInfo(p, count) (VkDeviceCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO, sizeof(VkDeviceCreateInfo), (count))
 #define znewchainVkDeviceCreateInfo moonvulkan_znewchainVkDeviceCreateInfo
 VkDeviceCreateInfo* znewchainVkDeviceCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkDeviceCreateInfo moonvulkan_znewchainarrayVkDeviceCreateInfo
@@ -85,6 +97,8 @@ VkDeviceCreateInfo* znewchainarrayVkDeviceCreateInfo(lua_State *L, uint32_t coun
 VkDeviceCreateInfo* zcheckVkDeviceCreateInfo(lua_State *L, int arg, int *err, ud_t *ud); //non-standard
 #define zcheckarrayVkDeviceCreateInfo moonvulkan_zcheckarrayVkDeviceCreateInfo
 VkDeviceCreateInfo* zcheckarrayVkDeviceCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceCreateInfo moonvulkan_zcheckarraybufVkDeviceCreateInfo
+VkDeviceCreateInfo* zcheckarraybufVkDeviceCreateInfo(lua_State *L, int arg, VkDeviceCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceCreateInfo moonvulkan_zinitVkDeviceCreateInfo
 int zinitVkDeviceCreateInfo(lua_State *L, VkDeviceCreateInfo* p, int *err);
 #define zfreeVkDeviceCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -94,6 +108,7 @@ int zpushVkDeviceCreateInfo(lua_State *L, const VkDeviceCreateInfo *p);
 
 #define znewVkDeviceQueueCreateInfo(L, err) (VkDeviceQueueCreateInfo*)znew((L), VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO, sizeof(VkDeviceQueueCreateInfo), (err))
 #define znewarrayVkDeviceQueueCreateInfo(L, count, err) (VkDeviceQueueCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO, sizeof(VkDeviceQueueCreateInfo), (count), (err))
+#define zinitarrayVkDeviceQueueCreateInfo(p, count) (VkDeviceQueueCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO, sizeof(VkDeviceQueueCreateInfo), (count))
 #define znewchainVkDeviceQueueCreateInfo moonvulkan_znewchainVkDeviceQueueCreateInfo
 VkDeviceQueueCreateInfo* znewchainVkDeviceQueueCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkDeviceQueueCreateInfo moonvulkan_znewchainarrayVkDeviceQueueCreateInfo
@@ -102,6 +117,8 @@ VkDeviceQueueCreateInfo* znewchainarrayVkDeviceQueueCreateInfo(lua_State *L, uin
 VkDeviceQueueCreateInfo* zcheckVkDeviceQueueCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceQueueCreateInfo moonvulkan_zcheckarrayVkDeviceQueueCreateInfo
 VkDeviceQueueCreateInfo* zcheckarrayVkDeviceQueueCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceQueueCreateInfo moonvulkan_zcheckarraybufVkDeviceQueueCreateInfo
+VkDeviceQueueCreateInfo* zcheckarraybufVkDeviceQueueCreateInfo(lua_State *L, int arg, VkDeviceQueueCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceQueueCreateInfo moonvulkan_zinitVkDeviceQueueCreateInfo
 int zinitVkDeviceQueueCreateInfo(lua_State *L, VkDeviceQueueCreateInfo* p, int *err);
 #define zfreeVkDeviceQueueCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -111,6 +128,7 @@ int zpushVkDeviceQueueCreateInfo(lua_State *L, const VkDeviceQueueCreateInfo *p)
 
 #define znewVkCommandPoolCreateInfo(L, err) (VkCommandPoolCreateInfo*)znew((L), VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO, sizeof(VkCommandPoolCreateInfo), (err))
 #define znewarrayVkCommandPoolCreateInfo(L, count, err) (VkCommandPoolCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO, sizeof(VkCommandPoolCreateInfo), (count), (err))
+#define zinitarrayVkCommandPoolCreateInfo(p, count) (VkCommandPoolCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO, sizeof(VkCommandPoolCreateInfo), (count))
 #define znewchainVkCommandPoolCreateInfo moonvulkan_znewchainVkCommandPoolCreateInfo
 VkCommandPoolCreateInfo* znewchainVkCommandPoolCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkCommandPoolCreateInfo moonvulkan_znewchainarrayVkCommandPoolCreateInfo
@@ -119,6 +137,8 @@ VkCommandPoolCreateInfo* znewchainarrayVkCommandPoolCreateInfo(lua_State *L, uin
 VkCommandPoolCreateInfo* zcheckVkCommandPoolCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCommandPoolCreateInfo moonvulkan_zcheckarrayVkCommandPoolCreateInfo
 VkCommandPoolCreateInfo* zcheckarrayVkCommandPoolCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCommandPoolCreateInfo moonvulkan_zcheckarraybufVkCommandPoolCreateInfo
+VkCommandPoolCreateInfo* zcheckarraybufVkCommandPoolCreateInfo(lua_State *L, int arg, VkCommandPoolCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCommandPoolCreateInfo moonvulkan_zinitVkCommandPoolCreateInfo
 int zinitVkCommandPoolCreateInfo(lua_State *L, VkCommandPoolCreateInfo* p, int *err);
 #define zfreeVkCommandPoolCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -128,6 +148,7 @@ int zpushVkCommandPoolCreateInfo(lua_State *L, const VkCommandPoolCreateInfo *p)
 
 #define znewVkCommandBufferAllocateInfo(L, err) (VkCommandBufferAllocateInfo*)znew((L), VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, sizeof(VkCommandBufferAllocateInfo), (err))
 #define znewarrayVkCommandBufferAllocateInfo(L, count, err) (VkCommandBufferAllocateInfo*)znewarray((L), VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, sizeof(VkCommandBufferAllocateInfo), (count), (err))
+#define zinitarrayVkCommandBufferAllocateInfo(p, count) (VkCommandBufferAllocateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, sizeof(VkCommandBufferAllocateInfo), (count))
 #define znewchainVkCommandBufferAllocateInfo moonvulkan_znewchainVkCommandBufferAllocateInfo
 VkCommandBufferAllocateInfo* znewchainVkCommandBufferAllocateInfo(lua_State *L, int *err);
 #define znewchainarrayVkCommandBufferAllocateInfo moonvulkan_znewchainarrayVkCommandBufferAllocateInfo
@@ -136,6 +157,8 @@ VkCommandBufferAllocateInfo* znewchainarrayVkCommandBufferAllocateInfo(lua_State
 VkCommandBufferAllocateInfo* zcheckVkCommandBufferAllocateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCommandBufferAllocateInfo moonvulkan_zcheckarrayVkCommandBufferAllocateInfo
 VkCommandBufferAllocateInfo* zcheckarrayVkCommandBufferAllocateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCommandBufferAllocateInfo moonvulkan_zcheckarraybufVkCommandBufferAllocateInfo
+VkCommandBufferAllocateInfo* zcheckarraybufVkCommandBufferAllocateInfo(lua_State *L, int arg, VkCommandBufferAllocateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCommandBufferAllocateInfo moonvulkan_zinitVkCommandBufferAllocateInfo
 int zinitVkCommandBufferAllocateInfo(lua_State *L, VkCommandBufferAllocateInfo* p, int *err);
 #define zfreeVkCommandBufferAllocateInfo(L, p, base) zfree((L), (p), (base))
@@ -145,6 +168,7 @@ int zpushVkCommandBufferAllocateInfo(lua_State *L, const VkCommandBufferAllocate
 
 #define znewVkCommandBufferInheritanceInfo(L, err) (VkCommandBufferInheritanceInfo*)znew((L), VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO, sizeof(VkCommandBufferInheritanceInfo), (err))
 #define znewarrayVkCommandBufferInheritanceInfo(L, count, err) (VkCommandBufferInheritanceInfo*)znewarray((L), VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO, sizeof(VkCommandBufferInheritanceInfo), (count), (err))
+#define zinitarrayVkCommandBufferInheritanceInfo(p, count) (VkCommandBufferInheritanceInfo*)zinitarray((p), VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO, sizeof(VkCommandBufferInheritanceInfo), (count))
 #define znewchainVkCommandBufferInheritanceInfo moonvulkan_znewchainVkCommandBufferInheritanceInfo
 VkCommandBufferInheritanceInfo* znewchainVkCommandBufferInheritanceInfo(lua_State *L, int *err);
 #define znewchainarrayVkCommandBufferInheritanceInfo moonvulkan_znewchainarrayVkCommandBufferInheritanceInfo
@@ -153,6 +177,8 @@ VkCommandBufferInheritanceInfo* znewchainarrayVkCommandBufferInheritanceInfo(lua
 VkCommandBufferInheritanceInfo* zcheckVkCommandBufferInheritanceInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCommandBufferInheritanceInfo moonvulkan_zcheckarrayVkCommandBufferInheritanceInfo
 VkCommandBufferInheritanceInfo* zcheckarrayVkCommandBufferInheritanceInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCommandBufferInheritanceInfo moonvulkan_zcheckarraybufVkCommandBufferInheritanceInfo
+VkCommandBufferInheritanceInfo* zcheckarraybufVkCommandBufferInheritanceInfo(lua_State *L, int arg, VkCommandBufferInheritanceInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCommandBufferInheritanceInfo moonvulkan_zinitVkCommandBufferInheritanceInfo
 int zinitVkCommandBufferInheritanceInfo(lua_State *L, VkCommandBufferInheritanceInfo* p, int *err);
 #define zfreeVkCommandBufferInheritanceInfo(L, p, base) zfree((L), (p), (base))
@@ -162,6 +188,7 @@ int zpushVkCommandBufferInheritanceInfo(lua_State *L, const VkCommandBufferInher
 
 #define znewVkCommandBufferInheritanceConditionalRenderingInfoEXT(L, err) (VkCommandBufferInheritanceConditionalRenderingInfoEXT*)znew((L), VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT, sizeof(VkCommandBufferInheritanceConditionalRenderingInfoEXT), (err))
 #define znewarrayVkCommandBufferInheritanceConditionalRenderingInfoEXT(L, count, err) (VkCommandBufferInheritanceConditionalRenderingInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT, sizeof(VkCommandBufferInheritanceConditionalRenderingInfoEXT), (count), (err))
+#define zinitarrayVkCommandBufferInheritanceConditionalRenderingInfoEXT(p, count) (VkCommandBufferInheritanceConditionalRenderingInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT, sizeof(VkCommandBufferInheritanceConditionalRenderingInfoEXT), (count))
 #define znewchainVkCommandBufferInheritanceConditionalRenderingInfoEXT moonvulkan_znewchainVkCommandBufferInheritanceConditionalRenderingInfoEXT
 VkCommandBufferInheritanceConditionalRenderingInfoEXT* znewchainVkCommandBufferInheritanceConditionalRenderingInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkCommandBufferInheritanceConditionalRenderingInfoEXT moonvulkan_znewchainarrayVkCommandBufferInheritanceConditionalRenderingInfoEXT
@@ -170,6 +197,8 @@ VkCommandBufferInheritanceConditionalRenderingInfoEXT* znewchainarrayVkCommandBu
 VkCommandBufferInheritanceConditionalRenderingInfoEXT* zcheckVkCommandBufferInheritanceConditionalRenderingInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCommandBufferInheritanceConditionalRenderingInfoEXT moonvulkan_zcheckarrayVkCommandBufferInheritanceConditionalRenderingInfoEXT
 VkCommandBufferInheritanceConditionalRenderingInfoEXT* zcheckarrayVkCommandBufferInheritanceConditionalRenderingInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCommandBufferInheritanceConditionalRenderingInfoEXT moonvulkan_zcheckarraybufVkCommandBufferInheritanceConditionalRenderingInfoEXT
+VkCommandBufferInheritanceConditionalRenderingInfoEXT* zcheckarraybufVkCommandBufferInheritanceConditionalRenderingInfoEXT(lua_State *L, int arg, VkCommandBufferInheritanceConditionalRenderingInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCommandBufferInheritanceConditionalRenderingInfoEXT moonvulkan_zinitVkCommandBufferInheritanceConditionalRenderingInfoEXT
 int zinitVkCommandBufferInheritanceConditionalRenderingInfoEXT(lua_State *L, VkCommandBufferInheritanceConditionalRenderingInfoEXT* p, int *err);
 #define zfreeVkCommandBufferInheritanceConditionalRenderingInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -179,6 +208,7 @@ int zpushVkCommandBufferInheritanceConditionalRenderingInfoEXT(lua_State *L, con
 
 #define znewVkExternalMemoryBufferCreateInfo(L, err) (VkExternalMemoryBufferCreateInfo*)znew((L), VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO, sizeof(VkExternalMemoryBufferCreateInfo), (err))
 #define znewarrayVkExternalMemoryBufferCreateInfo(L, count, err) (VkExternalMemoryBufferCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO, sizeof(VkExternalMemoryBufferCreateInfo), (count), (err))
+#define zinitarrayVkExternalMemoryBufferCreateInfo(p, count) (VkExternalMemoryBufferCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO, sizeof(VkExternalMemoryBufferCreateInfo), (count))
 #define znewchainVkExternalMemoryBufferCreateInfo moonvulkan_znewchainVkExternalMemoryBufferCreateInfo
 VkExternalMemoryBufferCreateInfo* znewchainVkExternalMemoryBufferCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkExternalMemoryBufferCreateInfo moonvulkan_znewchainarrayVkExternalMemoryBufferCreateInfo
@@ -187,6 +217,8 @@ VkExternalMemoryBufferCreateInfo* znewchainarrayVkExternalMemoryBufferCreateInfo
 VkExternalMemoryBufferCreateInfo* zcheckVkExternalMemoryBufferCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExternalMemoryBufferCreateInfo moonvulkan_zcheckarrayVkExternalMemoryBufferCreateInfo
 VkExternalMemoryBufferCreateInfo* zcheckarrayVkExternalMemoryBufferCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExternalMemoryBufferCreateInfo moonvulkan_zcheckarraybufVkExternalMemoryBufferCreateInfo
+VkExternalMemoryBufferCreateInfo* zcheckarraybufVkExternalMemoryBufferCreateInfo(lua_State *L, int arg, VkExternalMemoryBufferCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExternalMemoryBufferCreateInfo moonvulkan_zinitVkExternalMemoryBufferCreateInfo
 int zinitVkExternalMemoryBufferCreateInfo(lua_State *L, VkExternalMemoryBufferCreateInfo* p, int *err);
 #define zfreeVkExternalMemoryBufferCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -196,6 +228,7 @@ int zpushVkExternalMemoryBufferCreateInfo(lua_State *L, const VkExternalMemoryBu
 
 #define znewVkDeviceQueueGlobalPriorityCreateInfoEXT(L, err) (VkDeviceQueueGlobalPriorityCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_EXT, sizeof(VkDeviceQueueGlobalPriorityCreateInfoEXT), (err))
 #define znewarrayVkDeviceQueueGlobalPriorityCreateInfoEXT(L, count, err) (VkDeviceQueueGlobalPriorityCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_EXT, sizeof(VkDeviceQueueGlobalPriorityCreateInfoEXT), (count), (err))
+#define zinitarrayVkDeviceQueueGlobalPriorityCreateInfoEXT(p, count) (VkDeviceQueueGlobalPriorityCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_EXT, sizeof(VkDeviceQueueGlobalPriorityCreateInfoEXT), (count))
 #define znewchainVkDeviceQueueGlobalPriorityCreateInfoEXT moonvulkan_znewchainVkDeviceQueueGlobalPriorityCreateInfoEXT
 VkDeviceQueueGlobalPriorityCreateInfoEXT* znewchainVkDeviceQueueGlobalPriorityCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkDeviceQueueGlobalPriorityCreateInfoEXT moonvulkan_znewchainarrayVkDeviceQueueGlobalPriorityCreateInfoEXT
@@ -204,6 +237,8 @@ VkDeviceQueueGlobalPriorityCreateInfoEXT* znewchainarrayVkDeviceQueueGlobalPrior
 VkDeviceQueueGlobalPriorityCreateInfoEXT* zcheckVkDeviceQueueGlobalPriorityCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceQueueGlobalPriorityCreateInfoEXT moonvulkan_zcheckarrayVkDeviceQueueGlobalPriorityCreateInfoEXT
 VkDeviceQueueGlobalPriorityCreateInfoEXT* zcheckarrayVkDeviceQueueGlobalPriorityCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceQueueGlobalPriorityCreateInfoEXT moonvulkan_zcheckarraybufVkDeviceQueueGlobalPriorityCreateInfoEXT
+VkDeviceQueueGlobalPriorityCreateInfoEXT* zcheckarraybufVkDeviceQueueGlobalPriorityCreateInfoEXT(lua_State *L, int arg, VkDeviceQueueGlobalPriorityCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceQueueGlobalPriorityCreateInfoEXT moonvulkan_zinitVkDeviceQueueGlobalPriorityCreateInfoEXT
 int zinitVkDeviceQueueGlobalPriorityCreateInfoEXT(lua_State *L, VkDeviceQueueGlobalPriorityCreateInfoEXT* p, int *err);
 #define zfreeVkDeviceQueueGlobalPriorityCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -213,6 +248,7 @@ int zpushVkDeviceQueueGlobalPriorityCreateInfoEXT(lua_State *L, const VkDeviceQu
 
 #define znewVkCommandBufferBeginInfo(L, err) (VkCommandBufferBeginInfo*)znew((L), VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO, sizeof(VkCommandBufferBeginInfo), (err))
 #define znewarrayVkCommandBufferBeginInfo(L, count, err) (VkCommandBufferBeginInfo*)znewarray((L), VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO, sizeof(VkCommandBufferBeginInfo), (count), (err))
+#define zinitarrayVkCommandBufferBeginInfo(p, count) (VkCommandBufferBeginInfo*)zinitarray((p), VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO, sizeof(VkCommandBufferBeginInfo), (count))
 #define znewchainVkCommandBufferBeginInfo moonvulkan_znewchainVkCommandBufferBeginInfo
 VkCommandBufferBeginInfo* znewchainVkCommandBufferBeginInfo(lua_State *L, int *err);
 #define znewchainarrayVkCommandBufferBeginInfo moonvulkan_znewchainarrayVkCommandBufferBeginInfo
@@ -221,6 +257,8 @@ VkCommandBufferBeginInfo* znewchainarrayVkCommandBufferBeginInfo(lua_State *L, u
 VkCommandBufferBeginInfo* zcheckVkCommandBufferBeginInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCommandBufferBeginInfo moonvulkan_zcheckarrayVkCommandBufferBeginInfo
 VkCommandBufferBeginInfo* zcheckarrayVkCommandBufferBeginInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCommandBufferBeginInfo moonvulkan_zcheckarraybufVkCommandBufferBeginInfo
+VkCommandBufferBeginInfo* zcheckarraybufVkCommandBufferBeginInfo(lua_State *L, int arg, VkCommandBufferBeginInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCommandBufferBeginInfo moonvulkan_zinitVkCommandBufferBeginInfo
 int zinitVkCommandBufferBeginInfo(lua_State *L, VkCommandBufferBeginInfo* p, int *err);
 #define zfreeVkCommandBufferBeginInfo(L, p, base) zfree((L), (p), (base))
@@ -230,6 +268,7 @@ int zpushVkCommandBufferBeginInfo(lua_State *L, const VkCommandBufferBeginInfo *
 
 #define znewVkBufferCreateInfo(L, err) (VkBufferCreateInfo*)znew((L), VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO, sizeof(VkBufferCreateInfo), (err))
 #define znewarrayVkBufferCreateInfo(L, count, err) (VkBufferCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO, sizeof(VkBufferCreateInfo), (count), (err))
+#define zinitarrayVkBufferCreateInfo(p, count) (VkBufferCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO, sizeof(VkBufferCreateInfo), (count))
 #define znewchainVkBufferCreateInfo moonvulkan_znewchainVkBufferCreateInfo
 VkBufferCreateInfo* znewchainVkBufferCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkBufferCreateInfo moonvulkan_znewchainarrayVkBufferCreateInfo
@@ -238,6 +277,8 @@ VkBufferCreateInfo* znewchainarrayVkBufferCreateInfo(lua_State *L, uint32_t coun
 VkBufferCreateInfo* zcheckVkBufferCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBufferCreateInfo moonvulkan_zcheckarrayVkBufferCreateInfo
 VkBufferCreateInfo* zcheckarrayVkBufferCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBufferCreateInfo moonvulkan_zcheckarraybufVkBufferCreateInfo
+VkBufferCreateInfo* zcheckarraybufVkBufferCreateInfo(lua_State *L, int arg, VkBufferCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBufferCreateInfo moonvulkan_zinitVkBufferCreateInfo
 int zinitVkBufferCreateInfo(lua_State *L, VkBufferCreateInfo* p, int *err);
 #define zfreeVkBufferCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -247,6 +288,7 @@ int zpushVkBufferCreateInfo(lua_State *L, const VkBufferCreateInfo *p);
 
 #define znewVkBufferViewCreateInfo(L, err) (VkBufferViewCreateInfo*)znew((L), VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO, sizeof(VkBufferViewCreateInfo), (err))
 #define znewarrayVkBufferViewCreateInfo(L, count, err) (VkBufferViewCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO, sizeof(VkBufferViewCreateInfo), (count), (err))
+#define zinitarrayVkBufferViewCreateInfo(p, count) (VkBufferViewCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO, sizeof(VkBufferViewCreateInfo), (count))
 #define znewchainVkBufferViewCreateInfo moonvulkan_znewchainVkBufferViewCreateInfo
 VkBufferViewCreateInfo* znewchainVkBufferViewCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkBufferViewCreateInfo moonvulkan_znewchainarrayVkBufferViewCreateInfo
@@ -255,6 +297,8 @@ VkBufferViewCreateInfo* znewchainarrayVkBufferViewCreateInfo(lua_State *L, uint3
 VkBufferViewCreateInfo* zcheckVkBufferViewCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBufferViewCreateInfo moonvulkan_zcheckarrayVkBufferViewCreateInfo
 VkBufferViewCreateInfo* zcheckarrayVkBufferViewCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBufferViewCreateInfo moonvulkan_zcheckarraybufVkBufferViewCreateInfo
+VkBufferViewCreateInfo* zcheckarraybufVkBufferViewCreateInfo(lua_State *L, int arg, VkBufferViewCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBufferViewCreateInfo moonvulkan_zinitVkBufferViewCreateInfo
 int zinitVkBufferViewCreateInfo(lua_State *L, VkBufferViewCreateInfo* p, int *err);
 #define zfreeVkBufferViewCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -264,6 +308,7 @@ int zpushVkBufferViewCreateInfo(lua_State *L, const VkBufferViewCreateInfo *p);
 
 #define znewVkPhysicalDeviceFeatures2(L, err) (VkPhysicalDeviceFeatures2*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, sizeof(VkPhysicalDeviceFeatures2), (err))
 #define znewarrayVkPhysicalDeviceFeatures2(L, count, err) (VkPhysicalDeviceFeatures2*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, sizeof(VkPhysicalDeviceFeatures2), (count), (err))
+#define zinitarrayVkPhysicalDeviceFeatures2(p, count) (VkPhysicalDeviceFeatures2*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, sizeof(VkPhysicalDeviceFeatures2), (count))
 #define znewchainVkPhysicalDeviceFeatures2 moonvulkan_znewchainVkPhysicalDeviceFeatures2
 VkPhysicalDeviceFeatures2* znewchainVkPhysicalDeviceFeatures2(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceFeatures2 moonvulkan_znewchainarrayVkPhysicalDeviceFeatures2
@@ -272,6 +317,8 @@ VkPhysicalDeviceFeatures2* znewchainarrayVkPhysicalDeviceFeatures2(lua_State *L,
 VkPhysicalDeviceFeatures2* zcheckVkPhysicalDeviceFeatures2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceFeatures2 moonvulkan_zcheckarrayVkPhysicalDeviceFeatures2
 VkPhysicalDeviceFeatures2* zcheckarrayVkPhysicalDeviceFeatures2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceFeatures2 moonvulkan_zcheckarraybufVkPhysicalDeviceFeatures2
+VkPhysicalDeviceFeatures2* zcheckarraybufVkPhysicalDeviceFeatures2(lua_State *L, int arg, VkPhysicalDeviceFeatures2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceFeatures2 moonvulkan_zinitVkPhysicalDeviceFeatures2
 int zinitVkPhysicalDeviceFeatures2(lua_State *L, VkPhysicalDeviceFeatures2* p, int *err);
 #define zfreeVkPhysicalDeviceFeatures2(L, p, base) zfree((L), (p), (base))
@@ -281,6 +328,7 @@ int zpushVkPhysicalDeviceFeatures2(lua_State *L, const VkPhysicalDeviceFeatures2
 
 #define znewVkPhysicalDeviceProperties2(L, err) (VkPhysicalDeviceProperties2*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, sizeof(VkPhysicalDeviceProperties2), (err))
 #define znewarrayVkPhysicalDeviceProperties2(L, count, err) (VkPhysicalDeviceProperties2*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, sizeof(VkPhysicalDeviceProperties2), (count), (err))
+#define zinitarrayVkPhysicalDeviceProperties2(p, count) (VkPhysicalDeviceProperties2*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, sizeof(VkPhysicalDeviceProperties2), (count))
 #define znewchainVkPhysicalDeviceProperties2 moonvulkan_znewchainVkPhysicalDeviceProperties2
 VkPhysicalDeviceProperties2* znewchainVkPhysicalDeviceProperties2(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceProperties2 moonvulkan_znewchainarrayVkPhysicalDeviceProperties2
@@ -289,6 +337,8 @@ VkPhysicalDeviceProperties2* znewchainarrayVkPhysicalDeviceProperties2(lua_State
 VkPhysicalDeviceProperties2* zcheckVkPhysicalDeviceProperties2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceProperties2 moonvulkan_zcheckarrayVkPhysicalDeviceProperties2
 VkPhysicalDeviceProperties2* zcheckarrayVkPhysicalDeviceProperties2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceProperties2 moonvulkan_zcheckarraybufVkPhysicalDeviceProperties2
+VkPhysicalDeviceProperties2* zcheckarraybufVkPhysicalDeviceProperties2(lua_State *L, int arg, VkPhysicalDeviceProperties2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceProperties2 moonvulkan_zinitVkPhysicalDeviceProperties2
 int zinitVkPhysicalDeviceProperties2(lua_State *L, VkPhysicalDeviceProperties2* p, int *err);
 #define zfreeVkPhysicalDeviceProperties2(L, p, base) zfree((L), (p), (base))
@@ -298,6 +348,7 @@ int zpushVkPhysicalDeviceProperties2(lua_State *L, const VkPhysicalDevicePropert
 
 #define znewVkFormatProperties2(L, err) (VkFormatProperties2*)znew((L), VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2, sizeof(VkFormatProperties2), (err))
 #define znewarrayVkFormatProperties2(L, count, err) (VkFormatProperties2*)znewarray((L), VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2, sizeof(VkFormatProperties2), (count), (err))
+#define zinitarrayVkFormatProperties2(p, count) (VkFormatProperties2*)zinitarray((p), VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2, sizeof(VkFormatProperties2), (count))
 #define znewchainVkFormatProperties2 moonvulkan_znewchainVkFormatProperties2
 VkFormatProperties2* znewchainVkFormatProperties2(lua_State *L, int *err);
 #define znewchainarrayVkFormatProperties2 moonvulkan_znewchainarrayVkFormatProperties2
@@ -306,6 +357,8 @@ VkFormatProperties2* znewchainarrayVkFormatProperties2(lua_State *L, uint32_t co
 VkFormatProperties2* zcheckVkFormatProperties2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkFormatProperties2 moonvulkan_zcheckarrayVkFormatProperties2
 VkFormatProperties2* zcheckarrayVkFormatProperties2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkFormatProperties2 moonvulkan_zcheckarraybufVkFormatProperties2
+VkFormatProperties2* zcheckarraybufVkFormatProperties2(lua_State *L, int arg, VkFormatProperties2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkFormatProperties2 moonvulkan_zinitVkFormatProperties2
 int zinitVkFormatProperties2(lua_State *L, VkFormatProperties2* p, int *err);
 #define zfreeVkFormatProperties2(L, p, base) zfree((L), (p), (base))
@@ -315,6 +368,7 @@ int zpushVkFormatProperties2(lua_State *L, const VkFormatProperties2 *p);
 
 #define znewVkImageFormatProperties2(L, err) (VkImageFormatProperties2*)znew((L), VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2, sizeof(VkImageFormatProperties2), (err))
 #define znewarrayVkImageFormatProperties2(L, count, err) (VkImageFormatProperties2*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2, sizeof(VkImageFormatProperties2), (count), (err))
+#define zinitarrayVkImageFormatProperties2(p, count) (VkImageFormatProperties2*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2, sizeof(VkImageFormatProperties2), (count))
 #define znewchainVkImageFormatProperties2 moonvulkan_znewchainVkImageFormatProperties2
 VkImageFormatProperties2* znewchainVkImageFormatProperties2(lua_State *L, int *err);
 #define znewchainarrayVkImageFormatProperties2 moonvulkan_znewchainarrayVkImageFormatProperties2
@@ -323,6 +377,8 @@ VkImageFormatProperties2* znewchainarrayVkImageFormatProperties2(lua_State *L, u
 VkImageFormatProperties2* zcheckVkImageFormatProperties2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageFormatProperties2 moonvulkan_zcheckarrayVkImageFormatProperties2
 VkImageFormatProperties2* zcheckarrayVkImageFormatProperties2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageFormatProperties2 moonvulkan_zcheckarraybufVkImageFormatProperties2
+VkImageFormatProperties2* zcheckarraybufVkImageFormatProperties2(lua_State *L, int arg, VkImageFormatProperties2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageFormatProperties2 moonvulkan_zinitVkImageFormatProperties2
 int zinitVkImageFormatProperties2(lua_State *L, VkImageFormatProperties2* p, int *err);
 #define zfreeVkImageFormatProperties2(L, p, base) zfree((L), (p), (base))
@@ -332,6 +388,7 @@ int zpushVkImageFormatProperties2(lua_State *L, const VkImageFormatProperties2 *
 
 #define znewVkSparseImageFormatProperties2(L, err) (VkSparseImageFormatProperties2*)znew((L), VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2, sizeof(VkSparseImageFormatProperties2), (err))
 #define znewarrayVkSparseImageFormatProperties2(L, count, err) (VkSparseImageFormatProperties2*)znewarray((L), VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2, sizeof(VkSparseImageFormatProperties2), (count), (err))
+#define zinitarrayVkSparseImageFormatProperties2(p, count) (VkSparseImageFormatProperties2*)zinitarray((p), VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2, sizeof(VkSparseImageFormatProperties2), (count))
 #define znewchainVkSparseImageFormatProperties2 moonvulkan_znewchainVkSparseImageFormatProperties2
 VkSparseImageFormatProperties2* znewchainVkSparseImageFormatProperties2(lua_State *L, int *err);
 #define znewchainarrayVkSparseImageFormatProperties2 moonvulkan_znewchainarrayVkSparseImageFormatProperties2
@@ -340,6 +397,8 @@ VkSparseImageFormatProperties2* znewchainarrayVkSparseImageFormatProperties2(lua
 VkSparseImageFormatProperties2* zcheckVkSparseImageFormatProperties2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSparseImageFormatProperties2 moonvulkan_zcheckarrayVkSparseImageFormatProperties2
 VkSparseImageFormatProperties2* zcheckarrayVkSparseImageFormatProperties2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSparseImageFormatProperties2 moonvulkan_zcheckarraybufVkSparseImageFormatProperties2
+VkSparseImageFormatProperties2* zcheckarraybufVkSparseImageFormatProperties2(lua_State *L, int arg, VkSparseImageFormatProperties2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSparseImageFormatProperties2 moonvulkan_zinitVkSparseImageFormatProperties2
 int zinitVkSparseImageFormatProperties2(lua_State *L, VkSparseImageFormatProperties2* p, int *err);
 #define zfreeVkSparseImageFormatProperties2(L, p, base) zfree((L), (p), (base))
@@ -349,6 +408,7 @@ int zpushVkSparseImageFormatProperties2(lua_State *L, const VkSparseImageFormatP
 
 #define znewVkPhysicalDeviceMemoryProperties2(L, err) (VkPhysicalDeviceMemoryProperties2*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2, sizeof(VkPhysicalDeviceMemoryProperties2), (err))
 #define znewarrayVkPhysicalDeviceMemoryProperties2(L, count, err) (VkPhysicalDeviceMemoryProperties2*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2, sizeof(VkPhysicalDeviceMemoryProperties2), (count), (err))
+#define zinitarrayVkPhysicalDeviceMemoryProperties2(p, count) (VkPhysicalDeviceMemoryProperties2*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2, sizeof(VkPhysicalDeviceMemoryProperties2), (count))
 #define znewchainVkPhysicalDeviceMemoryProperties2 moonvulkan_znewchainVkPhysicalDeviceMemoryProperties2
 VkPhysicalDeviceMemoryProperties2* znewchainVkPhysicalDeviceMemoryProperties2(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceMemoryProperties2 moonvulkan_znewchainarrayVkPhysicalDeviceMemoryProperties2
@@ -357,6 +417,8 @@ VkPhysicalDeviceMemoryProperties2* znewchainarrayVkPhysicalDeviceMemoryPropertie
 VkPhysicalDeviceMemoryProperties2* zcheckVkPhysicalDeviceMemoryProperties2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceMemoryProperties2 moonvulkan_zcheckarrayVkPhysicalDeviceMemoryProperties2
 VkPhysicalDeviceMemoryProperties2* zcheckarrayVkPhysicalDeviceMemoryProperties2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceMemoryProperties2 moonvulkan_zcheckarraybufVkPhysicalDeviceMemoryProperties2
+VkPhysicalDeviceMemoryProperties2* zcheckarraybufVkPhysicalDeviceMemoryProperties2(lua_State *L, int arg, VkPhysicalDeviceMemoryProperties2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceMemoryProperties2 moonvulkan_zinitVkPhysicalDeviceMemoryProperties2
 int zinitVkPhysicalDeviceMemoryProperties2(lua_State *L, VkPhysicalDeviceMemoryProperties2* p, int *err);
 #define zfreeVkPhysicalDeviceMemoryProperties2(L, p, base) zfree((L), (p), (base))
@@ -366,6 +428,7 @@ int zpushVkPhysicalDeviceMemoryProperties2(lua_State *L, const VkPhysicalDeviceM
 
 #define znewVkMemoryRequirements2(L, err) (VkMemoryRequirements2*)znew((L), VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2, sizeof(VkMemoryRequirements2), (err))
 #define znewarrayVkMemoryRequirements2(L, count, err) (VkMemoryRequirements2*)znewarray((L), VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2, sizeof(VkMemoryRequirements2), (count), (err))
+#define zinitarrayVkMemoryRequirements2(p, count) (VkMemoryRequirements2*)zinitarray((p), VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2, sizeof(VkMemoryRequirements2), (count))
 #define znewchainVkMemoryRequirements2 moonvulkan_znewchainVkMemoryRequirements2
 VkMemoryRequirements2* znewchainVkMemoryRequirements2(lua_State *L, int *err);
 #define znewchainarrayVkMemoryRequirements2 moonvulkan_znewchainarrayVkMemoryRequirements2
@@ -374,6 +437,8 @@ VkMemoryRequirements2* znewchainarrayVkMemoryRequirements2(lua_State *L, uint32_
 VkMemoryRequirements2* zcheckVkMemoryRequirements2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryRequirements2 moonvulkan_zcheckarrayVkMemoryRequirements2
 VkMemoryRequirements2* zcheckarrayVkMemoryRequirements2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryRequirements2 moonvulkan_zcheckarraybufVkMemoryRequirements2
+VkMemoryRequirements2* zcheckarraybufVkMemoryRequirements2(lua_State *L, int arg, VkMemoryRequirements2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryRequirements2 moonvulkan_zinitVkMemoryRequirements2
 int zinitVkMemoryRequirements2(lua_State *L, VkMemoryRequirements2* p, int *err);
 #define zfreeVkMemoryRequirements2(L, p, base) zfree((L), (p), (base))
@@ -383,6 +448,7 @@ int zpushVkMemoryRequirements2(lua_State *L, const VkMemoryRequirements2 *p);
 
 #define znewVkSparseImageMemoryRequirements2(L, err) (VkSparseImageMemoryRequirements2*)znew((L), VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2, sizeof(VkSparseImageMemoryRequirements2), (err))
 #define znewarrayVkSparseImageMemoryRequirements2(L, count, err) (VkSparseImageMemoryRequirements2*)znewarray((L), VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2, sizeof(VkSparseImageMemoryRequirements2), (count), (err))
+#define zinitarrayVkSparseImageMemoryRequirements2(p, count) (VkSparseImageMemoryRequirements2*)zinitarray((p), VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2, sizeof(VkSparseImageMemoryRequirements2), (count))
 #define znewchainVkSparseImageMemoryRequirements2 moonvulkan_znewchainVkSparseImageMemoryRequirements2
 VkSparseImageMemoryRequirements2* znewchainVkSparseImageMemoryRequirements2(lua_State *L, int *err);
 #define znewchainarrayVkSparseImageMemoryRequirements2 moonvulkan_znewchainarrayVkSparseImageMemoryRequirements2
@@ -391,6 +457,8 @@ VkSparseImageMemoryRequirements2* znewchainarrayVkSparseImageMemoryRequirements2
 VkSparseImageMemoryRequirements2* zcheckVkSparseImageMemoryRequirements2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSparseImageMemoryRequirements2 moonvulkan_zcheckarrayVkSparseImageMemoryRequirements2
 VkSparseImageMemoryRequirements2* zcheckarrayVkSparseImageMemoryRequirements2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSparseImageMemoryRequirements2 moonvulkan_zcheckarraybufVkSparseImageMemoryRequirements2
+VkSparseImageMemoryRequirements2* zcheckarraybufVkSparseImageMemoryRequirements2(lua_State *L, int arg, VkSparseImageMemoryRequirements2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSparseImageMemoryRequirements2 moonvulkan_zinitVkSparseImageMemoryRequirements2
 int zinitVkSparseImageMemoryRequirements2(lua_State *L, VkSparseImageMemoryRequirements2* p, int *err);
 #define zfreeVkSparseImageMemoryRequirements2(L, p, base) zfree((L), (p), (base))
@@ -400,6 +468,7 @@ int zpushVkSparseImageMemoryRequirements2(lua_State *L, const VkSparseImageMemor
 
 #define znewVkSurfaceCapabilities2KHR(L, err) (VkSurfaceCapabilities2KHR*)znew((L), VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR, sizeof(VkSurfaceCapabilities2KHR), (err))
 #define znewarrayVkSurfaceCapabilities2KHR(L, count, err) (VkSurfaceCapabilities2KHR*)znewarray((L), VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR, sizeof(VkSurfaceCapabilities2KHR), (count), (err))
+#define zinitarrayVkSurfaceCapabilities2KHR(p, count) (VkSurfaceCapabilities2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR, sizeof(VkSurfaceCapabilities2KHR), (count))
 #define znewchainVkSurfaceCapabilities2KHR moonvulkan_znewchainVkSurfaceCapabilities2KHR
 VkSurfaceCapabilities2KHR* znewchainVkSurfaceCapabilities2KHR(lua_State *L, int *err);
 #define znewchainarrayVkSurfaceCapabilities2KHR moonvulkan_znewchainarrayVkSurfaceCapabilities2KHR
@@ -408,6 +477,8 @@ VkSurfaceCapabilities2KHR* znewchainarrayVkSurfaceCapabilities2KHR(lua_State *L,
 VkSurfaceCapabilities2KHR* zcheckVkSurfaceCapabilities2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSurfaceCapabilities2KHR moonvulkan_zcheckarrayVkSurfaceCapabilities2KHR
 VkSurfaceCapabilities2KHR* zcheckarrayVkSurfaceCapabilities2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSurfaceCapabilities2KHR moonvulkan_zcheckarraybufVkSurfaceCapabilities2KHR
+VkSurfaceCapabilities2KHR* zcheckarraybufVkSurfaceCapabilities2KHR(lua_State *L, int arg, VkSurfaceCapabilities2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSurfaceCapabilities2KHR moonvulkan_zinitVkSurfaceCapabilities2KHR
 int zinitVkSurfaceCapabilities2KHR(lua_State *L, VkSurfaceCapabilities2KHR* p, int *err);
 #define zfreeVkSurfaceCapabilities2KHR(L, p, base) zfree((L), (p), (base))
@@ -417,6 +488,7 @@ int zpushVkSurfaceCapabilities2KHR(lua_State *L, const VkSurfaceCapabilities2KHR
 
 #define znewVkSurfaceFormat2KHR(L, err) (VkSurfaceFormat2KHR*)znew((L), VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR, sizeof(VkSurfaceFormat2KHR), (err))
 #define znewarrayVkSurfaceFormat2KHR(L, count, err) (VkSurfaceFormat2KHR*)znewarray((L), VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR, sizeof(VkSurfaceFormat2KHR), (count), (err))
+#define zinitarrayVkSurfaceFormat2KHR(p, count) (VkSurfaceFormat2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR, sizeof(VkSurfaceFormat2KHR), (count))
 #define znewchainVkSurfaceFormat2KHR moonvulkan_znewchainVkSurfaceFormat2KHR
 VkSurfaceFormat2KHR* znewchainVkSurfaceFormat2KHR(lua_State *L, int *err);
 #define znewchainarrayVkSurfaceFormat2KHR moonvulkan_znewchainarrayVkSurfaceFormat2KHR
@@ -425,6 +497,8 @@ VkSurfaceFormat2KHR* znewchainarrayVkSurfaceFormat2KHR(lua_State *L, uint32_t co
 VkSurfaceFormat2KHR* zcheckVkSurfaceFormat2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSurfaceFormat2KHR moonvulkan_zcheckarrayVkSurfaceFormat2KHR
 VkSurfaceFormat2KHR* zcheckarrayVkSurfaceFormat2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSurfaceFormat2KHR moonvulkan_zcheckarraybufVkSurfaceFormat2KHR
+VkSurfaceFormat2KHR* zcheckarraybufVkSurfaceFormat2KHR(lua_State *L, int arg, VkSurfaceFormat2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSurfaceFormat2KHR moonvulkan_zinitVkSurfaceFormat2KHR
 int zinitVkSurfaceFormat2KHR(lua_State *L, VkSurfaceFormat2KHR* p, int *err);
 #define zfreeVkSurfaceFormat2KHR(L, p, base) zfree((L), (p), (base))
@@ -434,6 +508,7 @@ int zpushVkSurfaceFormat2KHR(lua_State *L, const VkSurfaceFormat2KHR *p);
 
 #define znewVkQueueFamilyProperties2(L, err) (VkQueueFamilyProperties2*)znew((L), VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2, sizeof(VkQueueFamilyProperties2), (err))
 #define znewarrayVkQueueFamilyProperties2(L, count, err) (VkQueueFamilyProperties2*)znewarray((L), VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2, sizeof(VkQueueFamilyProperties2), (count), (err))
+#define zinitarrayVkQueueFamilyProperties2(p, count) (VkQueueFamilyProperties2*)zinitarray((p), VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2, sizeof(VkQueueFamilyProperties2), (count))
 #define znewchainVkQueueFamilyProperties2 moonvulkan_znewchainVkQueueFamilyProperties2
 VkQueueFamilyProperties2* znewchainVkQueueFamilyProperties2(lua_State *L, int *err);
 #define znewchainarrayVkQueueFamilyProperties2 moonvulkan_znewchainarrayVkQueueFamilyProperties2
@@ -442,6 +517,8 @@ VkQueueFamilyProperties2* znewchainarrayVkQueueFamilyProperties2(lua_State *L, u
 VkQueueFamilyProperties2* zcheckVkQueueFamilyProperties2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkQueueFamilyProperties2 moonvulkan_zcheckarrayVkQueueFamilyProperties2
 VkQueueFamilyProperties2* zcheckarrayVkQueueFamilyProperties2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkQueueFamilyProperties2 moonvulkan_zcheckarraybufVkQueueFamilyProperties2
+VkQueueFamilyProperties2* zcheckarraybufVkQueueFamilyProperties2(lua_State *L, int arg, VkQueueFamilyProperties2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkQueueFamilyProperties2 moonvulkan_zinitVkQueueFamilyProperties2
 int zinitVkQueueFamilyProperties2(lua_State *L, VkQueueFamilyProperties2* p, int *err);
 #define zfreeVkQueueFamilyProperties2(L, p, base) zfree((L), (p), (base))
@@ -451,6 +528,7 @@ int zpushVkQueueFamilyProperties2(lua_State *L, const VkQueueFamilyProperties2 *
 
 #define znewVkImageFormatListCreateInfo(L, err) (VkImageFormatListCreateInfo*)znew((L), VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO, sizeof(VkImageFormatListCreateInfo), (err))
 #define znewarrayVkImageFormatListCreateInfo(L, count, err) (VkImageFormatListCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO, sizeof(VkImageFormatListCreateInfo), (count), (err))
+#define zinitarrayVkImageFormatListCreateInfo(p, count) (VkImageFormatListCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO, sizeof(VkImageFormatListCreateInfo), (count))
 #define znewchainVkImageFormatListCreateInfo moonvulkan_znewchainVkImageFormatListCreateInfo
 VkImageFormatListCreateInfo* znewchainVkImageFormatListCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkImageFormatListCreateInfo moonvulkan_znewchainarrayVkImageFormatListCreateInfo
@@ -459,6 +537,8 @@ VkImageFormatListCreateInfo* znewchainarrayVkImageFormatListCreateInfo(lua_State
 VkImageFormatListCreateInfo* zcheckVkImageFormatListCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageFormatListCreateInfo moonvulkan_zcheckarrayVkImageFormatListCreateInfo
 VkImageFormatListCreateInfo* zcheckarrayVkImageFormatListCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageFormatListCreateInfo moonvulkan_zcheckarraybufVkImageFormatListCreateInfo
+VkImageFormatListCreateInfo* zcheckarraybufVkImageFormatListCreateInfo(lua_State *L, int arg, VkImageFormatListCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageFormatListCreateInfo moonvulkan_zinitVkImageFormatListCreateInfo
 int zinitVkImageFormatListCreateInfo(lua_State *L, VkImageFormatListCreateInfo* p, int *err);
 #define zfreeVkImageFormatListCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -468,6 +548,7 @@ int zpushVkImageFormatListCreateInfo(lua_State *L, const VkImageFormatListCreate
 
 #define znewVkExternalMemoryImageCreateInfoKHR(L, err) (VkExternalMemoryImageCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_KHR, sizeof(VkExternalMemoryImageCreateInfoKHR), (err))
 #define znewarrayVkExternalMemoryImageCreateInfoKHR(L, count, err) (VkExternalMemoryImageCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_KHR, sizeof(VkExternalMemoryImageCreateInfoKHR), (count), (err))
+#define zinitarrayVkExternalMemoryImageCreateInfoKHR(p, count) (VkExternalMemoryImageCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_KHR, sizeof(VkExternalMemoryImageCreateInfoKHR), (count))
 #define znewchainVkExternalMemoryImageCreateInfoKHR moonvulkan_znewchainVkExternalMemoryImageCreateInfoKHR
 VkExternalMemoryImageCreateInfoKHR* znewchainVkExternalMemoryImageCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkExternalMemoryImageCreateInfoKHR moonvulkan_znewchainarrayVkExternalMemoryImageCreateInfoKHR
@@ -476,6 +557,8 @@ VkExternalMemoryImageCreateInfoKHR* znewchainarrayVkExternalMemoryImageCreateInf
 VkExternalMemoryImageCreateInfoKHR* zcheckVkExternalMemoryImageCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExternalMemoryImageCreateInfoKHR moonvulkan_zcheckarrayVkExternalMemoryImageCreateInfoKHR
 VkExternalMemoryImageCreateInfoKHR* zcheckarrayVkExternalMemoryImageCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExternalMemoryImageCreateInfoKHR moonvulkan_zcheckarraybufVkExternalMemoryImageCreateInfoKHR
+VkExternalMemoryImageCreateInfoKHR* zcheckarraybufVkExternalMemoryImageCreateInfoKHR(lua_State *L, int arg, VkExternalMemoryImageCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExternalMemoryImageCreateInfoKHR moonvulkan_zinitVkExternalMemoryImageCreateInfoKHR
 int zinitVkExternalMemoryImageCreateInfoKHR(lua_State *L, VkExternalMemoryImageCreateInfoKHR* p, int *err);
 #define zfreeVkExternalMemoryImageCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -485,6 +568,7 @@ int zpushVkExternalMemoryImageCreateInfoKHR(lua_State *L, const VkExternalMemory
 
 #define znewVkImageCreateInfo(L, err) (VkImageCreateInfo*)znew((L), VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, sizeof(VkImageCreateInfo), (err))
 #define znewarrayVkImageCreateInfo(L, count, err) (VkImageCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, sizeof(VkImageCreateInfo), (count), (err))
+#define zinitarrayVkImageCreateInfo(p, count) (VkImageCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, sizeof(VkImageCreateInfo), (count))
 #define znewchainVkImageCreateInfo moonvulkan_znewchainVkImageCreateInfo
 VkImageCreateInfo* znewchainVkImageCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkImageCreateInfo moonvulkan_znewchainarrayVkImageCreateInfo
@@ -493,6 +577,8 @@ VkImageCreateInfo* znewchainarrayVkImageCreateInfo(lua_State *L, uint32_t count,
 VkImageCreateInfo* zcheckVkImageCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageCreateInfo moonvulkan_zcheckarrayVkImageCreateInfo
 VkImageCreateInfo* zcheckarrayVkImageCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageCreateInfo moonvulkan_zcheckarraybufVkImageCreateInfo
+VkImageCreateInfo* zcheckarraybufVkImageCreateInfo(lua_State *L, int arg, VkImageCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageCreateInfo moonvulkan_zinitVkImageCreateInfo
 int zinitVkImageCreateInfo(lua_State *L, VkImageCreateInfo* p, int *err);
 #define zfreeVkImageCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -502,6 +588,7 @@ int zpushVkImageCreateInfo(lua_State *L, const VkImageCreateInfo *p);
 
 #define znewVkImageViewUsageCreateInfoKHR(L, err) (VkImageViewUsageCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO_KHR, sizeof(VkImageViewUsageCreateInfoKHR), (err))
 #define znewarrayVkImageViewUsageCreateInfoKHR(L, count, err) (VkImageViewUsageCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO_KHR, sizeof(VkImageViewUsageCreateInfoKHR), (count), (err))
+#define zinitarrayVkImageViewUsageCreateInfoKHR(p, count) (VkImageViewUsageCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO_KHR, sizeof(VkImageViewUsageCreateInfoKHR), (count))
 #define znewchainVkImageViewUsageCreateInfoKHR moonvulkan_znewchainVkImageViewUsageCreateInfoKHR
 VkImageViewUsageCreateInfoKHR* znewchainVkImageViewUsageCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkImageViewUsageCreateInfoKHR moonvulkan_znewchainarrayVkImageViewUsageCreateInfoKHR
@@ -510,6 +597,8 @@ VkImageViewUsageCreateInfoKHR* znewchainarrayVkImageViewUsageCreateInfoKHR(lua_S
 VkImageViewUsageCreateInfoKHR* zcheckVkImageViewUsageCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageViewUsageCreateInfoKHR moonvulkan_zcheckarrayVkImageViewUsageCreateInfoKHR
 VkImageViewUsageCreateInfoKHR* zcheckarrayVkImageViewUsageCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageViewUsageCreateInfoKHR moonvulkan_zcheckarraybufVkImageViewUsageCreateInfoKHR
+VkImageViewUsageCreateInfoKHR* zcheckarraybufVkImageViewUsageCreateInfoKHR(lua_State *L, int arg, VkImageViewUsageCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageViewUsageCreateInfoKHR moonvulkan_zinitVkImageViewUsageCreateInfoKHR
 int zinitVkImageViewUsageCreateInfoKHR(lua_State *L, VkImageViewUsageCreateInfoKHR* p, int *err);
 #define zfreeVkImageViewUsageCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -519,6 +608,7 @@ int zpushVkImageViewUsageCreateInfoKHR(lua_State *L, const VkImageViewUsageCreat
 
 #define znewVkImageViewCreateInfo(L, err) (VkImageViewCreateInfo*)znew((L), VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO, sizeof(VkImageViewCreateInfo), (err))
 #define znewarrayVkImageViewCreateInfo(L, count, err) (VkImageViewCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO, sizeof(VkImageViewCreateInfo), (count), (err))
+#define zinitarrayVkImageViewCreateInfo(p, count) (VkImageViewCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO, sizeof(VkImageViewCreateInfo), (count))
 #define znewchainVkImageViewCreateInfo moonvulkan_znewchainVkImageViewCreateInfo
 VkImageViewCreateInfo* znewchainVkImageViewCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkImageViewCreateInfo moonvulkan_znewchainarrayVkImageViewCreateInfo
@@ -527,6 +617,8 @@ VkImageViewCreateInfo* znewchainarrayVkImageViewCreateInfo(lua_State *L, uint32_
 VkImageViewCreateInfo* zcheckVkImageViewCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageViewCreateInfo moonvulkan_zcheckarrayVkImageViewCreateInfo
 VkImageViewCreateInfo* zcheckarrayVkImageViewCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageViewCreateInfo moonvulkan_zcheckarraybufVkImageViewCreateInfo
+VkImageViewCreateInfo* zcheckarraybufVkImageViewCreateInfo(lua_State *L, int arg, VkImageViewCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageViewCreateInfo moonvulkan_zinitVkImageViewCreateInfo
 int zinitVkImageViewCreateInfo(lua_State *L, VkImageViewCreateInfo* p, int *err);
 #define zfreeVkImageViewCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -536,6 +628,7 @@ int zpushVkImageViewCreateInfo(lua_State *L, const VkImageViewCreateInfo *p);
 
 #define znewVkDescriptorPoolCreateInfo(L, err) (VkDescriptorPoolCreateInfo*)znew((L), VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO, sizeof(VkDescriptorPoolCreateInfo), (err))
 #define znewarrayVkDescriptorPoolCreateInfo(L, count, err) (VkDescriptorPoolCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO, sizeof(VkDescriptorPoolCreateInfo), (count), (err))
+#define zinitarrayVkDescriptorPoolCreateInfo(p, count) (VkDescriptorPoolCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO, sizeof(VkDescriptorPoolCreateInfo), (count))
 #define znewchainVkDescriptorPoolCreateInfo moonvulkan_znewchainVkDescriptorPoolCreateInfo
 VkDescriptorPoolCreateInfo* znewchainVkDescriptorPoolCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkDescriptorPoolCreateInfo moonvulkan_znewchainarrayVkDescriptorPoolCreateInfo
@@ -544,6 +637,8 @@ VkDescriptorPoolCreateInfo* znewchainarrayVkDescriptorPoolCreateInfo(lua_State *
 VkDescriptorPoolCreateInfo* zcheckVkDescriptorPoolCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDescriptorPoolCreateInfo moonvulkan_zcheckarrayVkDescriptorPoolCreateInfo
 VkDescriptorPoolCreateInfo* zcheckarrayVkDescriptorPoolCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDescriptorPoolCreateInfo moonvulkan_zcheckarraybufVkDescriptorPoolCreateInfo
+VkDescriptorPoolCreateInfo* zcheckarraybufVkDescriptorPoolCreateInfo(lua_State *L, int arg, VkDescriptorPoolCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDescriptorPoolCreateInfo moonvulkan_zinitVkDescriptorPoolCreateInfo
 int zinitVkDescriptorPoolCreateInfo(lua_State *L, VkDescriptorPoolCreateInfo* p, int *err);
 #define zfreeVkDescriptorPoolCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -553,6 +648,7 @@ int zpushVkDescriptorPoolCreateInfo(lua_State *L, const VkDescriptorPoolCreateIn
 
 #define znewVkDescriptorSetAllocateInfo(L, err) (VkDescriptorSetAllocateInfo*)znew((L), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO, sizeof(VkDescriptorSetAllocateInfo), (err))
 #define znewarrayVkDescriptorSetAllocateInfo(L, count, err) (VkDescriptorSetAllocateInfo*)znewarray((L), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO, sizeof(VkDescriptorSetAllocateInfo), (count), (err))
+#define zinitarrayVkDescriptorSetAllocateInfo(p, count) (VkDescriptorSetAllocateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO, sizeof(VkDescriptorSetAllocateInfo), (count))
 #define znewchainVkDescriptorSetAllocateInfo moonvulkan_znewchainVkDescriptorSetAllocateInfo
 VkDescriptorSetAllocateInfo* znewchainVkDescriptorSetAllocateInfo(lua_State *L, int *err);
 #define znewchainarrayVkDescriptorSetAllocateInfo moonvulkan_znewchainarrayVkDescriptorSetAllocateInfo
@@ -561,6 +657,8 @@ VkDescriptorSetAllocateInfo* znewchainarrayVkDescriptorSetAllocateInfo(lua_State
 VkDescriptorSetAllocateInfo* zcheckVkDescriptorSetAllocateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDescriptorSetAllocateInfo moonvulkan_zcheckarrayVkDescriptorSetAllocateInfo
 VkDescriptorSetAllocateInfo* zcheckarrayVkDescriptorSetAllocateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDescriptorSetAllocateInfo moonvulkan_zcheckarraybufVkDescriptorSetAllocateInfo
+VkDescriptorSetAllocateInfo* zcheckarraybufVkDescriptorSetAllocateInfo(lua_State *L, int arg, VkDescriptorSetAllocateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDescriptorSetAllocateInfo moonvulkan_zinitVkDescriptorSetAllocateInfo
 int zinitVkDescriptorSetAllocateInfo(lua_State *L, VkDescriptorSetAllocateInfo* p, int *err);
 #define zfreeVkDescriptorSetAllocateInfo(L, p, base) zfree((L), (p), (base))
@@ -570,6 +668,7 @@ int zpushVkDescriptorSetAllocateInfo(lua_State *L, const VkDescriptorSetAllocate
 
 #define znewVkDescriptorSetLayoutCreateInfo(L, err) (VkDescriptorSetLayoutCreateInfo*)znew((L), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, sizeof(VkDescriptorSetLayoutCreateInfo), (err))
 #define znewarrayVkDescriptorSetLayoutCreateInfo(L, count, err) (VkDescriptorSetLayoutCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, sizeof(VkDescriptorSetLayoutCreateInfo), (count), (err))
+#define zinitarrayVkDescriptorSetLayoutCreateInfo(p, count) (VkDescriptorSetLayoutCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, sizeof(VkDescriptorSetLayoutCreateInfo), (count))
 #define znewchainVkDescriptorSetLayoutCreateInfo moonvulkan_znewchainVkDescriptorSetLayoutCreateInfo
 VkDescriptorSetLayoutCreateInfo* znewchainVkDescriptorSetLayoutCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkDescriptorSetLayoutCreateInfo moonvulkan_znewchainarrayVkDescriptorSetLayoutCreateInfo
@@ -578,6 +677,8 @@ VkDescriptorSetLayoutCreateInfo* znewchainarrayVkDescriptorSetLayoutCreateInfo(l
 VkDescriptorSetLayoutCreateInfo* zcheckVkDescriptorSetLayoutCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDescriptorSetLayoutCreateInfo moonvulkan_zcheckarrayVkDescriptorSetLayoutCreateInfo
 VkDescriptorSetLayoutCreateInfo* zcheckarrayVkDescriptorSetLayoutCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDescriptorSetLayoutCreateInfo moonvulkan_zcheckarraybufVkDescriptorSetLayoutCreateInfo
+VkDescriptorSetLayoutCreateInfo* zcheckarraybufVkDescriptorSetLayoutCreateInfo(lua_State *L, int arg, VkDescriptorSetLayoutCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDescriptorSetLayoutCreateInfo moonvulkan_zinitVkDescriptorSetLayoutCreateInfo
 int zinitVkDescriptorSetLayoutCreateInfo(lua_State *L, VkDescriptorSetLayoutCreateInfo* p, int *err);
 #define zfreeVkDescriptorSetLayoutCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -587,6 +688,7 @@ int zpushVkDescriptorSetLayoutCreateInfo(lua_State *L, const VkDescriptorSetLayo
 
 #define znewVkPipelineLayoutCreateInfo(L, err) (VkPipelineLayoutCreateInfo*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO, sizeof(VkPipelineLayoutCreateInfo), (err))
 #define znewarrayVkPipelineLayoutCreateInfo(L, count, err) (VkPipelineLayoutCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO, sizeof(VkPipelineLayoutCreateInfo), (count), (err))
+#define zinitarrayVkPipelineLayoutCreateInfo(p, count) (VkPipelineLayoutCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO, sizeof(VkPipelineLayoutCreateInfo), (count))
 #define znewchainVkPipelineLayoutCreateInfo moonvulkan_znewchainVkPipelineLayoutCreateInfo
 VkPipelineLayoutCreateInfo* znewchainVkPipelineLayoutCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkPipelineLayoutCreateInfo moonvulkan_znewchainarrayVkPipelineLayoutCreateInfo
@@ -595,6 +697,8 @@ VkPipelineLayoutCreateInfo* znewchainarrayVkPipelineLayoutCreateInfo(lua_State *
 VkPipelineLayoutCreateInfo* zcheckVkPipelineLayoutCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineLayoutCreateInfo moonvulkan_zcheckarrayVkPipelineLayoutCreateInfo
 VkPipelineLayoutCreateInfo* zcheckarrayVkPipelineLayoutCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineLayoutCreateInfo moonvulkan_zcheckarraybufVkPipelineLayoutCreateInfo
+VkPipelineLayoutCreateInfo* zcheckarraybufVkPipelineLayoutCreateInfo(lua_State *L, int arg, VkPipelineLayoutCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineLayoutCreateInfo moonvulkan_zinitVkPipelineLayoutCreateInfo
 int zinitVkPipelineLayoutCreateInfo(lua_State *L, VkPipelineLayoutCreateInfo* p, int *err);
 #define zfreeVkPipelineLayoutCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -604,6 +708,7 @@ int zpushVkPipelineLayoutCreateInfo(lua_State *L, const VkPipelineLayoutCreateIn
 
 #define znewVkQueryPoolCreateInfo(L, err) (VkQueryPoolCreateInfo*)znew((L), VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO, sizeof(VkQueryPoolCreateInfo), (err))
 #define znewarrayVkQueryPoolCreateInfo(L, count, err) (VkQueryPoolCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO, sizeof(VkQueryPoolCreateInfo), (count), (err))
+#define zinitarrayVkQueryPoolCreateInfo(p, count) (VkQueryPoolCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO, sizeof(VkQueryPoolCreateInfo), (count))
 #define znewchainVkQueryPoolCreateInfo moonvulkan_znewchainVkQueryPoolCreateInfo
 VkQueryPoolCreateInfo* znewchainVkQueryPoolCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkQueryPoolCreateInfo moonvulkan_znewchainarrayVkQueryPoolCreateInfo
@@ -612,6 +717,8 @@ VkQueryPoolCreateInfo* znewchainarrayVkQueryPoolCreateInfo(lua_State *L, uint32_
 VkQueryPoolCreateInfo* zcheckVkQueryPoolCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkQueryPoolCreateInfo moonvulkan_zcheckarrayVkQueryPoolCreateInfo
 VkQueryPoolCreateInfo* zcheckarrayVkQueryPoolCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkQueryPoolCreateInfo moonvulkan_zcheckarraybufVkQueryPoolCreateInfo
+VkQueryPoolCreateInfo* zcheckarraybufVkQueryPoolCreateInfo(lua_State *L, int arg, VkQueryPoolCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkQueryPoolCreateInfo moonvulkan_zinitVkQueryPoolCreateInfo
 int zinitVkQueryPoolCreateInfo(lua_State *L, VkQueryPoolCreateInfo* p, int *err);
 #define zfreeVkQueryPoolCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -621,6 +728,7 @@ int zpushVkQueryPoolCreateInfo(lua_State *L, const VkQueryPoolCreateInfo *p);
 
 #define znewVkRenderPassInputAttachmentAspectCreateInfoKHR(L, err) (VkRenderPassInputAttachmentAspectCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO_KHR, sizeof(VkRenderPassInputAttachmentAspectCreateInfoKHR), (err))
 #define znewarrayVkRenderPassInputAttachmentAspectCreateInfoKHR(L, count, err) (VkRenderPassInputAttachmentAspectCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO_KHR, sizeof(VkRenderPassInputAttachmentAspectCreateInfoKHR), (count), (err))
+#define zinitarrayVkRenderPassInputAttachmentAspectCreateInfoKHR(p, count) (VkRenderPassInputAttachmentAspectCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO_KHR, sizeof(VkRenderPassInputAttachmentAspectCreateInfoKHR), (count))
 #define znewchainVkRenderPassInputAttachmentAspectCreateInfoKHR moonvulkan_znewchainVkRenderPassInputAttachmentAspectCreateInfoKHR
 VkRenderPassInputAttachmentAspectCreateInfoKHR* znewchainVkRenderPassInputAttachmentAspectCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkRenderPassInputAttachmentAspectCreateInfoKHR moonvulkan_znewchainarrayVkRenderPassInputAttachmentAspectCreateInfoKHR
@@ -629,6 +737,8 @@ VkRenderPassInputAttachmentAspectCreateInfoKHR* znewchainarrayVkRenderPassInputA
 VkRenderPassInputAttachmentAspectCreateInfoKHR* zcheckVkRenderPassInputAttachmentAspectCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRenderPassInputAttachmentAspectCreateInfoKHR moonvulkan_zcheckarrayVkRenderPassInputAttachmentAspectCreateInfoKHR
 VkRenderPassInputAttachmentAspectCreateInfoKHR* zcheckarrayVkRenderPassInputAttachmentAspectCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRenderPassInputAttachmentAspectCreateInfoKHR moonvulkan_zcheckarraybufVkRenderPassInputAttachmentAspectCreateInfoKHR
+VkRenderPassInputAttachmentAspectCreateInfoKHR* zcheckarraybufVkRenderPassInputAttachmentAspectCreateInfoKHR(lua_State *L, int arg, VkRenderPassInputAttachmentAspectCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRenderPassInputAttachmentAspectCreateInfoKHR moonvulkan_zinitVkRenderPassInputAttachmentAspectCreateInfoKHR
 int zinitVkRenderPassInputAttachmentAspectCreateInfoKHR(lua_State *L, VkRenderPassInputAttachmentAspectCreateInfoKHR* p, int *err);
 #define zfreeVkRenderPassInputAttachmentAspectCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -638,6 +748,7 @@ int zpushVkRenderPassInputAttachmentAspectCreateInfoKHR(lua_State *L, const VkRe
 
 #define znewVkRenderPassCreateInfo(L, err) (VkRenderPassCreateInfo*)znew((L), VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO, sizeof(VkRenderPassCreateInfo), (err))
 #define znewarrayVkRenderPassCreateInfo(L, count, err) (VkRenderPassCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO, sizeof(VkRenderPassCreateInfo), (count), (err))
+#define zinitarrayVkRenderPassCreateInfo(p, count) (VkRenderPassCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO, sizeof(VkRenderPassCreateInfo), (count))
 #define znewchainVkRenderPassCreateInfo moonvulkan_znewchainVkRenderPassCreateInfo
 VkRenderPassCreateInfo* znewchainVkRenderPassCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkRenderPassCreateInfo moonvulkan_znewchainarrayVkRenderPassCreateInfo
@@ -646,6 +757,8 @@ VkRenderPassCreateInfo* znewchainarrayVkRenderPassCreateInfo(lua_State *L, uint3
 VkRenderPassCreateInfo* zcheckVkRenderPassCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRenderPassCreateInfo moonvulkan_zcheckarrayVkRenderPassCreateInfo
 VkRenderPassCreateInfo* zcheckarrayVkRenderPassCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRenderPassCreateInfo moonvulkan_zcheckarraybufVkRenderPassCreateInfo
+VkRenderPassCreateInfo* zcheckarraybufVkRenderPassCreateInfo(lua_State *L, int arg, VkRenderPassCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRenderPassCreateInfo moonvulkan_zinitVkRenderPassCreateInfo
 int zinitVkRenderPassCreateInfo(lua_State *L, VkRenderPassCreateInfo* p, int *err);
 #define zfreeVkRenderPassCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -655,6 +768,7 @@ int zpushVkRenderPassCreateInfo(lua_State *L, const VkRenderPassCreateInfo *p);
 
 #define znewVkFramebufferCreateInfo(L, err) (VkFramebufferCreateInfo*)znew((L), VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO, sizeof(VkFramebufferCreateInfo), (err))
 #define znewarrayVkFramebufferCreateInfo(L, count, err) (VkFramebufferCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO, sizeof(VkFramebufferCreateInfo), (count), (err))
+#define zinitarrayVkFramebufferCreateInfo(p, count) (VkFramebufferCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO, sizeof(VkFramebufferCreateInfo), (count))
 #define znewchainVkFramebufferCreateInfo moonvulkan_znewchainVkFramebufferCreateInfo
 VkFramebufferCreateInfo* znewchainVkFramebufferCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkFramebufferCreateInfo moonvulkan_znewchainarrayVkFramebufferCreateInfo
@@ -663,6 +777,8 @@ VkFramebufferCreateInfo* znewchainarrayVkFramebufferCreateInfo(lua_State *L, uin
 VkFramebufferCreateInfo* zcheckVkFramebufferCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkFramebufferCreateInfo moonvulkan_zcheckarrayVkFramebufferCreateInfo
 VkFramebufferCreateInfo* zcheckarrayVkFramebufferCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkFramebufferCreateInfo moonvulkan_zcheckarraybufVkFramebufferCreateInfo
+VkFramebufferCreateInfo* zcheckarraybufVkFramebufferCreateInfo(lua_State *L, int arg, VkFramebufferCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkFramebufferCreateInfo moonvulkan_zinitVkFramebufferCreateInfo
 int zinitVkFramebufferCreateInfo(lua_State *L, VkFramebufferCreateInfo* p, int *err);
 #define zfreeVkFramebufferCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -672,6 +788,7 @@ int zpushVkFramebufferCreateInfo(lua_State *L, const VkFramebufferCreateInfo *p)
 
 #define znewVkShaderModuleValidationCacheCreateInfoEXT(L, err) (VkShaderModuleValidationCacheCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT, sizeof(VkShaderModuleValidationCacheCreateInfoEXT), (err))
 #define znewarrayVkShaderModuleValidationCacheCreateInfoEXT(L, count, err) (VkShaderModuleValidationCacheCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT, sizeof(VkShaderModuleValidationCacheCreateInfoEXT), (count), (err))
+#define zinitarrayVkShaderModuleValidationCacheCreateInfoEXT(p, count) (VkShaderModuleValidationCacheCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT, sizeof(VkShaderModuleValidationCacheCreateInfoEXT), (count))
 #define znewchainVkShaderModuleValidationCacheCreateInfoEXT moonvulkan_znewchainVkShaderModuleValidationCacheCreateInfoEXT
 VkShaderModuleValidationCacheCreateInfoEXT* znewchainVkShaderModuleValidationCacheCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkShaderModuleValidationCacheCreateInfoEXT moonvulkan_znewchainarrayVkShaderModuleValidationCacheCreateInfoEXT
@@ -680,6 +797,8 @@ VkShaderModuleValidationCacheCreateInfoEXT* znewchainarrayVkShaderModuleValidati
 VkShaderModuleValidationCacheCreateInfoEXT* zcheckVkShaderModuleValidationCacheCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkShaderModuleValidationCacheCreateInfoEXT moonvulkan_zcheckarrayVkShaderModuleValidationCacheCreateInfoEXT
 VkShaderModuleValidationCacheCreateInfoEXT* zcheckarrayVkShaderModuleValidationCacheCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkShaderModuleValidationCacheCreateInfoEXT moonvulkan_zcheckarraybufVkShaderModuleValidationCacheCreateInfoEXT
+VkShaderModuleValidationCacheCreateInfoEXT* zcheckarraybufVkShaderModuleValidationCacheCreateInfoEXT(lua_State *L, int arg, VkShaderModuleValidationCacheCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkShaderModuleValidationCacheCreateInfoEXT moonvulkan_zinitVkShaderModuleValidationCacheCreateInfoEXT
 int zinitVkShaderModuleValidationCacheCreateInfoEXT(lua_State *L, VkShaderModuleValidationCacheCreateInfoEXT* p, int *err);
 #define zfreeVkShaderModuleValidationCacheCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -689,6 +808,7 @@ int zpushVkShaderModuleValidationCacheCreateInfoEXT(lua_State *L, const VkShader
 
 #define znewVkShaderModuleCreateInfo(L, err) (VkShaderModuleCreateInfo*)znew((L), VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO, sizeof(VkShaderModuleCreateInfo), (err))
 #define znewarrayVkShaderModuleCreateInfo(L, count, err) (VkShaderModuleCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO, sizeof(VkShaderModuleCreateInfo), (count), (err))
+#define zinitarrayVkShaderModuleCreateInfo(p, count) (VkShaderModuleCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO, sizeof(VkShaderModuleCreateInfo), (count))
 #define znewchainVkShaderModuleCreateInfo moonvulkan_znewchainVkShaderModuleCreateInfo
 VkShaderModuleCreateInfo* znewchainVkShaderModuleCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkShaderModuleCreateInfo moonvulkan_znewchainarrayVkShaderModuleCreateInfo
@@ -697,6 +817,8 @@ VkShaderModuleCreateInfo* znewchainarrayVkShaderModuleCreateInfo(lua_State *L, u
 VkShaderModuleCreateInfo* zcheckVkShaderModuleCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkShaderModuleCreateInfo moonvulkan_zcheckarrayVkShaderModuleCreateInfo
 VkShaderModuleCreateInfo* zcheckarrayVkShaderModuleCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkShaderModuleCreateInfo moonvulkan_zcheckarraybufVkShaderModuleCreateInfo
+VkShaderModuleCreateInfo* zcheckarraybufVkShaderModuleCreateInfo(lua_State *L, int arg, VkShaderModuleCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkShaderModuleCreateInfo moonvulkan_zinitVkShaderModuleCreateInfo
 int zinitVkShaderModuleCreateInfo(lua_State *L, VkShaderModuleCreateInfo* p, int *err);
 #define zfreeVkShaderModuleCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -706,6 +828,7 @@ int zpushVkShaderModuleCreateInfo(lua_State *L, const VkShaderModuleCreateInfo *
 
 #define znewVkSwapchainCounterCreateInfoEXT(L, err) (VkSwapchainCounterCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT, sizeof(VkSwapchainCounterCreateInfoEXT), (err))
 #define znewarrayVkSwapchainCounterCreateInfoEXT(L, count, err) (VkSwapchainCounterCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT, sizeof(VkSwapchainCounterCreateInfoEXT), (count), (err))
+#define zinitarrayVkSwapchainCounterCreateInfoEXT(p, count) (VkSwapchainCounterCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT, sizeof(VkSwapchainCounterCreateInfoEXT), (count))
 #define znewchainVkSwapchainCounterCreateInfoEXT moonvulkan_znewchainVkSwapchainCounterCreateInfoEXT
 VkSwapchainCounterCreateInfoEXT* znewchainVkSwapchainCounterCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkSwapchainCounterCreateInfoEXT moonvulkan_znewchainarrayVkSwapchainCounterCreateInfoEXT
@@ -714,6 +837,8 @@ VkSwapchainCounterCreateInfoEXT* znewchainarrayVkSwapchainCounterCreateInfoEXT(l
 VkSwapchainCounterCreateInfoEXT* zcheckVkSwapchainCounterCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSwapchainCounterCreateInfoEXT moonvulkan_zcheckarrayVkSwapchainCounterCreateInfoEXT
 VkSwapchainCounterCreateInfoEXT* zcheckarrayVkSwapchainCounterCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSwapchainCounterCreateInfoEXT moonvulkan_zcheckarraybufVkSwapchainCounterCreateInfoEXT
+VkSwapchainCounterCreateInfoEXT* zcheckarraybufVkSwapchainCounterCreateInfoEXT(lua_State *L, int arg, VkSwapchainCounterCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSwapchainCounterCreateInfoEXT moonvulkan_zinitVkSwapchainCounterCreateInfoEXT
 int zinitVkSwapchainCounterCreateInfoEXT(lua_State *L, VkSwapchainCounterCreateInfoEXT* p, int *err);
 #define zfreeVkSwapchainCounterCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -723,6 +848,7 @@ int zpushVkSwapchainCounterCreateInfoEXT(lua_State *L, const VkSwapchainCounterC
 
 #define znewVkSwapchainCreateInfoKHR(L, err) (VkSwapchainCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR, sizeof(VkSwapchainCreateInfoKHR), (err))
 #define znewarrayVkSwapchainCreateInfoKHR(L, count, err) (VkSwapchainCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR, sizeof(VkSwapchainCreateInfoKHR), (count), (err))
+#define zinitarrayVkSwapchainCreateInfoKHR(p, count) (VkSwapchainCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR, sizeof(VkSwapchainCreateInfoKHR), (count))
 #define znewchainVkSwapchainCreateInfoKHR moonvulkan_znewchainVkSwapchainCreateInfoKHR
 VkSwapchainCreateInfoKHR* znewchainVkSwapchainCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkSwapchainCreateInfoKHR moonvulkan_znewchainarrayVkSwapchainCreateInfoKHR
@@ -731,6 +857,8 @@ VkSwapchainCreateInfoKHR* znewchainarrayVkSwapchainCreateInfoKHR(lua_State *L, u
 VkSwapchainCreateInfoKHR* zcheckVkSwapchainCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSwapchainCreateInfoKHR moonvulkan_zcheckarrayVkSwapchainCreateInfoKHR
 VkSwapchainCreateInfoKHR* zcheckarrayVkSwapchainCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSwapchainCreateInfoKHR moonvulkan_zcheckarraybufVkSwapchainCreateInfoKHR
+VkSwapchainCreateInfoKHR* zcheckarraybufVkSwapchainCreateInfoKHR(lua_State *L, int arg, VkSwapchainCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSwapchainCreateInfoKHR moonvulkan_zinitVkSwapchainCreateInfoKHR
 int zinitVkSwapchainCreateInfoKHR(lua_State *L, VkSwapchainCreateInfoKHR* p, int *err);
 #define zfreeVkSwapchainCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -740,6 +868,7 @@ int zpushVkSwapchainCreateInfoKHR(lua_State *L, const VkSwapchainCreateInfoKHR *
 
 #define znewVkPipelineCacheCreateInfo(L, err) (VkPipelineCacheCreateInfo*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO, sizeof(VkPipelineCacheCreateInfo), (err))
 #define znewarrayVkPipelineCacheCreateInfo(L, count, err) (VkPipelineCacheCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO, sizeof(VkPipelineCacheCreateInfo), (count), (err))
+#define zinitarrayVkPipelineCacheCreateInfo(p, count) (VkPipelineCacheCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO, sizeof(VkPipelineCacheCreateInfo), (count))
 #define znewchainVkPipelineCacheCreateInfo moonvulkan_znewchainVkPipelineCacheCreateInfo
 VkPipelineCacheCreateInfo* znewchainVkPipelineCacheCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkPipelineCacheCreateInfo moonvulkan_znewchainarrayVkPipelineCacheCreateInfo
@@ -748,6 +877,8 @@ VkPipelineCacheCreateInfo* znewchainarrayVkPipelineCacheCreateInfo(lua_State *L,
 VkPipelineCacheCreateInfo* zcheckVkPipelineCacheCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineCacheCreateInfo moonvulkan_zcheckarrayVkPipelineCacheCreateInfo
 VkPipelineCacheCreateInfo* zcheckarrayVkPipelineCacheCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineCacheCreateInfo moonvulkan_zcheckarraybufVkPipelineCacheCreateInfo
+VkPipelineCacheCreateInfo* zcheckarraybufVkPipelineCacheCreateInfo(lua_State *L, int arg, VkPipelineCacheCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineCacheCreateInfo moonvulkan_zinitVkPipelineCacheCreateInfo
 int zinitVkPipelineCacheCreateInfo(lua_State *L, VkPipelineCacheCreateInfo* p, int *err);
 #define zfreeVkPipelineCacheCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -757,6 +888,7 @@ int zpushVkPipelineCacheCreateInfo(lua_State *L, const VkPipelineCacheCreateInfo
 
 #define znewVkValidationCacheCreateInfoEXT(L, err) (VkValidationCacheCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT, sizeof(VkValidationCacheCreateInfoEXT), (err))
 #define znewarrayVkValidationCacheCreateInfoEXT(L, count, err) (VkValidationCacheCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT, sizeof(VkValidationCacheCreateInfoEXT), (count), (err))
+#define zinitarrayVkValidationCacheCreateInfoEXT(p, count) (VkValidationCacheCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT, sizeof(VkValidationCacheCreateInfoEXT), (count))
 #define znewchainVkValidationCacheCreateInfoEXT moonvulkan_znewchainVkValidationCacheCreateInfoEXT
 VkValidationCacheCreateInfoEXT* znewchainVkValidationCacheCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkValidationCacheCreateInfoEXT moonvulkan_znewchainarrayVkValidationCacheCreateInfoEXT
@@ -765,6 +897,8 @@ VkValidationCacheCreateInfoEXT* znewchainarrayVkValidationCacheCreateInfoEXT(lua
 VkValidationCacheCreateInfoEXT* zcheckVkValidationCacheCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkValidationCacheCreateInfoEXT moonvulkan_zcheckarrayVkValidationCacheCreateInfoEXT
 VkValidationCacheCreateInfoEXT* zcheckarrayVkValidationCacheCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkValidationCacheCreateInfoEXT moonvulkan_zcheckarraybufVkValidationCacheCreateInfoEXT
+VkValidationCacheCreateInfoEXT* zcheckarraybufVkValidationCacheCreateInfoEXT(lua_State *L, int arg, VkValidationCacheCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkValidationCacheCreateInfoEXT moonvulkan_zinitVkValidationCacheCreateInfoEXT
 int zinitVkValidationCacheCreateInfoEXT(lua_State *L, VkValidationCacheCreateInfoEXT* p, int *err);
 #define zfreeVkValidationCacheCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -774,6 +908,7 @@ int zpushVkValidationCacheCreateInfoEXT(lua_State *L, const VkValidationCacheCre
 
 #define znewVkSamplerReductionModeCreateInfo(L, err) (VkSamplerReductionModeCreateInfo*)znew((L), VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO, sizeof(VkSamplerReductionModeCreateInfo), (err))
 #define znewarrayVkSamplerReductionModeCreateInfo(L, count, err) (VkSamplerReductionModeCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO, sizeof(VkSamplerReductionModeCreateInfo), (count), (err))
+#define zinitarrayVkSamplerReductionModeCreateInfo(p, count) (VkSamplerReductionModeCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO, sizeof(VkSamplerReductionModeCreateInfo), (count))
 #define znewchainVkSamplerReductionModeCreateInfo moonvulkan_znewchainVkSamplerReductionModeCreateInfo
 VkSamplerReductionModeCreateInfo* znewchainVkSamplerReductionModeCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkSamplerReductionModeCreateInfo moonvulkan_znewchainarrayVkSamplerReductionModeCreateInfo
@@ -782,6 +917,8 @@ VkSamplerReductionModeCreateInfo* znewchainarrayVkSamplerReductionModeCreateInfo
 VkSamplerReductionModeCreateInfo* zcheckVkSamplerReductionModeCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSamplerReductionModeCreateInfo moonvulkan_zcheckarrayVkSamplerReductionModeCreateInfo
 VkSamplerReductionModeCreateInfo* zcheckarrayVkSamplerReductionModeCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSamplerReductionModeCreateInfo moonvulkan_zcheckarraybufVkSamplerReductionModeCreateInfo
+VkSamplerReductionModeCreateInfo* zcheckarraybufVkSamplerReductionModeCreateInfo(lua_State *L, int arg, VkSamplerReductionModeCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSamplerReductionModeCreateInfo moonvulkan_zinitVkSamplerReductionModeCreateInfo
 int zinitVkSamplerReductionModeCreateInfo(lua_State *L, VkSamplerReductionModeCreateInfo* p, int *err);
 #define zfreeVkSamplerReductionModeCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -791,6 +928,7 @@ int zpushVkSamplerReductionModeCreateInfo(lua_State *L, const VkSamplerReduction
 
 #define znewVkSamplerYcbcrConversionInfoKHR(L, err) (VkSamplerYcbcrConversionInfoKHR*)znew((L), VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO_KHR, sizeof(VkSamplerYcbcrConversionInfoKHR), (err))
 #define znewarrayVkSamplerYcbcrConversionInfoKHR(L, count, err) (VkSamplerYcbcrConversionInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO_KHR, sizeof(VkSamplerYcbcrConversionInfoKHR), (count), (err))
+#define zinitarrayVkSamplerYcbcrConversionInfoKHR(p, count) (VkSamplerYcbcrConversionInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO_KHR, sizeof(VkSamplerYcbcrConversionInfoKHR), (count))
 #define znewchainVkSamplerYcbcrConversionInfoKHR moonvulkan_znewchainVkSamplerYcbcrConversionInfoKHR
 VkSamplerYcbcrConversionInfoKHR* znewchainVkSamplerYcbcrConversionInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkSamplerYcbcrConversionInfoKHR moonvulkan_znewchainarrayVkSamplerYcbcrConversionInfoKHR
@@ -799,6 +937,8 @@ VkSamplerYcbcrConversionInfoKHR* znewchainarrayVkSamplerYcbcrConversionInfoKHR(l
 VkSamplerYcbcrConversionInfoKHR* zcheckVkSamplerYcbcrConversionInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSamplerYcbcrConversionInfoKHR moonvulkan_zcheckarrayVkSamplerYcbcrConversionInfoKHR
 VkSamplerYcbcrConversionInfoKHR* zcheckarrayVkSamplerYcbcrConversionInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSamplerYcbcrConversionInfoKHR moonvulkan_zcheckarraybufVkSamplerYcbcrConversionInfoKHR
+VkSamplerYcbcrConversionInfoKHR* zcheckarraybufVkSamplerYcbcrConversionInfoKHR(lua_State *L, int arg, VkSamplerYcbcrConversionInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSamplerYcbcrConversionInfoKHR moonvulkan_zinitVkSamplerYcbcrConversionInfoKHR
 int zinitVkSamplerYcbcrConversionInfoKHR(lua_State *L, VkSamplerYcbcrConversionInfoKHR* p, int *err);
 #define zfreeVkSamplerYcbcrConversionInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -808,6 +948,7 @@ int zpushVkSamplerYcbcrConversionInfoKHR(lua_State *L, const VkSamplerYcbcrConve
 
 #define znewVkSamplerCreateInfo(L, err) (VkSamplerCreateInfo*)znew((L), VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO, sizeof(VkSamplerCreateInfo), (err))
 #define znewarrayVkSamplerCreateInfo(L, count, err) (VkSamplerCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO, sizeof(VkSamplerCreateInfo), (count), (err))
+#define zinitarrayVkSamplerCreateInfo(p, count) (VkSamplerCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO, sizeof(VkSamplerCreateInfo), (count))
 #define znewchainVkSamplerCreateInfo moonvulkan_znewchainVkSamplerCreateInfo
 VkSamplerCreateInfo* znewchainVkSamplerCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkSamplerCreateInfo moonvulkan_znewchainarrayVkSamplerCreateInfo
@@ -816,6 +957,8 @@ VkSamplerCreateInfo* znewchainarrayVkSamplerCreateInfo(lua_State *L, uint32_t co
 VkSamplerCreateInfo* zcheckVkSamplerCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSamplerCreateInfo moonvulkan_zcheckarrayVkSamplerCreateInfo
 VkSamplerCreateInfo* zcheckarrayVkSamplerCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSamplerCreateInfo moonvulkan_zcheckarraybufVkSamplerCreateInfo
+VkSamplerCreateInfo* zcheckarraybufVkSamplerCreateInfo(lua_State *L, int arg, VkSamplerCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSamplerCreateInfo moonvulkan_zinitVkSamplerCreateInfo
 int zinitVkSamplerCreateInfo(lua_State *L, VkSamplerCreateInfo* p, int *err);
 #define zfreeVkSamplerCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -825,6 +968,7 @@ int zpushVkSamplerCreateInfo(lua_State *L, const VkSamplerCreateInfo *p);
 
 #define znewVkSamplerYcbcrConversionCreateInfoKHR(L, err) (VkSamplerYcbcrConversionCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO_KHR, sizeof(VkSamplerYcbcrConversionCreateInfoKHR), (err))
 #define znewarrayVkSamplerYcbcrConversionCreateInfoKHR(L, count, err) (VkSamplerYcbcrConversionCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO_KHR, sizeof(VkSamplerYcbcrConversionCreateInfoKHR), (count), (err))
+#define zinitarrayVkSamplerYcbcrConversionCreateInfoKHR(p, count) (VkSamplerYcbcrConversionCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO_KHR, sizeof(VkSamplerYcbcrConversionCreateInfoKHR), (count))
 #define znewchainVkSamplerYcbcrConversionCreateInfoKHR moonvulkan_znewchainVkSamplerYcbcrConversionCreateInfoKHR
 VkSamplerYcbcrConversionCreateInfoKHR* znewchainVkSamplerYcbcrConversionCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkSamplerYcbcrConversionCreateInfoKHR moonvulkan_znewchainarrayVkSamplerYcbcrConversionCreateInfoKHR
@@ -833,6 +977,8 @@ VkSamplerYcbcrConversionCreateInfoKHR* znewchainarrayVkSamplerYcbcrConversionCre
 VkSamplerYcbcrConversionCreateInfoKHR* zcheckVkSamplerYcbcrConversionCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSamplerYcbcrConversionCreateInfoKHR moonvulkan_zcheckarrayVkSamplerYcbcrConversionCreateInfoKHR
 VkSamplerYcbcrConversionCreateInfoKHR* zcheckarrayVkSamplerYcbcrConversionCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSamplerYcbcrConversionCreateInfoKHR moonvulkan_zcheckarraybufVkSamplerYcbcrConversionCreateInfoKHR
+VkSamplerYcbcrConversionCreateInfoKHR* zcheckarraybufVkSamplerYcbcrConversionCreateInfoKHR(lua_State *L, int arg, VkSamplerYcbcrConversionCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSamplerYcbcrConversionCreateInfoKHR moonvulkan_zinitVkSamplerYcbcrConversionCreateInfoKHR
 int zinitVkSamplerYcbcrConversionCreateInfoKHR(lua_State *L, VkSamplerYcbcrConversionCreateInfoKHR* p, int *err);
 #define zfreeVkSamplerYcbcrConversionCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -842,6 +988,7 @@ int zpushVkSamplerYcbcrConversionCreateInfoKHR(lua_State *L, const VkSamplerYcbc
 
 #define znewVkEventCreateInfo(L, err) (VkEventCreateInfo*)znew((L), VK_STRUCTURE_TYPE_EVENT_CREATE_INFO, sizeof(VkEventCreateInfo), (err))
 #define znewarrayVkEventCreateInfo(L, count, err) (VkEventCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_EVENT_CREATE_INFO, sizeof(VkEventCreateInfo), (count), (err))
+#define zinitarrayVkEventCreateInfo(p, count) (VkEventCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_EVENT_CREATE_INFO, sizeof(VkEventCreateInfo), (count))
 #define znewchainVkEventCreateInfo moonvulkan_znewchainVkEventCreateInfo
 VkEventCreateInfo* znewchainVkEventCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkEventCreateInfo moonvulkan_znewchainarrayVkEventCreateInfo
@@ -850,6 +997,8 @@ VkEventCreateInfo* znewchainarrayVkEventCreateInfo(lua_State *L, uint32_t count,
 VkEventCreateInfo* zcheckVkEventCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkEventCreateInfo moonvulkan_zcheckarrayVkEventCreateInfo
 VkEventCreateInfo* zcheckarrayVkEventCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkEventCreateInfo moonvulkan_zcheckarraybufVkEventCreateInfo
+VkEventCreateInfo* zcheckarraybufVkEventCreateInfo(lua_State *L, int arg, VkEventCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkEventCreateInfo moonvulkan_zinitVkEventCreateInfo
 int zinitVkEventCreateInfo(lua_State *L, VkEventCreateInfo* p, int *err);
 #define zfreeVkEventCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -859,6 +1008,7 @@ int zpushVkEventCreateInfo(lua_State *L, const VkEventCreateInfo *p);
 
 #define znewVkExportFenceCreateInfoKHR(L, err) (VkExportFenceCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO_KHR, sizeof(VkExportFenceCreateInfoKHR), (err))
 #define znewarrayVkExportFenceCreateInfoKHR(L, count, err) (VkExportFenceCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO_KHR, sizeof(VkExportFenceCreateInfoKHR), (count), (err))
+#define zinitarrayVkExportFenceCreateInfoKHR(p, count) (VkExportFenceCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO_KHR, sizeof(VkExportFenceCreateInfoKHR), (count))
 #define znewchainVkExportFenceCreateInfoKHR moonvulkan_znewchainVkExportFenceCreateInfoKHR
 VkExportFenceCreateInfoKHR* znewchainVkExportFenceCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkExportFenceCreateInfoKHR moonvulkan_znewchainarrayVkExportFenceCreateInfoKHR
@@ -867,6 +1017,8 @@ VkExportFenceCreateInfoKHR* znewchainarrayVkExportFenceCreateInfoKHR(lua_State *
 VkExportFenceCreateInfoKHR* zcheckVkExportFenceCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExportFenceCreateInfoKHR moonvulkan_zcheckarrayVkExportFenceCreateInfoKHR
 VkExportFenceCreateInfoKHR* zcheckarrayVkExportFenceCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExportFenceCreateInfoKHR moonvulkan_zcheckarraybufVkExportFenceCreateInfoKHR
+VkExportFenceCreateInfoKHR* zcheckarraybufVkExportFenceCreateInfoKHR(lua_State *L, int arg, VkExportFenceCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExportFenceCreateInfoKHR moonvulkan_zinitVkExportFenceCreateInfoKHR
 int zinitVkExportFenceCreateInfoKHR(lua_State *L, VkExportFenceCreateInfoKHR* p, int *err);
 #define zfreeVkExportFenceCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -876,6 +1028,7 @@ int zpushVkExportFenceCreateInfoKHR(lua_State *L, const VkExportFenceCreateInfoK
 
 #define znewVkFenceCreateInfo(L, err) (VkFenceCreateInfo*)znew((L), VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, sizeof(VkFenceCreateInfo), (err))
 #define znewarrayVkFenceCreateInfo(L, count, err) (VkFenceCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, sizeof(VkFenceCreateInfo), (count), (err))
+#define zinitarrayVkFenceCreateInfo(p, count) (VkFenceCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, sizeof(VkFenceCreateInfo), (count))
 #define znewchainVkFenceCreateInfo moonvulkan_znewchainVkFenceCreateInfo
 VkFenceCreateInfo* znewchainVkFenceCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkFenceCreateInfo moonvulkan_znewchainarrayVkFenceCreateInfo
@@ -884,6 +1037,8 @@ VkFenceCreateInfo* znewchainarrayVkFenceCreateInfo(lua_State *L, uint32_t count,
 VkFenceCreateInfo* zcheckVkFenceCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkFenceCreateInfo moonvulkan_zcheckarrayVkFenceCreateInfo
 VkFenceCreateInfo* zcheckarrayVkFenceCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkFenceCreateInfo moonvulkan_zcheckarraybufVkFenceCreateInfo
+VkFenceCreateInfo* zcheckarraybufVkFenceCreateInfo(lua_State *L, int arg, VkFenceCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkFenceCreateInfo moonvulkan_zinitVkFenceCreateInfo
 int zinitVkFenceCreateInfo(lua_State *L, VkFenceCreateInfo* p, int *err);
 #define zfreeVkFenceCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -893,6 +1048,7 @@ int zpushVkFenceCreateInfo(lua_State *L, const VkFenceCreateInfo *p);
 
 #define znewVkExportSemaphoreCreateInfoKHR(L, err) (VkExportSemaphoreCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO_KHR, sizeof(VkExportSemaphoreCreateInfoKHR), (err))
 #define znewarrayVkExportSemaphoreCreateInfoKHR(L, count, err) (VkExportSemaphoreCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO_KHR, sizeof(VkExportSemaphoreCreateInfoKHR), (count), (err))
+#define zinitarrayVkExportSemaphoreCreateInfoKHR(p, count) (VkExportSemaphoreCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO_KHR, sizeof(VkExportSemaphoreCreateInfoKHR), (count))
 #define znewchainVkExportSemaphoreCreateInfoKHR moonvulkan_znewchainVkExportSemaphoreCreateInfoKHR
 VkExportSemaphoreCreateInfoKHR* znewchainVkExportSemaphoreCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkExportSemaphoreCreateInfoKHR moonvulkan_znewchainarrayVkExportSemaphoreCreateInfoKHR
@@ -901,6 +1057,8 @@ VkExportSemaphoreCreateInfoKHR* znewchainarrayVkExportSemaphoreCreateInfoKHR(lua
 VkExportSemaphoreCreateInfoKHR* zcheckVkExportSemaphoreCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExportSemaphoreCreateInfoKHR moonvulkan_zcheckarrayVkExportSemaphoreCreateInfoKHR
 VkExportSemaphoreCreateInfoKHR* zcheckarrayVkExportSemaphoreCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExportSemaphoreCreateInfoKHR moonvulkan_zcheckarraybufVkExportSemaphoreCreateInfoKHR
+VkExportSemaphoreCreateInfoKHR* zcheckarraybufVkExportSemaphoreCreateInfoKHR(lua_State *L, int arg, VkExportSemaphoreCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExportSemaphoreCreateInfoKHR moonvulkan_zinitVkExportSemaphoreCreateInfoKHR
 int zinitVkExportSemaphoreCreateInfoKHR(lua_State *L, VkExportSemaphoreCreateInfoKHR* p, int *err);
 #define zfreeVkExportSemaphoreCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -910,6 +1068,7 @@ int zpushVkExportSemaphoreCreateInfoKHR(lua_State *L, const VkExportSemaphoreCre
 
 #define znewVkSemaphoreCreateInfo(L, err) (VkSemaphoreCreateInfo*)znew((L), VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, sizeof(VkSemaphoreCreateInfo), (err))
 #define znewarrayVkSemaphoreCreateInfo(L, count, err) (VkSemaphoreCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, sizeof(VkSemaphoreCreateInfo), (count), (err))
+#define zinitarrayVkSemaphoreCreateInfo(p, count) (VkSemaphoreCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, sizeof(VkSemaphoreCreateInfo), (count))
 #define znewchainVkSemaphoreCreateInfo moonvulkan_znewchainVkSemaphoreCreateInfo
 VkSemaphoreCreateInfo* znewchainVkSemaphoreCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkSemaphoreCreateInfo moonvulkan_znewchainarrayVkSemaphoreCreateInfo
@@ -918,6 +1077,8 @@ VkSemaphoreCreateInfo* znewchainarrayVkSemaphoreCreateInfo(lua_State *L, uint32_
 VkSemaphoreCreateInfo* zcheckVkSemaphoreCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSemaphoreCreateInfo moonvulkan_zcheckarrayVkSemaphoreCreateInfo
 VkSemaphoreCreateInfo* zcheckarrayVkSemaphoreCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSemaphoreCreateInfo moonvulkan_zcheckarraybufVkSemaphoreCreateInfo
+VkSemaphoreCreateInfo* zcheckarraybufVkSemaphoreCreateInfo(lua_State *L, int arg, VkSemaphoreCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSemaphoreCreateInfo moonvulkan_zinitVkSemaphoreCreateInfo
 int zinitVkSemaphoreCreateInfo(lua_State *L, VkSemaphoreCreateInfo* p, int *err);
 #define zfreeVkSemaphoreCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -927,6 +1088,7 @@ int zpushVkSemaphoreCreateInfo(lua_State *L, const VkSemaphoreCreateInfo *p);
 
 #define znewVkDisplaySurfaceCreateInfoKHR(L, err) (VkDisplaySurfaceCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR, sizeof(VkDisplaySurfaceCreateInfoKHR), (err))
 #define znewarrayVkDisplaySurfaceCreateInfoKHR(L, count, err) (VkDisplaySurfaceCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR, sizeof(VkDisplaySurfaceCreateInfoKHR), (count), (err))
+#define zinitarrayVkDisplaySurfaceCreateInfoKHR(p, count) (VkDisplaySurfaceCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR, sizeof(VkDisplaySurfaceCreateInfoKHR), (count))
 #define znewchainVkDisplaySurfaceCreateInfoKHR moonvulkan_znewchainVkDisplaySurfaceCreateInfoKHR
 VkDisplaySurfaceCreateInfoKHR* znewchainVkDisplaySurfaceCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkDisplaySurfaceCreateInfoKHR moonvulkan_znewchainarrayVkDisplaySurfaceCreateInfoKHR
@@ -935,6 +1097,8 @@ VkDisplaySurfaceCreateInfoKHR* znewchainarrayVkDisplaySurfaceCreateInfoKHR(lua_S
 VkDisplaySurfaceCreateInfoKHR* zcheckVkDisplaySurfaceCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplaySurfaceCreateInfoKHR moonvulkan_zcheckarrayVkDisplaySurfaceCreateInfoKHR
 VkDisplaySurfaceCreateInfoKHR* zcheckarrayVkDisplaySurfaceCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplaySurfaceCreateInfoKHR moonvulkan_zcheckarraybufVkDisplaySurfaceCreateInfoKHR
+VkDisplaySurfaceCreateInfoKHR* zcheckarraybufVkDisplaySurfaceCreateInfoKHR(lua_State *L, int arg, VkDisplaySurfaceCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplaySurfaceCreateInfoKHR moonvulkan_zinitVkDisplaySurfaceCreateInfoKHR
 int zinitVkDisplaySurfaceCreateInfoKHR(lua_State *L, VkDisplaySurfaceCreateInfoKHR* p, int *err);
 #define zfreeVkDisplaySurfaceCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -944,6 +1108,7 @@ int zpushVkDisplaySurfaceCreateInfoKHR(lua_State *L, const VkDisplaySurfaceCreat
 
 #define znewVkDescriptorUpdateTemplateCreateInfoKHR(L, err) (VkDescriptorUpdateTemplateCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO_KHR, sizeof(VkDescriptorUpdateTemplateCreateInfoKHR), (err))
 #define znewarrayVkDescriptorUpdateTemplateCreateInfoKHR(L, count, err) (VkDescriptorUpdateTemplateCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO_KHR, sizeof(VkDescriptorUpdateTemplateCreateInfoKHR), (count), (err))
+#define zinitarrayVkDescriptorUpdateTemplateCreateInfoKHR(p, count) (VkDescriptorUpdateTemplateCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO_KHR, sizeof(VkDescriptorUpdateTemplateCreateInfoKHR), (count))
 #define znewchainVkDescriptorUpdateTemplateCreateInfoKHR moonvulkan_znewchainVkDescriptorUpdateTemplateCreateInfoKHR
 VkDescriptorUpdateTemplateCreateInfoKHR* znewchainVkDescriptorUpdateTemplateCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkDescriptorUpdateTemplateCreateInfoKHR moonvulkan_znewchainarrayVkDescriptorUpdateTemplateCreateInfoKHR
@@ -952,6 +1117,8 @@ VkDescriptorUpdateTemplateCreateInfoKHR* znewchainarrayVkDescriptorUpdateTemplat
 VkDescriptorUpdateTemplateCreateInfoKHR* zcheckVkDescriptorUpdateTemplateCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDescriptorUpdateTemplateCreateInfoKHR moonvulkan_zcheckarrayVkDescriptorUpdateTemplateCreateInfoKHR
 VkDescriptorUpdateTemplateCreateInfoKHR* zcheckarrayVkDescriptorUpdateTemplateCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDescriptorUpdateTemplateCreateInfoKHR moonvulkan_zcheckarraybufVkDescriptorUpdateTemplateCreateInfoKHR
+VkDescriptorUpdateTemplateCreateInfoKHR* zcheckarraybufVkDescriptorUpdateTemplateCreateInfoKHR(lua_State *L, int arg, VkDescriptorUpdateTemplateCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDescriptorUpdateTemplateCreateInfoKHR moonvulkan_zinitVkDescriptorUpdateTemplateCreateInfoKHR
 int zinitVkDescriptorUpdateTemplateCreateInfoKHR(lua_State *L, VkDescriptorUpdateTemplateCreateInfoKHR* p, int *err);
 #define zfreeVkDescriptorUpdateTemplateCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -961,6 +1128,7 @@ int zpushVkDescriptorUpdateTemplateCreateInfoKHR(lua_State *L, const VkDescripto
 
 #define znewVkDebugUtilsMessengerCreateInfoEXT(L, err) (VkDebugUtilsMessengerCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT, sizeof(VkDebugUtilsMessengerCreateInfoEXT), (err))
 #define znewarrayVkDebugUtilsMessengerCreateInfoEXT(L, count, err) (VkDebugUtilsMessengerCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT, sizeof(VkDebugUtilsMessengerCreateInfoEXT), (count), (err))
+#define zinitarrayVkDebugUtilsMessengerCreateInfoEXT(p, count) (VkDebugUtilsMessengerCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT, sizeof(VkDebugUtilsMessengerCreateInfoEXT), (count))
 #define znewchainVkDebugUtilsMessengerCreateInfoEXT moonvulkan_znewchainVkDebugUtilsMessengerCreateInfoEXT
 VkDebugUtilsMessengerCreateInfoEXT* znewchainVkDebugUtilsMessengerCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkDebugUtilsMessengerCreateInfoEXT moonvulkan_znewchainarrayVkDebugUtilsMessengerCreateInfoEXT
@@ -969,6 +1137,8 @@ VkDebugUtilsMessengerCreateInfoEXT* znewchainarrayVkDebugUtilsMessengerCreateInf
 VkDebugUtilsMessengerCreateInfoEXT* zcheckVkDebugUtilsMessengerCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDebugUtilsMessengerCreateInfoEXT moonvulkan_zcheckarrayVkDebugUtilsMessengerCreateInfoEXT
 VkDebugUtilsMessengerCreateInfoEXT* zcheckarrayVkDebugUtilsMessengerCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDebugUtilsMessengerCreateInfoEXT moonvulkan_zcheckarraybufVkDebugUtilsMessengerCreateInfoEXT
+VkDebugUtilsMessengerCreateInfoEXT* zcheckarraybufVkDebugUtilsMessengerCreateInfoEXT(lua_State *L, int arg, VkDebugUtilsMessengerCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDebugUtilsMessengerCreateInfoEXT moonvulkan_zinitVkDebugUtilsMessengerCreateInfoEXT
 int zinitVkDebugUtilsMessengerCreateInfoEXT(lua_State *L, VkDebugUtilsMessengerCreateInfoEXT* p, int *err);
 #define zfreeVkDebugUtilsMessengerCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -978,6 +1148,7 @@ int zpushVkDebugUtilsMessengerCreateInfoEXT(lua_State *L, const VkDebugUtilsMess
 
 #define znewVkMemoryBarrier(L, err) (VkMemoryBarrier*)znew((L), VK_STRUCTURE_TYPE_MEMORY_BARRIER, sizeof(VkMemoryBarrier), (err))
 #define znewarrayVkMemoryBarrier(L, count, err) (VkMemoryBarrier*)znewarray((L), VK_STRUCTURE_TYPE_MEMORY_BARRIER, sizeof(VkMemoryBarrier), (count), (err))
+#define zinitarrayVkMemoryBarrier(p, count) (VkMemoryBarrier*)zinitarray((p), VK_STRUCTURE_TYPE_MEMORY_BARRIER, sizeof(VkMemoryBarrier), (count))
 #define znewchainVkMemoryBarrier moonvulkan_znewchainVkMemoryBarrier
 VkMemoryBarrier* znewchainVkMemoryBarrier(lua_State *L, int *err);
 #define znewchainarrayVkMemoryBarrier moonvulkan_znewchainarrayVkMemoryBarrier
@@ -986,6 +1157,8 @@ VkMemoryBarrier* znewchainarrayVkMemoryBarrier(lua_State *L, uint32_t count, int
 VkMemoryBarrier* zcheckVkMemoryBarrier(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryBarrier moonvulkan_zcheckarrayVkMemoryBarrier
 VkMemoryBarrier* zcheckarrayVkMemoryBarrier(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryBarrier moonvulkan_zcheckarraybufVkMemoryBarrier
+VkMemoryBarrier* zcheckarraybufVkMemoryBarrier(lua_State *L, int arg, VkMemoryBarrier *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryBarrier moonvulkan_zinitVkMemoryBarrier
 int zinitVkMemoryBarrier(lua_State *L, VkMemoryBarrier* p, int *err);
 #define zfreeVkMemoryBarrier(L, p, base) zfree((L), (p), (base))
@@ -995,6 +1168,7 @@ int zpushVkMemoryBarrier(lua_State *L, const VkMemoryBarrier *p);
 
 #define znewVkBufferMemoryBarrier(L, err) (VkBufferMemoryBarrier*)znew((L), VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER, sizeof(VkBufferMemoryBarrier), (err))
 #define znewarrayVkBufferMemoryBarrier(L, count, err) (VkBufferMemoryBarrier*)znewarray((L), VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER, sizeof(VkBufferMemoryBarrier), (count), (err))
+#define zinitarrayVkBufferMemoryBarrier(p, count) (VkBufferMemoryBarrier*)zinitarray((p), VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER, sizeof(VkBufferMemoryBarrier), (count))
 #define znewchainVkBufferMemoryBarrier moonvulkan_znewchainVkBufferMemoryBarrier
 VkBufferMemoryBarrier* znewchainVkBufferMemoryBarrier(lua_State *L, int *err);
 #define znewchainarrayVkBufferMemoryBarrier moonvulkan_znewchainarrayVkBufferMemoryBarrier
@@ -1003,6 +1177,8 @@ VkBufferMemoryBarrier* znewchainarrayVkBufferMemoryBarrier(lua_State *L, uint32_
 VkBufferMemoryBarrier* zcheckVkBufferMemoryBarrier(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBufferMemoryBarrier moonvulkan_zcheckarrayVkBufferMemoryBarrier
 VkBufferMemoryBarrier* zcheckarrayVkBufferMemoryBarrier(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBufferMemoryBarrier moonvulkan_zcheckarraybufVkBufferMemoryBarrier
+VkBufferMemoryBarrier* zcheckarraybufVkBufferMemoryBarrier(lua_State *L, int arg, VkBufferMemoryBarrier *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBufferMemoryBarrier moonvulkan_zinitVkBufferMemoryBarrier
 int zinitVkBufferMemoryBarrier(lua_State *L, VkBufferMemoryBarrier* p, int *err);
 #define zfreeVkBufferMemoryBarrier(L, p, base) zfree((L), (p), (base))
@@ -1012,6 +1188,7 @@ int zpushVkBufferMemoryBarrier(lua_State *L, const VkBufferMemoryBarrier *p);
 
 #define znewVkImageMemoryBarrier(L, err) (VkImageMemoryBarrier*)znew((L), VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, sizeof(VkImageMemoryBarrier), (err))
 #define znewarrayVkImageMemoryBarrier(L, count, err) (VkImageMemoryBarrier*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, sizeof(VkImageMemoryBarrier), (count), (err))
+#define zinitarrayVkImageMemoryBarrier(p, count) (VkImageMemoryBarrier*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, sizeof(VkImageMemoryBarrier), (count))
 #define znewchainVkImageMemoryBarrier moonvulkan_znewchainVkImageMemoryBarrier
 VkImageMemoryBarrier* znewchainVkImageMemoryBarrier(lua_State *L, int *err);
 #define znewchainarrayVkImageMemoryBarrier moonvulkan_znewchainarrayVkImageMemoryBarrier
@@ -1020,6 +1197,8 @@ VkImageMemoryBarrier* znewchainarrayVkImageMemoryBarrier(lua_State *L, uint32_t
 VkImageMemoryBarrier* zcheckVkImageMemoryBarrier(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageMemoryBarrier moonvulkan_zcheckarrayVkImageMemoryBarrier
 VkImageMemoryBarrier* zcheckarrayVkImageMemoryBarrier(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageMemoryBarrier moonvulkan_zcheckarraybufVkImageMemoryBarrier
+VkImageMemoryBarrier* zcheckarraybufVkImageMemoryBarrier(lua_State *L, int arg, VkImageMemoryBarrier *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageMemoryBarrier moonvulkan_zinitVkImageMemoryBarrier
 int zinitVkImageMemoryBarrier(lua_State *L, VkImageMemoryBarrier* p, int *err);
 #define zfreeVkImageMemoryBarrier(L, p, base) zfree((L), (p), (base))
@@ -1029,6 +1208,7 @@ int zpushVkImageMemoryBarrier(lua_State *L, const VkImageMemoryBarrier *p);
 
 #define znewVkBufferMemoryRequirementsInfo2KHR(L, err) (VkBufferMemoryRequirementsInfo2KHR*)znew((L), VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2_KHR, sizeof(VkBufferMemoryRequirementsInfo2KHR), (err))
 #define znewarrayVkBufferMemoryRequirementsInfo2KHR(L, count, err) (VkBufferMemoryRequirementsInfo2KHR*)znewarray((L), VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2_KHR, sizeof(VkBufferMemoryRequirementsInfo2KHR), (count), (err))
+#define zinitarrayVkBufferMemoryRequirementsInfo2KHR(p, count) (VkBufferMemoryRequirementsInfo2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2_KHR, sizeof(VkBufferMemoryRequirementsInfo2KHR), (count))
 #define znewchainVkBufferMemoryRequirementsInfo2KHR moonvulkan_znewchainVkBufferMemoryRequirementsInfo2KHR
 VkBufferMemoryRequirementsInfo2KHR* znewchainVkBufferMemoryRequirementsInfo2KHR(lua_State *L, int *err);
 #define znewchainarrayVkBufferMemoryRequirementsInfo2KHR moonvulkan_znewchainarrayVkBufferMemoryRequirementsInfo2KHR
@@ -1037,6 +1217,8 @@ VkBufferMemoryRequirementsInfo2KHR* znewchainarrayVkBufferMemoryRequirementsInfo
 VkBufferMemoryRequirementsInfo2KHR* zcheckVkBufferMemoryRequirementsInfo2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBufferMemoryRequirementsInfo2KHR moonvulkan_zcheckarrayVkBufferMemoryRequirementsInfo2KHR
 VkBufferMemoryRequirementsInfo2KHR* zcheckarrayVkBufferMemoryRequirementsInfo2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBufferMemoryRequirementsInfo2KHR moonvulkan_zcheckarraybufVkBufferMemoryRequirementsInfo2KHR
+VkBufferMemoryRequirementsInfo2KHR* zcheckarraybufVkBufferMemoryRequirementsInfo2KHR(lua_State *L, int arg, VkBufferMemoryRequirementsInfo2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBufferMemoryRequirementsInfo2KHR moonvulkan_zinitVkBufferMemoryRequirementsInfo2KHR
 int zinitVkBufferMemoryRequirementsInfo2KHR(lua_State *L, VkBufferMemoryRequirementsInfo2KHR* p, int *err);
 #define zfreeVkBufferMemoryRequirementsInfo2KHR(L, p, base) zfree((L), (p), (base))
@@ -1046,6 +1228,7 @@ int zpushVkBufferMemoryRequirementsInfo2KHR(lua_State *L, const VkBufferMemoryRe
 
 #define znewVkImagePlaneMemoryRequirementsInfoKHR(L, err) (VkImagePlaneMemoryRequirementsInfoKHR*)znew((L), VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO_KHR, sizeof(VkImagePlaneMemoryRequirementsInfoKHR), (err))
 #define znewarrayVkImagePlaneMemoryRequirementsInfoKHR(L, count, err) (VkImagePlaneMemoryRequirementsInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO_KHR, sizeof(VkImagePlaneMemoryRequirementsInfoKHR), (count), (err))
+#define zinitarrayVkImagePlaneMemoryRequirementsInfoKHR(p, count) (VkImagePlaneMemoryRequirementsInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO_KHR, sizeof(VkImagePlaneMemoryRequirementsInfoKHR), (count))
 #define znewchainVkImagePlaneMemoryRequirementsInfoKHR moonvulkan_znewchainVkImagePlaneMemoryRequirementsInfoKHR
 VkImagePlaneMemoryRequirementsInfoKHR* znewchainVkImagePlaneMemoryRequirementsInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkImagePlaneMemoryRequirementsInfoKHR moonvulkan_znewchainarrayVkImagePlaneMemoryRequirementsInfoKHR
@@ -1054,6 +1237,8 @@ VkImagePlaneMemoryRequirementsInfoKHR* znewchainarrayVkImagePlaneMemoryRequireme
 VkImagePlaneMemoryRequirementsInfoKHR* zcheckVkImagePlaneMemoryRequirementsInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImagePlaneMemoryRequirementsInfoKHR moonvulkan_zcheckarrayVkImagePlaneMemoryRequirementsInfoKHR
 VkImagePlaneMemoryRequirementsInfoKHR* zcheckarrayVkImagePlaneMemoryRequirementsInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImagePlaneMemoryRequirementsInfoKHR moonvulkan_zcheckarraybufVkImagePlaneMemoryRequirementsInfoKHR
+VkImagePlaneMemoryRequirementsInfoKHR* zcheckarraybufVkImagePlaneMemoryRequirementsInfoKHR(lua_State *L, int arg, VkImagePlaneMemoryRequirementsInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImagePlaneMemoryRequirementsInfoKHR moonvulkan_zinitVkImagePlaneMemoryRequirementsInfoKHR
 int zinitVkImagePlaneMemoryRequirementsInfoKHR(lua_State *L, VkImagePlaneMemoryRequirementsInfoKHR* p, int *err);
 #define zfreeVkImagePlaneMemoryRequirementsInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1063,6 +1248,7 @@ int zpushVkImagePlaneMemoryRequirementsInfoKHR(lua_State *L, const VkImagePlaneM
 
 #define znewVkImageMemoryRequirementsInfo2KHR(L, err) (VkImageMemoryRequirementsInfo2KHR*)znew((L), VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2_KHR, sizeof(VkImageMemoryRequirementsInfo2KHR), (err))
 #define znewarrayVkImageMemoryRequirementsInfo2KHR(L, count, err) (VkImageMemoryRequirementsInfo2KHR*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2_KHR, sizeof(VkImageMemoryRequirementsInfo2KHR), (count), (err))
+#define zinitarrayVkImageMemoryRequirementsInfo2KHR(p, count) (VkImageMemoryRequirementsInfo2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2_KHR, sizeof(VkImageMemoryRequirementsInfo2KHR), (count))
 #define znewchainVkImageMemoryRequirementsInfo2KHR moonvulkan_znewchainVkImageMemoryRequirementsInfo2KHR
 VkImageMemoryRequirementsInfo2KHR* znewchainVkImageMemoryRequirementsInfo2KHR(lua_State *L, int *err);
 #define znewchainarrayVkImageMemoryRequirementsInfo2KHR moonvulkan_znewchainarrayVkImageMemoryRequirementsInfo2KHR
@@ -1071,6 +1257,8 @@ VkImageMemoryRequirementsInfo2KHR* znewchainarrayVkImageMemoryRequirementsInfo2K
 VkImageMemoryRequirementsInfo2KHR* zcheckVkImageMemoryRequirementsInfo2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageMemoryRequirementsInfo2KHR moonvulkan_zcheckarrayVkImageMemoryRequirementsInfo2KHR
 VkImageMemoryRequirementsInfo2KHR* zcheckarrayVkImageMemoryRequirementsInfo2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageMemoryRequirementsInfo2KHR moonvulkan_zcheckarraybufVkImageMemoryRequirementsInfo2KHR
+VkImageMemoryRequirementsInfo2KHR* zcheckarraybufVkImageMemoryRequirementsInfo2KHR(lua_State *L, int arg, VkImageMemoryRequirementsInfo2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageMemoryRequirementsInfo2KHR moonvulkan_zinitVkImageMemoryRequirementsInfo2KHR
 int zinitVkImageMemoryRequirementsInfo2KHR(lua_State *L, VkImageMemoryRequirementsInfo2KHR* p, int *err);
 #define zfreeVkImageMemoryRequirementsInfo2KHR(L, p, base) zfree((L), (p), (base))
@@ -1080,6 +1268,7 @@ int zpushVkImageMemoryRequirementsInfo2KHR(lua_State *L, const VkImageMemoryRequ
 
 #define znewVkImageSparseMemoryRequirementsInfo2KHR(L, err) (VkImageSparseMemoryRequirementsInfo2KHR*)znew((L), VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2_KHR, sizeof(VkImageSparseMemoryRequirementsInfo2KHR), (err))
 #define znewarrayVkImageSparseMemoryRequirementsInfo2KHR(L, count, err) (VkImageSparseMemoryRequirementsInfo2KHR*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2_KHR, sizeof(VkImageSparseMemoryRequirementsInfo2KHR), (count), (err))
+#define zinitarrayVkImageSparseMemoryRequirementsInfo2KHR(p, count) (VkImageSparseMemoryRequirementsInfo2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2_KHR, sizeof(VkImageSparseMemoryRequirementsInfo2KHR), (count))
 #define znewchainVkImageSparseMemoryRequirementsInfo2KHR moonvulkan_znewchainVkImageSparseMemoryRequirementsInfo2KHR
 VkImageSparseMemoryRequirementsInfo2KHR* znewchainVkImageSparseMemoryRequirementsInfo2KHR(lua_State *L, int *err);
 #define znewchainarrayVkImageSparseMemoryRequirementsInfo2KHR moonvulkan_znewchainarrayVkImageSparseMemoryRequirementsInfo2KHR
@@ -1088,6 +1277,8 @@ VkImageSparseMemoryRequirementsInfo2KHR* znewchainarrayVkImageSparseMemoryRequir
 VkImageSparseMemoryRequirementsInfo2KHR* zcheckVkImageSparseMemoryRequirementsInfo2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageSparseMemoryRequirementsInfo2KHR moonvulkan_zcheckarrayVkImageSparseMemoryRequirementsInfo2KHR
 VkImageSparseMemoryRequirementsInfo2KHR* zcheckarrayVkImageSparseMemoryRequirementsInfo2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageSparseMemoryRequirementsInfo2KHR moonvulkan_zcheckarraybufVkImageSparseMemoryRequirementsInfo2KHR
+VkImageSparseMemoryRequirementsInfo2KHR* zcheckarraybufVkImageSparseMemoryRequirementsInfo2KHR(lua_State *L, int arg, VkImageSparseMemoryRequirementsInfo2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageSparseMemoryRequirementsInfo2KHR moonvulkan_zinitVkImageSparseMemoryRequirementsInfo2KHR
 int zinitVkImageSparseMemoryRequirementsInfo2KHR(lua_State *L, VkImageSparseMemoryRequirementsInfo2KHR* p, int *err);
 #define zfreeVkImageSparseMemoryRequirementsInfo2KHR(L, p, base) zfree((L), (p), (base))
@@ -1097,6 +1288,7 @@ int zpushVkImageSparseMemoryRequirementsInfo2KHR(lua_State *L, const VkImageSpar
 
 #define znewVkDeviceQueueInfo2(L, err) (VkDeviceQueueInfo2*)znew((L), VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2, sizeof(VkDeviceQueueInfo2), (err))
 #define znewarrayVkDeviceQueueInfo2(L, count, err) (VkDeviceQueueInfo2*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2, sizeof(VkDeviceQueueInfo2), (count), (err))
+#define zinitarrayVkDeviceQueueInfo2(p, count) (VkDeviceQueueInfo2*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2, sizeof(VkDeviceQueueInfo2), (count))
 #define znewchainVkDeviceQueueInfo2 moonvulkan_znewchainVkDeviceQueueInfo2
 VkDeviceQueueInfo2* znewchainVkDeviceQueueInfo2(lua_State *L, int *err);
 #define znewchainarrayVkDeviceQueueInfo2 moonvulkan_znewchainarrayVkDeviceQueueInfo2
@@ -1105,6 +1297,8 @@ VkDeviceQueueInfo2* znewchainarrayVkDeviceQueueInfo2(lua_State *L, uint32_t coun
 VkDeviceQueueInfo2* zcheckVkDeviceQueueInfo2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceQueueInfo2 moonvulkan_zcheckarrayVkDeviceQueueInfo2
 VkDeviceQueueInfo2* zcheckarrayVkDeviceQueueInfo2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceQueueInfo2 moonvulkan_zcheckarraybufVkDeviceQueueInfo2
+VkDeviceQueueInfo2* zcheckarraybufVkDeviceQueueInfo2(lua_State *L, int arg, VkDeviceQueueInfo2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceQueueInfo2 moonvulkan_zinitVkDeviceQueueInfo2
 int zinitVkDeviceQueueInfo2(lua_State *L, VkDeviceQueueInfo2* p, int *err);
 #define zfreeVkDeviceQueueInfo2(L, p, base) zfree((L), (p), (base))
@@ -1114,6 +1308,7 @@ int zpushVkDeviceQueueInfo2(lua_State *L, const VkDeviceQueueInfo2 *p);
 
 #define znewVkMemoryAllocateInfo(L, err) (VkMemoryAllocateInfo*)znew((L), VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, sizeof(VkMemoryAllocateInfo), (err))
 #define znewarrayVkMemoryAllocateInfo(L, count, err) (VkMemoryAllocateInfo*)znewarray((L), VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, sizeof(VkMemoryAllocateInfo), (count), (err))
+#define zinitarrayVkMemoryAllocateInfo(p, count) (VkMemoryAllocateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, sizeof(VkMemoryAllocateInfo), (count))
 #define znewchainVkMemoryAllocateInfo moonvulkan_znewchainVkMemoryAllocateInfo
 VkMemoryAllocateInfo* znewchainVkMemoryAllocateInfo(lua_State *L, int *err);
 #define znewchainarrayVkMemoryAllocateInfo moonvulkan_znewchainarrayVkMemoryAllocateInfo
@@ -1122,6 +1317,8 @@ VkMemoryAllocateInfo* znewchainarrayVkMemoryAllocateInfo(lua_State *L, uint32_t
 VkMemoryAllocateInfo* zcheckVkMemoryAllocateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryAllocateInfo moonvulkan_zcheckarrayVkMemoryAllocateInfo
 VkMemoryAllocateInfo* zcheckarrayVkMemoryAllocateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryAllocateInfo moonvulkan_zcheckarraybufVkMemoryAllocateInfo
+VkMemoryAllocateInfo* zcheckarraybufVkMemoryAllocateInfo(lua_State *L, int arg, VkMemoryAllocateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryAllocateInfo moonvulkan_zinitVkMemoryAllocateInfo
 int zinitVkMemoryAllocateInfo(lua_State *L, VkMemoryAllocateInfo* p, int *err);
 #define zfreeVkMemoryAllocateInfo(L, p, base) zfree((L), (p), (base))
@@ -1131,6 +1328,7 @@ int zpushVkMemoryAllocateInfo(lua_State *L, const VkMemoryAllocateInfo *p);
 
 #define znewVkMemoryDedicatedAllocateInfoKHR(L, err) (VkMemoryDedicatedAllocateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_KHR, sizeof(VkMemoryDedicatedAllocateInfoKHR), (err))
 #define znewarrayVkMemoryDedicatedAllocateInfoKHR(L, count, err) (VkMemoryDedicatedAllocateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_KHR, sizeof(VkMemoryDedicatedAllocateInfoKHR), (count), (err))
+#define zinitarrayVkMemoryDedicatedAllocateInfoKHR(p, count) (VkMemoryDedicatedAllocateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_KHR, sizeof(VkMemoryDedicatedAllocateInfoKHR), (count))
 #define znewchainVkMemoryDedicatedAllocateInfoKHR moonvulkan_znewchainVkMemoryDedicatedAllocateInfoKHR
 VkMemoryDedicatedAllocateInfoKHR* znewchainVkMemoryDedicatedAllocateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkMemoryDedicatedAllocateInfoKHR moonvulkan_znewchainarrayVkMemoryDedicatedAllocateInfoKHR
@@ -1139,6 +1337,8 @@ VkMemoryDedicatedAllocateInfoKHR* znewchainarrayVkMemoryDedicatedAllocateInfoKHR
 VkMemoryDedicatedAllocateInfoKHR* zcheckVkMemoryDedicatedAllocateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryDedicatedAllocateInfoKHR moonvulkan_zcheckarrayVkMemoryDedicatedAllocateInfoKHR
 VkMemoryDedicatedAllocateInfoKHR* zcheckarrayVkMemoryDedicatedAllocateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryDedicatedAllocateInfoKHR moonvulkan_zcheckarraybufVkMemoryDedicatedAllocateInfoKHR
+VkMemoryDedicatedAllocateInfoKHR* zcheckarraybufVkMemoryDedicatedAllocateInfoKHR(lua_State *L, int arg, VkMemoryDedicatedAllocateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryDedicatedAllocateInfoKHR moonvulkan_zinitVkMemoryDedicatedAllocateInfoKHR
 int zinitVkMemoryDedicatedAllocateInfoKHR(lua_State *L, VkMemoryDedicatedAllocateInfoKHR* p, int *err);
 #define zfreeVkMemoryDedicatedAllocateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1148,6 +1348,7 @@ int zpushVkMemoryDedicatedAllocateInfoKHR(lua_State *L, const VkMemoryDedicatedA
 
 #define znewVkExportMemoryAllocateInfoKHR(L, err) (VkExportMemoryAllocateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_KHR, sizeof(VkExportMemoryAllocateInfoKHR), (err))
 #define znewarrayVkExportMemoryAllocateInfoKHR(L, count, err) (VkExportMemoryAllocateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_KHR, sizeof(VkExportMemoryAllocateInfoKHR), (count), (err))
+#define zinitarrayVkExportMemoryAllocateInfoKHR(p, count) (VkExportMemoryAllocateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_KHR, sizeof(VkExportMemoryAllocateInfoKHR), (count))
 #define znewchainVkExportMemoryAllocateInfoKHR moonvulkan_znewchainVkExportMemoryAllocateInfoKHR
 VkExportMemoryAllocateInfoKHR* znewchainVkExportMemoryAllocateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkExportMemoryAllocateInfoKHR moonvulkan_znewchainarrayVkExportMemoryAllocateInfoKHR
@@ -1156,6 +1357,8 @@ VkExportMemoryAllocateInfoKHR* znewchainarrayVkExportMemoryAllocateInfoKHR(lua_S
 VkExportMemoryAllocateInfoKHR* zcheckVkExportMemoryAllocateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExportMemoryAllocateInfoKHR moonvulkan_zcheckarrayVkExportMemoryAllocateInfoKHR
 VkExportMemoryAllocateInfoKHR* zcheckarrayVkExportMemoryAllocateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExportMemoryAllocateInfoKHR moonvulkan_zcheckarraybufVkExportMemoryAllocateInfoKHR
+VkExportMemoryAllocateInfoKHR* zcheckarraybufVkExportMemoryAllocateInfoKHR(lua_State *L, int arg, VkExportMemoryAllocateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExportMemoryAllocateInfoKHR moonvulkan_zinitVkExportMemoryAllocateInfoKHR
 int zinitVkExportMemoryAllocateInfoKHR(lua_State *L, VkExportMemoryAllocateInfoKHR* p, int *err);
 #define zfreeVkExportMemoryAllocateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1165,6 +1368,7 @@ int zpushVkExportMemoryAllocateInfoKHR(lua_State *L, const VkExportMemoryAllocat
 
 #define znewVkImportMemoryFdInfoKHR(L, err) (VkImportMemoryFdInfoKHR*)znew((L), VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR, sizeof(VkImportMemoryFdInfoKHR), (err))
 #define znewarrayVkImportMemoryFdInfoKHR(L, count, err) (VkImportMemoryFdInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR, sizeof(VkImportMemoryFdInfoKHR), (count), (err))
+#define zinitarrayVkImportMemoryFdInfoKHR(p, count) (VkImportMemoryFdInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR, sizeof(VkImportMemoryFdInfoKHR), (count))
 #define znewchainVkImportMemoryFdInfoKHR moonvulkan_znewchainVkImportMemoryFdInfoKHR
 VkImportMemoryFdInfoKHR* znewchainVkImportMemoryFdInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkImportMemoryFdInfoKHR moonvulkan_znewchainarrayVkImportMemoryFdInfoKHR
@@ -1173,6 +1377,8 @@ VkImportMemoryFdInfoKHR* znewchainarrayVkImportMemoryFdInfoKHR(lua_State *L, uin
 VkImportMemoryFdInfoKHR* zcheckVkImportMemoryFdInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImportMemoryFdInfoKHR moonvulkan_zcheckarrayVkImportMemoryFdInfoKHR
 VkImportMemoryFdInfoKHR* zcheckarrayVkImportMemoryFdInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImportMemoryFdInfoKHR moonvulkan_zcheckarraybufVkImportMemoryFdInfoKHR
+VkImportMemoryFdInfoKHR* zcheckarraybufVkImportMemoryFdInfoKHR(lua_State *L, int arg, VkImportMemoryFdInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImportMemoryFdInfoKHR moonvulkan_zinitVkImportMemoryFdInfoKHR
 int zinitVkImportMemoryFdInfoKHR(lua_State *L, VkImportMemoryFdInfoKHR* p, int *err);
 #define zfreeVkImportMemoryFdInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1182,6 +1388,7 @@ int zpushVkImportMemoryFdInfoKHR(lua_State *L, const VkImportMemoryFdInfoKHR *p)
 
 #define znewVkMappedMemoryRange(L, err) (VkMappedMemoryRange*)znew((L), VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, sizeof(VkMappedMemoryRange), (err))
 #define znewarrayVkMappedMemoryRange(L, count, err) (VkMappedMemoryRange*)znewarray((L), VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, sizeof(VkMappedMemoryRange), (count), (err))
+#define zinitarrayVkMappedMemoryRange(p, count) (VkMappedMemoryRange*)zinitarray((p), VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, sizeof(VkMappedMemoryRange), (count))
 #define znewchainVkMappedMemoryRange moonvulkan_znewchainVkMappedMemoryRange
 VkMappedMemoryRange* znewchainVkMappedMemoryRange(lua_State *L, int *err);
 #define znewchainarrayVkMappedMemoryRange moonvulkan_znewchainarrayVkMappedMemoryRange
@@ -1190,6 +1397,8 @@ VkMappedMemoryRange* znewchainarrayVkMappedMemoryRange(lua_State *L, uint32_t co
 VkMappedMemoryRange* zcheckVkMappedMemoryRange(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMappedMemoryRange moonvulkan_zcheckarrayVkMappedMemoryRange
 VkMappedMemoryRange* zcheckarrayVkMappedMemoryRange(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMappedMemoryRange moonvulkan_zcheckarraybufVkMappedMemoryRange
+VkMappedMemoryRange* zcheckarraybufVkMappedMemoryRange(lua_State *L, int arg, VkMappedMemoryRange *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMappedMemoryRange moonvulkan_zinitVkMappedMemoryRange
 int zinitVkMappedMemoryRange(lua_State *L, VkMappedMemoryRange* p, int *err);
 #define zfreeVkMappedMemoryRange(L, p, base) zfree((L), (p), (base))
@@ -1199,6 +1408,7 @@ int zpushVkMappedMemoryRange(lua_State *L, const VkMappedMemoryRange *p);
 
 #define znewVkHdrMetadataEXT(L, err) (VkHdrMetadataEXT*)znew((L), VK_STRUCTURE_TYPE_HDR_METADATA_EXT, sizeof(VkHdrMetadataEXT), (err))
 #define znewarrayVkHdrMetadataEXT(L, count, err) (VkHdrMetadataEXT*)znewarray((L), VK_STRUCTURE_TYPE_HDR_METADATA_EXT, sizeof(VkHdrMetadataEXT), (count), (err))
+#define zinitarrayVkHdrMetadataEXT(p, count) (VkHdrMetadataEXT*)zinitarray((p), VK_STRUCTURE_TYPE_HDR_METADATA_EXT, sizeof(VkHdrMetadataEXT), (count))
 #define znewchainVkHdrMetadataEXT moonvulkan_znewchainVkHdrMetadataEXT
 VkHdrMetadataEXT* znewchainVkHdrMetadataEXT(lua_State *L, int *err);
 #define znewchainarrayVkHdrMetadataEXT moonvulkan_znewchainarrayVkHdrMetadataEXT
@@ -1207,6 +1417,8 @@ VkHdrMetadataEXT* znewchainarrayVkHdrMetadataEXT(lua_State *L, uint32_t count, i
 VkHdrMetadataEXT* zcheckVkHdrMetadataEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkHdrMetadataEXT moonvulkan_zcheckarrayVkHdrMetadataEXT
 VkHdrMetadataEXT* zcheckarrayVkHdrMetadataEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkHdrMetadataEXT moonvulkan_zcheckarraybufVkHdrMetadataEXT
+VkHdrMetadataEXT* zcheckarraybufVkHdrMetadataEXT(lua_State *L, int arg, VkHdrMetadataEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkHdrMetadataEXT moonvulkan_zinitVkHdrMetadataEXT
 int zinitVkHdrMetadataEXT(lua_State *L, VkHdrMetadataEXT* p, int *err);
 #define zfreeVkHdrMetadataEXT(L, p, base) zfree((L), (p), (base))
@@ -1216,6 +1428,7 @@ int zpushVkHdrMetadataEXT(lua_State *L, const VkHdrMetadataEXT *p);
 
 #define znewVkSubmitInfo(L, err) (VkSubmitInfo*)znew((L), VK_STRUCTURE_TYPE_SUBMIT_INFO, sizeof(VkSubmitInfo), (err))
 #define znewarrayVkSubmitInfo(L, count, err) (VkSubmitInfo*)znewarray((L), VK_STRUCTURE_TYPE_SUBMIT_INFO, sizeof(VkSubmitInfo), (count), (err))
+#define zinitarrayVkSubmitInfo(p, count) (VkSubmitInfo*)zinitarray((p), VK_STRUCTURE_TYPE_SUBMIT_INFO, sizeof(VkSubmitInfo), (count))
 #define znewchainVkSubmitInfo moonvulkan_znewchainVkSubmitInfo
 VkSubmitInfo* znewchainVkSubmitInfo(lua_State *L, int *err);
 #define znewchainarrayVkSubmitInfo moonvulkan_znewchainarrayVkSubmitInfo
@@ -1224,6 +1437,8 @@ VkSubmitInfo* znewchainarrayVkSubmitInfo(lua_State *L, uint32_t count, int *err)
 VkSubmitInfo* zcheckVkSubmitInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSubmitInfo moonvulkan_zcheckarrayVkSubmitInfo
 VkSubmitInfo* zcheckarrayVkSubmitInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSubmitInfo moonvulkan_zcheckarraybufVkSubmitInfo
+VkSubmitInfo* zcheckarraybufVkSubmitInfo(lua_State *L, int arg, VkSubmitInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSubmitInfo moonvulkan_zinitVkSubmitInfo
 int zinitVkSubmitInfo(lua_State *L, VkSubmitInfo* p, int *err);
 #define zfreeVkSubmitInfo(L, p, base) zfree((L), (p), (base))
@@ -1233,6 +1448,7 @@ int zpushVkSubmitInfo(lua_State *L, const VkSubmitInfo *p);
 
 #define znewVkPresentRegionsKHR(L, err) (VkPresentRegionsKHR*)znew((L), VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR, sizeof(VkPresentRegionsKHR), (err))
 #define znewarrayVkPresentRegionsKHR(L, count, err) (VkPresentRegionsKHR*)znewarray((L), VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR, sizeof(VkPresentRegionsKHR), (count), (err))
+#define zinitarrayVkPresentRegionsKHR(p, count) (VkPresentRegionsKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR, sizeof(VkPresentRegionsKHR), (count))
 #define znewchainVkPresentRegionsKHR moonvulkan_znewchainVkPresentRegionsKHR
 VkPresentRegionsKHR* znewchainVkPresentRegionsKHR(lua_State *L, int *err);
 #define znewchainarrayVkPresentRegionsKHR moonvulkan_znewchainarrayVkPresentRegionsKHR
@@ -1241,6 +1457,8 @@ VkPresentRegionsKHR* znewchainarrayVkPresentRegionsKHR(lua_State *L, uint32_t co
 VkPresentRegionsKHR* zcheckVkPresentRegionsKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPresentRegionsKHR moonvulkan_zcheckarrayVkPresentRegionsKHR
 VkPresentRegionsKHR* zcheckarrayVkPresentRegionsKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPresentRegionsKHR moonvulkan_zcheckarraybufVkPresentRegionsKHR
+VkPresentRegionsKHR* zcheckarraybufVkPresentRegionsKHR(lua_State *L, int arg, VkPresentRegionsKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPresentRegionsKHR moonvulkan_zinitVkPresentRegionsKHR
 int zinitVkPresentRegionsKHR(lua_State *L, VkPresentRegionsKHR* p, int *err);
 #define zfreeVkPresentRegionsKHR(L, p, base) zfree((L), (p), (base))
@@ -1250,6 +1468,7 @@ int zpushVkPresentRegionsKHR(lua_State *L, const VkPresentRegionsKHR *p);
 
 #define znewVkDisplayPresentInfoKHR(L, err) (VkDisplayPresentInfoKHR*)znew((L), VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR, sizeof(VkDisplayPresentInfoKHR), (err))
 #define znewarrayVkDisplayPresentInfoKHR(L, count, err) (VkDisplayPresentInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR, sizeof(VkDisplayPresentInfoKHR), (count), (err))
+#define zinitarrayVkDisplayPresentInfoKHR(p, count) (VkDisplayPresentInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR, sizeof(VkDisplayPresentInfoKHR), (count))
 #define znewchainVkDisplayPresentInfoKHR moonvulkan_znewchainVkDisplayPresentInfoKHR
 VkDisplayPresentInfoKHR* znewchainVkDisplayPresentInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkDisplayPresentInfoKHR moonvulkan_znewchainarrayVkDisplayPresentInfoKHR
@@ -1258,6 +1477,8 @@ VkDisplayPresentInfoKHR* znewchainarrayVkDisplayPresentInfoKHR(lua_State *L, uin
 VkDisplayPresentInfoKHR* zcheckVkDisplayPresentInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayPresentInfoKHR moonvulkan_zcheckarrayVkDisplayPresentInfoKHR
 VkDisplayPresentInfoKHR* zcheckarrayVkDisplayPresentInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayPresentInfoKHR moonvulkan_zcheckarraybufVkDisplayPresentInfoKHR
+VkDisplayPresentInfoKHR* zcheckarraybufVkDisplayPresentInfoKHR(lua_State *L, int arg, VkDisplayPresentInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayPresentInfoKHR moonvulkan_zinitVkDisplayPresentInfoKHR
 int zinitVkDisplayPresentInfoKHR(lua_State *L, VkDisplayPresentInfoKHR* p, int *err);
 #define zfreeVkDisplayPresentInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1267,6 +1488,7 @@ int zpushVkDisplayPresentInfoKHR(lua_State *L, const VkDisplayPresentInfoKHR *p)
 
 #define znewVkPresentInfoKHR(L, err) (VkPresentInfoKHR*)znew((L), VK_STRUCTURE_TYPE_PRESENT_INFO_KHR, sizeof(VkPresentInfoKHR), (err))
 #define znewarrayVkPresentInfoKHR(L, count, err) (VkPresentInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_PRESENT_INFO_KHR, sizeof(VkPresentInfoKHR), (count), (err))
+#define zinitarrayVkPresentInfoKHR(p, count) (VkPresentInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PRESENT_INFO_KHR, sizeof(VkPresentInfoKHR), (count))
 #define znewchainVkPresentInfoKHR moonvulkan_znewchainVkPresentInfoKHR
 VkPresentInfoKHR* znewchainVkPresentInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkPresentInfoKHR moonvulkan_znewchainarrayVkPresentInfoKHR
@@ -1275,6 +1497,8 @@ VkPresentInfoKHR* znewchainarrayVkPresentInfoKHR(lua_State *L, uint32_t count, i
 VkPresentInfoKHR* zcheckVkPresentInfoKHR(lua_State *L, int arg, int *err, int results); //non-standard
 #define zcheckarrayVkPresentInfoKHR moonvulkan_zcheckarrayVkPresentInfoKHR
 VkPresentInfoKHR* zcheckarrayVkPresentInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPresentInfoKHR moonvulkan_zcheckarraybufVkPresentInfoKHR
+VkPresentInfoKHR* zcheckarraybufVkPresentInfoKHR(lua_State *L, int arg, VkPresentInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPresentInfoKHR moonvulkan_zinitVkPresentInfoKHR
 int zinitVkPresentInfoKHR(lua_State *L, VkPresentInfoKHR* p, int *err);
 #define zfreeVkPresentInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1284,6 +1508,7 @@ int zpushVkPresentInfoKHR(lua_State *L, const VkPresentInfoKHR *p);
 
 #define znewVkBindSparseInfo(L, err) (VkBindSparseInfo*)znew((L), VK_STRUCTURE_TYPE_BIND_SPARSE_INFO, sizeof(VkBindSparseInfo), (err))
 #define znewarrayVkBindSparseInfo(L, count, err) (VkBindSparseInfo*)znewarray((L), VK_STRUCTURE_TYPE_BIND_SPARSE_INFO, sizeof(VkBindSparseInfo), (count), (err))
+#define zinitarrayVkBindSparseInfo(p, count) (VkBindSparseInfo*)zinitarray((p), VK_STRUCTURE_TYPE_BIND_SPARSE_INFO, sizeof(VkBindSparseInfo), (count))
 #define znewchainVkBindSparseInfo moonvulkan_znewchainVkBindSparseInfo
 VkBindSparseInfo* znewchainVkBindSparseInfo(lua_State *L, int *err);
 #define znewchainarrayVkBindSparseInfo moonvulkan_znewchainarrayVkBindSparseInfo
@@ -1292,6 +1517,8 @@ VkBindSparseInfo* znewchainarrayVkBindSparseInfo(lua_State *L, uint32_t count, i
 VkBindSparseInfo* zcheckVkBindSparseInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBindSparseInfo moonvulkan_zcheckarrayVkBindSparseInfo
 VkBindSparseInfo* zcheckarrayVkBindSparseInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBindSparseInfo moonvulkan_zcheckarraybufVkBindSparseInfo
+VkBindSparseInfo* zcheckarraybufVkBindSparseInfo(lua_State *L, int arg, VkBindSparseInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBindSparseInfo moonvulkan_zinitVkBindSparseInfo
 int zinitVkBindSparseInfo(lua_State *L, VkBindSparseInfo* p, int *err);
 #define zfreeVkBindSparseInfo(L, p, base) zfree((L), (p), (base))
@@ -1301,6 +1528,7 @@ int zpushVkBindSparseInfo(lua_State *L, const VkBindSparseInfo *p);
 
 #define znewVkBindBufferMemoryInfo(L, err) (VkBindBufferMemoryInfo*)znew((L), VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO, sizeof(VkBindBufferMemoryInfo), (err))
 #define znewarrayVkBindBufferMemoryInfo(L, count, err) (VkBindBufferMemoryInfo*)znewarray((L), VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO, sizeof(VkBindBufferMemoryInfo), (count), (err))
+#define zinitarrayVkBindBufferMemoryInfo(p, count) (VkBindBufferMemoryInfo*)zinitarray((p), VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO, sizeof(VkBindBufferMemoryInfo), (count))
 #define znewchainVkBindBufferMemoryInfo moonvulkan_znewchainVkBindBufferMemoryInfo
 VkBindBufferMemoryInfo* znewchainVkBindBufferMemoryInfo(lua_State *L, int *err);
 #define znewchainarrayVkBindBufferMemoryInfo moonvulkan_znewchainarrayVkBindBufferMemoryInfo
@@ -1309,6 +1537,8 @@ VkBindBufferMemoryInfo* znewchainarrayVkBindBufferMemoryInfo(lua_State *L, uint3
 VkBindBufferMemoryInfo* zcheckVkBindBufferMemoryInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBindBufferMemoryInfo moonvulkan_zcheckarrayVkBindBufferMemoryInfo
 VkBindBufferMemoryInfo* zcheckarrayVkBindBufferMemoryInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBindBufferMemoryInfo moonvulkan_zcheckarraybufVkBindBufferMemoryInfo
+VkBindBufferMemoryInfo* zcheckarraybufVkBindBufferMemoryInfo(lua_State *L, int arg, VkBindBufferMemoryInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBindBufferMemoryInfo moonvulkan_zinitVkBindBufferMemoryInfo
 int zinitVkBindBufferMemoryInfo(lua_State *L, VkBindBufferMemoryInfo* p, int *err);
 #define zfreeVkBindBufferMemoryInfo(L, p, base) zfree((L), (p), (base))
@@ -1318,6 +1548,7 @@ int zpushVkBindBufferMemoryInfo(lua_State *L, const VkBindBufferMemoryInfo *p);
 
 #define znewVkBindImagePlaneMemoryInfoKHR(L, err) (VkBindImagePlaneMemoryInfoKHR*)znew((L), VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO_KHR, sizeof(VkBindImagePlaneMemoryInfoKHR), (err))
 #define znewarrayVkBindImagePlaneMemoryInfoKHR(L, count, err) (VkBindImagePlaneMemoryInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO_KHR, sizeof(VkBindImagePlaneMemoryInfoKHR), (count), (err))
+#define zinitarrayVkBindImagePlaneMemoryInfoKHR(p, count) (VkBindImagePlaneMemoryInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO_KHR, sizeof(VkBindImagePlaneMemoryInfoKHR), (count))
 #define znewchainVkBindImagePlaneMemoryInfoKHR moonvulkan_znewchainVkBindImagePlaneMemoryInfoKHR
 VkBindImagePlaneMemoryInfoKHR* znewchainVkBindImagePlaneMemoryInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkBindImagePlaneMemoryInfoKHR moonvulkan_znewchainarrayVkBindImagePlaneMemoryInfoKHR
@@ -1326,6 +1557,8 @@ VkBindImagePlaneMemoryInfoKHR* znewchainarrayVkBindImagePlaneMemoryInfoKHR(lua_S
 VkBindImagePlaneMemoryInfoKHR* zcheckVkBindImagePlaneMemoryInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBindImagePlaneMemoryInfoKHR moonvulkan_zcheckarrayVkBindImagePlaneMemoryInfoKHR
 VkBindImagePlaneMemoryInfoKHR* zcheckarrayVkBindImagePlaneMemoryInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBindImagePlaneMemoryInfoKHR moonvulkan_zcheckarraybufVkBindImagePlaneMemoryInfoKHR
+VkBindImagePlaneMemoryInfoKHR* zcheckarraybufVkBindImagePlaneMemoryInfoKHR(lua_State *L, int arg, VkBindImagePlaneMemoryInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBindImagePlaneMemoryInfoKHR moonvulkan_zinitVkBindImagePlaneMemoryInfoKHR
 int zinitVkBindImagePlaneMemoryInfoKHR(lua_State *L, VkBindImagePlaneMemoryInfoKHR* p, int *err);
 #define zfreeVkBindImagePlaneMemoryInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1335,6 +1568,7 @@ int zpushVkBindImagePlaneMemoryInfoKHR(lua_State *L, const VkBindImagePlaneMemor
 
 #define znewVkBindImageMemoryInfo(L, err) (VkBindImageMemoryInfo*)znew((L), VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO, sizeof(VkBindImageMemoryInfo), (err))
 #define znewarrayVkBindImageMemoryInfo(L, count, err) (VkBindImageMemoryInfo*)znewarray((L), VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO, sizeof(VkBindImageMemoryInfo), (count), (err))
+#define zinitarrayVkBindImageMemoryInfo(p, count) (VkBindImageMemoryInfo*)zinitarray((p), VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO, sizeof(VkBindImageMemoryInfo), (count))
 #define znewchainVkBindImageMemoryInfo moonvulkan_znewchainVkBindImageMemoryInfo
 VkBindImageMemoryInfo* znewchainVkBindImageMemoryInfo(lua_State *L, int *err);
 #define znewchainarrayVkBindImageMemoryInfo moonvulkan_znewchainarrayVkBindImageMemoryInfo
@@ -1343,6 +1577,8 @@ VkBindImageMemoryInfo* znewchainarrayVkBindImageMemoryInfo(lua_State *L, uint32_
 VkBindImageMemoryInfo* zcheckVkBindImageMemoryInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBindImageMemoryInfo moonvulkan_zcheckarrayVkBindImageMemoryInfo
 VkBindImageMemoryInfo* zcheckarrayVkBindImageMemoryInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBindImageMemoryInfo moonvulkan_zcheckarraybufVkBindImageMemoryInfo
+VkBindImageMemoryInfo* zcheckarraybufVkBindImageMemoryInfo(lua_State *L, int arg, VkBindImageMemoryInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBindImageMemoryInfo moonvulkan_zinitVkBindImageMemoryInfo
 int zinitVkBindImageMemoryInfo(lua_State *L, VkBindImageMemoryInfo* p, int *err);
 #define zfreeVkBindImageMemoryInfo(L, p, base) zfree((L), (p), (base))
@@ -1352,6 +1588,7 @@ int zpushVkBindImageMemoryInfo(lua_State *L, const VkBindImageMemoryInfo *p);
 
 #define znewVkWriteDescriptorSet(L, err) (VkWriteDescriptorSet*)znew((L), VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, sizeof(VkWriteDescriptorSet), (err))
 #define znewarrayVkWriteDescriptorSet(L, count, err) (VkWriteDescriptorSet*)znewarray((L), VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, sizeof(VkWriteDescriptorSet), (count), (err))
+#define zinitarrayVkWriteDescriptorSet(p, count) (VkWriteDescriptorSet*)zinitarray((p), VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, sizeof(VkWriteDescriptorSet), (count))
 #define znewchainVkWriteDescriptorSet moonvulkan_znewchainVkWriteDescriptorSet
 VkWriteDescriptorSet* znewchainVkWriteDescriptorSet(lua_State *L, int *err);
 #define znewchainarrayVkWriteDescriptorSet moonvulkan_znewchainarrayVkWriteDescriptorSet
@@ -1360,6 +1597,8 @@ VkWriteDescriptorSet* znewchainarrayVkWriteDescriptorSet(lua_State *L, uint32_t
 VkWriteDescriptorSet* zcheckVkWriteDescriptorSet(lua_State *L, int arg, int *err);
 #define zcheckarrayVkWriteDescriptorSet moonvulkan_zcheckarrayVkWriteDescriptorSet
 VkWriteDescriptorSet* zcheckarrayVkWriteDescriptorSet(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkWriteDescriptorSet moonvulkan_zcheckarraybufVkWriteDescriptorSet
+VkWriteDescriptorSet* zcheckarraybufVkWriteDescriptorSet(lua_State *L, int arg, VkWriteDescriptorSet *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkWriteDescriptorSet moonvulkan_zinitVkWriteDescriptorSet
 int zinitVkWriteDescriptorSet(lua_State *L, VkWriteDescriptorSet* p, int *err);
 #define zfreeVkWriteDescriptorSet(L, p, base) zfree((L), (p), (base))
@@ -1369,6 +1608,7 @@ int zpushVkWriteDescriptorSet(lua_State *L, const VkWriteDescriptorSet *p);
 
 #define znewVkCopyDescriptorSet(L, err) (VkCopyDescriptorSet*)znew((L), VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET, sizeof(VkCopyDescriptorSet), (err))
 #define znewarrayVkCopyDescriptorSet(L, count, err) (VkCopyDescriptorSet*)znewarray((L), VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET, sizeof(VkCopyDescriptorSet), (count), (err))
+#define zinitarrayVkCopyDescriptorSet(p, count) (VkCopyDescriptorSet*)zinitarray((p), VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET, sizeof(VkCopyDescriptorSet), (count))
 #define znewchainVkCopyDescriptorSet moonvulkan_znewchainVkCopyDescriptorSet
 VkCopyDescriptorSet* znewchainVkCopyDescriptorSet(lua_State *L, int *err);
 #define znewchainarrayVkCopyDescriptorSet moonvulkan_znewchainarrayVkCopyDescriptorSet
@@ -1377,6 +1617,8 @@ VkCopyDescriptorSet* znewchainarrayVkCopyDescriptorSet(lua_State *L, uint32_t co
 VkCopyDescriptorSet* zcheckVkCopyDescriptorSet(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCopyDescriptorSet moonvulkan_zcheckarrayVkCopyDescriptorSet
 VkCopyDescriptorSet* zcheckarrayVkCopyDescriptorSet(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCopyDescriptorSet moonvulkan_zcheckarraybufVkCopyDescriptorSet
+VkCopyDescriptorSet* zcheckarraybufVkCopyDescriptorSet(lua_State *L, int arg, VkCopyDescriptorSet *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCopyDescriptorSet moonvulkan_zinitVkCopyDescriptorSet
 int zinitVkCopyDescriptorSet(lua_State *L, VkCopyDescriptorSet* p, int *err);
 #define zfreeVkCopyDescriptorSet(L, p, base) zfree((L), (p), (base))
@@ -1386,6 +1628,7 @@ int zpushVkCopyDescriptorSet(lua_State *L, const VkCopyDescriptorSet *p);
 
 #define znewVkDebugUtilsObjectNameInfoEXT(L, err) (VkDebugUtilsObjectNameInfoEXT*)znew((L), VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT, sizeof(VkDebugUtilsObjectNameInfoEXT), (err))
 #define znewarrayVkDebugUtilsObjectNameInfoEXT(L, count, err) (VkDebugUtilsObjectNameInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT, sizeof(VkDebugUtilsObjectNameInfoEXT), (count), (err))
+#define zinitarrayVkDebugUtilsObjectNameInfoEXT(p, count) (VkDebugUtilsObjectNameInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT, sizeof(VkDebugUtilsObjectNameInfoEXT), (count))
 #define znewchainVkDebugUtilsObjectNameInfoEXT moonvulkan_znewchainVkDebugUtilsObjectNameInfoEXT
 VkDebugUtilsObjectNameInfoEXT* znewchainVkDebugUtilsObjectNameInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkDebugUtilsObjectNameInfoEXT moonvulkan_znewchainarrayVkDebugUtilsObjectNameInfoEXT
@@ -1394,6 +1637,8 @@ VkDebugUtilsObjectNameInfoEXT* znewchainarrayVkDebugUtilsObjectNameInfoEXT(lua_S
 VkDebugUtilsObjectNameInfoEXT* zcheckVkDebugUtilsObjectNameInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDebugUtilsObjectNameInfoEXT moonvulkan_zcheckarrayVkDebugUtilsObjectNameInfoEXT
 VkDebugUtilsObjectNameInfoEXT* zcheckarrayVkDebugUtilsObjectNameInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDebugUtilsObjectNameInfoEXT moonvulkan_zcheckarraybufVkDebugUtilsObjectNameInfoEXT
+VkDebugUtilsObjectNameInfoEXT* zcheckarraybufVkDebugUtilsObjectNameInfoEXT(lua_State *L, int arg, VkDebugUtilsObjectNameInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDebugUtilsObjectNameInfoEXT moonvulkan_zinitVkDebugUtilsObjectNameInfoEXT
 int zinitVkDebugUtilsObjectNameInfoEXT(lua_State *L, VkDebugUtilsObjectNameInfoEXT* p, int *err);
 #define zfreeVkDebugUtilsObjectNameInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -1403,6 +1648,7 @@ int zpushVkDebugUtilsObjectNameInfoEXT(lua_State *L, const VkDebugUtilsObjectNam
 
 #define znewVkDebugUtilsObjectTagInfoEXT(L, err) (VkDebugUtilsObjectTagInfoEXT*)znew((L), VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_TAG_INFO_EXT, sizeof(VkDebugUtilsObjectTagInfoEXT), (err))
 #define znewarrayVkDebugUtilsObjectTagInfoEXT(L, count, err) (VkDebugUtilsObjectTagInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_TAG_INFO_EXT, sizeof(VkDebugUtilsObjectTagInfoEXT), (count), (err))
+#define zinitarrayVkDebugUtilsObjectTagInfoEXT(p, count) (VkDebugUtilsObjectTagInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_TAG_INFO_EXT, sizeof(VkDebugUtilsObjectTagInfoEXT), (count))
 #define znewchainVkDebugUtilsObjectTagInfoEXT moonvulkan_znewchainVkDebugUtilsObjectTagInfoEXT
 VkDebugUtilsObjectTagInfoEXT* znewchainVkDebugUtilsObjectTagInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkDebugUtilsObjectTagInfoEXT moonvulkan_znewchainarrayVkDebugUtilsObjectTagInfoEXT
@@ -1411,6 +1657,8 @@ VkDebugUtilsObjectTagInfoEXT* znewchainarrayVkDebugUtilsObjectTagInfoEXT(lua_Sta
 VkDebugUtilsObjectTagInfoEXT* zcheckVkDebugUtilsObjectTagInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDebugUtilsObjectTagInfoEXT moonvulkan_zcheckarrayVkDebugUtilsObjectTagInfoEXT
 VkDebugUtilsObjectTagInfoEXT* zcheckarrayVkDebugUtilsObjectTagInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDebugUtilsObjectTagInfoEXT moonvulkan_zcheckarraybufVkDebugUtilsObjectTagInfoEXT
+VkDebugUtilsObjectTagInfoEXT* zcheckarraybufVkDebugUtilsObjectTagInfoEXT(lua_State *L, int arg, VkDebugUtilsObjectTagInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDebugUtilsObjectTagInfoEXT moonvulkan_zinitVkDebugUtilsObjectTagInfoEXT
 int zinitVkDebugUtilsObjectTagInfoEXT(lua_State *L, VkDebugUtilsObjectTagInfoEXT* p, int *err);
 #define zfreeVkDebugUtilsObjectTagInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -1420,6 +1668,7 @@ int zpushVkDebugUtilsObjectTagInfoEXT(lua_State *L, const VkDebugUtilsObjectTagI
 
 #define znewVkDebugUtilsLabelEXT(L, err) (VkDebugUtilsLabelEXT*)znew((L), VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT, sizeof(VkDebugUtilsLabelEXT), (err))
 #define znewarrayVkDebugUtilsLabelEXT(L, count, err) (VkDebugUtilsLabelEXT*)znewarray((L), VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT, sizeof(VkDebugUtilsLabelEXT), (count), (err))
+#define zinitarrayVkDebugUtilsLabelEXT(p, count) (VkDebugUtilsLabelEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT, sizeof(VkDebugUtilsLabelEXT), (count))
 #define znewchainVkDebugUtilsLabelEXT moonvulkan_znewchainVkDebugUtilsLabelEXT
 VkDebugUtilsLabelEXT* znewchainVkDebugUtilsLabelEXT(lua_State *L, int *err);
 #define znewchainarrayVkDebugUtilsLabelEXT moonvulkan_znewchainarrayVkDebugUtilsLabelEXT
@@ -1428,6 +1677,8 @@ VkDebugUtilsLabelEXT* znewchainarrayVkDebugUtilsLabelEXT(lua_State *L, uint32_t
 VkDebugUtilsLabelEXT* zcheckVkDebugUtilsLabelEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDebugUtilsLabelEXT moonvulkan_zcheckarrayVkDebugUtilsLabelEXT
 VkDebugUtilsLabelEXT* zcheckarrayVkDebugUtilsLabelEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDebugUtilsLabelEXT moonvulkan_zcheckarraybufVkDebugUtilsLabelEXT
+VkDebugUtilsLabelEXT* zcheckarraybufVkDebugUtilsLabelEXT(lua_State *L, int arg, VkDebugUtilsLabelEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDebugUtilsLabelEXT moonvulkan_zinitVkDebugUtilsLabelEXT
 int zinitVkDebugUtilsLabelEXT(lua_State *L, VkDebugUtilsLabelEXT* p, int *err);
 #define zfreeVkDebugUtilsLabelEXT(L, p, base) zfree((L), (p), (base))
@@ -1437,6 +1688,7 @@ int zpushVkDebugUtilsLabelEXT(lua_State *L, const VkDebugUtilsLabelEXT *p);
 
 #define znewVkDebugUtilsMessengerCallbackDataEXT(L, err) (VkDebugUtilsMessengerCallbackDataEXT*)znew((L), VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT, sizeof(VkDebugUtilsMessengerCallbackDataEXT), (err))
 #define znewarrayVkDebugUtilsMessengerCallbackDataEXT(L, count, err) (VkDebugUtilsMessengerCallbackDataEXT*)znewarray((L), VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT, sizeof(VkDebugUtilsMessengerCallbackDataEXT), (count), (err))
+#define zinitarrayVkDebugUtilsMessengerCallbackDataEXT(p, count) (VkDebugUtilsMessengerCallbackDataEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT, sizeof(VkDebugUtilsMessengerCallbackDataEXT), (count))
 #define znewchainVkDebugUtilsMessengerCallbackDataEXT moonvulkan_znewchainVkDebugUtilsMessengerCallbackDataEXT
 VkDebugUtilsMessengerCallbackDataEXT* znewchainVkDebugUtilsMessengerCallbackDataEXT(lua_State *L, int *err);
 #define znewchainarrayVkDebugUtilsMessengerCallbackDataEXT moonvulkan_znewchainarrayVkDebugUtilsMessengerCallbackDataEXT
@@ -1445,6 +1697,8 @@ VkDebugUtilsMessengerCallbackDataEXT* znewchainarrayVkDebugUtilsMessengerCallbac
 VkDebugUtilsMessengerCallbackDataEXT* zcheckVkDebugUtilsMessengerCallbackDataEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDebugUtilsMessengerCallbackDataEXT moonvulkan_zcheckarrayVkDebugUtilsMessengerCallbackDataEXT
 VkDebugUtilsMessengerCallbackDataEXT* zcheckarrayVkDebugUtilsMessengerCallbackDataEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDebugUtilsMessengerCallbackDataEXT moonvulkan_zcheckarraybufVkDebugUtilsMessengerCallbackDataEXT
+VkDebugUtilsMessengerCallbackDataEXT* zcheckarraybufVkDebugUtilsMessengerCallbackDataEXT(lua_State *L, int arg, VkDebugUtilsMessengerCallbackDataEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDebugUtilsMessengerCallbackDataEXT moonvulkan_zinitVkDebugUtilsMessengerCallbackDataEXT
 int zinitVkDebugUtilsMessengerCallbackDataEXT(lua_State *L, VkDebugUtilsMessengerCallbackDataEXT* p, int *err);
 #define zfreeVkDebugUtilsMessengerCallbackDataEXT(L, p, base) zfree((L), (p), (base))
@@ -1454,6 +1708,7 @@ int zpushVkDebugUtilsMessengerCallbackDataEXT(lua_State *L, const VkDebugUtilsMe
 
 #define znewVkDisplayPowerInfoEXT(L, err) (VkDisplayPowerInfoEXT*)znew((L), VK_STRUCTURE_TYPE_DISPLAY_POWER_INFO_EXT, sizeof(VkDisplayPowerInfoEXT), (err))
 #define znewarrayVkDisplayPowerInfoEXT(L, count, err) (VkDisplayPowerInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_DISPLAY_POWER_INFO_EXT, sizeof(VkDisplayPowerInfoEXT), (count), (err))
+#define zinitarrayVkDisplayPowerInfoEXT(p, count) (VkDisplayPowerInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DISPLAY_POWER_INFO_EXT, sizeof(VkDisplayPowerInfoEXT), (count))
 #define znewchainVkDisplayPowerInfoEXT moonvulkan_znewchainVkDisplayPowerInfoEXT
 VkDisplayPowerInfoEXT* znewchainVkDisplayPowerInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkDisplayPowerInfoEXT moonvulkan_znewchainarrayVkDisplayPowerInfoEXT
@@ -1462,6 +1717,8 @@ VkDisplayPowerInfoEXT* znewchainarrayVkDisplayPowerInfoEXT(lua_State *L, uint32_
 VkDisplayPowerInfoEXT* zcheckVkDisplayPowerInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayPowerInfoEXT moonvulkan_zcheckarrayVkDisplayPowerInfoEXT
 VkDisplayPowerInfoEXT* zcheckarrayVkDisplayPowerInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayPowerInfoEXT moonvulkan_zcheckarraybufVkDisplayPowerInfoEXT
+VkDisplayPowerInfoEXT* zcheckarraybufVkDisplayPowerInfoEXT(lua_State *L, int arg, VkDisplayPowerInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayPowerInfoEXT moonvulkan_zinitVkDisplayPowerInfoEXT
 int zinitVkDisplayPowerInfoEXT(lua_State *L, VkDisplayPowerInfoEXT* p, int *err);
 #define zfreeVkDisplayPowerInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -1471,6 +1728,7 @@ int zpushVkDisplayPowerInfoEXT(lua_State *L, const VkDisplayPowerInfoEXT *p);
 
 #define znewVkMultisamplePropertiesEXT(L, err) (VkMultisamplePropertiesEXT*)znew((L), VK_STRUCTURE_TYPE_MULTISAMPLE_PROPERTIES_EXT, sizeof(VkMultisamplePropertiesEXT), (err))
 #define znewarrayVkMultisamplePropertiesEXT(L, count, err) (VkMultisamplePropertiesEXT*)znewarray((L), VK_STRUCTURE_TYPE_MULTISAMPLE_PROPERTIES_EXT, sizeof(VkMultisamplePropertiesEXT), (count), (err))
+#define zinitarrayVkMultisamplePropertiesEXT(p, count) (VkMultisamplePropertiesEXT*)zinitarray((p), VK_STRUCTURE_TYPE_MULTISAMPLE_PROPERTIES_EXT, sizeof(VkMultisamplePropertiesEXT), (count))
 #define znewchainVkMultisamplePropertiesEXT moonvulkan_znewchainVkMultisamplePropertiesEXT
 VkMultisamplePropertiesEXT* znewchainVkMultisamplePropertiesEXT(lua_State *L, int *err);
 #define znewchainarrayVkMultisamplePropertiesEXT moonvulkan_znewchainarrayVkMultisamplePropertiesEXT
@@ -1479,6 +1737,8 @@ VkMultisamplePropertiesEXT* znewchainarrayVkMultisamplePropertiesEXT(lua_State *
 VkMultisamplePropertiesEXT* zcheckVkMultisamplePropertiesEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMultisamplePropertiesEXT moonvulkan_zcheckarrayVkMultisamplePropertiesEXT
 VkMultisamplePropertiesEXT* zcheckarrayVkMultisamplePropertiesEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMultisamplePropertiesEXT moonvulkan_zcheckarraybufVkMultisamplePropertiesEXT
+VkMultisamplePropertiesEXT* zcheckarraybufVkMultisamplePropertiesEXT(lua_State *L, int arg, VkMultisamplePropertiesEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMultisamplePropertiesEXT moonvulkan_zinitVkMultisamplePropertiesEXT
 int zinitVkMultisamplePropertiesEXT(lua_State *L, VkMultisamplePropertiesEXT* p, int *err);
 #define zfreeVkMultisamplePropertiesEXT(L, p, base) zfree((L), (p), (base))
@@ -1488,6 +1748,7 @@ int zpushVkMultisamplePropertiesEXT(lua_State *L, const VkMultisamplePropertiesE
 
 #define znewVkConditionalRenderingBeginInfoEXT(L, err) (VkConditionalRenderingBeginInfoEXT*)znew((L), VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT, sizeof(VkConditionalRenderingBeginInfoEXT), (err))
 #define znewarrayVkConditionalRenderingBeginInfoEXT(L, count, err) (VkConditionalRenderingBeginInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT, sizeof(VkConditionalRenderingBeginInfoEXT), (count), (err))
+#define zinitarrayVkConditionalRenderingBeginInfoEXT(p, count) (VkConditionalRenderingBeginInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT, sizeof(VkConditionalRenderingBeginInfoEXT), (count))
 #define znewchainVkConditionalRenderingBeginInfoEXT moonvulkan_znewchainVkConditionalRenderingBeginInfoEXT
 VkConditionalRenderingBeginInfoEXT* znewchainVkConditionalRenderingBeginInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkConditionalRenderingBeginInfoEXT moonvulkan_znewchainarrayVkConditionalRenderingBeginInfoEXT
@@ -1496,6 +1757,8 @@ VkConditionalRenderingBeginInfoEXT* znewchainarrayVkConditionalRenderingBeginInf
 VkConditionalRenderingBeginInfoEXT* zcheckVkConditionalRenderingBeginInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkConditionalRenderingBeginInfoEXT moonvulkan_zcheckarrayVkConditionalRenderingBeginInfoEXT
 VkConditionalRenderingBeginInfoEXT* zcheckarrayVkConditionalRenderingBeginInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkConditionalRenderingBeginInfoEXT moonvulkan_zcheckarraybufVkConditionalRenderingBeginInfoEXT
+VkConditionalRenderingBeginInfoEXT* zcheckarraybufVkConditionalRenderingBeginInfoEXT(lua_State *L, int arg, VkConditionalRenderingBeginInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkConditionalRenderingBeginInfoEXT moonvulkan_zinitVkConditionalRenderingBeginInfoEXT
 int zinitVkConditionalRenderingBeginInfoEXT(lua_State *L, VkConditionalRenderingBeginInfoEXT* p, int *err);
 #define zfreeVkConditionalRenderingBeginInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -1505,6 +1768,7 @@ int zpushVkConditionalRenderingBeginInfoEXT(lua_State *L, const VkConditionalRen
 
 #define znewVkDescriptorSetLayoutSupport(L, err) (VkDescriptorSetLayoutSupport*)znew((L), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT, sizeof(VkDescriptorSetLayoutSupport), (err))
 #define znewarrayVkDescriptorSetLayoutSupport(L, count, err) (VkDescriptorSetLayoutSupport*)znewarray((L), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT, sizeof(VkDescriptorSetLayoutSupport), (count), (err))
+#define zinitarrayVkDescriptorSetLayoutSupport(p, count) (VkDescriptorSetLayoutSupport*)zinitarray((p), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT, sizeof(VkDescriptorSetLayoutSupport), (count))
 #define znewchainVkDescriptorSetLayoutSupport moonvulkan_znewchainVkDescriptorSetLayoutSupport
 VkDescriptorSetLayoutSupport* znewchainVkDescriptorSetLayoutSupport(lua_State *L, int *err);
 #define znewchainarrayVkDescriptorSetLayoutSupport moonvulkan_znewchainarrayVkDescriptorSetLayoutSupport
@@ -1513,6 +1777,8 @@ VkDescriptorSetLayoutSupport* znewchainarrayVkDescriptorSetLayoutSupport(lua_Sta
 VkDescriptorSetLayoutSupport* zcheckVkDescriptorSetLayoutSupport(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDescriptorSetLayoutSupport moonvulkan_zcheckarrayVkDescriptorSetLayoutSupport
 VkDescriptorSetLayoutSupport* zcheckarrayVkDescriptorSetLayoutSupport(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDescriptorSetLayoutSupport moonvulkan_zcheckarraybufVkDescriptorSetLayoutSupport
+VkDescriptorSetLayoutSupport* zcheckarraybufVkDescriptorSetLayoutSupport(lua_State *L, int arg, VkDescriptorSetLayoutSupport *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDescriptorSetLayoutSupport moonvulkan_zinitVkDescriptorSetLayoutSupport
 int zinitVkDescriptorSetLayoutSupport(lua_State *L, VkDescriptorSetLayoutSupport* p, int *err);
 #define zfreeVkDescriptorSetLayoutSupport(L, p, base) zfree((L), (p), (base))
@@ -1522,6 +1788,7 @@ int zpushVkDescriptorSetLayoutSupport(lua_State *L, const VkDescriptorSetLayoutS
 
 #define znewVkPipelineShaderStageCreateInfo(L, err) (VkPipelineShaderStageCreateInfo*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, sizeof(VkPipelineShaderStageCreateInfo), (err))
 #define znewarrayVkPipelineShaderStageCreateInfo(L, count, err) (VkPipelineShaderStageCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, sizeof(VkPipelineShaderStageCreateInfo), (count), (err))
+#define zinitarrayVkPipelineShaderStageCreateInfo(p, count) (VkPipelineShaderStageCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, sizeof(VkPipelineShaderStageCreateInfo), (count))
 #define znewchainVkPipelineShaderStageCreateInfo moonvulkan_znewchainVkPipelineShaderStageCreateInfo
 VkPipelineShaderStageCreateInfo* znewchainVkPipelineShaderStageCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkPipelineShaderStageCreateInfo moonvulkan_znewchainarrayVkPipelineShaderStageCreateInfo
@@ -1530,6 +1797,8 @@ VkPipelineShaderStageCreateInfo* znewchainarrayVkPipelineShaderStageCreateInfo(l
 VkPipelineShaderStageCreateInfo* zcheckVkPipelineShaderStageCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineShaderStageCreateInfo moonvulkan_zcheckarrayVkPipelineShaderStageCreateInfo
 VkPipelineShaderStageCreateInfo* zcheckarrayVkPipelineShaderStageCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineShaderStageCreateInfo moonvulkan_zcheckarraybufVkPipelineShaderStageCreateInfo
+VkPipelineShaderStageCreateInfo* zcheckarraybufVkPipelineShaderStageCreateInfo(lua_State *L, int arg, VkPipelineShaderStageCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineShaderStageCreateInfo moonvulkan_zinitVkPipelineShaderStageCreateInfo
 int zinitVkPipelineShaderStageCreateInfo(lua_State *L, VkPipelineShaderStageCreateInfo* p, int *err);
 #define zfreeVkPipelineShaderStageCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -1539,6 +1808,7 @@ int zpushVkPipelineShaderStageCreateInfo(lua_State *L, const VkPipelineShaderSta
 
 #define znewVkComputePipelineCreateInfo(L, err) (VkComputePipelineCreateInfo*)znew((L), VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO, sizeof(VkComputePipelineCreateInfo), (err))
 #define znewarrayVkComputePipelineCreateInfo(L, count, err) (VkComputePipelineCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO, sizeof(VkComputePipelineCreateInfo), (count), (err))
+#define zinitarrayVkComputePipelineCreateInfo(p, count) (VkComputePipelineCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO, sizeof(VkComputePipelineCreateInfo), (count))
 #define znewchainVkComputePipelineCreateInfo moonvulkan_znewchainVkComputePipelineCreateInfo
 VkComputePipelineCreateInfo* znewchainVkComputePipelineCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkComputePipelineCreateInfo moonvulkan_znewchainarrayVkComputePipelineCreateInfo
@@ -1547,6 +1817,8 @@ VkComputePipelineCreateInfo* znewchainarrayVkComputePipelineCreateInfo(lua_State
 VkComputePipelineCreateInfo* zcheckVkComputePipelineCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkComputePipelineCreateInfo moonvulkan_zcheckarrayVkComputePipelineCreateInfo
 VkComputePipelineCreateInfo* zcheckarrayVkComputePipelineCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkComputePipelineCreateInfo moonvulkan_zcheckarraybufVkComputePipelineCreateInfo
+VkComputePipelineCreateInfo* zcheckarraybufVkComputePipelineCreateInfo(lua_State *L, int arg, VkComputePipelineCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkComputePipelineCreateInfo moonvulkan_zinitVkComputePipelineCreateInfo
 int zinitVkComputePipelineCreateInfo(lua_State *L, VkComputePipelineCreateInfo* p, int *err);
 #define zfreeVkComputePipelineCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -1556,6 +1828,7 @@ int zpushVkComputePipelineCreateInfo(lua_State *L, const VkComputePipelineCreate
 
 #define znewVkPipelineInputAssemblyStateCreateInfo(L, err) (VkPipelineInputAssemblyStateCreateInfo*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO, sizeof(VkPipelineInputAssemblyStateCreateInfo), (err))
 #define znewarrayVkPipelineInputAssemblyStateCreateInfo(L, count, err) (VkPipelineInputAssemblyStateCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO, sizeof(VkPipelineInputAssemblyStateCreateInfo), (count), (err))
+#define zinitarrayVkPipelineInputAssemblyStateCreateInfo(p, count) (VkPipelineInputAssemblyStateCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO, sizeof(VkPipelineInputAssemblyStateCreateInfo), (count))
 #define znewchainVkPipelineInputAssemblyStateCreateInfo moonvulkan_znewchainVkPipelineInputAssemblyStateCreateInfo
 VkPipelineInputAssemblyStateCreateInfo* znewchainVkPipelineInputAssemblyStateCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkPipelineInputAssemblyStateCreateInfo moonvulkan_znewchainarrayVkPipelineInputAssemblyStateCreateInfo
@@ -1564,6 +1837,8 @@ VkPipelineInputAssemblyStateCreateInfo* znewchainarrayVkPipelineInputAssemblySta
 VkPipelineInputAssemblyStateCreateInfo* zcheckVkPipelineInputAssemblyStateCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineInputAssemblyStateCreateInfo moonvulkan_zcheckarrayVkPipelineInputAssemblyStateCreateInfo
 VkPipelineInputAssemblyStateCreateInfo* zcheckarrayVkPipelineInputAssemblyStateCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineInputAssemblyStateCreateInfo moonvulkan_zcheckarraybufVkPipelineInputAssemblyStateCreateInfo
+VkPipelineInputAssemblyStateCreateInfo* zcheckarraybufVkPipelineInputAssemblyStateCreateInfo(lua_State *L, int arg, VkPipelineInputAssemblyStateCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineInputAssemblyStateCreateInfo moonvulkan_zinitVkPipelineInputAssemblyStateCreateInfo
 int zinitVkPipelineInputAssemblyStateCreateInfo(lua_State *L, VkPipelineInputAssemblyStateCreateInfo* p, int *err);
 #define zfreeVkPipelineInputAssemblyStateCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -1573,6 +1848,7 @@ int zpushVkPipelineInputAssemblyStateCreateInfo(lua_State *L, const VkPipelineIn
 
 #define znewVkPipelineTessellationDomainOriginStateCreateInfoKHR(L, err) (VkPipelineTessellationDomainOriginStateCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO_KHR, sizeof(VkPipelineTessellationDomainOriginStateCreateInfoKHR), (err))
 #define znewarrayVkPipelineTessellationDomainOriginStateCreateInfoKHR(L, count, err) (VkPipelineTessellationDomainOriginStateCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO_KHR, sizeof(VkPipelineTessellationDomainOriginStateCreateInfoKHR), (count), (err))
+#define zinitarrayVkPipelineTessellationDomainOriginStateCreateInfoKHR(p, count) (VkPipelineTessellationDomainOriginStateCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO_KHR, sizeof(VkPipelineTessellationDomainOriginStateCreateInfoKHR), (count))
 #define znewchainVkPipelineTessellationDomainOriginStateCreateInfoKHR moonvulkan_znewchainVkPipelineTessellationDomainOriginStateCreateInfoKHR
 VkPipelineTessellationDomainOriginStateCreateInfoKHR* znewchainVkPipelineTessellationDomainOriginStateCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkPipelineTessellationDomainOriginStateCreateInfoKHR moonvulkan_znewchainarrayVkPipelineTessellationDomainOriginStateCreateInfoKHR
@@ -1581,6 +1857,8 @@ VkPipelineTessellationDomainOriginStateCreateInfoKHR* znewchainarrayVkPipelineTe
 VkPipelineTessellationDomainOriginStateCreateInfoKHR* zcheckVkPipelineTessellationDomainOriginStateCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineTessellationDomainOriginStateCreateInfoKHR moonvulkan_zcheckarrayVkPipelineTessellationDomainOriginStateCreateInfoKHR
 VkPipelineTessellationDomainOriginStateCreateInfoKHR* zcheckarrayVkPipelineTessellationDomainOriginStateCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineTessellationDomainOriginStateCreateInfoKHR moonvulkan_zcheckarraybufVkPipelineTessellationDomainOriginStateCreateInfoKHR
+VkPipelineTessellationDomainOriginStateCreateInfoKHR* zcheckarraybufVkPipelineTessellationDomainOriginStateCreateInfoKHR(lua_State *L, int arg, VkPipelineTessellationDomainOriginStateCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineTessellationDomainOriginStateCreateInfoKHR moonvulkan_zinitVkPipelineTessellationDomainOriginStateCreateInfoKHR
 int zinitVkPipelineTessellationDomainOriginStateCreateInfoKHR(lua_State *L, VkPipelineTessellationDomainOriginStateCreateInfoKHR* p, int *err);
 #define zfreeVkPipelineTessellationDomainOriginStateCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1590,6 +1868,7 @@ int zpushVkPipelineTessellationDomainOriginStateCreateInfoKHR(lua_State *L, cons
 
 #define znewVkPipelineTessellationStateCreateInfo(L, err) (VkPipelineTessellationStateCreateInfo*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO, sizeof(VkPipelineTessellationStateCreateInfo), (err))
 #define znewarrayVkPipelineTessellationStateCreateInfo(L, count, err) (VkPipelineTessellationStateCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO, sizeof(VkPipelineTessellationStateCreateInfo), (count), (err))
+#define zinitarrayVkPipelineTessellationStateCreateInfo(p, count) (VkPipelineTessellationStateCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO, sizeof(VkPipelineTessellationStateCreateInfo), (count))
 #define znewchainVkPipelineTessellationStateCreateInfo moonvulkan_znewchainVkPipelineTessellationStateCreateInfo
 VkPipelineTessellationStateCreateInfo* znewchainVkPipelineTessellationStateCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkPipelineTessellationStateCreateInfo moonvulkan_znewchainarrayVkPipelineTessellationStateCreateInfo
@@ -1598,6 +1877,8 @@ VkPipelineTessellationStateCreateInfo* znewchainarrayVkPipelineTessellationState
 VkPipelineTessellationStateCreateInfo* zcheckVkPipelineTessellationStateCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineTessellationStateCreateInfo moonvulkan_zcheckarrayVkPipelineTessellationStateCreateInfo
 VkPipelineTessellationStateCreateInfo* zcheckarrayVkPipelineTessellationStateCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineTessellationStateCreateInfo moonvulkan_zcheckarraybufVkPipelineTessellationStateCreateInfo
+VkPipelineTessellationStateCreateInfo* zcheckarraybufVkPipelineTessellationStateCreateInfo(lua_State *L, int arg, VkPipelineTessellationStateCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineTessellationStateCreateInfo moonvulkan_zinitVkPipelineTessellationStateCreateInfo
 int zinitVkPipelineTessellationStateCreateInfo(lua_State *L, VkPipelineTessellationStateCreateInfo* p, int *err);
 #define zfreeVkPipelineTessellationStateCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -1607,6 +1888,7 @@ int zpushVkPipelineTessellationStateCreateInfo(lua_State *L, const VkPipelineTes
 
 #define znewVkPipelineViewportStateCreateInfo(L, err) (VkPipelineViewportStateCreateInfo*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO, sizeof(VkPipelineViewportStateCreateInfo), (err))
 #define znewarrayVkPipelineViewportStateCreateInfo(L, count, err) (VkPipelineViewportStateCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO, sizeof(VkPipelineViewportStateCreateInfo), (count), (err))
+#define zinitarrayVkPipelineViewportStateCreateInfo(p, count) (VkPipelineViewportStateCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO, sizeof(VkPipelineViewportStateCreateInfo), (count))
 #define znewchainVkPipelineViewportStateCreateInfo moonvulkan_znewchainVkPipelineViewportStateCreateInfo
 VkPipelineViewportStateCreateInfo* znewchainVkPipelineViewportStateCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkPipelineViewportStateCreateInfo moonvulkan_znewchainarrayVkPipelineViewportStateCreateInfo
@@ -1615,6 +1897,8 @@ VkPipelineViewportStateCreateInfo* znewchainarrayVkPipelineViewportStateCreateIn
 VkPipelineViewportStateCreateInfo* zcheckVkPipelineViewportStateCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineViewportStateCreateInfo moonvulkan_zcheckarrayVkPipelineViewportStateCreateInfo
 VkPipelineViewportStateCreateInfo* zcheckarrayVkPipelineViewportStateCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineViewportStateCreateInfo moonvulkan_zcheckarraybufVkPipelineViewportStateCreateInfo
+VkPipelineViewportStateCreateInfo* zcheckarraybufVkPipelineViewportStateCreateInfo(lua_State *L, int arg, VkPipelineViewportStateCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineViewportStateCreateInfo moonvulkan_zinitVkPipelineViewportStateCreateInfo
 int zinitVkPipelineViewportStateCreateInfo(lua_State *L, VkPipelineViewportStateCreateInfo* p, int *err);
 #define zfreeVkPipelineViewportStateCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -1624,6 +1908,7 @@ int zpushVkPipelineViewportStateCreateInfo(lua_State *L, const VkPipelineViewpor
 
 #define znewVkPipelineRasterizationStateCreateInfo(L, err) (VkPipelineRasterizationStateCreateInfo*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO, sizeof(VkPipelineRasterizationStateCreateInfo), (err))
 #define znewarrayVkPipelineRasterizationStateCreateInfo(L, count, err) (VkPipelineRasterizationStateCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO, sizeof(VkPipelineRasterizationStateCreateInfo), (count), (err))
+#define zinitarrayVkPipelineRasterizationStateCreateInfo(p, count) (VkPipelineRasterizationStateCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO, sizeof(VkPipelineRasterizationStateCreateInfo), (count))
 #define znewchainVkPipelineRasterizationStateCreateInfo moonvulkan_znewchainVkPipelineRasterizationStateCreateInfo
 VkPipelineRasterizationStateCreateInfo* znewchainVkPipelineRasterizationStateCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkPipelineRasterizationStateCreateInfo moonvulkan_znewchainarrayVkPipelineRasterizationStateCreateInfo
@@ -1632,6 +1917,8 @@ VkPipelineRasterizationStateCreateInfo* znewchainarrayVkPipelineRasterizationSta
 VkPipelineRasterizationStateCreateInfo* zcheckVkPipelineRasterizationStateCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineRasterizationStateCreateInfo moonvulkan_zcheckarrayVkPipelineRasterizationStateCreateInfo
 VkPipelineRasterizationStateCreateInfo* zcheckarrayVkPipelineRasterizationStateCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineRasterizationStateCreateInfo moonvulkan_zcheckarraybufVkPipelineRasterizationStateCreateInfo
+VkPipelineRasterizationStateCreateInfo* zcheckarraybufVkPipelineRasterizationStateCreateInfo(lua_State *L, int arg, VkPipelineRasterizationStateCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineRasterizationStateCreateInfo moonvulkan_zinitVkPipelineRasterizationStateCreateInfo
 int zinitVkPipelineRasterizationStateCreateInfo(lua_State *L, VkPipelineRasterizationStateCreateInfo* p, int *err);
 #define zfreeVkPipelineRasterizationStateCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -1641,6 +1928,7 @@ int zpushVkPipelineRasterizationStateCreateInfo(lua_State *L, const VkPipelineRa
 
 #define znewVkPipelineSampleLocationsStateCreateInfoEXT(L, err) (VkPipelineSampleLocationsStateCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT, sizeof(VkPipelineSampleLocationsStateCreateInfoEXT), (err))
 #define znewarrayVkPipelineSampleLocationsStateCreateInfoEXT(L, count, err) (VkPipelineSampleLocationsStateCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT, sizeof(VkPipelineSampleLocationsStateCreateInfoEXT), (count), (err))
+#define zinitarrayVkPipelineSampleLocationsStateCreateInfoEXT(p, count) (VkPipelineSampleLocationsStateCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT, sizeof(VkPipelineSampleLocationsStateCreateInfoEXT), (count))
 #define znewchainVkPipelineSampleLocationsStateCreateInfoEXT moonvulkan_znewchainVkPipelineSampleLocationsStateCreateInfoEXT
 VkPipelineSampleLocationsStateCreateInfoEXT* znewchainVkPipelineSampleLocationsStateCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPipelineSampleLocationsStateCreateInfoEXT moonvulkan_znewchainarrayVkPipelineSampleLocationsStateCreateInfoEXT
@@ -1649,6 +1937,8 @@ VkPipelineSampleLocationsStateCreateInfoEXT* znewchainarrayVkPipelineSampleLocat
 VkPipelineSampleLocationsStateCreateInfoEXT* zcheckVkPipelineSampleLocationsStateCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineSampleLocationsStateCreateInfoEXT moonvulkan_zcheckarrayVkPipelineSampleLocationsStateCreateInfoEXT
 VkPipelineSampleLocationsStateCreateInfoEXT* zcheckarrayVkPipelineSampleLocationsStateCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineSampleLocationsStateCreateInfoEXT moonvulkan_zcheckarraybufVkPipelineSampleLocationsStateCreateInfoEXT
+VkPipelineSampleLocationsStateCreateInfoEXT* zcheckarraybufVkPipelineSampleLocationsStateCreateInfoEXT(lua_State *L, int arg, VkPipelineSampleLocationsStateCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineSampleLocationsStateCreateInfoEXT moonvulkan_zinitVkPipelineSampleLocationsStateCreateInfoEXT
 int zinitVkPipelineSampleLocationsStateCreateInfoEXT(lua_State *L, VkPipelineSampleLocationsStateCreateInfoEXT* p, int *err);
 #define zfreeVkPipelineSampleLocationsStateCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -1658,6 +1948,7 @@ int zpushVkPipelineSampleLocationsStateCreateInfoEXT(lua_State *L, const VkPipel
 
 #define znewVkSampleLocationsInfoEXT(L, err) (VkSampleLocationsInfoEXT*)znew((L), VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT, sizeof(VkSampleLocationsInfoEXT), (err))
 #define znewarrayVkSampleLocationsInfoEXT(L, count, err) (VkSampleLocationsInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT, sizeof(VkSampleLocationsInfoEXT), (count), (err))
+#define zinitarrayVkSampleLocationsInfoEXT(p, count) (VkSampleLocationsInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT, sizeof(VkSampleLocationsInfoEXT), (count))
 #define znewchainVkSampleLocationsInfoEXT moonvulkan_znewchainVkSampleLocationsInfoEXT
 VkSampleLocationsInfoEXT* znewchainVkSampleLocationsInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkSampleLocationsInfoEXT moonvulkan_znewchainarrayVkSampleLocationsInfoEXT
@@ -1666,6 +1957,8 @@ VkSampleLocationsInfoEXT* znewchainarrayVkSampleLocationsInfoEXT(lua_State *L, u
 VkSampleLocationsInfoEXT* zcheckVkSampleLocationsInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSampleLocationsInfoEXT moonvulkan_zcheckarrayVkSampleLocationsInfoEXT
 VkSampleLocationsInfoEXT* zcheckarrayVkSampleLocationsInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSampleLocationsInfoEXT moonvulkan_zcheckarraybufVkSampleLocationsInfoEXT
+VkSampleLocationsInfoEXT* zcheckarraybufVkSampleLocationsInfoEXT(lua_State *L, int arg, VkSampleLocationsInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSampleLocationsInfoEXT moonvulkan_zinitVkSampleLocationsInfoEXT
 int zinitVkSampleLocationsInfoEXT(lua_State *L, VkSampleLocationsInfoEXT* p, int *err);
 #define zfreeVkSampleLocationsInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -1675,6 +1968,7 @@ int zpushVkSampleLocationsInfoEXT(lua_State *L, const VkSampleLocationsInfoEXT *
 
 #define znewVkPipelineMultisampleStateCreateInfo(L, err) (VkPipelineMultisampleStateCreateInfo*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO, sizeof(VkPipelineMultisampleStateCreateInfo), (err))
 #define znewarrayVkPipelineMultisampleStateCreateInfo(L, count, err) (VkPipelineMultisampleStateCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO, sizeof(VkPipelineMultisampleStateCreateInfo), (count), (err))
+#define zinitarrayVkPipelineMultisampleStateCreateInfo(p, count) (VkPipelineMultisampleStateCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO, sizeof(VkPipelineMultisampleStateCreateInfo), (count))
 #define znewchainVkPipelineMultisampleStateCreateInfo moonvulkan_znewchainVkPipelineMultisampleStateCreateInfo
 VkPipelineMultisampleStateCreateInfo* znewchainVkPipelineMultisampleStateCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkPipelineMultisampleStateCreateInfo moonvulkan_znewchainarrayVkPipelineMultisampleStateCreateInfo
@@ -1683,6 +1977,8 @@ VkPipelineMultisampleStateCreateInfo* znewchainarrayVkPipelineMultisampleStateCr
 VkPipelineMultisampleStateCreateInfo* zcheckVkPipelineMultisampleStateCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineMultisampleStateCreateInfo moonvulkan_zcheckarrayVkPipelineMultisampleStateCreateInfo
 VkPipelineMultisampleStateCreateInfo* zcheckarrayVkPipelineMultisampleStateCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineMultisampleStateCreateInfo moonvulkan_zcheckarraybufVkPipelineMultisampleStateCreateInfo
+VkPipelineMultisampleStateCreateInfo* zcheckarraybufVkPipelineMultisampleStateCreateInfo(lua_State *L, int arg, VkPipelineMultisampleStateCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineMultisampleStateCreateInfo moonvulkan_zinitVkPipelineMultisampleStateCreateInfo
 int zinitVkPipelineMultisampleStateCreateInfo(lua_State *L, VkPipelineMultisampleStateCreateInfo* p, int *err);
 #define zfreeVkPipelineMultisampleStateCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -1692,6 +1988,7 @@ int zpushVkPipelineMultisampleStateCreateInfo(lua_State *L, const VkPipelineMult
 
 #define znewVkPipelineVertexInputStateCreateInfo(L, err) (VkPipelineVertexInputStateCreateInfo*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO, sizeof(VkPipelineVertexInputStateCreateInfo), (err))
 #define znewarrayVkPipelineVertexInputStateCreateInfo(L, count, err) (VkPipelineVertexInputStateCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO, sizeof(VkPipelineVertexInputStateCreateInfo), (count), (err))
+#define zinitarrayVkPipelineVertexInputStateCreateInfo(p, count) (VkPipelineVertexInputStateCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO, sizeof(VkPipelineVertexInputStateCreateInfo), (count))
 #define znewchainVkPipelineVertexInputStateCreateInfo moonvulkan_znewchainVkPipelineVertexInputStateCreateInfo
 VkPipelineVertexInputStateCreateInfo* znewchainVkPipelineVertexInputStateCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkPipelineVertexInputStateCreateInfo moonvulkan_znewchainarrayVkPipelineVertexInputStateCreateInfo
@@ -1700,6 +1997,8 @@ VkPipelineVertexInputStateCreateInfo* znewchainarrayVkPipelineVertexInputStateCr
 VkPipelineVertexInputStateCreateInfo* zcheckVkPipelineVertexInputStateCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineVertexInputStateCreateInfo moonvulkan_zcheckarrayVkPipelineVertexInputStateCreateInfo
 VkPipelineVertexInputStateCreateInfo* zcheckarrayVkPipelineVertexInputStateCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineVertexInputStateCreateInfo moonvulkan_zcheckarraybufVkPipelineVertexInputStateCreateInfo
+VkPipelineVertexInputStateCreateInfo* zcheckarraybufVkPipelineVertexInputStateCreateInfo(lua_State *L, int arg, VkPipelineVertexInputStateCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineVertexInputStateCreateInfo moonvulkan_zinitVkPipelineVertexInputStateCreateInfo
 int zinitVkPipelineVertexInputStateCreateInfo(lua_State *L, VkPipelineVertexInputStateCreateInfo* p, int *err);
 #define zfreeVkPipelineVertexInputStateCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -1709,6 +2008,7 @@ int zpushVkPipelineVertexInputStateCreateInfo(lua_State *L, const VkPipelineVert
 
 #define znewVkPipelineDepthStencilStateCreateInfo(L, err) (VkPipelineDepthStencilStateCreateInfo*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO, sizeof(VkPipelineDepthStencilStateCreateInfo), (err))
 #define znewarrayVkPipelineDepthStencilStateCreateInfo(L, count, err) (VkPipelineDepthStencilStateCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO, sizeof(VkPipelineDepthStencilStateCreateInfo), (count), (err))
+#define zinitarrayVkPipelineDepthStencilStateCreateInfo(p, count) (VkPipelineDepthStencilStateCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO, sizeof(VkPipelineDepthStencilStateCreateInfo), (count))
 #define znewchainVkPipelineDepthStencilStateCreateInfo moonvulkan_znewchainVkPipelineDepthStencilStateCreateInfo
 VkPipelineDepthStencilStateCreateInfo* znewchainVkPipelineDepthStencilStateCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkPipelineDepthStencilStateCreateInfo moonvulkan_znewchainarrayVkPipelineDepthStencilStateCreateInfo
@@ -1717,6 +2017,8 @@ VkPipelineDepthStencilStateCreateInfo* znewchainarrayVkPipelineDepthStencilState
 VkPipelineDepthStencilStateCreateInfo* zcheckVkPipelineDepthStencilStateCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineDepthStencilStateCreateInfo moonvulkan_zcheckarrayVkPipelineDepthStencilStateCreateInfo
 VkPipelineDepthStencilStateCreateInfo* zcheckarrayVkPipelineDepthStencilStateCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineDepthStencilStateCreateInfo moonvulkan_zcheckarraybufVkPipelineDepthStencilStateCreateInfo
+VkPipelineDepthStencilStateCreateInfo* zcheckarraybufVkPipelineDepthStencilStateCreateInfo(lua_State *L, int arg, VkPipelineDepthStencilStateCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineDepthStencilStateCreateInfo moonvulkan_zinitVkPipelineDepthStencilStateCreateInfo
 int zinitVkPipelineDepthStencilStateCreateInfo(lua_State *L, VkPipelineDepthStencilStateCreateInfo* p, int *err);
 #define zfreeVkPipelineDepthStencilStateCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -1726,6 +2028,7 @@ int zpushVkPipelineDepthStencilStateCreateInfo(lua_State *L, const VkPipelineDep
 
 #define znewVkPipelineColorBlendAdvancedStateCreateInfoEXT(L, err) (VkPipelineColorBlendAdvancedStateCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT, sizeof(VkPipelineColorBlendAdvancedStateCreateInfoEXT), (err))
 #define znewarrayVkPipelineColorBlendAdvancedStateCreateInfoEXT(L, count, err) (VkPipelineColorBlendAdvancedStateCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT, sizeof(VkPipelineColorBlendAdvancedStateCreateInfoEXT), (count), (err))
+#define zinitarrayVkPipelineColorBlendAdvancedStateCreateInfoEXT(p, count) (VkPipelineColorBlendAdvancedStateCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT, sizeof(VkPipelineColorBlendAdvancedStateCreateInfoEXT), (count))
 #define znewchainVkPipelineColorBlendAdvancedStateCreateInfoEXT moonvulkan_znewchainVkPipelineColorBlendAdvancedStateCreateInfoEXT
 VkPipelineColorBlendAdvancedStateCreateInfoEXT* znewchainVkPipelineColorBlendAdvancedStateCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPipelineColorBlendAdvancedStateCreateInfoEXT moonvulkan_znewchainarrayVkPipelineColorBlendAdvancedStateCreateInfoEXT
@@ -1734,6 +2037,8 @@ VkPipelineColorBlendAdvancedStateCreateInfoEXT* znewchainarrayVkPipelineColorBle
 VkPipelineColorBlendAdvancedStateCreateInfoEXT* zcheckVkPipelineColorBlendAdvancedStateCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineColorBlendAdvancedStateCreateInfoEXT moonvulkan_zcheckarrayVkPipelineColorBlendAdvancedStateCreateInfoEXT
 VkPipelineColorBlendAdvancedStateCreateInfoEXT* zcheckarrayVkPipelineColorBlendAdvancedStateCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineColorBlendAdvancedStateCreateInfoEXT moonvulkan_zcheckarraybufVkPipelineColorBlendAdvancedStateCreateInfoEXT
+VkPipelineColorBlendAdvancedStateCreateInfoEXT* zcheckarraybufVkPipelineColorBlendAdvancedStateCreateInfoEXT(lua_State *L, int arg, VkPipelineColorBlendAdvancedStateCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineColorBlendAdvancedStateCreateInfoEXT moonvulkan_zinitVkPipelineColorBlendAdvancedStateCreateInfoEXT
 int zinitVkPipelineColorBlendAdvancedStateCreateInfoEXT(lua_State *L, VkPipelineColorBlendAdvancedStateCreateInfoEXT* p, int *err);
 #define zfreeVkPipelineColorBlendAdvancedStateCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -1743,6 +2048,7 @@ int zpushVkPipelineColorBlendAdvancedStateCreateInfoEXT(lua_State *L, const VkPi
 
 #define znewVkPipelineColorBlendStateCreateInfo(L, err) (VkPipelineColorBlendStateCreateInfo*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO, sizeof(VkPipelineColorBlendStateCreateInfo), (err))
 #define znewarrayVkPipelineColorBlendStateCreateInfo(L, count, err) (VkPipelineColorBlendStateCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO, sizeof(VkPipelineColorBlendStateCreateInfo), (count), (err))
+#define zinitarrayVkPipelineColorBlendStateCreateInfo(p, count) (VkPipelineColorBlendStateCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO, sizeof(VkPipelineColorBlendStateCreateInfo), (count))
 #define znewchainVkPipelineColorBlendStateCreateInfo moonvulkan_znewchainVkPipelineColorBlendStateCreateInfo
 VkPipelineColorBlendStateCreateInfo* znewchainVkPipelineColorBlendStateCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkPipelineColorBlendStateCreateInfo moonvulkan_znewchainarrayVkPipelineColorBlendStateCreateInfo
@@ -1751,6 +2057,8 @@ VkPipelineColorBlendStateCreateInfo* znewchainarrayVkPipelineColorBlendStateCrea
 VkPipelineColorBlendStateCreateInfo* zcheckVkPipelineColorBlendStateCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineColorBlendStateCreateInfo moonvulkan_zcheckarrayVkPipelineColorBlendStateCreateInfo
 VkPipelineColorBlendStateCreateInfo* zcheckarrayVkPipelineColorBlendStateCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineColorBlendStateCreateInfo moonvulkan_zcheckarraybufVkPipelineColorBlendStateCreateInfo
+VkPipelineColorBlendStateCreateInfo* zcheckarraybufVkPipelineColorBlendStateCreateInfo(lua_State *L, int arg, VkPipelineColorBlendStateCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineColorBlendStateCreateInfo moonvulkan_zinitVkPipelineColorBlendStateCreateInfo
 int zinitVkPipelineColorBlendStateCreateInfo(lua_State *L, VkPipelineColorBlendStateCreateInfo* p, int *err);
 #define zfreeVkPipelineColorBlendStateCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -1760,6 +2068,7 @@ int zpushVkPipelineColorBlendStateCreateInfo(lua_State *L, const VkPipelineColor
 
 #define znewVkPipelineDynamicStateCreateInfo(L, err) (VkPipelineDynamicStateCreateInfo*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, sizeof(VkPipelineDynamicStateCreateInfo), (err))
 #define znewarrayVkPipelineDynamicStateCreateInfo(L, count, err) (VkPipelineDynamicStateCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, sizeof(VkPipelineDynamicStateCreateInfo), (count), (err))
+#define zinitarrayVkPipelineDynamicStateCreateInfo(p, count) (VkPipelineDynamicStateCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, sizeof(VkPipelineDynamicStateCreateInfo), (count))
 #define znewchainVkPipelineDynamicStateCreateInfo moonvulkan_znewchainVkPipelineDynamicStateCreateInfo
 VkPipelineDynamicStateCreateInfo* znewchainVkPipelineDynamicStateCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkPipelineDynamicStateCreateInfo moonvulkan_znewchainarrayVkPipelineDynamicStateCreateInfo
@@ -1768,6 +2077,8 @@ VkPipelineDynamicStateCreateInfo* znewchainarrayVkPipelineDynamicStateCreateInfo
 VkPipelineDynamicStateCreateInfo* zcheckVkPipelineDynamicStateCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineDynamicStateCreateInfo moonvulkan_zcheckarrayVkPipelineDynamicStateCreateInfo
 VkPipelineDynamicStateCreateInfo* zcheckarrayVkPipelineDynamicStateCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineDynamicStateCreateInfo moonvulkan_zcheckarraybufVkPipelineDynamicStateCreateInfo
+VkPipelineDynamicStateCreateInfo* zcheckarraybufVkPipelineDynamicStateCreateInfo(lua_State *L, int arg, VkPipelineDynamicStateCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineDynamicStateCreateInfo moonvulkan_zinitVkPipelineDynamicStateCreateInfo
 int zinitVkPipelineDynamicStateCreateInfo(lua_State *L, VkPipelineDynamicStateCreateInfo* p, int *err);
 #define zfreeVkPipelineDynamicStateCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -1777,6 +2088,7 @@ int zpushVkPipelineDynamicStateCreateInfo(lua_State *L, const VkPipelineDynamicS
 
 #define znewVkPipelineDiscardRectangleStateCreateInfoEXT(L, err) (VkPipelineDiscardRectangleStateCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT, sizeof(VkPipelineDiscardRectangleStateCreateInfoEXT), (err))
 #define znewarrayVkPipelineDiscardRectangleStateCreateInfoEXT(L, count, err) (VkPipelineDiscardRectangleStateCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT, sizeof(VkPipelineDiscardRectangleStateCreateInfoEXT), (count), (err))
+#define zinitarrayVkPipelineDiscardRectangleStateCreateInfoEXT(p, count) (VkPipelineDiscardRectangleStateCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT, sizeof(VkPipelineDiscardRectangleStateCreateInfoEXT), (count))
 #define znewchainVkPipelineDiscardRectangleStateCreateInfoEXT moonvulkan_znewchainVkPipelineDiscardRectangleStateCreateInfoEXT
 VkPipelineDiscardRectangleStateCreateInfoEXT* znewchainVkPipelineDiscardRectangleStateCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPipelineDiscardRectangleStateCreateInfoEXT moonvulkan_znewchainarrayVkPipelineDiscardRectangleStateCreateInfoEXT
@@ -1785,6 +2097,8 @@ VkPipelineDiscardRectangleStateCreateInfoEXT* znewchainarrayVkPipelineDiscardRec
 VkPipelineDiscardRectangleStateCreateInfoEXT* zcheckVkPipelineDiscardRectangleStateCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineDiscardRectangleStateCreateInfoEXT moonvulkan_zcheckarrayVkPipelineDiscardRectangleStateCreateInfoEXT
 VkPipelineDiscardRectangleStateCreateInfoEXT* zcheckarrayVkPipelineDiscardRectangleStateCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineDiscardRectangleStateCreateInfoEXT moonvulkan_zcheckarraybufVkPipelineDiscardRectangleStateCreateInfoEXT
+VkPipelineDiscardRectangleStateCreateInfoEXT* zcheckarraybufVkPipelineDiscardRectangleStateCreateInfoEXT(lua_State *L, int arg, VkPipelineDiscardRectangleStateCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineDiscardRectangleStateCreateInfoEXT moonvulkan_zinitVkPipelineDiscardRectangleStateCreateInfoEXT
 int zinitVkPipelineDiscardRectangleStateCreateInfoEXT(lua_State *L, VkPipelineDiscardRectangleStateCreateInfoEXT* p, int *err);
 #define zfreeVkPipelineDiscardRectangleStateCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -1794,6 +2108,7 @@ int zpushVkPipelineDiscardRectangleStateCreateInfoEXT(lua_State *L, const VkPipe
 
 #define znewVkGraphicsPipelineCreateInfo(L, err) (VkGraphicsPipelineCreateInfo*)znew((L), VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO, sizeof(VkGraphicsPipelineCreateInfo), (err))
 #define znewarrayVkGraphicsPipelineCreateInfo(L, count, err) (VkGraphicsPipelineCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO, sizeof(VkGraphicsPipelineCreateInfo), (count), (err))
+#define zinitarrayVkGraphicsPipelineCreateInfo(p, count) (VkGraphicsPipelineCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO, sizeof(VkGraphicsPipelineCreateInfo), (count))
 #define znewchainVkGraphicsPipelineCreateInfo moonvulkan_znewchainVkGraphicsPipelineCreateInfo
 VkGraphicsPipelineCreateInfo* znewchainVkGraphicsPipelineCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkGraphicsPipelineCreateInfo moonvulkan_znewchainarrayVkGraphicsPipelineCreateInfo
@@ -1802,6 +2117,8 @@ VkGraphicsPipelineCreateInfo* znewchainarrayVkGraphicsPipelineCreateInfo(lua_Sta
 VkGraphicsPipelineCreateInfo* zcheckVkGraphicsPipelineCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkGraphicsPipelineCreateInfo moonvulkan_zcheckarrayVkGraphicsPipelineCreateInfo
 VkGraphicsPipelineCreateInfo* zcheckarrayVkGraphicsPipelineCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkGraphicsPipelineCreateInfo moonvulkan_zcheckarraybufVkGraphicsPipelineCreateInfo
+VkGraphicsPipelineCreateInfo* zcheckarraybufVkGraphicsPipelineCreateInfo(lua_State *L, int arg, VkGraphicsPipelineCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkGraphicsPipelineCreateInfo moonvulkan_zinitVkGraphicsPipelineCreateInfo
 int zinitVkGraphicsPipelineCreateInfo(lua_State *L, VkGraphicsPipelineCreateInfo* p, int *err);
 #define zfreeVkGraphicsPipelineCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -1811,6 +2128,7 @@ int zpushVkGraphicsPipelineCreateInfo(lua_State *L, const VkGraphicsPipelineCrea
 
 #define znewVkMemoryFdPropertiesKHR(L, err) (VkMemoryFdPropertiesKHR*)znew((L), VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR, sizeof(VkMemoryFdPropertiesKHR), (err))
 #define znewarrayVkMemoryFdPropertiesKHR(L, count, err) (VkMemoryFdPropertiesKHR*)znewarray((L), VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR, sizeof(VkMemoryFdPropertiesKHR), (count), (err))
+#define zinitarrayVkMemoryFdPropertiesKHR(p, count) (VkMemoryFdPropertiesKHR*)zinitarray((p), VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR, sizeof(VkMemoryFdPropertiesKHR), (count))
 #define znewchainVkMemoryFdPropertiesKHR moonvulkan_znewchainVkMemoryFdPropertiesKHR
 VkMemoryFdPropertiesKHR* znewchainVkMemoryFdPropertiesKHR(lua_State *L, int *err);
 #define znewchainarrayVkMemoryFdPropertiesKHR moonvulkan_znewchainarrayVkMemoryFdPropertiesKHR
@@ -1819,6 +2137,8 @@ VkMemoryFdPropertiesKHR* znewchainarrayVkMemoryFdPropertiesKHR(lua_State *L, uin
 VkMemoryFdPropertiesKHR* zcheckVkMemoryFdPropertiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryFdPropertiesKHR moonvulkan_zcheckarrayVkMemoryFdPropertiesKHR
 VkMemoryFdPropertiesKHR* zcheckarrayVkMemoryFdPropertiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryFdPropertiesKHR moonvulkan_zcheckarraybufVkMemoryFdPropertiesKHR
+VkMemoryFdPropertiesKHR* zcheckarraybufVkMemoryFdPropertiesKHR(lua_State *L, int arg, VkMemoryFdPropertiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryFdPropertiesKHR moonvulkan_zinitVkMemoryFdPropertiesKHR
 int zinitVkMemoryFdPropertiesKHR(lua_State *L, VkMemoryFdPropertiesKHR* p, int *err);
 #define zfreeVkMemoryFdPropertiesKHR(L, p, base) zfree((L), (p), (base))
@@ -1828,6 +2148,7 @@ int zpushVkMemoryFdPropertiesKHR(lua_State *L, const VkMemoryFdPropertiesKHR *p)
 
 #define znewVkMemoryHostPointerPropertiesEXT(L, err) (VkMemoryHostPointerPropertiesEXT*)znew((L), VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT, sizeof(VkMemoryHostPointerPropertiesEXT), (err))
 #define znewarrayVkMemoryHostPointerPropertiesEXT(L, count, err) (VkMemoryHostPointerPropertiesEXT*)znewarray((L), VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT, sizeof(VkMemoryHostPointerPropertiesEXT), (count), (err))
+#define zinitarrayVkMemoryHostPointerPropertiesEXT(p, count) (VkMemoryHostPointerPropertiesEXT*)zinitarray((p), VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT, sizeof(VkMemoryHostPointerPropertiesEXT), (count))
 #define znewchainVkMemoryHostPointerPropertiesEXT moonvulkan_znewchainVkMemoryHostPointerPropertiesEXT
 VkMemoryHostPointerPropertiesEXT* znewchainVkMemoryHostPointerPropertiesEXT(lua_State *L, int *err);
 #define znewchainarrayVkMemoryHostPointerPropertiesEXT moonvulkan_znewchainarrayVkMemoryHostPointerPropertiesEXT
@@ -1836,6 +2157,8 @@ VkMemoryHostPointerPropertiesEXT* znewchainarrayVkMemoryHostPointerPropertiesEXT
 VkMemoryHostPointerPropertiesEXT* zcheckVkMemoryHostPointerPropertiesEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryHostPointerPropertiesEXT moonvulkan_zcheckarrayVkMemoryHostPointerPropertiesEXT
 VkMemoryHostPointerPropertiesEXT* zcheckarrayVkMemoryHostPointerPropertiesEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryHostPointerPropertiesEXT moonvulkan_zcheckarraybufVkMemoryHostPointerPropertiesEXT
+VkMemoryHostPointerPropertiesEXT* zcheckarraybufVkMemoryHostPointerPropertiesEXT(lua_State *L, int arg, VkMemoryHostPointerPropertiesEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryHostPointerPropertiesEXT moonvulkan_zinitVkMemoryHostPointerPropertiesEXT
 int zinitVkMemoryHostPointerPropertiesEXT(lua_State *L, VkMemoryHostPointerPropertiesEXT* p, int *err);
 #define zfreeVkMemoryHostPointerPropertiesEXT(L, p, base) zfree((L), (p), (base))
@@ -1845,6 +2168,7 @@ int zpushVkMemoryHostPointerPropertiesEXT(lua_State *L, const VkMemoryHostPointe
 
 #define znewVkMemoryGetFdInfoKHR(L, err) (VkMemoryGetFdInfoKHR*)znew((L), VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR, sizeof(VkMemoryGetFdInfoKHR), (err))
 #define znewarrayVkMemoryGetFdInfoKHR(L, count, err) (VkMemoryGetFdInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR, sizeof(VkMemoryGetFdInfoKHR), (count), (err))
+#define zinitarrayVkMemoryGetFdInfoKHR(p, count) (VkMemoryGetFdInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR, sizeof(VkMemoryGetFdInfoKHR), (count))
 #define znewchainVkMemoryGetFdInfoKHR moonvulkan_znewchainVkMemoryGetFdInfoKHR
 VkMemoryGetFdInfoKHR* znewchainVkMemoryGetFdInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkMemoryGetFdInfoKHR moonvulkan_znewchainarrayVkMemoryGetFdInfoKHR
@@ -1853,6 +2177,8 @@ VkMemoryGetFdInfoKHR* znewchainarrayVkMemoryGetFdInfoKHR(lua_State *L, uint32_t
 VkMemoryGetFdInfoKHR* zcheckVkMemoryGetFdInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryGetFdInfoKHR moonvulkan_zcheckarrayVkMemoryGetFdInfoKHR
 VkMemoryGetFdInfoKHR* zcheckarrayVkMemoryGetFdInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryGetFdInfoKHR moonvulkan_zcheckarraybufVkMemoryGetFdInfoKHR
+VkMemoryGetFdInfoKHR* zcheckarraybufVkMemoryGetFdInfoKHR(lua_State *L, int arg, VkMemoryGetFdInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryGetFdInfoKHR moonvulkan_zinitVkMemoryGetFdInfoKHR
 int zinitVkMemoryGetFdInfoKHR(lua_State *L, VkMemoryGetFdInfoKHR* p, int *err);
 #define zfreeVkMemoryGetFdInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1862,6 +2188,7 @@ int zpushVkMemoryGetFdInfoKHR(lua_State *L, const VkMemoryGetFdInfoKHR *p);
 
 #define znewVkDeviceEventInfoEXT(L, err) (VkDeviceEventInfoEXT*)znew((L), VK_STRUCTURE_TYPE_DEVICE_EVENT_INFO_EXT, sizeof(VkDeviceEventInfoEXT), (err))
 #define znewarrayVkDeviceEventInfoEXT(L, count, err) (VkDeviceEventInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_EVENT_INFO_EXT, sizeof(VkDeviceEventInfoEXT), (count), (err))
+#define zinitarrayVkDeviceEventInfoEXT(p, count) (VkDeviceEventInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_EVENT_INFO_EXT, sizeof(VkDeviceEventInfoEXT), (count))
 #define znewchainVkDeviceEventInfoEXT moonvulkan_znewchainVkDeviceEventInfoEXT
 VkDeviceEventInfoEXT* znewchainVkDeviceEventInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkDeviceEventInfoEXT moonvulkan_znewchainarrayVkDeviceEventInfoEXT
@@ -1870,6 +2197,8 @@ VkDeviceEventInfoEXT* znewchainarrayVkDeviceEventInfoEXT(lua_State *L, uint32_t
 VkDeviceEventInfoEXT* zcheckVkDeviceEventInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceEventInfoEXT moonvulkan_zcheckarrayVkDeviceEventInfoEXT
 VkDeviceEventInfoEXT* zcheckarrayVkDeviceEventInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceEventInfoEXT moonvulkan_zcheckarraybufVkDeviceEventInfoEXT
+VkDeviceEventInfoEXT* zcheckarraybufVkDeviceEventInfoEXT(lua_State *L, int arg, VkDeviceEventInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceEventInfoEXT moonvulkan_zinitVkDeviceEventInfoEXT
 int zinitVkDeviceEventInfoEXT(lua_State *L, VkDeviceEventInfoEXT* p, int *err);
 #define zfreeVkDeviceEventInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -1879,6 +2208,7 @@ int zpushVkDeviceEventInfoEXT(lua_State *L, const VkDeviceEventInfoEXT *p);
 
 #define znewVkDisplayEventInfoEXT(L, err) (VkDisplayEventInfoEXT*)znew((L), VK_STRUCTURE_TYPE_DISPLAY_EVENT_INFO_EXT, sizeof(VkDisplayEventInfoEXT), (err))
 #define znewarrayVkDisplayEventInfoEXT(L, count, err) (VkDisplayEventInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_DISPLAY_EVENT_INFO_EXT, sizeof(VkDisplayEventInfoEXT), (count), (err))
+#define zinitarrayVkDisplayEventInfoEXT(p, count) (VkDisplayEventInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DISPLAY_EVENT_INFO_EXT, sizeof(VkDisplayEventInfoEXT), (count))
 #define znewchainVkDisplayEventInfoEXT moonvulkan_znewchainVkDisplayEventInfoEXT
 VkDisplayEventInfoEXT* znewchainVkDisplayEventInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkDisplayEventInfoEXT moonvulkan_znewchainarrayVkDisplayEventInfoEXT
@@ -1887,6 +2217,8 @@ VkDisplayEventInfoEXT* znewchainarrayVkDisplayEventInfoEXT(lua_State *L, uint32_
 VkDisplayEventInfoEXT* zcheckVkDisplayEventInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayEventInfoEXT moonvulkan_zcheckarrayVkDisplayEventInfoEXT
 VkDisplayEventInfoEXT* zcheckarrayVkDisplayEventInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayEventInfoEXT moonvulkan_zcheckarraybufVkDisplayEventInfoEXT
+VkDisplayEventInfoEXT* zcheckarraybufVkDisplayEventInfoEXT(lua_State *L, int arg, VkDisplayEventInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayEventInfoEXT moonvulkan_zinitVkDisplayEventInfoEXT
 int zinitVkDisplayEventInfoEXT(lua_State *L, VkDisplayEventInfoEXT* p, int *err);
 #define zfreeVkDisplayEventInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -1896,6 +2228,7 @@ int zpushVkDisplayEventInfoEXT(lua_State *L, const VkDisplayEventInfoEXT *p);
 
 #define znewVkImportFenceFdInfoKHR(L, err) (VkImportFenceFdInfoKHR*)znew((L), VK_STRUCTURE_TYPE_IMPORT_FENCE_FD_INFO_KHR, sizeof(VkImportFenceFdInfoKHR), (err))
 #define znewarrayVkImportFenceFdInfoKHR(L, count, err) (VkImportFenceFdInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_IMPORT_FENCE_FD_INFO_KHR, sizeof(VkImportFenceFdInfoKHR), (count), (err))
+#define zinitarrayVkImportFenceFdInfoKHR(p, count) (VkImportFenceFdInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMPORT_FENCE_FD_INFO_KHR, sizeof(VkImportFenceFdInfoKHR), (count))
 #define znewchainVkImportFenceFdInfoKHR moonvulkan_znewchainVkImportFenceFdInfoKHR
 VkImportFenceFdInfoKHR* znewchainVkImportFenceFdInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkImportFenceFdInfoKHR moonvulkan_znewchainarrayVkImportFenceFdInfoKHR
@@ -1904,6 +2237,8 @@ VkImportFenceFdInfoKHR* znewchainarrayVkImportFenceFdInfoKHR(lua_State *L, uint3
 VkImportFenceFdInfoKHR* zcheckVkImportFenceFdInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImportFenceFdInfoKHR moonvulkan_zcheckarrayVkImportFenceFdInfoKHR
 VkImportFenceFdInfoKHR* zcheckarrayVkImportFenceFdInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImportFenceFdInfoKHR moonvulkan_zcheckarraybufVkImportFenceFdInfoKHR
+VkImportFenceFdInfoKHR* zcheckarraybufVkImportFenceFdInfoKHR(lua_State *L, int arg, VkImportFenceFdInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImportFenceFdInfoKHR moonvulkan_zinitVkImportFenceFdInfoKHR
 int zinitVkImportFenceFdInfoKHR(lua_State *L, VkImportFenceFdInfoKHR* p, int *err);
 #define zfreeVkImportFenceFdInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1913,6 +2248,7 @@ int zpushVkImportFenceFdInfoKHR(lua_State *L, const VkImportFenceFdInfoKHR *p);
 
 #define znewVkFenceGetFdInfoKHR(L, err) (VkFenceGetFdInfoKHR*)znew((L), VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR, sizeof(VkFenceGetFdInfoKHR), (err))
 #define znewarrayVkFenceGetFdInfoKHR(L, count, err) (VkFenceGetFdInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR, sizeof(VkFenceGetFdInfoKHR), (count), (err))
+#define zinitarrayVkFenceGetFdInfoKHR(p, count) (VkFenceGetFdInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR, sizeof(VkFenceGetFdInfoKHR), (count))
 #define znewchainVkFenceGetFdInfoKHR moonvulkan_znewchainVkFenceGetFdInfoKHR
 VkFenceGetFdInfoKHR* znewchainVkFenceGetFdInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkFenceGetFdInfoKHR moonvulkan_znewchainarrayVkFenceGetFdInfoKHR
@@ -1921,6 +2257,8 @@ VkFenceGetFdInfoKHR* znewchainarrayVkFenceGetFdInfoKHR(lua_State *L, uint32_t co
 VkFenceGetFdInfoKHR* zcheckVkFenceGetFdInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkFenceGetFdInfoKHR moonvulkan_zcheckarrayVkFenceGetFdInfoKHR
 VkFenceGetFdInfoKHR* zcheckarrayVkFenceGetFdInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkFenceGetFdInfoKHR moonvulkan_zcheckarraybufVkFenceGetFdInfoKHR
+VkFenceGetFdInfoKHR* zcheckarraybufVkFenceGetFdInfoKHR(lua_State *L, int arg, VkFenceGetFdInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkFenceGetFdInfoKHR moonvulkan_zinitVkFenceGetFdInfoKHR
 int zinitVkFenceGetFdInfoKHR(lua_State *L, VkFenceGetFdInfoKHR* p, int *err);
 #define zfreeVkFenceGetFdInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1930,6 +2268,7 @@ int zpushVkFenceGetFdInfoKHR(lua_State *L, const VkFenceGetFdInfoKHR *p);
 
 #define znewVkImportSemaphoreFdInfoKHR(L, err) (VkImportSemaphoreFdInfoKHR*)znew((L), VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR, sizeof(VkImportSemaphoreFdInfoKHR), (err))
 #define znewarrayVkImportSemaphoreFdInfoKHR(L, count, err) (VkImportSemaphoreFdInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR, sizeof(VkImportSemaphoreFdInfoKHR), (count), (err))
+#define zinitarrayVkImportSemaphoreFdInfoKHR(p, count) (VkImportSemaphoreFdInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR, sizeof(VkImportSemaphoreFdInfoKHR), (count))
 #define znewchainVkImportSemaphoreFdInfoKHR moonvulkan_znewchainVkImportSemaphoreFdInfoKHR
 VkImportSemaphoreFdInfoKHR* znewchainVkImportSemaphoreFdInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkImportSemaphoreFdInfoKHR moonvulkan_znewchainarrayVkImportSemaphoreFdInfoKHR
@@ -1938,6 +2277,8 @@ VkImportSemaphoreFdInfoKHR* znewchainarrayVkImportSemaphoreFdInfoKHR(lua_State *
 VkImportSemaphoreFdInfoKHR* zcheckVkImportSemaphoreFdInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImportSemaphoreFdInfoKHR moonvulkan_zcheckarrayVkImportSemaphoreFdInfoKHR
 VkImportSemaphoreFdInfoKHR* zcheckarrayVkImportSemaphoreFdInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImportSemaphoreFdInfoKHR moonvulkan_zcheckarraybufVkImportSemaphoreFdInfoKHR
+VkImportSemaphoreFdInfoKHR* zcheckarraybufVkImportSemaphoreFdInfoKHR(lua_State *L, int arg, VkImportSemaphoreFdInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImportSemaphoreFdInfoKHR moonvulkan_zinitVkImportSemaphoreFdInfoKHR
 int zinitVkImportSemaphoreFdInfoKHR(lua_State *L, VkImportSemaphoreFdInfoKHR* p, int *err);
 #define zfreeVkImportSemaphoreFdInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1947,6 +2288,7 @@ int zpushVkImportSemaphoreFdInfoKHR(lua_State *L, const VkImportSemaphoreFdInfoK
 
 #define znewVkSemaphoreGetFdInfoKHR(L, err) (VkSemaphoreGetFdInfoKHR*)znew((L), VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR, sizeof(VkSemaphoreGetFdInfoKHR), (err))
 #define znewarrayVkSemaphoreGetFdInfoKHR(L, count, err) (VkSemaphoreGetFdInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR, sizeof(VkSemaphoreGetFdInfoKHR), (count), (err))
+#define zinitarrayVkSemaphoreGetFdInfoKHR(p, count) (VkSemaphoreGetFdInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR, sizeof(VkSemaphoreGetFdInfoKHR), (count))
 #define znewchainVkSemaphoreGetFdInfoKHR moonvulkan_znewchainVkSemaphoreGetFdInfoKHR
 VkSemaphoreGetFdInfoKHR* znewchainVkSemaphoreGetFdInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkSemaphoreGetFdInfoKHR moonvulkan_znewchainarrayVkSemaphoreGetFdInfoKHR
@@ -1955,6 +2297,8 @@ VkSemaphoreGetFdInfoKHR* znewchainarrayVkSemaphoreGetFdInfoKHR(lua_State *L, uin
 VkSemaphoreGetFdInfoKHR* zcheckVkSemaphoreGetFdInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSemaphoreGetFdInfoKHR moonvulkan_zcheckarrayVkSemaphoreGetFdInfoKHR
 VkSemaphoreGetFdInfoKHR* zcheckarrayVkSemaphoreGetFdInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSemaphoreGetFdInfoKHR moonvulkan_zcheckarraybufVkSemaphoreGetFdInfoKHR
+VkSemaphoreGetFdInfoKHR* zcheckarraybufVkSemaphoreGetFdInfoKHR(lua_State *L, int arg, VkSemaphoreGetFdInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSemaphoreGetFdInfoKHR moonvulkan_zinitVkSemaphoreGetFdInfoKHR
 int zinitVkSemaphoreGetFdInfoKHR(lua_State *L, VkSemaphoreGetFdInfoKHR* p, int *err);
 #define zfreeVkSemaphoreGetFdInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1964,6 +2308,7 @@ int zpushVkSemaphoreGetFdInfoKHR(lua_State *L, const VkSemaphoreGetFdInfoKHR *p)
 
 #define znewVkExternalBufferPropertiesKHR(L, err) (VkExternalBufferPropertiesKHR*)znew((L), VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES_KHR, sizeof(VkExternalBufferPropertiesKHR), (err))
 #define znewarrayVkExternalBufferPropertiesKHR(L, count, err) (VkExternalBufferPropertiesKHR*)znewarray((L), VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES_KHR, sizeof(VkExternalBufferPropertiesKHR), (count), (err))
+#define zinitarrayVkExternalBufferPropertiesKHR(p, count) (VkExternalBufferPropertiesKHR*)zinitarray((p), VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES_KHR, sizeof(VkExternalBufferPropertiesKHR), (count))
 #define znewchainVkExternalBufferPropertiesKHR moonvulkan_znewchainVkExternalBufferPropertiesKHR
 VkExternalBufferPropertiesKHR* znewchainVkExternalBufferPropertiesKHR(lua_State *L, int *err);
 #define znewchainarrayVkExternalBufferPropertiesKHR moonvulkan_znewchainarrayVkExternalBufferPropertiesKHR
@@ -1972,6 +2317,8 @@ VkExternalBufferPropertiesKHR* znewchainarrayVkExternalBufferPropertiesKHR(lua_S
 VkExternalBufferPropertiesKHR* zcheckVkExternalBufferPropertiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExternalBufferPropertiesKHR moonvulkan_zcheckarrayVkExternalBufferPropertiesKHR
 VkExternalBufferPropertiesKHR* zcheckarrayVkExternalBufferPropertiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExternalBufferPropertiesKHR moonvulkan_zcheckarraybufVkExternalBufferPropertiesKHR
+VkExternalBufferPropertiesKHR* zcheckarraybufVkExternalBufferPropertiesKHR(lua_State *L, int arg, VkExternalBufferPropertiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExternalBufferPropertiesKHR moonvulkan_zinitVkExternalBufferPropertiesKHR
 int zinitVkExternalBufferPropertiesKHR(lua_State *L, VkExternalBufferPropertiesKHR* p, int *err);
 #define zfreeVkExternalBufferPropertiesKHR(L, p, base) zfree((L), (p), (base))
@@ -1981,6 +2328,7 @@ int zpushVkExternalBufferPropertiesKHR(lua_State *L, const VkExternalBufferPrope
 
 #define znewVkPhysicalDeviceExternalBufferInfoKHR(L, err) (VkPhysicalDeviceExternalBufferInfoKHR*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO_KHR, sizeof(VkPhysicalDeviceExternalBufferInfoKHR), (err))
 #define znewarrayVkPhysicalDeviceExternalBufferInfoKHR(L, count, err) (VkPhysicalDeviceExternalBufferInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO_KHR, sizeof(VkPhysicalDeviceExternalBufferInfoKHR), (count), (err))
+#define zinitarrayVkPhysicalDeviceExternalBufferInfoKHR(p, count) (VkPhysicalDeviceExternalBufferInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO_KHR, sizeof(VkPhysicalDeviceExternalBufferInfoKHR), (count))
 #define znewchainVkPhysicalDeviceExternalBufferInfoKHR moonvulkan_znewchainVkPhysicalDeviceExternalBufferInfoKHR
 VkPhysicalDeviceExternalBufferInfoKHR* znewchainVkPhysicalDeviceExternalBufferInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceExternalBufferInfoKHR moonvulkan_znewchainarrayVkPhysicalDeviceExternalBufferInfoKHR
@@ -1989,6 +2337,8 @@ VkPhysicalDeviceExternalBufferInfoKHR* znewchainarrayVkPhysicalDeviceExternalBuf
 VkPhysicalDeviceExternalBufferInfoKHR* zcheckVkPhysicalDeviceExternalBufferInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceExternalBufferInfoKHR moonvulkan_zcheckarrayVkPhysicalDeviceExternalBufferInfoKHR
 VkPhysicalDeviceExternalBufferInfoKHR* zcheckarrayVkPhysicalDeviceExternalBufferInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceExternalBufferInfoKHR moonvulkan_zcheckarraybufVkPhysicalDeviceExternalBufferInfoKHR
+VkPhysicalDeviceExternalBufferInfoKHR* zcheckarraybufVkPhysicalDeviceExternalBufferInfoKHR(lua_State *L, int arg, VkPhysicalDeviceExternalBufferInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceExternalBufferInfoKHR moonvulkan_zinitVkPhysicalDeviceExternalBufferInfoKHR
 int zinitVkPhysicalDeviceExternalBufferInfoKHR(lua_State *L, VkPhysicalDeviceExternalBufferInfoKHR* p, int *err);
 #define zfreeVkPhysicalDeviceExternalBufferInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -1998,6 +2348,7 @@ int zpushVkPhysicalDeviceExternalBufferInfoKHR(lua_State *L, const VkPhysicalDev
 
 #define znewVkExternalFencePropertiesKHR(L, err) (VkExternalFencePropertiesKHR*)znew((L), VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES_KHR, sizeof(VkExternalFencePropertiesKHR), (err))
 #define znewarrayVkExternalFencePropertiesKHR(L, count, err) (VkExternalFencePropertiesKHR*)znewarray((L), VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES_KHR, sizeof(VkExternalFencePropertiesKHR), (count), (err))
+#define zinitarrayVkExternalFencePropertiesKHR(p, count) (VkExternalFencePropertiesKHR*)zinitarray((p), VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES_KHR, sizeof(VkExternalFencePropertiesKHR), (count))
 #define znewchainVkExternalFencePropertiesKHR moonvulkan_znewchainVkExternalFencePropertiesKHR
 VkExternalFencePropertiesKHR* znewchainVkExternalFencePropertiesKHR(lua_State *L, int *err);
 #define znewchainarrayVkExternalFencePropertiesKHR moonvulkan_znewchainarrayVkExternalFencePropertiesKHR
@@ -2006,6 +2357,8 @@ VkExternalFencePropertiesKHR* znewchainarrayVkExternalFencePropertiesKHR(lua_Sta
 VkExternalFencePropertiesKHR* zcheckVkExternalFencePropertiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExternalFencePropertiesKHR moonvulkan_zcheckarrayVkExternalFencePropertiesKHR
 VkExternalFencePropertiesKHR* zcheckarrayVkExternalFencePropertiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExternalFencePropertiesKHR moonvulkan_zcheckarraybufVkExternalFencePropertiesKHR
+VkExternalFencePropertiesKHR* zcheckarraybufVkExternalFencePropertiesKHR(lua_State *L, int arg, VkExternalFencePropertiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExternalFencePropertiesKHR moonvulkan_zinitVkExternalFencePropertiesKHR
 int zinitVkExternalFencePropertiesKHR(lua_State *L, VkExternalFencePropertiesKHR* p, int *err);
 #define zfreeVkExternalFencePropertiesKHR(L, p, base) zfree((L), (p), (base))
@@ -2015,6 +2368,7 @@ int zpushVkExternalFencePropertiesKHR(lua_State *L, const VkExternalFencePropert
 
 #define znewVkPhysicalDeviceExternalFenceInfoKHR(L, err) (VkPhysicalDeviceExternalFenceInfoKHR*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO_KHR, sizeof(VkPhysicalDeviceExternalFenceInfoKHR), (err))
 #define znewarrayVkPhysicalDeviceExternalFenceInfoKHR(L, count, err) (VkPhysicalDeviceExternalFenceInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO_KHR, sizeof(VkPhysicalDeviceExternalFenceInfoKHR), (count), (err))
+#define zinitarrayVkPhysicalDeviceExternalFenceInfoKHR(p, count) (VkPhysicalDeviceExternalFenceInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO_KHR, sizeof(VkPhysicalDeviceExternalFenceInfoKHR), (count))
 #define znewchainVkPhysicalDeviceExternalFenceInfoKHR moonvulkan_znewchainVkPhysicalDeviceExternalFenceInfoKHR
 VkPhysicalDeviceExternalFenceInfoKHR* znewchainVkPhysicalDeviceExternalFenceInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceExternalFenceInfoKHR moonvulkan_znewchainarrayVkPhysicalDeviceExternalFenceInfoKHR
@@ -2023,6 +2377,8 @@ VkPhysicalDeviceExternalFenceInfoKHR* znewchainarrayVkPhysicalDeviceExternalFenc
 VkPhysicalDeviceExternalFenceInfoKHR* zcheckVkPhysicalDeviceExternalFenceInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceExternalFenceInfoKHR moonvulkan_zcheckarrayVkPhysicalDeviceExternalFenceInfoKHR
 VkPhysicalDeviceExternalFenceInfoKHR* zcheckarrayVkPhysicalDeviceExternalFenceInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceExternalFenceInfoKHR moonvulkan_zcheckarraybufVkPhysicalDeviceExternalFenceInfoKHR
+VkPhysicalDeviceExternalFenceInfoKHR* zcheckarraybufVkPhysicalDeviceExternalFenceInfoKHR(lua_State *L, int arg, VkPhysicalDeviceExternalFenceInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceExternalFenceInfoKHR moonvulkan_zinitVkPhysicalDeviceExternalFenceInfoKHR
 int zinitVkPhysicalDeviceExternalFenceInfoKHR(lua_State *L, VkPhysicalDeviceExternalFenceInfoKHR* p, int *err);
 #define zfreeVkPhysicalDeviceExternalFenceInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2032,6 +2388,7 @@ int zpushVkPhysicalDeviceExternalFenceInfoKHR(lua_State *L, const VkPhysicalDevi
 
 #define znewVkExternalSemaphorePropertiesKHR(L, err) (VkExternalSemaphorePropertiesKHR*)znew((L), VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES_KHR, sizeof(VkExternalSemaphorePropertiesKHR), (err))
 #define znewarrayVkExternalSemaphorePropertiesKHR(L, count, err) (VkExternalSemaphorePropertiesKHR*)znewarray((L), VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES_KHR, sizeof(VkExternalSemaphorePropertiesKHR), (count), (err))
+#define zinitarrayVkExternalSemaphorePropertiesKHR(p, count) (VkExternalSemaphorePropertiesKHR*)zinitarray((p), VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES_KHR, sizeof(VkExternalSemaphorePropertiesKHR), (count))
 #define znewchainVkExternalSemaphorePropertiesKHR moonvulkan_znewchainVkExternalSemaphorePropertiesKHR
 VkExternalSemaphorePropertiesKHR* znewchainVkExternalSemaphorePropertiesKHR(lua_State *L, int *err);
 #define znewchainarrayVkExternalSemaphorePropertiesKHR moonvulkan_znewchainarrayVkExternalSemaphorePropertiesKHR
@@ -2040,6 +2397,8 @@ VkExternalSemaphorePropertiesKHR* znewchainarrayVkExternalSemaphorePropertiesKHR
 VkExternalSemaphorePropertiesKHR* zcheckVkExternalSemaphorePropertiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExternalSemaphorePropertiesKHR moonvulkan_zcheckarrayVkExternalSemaphorePropertiesKHR
 VkExternalSemaphorePropertiesKHR* zcheckarrayVkExternalSemaphorePropertiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExternalSemaphorePropertiesKHR moonvulkan_zcheckarraybufVkExternalSemaphorePropertiesKHR
+VkExternalSemaphorePropertiesKHR* zcheckarraybufVkExternalSemaphorePropertiesKHR(lua_State *L, int arg, VkExternalSemaphorePropertiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExternalSemaphorePropertiesKHR moonvulkan_zinitVkExternalSemaphorePropertiesKHR
 int zinitVkExternalSemaphorePropertiesKHR(lua_State *L, VkExternalSemaphorePropertiesKHR* p, int *err);
 #define zfreeVkExternalSemaphorePropertiesKHR(L, p, base) zfree((L), (p), (base))
@@ -2049,6 +2408,7 @@ int zpushVkExternalSemaphorePropertiesKHR(lua_State *L, const VkExternalSemaphor
 
 #define znewVkPhysicalDeviceExternalSemaphoreInfo(L, err) (VkPhysicalDeviceExternalSemaphoreInfo*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO, sizeof(VkPhysicalDeviceExternalSemaphoreInfo), (err))
 #define znewarrayVkPhysicalDeviceExternalSemaphoreInfo(L, count, err) (VkPhysicalDeviceExternalSemaphoreInfo*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO, sizeof(VkPhysicalDeviceExternalSemaphoreInfo), (count), (err))
+#define zinitarrayVkPhysicalDeviceExternalSemaphoreInfo(p, count) (VkPhysicalDeviceExternalSemaphoreInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO, sizeof(VkPhysicalDeviceExternalSemaphoreInfo), (count))
 #define znewchainVkPhysicalDeviceExternalSemaphoreInfo moonvulkan_znewchainVkPhysicalDeviceExternalSemaphoreInfo
 VkPhysicalDeviceExternalSemaphoreInfo* znewchainVkPhysicalDeviceExternalSemaphoreInfo(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceExternalSemaphoreInfo moonvulkan_znewchainarrayVkPhysicalDeviceExternalSemaphoreInfo
@@ -2057,6 +2417,8 @@ VkPhysicalDeviceExternalSemaphoreInfo* znewchainarrayVkPhysicalDeviceExternalSem
 VkPhysicalDeviceExternalSemaphoreInfo* zcheckVkPhysicalDeviceExternalSemaphoreInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceExternalSemaphoreInfo moonvulkan_zcheckarrayVkPhysicalDeviceExternalSemaphoreInfo
 VkPhysicalDeviceExternalSemaphoreInfo* zcheckarrayVkPhysicalDeviceExternalSemaphoreInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceExternalSemaphoreInfo moonvulkan_zcheckarraybufVkPhysicalDeviceExternalSemaphoreInfo
+VkPhysicalDeviceExternalSemaphoreInfo* zcheckarraybufVkPhysicalDeviceExternalSemaphoreInfo(lua_State *L, int arg, VkPhysicalDeviceExternalSemaphoreInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceExternalSemaphoreInfo moonvulkan_zinitVkPhysicalDeviceExternalSemaphoreInfo
 int zinitVkPhysicalDeviceExternalSemaphoreInfo(lua_State *L, VkPhysicalDeviceExternalSemaphoreInfo* p, int *err);
 #define zfreeVkPhysicalDeviceExternalSemaphoreInfo(L, p, base) zfree((L), (p), (base))
@@ -2066,6 +2428,7 @@ int zpushVkPhysicalDeviceExternalSemaphoreInfo(lua_State *L, const VkPhysicalDev
 
 #define znewVkPhysicalDeviceSparseImageFormatInfo2(L, err) (VkPhysicalDeviceSparseImageFormatInfo2*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2, sizeof(VkPhysicalDeviceSparseImageFormatInfo2), (err))
 #define znewarrayVkPhysicalDeviceSparseImageFormatInfo2(L, count, err) (VkPhysicalDeviceSparseImageFormatInfo2*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2, sizeof(VkPhysicalDeviceSparseImageFormatInfo2), (count), (err))
+#define zinitarrayVkPhysicalDeviceSparseImageFormatInfo2(p, count) (VkPhysicalDeviceSparseImageFormatInfo2*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2, sizeof(VkPhysicalDeviceSparseImageFormatInfo2), (count))
 #define znewchainVkPhysicalDeviceSparseImageFormatInfo2 moonvulkan_znewchainVkPhysicalDeviceSparseImageFormatInfo2
 VkPhysicalDeviceSparseImageFormatInfo2* znewchainVkPhysicalDeviceSparseImageFormatInfo2(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceSparseImageFormatInfo2 moonvulkan_znewchainarrayVkPhysicalDeviceSparseImageFormatInfo2
@@ -2074,6 +2437,8 @@ VkPhysicalDeviceSparseImageFormatInfo2* znewchainarrayVkPhysicalDeviceSparseImag
 VkPhysicalDeviceSparseImageFormatInfo2* zcheckVkPhysicalDeviceSparseImageFormatInfo2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceSparseImageFormatInfo2 moonvulkan_zcheckarrayVkPhysicalDeviceSparseImageFormatInfo2
 VkPhysicalDeviceSparseImageFormatInfo2* zcheckarrayVkPhysicalDeviceSparseImageFormatInfo2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceSparseImageFormatInfo2 moonvulkan_zcheckarraybufVkPhysicalDeviceSparseImageFormatInfo2
+VkPhysicalDeviceSparseImageFormatInfo2* zcheckarraybufVkPhysicalDeviceSparseImageFormatInfo2(lua_State *L, int arg, VkPhysicalDeviceSparseImageFormatInfo2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceSparseImageFormatInfo2 moonvulkan_zinitVkPhysicalDeviceSparseImageFormatInfo2
 int zinitVkPhysicalDeviceSparseImageFormatInfo2(lua_State *L, VkPhysicalDeviceSparseImageFormatInfo2* p, int *err);
 #define zfreeVkPhysicalDeviceSparseImageFormatInfo2(L, p, base) zfree((L), (p), (base))
@@ -2083,6 +2448,7 @@ int zpushVkPhysicalDeviceSparseImageFormatInfo2(lua_State *L, const VkPhysicalDe
 
 #define znewVkRenderPassSampleLocationsBeginInfoEXT(L, err) (VkRenderPassSampleLocationsBeginInfoEXT*)znew((L), VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT, sizeof(VkRenderPassSampleLocationsBeginInfoEXT), (err))
 #define znewarrayVkRenderPassSampleLocationsBeginInfoEXT(L, count, err) (VkRenderPassSampleLocationsBeginInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT, sizeof(VkRenderPassSampleLocationsBeginInfoEXT), (count), (err))
+#define zinitarrayVkRenderPassSampleLocationsBeginInfoEXT(p, count) (VkRenderPassSampleLocationsBeginInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT, sizeof(VkRenderPassSampleLocationsBeginInfoEXT), (count))
 #define znewchainVkRenderPassSampleLocationsBeginInfoEXT moonvulkan_znewchainVkRenderPassSampleLocationsBeginInfoEXT
 VkRenderPassSampleLocationsBeginInfoEXT* znewchainVkRenderPassSampleLocationsBeginInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkRenderPassSampleLocationsBeginInfoEXT moonvulkan_znewchainarrayVkRenderPassSampleLocationsBeginInfoEXT
@@ -2091,6 +2457,8 @@ VkRenderPassSampleLocationsBeginInfoEXT* znewchainarrayVkRenderPassSampleLocatio
 VkRenderPassSampleLocationsBeginInfoEXT* zcheckVkRenderPassSampleLocationsBeginInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRenderPassSampleLocationsBeginInfoEXT moonvulkan_zcheckarrayVkRenderPassSampleLocationsBeginInfoEXT
 VkRenderPassSampleLocationsBeginInfoEXT* zcheckarrayVkRenderPassSampleLocationsBeginInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRenderPassSampleLocationsBeginInfoEXT moonvulkan_zcheckarraybufVkRenderPassSampleLocationsBeginInfoEXT
+VkRenderPassSampleLocationsBeginInfoEXT* zcheckarraybufVkRenderPassSampleLocationsBeginInfoEXT(lua_State *L, int arg, VkRenderPassSampleLocationsBeginInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRenderPassSampleLocationsBeginInfoEXT moonvulkan_zinitVkRenderPassSampleLocationsBeginInfoEXT
 int zinitVkRenderPassSampleLocationsBeginInfoEXT(lua_State *L, VkRenderPassSampleLocationsBeginInfoEXT* p, int *err);
 #define zfreeVkRenderPassSampleLocationsBeginInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -2100,6 +2468,7 @@ int zpushVkRenderPassSampleLocationsBeginInfoEXT(lua_State *L, const VkRenderPas
 
 #define znewVkRenderPassBeginInfo(L, err) (VkRenderPassBeginInfo*)znew((L), VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO, sizeof(VkRenderPassBeginInfo), (err))
 #define znewarrayVkRenderPassBeginInfo(L, count, err) (VkRenderPassBeginInfo*)znewarray((L), VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO, sizeof(VkRenderPassBeginInfo), (count), (err))
+#define zinitarrayVkRenderPassBeginInfo(p, count) (VkRenderPassBeginInfo*)zinitarray((p), VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO, sizeof(VkRenderPassBeginInfo), (count))
 #define znewchainVkRenderPassBeginInfo moonvulkan_znewchainVkRenderPassBeginInfo
 VkRenderPassBeginInfo* znewchainVkRenderPassBeginInfo(lua_State *L, int *err);
 #define znewchainarrayVkRenderPassBeginInfo moonvulkan_znewchainarrayVkRenderPassBeginInfo
@@ -2108,6 +2477,8 @@ VkRenderPassBeginInfo* znewchainarrayVkRenderPassBeginInfo(lua_State *L, uint32_
 VkRenderPassBeginInfo* zcheckVkRenderPassBeginInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRenderPassBeginInfo moonvulkan_zcheckarrayVkRenderPassBeginInfo
 VkRenderPassBeginInfo* zcheckarrayVkRenderPassBeginInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRenderPassBeginInfo moonvulkan_zcheckarraybufVkRenderPassBeginInfo
+VkRenderPassBeginInfo* zcheckarraybufVkRenderPassBeginInfo(lua_State *L, int arg, VkRenderPassBeginInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRenderPassBeginInfo moonvulkan_zinitVkRenderPassBeginInfo
 int zinitVkRenderPassBeginInfo(lua_State *L, VkRenderPassBeginInfo* p, int *err);
 #define zfreeVkRenderPassBeginInfo(L, p, base) zfree((L), (p), (base))
@@ -2117,6 +2488,7 @@ int zpushVkRenderPassBeginInfo(lua_State *L, const VkRenderPassBeginInfo *p);
 
 #define znewVkPhysicalDeviceExternalImageFormatInfoKHR(L, err) (VkPhysicalDeviceExternalImageFormatInfoKHR*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO_KHR, sizeof(VkPhysicalDeviceExternalImageFormatInfoKHR), (err))
 #define znewarrayVkPhysicalDeviceExternalImageFormatInfoKHR(L, count, err) (VkPhysicalDeviceExternalImageFormatInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO_KHR, sizeof(VkPhysicalDeviceExternalImageFormatInfoKHR), (count), (err))
+#define zinitarrayVkPhysicalDeviceExternalImageFormatInfoKHR(p, count) (VkPhysicalDeviceExternalImageFormatInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO_KHR, sizeof(VkPhysicalDeviceExternalImageFormatInfoKHR), (count))
 #define znewchainVkPhysicalDeviceExternalImageFormatInfoKHR moonvulkan_znewchainVkPhysicalDeviceExternalImageFormatInfoKHR
 VkPhysicalDeviceExternalImageFormatInfoKHR* znewchainVkPhysicalDeviceExternalImageFormatInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceExternalImageFormatInfoKHR moonvulkan_znewchainarrayVkPhysicalDeviceExternalImageFormatInfoKHR
@@ -2125,6 +2497,8 @@ VkPhysicalDeviceExternalImageFormatInfoKHR* znewchainarrayVkPhysicalDeviceExtern
 VkPhysicalDeviceExternalImageFormatInfoKHR* zcheckVkPhysicalDeviceExternalImageFormatInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceExternalImageFormatInfoKHR moonvulkan_zcheckarrayVkPhysicalDeviceExternalImageFormatInfoKHR
 VkPhysicalDeviceExternalImageFormatInfoKHR* zcheckarrayVkPhysicalDeviceExternalImageFormatInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceExternalImageFormatInfoKHR moonvulkan_zcheckarraybufVkPhysicalDeviceExternalImageFormatInfoKHR
+VkPhysicalDeviceExternalImageFormatInfoKHR* zcheckarraybufVkPhysicalDeviceExternalImageFormatInfoKHR(lua_State *L, int arg, VkPhysicalDeviceExternalImageFormatInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceExternalImageFormatInfoKHR moonvulkan_zinitVkPhysicalDeviceExternalImageFormatInfoKHR
 int zinitVkPhysicalDeviceExternalImageFormatInfoKHR(lua_State *L, VkPhysicalDeviceExternalImageFormatInfoKHR* p, int *err);
 #define zfreeVkPhysicalDeviceExternalImageFormatInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2134,6 +2508,7 @@ int zpushVkPhysicalDeviceExternalImageFormatInfoKHR(lua_State *L, const VkPhysic
 
 #define znewVkPhysicalDeviceImageFormatInfo2(L, err) (VkPhysicalDeviceImageFormatInfo2*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2, sizeof(VkPhysicalDeviceImageFormatInfo2), (err))
 #define znewarrayVkPhysicalDeviceImageFormatInfo2(L, count, err) (VkPhysicalDeviceImageFormatInfo2*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2, sizeof(VkPhysicalDeviceImageFormatInfo2), (count), (err))
+#define zinitarrayVkPhysicalDeviceImageFormatInfo2(p, count) (VkPhysicalDeviceImageFormatInfo2*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2, sizeof(VkPhysicalDeviceImageFormatInfo2), (count))
 #define znewchainVkPhysicalDeviceImageFormatInfo2 moonvulkan_znewchainVkPhysicalDeviceImageFormatInfo2
 VkPhysicalDeviceImageFormatInfo2* znewchainVkPhysicalDeviceImageFormatInfo2(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceImageFormatInfo2 moonvulkan_znewchainarrayVkPhysicalDeviceImageFormatInfo2
@@ -2142,6 +2517,8 @@ VkPhysicalDeviceImageFormatInfo2* znewchainarrayVkPhysicalDeviceImageFormatInfo2
 VkPhysicalDeviceImageFormatInfo2* zcheckVkPhysicalDeviceImageFormatInfo2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceImageFormatInfo2 moonvulkan_zcheckarrayVkPhysicalDeviceImageFormatInfo2
 VkPhysicalDeviceImageFormatInfo2* zcheckarrayVkPhysicalDeviceImageFormatInfo2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceImageFormatInfo2 moonvulkan_zcheckarraybufVkPhysicalDeviceImageFormatInfo2
+VkPhysicalDeviceImageFormatInfo2* zcheckarraybufVkPhysicalDeviceImageFormatInfo2(lua_State *L, int arg, VkPhysicalDeviceImageFormatInfo2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceImageFormatInfo2 moonvulkan_zinitVkPhysicalDeviceImageFormatInfo2
 int zinitVkPhysicalDeviceImageFormatInfo2(lua_State *L, VkPhysicalDeviceImageFormatInfo2* p, int *err);
 #define zfreeVkPhysicalDeviceImageFormatInfo2(L, p, base) zfree((L), (p), (base))
@@ -2151,6 +2528,7 @@ int zpushVkPhysicalDeviceImageFormatInfo2(lua_State *L, const VkPhysicalDeviceIm
 
 #define znewVkDisplayModeCreateInfoKHR(L, err) (VkDisplayModeCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR, sizeof(VkDisplayModeCreateInfoKHR), (err))
 #define znewarrayVkDisplayModeCreateInfoKHR(L, count, err) (VkDisplayModeCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR, sizeof(VkDisplayModeCreateInfoKHR), (count), (err))
+#define zinitarrayVkDisplayModeCreateInfoKHR(p, count) (VkDisplayModeCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR, sizeof(VkDisplayModeCreateInfoKHR), (count))
 #define znewchainVkDisplayModeCreateInfoKHR moonvulkan_znewchainVkDisplayModeCreateInfoKHR
 VkDisplayModeCreateInfoKHR* znewchainVkDisplayModeCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkDisplayModeCreateInfoKHR moonvulkan_znewchainarrayVkDisplayModeCreateInfoKHR
@@ -2159,6 +2537,8 @@ VkDisplayModeCreateInfoKHR* znewchainarrayVkDisplayModeCreateInfoKHR(lua_State *
 VkDisplayModeCreateInfoKHR* zcheckVkDisplayModeCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayModeCreateInfoKHR moonvulkan_zcheckarrayVkDisplayModeCreateInfoKHR
 VkDisplayModeCreateInfoKHR* zcheckarrayVkDisplayModeCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayModeCreateInfoKHR moonvulkan_zcheckarraybufVkDisplayModeCreateInfoKHR
+VkDisplayModeCreateInfoKHR* zcheckarraybufVkDisplayModeCreateInfoKHR(lua_State *L, int arg, VkDisplayModeCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayModeCreateInfoKHR moonvulkan_zinitVkDisplayModeCreateInfoKHR
 int zinitVkDisplayModeCreateInfoKHR(lua_State *L, VkDisplayModeCreateInfoKHR* p, int *err);
 #define zfreeVkDisplayModeCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2168,6 +2548,7 @@ int zpushVkDisplayModeCreateInfoKHR(lua_State *L, const VkDisplayModeCreateInfoK
 
 #define znewVkPhysicalDeviceSurfaceInfo2KHR(L, err) (VkPhysicalDeviceSurfaceInfo2KHR*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR, sizeof(VkPhysicalDeviceSurfaceInfo2KHR), (err))
 #define znewarrayVkPhysicalDeviceSurfaceInfo2KHR(L, count, err) (VkPhysicalDeviceSurfaceInfo2KHR*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR, sizeof(VkPhysicalDeviceSurfaceInfo2KHR), (count), (err))
+#define zinitarrayVkPhysicalDeviceSurfaceInfo2KHR(p, count) (VkPhysicalDeviceSurfaceInfo2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR, sizeof(VkPhysicalDeviceSurfaceInfo2KHR), (count))
 #define znewchainVkPhysicalDeviceSurfaceInfo2KHR moonvulkan_znewchainVkPhysicalDeviceSurfaceInfo2KHR
 VkPhysicalDeviceSurfaceInfo2KHR* znewchainVkPhysicalDeviceSurfaceInfo2KHR(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceSurfaceInfo2KHR moonvulkan_znewchainarrayVkPhysicalDeviceSurfaceInfo2KHR
@@ -2176,6 +2557,8 @@ VkPhysicalDeviceSurfaceInfo2KHR* znewchainarrayVkPhysicalDeviceSurfaceInfo2KHR(l
 VkPhysicalDeviceSurfaceInfo2KHR* zcheckVkPhysicalDeviceSurfaceInfo2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceSurfaceInfo2KHR moonvulkan_zcheckarrayVkPhysicalDeviceSurfaceInfo2KHR
 VkPhysicalDeviceSurfaceInfo2KHR* zcheckarrayVkPhysicalDeviceSurfaceInfo2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceSurfaceInfo2KHR moonvulkan_zcheckarraybufVkPhysicalDeviceSurfaceInfo2KHR
+VkPhysicalDeviceSurfaceInfo2KHR* zcheckarraybufVkPhysicalDeviceSurfaceInfo2KHR(lua_State *L, int arg, VkPhysicalDeviceSurfaceInfo2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceSurfaceInfo2KHR moonvulkan_zinitVkPhysicalDeviceSurfaceInfo2KHR
 int zinitVkPhysicalDeviceSurfaceInfo2KHR(lua_State *L, VkPhysicalDeviceSurfaceInfo2KHR* p, int *err);
 #define zfreeVkPhysicalDeviceSurfaceInfo2KHR(L, p, base) zfree((L), (p), (base))
@@ -2185,6 +2568,7 @@ int zpushVkPhysicalDeviceSurfaceInfo2KHR(lua_State *L, const VkPhysicalDeviceSur
 
 #define znewVkProtectedSubmitInfo(L, err) (VkProtectedSubmitInfo*)znew((L), VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO, sizeof(VkProtectedSubmitInfo), (err))
 #define znewarrayVkProtectedSubmitInfo(L, count, err) (VkProtectedSubmitInfo*)znewarray((L), VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO, sizeof(VkProtectedSubmitInfo), (count), (err))
+#define zinitarrayVkProtectedSubmitInfo(p, count) (VkProtectedSubmitInfo*)zinitarray((p), VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO, sizeof(VkProtectedSubmitInfo), (count))
 #define znewchainVkProtectedSubmitInfo moonvulkan_znewchainVkProtectedSubmitInfo
 VkProtectedSubmitInfo* znewchainVkProtectedSubmitInfo(lua_State *L, int *err);
 #define znewchainarrayVkProtectedSubmitInfo moonvulkan_znewchainarrayVkProtectedSubmitInfo
@@ -2193,6 +2577,8 @@ VkProtectedSubmitInfo* znewchainarrayVkProtectedSubmitInfo(lua_State *L, uint32_
 VkProtectedSubmitInfo* zcheckVkProtectedSubmitInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkProtectedSubmitInfo moonvulkan_zcheckarrayVkProtectedSubmitInfo
 VkProtectedSubmitInfo* zcheckarrayVkProtectedSubmitInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkProtectedSubmitInfo moonvulkan_zcheckarraybufVkProtectedSubmitInfo
+VkProtectedSubmitInfo* zcheckarraybufVkProtectedSubmitInfo(lua_State *L, int arg, VkProtectedSubmitInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkProtectedSubmitInfo moonvulkan_zinitVkProtectedSubmitInfo
 int zinitVkProtectedSubmitInfo(lua_State *L, VkProtectedSubmitInfo* p, int *err);
 #define zfreeVkProtectedSubmitInfo(L, p, base) zfree((L), (p), (base))
@@ -2202,6 +2588,7 @@ int zpushVkProtectedSubmitInfo(lua_State *L, const VkProtectedSubmitInfo *p);
 
 #define znewVkPipelineRasterizationConservativeStateCreateInfoEXT(L, err) (VkPipelineRasterizationConservativeStateCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationConservativeStateCreateInfoEXT), (err))
 #define znewarrayVkPipelineRasterizationConservativeStateCreateInfoEXT(L, count, err) (VkPipelineRasterizationConservativeStateCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationConservativeStateCreateInfoEXT), (count), (err))
+#define zinitarrayVkPipelineRasterizationConservativeStateCreateInfoEXT(p, count) (VkPipelineRasterizationConservativeStateCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationConservativeStateCreateInfoEXT), (count))
 #define znewchainVkPipelineRasterizationConservativeStateCreateInfoEXT moonvulkan_znewchainVkPipelineRasterizationConservativeStateCreateInfoEXT
 VkPipelineRasterizationConservativeStateCreateInfoEXT* znewchainVkPipelineRasterizationConservativeStateCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPipelineRasterizationConservativeStateCreateInfoEXT moonvulkan_znewchainarrayVkPipelineRasterizationConservativeStateCreateInfoEXT
@@ -2210,6 +2597,8 @@ VkPipelineRasterizationConservativeStateCreateInfoEXT* znewchainarrayVkPipelineR
 VkPipelineRasterizationConservativeStateCreateInfoEXT* zcheckVkPipelineRasterizationConservativeStateCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineRasterizationConservativeStateCreateInfoEXT moonvulkan_zcheckarrayVkPipelineRasterizationConservativeStateCreateInfoEXT
 VkPipelineRasterizationConservativeStateCreateInfoEXT* zcheckarrayVkPipelineRasterizationConservativeStateCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineRasterizationConservativeStateCreateInfoEXT moonvulkan_zcheckarraybufVkPipelineRasterizationConservativeStateCreateInfoEXT
+VkPipelineRasterizationConservativeStateCreateInfoEXT* zcheckarraybufVkPipelineRasterizationConservativeStateCreateInfoEXT(lua_State *L, int arg, VkPipelineRasterizationConservativeStateCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineRasterizationConservativeStateCreateInfoEXT moonvulkan_zinitVkPipelineRasterizationConservativeStateCreateInfoEXT
 int zinitVkPipelineRasterizationConservativeStateCreateInfoEXT(lua_State *L, VkPipelineRasterizationConservativeStateCreateInfoEXT* p, int *err);
 #define zfreeVkPipelineRasterizationConservativeStateCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -2219,6 +2608,7 @@ int zpushVkPipelineRasterizationConservativeStateCreateInfoEXT(lua_State *L, con
 
 #define znewVkPipelineRasterizationStateStreamCreateInfoEXT(L, err) (VkPipelineRasterizationStateStreamCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationStateStreamCreateInfoEXT), (err))
 #define znewarrayVkPipelineRasterizationStateStreamCreateInfoEXT(L, count, err) (VkPipelineRasterizationStateStreamCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationStateStreamCreateInfoEXT), (count), (err))
+#define zinitarrayVkPipelineRasterizationStateStreamCreateInfoEXT(p, count) (VkPipelineRasterizationStateStreamCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationStateStreamCreateInfoEXT), (count))
 #define znewchainVkPipelineRasterizationStateStreamCreateInfoEXT moonvulkan_znewchainVkPipelineRasterizationStateStreamCreateInfoEXT
 VkPipelineRasterizationStateStreamCreateInfoEXT* znewchainVkPipelineRasterizationStateStreamCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPipelineRasterizationStateStreamCreateInfoEXT moonvulkan_znewchainarrayVkPipelineRasterizationStateStreamCreateInfoEXT
@@ -2227,6 +2617,8 @@ VkPipelineRasterizationStateStreamCreateInfoEXT* znewchainarrayVkPipelineRasteri
 VkPipelineRasterizationStateStreamCreateInfoEXT* zcheckVkPipelineRasterizationStateStreamCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineRasterizationStateStreamCreateInfoEXT moonvulkan_zcheckarrayVkPipelineRasterizationStateStreamCreateInfoEXT
 VkPipelineRasterizationStateStreamCreateInfoEXT* zcheckarrayVkPipelineRasterizationStateStreamCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineRasterizationStateStreamCreateInfoEXT moonvulkan_zcheckarraybufVkPipelineRasterizationStateStreamCreateInfoEXT
+VkPipelineRasterizationStateStreamCreateInfoEXT* zcheckarraybufVkPipelineRasterizationStateStreamCreateInfoEXT(lua_State *L, int arg, VkPipelineRasterizationStateStreamCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineRasterizationStateStreamCreateInfoEXT moonvulkan_zinitVkPipelineRasterizationStateStreamCreateInfoEXT
 int zinitVkPipelineRasterizationStateStreamCreateInfoEXT(lua_State *L, VkPipelineRasterizationStateStreamCreateInfoEXT* p, int *err);
 #define zfreeVkPipelineRasterizationStateStreamCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -2236,6 +2628,7 @@ int zpushVkPipelineRasterizationStateStreamCreateInfoEXT(lua_State *L, const VkP
 
 #define znewVkImageViewASTCDecodeModeEXT(L, err) (VkImageViewASTCDecodeModeEXT*)znew((L), VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT, sizeof(VkImageViewASTCDecodeModeEXT), (err))
 #define znewarrayVkImageViewASTCDecodeModeEXT(L, count, err) (VkImageViewASTCDecodeModeEXT*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT, sizeof(VkImageViewASTCDecodeModeEXT), (count), (err))
+#define zinitarrayVkImageViewASTCDecodeModeEXT(p, count) (VkImageViewASTCDecodeModeEXT*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT, sizeof(VkImageViewASTCDecodeModeEXT), (count))
 #define znewchainVkImageViewASTCDecodeModeEXT moonvulkan_znewchainVkImageViewASTCDecodeModeEXT
 VkImageViewASTCDecodeModeEXT* znewchainVkImageViewASTCDecodeModeEXT(lua_State *L, int *err);
 #define znewchainarrayVkImageViewASTCDecodeModeEXT moonvulkan_znewchainarrayVkImageViewASTCDecodeModeEXT
@@ -2244,6 +2637,8 @@ VkImageViewASTCDecodeModeEXT* znewchainarrayVkImageViewASTCDecodeModeEXT(lua_Sta
 VkImageViewASTCDecodeModeEXT* zcheckVkImageViewASTCDecodeModeEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageViewASTCDecodeModeEXT moonvulkan_zcheckarrayVkImageViewASTCDecodeModeEXT
 VkImageViewASTCDecodeModeEXT* zcheckarrayVkImageViewASTCDecodeModeEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageViewASTCDecodeModeEXT moonvulkan_zcheckarraybufVkImageViewASTCDecodeModeEXT
+VkImageViewASTCDecodeModeEXT* zcheckarraybufVkImageViewASTCDecodeModeEXT(lua_State *L, int arg, VkImageViewASTCDecodeModeEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageViewASTCDecodeModeEXT moonvulkan_zinitVkImageViewASTCDecodeModeEXT
 int zinitVkImageViewASTCDecodeModeEXT(lua_State *L, VkImageViewASTCDecodeModeEXT* p, int *err);
 #define zfreeVkImageViewASTCDecodeModeEXT(L, p, base) zfree((L), (p), (base))
@@ -2253,6 +2648,7 @@ int zpushVkImageViewASTCDecodeModeEXT(lua_State *L, const VkImageViewASTCDecodeM
 
 #define znewVkPipelineVertexInputDivisorStateCreateInfoEXT(L, err) (VkPipelineVertexInputDivisorStateCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT, sizeof(VkPipelineVertexInputDivisorStateCreateInfoEXT), (err))
 #define znewarrayVkPipelineVertexInputDivisorStateCreateInfoEXT(L, count, err) (VkPipelineVertexInputDivisorStateCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT, sizeof(VkPipelineVertexInputDivisorStateCreateInfoEXT), (count), (err))
+#define zinitarrayVkPipelineVertexInputDivisorStateCreateInfoEXT(p, count) (VkPipelineVertexInputDivisorStateCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT, sizeof(VkPipelineVertexInputDivisorStateCreateInfoEXT), (count))
 #define znewchainVkPipelineVertexInputDivisorStateCreateInfoEXT moonvulkan_znewchainVkPipelineVertexInputDivisorStateCreateInfoEXT
 VkPipelineVertexInputDivisorStateCreateInfoEXT* znewchainVkPipelineVertexInputDivisorStateCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPipelineVertexInputDivisorStateCreateInfoEXT moonvulkan_znewchainarrayVkPipelineVertexInputDivisorStateCreateInfoEXT
@@ -2261,6 +2657,8 @@ VkPipelineVertexInputDivisorStateCreateInfoEXT* znewchainarrayVkPipelineVertexIn
 VkPipelineVertexInputDivisorStateCreateInfoEXT* zcheckVkPipelineVertexInputDivisorStateCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineVertexInputDivisorStateCreateInfoEXT moonvulkan_zcheckarrayVkPipelineVertexInputDivisorStateCreateInfoEXT
 VkPipelineVertexInputDivisorStateCreateInfoEXT* zcheckarrayVkPipelineVertexInputDivisorStateCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineVertexInputDivisorStateCreateInfoEXT moonvulkan_zcheckarraybufVkPipelineVertexInputDivisorStateCreateInfoEXT
+VkPipelineVertexInputDivisorStateCreateInfoEXT* zcheckarraybufVkPipelineVertexInputDivisorStateCreateInfoEXT(lua_State *L, int arg, VkPipelineVertexInputDivisorStateCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineVertexInputDivisorStateCreateInfoEXT moonvulkan_zinitVkPipelineVertexInputDivisorStateCreateInfoEXT
 int zinitVkPipelineVertexInputDivisorStateCreateInfoEXT(lua_State *L, VkPipelineVertexInputDivisorStateCreateInfoEXT* p, int *err);
 #define zfreeVkPipelineVertexInputDivisorStateCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -2270,6 +2668,7 @@ int zpushVkPipelineVertexInputDivisorStateCreateInfoEXT(lua_State *L, const VkPi
 
 #define znewVkWriteDescriptorSetInlineUniformBlockEXT(L, err) (VkWriteDescriptorSetInlineUniformBlockEXT*)znew((L), VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT, sizeof(VkWriteDescriptorSetInlineUniformBlockEXT), (err))
 #define znewarrayVkWriteDescriptorSetInlineUniformBlockEXT(L, count, err) (VkWriteDescriptorSetInlineUniformBlockEXT*)znewarray((L), VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT, sizeof(VkWriteDescriptorSetInlineUniformBlockEXT), (count), (err))
+#define zinitarrayVkWriteDescriptorSetInlineUniformBlockEXT(p, count) (VkWriteDescriptorSetInlineUniformBlockEXT*)zinitarray((p), VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT, sizeof(VkWriteDescriptorSetInlineUniformBlockEXT), (count))
 #define znewchainVkWriteDescriptorSetInlineUniformBlockEXT moonvulkan_znewchainVkWriteDescriptorSetInlineUniformBlockEXT
 VkWriteDescriptorSetInlineUniformBlockEXT* znewchainVkWriteDescriptorSetInlineUniformBlockEXT(lua_State *L, int *err);
 #define znewchainarrayVkWriteDescriptorSetInlineUniformBlockEXT moonvulkan_znewchainarrayVkWriteDescriptorSetInlineUniformBlockEXT
@@ -2278,6 +2677,8 @@ VkWriteDescriptorSetInlineUniformBlockEXT* znewchainarrayVkWriteDescriptorSetInl
 VkWriteDescriptorSetInlineUniformBlockEXT* zcheckVkWriteDescriptorSetInlineUniformBlockEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkWriteDescriptorSetInlineUniformBlockEXT moonvulkan_zcheckarrayVkWriteDescriptorSetInlineUniformBlockEXT
 VkWriteDescriptorSetInlineUniformBlockEXT* zcheckarrayVkWriteDescriptorSetInlineUniformBlockEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkWriteDescriptorSetInlineUniformBlockEXT moonvulkan_zcheckarraybufVkWriteDescriptorSetInlineUniformBlockEXT
+VkWriteDescriptorSetInlineUniformBlockEXT* zcheckarraybufVkWriteDescriptorSetInlineUniformBlockEXT(lua_State *L, int arg, VkWriteDescriptorSetInlineUniformBlockEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkWriteDescriptorSetInlineUniformBlockEXT moonvulkan_zinitVkWriteDescriptorSetInlineUniformBlockEXT
 int zinitVkWriteDescriptorSetInlineUniformBlockEXT(lua_State *L, VkWriteDescriptorSetInlineUniformBlockEXT* p, int *err);
 #define zfreeVkWriteDescriptorSetInlineUniformBlockEXT(L, p, base) zfree((L), (p), (base))
@@ -2287,6 +2688,7 @@ int zpushVkWriteDescriptorSetInlineUniformBlockEXT(lua_State *L, const VkWriteDe
 
 #define znewVkDescriptorPoolInlineUniformBlockCreateInfoEXT(L, err) (VkDescriptorPoolInlineUniformBlockCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT, sizeof(VkDescriptorPoolInlineUniformBlockCreateInfoEXT), (err))
 #define znewarrayVkDescriptorPoolInlineUniformBlockCreateInfoEXT(L, count, err) (VkDescriptorPoolInlineUniformBlockCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT, sizeof(VkDescriptorPoolInlineUniformBlockCreateInfoEXT), (count), (err))
+#define zinitarrayVkDescriptorPoolInlineUniformBlockCreateInfoEXT(p, count) (VkDescriptorPoolInlineUniformBlockCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT, sizeof(VkDescriptorPoolInlineUniformBlockCreateInfoEXT), (count))
 #define znewchainVkDescriptorPoolInlineUniformBlockCreateInfoEXT moonvulkan_znewchainVkDescriptorPoolInlineUniformBlockCreateInfoEXT
 VkDescriptorPoolInlineUniformBlockCreateInfoEXT* znewchainVkDescriptorPoolInlineUniformBlockCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkDescriptorPoolInlineUniformBlockCreateInfoEXT moonvulkan_znewchainarrayVkDescriptorPoolInlineUniformBlockCreateInfoEXT
@@ -2295,6 +2697,8 @@ VkDescriptorPoolInlineUniformBlockCreateInfoEXT* znewchainarrayVkDescriptorPoolI
 VkDescriptorPoolInlineUniformBlockCreateInfoEXT* zcheckVkDescriptorPoolInlineUniformBlockCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDescriptorPoolInlineUniformBlockCreateInfoEXT moonvulkan_zcheckarrayVkDescriptorPoolInlineUniformBlockCreateInfoEXT
 VkDescriptorPoolInlineUniformBlockCreateInfoEXT* zcheckarrayVkDescriptorPoolInlineUniformBlockCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDescriptorPoolInlineUniformBlockCreateInfoEXT moonvulkan_zcheckarraybufVkDescriptorPoolInlineUniformBlockCreateInfoEXT
+VkDescriptorPoolInlineUniformBlockCreateInfoEXT* zcheckarraybufVkDescriptorPoolInlineUniformBlockCreateInfoEXT(lua_State *L, int arg, VkDescriptorPoolInlineUniformBlockCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDescriptorPoolInlineUniformBlockCreateInfoEXT moonvulkan_zinitVkDescriptorPoolInlineUniformBlockCreateInfoEXT
 int zinitVkDescriptorPoolInlineUniformBlockCreateInfoEXT(lua_State *L, VkDescriptorPoolInlineUniformBlockCreateInfoEXT* p, int *err);
 #define zfreeVkDescriptorPoolInlineUniformBlockCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -2304,6 +2708,7 @@ int zpushVkDescriptorPoolInlineUniformBlockCreateInfoEXT(lua_State *L, const VkD
 
 #define znewVkDescriptorSetLayoutBindingFlagsCreateInfo(L, err) (VkDescriptorSetLayoutBindingFlagsCreateInfo*)znew((L), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO, sizeof(VkDescriptorSetLayoutBindingFlagsCreateInfo), (err))
 #define znewarrayVkDescriptorSetLayoutBindingFlagsCreateInfo(L, count, err) (VkDescriptorSetLayoutBindingFlagsCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO, sizeof(VkDescriptorSetLayoutBindingFlagsCreateInfo), (count), (err))
+#define zinitarrayVkDescriptorSetLayoutBindingFlagsCreateInfo(p, count) (VkDescriptorSetLayoutBindingFlagsCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO, sizeof(VkDescriptorSetLayoutBindingFlagsCreateInfo), (count))
 #define znewchainVkDescriptorSetLayoutBindingFlagsCreateInfo moonvulkan_znewchainVkDescriptorSetLayoutBindingFlagsCreateInfo
 VkDescriptorSetLayoutBindingFlagsCreateInfo* znewchainVkDescriptorSetLayoutBindingFlagsCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkDescriptorSetLayoutBindingFlagsCreateInfo moonvulkan_znewchainarrayVkDescriptorSetLayoutBindingFlagsCreateInfo
@@ -2312,6 +2717,8 @@ VkDescriptorSetLayoutBindingFlagsCreateInfo* znewchainarrayVkDescriptorSetLayout
 VkDescriptorSetLayoutBindingFlagsCreateInfo* zcheckVkDescriptorSetLayoutBindingFlagsCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDescriptorSetLayoutBindingFlagsCreateInfo moonvulkan_zcheckarrayVkDescriptorSetLayoutBindingFlagsCreateInfo
 VkDescriptorSetLayoutBindingFlagsCreateInfo* zcheckarrayVkDescriptorSetLayoutBindingFlagsCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDescriptorSetLayoutBindingFlagsCreateInfo moonvulkan_zcheckarraybufVkDescriptorSetLayoutBindingFlagsCreateInfo
+VkDescriptorSetLayoutBindingFlagsCreateInfo* zcheckarraybufVkDescriptorSetLayoutBindingFlagsCreateInfo(lua_State *L, int arg, VkDescriptorSetLayoutBindingFlagsCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDescriptorSetLayoutBindingFlagsCreateInfo moonvulkan_zinitVkDescriptorSetLayoutBindingFlagsCreateInfo
 int zinitVkDescriptorSetLayoutBindingFlagsCreateInfo(lua_State *L, VkDescriptorSetLayoutBindingFlagsCreateInfo* p, int *err);
 #define zfreeVkDescriptorSetLayoutBindingFlagsCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -2321,6 +2728,7 @@ int zpushVkDescriptorSetLayoutBindingFlagsCreateInfo(lua_State *L, const VkDescr
 
 #define znewVkDescriptorSetVariableDescriptorCountAllocateInfo(L, err) (VkDescriptorSetVariableDescriptorCountAllocateInfo*)znew((L), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO, sizeof(VkDescriptorSetVariableDescriptorCountAllocateInfo), (err))
 #define znewarrayVkDescriptorSetVariableDescriptorCountAllocateInfo(L, count, err) (VkDescriptorSetVariableDescriptorCountAllocateInfo*)znewarray((L), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO, sizeof(VkDescriptorSetVariableDescriptorCountAllocateInfo), (count), (err))
+#define zinitarrayVkDescriptorSetVariableDescriptorCountAllocateInfo(p, count) (VkDescriptorSetVariableDescriptorCountAllocateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO, sizeof(VkDescriptorSetVariableDescriptorCountAllocateInfo), (count))
 #define znewchainVkDescriptorSetVariableDescriptorCountAllocateInfo moonvulkan_znewchainVkDescriptorSetVariableDescriptorCountAllocateInfo
 VkDescriptorSetVariableDescriptorCountAllocateInfo* znewchainVkDescriptorSetVariableDescriptorCountAllocateInfo(lua_State *L, int *err);
 #define znewchainarrayVkDescriptorSetVariableDescriptorCountAllocateInfo moonvulkan_znewchainarrayVkDescriptorSetVariableDescriptorCountAllocateInfo
@@ -2329,6 +2737,8 @@ VkDescriptorSetVariableDescriptorCountAllocateInfo* znewchainarrayVkDescriptorSe
 VkDescriptorSetVariableDescriptorCountAllocateInfo* zcheckVkDescriptorSetVariableDescriptorCountAllocateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDescriptorSetVariableDescriptorCountAllocateInfo moonvulkan_zcheckarrayVkDescriptorSetVariableDescriptorCountAllocateInfo
 VkDescriptorSetVariableDescriptorCountAllocateInfo* zcheckarrayVkDescriptorSetVariableDescriptorCountAllocateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDescriptorSetVariableDescriptorCountAllocateInfo moonvulkan_zcheckarraybufVkDescriptorSetVariableDescriptorCountAllocateInfo
+VkDescriptorSetVariableDescriptorCountAllocateInfo* zcheckarraybufVkDescriptorSetVariableDescriptorCountAllocateInfo(lua_State *L, int arg, VkDescriptorSetVariableDescriptorCountAllocateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDescriptorSetVariableDescriptorCountAllocateInfo moonvulkan_zinitVkDescriptorSetVariableDescriptorCountAllocateInfo
 int zinitVkDescriptorSetVariableDescriptorCountAllocateInfo(lua_State *L, VkDescriptorSetVariableDescriptorCountAllocateInfo* p, int *err);
 #define zfreeVkDescriptorSetVariableDescriptorCountAllocateInfo(L, p, base) zfree((L), (p), (base))
@@ -2338,6 +2748,7 @@ int zpushVkDescriptorSetVariableDescriptorCountAllocateInfo(lua_State *L, const
 
 #define znewVkRenderPassMultiviewCreateInfoKHR(L, err) (VkRenderPassMultiviewCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO_KHR, sizeof(VkRenderPassMultiviewCreateInfoKHR), (err))
 #define znewarrayVkRenderPassMultiviewCreateInfoKHR(L, count, err) (VkRenderPassMultiviewCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO_KHR, sizeof(VkRenderPassMultiviewCreateInfoKHR), (count), (err))
+#define zinitarrayVkRenderPassMultiviewCreateInfoKHR(p, count) (VkRenderPassMultiviewCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO_KHR, sizeof(VkRenderPassMultiviewCreateInfoKHR), (count))
 #define znewchainVkRenderPassMultiviewCreateInfoKHR moonvulkan_znewchainVkRenderPassMultiviewCreateInfoKHR
 VkRenderPassMultiviewCreateInfoKHR* znewchainVkRenderPassMultiviewCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkRenderPassMultiviewCreateInfoKHR moonvulkan_znewchainarrayVkRenderPassMultiviewCreateInfoKHR
@@ -2346,6 +2757,8 @@ VkRenderPassMultiviewCreateInfoKHR* znewchainarrayVkRenderPassMultiviewCreateInf
 VkRenderPassMultiviewCreateInfoKHR* zcheckVkRenderPassMultiviewCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRenderPassMultiviewCreateInfoKHR moonvulkan_zcheckarrayVkRenderPassMultiviewCreateInfoKHR
 VkRenderPassMultiviewCreateInfoKHR* zcheckarrayVkRenderPassMultiviewCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRenderPassMultiviewCreateInfoKHR moonvulkan_zcheckarraybufVkRenderPassMultiviewCreateInfoKHR
+VkRenderPassMultiviewCreateInfoKHR* zcheckarraybufVkRenderPassMultiviewCreateInfoKHR(lua_State *L, int arg, VkRenderPassMultiviewCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRenderPassMultiviewCreateInfoKHR moonvulkan_zinitVkRenderPassMultiviewCreateInfoKHR
 int zinitVkRenderPassMultiviewCreateInfoKHR(lua_State *L, VkRenderPassMultiviewCreateInfoKHR* p, int *err);
 #define zfreeVkRenderPassMultiviewCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2355,6 +2768,7 @@ int zpushVkRenderPassMultiviewCreateInfoKHR(lua_State *L, const VkRenderPassMult
 
 #define znewVkAttachmentDescription2(L, err) (VkAttachmentDescription2*)znew((L), VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2, sizeof(VkAttachmentDescription2), (err))
 #define znewarrayVkAttachmentDescription2(L, count, err) (VkAttachmentDescription2*)znewarray((L), VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2, sizeof(VkAttachmentDescription2), (count), (err))
+#define zinitarrayVkAttachmentDescription2(p, count) (VkAttachmentDescription2*)zinitarray((p), VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2, sizeof(VkAttachmentDescription2), (count))
 #define znewchainVkAttachmentDescription2 moonvulkan_znewchainVkAttachmentDescription2
 VkAttachmentDescription2* znewchainVkAttachmentDescription2(lua_State *L, int *err);
 #define znewchainarrayVkAttachmentDescription2 moonvulkan_znewchainarrayVkAttachmentDescription2
@@ -2363,6 +2777,8 @@ VkAttachmentDescription2* znewchainarrayVkAttachmentDescription2(lua_State *L, u
 VkAttachmentDescription2* zcheckVkAttachmentDescription2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAttachmentDescription2 moonvulkan_zcheckarrayVkAttachmentDescription2
 VkAttachmentDescription2* zcheckarrayVkAttachmentDescription2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAttachmentDescription2 moonvulkan_zcheckarraybufVkAttachmentDescription2
+VkAttachmentDescription2* zcheckarraybufVkAttachmentDescription2(lua_State *L, int arg, VkAttachmentDescription2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAttachmentDescription2 moonvulkan_zinitVkAttachmentDescription2
 int zinitVkAttachmentDescription2(lua_State *L, VkAttachmentDescription2* p, int *err);
 #define zfreeVkAttachmentDescription2(L, p, base) zfree((L), (p), (base))
@@ -2372,6 +2788,7 @@ int zpushVkAttachmentDescription2(lua_State *L, const VkAttachmentDescription2 *
 
 #define znewVkAttachmentReference2(L, err) (VkAttachmentReference2*)znew((L), VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2, sizeof(VkAttachmentReference2), (err))
 #define znewarrayVkAttachmentReference2(L, count, err) (VkAttachmentReference2*)znewarray((L), VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2, sizeof(VkAttachmentReference2), (count), (err))
+#define zinitarrayVkAttachmentReference2(p, count) (VkAttachmentReference2*)zinitarray((p), VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2, sizeof(VkAttachmentReference2), (count))
 #define znewchainVkAttachmentReference2 moonvulkan_znewchainVkAttachmentReference2
 VkAttachmentReference2* znewchainVkAttachmentReference2(lua_State *L, int *err);
 #define znewchainarrayVkAttachmentReference2 moonvulkan_znewchainarrayVkAttachmentReference2
@@ -2380,6 +2797,8 @@ VkAttachmentReference2* znewchainarrayVkAttachmentReference2(lua_State *L, uint3
 VkAttachmentReference2* zcheckVkAttachmentReference2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAttachmentReference2 moonvulkan_zcheckarrayVkAttachmentReference2
 VkAttachmentReference2* zcheckarrayVkAttachmentReference2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAttachmentReference2 moonvulkan_zcheckarraybufVkAttachmentReference2
+VkAttachmentReference2* zcheckarraybufVkAttachmentReference2(lua_State *L, int arg, VkAttachmentReference2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAttachmentReference2 moonvulkan_zinitVkAttachmentReference2
 int zinitVkAttachmentReference2(lua_State *L, VkAttachmentReference2* p, int *err);
 #define zfreeVkAttachmentReference2(L, p, base) zfree((L), (p), (base))
@@ -2389,6 +2808,7 @@ int zpushVkAttachmentReference2(lua_State *L, const VkAttachmentReference2 *p);
 
 #define znewVkSubpassDescription2(L, err) (VkSubpassDescription2*)znew((L), VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2, sizeof(VkSubpassDescription2), (err))
 #define znewarrayVkSubpassDescription2(L, count, err) (VkSubpassDescription2*)znewarray((L), VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2, sizeof(VkSubpassDescription2), (count), (err))
+#define zinitarrayVkSubpassDescription2(p, count) (VkSubpassDescription2*)zinitarray((p), VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2, sizeof(VkSubpassDescription2), (count))
 #define znewchainVkSubpassDescription2 moonvulkan_znewchainVkSubpassDescription2
 VkSubpassDescription2* znewchainVkSubpassDescription2(lua_State *L, int *err);
 #define znewchainarrayVkSubpassDescription2 moonvulkan_znewchainarrayVkSubpassDescription2
@@ -2397,6 +2817,8 @@ VkSubpassDescription2* znewchainarrayVkSubpassDescription2(lua_State *L, uint32_
 VkSubpassDescription2* zcheckVkSubpassDescription2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSubpassDescription2 moonvulkan_zcheckarrayVkSubpassDescription2
 VkSubpassDescription2* zcheckarrayVkSubpassDescription2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSubpassDescription2 moonvulkan_zcheckarraybufVkSubpassDescription2
+VkSubpassDescription2* zcheckarraybufVkSubpassDescription2(lua_State *L, int arg, VkSubpassDescription2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSubpassDescription2 moonvulkan_zinitVkSubpassDescription2
 int zinitVkSubpassDescription2(lua_State *L, VkSubpassDescription2* p, int *err);
 #define zfreeVkSubpassDescription2(L, p, base) zfree((L), (p), (base))
@@ -2406,6 +2828,7 @@ int zpushVkSubpassDescription2(lua_State *L, const VkSubpassDescription2 *p);
 
 #define znewVkSubpassDependency2(L, err) (VkSubpassDependency2*)znew((L), VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2, sizeof(VkSubpassDependency2), (err))
 #define znewarrayVkSubpassDependency2(L, count, err) (VkSubpassDependency2*)znewarray((L), VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2, sizeof(VkSubpassDependency2), (count), (err))
+#define zinitarrayVkSubpassDependency2(p, count) (VkSubpassDependency2*)zinitarray((p), VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2, sizeof(VkSubpassDependency2), (count))
 #define znewchainVkSubpassDependency2 moonvulkan_znewchainVkSubpassDependency2
 VkSubpassDependency2* znewchainVkSubpassDependency2(lua_State *L, int *err);
 #define znewchainarrayVkSubpassDependency2 moonvulkan_znewchainarrayVkSubpassDependency2
@@ -2414,6 +2837,8 @@ VkSubpassDependency2* znewchainarrayVkSubpassDependency2(lua_State *L, uint32_t
 VkSubpassDependency2* zcheckVkSubpassDependency2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSubpassDependency2 moonvulkan_zcheckarrayVkSubpassDependency2
 VkSubpassDependency2* zcheckarrayVkSubpassDependency2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSubpassDependency2 moonvulkan_zcheckarraybufVkSubpassDependency2
+VkSubpassDependency2* zcheckarraybufVkSubpassDependency2(lua_State *L, int arg, VkSubpassDependency2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSubpassDependency2 moonvulkan_zinitVkSubpassDependency2
 int zinitVkSubpassDependency2(lua_State *L, VkSubpassDependency2* p, int *err);
 #define zfreeVkSubpassDependency2(L, p, base) zfree((L), (p), (base))
@@ -2423,6 +2848,7 @@ int zpushVkSubpassDependency2(lua_State *L, const VkSubpassDependency2 *p);
 
 #define znewVkRenderPassCreateInfo2(L, err) (VkRenderPassCreateInfo2*)znew((L), VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2, sizeof(VkRenderPassCreateInfo2), (err))
 #define znewarrayVkRenderPassCreateInfo2(L, count, err) (VkRenderPassCreateInfo2*)znewarray((L), VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2, sizeof(VkRenderPassCreateInfo2), (count), (err))
+#define zinitarrayVkRenderPassCreateInfo2(p, count) (VkRenderPassCreateInfo2*)zinitarray((p), VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2, sizeof(VkRenderPassCreateInfo2), (count))
 #define znewchainVkRenderPassCreateInfo2 moonvulkan_znewchainVkRenderPassCreateInfo2
 VkRenderPassCreateInfo2* znewchainVkRenderPassCreateInfo2(lua_State *L, int *err);
 #define znewchainarrayVkRenderPassCreateInfo2 moonvulkan_znewchainarrayVkRenderPassCreateInfo2
@@ -2431,6 +2857,8 @@ VkRenderPassCreateInfo2* znewchainarrayVkRenderPassCreateInfo2(lua_State *L, uin
 VkRenderPassCreateInfo2* zcheckVkRenderPassCreateInfo2(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRenderPassCreateInfo2 moonvulkan_zcheckarrayVkRenderPassCreateInfo2
 VkRenderPassCreateInfo2* zcheckarrayVkRenderPassCreateInfo2(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRenderPassCreateInfo2 moonvulkan_zcheckarraybufVkRenderPassCreateInfo2
+VkRenderPassCreateInfo2* zcheckarraybufVkRenderPassCreateInfo2(lua_State *L, int arg, VkRenderPassCreateInfo2 *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRenderPassCreateInfo2 moonvulkan_zinitVkRenderPassCreateInfo2
 int zinitVkRenderPassCreateInfo2(lua_State *L, VkRenderPassCreateInfo2* p, int *err);
 #define zfreeVkRenderPassCreateInfo2(L, p, base) zfree((L), (p), (base))
@@ -2440,6 +2868,7 @@ int zpushVkRenderPassCreateInfo2(lua_State *L, const VkRenderPassCreateInfo2 *p)
 
 #define znewVkSubpassBeginInfo(L, err) (VkSubpassBeginInfo*)znew((L), VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO, sizeof(VkSubpassBeginInfo), (err))
 #define znewarrayVkSubpassBeginInfo(L, count, err) (VkSubpassBeginInfo*)znewarray((L), VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO, sizeof(VkSubpassBeginInfo), (count), (err))
+#define zinitarrayVkSubpassBeginInfo(p, count) (VkSubpassBeginInfo*)zinitarray((p), VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO, sizeof(VkSubpassBeginInfo), (count))
 #define znewchainVkSubpassBeginInfo moonvulkan_znewchainVkSubpassBeginInfo
 VkSubpassBeginInfo* znewchainVkSubpassBeginInfo(lua_State *L, int *err);
 #define znewchainarrayVkSubpassBeginInfo moonvulkan_znewchainarrayVkSubpassBeginInfo
@@ -2448,6 +2877,8 @@ VkSubpassBeginInfo* znewchainarrayVkSubpassBeginInfo(lua_State *L, uint32_t coun
 VkSubpassBeginInfo* zcheckVkSubpassBeginInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSubpassBeginInfo moonvulkan_zcheckarrayVkSubpassBeginInfo
 VkSubpassBeginInfo* zcheckarrayVkSubpassBeginInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSubpassBeginInfo moonvulkan_zcheckarraybufVkSubpassBeginInfo
+VkSubpassBeginInfo* zcheckarraybufVkSubpassBeginInfo(lua_State *L, int arg, VkSubpassBeginInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSubpassBeginInfo moonvulkan_zinitVkSubpassBeginInfo
 int zinitVkSubpassBeginInfo(lua_State *L, VkSubpassBeginInfo* p, int *err);
 #define zfreeVkSubpassBeginInfo(L, p, base) zfree((L), (p), (base))
@@ -2457,6 +2888,7 @@ int zpushVkSubpassBeginInfo(lua_State *L, const VkSubpassBeginInfo *p);
 
 #define znewVkSubpassEndInfo(L, err) (VkSubpassEndInfo*)znew((L), VK_STRUCTURE_TYPE_SUBPASS_END_INFO, sizeof(VkSubpassEndInfo), (err))
 #define znewarrayVkSubpassEndInfo(L, count, err) (VkSubpassEndInfo*)znewarray((L), VK_STRUCTURE_TYPE_SUBPASS_END_INFO, sizeof(VkSubpassEndInfo), (count), (err))
+#define zinitarrayVkSubpassEndInfo(p, count) (VkSubpassEndInfo*)zinitarray((p), VK_STRUCTURE_TYPE_SUBPASS_END_INFO, sizeof(VkSubpassEndInfo), (count))
 #define znewchainVkSubpassEndInfo moonvulkan_znewchainVkSubpassEndInfo
 VkSubpassEndInfo* znewchainVkSubpassEndInfo(lua_State *L, int *err);
 #define znewchainarrayVkSubpassEndInfo moonvulkan_znewchainarrayVkSubpassEndInfo
@@ -2465,6 +2897,8 @@ VkSubpassEndInfo* znewchainarrayVkSubpassEndInfo(lua_State *L, uint32_t count, i
 VkSubpassEndInfo* zcheckVkSubpassEndInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSubpassEndInfo moonvulkan_zcheckarrayVkSubpassEndInfo
 VkSubpassEndInfo* zcheckarrayVkSubpassEndInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSubpassEndInfo moonvulkan_zcheckarraybufVkSubpassEndInfo
+VkSubpassEndInfo* zcheckarraybufVkSubpassEndInfo(lua_State *L, int arg, VkSubpassEndInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSubpassEndInfo moonvulkan_zinitVkSubpassEndInfo
 int zinitVkSubpassEndInfo(lua_State *L, VkSubpassEndInfo* p, int *err);
 #define zfreeVkSubpassEndInfo(L, p, base) zfree((L), (p), (base))
@@ -2474,6 +2908,7 @@ int zpushVkSubpassEndInfo(lua_State *L, const VkSubpassEndInfo *p);
 
 #define znewVkDisplayProperties2KHR(L, err) (VkDisplayProperties2KHR*)znew((L), VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR, sizeof(VkDisplayProperties2KHR), (err))
 #define znewarrayVkDisplayProperties2KHR(L, count, err) (VkDisplayProperties2KHR*)znewarray((L), VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR, sizeof(VkDisplayProperties2KHR), (count), (err))
+#define zinitarrayVkDisplayProperties2KHR(p, count) (VkDisplayProperties2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR, sizeof(VkDisplayProperties2KHR), (count))
 #define znewchainVkDisplayProperties2KHR moonvulkan_znewchainVkDisplayProperties2KHR
 VkDisplayProperties2KHR* znewchainVkDisplayProperties2KHR(lua_State *L, int *err);
 #define znewchainarrayVkDisplayProperties2KHR moonvulkan_znewchainarrayVkDisplayProperties2KHR
@@ -2482,6 +2917,8 @@ VkDisplayProperties2KHR* znewchainarrayVkDisplayProperties2KHR(lua_State *L, uin
 VkDisplayProperties2KHR* zcheckVkDisplayProperties2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayProperties2KHR moonvulkan_zcheckarrayVkDisplayProperties2KHR
 VkDisplayProperties2KHR* zcheckarrayVkDisplayProperties2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayProperties2KHR moonvulkan_zcheckarraybufVkDisplayProperties2KHR
+VkDisplayProperties2KHR* zcheckarraybufVkDisplayProperties2KHR(lua_State *L, int arg, VkDisplayProperties2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayProperties2KHR moonvulkan_zinitVkDisplayProperties2KHR
 int zinitVkDisplayProperties2KHR(lua_State *L, VkDisplayProperties2KHR* p, int *err);
 #define zfreeVkDisplayProperties2KHR(L, p, base) zfree((L), (p), (base))
@@ -2491,6 +2928,7 @@ int zpushVkDisplayProperties2KHR(lua_State *L, const VkDisplayProperties2KHR *p)
 
 #define znewVkDisplayPlaneProperties2KHR(L, err) (VkDisplayPlaneProperties2KHR*)znew((L), VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR, sizeof(VkDisplayPlaneProperties2KHR), (err))
 #define znewarrayVkDisplayPlaneProperties2KHR(L, count, err) (VkDisplayPlaneProperties2KHR*)znewarray((L), VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR, sizeof(VkDisplayPlaneProperties2KHR), (count), (err))
+#define zinitarrayVkDisplayPlaneProperties2KHR(p, count) (VkDisplayPlaneProperties2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR, sizeof(VkDisplayPlaneProperties2KHR), (count))
 #define znewchainVkDisplayPlaneProperties2KHR moonvulkan_znewchainVkDisplayPlaneProperties2KHR
 VkDisplayPlaneProperties2KHR* znewchainVkDisplayPlaneProperties2KHR(lua_State *L, int *err);
 #define znewchainarrayVkDisplayPlaneProperties2KHR moonvulkan_znewchainarrayVkDisplayPlaneProperties2KHR
@@ -2499,6 +2937,8 @@ VkDisplayPlaneProperties2KHR* znewchainarrayVkDisplayPlaneProperties2KHR(lua_Sta
 VkDisplayPlaneProperties2KHR* zcheckVkDisplayPlaneProperties2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayPlaneProperties2KHR moonvulkan_zcheckarrayVkDisplayPlaneProperties2KHR
 VkDisplayPlaneProperties2KHR* zcheckarrayVkDisplayPlaneProperties2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayPlaneProperties2KHR moonvulkan_zcheckarraybufVkDisplayPlaneProperties2KHR
+VkDisplayPlaneProperties2KHR* zcheckarraybufVkDisplayPlaneProperties2KHR(lua_State *L, int arg, VkDisplayPlaneProperties2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayPlaneProperties2KHR moonvulkan_zinitVkDisplayPlaneProperties2KHR
 int zinitVkDisplayPlaneProperties2KHR(lua_State *L, VkDisplayPlaneProperties2KHR* p, int *err);
 #define zfreeVkDisplayPlaneProperties2KHR(L, p, base) zfree((L), (p), (base))
@@ -2508,6 +2948,7 @@ int zpushVkDisplayPlaneProperties2KHR(lua_State *L, const VkDisplayPlaneProperti
 
 #define znewVkDisplayModeProperties2KHR(L, err) (VkDisplayModeProperties2KHR*)znew((L), VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR, sizeof(VkDisplayModeProperties2KHR), (err))
 #define znewarrayVkDisplayModeProperties2KHR(L, count, err) (VkDisplayModeProperties2KHR*)znewarray((L), VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR, sizeof(VkDisplayModeProperties2KHR), (count), (err))
+#define zinitarrayVkDisplayModeProperties2KHR(p, count) (VkDisplayModeProperties2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR, sizeof(VkDisplayModeProperties2KHR), (count))
 #define znewchainVkDisplayModeProperties2KHR moonvulkan_znewchainVkDisplayModeProperties2KHR
 VkDisplayModeProperties2KHR* znewchainVkDisplayModeProperties2KHR(lua_State *L, int *err);
 #define znewchainarrayVkDisplayModeProperties2KHR moonvulkan_znewchainarrayVkDisplayModeProperties2KHR
@@ -2516,6 +2957,8 @@ VkDisplayModeProperties2KHR* znewchainarrayVkDisplayModeProperties2KHR(lua_State
 VkDisplayModeProperties2KHR* zcheckVkDisplayModeProperties2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayModeProperties2KHR moonvulkan_zcheckarrayVkDisplayModeProperties2KHR
 VkDisplayModeProperties2KHR* zcheckarrayVkDisplayModeProperties2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayModeProperties2KHR moonvulkan_zcheckarraybufVkDisplayModeProperties2KHR
+VkDisplayModeProperties2KHR* zcheckarraybufVkDisplayModeProperties2KHR(lua_State *L, int arg, VkDisplayModeProperties2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayModeProperties2KHR moonvulkan_zinitVkDisplayModeProperties2KHR
 int zinitVkDisplayModeProperties2KHR(lua_State *L, VkDisplayModeProperties2KHR* p, int *err);
 #define zfreeVkDisplayModeProperties2KHR(L, p, base) zfree((L), (p), (base))
@@ -2525,6 +2968,7 @@ int zpushVkDisplayModeProperties2KHR(lua_State *L, const VkDisplayModeProperties
 
 #define znewVkDisplayPlaneCapabilities2KHR(L, err) (VkDisplayPlaneCapabilities2KHR*)znew((L), VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR, sizeof(VkDisplayPlaneCapabilities2KHR), (err))
 #define znewarrayVkDisplayPlaneCapabilities2KHR(L, count, err) (VkDisplayPlaneCapabilities2KHR*)znewarray((L), VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR, sizeof(VkDisplayPlaneCapabilities2KHR), (count), (err))
+#define zinitarrayVkDisplayPlaneCapabilities2KHR(p, count) (VkDisplayPlaneCapabilities2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR, sizeof(VkDisplayPlaneCapabilities2KHR), (count))
 #define znewchainVkDisplayPlaneCapabilities2KHR moonvulkan_znewchainVkDisplayPlaneCapabilities2KHR
 VkDisplayPlaneCapabilities2KHR* znewchainVkDisplayPlaneCapabilities2KHR(lua_State *L, int *err);
 #define znewchainarrayVkDisplayPlaneCapabilities2KHR moonvulkan_znewchainarrayVkDisplayPlaneCapabilities2KHR
@@ -2533,6 +2977,8 @@ VkDisplayPlaneCapabilities2KHR* znewchainarrayVkDisplayPlaneCapabilities2KHR(lua
 VkDisplayPlaneCapabilities2KHR* zcheckVkDisplayPlaneCapabilities2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayPlaneCapabilities2KHR moonvulkan_zcheckarrayVkDisplayPlaneCapabilities2KHR
 VkDisplayPlaneCapabilities2KHR* zcheckarrayVkDisplayPlaneCapabilities2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayPlaneCapabilities2KHR moonvulkan_zcheckarraybufVkDisplayPlaneCapabilities2KHR
+VkDisplayPlaneCapabilities2KHR* zcheckarraybufVkDisplayPlaneCapabilities2KHR(lua_State *L, int arg, VkDisplayPlaneCapabilities2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayPlaneCapabilities2KHR moonvulkan_zinitVkDisplayPlaneCapabilities2KHR
 int zinitVkDisplayPlaneCapabilities2KHR(lua_State *L, VkDisplayPlaneCapabilities2KHR* p, int *err);
 #define zfreeVkDisplayPlaneCapabilities2KHR(L, p, base) zfree((L), (p), (base))
@@ -2542,6 +2988,7 @@ int zpushVkDisplayPlaneCapabilities2KHR(lua_State *L, const VkDisplayPlaneCapabi
 
 #define znewVkDisplayPlaneInfo2KHR(L, err) (VkDisplayPlaneInfo2KHR*)znew((L), VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR, sizeof(VkDisplayPlaneInfo2KHR), (err))
 #define znewarrayVkDisplayPlaneInfo2KHR(L, count, err) (VkDisplayPlaneInfo2KHR*)znewarray((L), VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR, sizeof(VkDisplayPlaneInfo2KHR), (count), (err))
+#define zinitarrayVkDisplayPlaneInfo2KHR(p, count) (VkDisplayPlaneInfo2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR, sizeof(VkDisplayPlaneInfo2KHR), (count))
 #define znewchainVkDisplayPlaneInfo2KHR moonvulkan_znewchainVkDisplayPlaneInfo2KHR
 VkDisplayPlaneInfo2KHR* znewchainVkDisplayPlaneInfo2KHR(lua_State *L, int *err);
 #define znewchainarrayVkDisplayPlaneInfo2KHR moonvulkan_znewchainarrayVkDisplayPlaneInfo2KHR
@@ -2550,6 +2997,8 @@ VkDisplayPlaneInfo2KHR* znewchainarrayVkDisplayPlaneInfo2KHR(lua_State *L, uint3
 VkDisplayPlaneInfo2KHR* zcheckVkDisplayPlaneInfo2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayPlaneInfo2KHR moonvulkan_zcheckarrayVkDisplayPlaneInfo2KHR
 VkDisplayPlaneInfo2KHR* zcheckarrayVkDisplayPlaneInfo2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayPlaneInfo2KHR moonvulkan_zcheckarraybufVkDisplayPlaneInfo2KHR
+VkDisplayPlaneInfo2KHR* zcheckarraybufVkDisplayPlaneInfo2KHR(lua_State *L, int arg, VkDisplayPlaneInfo2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayPlaneInfo2KHR moonvulkan_zinitVkDisplayPlaneInfo2KHR
 int zinitVkDisplayPlaneInfo2KHR(lua_State *L, VkDisplayPlaneInfo2KHR* p, int *err);
 #define zfreeVkDisplayPlaneInfo2KHR(L, p, base) zfree((L), (p), (base))
@@ -2559,6 +3008,7 @@ int zpushVkDisplayPlaneInfo2KHR(lua_State *L, const VkDisplayPlaneInfo2KHR *p);
 
 #define znewVkDeviceGroupDeviceCreateInfoKHR(L, err) (VkDeviceGroupDeviceCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO_KHR, sizeof(VkDeviceGroupDeviceCreateInfoKHR), (err))
 #define znewarrayVkDeviceGroupDeviceCreateInfoKHR(L, count, err) (VkDeviceGroupDeviceCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO_KHR, sizeof(VkDeviceGroupDeviceCreateInfoKHR), (count), (err))
+#define zinitarrayVkDeviceGroupDeviceCreateInfoKHR(p, count) (VkDeviceGroupDeviceCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO_KHR, sizeof(VkDeviceGroupDeviceCreateInfoKHR), (count))
 #define znewchainVkDeviceGroupDeviceCreateInfoKHR moonvulkan_znewchainVkDeviceGroupDeviceCreateInfoKHR
 VkDeviceGroupDeviceCreateInfoKHR* znewchainVkDeviceGroupDeviceCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkDeviceGroupDeviceCreateInfoKHR moonvulkan_znewchainarrayVkDeviceGroupDeviceCreateInfoKHR
@@ -2567,6 +3017,8 @@ VkDeviceGroupDeviceCreateInfoKHR* znewchainarrayVkDeviceGroupDeviceCreateInfoKHR
 VkDeviceGroupDeviceCreateInfoKHR* zcheckVkDeviceGroupDeviceCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceGroupDeviceCreateInfoKHR moonvulkan_zcheckarrayVkDeviceGroupDeviceCreateInfoKHR
 VkDeviceGroupDeviceCreateInfoKHR* zcheckarrayVkDeviceGroupDeviceCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceGroupDeviceCreateInfoKHR moonvulkan_zcheckarraybufVkDeviceGroupDeviceCreateInfoKHR
+VkDeviceGroupDeviceCreateInfoKHR* zcheckarraybufVkDeviceGroupDeviceCreateInfoKHR(lua_State *L, int arg, VkDeviceGroupDeviceCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceGroupDeviceCreateInfoKHR moonvulkan_zinitVkDeviceGroupDeviceCreateInfoKHR
 int zinitVkDeviceGroupDeviceCreateInfoKHR(lua_State *L, VkDeviceGroupDeviceCreateInfoKHR* p, int *err);
 #define zfreeVkDeviceGroupDeviceCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2576,6 +3028,7 @@ int zpushVkDeviceGroupDeviceCreateInfoKHR(lua_State *L, const VkDeviceGroupDevic
 
 #define znewVkPhysicalDeviceGroupPropertiesKHR(L, err) (VkPhysicalDeviceGroupPropertiesKHR*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES_KHR, sizeof(VkPhysicalDeviceGroupPropertiesKHR), (err))
 #define znewarrayVkPhysicalDeviceGroupPropertiesKHR(L, count, err) (VkPhysicalDeviceGroupPropertiesKHR*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES_KHR, sizeof(VkPhysicalDeviceGroupPropertiesKHR), (count), (err))
+#define zinitarrayVkPhysicalDeviceGroupPropertiesKHR(p, count) (VkPhysicalDeviceGroupPropertiesKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES_KHR, sizeof(VkPhysicalDeviceGroupPropertiesKHR), (count))
 #define znewchainVkPhysicalDeviceGroupPropertiesKHR moonvulkan_znewchainVkPhysicalDeviceGroupPropertiesKHR
 VkPhysicalDeviceGroupPropertiesKHR* znewchainVkPhysicalDeviceGroupPropertiesKHR(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceGroupPropertiesKHR moonvulkan_znewchainarrayVkPhysicalDeviceGroupPropertiesKHR
@@ -2584,6 +3037,8 @@ VkPhysicalDeviceGroupPropertiesKHR* znewchainarrayVkPhysicalDeviceGroupPropertie
 VkPhysicalDeviceGroupPropertiesKHR* zcheckVkPhysicalDeviceGroupPropertiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceGroupPropertiesKHR moonvulkan_zcheckarrayVkPhysicalDeviceGroupPropertiesKHR
 VkPhysicalDeviceGroupPropertiesKHR* zcheckarrayVkPhysicalDeviceGroupPropertiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceGroupPropertiesKHR moonvulkan_zcheckarraybufVkPhysicalDeviceGroupPropertiesKHR
+VkPhysicalDeviceGroupPropertiesKHR* zcheckarraybufVkPhysicalDeviceGroupPropertiesKHR(lua_State *L, int arg, VkPhysicalDeviceGroupPropertiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceGroupPropertiesKHR moonvulkan_zinitVkPhysicalDeviceGroupPropertiesKHR
 int zinitVkPhysicalDeviceGroupPropertiesKHR(lua_State *L, VkPhysicalDeviceGroupPropertiesKHR* p, int *err);
 #define zfreeVkPhysicalDeviceGroupPropertiesKHR(L, p, base) zfree((L), (p), (base))
@@ -2593,6 +3048,7 @@ int zpushVkPhysicalDeviceGroupPropertiesKHR(lua_State *L, const VkPhysicalDevice
 
 #define znewVkMemoryAllocateFlagsInfoKHR(L, err) (VkMemoryAllocateFlagsInfoKHR*)znew((L), VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO_KHR, sizeof(VkMemoryAllocateFlagsInfoKHR), (err))
 #define znewarrayVkMemoryAllocateFlagsInfoKHR(L, count, err) (VkMemoryAllocateFlagsInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO_KHR, sizeof(VkMemoryAllocateFlagsInfoKHR), (count), (err))
+#define zinitarrayVkMemoryAllocateFlagsInfoKHR(p, count) (VkMemoryAllocateFlagsInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO_KHR, sizeof(VkMemoryAllocateFlagsInfoKHR), (count))
 #define znewchainVkMemoryAllocateFlagsInfoKHR moonvulkan_znewchainVkMemoryAllocateFlagsInfoKHR
 VkMemoryAllocateFlagsInfoKHR* znewchainVkMemoryAllocateFlagsInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkMemoryAllocateFlagsInfoKHR moonvulkan_znewchainarrayVkMemoryAllocateFlagsInfoKHR
@@ -2601,6 +3057,8 @@ VkMemoryAllocateFlagsInfoKHR* znewchainarrayVkMemoryAllocateFlagsInfoKHR(lua_Sta
 VkMemoryAllocateFlagsInfoKHR* zcheckVkMemoryAllocateFlagsInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryAllocateFlagsInfoKHR moonvulkan_zcheckarrayVkMemoryAllocateFlagsInfoKHR
 VkMemoryAllocateFlagsInfoKHR* zcheckarrayVkMemoryAllocateFlagsInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryAllocateFlagsInfoKHR moonvulkan_zcheckarraybufVkMemoryAllocateFlagsInfoKHR
+VkMemoryAllocateFlagsInfoKHR* zcheckarraybufVkMemoryAllocateFlagsInfoKHR(lua_State *L, int arg, VkMemoryAllocateFlagsInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryAllocateFlagsInfoKHR moonvulkan_zinitVkMemoryAllocateFlagsInfoKHR
 int zinitVkMemoryAllocateFlagsInfoKHR(lua_State *L, VkMemoryAllocateFlagsInfoKHR* p, int *err);
 #define zfreeVkMemoryAllocateFlagsInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2610,6 +3068,7 @@ int zpushVkMemoryAllocateFlagsInfoKHR(lua_State *L, const VkMemoryAllocateFlagsI
 
 #define znewVkDeviceGroupRenderPassBeginInfoKHR(L, err) (VkDeviceGroupRenderPassBeginInfoKHR*)znew((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO_KHR, sizeof(VkDeviceGroupRenderPassBeginInfoKHR), (err))
 #define znewarrayVkDeviceGroupRenderPassBeginInfoKHR(L, count, err) (VkDeviceGroupRenderPassBeginInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO_KHR, sizeof(VkDeviceGroupRenderPassBeginInfoKHR), (count), (err))
+#define zinitarrayVkDeviceGroupRenderPassBeginInfoKHR(p, count) (VkDeviceGroupRenderPassBeginInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO_KHR, sizeof(VkDeviceGroupRenderPassBeginInfoKHR), (count))
 #define znewchainVkDeviceGroupRenderPassBeginInfoKHR moonvulkan_znewchainVkDeviceGroupRenderPassBeginInfoKHR
 VkDeviceGroupRenderPassBeginInfoKHR* znewchainVkDeviceGroupRenderPassBeginInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkDeviceGroupRenderPassBeginInfoKHR moonvulkan_znewchainarrayVkDeviceGroupRenderPassBeginInfoKHR
@@ -2618,6 +3077,8 @@ VkDeviceGroupRenderPassBeginInfoKHR* znewchainarrayVkDeviceGroupRenderPassBeginI
 VkDeviceGroupRenderPassBeginInfoKHR* zcheckVkDeviceGroupRenderPassBeginInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceGroupRenderPassBeginInfoKHR moonvulkan_zcheckarrayVkDeviceGroupRenderPassBeginInfoKHR
 VkDeviceGroupRenderPassBeginInfoKHR* zcheckarrayVkDeviceGroupRenderPassBeginInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceGroupRenderPassBeginInfoKHR moonvulkan_zcheckarraybufVkDeviceGroupRenderPassBeginInfoKHR
+VkDeviceGroupRenderPassBeginInfoKHR* zcheckarraybufVkDeviceGroupRenderPassBeginInfoKHR(lua_State *L, int arg, VkDeviceGroupRenderPassBeginInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceGroupRenderPassBeginInfoKHR moonvulkan_zinitVkDeviceGroupRenderPassBeginInfoKHR
 int zinitVkDeviceGroupRenderPassBeginInfoKHR(lua_State *L, VkDeviceGroupRenderPassBeginInfoKHR* p, int *err);
 #define zfreeVkDeviceGroupRenderPassBeginInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2627,6 +3088,7 @@ int zpushVkDeviceGroupRenderPassBeginInfoKHR(lua_State *L, const VkDeviceGroupRe
 
 #define znewVkDeviceGroupCommandBufferBeginInfoKHR(L, err) (VkDeviceGroupCommandBufferBeginInfoKHR*)znew((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO_KHR, sizeof(VkDeviceGroupCommandBufferBeginInfoKHR), (err))
 #define znewarrayVkDeviceGroupCommandBufferBeginInfoKHR(L, count, err) (VkDeviceGroupCommandBufferBeginInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO_KHR, sizeof(VkDeviceGroupCommandBufferBeginInfoKHR), (count), (err))
+#define zinitarrayVkDeviceGroupCommandBufferBeginInfoKHR(p, count) (VkDeviceGroupCommandBufferBeginInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO_KHR, sizeof(VkDeviceGroupCommandBufferBeginInfoKHR), (count))
 #define znewchainVkDeviceGroupCommandBufferBeginInfoKHR moonvulkan_znewchainVkDeviceGroupCommandBufferBeginInfoKHR
 VkDeviceGroupCommandBufferBeginInfoKHR* znewchainVkDeviceGroupCommandBufferBeginInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkDeviceGroupCommandBufferBeginInfoKHR moonvulkan_znewchainarrayVkDeviceGroupCommandBufferBeginInfoKHR
@@ -2635,6 +3097,8 @@ VkDeviceGroupCommandBufferBeginInfoKHR* znewchainarrayVkDeviceGroupCommandBuffer
 VkDeviceGroupCommandBufferBeginInfoKHR* zcheckVkDeviceGroupCommandBufferBeginInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceGroupCommandBufferBeginInfoKHR moonvulkan_zcheckarrayVkDeviceGroupCommandBufferBeginInfoKHR
 VkDeviceGroupCommandBufferBeginInfoKHR* zcheckarrayVkDeviceGroupCommandBufferBeginInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceGroupCommandBufferBeginInfoKHR moonvulkan_zcheckarraybufVkDeviceGroupCommandBufferBeginInfoKHR
+VkDeviceGroupCommandBufferBeginInfoKHR* zcheckarraybufVkDeviceGroupCommandBufferBeginInfoKHR(lua_State *L, int arg, VkDeviceGroupCommandBufferBeginInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceGroupCommandBufferBeginInfoKHR moonvulkan_zinitVkDeviceGroupCommandBufferBeginInfoKHR
 int zinitVkDeviceGroupCommandBufferBeginInfoKHR(lua_State *L, VkDeviceGroupCommandBufferBeginInfoKHR* p, int *err);
 #define zfreeVkDeviceGroupCommandBufferBeginInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2644,6 +3108,7 @@ int zpushVkDeviceGroupCommandBufferBeginInfoKHR(lua_State *L, const VkDeviceGrou
 
 #define znewVkDeviceGroupSubmitInfoKHR(L, err) (VkDeviceGroupSubmitInfoKHR*)znew((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO_KHR, sizeof(VkDeviceGroupSubmitInfoKHR), (err))
 #define znewarrayVkDeviceGroupSubmitInfoKHR(L, count, err) (VkDeviceGroupSubmitInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO_KHR, sizeof(VkDeviceGroupSubmitInfoKHR), (count), (err))
+#define zinitarrayVkDeviceGroupSubmitInfoKHR(p, count) (VkDeviceGroupSubmitInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO_KHR, sizeof(VkDeviceGroupSubmitInfoKHR), (count))
 #define znewchainVkDeviceGroupSubmitInfoKHR moonvulkan_znewchainVkDeviceGroupSubmitInfoKHR
 VkDeviceGroupSubmitInfoKHR* znewchainVkDeviceGroupSubmitInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkDeviceGroupSubmitInfoKHR moonvulkan_znewchainarrayVkDeviceGroupSubmitInfoKHR
@@ -2652,6 +3117,8 @@ VkDeviceGroupSubmitInfoKHR* znewchainarrayVkDeviceGroupSubmitInfoKHR(lua_State *
 VkDeviceGroupSubmitInfoKHR* zcheckVkDeviceGroupSubmitInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceGroupSubmitInfoKHR moonvulkan_zcheckarrayVkDeviceGroupSubmitInfoKHR
 VkDeviceGroupSubmitInfoKHR* zcheckarrayVkDeviceGroupSubmitInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceGroupSubmitInfoKHR moonvulkan_zcheckarraybufVkDeviceGroupSubmitInfoKHR
+VkDeviceGroupSubmitInfoKHR* zcheckarraybufVkDeviceGroupSubmitInfoKHR(lua_State *L, int arg, VkDeviceGroupSubmitInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceGroupSubmitInfoKHR moonvulkan_zinitVkDeviceGroupSubmitInfoKHR
 int zinitVkDeviceGroupSubmitInfoKHR(lua_State *L, VkDeviceGroupSubmitInfoKHR* p, int *err);
 #define zfreeVkDeviceGroupSubmitInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2661,6 +3128,7 @@ int zpushVkDeviceGroupSubmitInfoKHR(lua_State *L, const VkDeviceGroupSubmitInfoK
 
 #define znewVkDeviceGroupBindSparseInfoKHR(L, err) (VkDeviceGroupBindSparseInfoKHR*)znew((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO_KHR, sizeof(VkDeviceGroupBindSparseInfoKHR), (err))
 #define znewarrayVkDeviceGroupBindSparseInfoKHR(L, count, err) (VkDeviceGroupBindSparseInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO_KHR, sizeof(VkDeviceGroupBindSparseInfoKHR), (count), (err))
+#define zinitarrayVkDeviceGroupBindSparseInfoKHR(p, count) (VkDeviceGroupBindSparseInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO_KHR, sizeof(VkDeviceGroupBindSparseInfoKHR), (count))
 #define znewchainVkDeviceGroupBindSparseInfoKHR moonvulkan_znewchainVkDeviceGroupBindSparseInfoKHR
 VkDeviceGroupBindSparseInfoKHR* znewchainVkDeviceGroupBindSparseInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkDeviceGroupBindSparseInfoKHR moonvulkan_znewchainarrayVkDeviceGroupBindSparseInfoKHR
@@ -2669,6 +3137,8 @@ VkDeviceGroupBindSparseInfoKHR* znewchainarrayVkDeviceGroupBindSparseInfoKHR(lua
 VkDeviceGroupBindSparseInfoKHR* zcheckVkDeviceGroupBindSparseInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceGroupBindSparseInfoKHR moonvulkan_zcheckarrayVkDeviceGroupBindSparseInfoKHR
 VkDeviceGroupBindSparseInfoKHR* zcheckarrayVkDeviceGroupBindSparseInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceGroupBindSparseInfoKHR moonvulkan_zcheckarraybufVkDeviceGroupBindSparseInfoKHR
+VkDeviceGroupBindSparseInfoKHR* zcheckarraybufVkDeviceGroupBindSparseInfoKHR(lua_State *L, int arg, VkDeviceGroupBindSparseInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceGroupBindSparseInfoKHR moonvulkan_zinitVkDeviceGroupBindSparseInfoKHR
 int zinitVkDeviceGroupBindSparseInfoKHR(lua_State *L, VkDeviceGroupBindSparseInfoKHR* p, int *err);
 #define zfreeVkDeviceGroupBindSparseInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2678,6 +3148,7 @@ int zpushVkDeviceGroupBindSparseInfoKHR(lua_State *L, const VkDeviceGroupBindSpa
 
 #define znewVkBindImageMemoryDeviceGroupInfoKHR(L, err) (VkBindImageMemoryDeviceGroupInfoKHR*)znew((L), VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO_KHR, sizeof(VkBindImageMemoryDeviceGroupInfoKHR), (err))
 #define znewarrayVkBindImageMemoryDeviceGroupInfoKHR(L, count, err) (VkBindImageMemoryDeviceGroupInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO_KHR, sizeof(VkBindImageMemoryDeviceGroupInfoKHR), (count), (err))
+#define zinitarrayVkBindImageMemoryDeviceGroupInfoKHR(p, count) (VkBindImageMemoryDeviceGroupInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO_KHR, sizeof(VkBindImageMemoryDeviceGroupInfoKHR), (count))
 #define znewchainVkBindImageMemoryDeviceGroupInfoKHR moonvulkan_znewchainVkBindImageMemoryDeviceGroupInfoKHR
 VkBindImageMemoryDeviceGroupInfoKHR* znewchainVkBindImageMemoryDeviceGroupInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkBindImageMemoryDeviceGroupInfoKHR moonvulkan_znewchainarrayVkBindImageMemoryDeviceGroupInfoKHR
@@ -2686,6 +3157,8 @@ VkBindImageMemoryDeviceGroupInfoKHR* znewchainarrayVkBindImageMemoryDeviceGroupI
 VkBindImageMemoryDeviceGroupInfoKHR* zcheckVkBindImageMemoryDeviceGroupInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBindImageMemoryDeviceGroupInfoKHR moonvulkan_zcheckarrayVkBindImageMemoryDeviceGroupInfoKHR
 VkBindImageMemoryDeviceGroupInfoKHR* zcheckarrayVkBindImageMemoryDeviceGroupInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBindImageMemoryDeviceGroupInfoKHR moonvulkan_zcheckarraybufVkBindImageMemoryDeviceGroupInfoKHR
+VkBindImageMemoryDeviceGroupInfoKHR* zcheckarraybufVkBindImageMemoryDeviceGroupInfoKHR(lua_State *L, int arg, VkBindImageMemoryDeviceGroupInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBindImageMemoryDeviceGroupInfoKHR moonvulkan_zinitVkBindImageMemoryDeviceGroupInfoKHR
 int zinitVkBindImageMemoryDeviceGroupInfoKHR(lua_State *L, VkBindImageMemoryDeviceGroupInfoKHR* p, int *err);
 #define zfreeVkBindImageMemoryDeviceGroupInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2695,6 +3168,7 @@ int zpushVkBindImageMemoryDeviceGroupInfoKHR(lua_State *L, const VkBindImageMemo
 
 #define znewVkBindBufferMemoryDeviceGroupInfoKHR(L, err) (VkBindBufferMemoryDeviceGroupInfoKHR*)znew((L), VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO_KHR, sizeof(VkBindBufferMemoryDeviceGroupInfoKHR), (err))
 #define znewarrayVkBindBufferMemoryDeviceGroupInfoKHR(L, count, err) (VkBindBufferMemoryDeviceGroupInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO_KHR, sizeof(VkBindBufferMemoryDeviceGroupInfoKHR), (count), (err))
+#define zinitarrayVkBindBufferMemoryDeviceGroupInfoKHR(p, count) (VkBindBufferMemoryDeviceGroupInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO_KHR, sizeof(VkBindBufferMemoryDeviceGroupInfoKHR), (count))
 #define znewchainVkBindBufferMemoryDeviceGroupInfoKHR moonvulkan_znewchainVkBindBufferMemoryDeviceGroupInfoKHR
 VkBindBufferMemoryDeviceGroupInfoKHR* znewchainVkBindBufferMemoryDeviceGroupInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkBindBufferMemoryDeviceGroupInfoKHR moonvulkan_znewchainarrayVkBindBufferMemoryDeviceGroupInfoKHR
@@ -2703,6 +3177,8 @@ VkBindBufferMemoryDeviceGroupInfoKHR* znewchainarrayVkBindBufferMemoryDeviceGrou
 VkBindBufferMemoryDeviceGroupInfoKHR* zcheckVkBindBufferMemoryDeviceGroupInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBindBufferMemoryDeviceGroupInfoKHR moonvulkan_zcheckarrayVkBindBufferMemoryDeviceGroupInfoKHR
 VkBindBufferMemoryDeviceGroupInfoKHR* zcheckarrayVkBindBufferMemoryDeviceGroupInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBindBufferMemoryDeviceGroupInfoKHR moonvulkan_zcheckarraybufVkBindBufferMemoryDeviceGroupInfoKHR
+VkBindBufferMemoryDeviceGroupInfoKHR* zcheckarraybufVkBindBufferMemoryDeviceGroupInfoKHR(lua_State *L, int arg, VkBindBufferMemoryDeviceGroupInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBindBufferMemoryDeviceGroupInfoKHR moonvulkan_zinitVkBindBufferMemoryDeviceGroupInfoKHR
 int zinitVkBindBufferMemoryDeviceGroupInfoKHR(lua_State *L, VkBindBufferMemoryDeviceGroupInfoKHR* p, int *err);
 #define zfreeVkBindBufferMemoryDeviceGroupInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2712,6 +3188,7 @@ int zpushVkBindBufferMemoryDeviceGroupInfoKHR(lua_State *L, const VkBindBufferMe
 
 #define znewVkImageSwapchainCreateInfoKHR(L, err) (VkImageSwapchainCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR, sizeof(VkImageSwapchainCreateInfoKHR), (err))
 #define znewarrayVkImageSwapchainCreateInfoKHR(L, count, err) (VkImageSwapchainCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR, sizeof(VkImageSwapchainCreateInfoKHR), (count), (err))
+#define zinitarrayVkImageSwapchainCreateInfoKHR(p, count) (VkImageSwapchainCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR, sizeof(VkImageSwapchainCreateInfoKHR), (count))
 #define znewchainVkImageSwapchainCreateInfoKHR moonvulkan_znewchainVkImageSwapchainCreateInfoKHR
 VkImageSwapchainCreateInfoKHR* znewchainVkImageSwapchainCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkImageSwapchainCreateInfoKHR moonvulkan_znewchainarrayVkImageSwapchainCreateInfoKHR
@@ -2720,6 +3197,8 @@ VkImageSwapchainCreateInfoKHR* znewchainarrayVkImageSwapchainCreateInfoKHR(lua_S
 VkImageSwapchainCreateInfoKHR* zcheckVkImageSwapchainCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageSwapchainCreateInfoKHR moonvulkan_zcheckarrayVkImageSwapchainCreateInfoKHR
 VkImageSwapchainCreateInfoKHR* zcheckarrayVkImageSwapchainCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageSwapchainCreateInfoKHR moonvulkan_zcheckarraybufVkImageSwapchainCreateInfoKHR
+VkImageSwapchainCreateInfoKHR* zcheckarraybufVkImageSwapchainCreateInfoKHR(lua_State *L, int arg, VkImageSwapchainCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageSwapchainCreateInfoKHR moonvulkan_zinitVkImageSwapchainCreateInfoKHR
 int zinitVkImageSwapchainCreateInfoKHR(lua_State *L, VkImageSwapchainCreateInfoKHR* p, int *err);
 #define zfreeVkImageSwapchainCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2729,6 +3208,7 @@ int zpushVkImageSwapchainCreateInfoKHR(lua_State *L, const VkImageSwapchainCreat
 
 #define znewVkBindImageMemorySwapchainInfoKHR(L, err) (VkBindImageMemorySwapchainInfoKHR*)znew((L), VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR, sizeof(VkBindImageMemorySwapchainInfoKHR), (err))
 #define znewarrayVkBindImageMemorySwapchainInfoKHR(L, count, err) (VkBindImageMemorySwapchainInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR, sizeof(VkBindImageMemorySwapchainInfoKHR), (count), (err))
+#define zinitarrayVkBindImageMemorySwapchainInfoKHR(p, count) (VkBindImageMemorySwapchainInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR, sizeof(VkBindImageMemorySwapchainInfoKHR), (count))
 #define znewchainVkBindImageMemorySwapchainInfoKHR moonvulkan_znewchainVkBindImageMemorySwapchainInfoKHR
 VkBindImageMemorySwapchainInfoKHR* znewchainVkBindImageMemorySwapchainInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkBindImageMemorySwapchainInfoKHR moonvulkan_znewchainarrayVkBindImageMemorySwapchainInfoKHR
@@ -2737,6 +3217,8 @@ VkBindImageMemorySwapchainInfoKHR* znewchainarrayVkBindImageMemorySwapchainInfoK
 VkBindImageMemorySwapchainInfoKHR* zcheckVkBindImageMemorySwapchainInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBindImageMemorySwapchainInfoKHR moonvulkan_zcheckarrayVkBindImageMemorySwapchainInfoKHR
 VkBindImageMemorySwapchainInfoKHR* zcheckarrayVkBindImageMemorySwapchainInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBindImageMemorySwapchainInfoKHR moonvulkan_zcheckarraybufVkBindImageMemorySwapchainInfoKHR
+VkBindImageMemorySwapchainInfoKHR* zcheckarraybufVkBindImageMemorySwapchainInfoKHR(lua_State *L, int arg, VkBindImageMemorySwapchainInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBindImageMemorySwapchainInfoKHR moonvulkan_zinitVkBindImageMemorySwapchainInfoKHR
 int zinitVkBindImageMemorySwapchainInfoKHR(lua_State *L, VkBindImageMemorySwapchainInfoKHR* p, int *err);
 #define zfreeVkBindImageMemorySwapchainInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2746,6 +3228,7 @@ int zpushVkBindImageMemorySwapchainInfoKHR(lua_State *L, const VkBindImageMemory
 
 #define znewVkDeviceGroupSwapchainCreateInfoKHR(L, err) (VkDeviceGroupSwapchainCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR, sizeof(VkDeviceGroupSwapchainCreateInfoKHR), (err))
 #define znewarrayVkDeviceGroupSwapchainCreateInfoKHR(L, count, err) (VkDeviceGroupSwapchainCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR, sizeof(VkDeviceGroupSwapchainCreateInfoKHR), (count), (err))
+#define zinitarrayVkDeviceGroupSwapchainCreateInfoKHR(p, count) (VkDeviceGroupSwapchainCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR, sizeof(VkDeviceGroupSwapchainCreateInfoKHR), (count))
 #define znewchainVkDeviceGroupSwapchainCreateInfoKHR moonvulkan_znewchainVkDeviceGroupSwapchainCreateInfoKHR
 VkDeviceGroupSwapchainCreateInfoKHR* znewchainVkDeviceGroupSwapchainCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkDeviceGroupSwapchainCreateInfoKHR moonvulkan_znewchainarrayVkDeviceGroupSwapchainCreateInfoKHR
@@ -2754,6 +3237,8 @@ VkDeviceGroupSwapchainCreateInfoKHR* znewchainarrayVkDeviceGroupSwapchainCreateI
 VkDeviceGroupSwapchainCreateInfoKHR* zcheckVkDeviceGroupSwapchainCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceGroupSwapchainCreateInfoKHR moonvulkan_zcheckarrayVkDeviceGroupSwapchainCreateInfoKHR
 VkDeviceGroupSwapchainCreateInfoKHR* zcheckarrayVkDeviceGroupSwapchainCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceGroupSwapchainCreateInfoKHR moonvulkan_zcheckarraybufVkDeviceGroupSwapchainCreateInfoKHR
+VkDeviceGroupSwapchainCreateInfoKHR* zcheckarraybufVkDeviceGroupSwapchainCreateInfoKHR(lua_State *L, int arg, VkDeviceGroupSwapchainCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceGroupSwapchainCreateInfoKHR moonvulkan_zinitVkDeviceGroupSwapchainCreateInfoKHR
 int zinitVkDeviceGroupSwapchainCreateInfoKHR(lua_State *L, VkDeviceGroupSwapchainCreateInfoKHR* p, int *err);
 #define zfreeVkDeviceGroupSwapchainCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2763,6 +3248,7 @@ int zpushVkDeviceGroupSwapchainCreateInfoKHR(lua_State *L, const VkDeviceGroupSw
 
 #define znewVkDeviceGroupPresentInfoKHR(L, err) (VkDeviceGroupPresentInfoKHR*)znew((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR, sizeof(VkDeviceGroupPresentInfoKHR), (err))
 #define znewarrayVkDeviceGroupPresentInfoKHR(L, count, err) (VkDeviceGroupPresentInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR, sizeof(VkDeviceGroupPresentInfoKHR), (count), (err))
+#define zinitarrayVkDeviceGroupPresentInfoKHR(p, count) (VkDeviceGroupPresentInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR, sizeof(VkDeviceGroupPresentInfoKHR), (count))
 #define znewchainVkDeviceGroupPresentInfoKHR moonvulkan_znewchainVkDeviceGroupPresentInfoKHR
 VkDeviceGroupPresentInfoKHR* znewchainVkDeviceGroupPresentInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkDeviceGroupPresentInfoKHR moonvulkan_znewchainarrayVkDeviceGroupPresentInfoKHR
@@ -2771,6 +3257,8 @@ VkDeviceGroupPresentInfoKHR* znewchainarrayVkDeviceGroupPresentInfoKHR(lua_State
 VkDeviceGroupPresentInfoKHR* zcheckVkDeviceGroupPresentInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceGroupPresentInfoKHR moonvulkan_zcheckarrayVkDeviceGroupPresentInfoKHR
 VkDeviceGroupPresentInfoKHR* zcheckarrayVkDeviceGroupPresentInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceGroupPresentInfoKHR moonvulkan_zcheckarraybufVkDeviceGroupPresentInfoKHR
+VkDeviceGroupPresentInfoKHR* zcheckarraybufVkDeviceGroupPresentInfoKHR(lua_State *L, int arg, VkDeviceGroupPresentInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceGroupPresentInfoKHR moonvulkan_zinitVkDeviceGroupPresentInfoKHR
 int zinitVkDeviceGroupPresentInfoKHR(lua_State *L, VkDeviceGroupPresentInfoKHR* p, int *err);
 #define zfreeVkDeviceGroupPresentInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2780,6 +3268,7 @@ int zpushVkDeviceGroupPresentInfoKHR(lua_State *L, const VkDeviceGroupPresentInf
 
 #define znewVkDeviceGroupPresentCapabilitiesKHR(L, err) (VkDeviceGroupPresentCapabilitiesKHR*)znew((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR, sizeof(VkDeviceGroupPresentCapabilitiesKHR), (err))
 #define znewarrayVkDeviceGroupPresentCapabilitiesKHR(L, count, err) (VkDeviceGroupPresentCapabilitiesKHR*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR, sizeof(VkDeviceGroupPresentCapabilitiesKHR), (count), (err))
+#define zinitarrayVkDeviceGroupPresentCapabilitiesKHR(p, count) (VkDeviceGroupPresentCapabilitiesKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR, sizeof(VkDeviceGroupPresentCapabilitiesKHR), (count))
 #define znewchainVkDeviceGroupPresentCapabilitiesKHR moonvulkan_znewchainVkDeviceGroupPresentCapabilitiesKHR
 VkDeviceGroupPresentCapabilitiesKHR* znewchainVkDeviceGroupPresentCapabilitiesKHR(lua_State *L, int *err);
 #define znewchainarrayVkDeviceGroupPresentCapabilitiesKHR moonvulkan_znewchainarrayVkDeviceGroupPresentCapabilitiesKHR
@@ -2788,6 +3277,8 @@ VkDeviceGroupPresentCapabilitiesKHR* znewchainarrayVkDeviceGroupPresentCapabilit
 VkDeviceGroupPresentCapabilitiesKHR* zcheckVkDeviceGroupPresentCapabilitiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceGroupPresentCapabilitiesKHR moonvulkan_zcheckarrayVkDeviceGroupPresentCapabilitiesKHR
 VkDeviceGroupPresentCapabilitiesKHR* zcheckarrayVkDeviceGroupPresentCapabilitiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceGroupPresentCapabilitiesKHR moonvulkan_zcheckarraybufVkDeviceGroupPresentCapabilitiesKHR
+VkDeviceGroupPresentCapabilitiesKHR* zcheckarraybufVkDeviceGroupPresentCapabilitiesKHR(lua_State *L, int arg, VkDeviceGroupPresentCapabilitiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceGroupPresentCapabilitiesKHR moonvulkan_zinitVkDeviceGroupPresentCapabilitiesKHR
 int zinitVkDeviceGroupPresentCapabilitiesKHR(lua_State *L, VkDeviceGroupPresentCapabilitiesKHR* p, int *err);
 #define zfreeVkDeviceGroupPresentCapabilitiesKHR(L, p, base) zfree((L), (p), (base))
@@ -2797,6 +3288,7 @@ int zpushVkDeviceGroupPresentCapabilitiesKHR(lua_State *L, const VkDeviceGroupPr
 
 #define znewVkAcquireNextImageInfoKHR(L, err) (VkAcquireNextImageInfoKHR*)znew((L), VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR, sizeof(VkAcquireNextImageInfoKHR), (err))
 #define znewarrayVkAcquireNextImageInfoKHR(L, count, err) (VkAcquireNextImageInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR, sizeof(VkAcquireNextImageInfoKHR), (count), (err))
+#define zinitarrayVkAcquireNextImageInfoKHR(p, count) (VkAcquireNextImageInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR, sizeof(VkAcquireNextImageInfoKHR), (count))
 #define znewchainVkAcquireNextImageInfoKHR moonvulkan_znewchainVkAcquireNextImageInfoKHR
 VkAcquireNextImageInfoKHR* znewchainVkAcquireNextImageInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkAcquireNextImageInfoKHR moonvulkan_znewchainarrayVkAcquireNextImageInfoKHR
@@ -2805,6 +3297,8 @@ VkAcquireNextImageInfoKHR* znewchainarrayVkAcquireNextImageInfoKHR(lua_State *L,
 VkAcquireNextImageInfoKHR* zcheckVkAcquireNextImageInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAcquireNextImageInfoKHR moonvulkan_zcheckarrayVkAcquireNextImageInfoKHR
 VkAcquireNextImageInfoKHR* zcheckarrayVkAcquireNextImageInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAcquireNextImageInfoKHR moonvulkan_zcheckarraybufVkAcquireNextImageInfoKHR
+VkAcquireNextImageInfoKHR* zcheckarraybufVkAcquireNextImageInfoKHR(lua_State *L, int arg, VkAcquireNextImageInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAcquireNextImageInfoKHR moonvulkan_zinitVkAcquireNextImageInfoKHR
 int zinitVkAcquireNextImageInfoKHR(lua_State *L, VkAcquireNextImageInfoKHR* p, int *err);
 #define zfreeVkAcquireNextImageInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -2814,6 +3308,7 @@ int zpushVkAcquireNextImageInfoKHR(lua_State *L, const VkAcquireNextImageInfoKHR
 
 #define znewVkImportMemoryHostPointerInfoEXT(L, err) (VkImportMemoryHostPointerInfoEXT*)znew((L), VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT, sizeof(VkImportMemoryHostPointerInfoEXT), (err))
 #define znewarrayVkImportMemoryHostPointerInfoEXT(L, count, err) (VkImportMemoryHostPointerInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT, sizeof(VkImportMemoryHostPointerInfoEXT), (count), (err))
+#define zinitarrayVkImportMemoryHostPointerInfoEXT(p, count) (VkImportMemoryHostPointerInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT, sizeof(VkImportMemoryHostPointerInfoEXT), (count))
 #define znewchainVkImportMemoryHostPointerInfoEXT moonvulkan_znewchainVkImportMemoryHostPointerInfoEXT
 VkImportMemoryHostPointerInfoEXT* znewchainVkImportMemoryHostPointerInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkImportMemoryHostPointerInfoEXT moonvulkan_znewchainarrayVkImportMemoryHostPointerInfoEXT
@@ -2822,6 +3317,8 @@ VkImportMemoryHostPointerInfoEXT* znewchainarrayVkImportMemoryHostPointerInfoEXT
 VkImportMemoryHostPointerInfoEXT* zcheckVkImportMemoryHostPointerInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImportMemoryHostPointerInfoEXT moonvulkan_zcheckarrayVkImportMemoryHostPointerInfoEXT
 VkImportMemoryHostPointerInfoEXT* zcheckarrayVkImportMemoryHostPointerInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImportMemoryHostPointerInfoEXT moonvulkan_zcheckarraybufVkImportMemoryHostPointerInfoEXT
+VkImportMemoryHostPointerInfoEXT* zcheckarraybufVkImportMemoryHostPointerInfoEXT(lua_State *L, int arg, VkImportMemoryHostPointerInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImportMemoryHostPointerInfoEXT moonvulkan_zinitVkImportMemoryHostPointerInfoEXT
 int zinitVkImportMemoryHostPointerInfoEXT(lua_State *L, VkImportMemoryHostPointerInfoEXT* p, int *err);
 #define zfreeVkImportMemoryHostPointerInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -2831,6 +3328,7 @@ int zpushVkImportMemoryHostPointerInfoEXT(lua_State *L, const VkImportMemoryHost
 
 #define znewVkCalibratedTimestampInfoEXT(L, err) (VkCalibratedTimestampInfoEXT*)znew((L), VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT, sizeof(VkCalibratedTimestampInfoEXT), (err))
 #define znewarrayVkCalibratedTimestampInfoEXT(L, count, err) (VkCalibratedTimestampInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT, sizeof(VkCalibratedTimestampInfoEXT), (count), (err))
+#define zinitarrayVkCalibratedTimestampInfoEXT(p, count) (VkCalibratedTimestampInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT, sizeof(VkCalibratedTimestampInfoEXT), (count))
 #define znewchainVkCalibratedTimestampInfoEXT moonvulkan_znewchainVkCalibratedTimestampInfoEXT
 VkCalibratedTimestampInfoEXT* znewchainVkCalibratedTimestampInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkCalibratedTimestampInfoEXT moonvulkan_znewchainarrayVkCalibratedTimestampInfoEXT
@@ -2839,6 +3337,8 @@ VkCalibratedTimestampInfoEXT* znewchainarrayVkCalibratedTimestampInfoEXT(lua_Sta
 VkCalibratedTimestampInfoEXT* zcheckVkCalibratedTimestampInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCalibratedTimestampInfoEXT moonvulkan_zcheckarrayVkCalibratedTimestampInfoEXT
 VkCalibratedTimestampInfoEXT* zcheckarrayVkCalibratedTimestampInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCalibratedTimestampInfoEXT moonvulkan_zcheckarraybufVkCalibratedTimestampInfoEXT
+VkCalibratedTimestampInfoEXT* zcheckarraybufVkCalibratedTimestampInfoEXT(lua_State *L, int arg, VkCalibratedTimestampInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCalibratedTimestampInfoEXT moonvulkan_zinitVkCalibratedTimestampInfoEXT
 int zinitVkCalibratedTimestampInfoEXT(lua_State *L, VkCalibratedTimestampInfoEXT* p, int *err);
 #define zfreeVkCalibratedTimestampInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -2848,6 +3348,7 @@ int zpushVkCalibratedTimestampInfoEXT(lua_State *L, const VkCalibratedTimestampI
 
 #define znewVkDrmFormatModifierPropertiesListEXT(L, err) (VkDrmFormatModifierPropertiesListEXT*)znew((L), VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT, sizeof(VkDrmFormatModifierPropertiesListEXT), (err))
 #define znewarrayVkDrmFormatModifierPropertiesListEXT(L, count, err) (VkDrmFormatModifierPropertiesListEXT*)znewarray((L), VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT, sizeof(VkDrmFormatModifierPropertiesListEXT), (count), (err))
+#define zinitarrayVkDrmFormatModifierPropertiesListEXT(p, count) (VkDrmFormatModifierPropertiesListEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT, sizeof(VkDrmFormatModifierPropertiesListEXT), (count))
 #define znewchainVkDrmFormatModifierPropertiesListEXT moonvulkan_znewchainVkDrmFormatModifierPropertiesListEXT
 VkDrmFormatModifierPropertiesListEXT* znewchainVkDrmFormatModifierPropertiesListEXT(lua_State *L, int *err);
 #define znewchainarrayVkDrmFormatModifierPropertiesListEXT moonvulkan_znewchainarrayVkDrmFormatModifierPropertiesListEXT
@@ -2856,6 +3357,8 @@ VkDrmFormatModifierPropertiesListEXT* znewchainarrayVkDrmFormatModifierPropertie
 VkDrmFormatModifierPropertiesListEXT* zcheckVkDrmFormatModifierPropertiesListEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDrmFormatModifierPropertiesListEXT moonvulkan_zcheckarrayVkDrmFormatModifierPropertiesListEXT
 VkDrmFormatModifierPropertiesListEXT* zcheckarrayVkDrmFormatModifierPropertiesListEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDrmFormatModifierPropertiesListEXT moonvulkan_zcheckarraybufVkDrmFormatModifierPropertiesListEXT
+VkDrmFormatModifierPropertiesListEXT* zcheckarraybufVkDrmFormatModifierPropertiesListEXT(lua_State *L, int arg, VkDrmFormatModifierPropertiesListEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDrmFormatModifierPropertiesListEXT moonvulkan_zinitVkDrmFormatModifierPropertiesListEXT
 int zinitVkDrmFormatModifierPropertiesListEXT(lua_State *L, VkDrmFormatModifierPropertiesListEXT* p, int *err);
 #define zfreeVkDrmFormatModifierPropertiesListEXT(L, p, base) zfree((L), (p), (base))
@@ -2865,6 +3368,7 @@ int zpushVkDrmFormatModifierPropertiesListEXT(lua_State *L, const VkDrmFormatMod
 
 #define znewVkPhysicalDeviceImageDrmFormatModifierInfoEXT(L, err) (VkPhysicalDeviceImageDrmFormatModifierInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT, sizeof(VkPhysicalDeviceImageDrmFormatModifierInfoEXT), (err))
 #define znewarrayVkPhysicalDeviceImageDrmFormatModifierInfoEXT(L, count, err) (VkPhysicalDeviceImageDrmFormatModifierInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT, sizeof(VkPhysicalDeviceImageDrmFormatModifierInfoEXT), (count), (err))
+#define zinitarrayVkPhysicalDeviceImageDrmFormatModifierInfoEXT(p, count) (VkPhysicalDeviceImageDrmFormatModifierInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT, sizeof(VkPhysicalDeviceImageDrmFormatModifierInfoEXT), (count))
 #define znewchainVkPhysicalDeviceImageDrmFormatModifierInfoEXT moonvulkan_znewchainVkPhysicalDeviceImageDrmFormatModifierInfoEXT
 VkPhysicalDeviceImageDrmFormatModifierInfoEXT* znewchainVkPhysicalDeviceImageDrmFormatModifierInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceImageDrmFormatModifierInfoEXT moonvulkan_znewchainarrayVkPhysicalDeviceImageDrmFormatModifierInfoEXT
@@ -2873,6 +3377,8 @@ VkPhysicalDeviceImageDrmFormatModifierInfoEXT* znewchainarrayVkPhysicalDeviceIma
 VkPhysicalDeviceImageDrmFormatModifierInfoEXT* zcheckVkPhysicalDeviceImageDrmFormatModifierInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceImageDrmFormatModifierInfoEXT moonvulkan_zcheckarrayVkPhysicalDeviceImageDrmFormatModifierInfoEXT
 VkPhysicalDeviceImageDrmFormatModifierInfoEXT* zcheckarrayVkPhysicalDeviceImageDrmFormatModifierInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceImageDrmFormatModifierInfoEXT moonvulkan_zcheckarraybufVkPhysicalDeviceImageDrmFormatModifierInfoEXT
+VkPhysicalDeviceImageDrmFormatModifierInfoEXT* zcheckarraybufVkPhysicalDeviceImageDrmFormatModifierInfoEXT(lua_State *L, int arg, VkPhysicalDeviceImageDrmFormatModifierInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceImageDrmFormatModifierInfoEXT moonvulkan_zinitVkPhysicalDeviceImageDrmFormatModifierInfoEXT
 int zinitVkPhysicalDeviceImageDrmFormatModifierInfoEXT(lua_State *L, VkPhysicalDeviceImageDrmFormatModifierInfoEXT* p, int *err);
 #define zfreeVkPhysicalDeviceImageDrmFormatModifierInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -2882,6 +3388,7 @@ int zpushVkPhysicalDeviceImageDrmFormatModifierInfoEXT(lua_State *L, const VkPhy
 
 #define znewVkImageDrmFormatModifierListCreateInfoEXT(L, err) (VkImageDrmFormatModifierListCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT, sizeof(VkImageDrmFormatModifierListCreateInfoEXT), (err))
 #define znewarrayVkImageDrmFormatModifierListCreateInfoEXT(L, count, err) (VkImageDrmFormatModifierListCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT, sizeof(VkImageDrmFormatModifierListCreateInfoEXT), (count), (err))
+#define zinitarrayVkImageDrmFormatModifierListCreateInfoEXT(p, count) (VkImageDrmFormatModifierListCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT, sizeof(VkImageDrmFormatModifierListCreateInfoEXT), (count))
 #define znewchainVkImageDrmFormatModifierListCreateInfoEXT moonvulkan_znewchainVkImageDrmFormatModifierListCreateInfoEXT
 VkImageDrmFormatModifierListCreateInfoEXT* znewchainVkImageDrmFormatModifierListCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkImageDrmFormatModifierListCreateInfoEXT moonvulkan_znewchainarrayVkImageDrmFormatModifierListCreateInfoEXT
@@ -2890,6 +3397,8 @@ VkImageDrmFormatModifierListCreateInfoEXT* znewchainarrayVkImageDrmFormatModifie
 VkImageDrmFormatModifierListCreateInfoEXT* zcheckVkImageDrmFormatModifierListCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageDrmFormatModifierListCreateInfoEXT moonvulkan_zcheckarrayVkImageDrmFormatModifierListCreateInfoEXT
 VkImageDrmFormatModifierListCreateInfoEXT* zcheckarrayVkImageDrmFormatModifierListCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageDrmFormatModifierListCreateInfoEXT moonvulkan_zcheckarraybufVkImageDrmFormatModifierListCreateInfoEXT
+VkImageDrmFormatModifierListCreateInfoEXT* zcheckarraybufVkImageDrmFormatModifierListCreateInfoEXT(lua_State *L, int arg, VkImageDrmFormatModifierListCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageDrmFormatModifierListCreateInfoEXT moonvulkan_zinitVkImageDrmFormatModifierListCreateInfoEXT
 int zinitVkImageDrmFormatModifierListCreateInfoEXT(lua_State *L, VkImageDrmFormatModifierListCreateInfoEXT* p, int *err);
 #define zfreeVkImageDrmFormatModifierListCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -2899,6 +3408,7 @@ int zpushVkImageDrmFormatModifierListCreateInfoEXT(lua_State *L, const VkImageDr
 
 #define znewVkImageDrmFormatModifierExplicitCreateInfoEXT(L, err) (VkImageDrmFormatModifierExplicitCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT, sizeof(VkImageDrmFormatModifierExplicitCreateInfoEXT), (err))
 #define znewarrayVkImageDrmFormatModifierExplicitCreateInfoEXT(L, count, err) (VkImageDrmFormatModifierExplicitCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT, sizeof(VkImageDrmFormatModifierExplicitCreateInfoEXT), (count), (err))
+#define zinitarrayVkImageDrmFormatModifierExplicitCreateInfoEXT(p, count) (VkImageDrmFormatModifierExplicitCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT, sizeof(VkImageDrmFormatModifierExplicitCreateInfoEXT), (count))
 #define znewchainVkImageDrmFormatModifierExplicitCreateInfoEXT moonvulkan_znewchainVkImageDrmFormatModifierExplicitCreateInfoEXT
 VkImageDrmFormatModifierExplicitCreateInfoEXT* znewchainVkImageDrmFormatModifierExplicitCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkImageDrmFormatModifierExplicitCreateInfoEXT moonvulkan_znewchainarrayVkImageDrmFormatModifierExplicitCreateInfoEXT
@@ -2907,6 +3417,8 @@ VkImageDrmFormatModifierExplicitCreateInfoEXT* znewchainarrayVkImageDrmFormatMod
 VkImageDrmFormatModifierExplicitCreateInfoEXT* zcheckVkImageDrmFormatModifierExplicitCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageDrmFormatModifierExplicitCreateInfoEXT moonvulkan_zcheckarrayVkImageDrmFormatModifierExplicitCreateInfoEXT
 VkImageDrmFormatModifierExplicitCreateInfoEXT* zcheckarrayVkImageDrmFormatModifierExplicitCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageDrmFormatModifierExplicitCreateInfoEXT moonvulkan_zcheckarraybufVkImageDrmFormatModifierExplicitCreateInfoEXT
+VkImageDrmFormatModifierExplicitCreateInfoEXT* zcheckarraybufVkImageDrmFormatModifierExplicitCreateInfoEXT(lua_State *L, int arg, VkImageDrmFormatModifierExplicitCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageDrmFormatModifierExplicitCreateInfoEXT moonvulkan_zinitVkImageDrmFormatModifierExplicitCreateInfoEXT
 int zinitVkImageDrmFormatModifierExplicitCreateInfoEXT(lua_State *L, VkImageDrmFormatModifierExplicitCreateInfoEXT* p, int *err);
 #define zfreeVkImageDrmFormatModifierExplicitCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -2916,6 +3428,7 @@ int zpushVkImageDrmFormatModifierExplicitCreateInfoEXT(lua_State *L, const VkIma
 
 #define znewVkImageDrmFormatModifierPropertiesEXT(L, err) (VkImageDrmFormatModifierPropertiesEXT*)znew((L), VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT, sizeof(VkImageDrmFormatModifierPropertiesEXT), (err))
 #define znewarrayVkImageDrmFormatModifierPropertiesEXT(L, count, err) (VkImageDrmFormatModifierPropertiesEXT*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT, sizeof(VkImageDrmFormatModifierPropertiesEXT), (count), (err))
+#define zinitarrayVkImageDrmFormatModifierPropertiesEXT(p, count) (VkImageDrmFormatModifierPropertiesEXT*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT, sizeof(VkImageDrmFormatModifierPropertiesEXT), (count))
 #define znewchainVkImageDrmFormatModifierPropertiesEXT moonvulkan_znewchainVkImageDrmFormatModifierPropertiesEXT
 VkImageDrmFormatModifierPropertiesEXT* znewchainVkImageDrmFormatModifierPropertiesEXT(lua_State *L, int *err);
 #define znewchainarrayVkImageDrmFormatModifierPropertiesEXT moonvulkan_znewchainarrayVkImageDrmFormatModifierPropertiesEXT
@@ -2924,6 +3437,8 @@ VkImageDrmFormatModifierPropertiesEXT* znewchainarrayVkImageDrmFormatModifierPro
 VkImageDrmFormatModifierPropertiesEXT* zcheckVkImageDrmFormatModifierPropertiesEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageDrmFormatModifierPropertiesEXT moonvulkan_zcheckarrayVkImageDrmFormatModifierPropertiesEXT
 VkImageDrmFormatModifierPropertiesEXT* zcheckarrayVkImageDrmFormatModifierPropertiesEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageDrmFormatModifierPropertiesEXT moonvulkan_zcheckarraybufVkImageDrmFormatModifierPropertiesEXT
+VkImageDrmFormatModifierPropertiesEXT* zcheckarraybufVkImageDrmFormatModifierPropertiesEXT(lua_State *L, int arg, VkImageDrmFormatModifierPropertiesEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageDrmFormatModifierPropertiesEXT moonvulkan_zinitVkImageDrmFormatModifierPropertiesEXT
 int zinitVkImageDrmFormatModifierPropertiesEXT(lua_State *L, VkImageDrmFormatModifierPropertiesEXT* p, int *err);
 #define zfreeVkImageDrmFormatModifierPropertiesEXT(L, p, base) zfree((L), (p), (base))
@@ -2933,6 +3448,7 @@ int zpushVkImageDrmFormatModifierPropertiesEXT(lua_State *L, const VkImageDrmFor
 
 #define znewVkFramebufferAttachmentImageInfo(L, err) (VkFramebufferAttachmentImageInfo*)znew((L), VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO, sizeof(VkFramebufferAttachmentImageInfo), (err))
 #define znewarrayVkFramebufferAttachmentImageInfo(L, count, err) (VkFramebufferAttachmentImageInfo*)znewarray((L), VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO, sizeof(VkFramebufferAttachmentImageInfo), (count), (err))
+#define zinitarrayVkFramebufferAttachmentImageInfo(p, count) (VkFramebufferAttachmentImageInfo*)zinitarray((p), VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO, sizeof(VkFramebufferAttachmentImageInfo), (count))
 #define znewchainVkFramebufferAttachmentImageInfo moonvulkan_znewchainVkFramebufferAttachmentImageInfo
 VkFramebufferAttachmentImageInfo* znewchainVkFramebufferAttachmentImageInfo(lua_State *L, int *err);
 #define znewchainarrayVkFramebufferAttachmentImageInfo moonvulkan_znewchainarrayVkFramebufferAttachmentImageInfo
@@ -2941,6 +3457,8 @@ VkFramebufferAttachmentImageInfo* znewchainarrayVkFramebufferAttachmentImageInfo
 VkFramebufferAttachmentImageInfo* zcheckVkFramebufferAttachmentImageInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkFramebufferAttachmentImageInfo moonvulkan_zcheckarrayVkFramebufferAttachmentImageInfo
 VkFramebufferAttachmentImageInfo* zcheckarrayVkFramebufferAttachmentImageInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkFramebufferAttachmentImageInfo moonvulkan_zcheckarraybufVkFramebufferAttachmentImageInfo
+VkFramebufferAttachmentImageInfo* zcheckarraybufVkFramebufferAttachmentImageInfo(lua_State *L, int arg, VkFramebufferAttachmentImageInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkFramebufferAttachmentImageInfo moonvulkan_zinitVkFramebufferAttachmentImageInfo
 int zinitVkFramebufferAttachmentImageInfo(lua_State *L, VkFramebufferAttachmentImageInfo* p, int *err);
 #define zfreeVkFramebufferAttachmentImageInfo(L, p, base) zfree((L), (p), (base))
@@ -2950,6 +3468,7 @@ int zpushVkFramebufferAttachmentImageInfo(lua_State *L, const VkFramebufferAttac
 
 #define znewVkFramebufferAttachmentsCreateInfo(L, err) (VkFramebufferAttachmentsCreateInfo*)znew((L), VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO, sizeof(VkFramebufferAttachmentsCreateInfo), (err))
 #define znewarrayVkFramebufferAttachmentsCreateInfo(L, count, err) (VkFramebufferAttachmentsCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO, sizeof(VkFramebufferAttachmentsCreateInfo), (count), (err))
+#define zinitarrayVkFramebufferAttachmentsCreateInfo(p, count) (VkFramebufferAttachmentsCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO, sizeof(VkFramebufferAttachmentsCreateInfo), (count))
 #define znewchainVkFramebufferAttachmentsCreateInfo moonvulkan_znewchainVkFramebufferAttachmentsCreateInfo
 VkFramebufferAttachmentsCreateInfo* znewchainVkFramebufferAttachmentsCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkFramebufferAttachmentsCreateInfo moonvulkan_znewchainarrayVkFramebufferAttachmentsCreateInfo
@@ -2958,6 +3477,8 @@ VkFramebufferAttachmentsCreateInfo* znewchainarrayVkFramebufferAttachmentsCreate
 VkFramebufferAttachmentsCreateInfo* zcheckVkFramebufferAttachmentsCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkFramebufferAttachmentsCreateInfo moonvulkan_zcheckarrayVkFramebufferAttachmentsCreateInfo
 VkFramebufferAttachmentsCreateInfo* zcheckarrayVkFramebufferAttachmentsCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkFramebufferAttachmentsCreateInfo moonvulkan_zcheckarraybufVkFramebufferAttachmentsCreateInfo
+VkFramebufferAttachmentsCreateInfo* zcheckarraybufVkFramebufferAttachmentsCreateInfo(lua_State *L, int arg, VkFramebufferAttachmentsCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkFramebufferAttachmentsCreateInfo moonvulkan_zinitVkFramebufferAttachmentsCreateInfo
 int zinitVkFramebufferAttachmentsCreateInfo(lua_State *L, VkFramebufferAttachmentsCreateInfo* p, int *err);
 #define zfreeVkFramebufferAttachmentsCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -2967,6 +3488,7 @@ int zpushVkFramebufferAttachmentsCreateInfo(lua_State *L, const VkFramebufferAtt
 
 #define znewVkRenderPassAttachmentBeginInfo(L, err) (VkRenderPassAttachmentBeginInfo*)znew((L), VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO, sizeof(VkRenderPassAttachmentBeginInfo), (err))
 #define znewarrayVkRenderPassAttachmentBeginInfo(L, count, err) (VkRenderPassAttachmentBeginInfo*)znewarray((L), VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO, sizeof(VkRenderPassAttachmentBeginInfo), (count), (err))
+#define zinitarrayVkRenderPassAttachmentBeginInfo(p, count) (VkRenderPassAttachmentBeginInfo*)zinitarray((p), VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO, sizeof(VkRenderPassAttachmentBeginInfo), (count))
 #define znewchainVkRenderPassAttachmentBeginInfo moonvulkan_znewchainVkRenderPassAttachmentBeginInfo
 VkRenderPassAttachmentBeginInfo* znewchainVkRenderPassAttachmentBeginInfo(lua_State *L, int *err);
 #define znewchainarrayVkRenderPassAttachmentBeginInfo moonvulkan_znewchainarrayVkRenderPassAttachmentBeginInfo
@@ -2975,6 +3497,8 @@ VkRenderPassAttachmentBeginInfo* znewchainarrayVkRenderPassAttachmentBeginInfo(l
 VkRenderPassAttachmentBeginInfo* zcheckVkRenderPassAttachmentBeginInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRenderPassAttachmentBeginInfo moonvulkan_zcheckarrayVkRenderPassAttachmentBeginInfo
 VkRenderPassAttachmentBeginInfo* zcheckarrayVkRenderPassAttachmentBeginInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRenderPassAttachmentBeginInfo moonvulkan_zcheckarraybufVkRenderPassAttachmentBeginInfo
+VkRenderPassAttachmentBeginInfo* zcheckarraybufVkRenderPassAttachmentBeginInfo(lua_State *L, int arg, VkRenderPassAttachmentBeginInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRenderPassAttachmentBeginInfo moonvulkan_zinitVkRenderPassAttachmentBeginInfo
 int zinitVkRenderPassAttachmentBeginInfo(lua_State *L, VkRenderPassAttachmentBeginInfo* p, int *err);
 #define zfreeVkRenderPassAttachmentBeginInfo(L, p, base) zfree((L), (p), (base))
@@ -2984,6 +3508,7 @@ int zpushVkRenderPassAttachmentBeginInfo(lua_State *L, const VkRenderPassAttachm
 
 #define znewVkSubpassDescriptionDepthStencilResolve(L, err) (VkSubpassDescriptionDepthStencilResolve*)znew((L), VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE, sizeof(VkSubpassDescriptionDepthStencilResolve), (err))
 #define znewarrayVkSubpassDescriptionDepthStencilResolve(L, count, err) (VkSubpassDescriptionDepthStencilResolve*)znewarray((L), VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE, sizeof(VkSubpassDescriptionDepthStencilResolve), (count), (err))
+#define zinitarrayVkSubpassDescriptionDepthStencilResolve(p, count) (VkSubpassDescriptionDepthStencilResolve*)zinitarray((p), VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE, sizeof(VkSubpassDescriptionDepthStencilResolve), (count))
 #define znewchainVkSubpassDescriptionDepthStencilResolve moonvulkan_znewchainVkSubpassDescriptionDepthStencilResolve
 VkSubpassDescriptionDepthStencilResolve* znewchainVkSubpassDescriptionDepthStencilResolve(lua_State *L, int *err);
 #define znewchainarrayVkSubpassDescriptionDepthStencilResolve moonvulkan_znewchainarrayVkSubpassDescriptionDepthStencilResolve
@@ -2992,6 +3517,8 @@ VkSubpassDescriptionDepthStencilResolve* znewchainarrayVkSubpassDescriptionDepth
 VkSubpassDescriptionDepthStencilResolve* zcheckVkSubpassDescriptionDepthStencilResolve(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSubpassDescriptionDepthStencilResolve moonvulkan_zcheckarrayVkSubpassDescriptionDepthStencilResolve
 VkSubpassDescriptionDepthStencilResolve* zcheckarrayVkSubpassDescriptionDepthStencilResolve(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSubpassDescriptionDepthStencilResolve moonvulkan_zcheckarraybufVkSubpassDescriptionDepthStencilResolve
+VkSubpassDescriptionDepthStencilResolve* zcheckarraybufVkSubpassDescriptionDepthStencilResolve(lua_State *L, int arg, VkSubpassDescriptionDepthStencilResolve *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSubpassDescriptionDepthStencilResolve moonvulkan_zinitVkSubpassDescriptionDepthStencilResolve
 int zinitVkSubpassDescriptionDepthStencilResolve(lua_State *L, VkSubpassDescriptionDepthStencilResolve* p, int *err);
 #define zfreeVkSubpassDescriptionDepthStencilResolve(L, p, base) zfree((L), (p), (base))
@@ -3001,6 +3528,7 @@ int zpushVkSubpassDescriptionDepthStencilResolve(lua_State *L, const VkSubpassDe
 
 #define znewVkSurfaceProtectedCapabilitiesKHR(L, err) (VkSurfaceProtectedCapabilitiesKHR*)znew((L), VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR, sizeof(VkSurfaceProtectedCapabilitiesKHR), (err))
 #define znewarrayVkSurfaceProtectedCapabilitiesKHR(L, count, err) (VkSurfaceProtectedCapabilitiesKHR*)znewarray((L), VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR, sizeof(VkSurfaceProtectedCapabilitiesKHR), (count), (err))
+#define zinitarrayVkSurfaceProtectedCapabilitiesKHR(p, count) (VkSurfaceProtectedCapabilitiesKHR*)zinitarray((p), VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR, sizeof(VkSurfaceProtectedCapabilitiesKHR), (count))
 #define znewchainVkSurfaceProtectedCapabilitiesKHR moonvulkan_znewchainVkSurfaceProtectedCapabilitiesKHR
 VkSurfaceProtectedCapabilitiesKHR* znewchainVkSurfaceProtectedCapabilitiesKHR(lua_State *L, int *err);
 #define znewchainarrayVkSurfaceProtectedCapabilitiesKHR moonvulkan_znewchainarrayVkSurfaceProtectedCapabilitiesKHR
@@ -3009,6 +3537,8 @@ VkSurfaceProtectedCapabilitiesKHR* znewchainarrayVkSurfaceProtectedCapabilitiesK
 VkSurfaceProtectedCapabilitiesKHR* zcheckVkSurfaceProtectedCapabilitiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSurfaceProtectedCapabilitiesKHR moonvulkan_zcheckarrayVkSurfaceProtectedCapabilitiesKHR
 VkSurfaceProtectedCapabilitiesKHR* zcheckarrayVkSurfaceProtectedCapabilitiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSurfaceProtectedCapabilitiesKHR moonvulkan_zcheckarraybufVkSurfaceProtectedCapabilitiesKHR
+VkSurfaceProtectedCapabilitiesKHR* zcheckarraybufVkSurfaceProtectedCapabilitiesKHR(lua_State *L, int arg, VkSurfaceProtectedCapabilitiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSurfaceProtectedCapabilitiesKHR moonvulkan_zinitVkSurfaceProtectedCapabilitiesKHR
 int zinitVkSurfaceProtectedCapabilitiesKHR(lua_State *L, VkSurfaceProtectedCapabilitiesKHR* p, int *err);
 #define zfreeVkSurfaceProtectedCapabilitiesKHR(L, p, base) zfree((L), (p), (base))
@@ -3018,6 +3548,7 @@ int zpushVkSurfaceProtectedCapabilitiesKHR(lua_State *L, const VkSurfaceProtecte
 
 #define znewVkPipelineRasterizationDepthClipStateCreateInfoEXT(L, err) (VkPipelineRasterizationDepthClipStateCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationDepthClipStateCreateInfoEXT), (err))
 #define znewarrayVkPipelineRasterizationDepthClipStateCreateInfoEXT(L, count, err) (VkPipelineRasterizationDepthClipStateCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationDepthClipStateCreateInfoEXT), (count), (err))
+#define zinitarrayVkPipelineRasterizationDepthClipStateCreateInfoEXT(p, count) (VkPipelineRasterizationDepthClipStateCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationDepthClipStateCreateInfoEXT), (count))
 #define znewchainVkPipelineRasterizationDepthClipStateCreateInfoEXT moonvulkan_znewchainVkPipelineRasterizationDepthClipStateCreateInfoEXT
 VkPipelineRasterizationDepthClipStateCreateInfoEXT* znewchainVkPipelineRasterizationDepthClipStateCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPipelineRasterizationDepthClipStateCreateInfoEXT moonvulkan_znewchainarrayVkPipelineRasterizationDepthClipStateCreateInfoEXT
@@ -3026,6 +3557,8 @@ VkPipelineRasterizationDepthClipStateCreateInfoEXT* znewchainarrayVkPipelineRast
 VkPipelineRasterizationDepthClipStateCreateInfoEXT* zcheckVkPipelineRasterizationDepthClipStateCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineRasterizationDepthClipStateCreateInfoEXT moonvulkan_zcheckarrayVkPipelineRasterizationDepthClipStateCreateInfoEXT
 VkPipelineRasterizationDepthClipStateCreateInfoEXT* zcheckarrayVkPipelineRasterizationDepthClipStateCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineRasterizationDepthClipStateCreateInfoEXT moonvulkan_zcheckarraybufVkPipelineRasterizationDepthClipStateCreateInfoEXT
+VkPipelineRasterizationDepthClipStateCreateInfoEXT* zcheckarraybufVkPipelineRasterizationDepthClipStateCreateInfoEXT(lua_State *L, int arg, VkPipelineRasterizationDepthClipStateCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineRasterizationDepthClipStateCreateInfoEXT moonvulkan_zinitVkPipelineRasterizationDepthClipStateCreateInfoEXT
 int zinitVkPipelineRasterizationDepthClipStateCreateInfoEXT(lua_State *L, VkPipelineRasterizationDepthClipStateCreateInfoEXT* p, int *err);
 #define zfreeVkPipelineRasterizationDepthClipStateCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -3035,6 +3568,7 @@ int zpushVkPipelineRasterizationDepthClipStateCreateInfoEXT(lua_State *L, const
 
 #define znewVkPhysicalDeviceImageViewImageFormatInfoEXT(L, err) (VkPhysicalDeviceImageViewImageFormatInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT, sizeof(VkPhysicalDeviceImageViewImageFormatInfoEXT), (err))
 #define znewarrayVkPhysicalDeviceImageViewImageFormatInfoEXT(L, count, err) (VkPhysicalDeviceImageViewImageFormatInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT, sizeof(VkPhysicalDeviceImageViewImageFormatInfoEXT), (count), (err))
+#define zinitarrayVkPhysicalDeviceImageViewImageFormatInfoEXT(p, count) (VkPhysicalDeviceImageViewImageFormatInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT, sizeof(VkPhysicalDeviceImageViewImageFormatInfoEXT), (count))
 #define znewchainVkPhysicalDeviceImageViewImageFormatInfoEXT moonvulkan_znewchainVkPhysicalDeviceImageViewImageFormatInfoEXT
 VkPhysicalDeviceImageViewImageFormatInfoEXT* znewchainVkPhysicalDeviceImageViewImageFormatInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceImageViewImageFormatInfoEXT moonvulkan_znewchainarrayVkPhysicalDeviceImageViewImageFormatInfoEXT
@@ -3043,6 +3577,8 @@ VkPhysicalDeviceImageViewImageFormatInfoEXT* znewchainarrayVkPhysicalDeviceImage
 VkPhysicalDeviceImageViewImageFormatInfoEXT* zcheckVkPhysicalDeviceImageViewImageFormatInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceImageViewImageFormatInfoEXT moonvulkan_zcheckarrayVkPhysicalDeviceImageViewImageFormatInfoEXT
 VkPhysicalDeviceImageViewImageFormatInfoEXT* zcheckarrayVkPhysicalDeviceImageViewImageFormatInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceImageViewImageFormatInfoEXT moonvulkan_zcheckarraybufVkPhysicalDeviceImageViewImageFormatInfoEXT
+VkPhysicalDeviceImageViewImageFormatInfoEXT* zcheckarraybufVkPhysicalDeviceImageViewImageFormatInfoEXT(lua_State *L, int arg, VkPhysicalDeviceImageViewImageFormatInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceImageViewImageFormatInfoEXT moonvulkan_zinitVkPhysicalDeviceImageViewImageFormatInfoEXT
 int zinitVkPhysicalDeviceImageViewImageFormatInfoEXT(lua_State *L, VkPhysicalDeviceImageViewImageFormatInfoEXT* p, int *err);
 #define zfreeVkPhysicalDeviceImageViewImageFormatInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -3052,6 +3588,7 @@ int zpushVkPhysicalDeviceImageViewImageFormatInfoEXT(lua_State *L, const VkPhysi
 
 #define znewVkFilterCubicImageViewImageFormatPropertiesEXT(L, err) (VkFilterCubicImageViewImageFormatPropertiesEXT*)znew((L), VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT, sizeof(VkFilterCubicImageViewImageFormatPropertiesEXT), (err))
 #define znewarrayVkFilterCubicImageViewImageFormatPropertiesEXT(L, count, err) (VkFilterCubicImageViewImageFormatPropertiesEXT*)znewarray((L), VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT, sizeof(VkFilterCubicImageViewImageFormatPropertiesEXT), (count), (err))
+#define zinitarrayVkFilterCubicImageViewImageFormatPropertiesEXT(p, count) (VkFilterCubicImageViewImageFormatPropertiesEXT*)zinitarray((p), VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT, sizeof(VkFilterCubicImageViewImageFormatPropertiesEXT), (count))
 #define znewchainVkFilterCubicImageViewImageFormatPropertiesEXT moonvulkan_znewchainVkFilterCubicImageViewImageFormatPropertiesEXT
 VkFilterCubicImageViewImageFormatPropertiesEXT* znewchainVkFilterCubicImageViewImageFormatPropertiesEXT(lua_State *L, int *err);
 #define znewchainarrayVkFilterCubicImageViewImageFormatPropertiesEXT moonvulkan_znewchainarrayVkFilterCubicImageViewImageFormatPropertiesEXT
@@ -3060,6 +3597,8 @@ VkFilterCubicImageViewImageFormatPropertiesEXT* znewchainarrayVkFilterCubicImage
 VkFilterCubicImageViewImageFormatPropertiesEXT* zcheckVkFilterCubicImageViewImageFormatPropertiesEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkFilterCubicImageViewImageFormatPropertiesEXT moonvulkan_zcheckarrayVkFilterCubicImageViewImageFormatPropertiesEXT
 VkFilterCubicImageViewImageFormatPropertiesEXT* zcheckarrayVkFilterCubicImageViewImageFormatPropertiesEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkFilterCubicImageViewImageFormatPropertiesEXT moonvulkan_zcheckarraybufVkFilterCubicImageViewImageFormatPropertiesEXT
+VkFilterCubicImageViewImageFormatPropertiesEXT* zcheckarraybufVkFilterCubicImageViewImageFormatPropertiesEXT(lua_State *L, int arg, VkFilterCubicImageViewImageFormatPropertiesEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkFilterCubicImageViewImageFormatPropertiesEXT moonvulkan_zinitVkFilterCubicImageViewImageFormatPropertiesEXT
 int zinitVkFilterCubicImageViewImageFormatPropertiesEXT(lua_State *L, VkFilterCubicImageViewImageFormatPropertiesEXT* p, int *err);
 #define zfreeVkFilterCubicImageViewImageFormatPropertiesEXT(L, p, base) zfree((L), (p), (base))
@@ -3069,6 +3608,7 @@ int zpushVkFilterCubicImageViewImageFormatPropertiesEXT(lua_State *L, const VkFi
 
 #define znewVkPipelineCreationFeedbackCreateInfoEXT(L, err) (VkPipelineCreationFeedbackCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT, sizeof(VkPipelineCreationFeedbackCreateInfoEXT), (err))
 #define znewarrayVkPipelineCreationFeedbackCreateInfoEXT(L, count, err) (VkPipelineCreationFeedbackCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT, sizeof(VkPipelineCreationFeedbackCreateInfoEXT), (count), (err))
+#define zinitarrayVkPipelineCreationFeedbackCreateInfoEXT(p, count) (VkPipelineCreationFeedbackCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT, sizeof(VkPipelineCreationFeedbackCreateInfoEXT), (count))
 #define znewchainVkPipelineCreationFeedbackCreateInfoEXT moonvulkan_znewchainVkPipelineCreationFeedbackCreateInfoEXT
 VkPipelineCreationFeedbackCreateInfoEXT* znewchainVkPipelineCreationFeedbackCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPipelineCreationFeedbackCreateInfoEXT moonvulkan_znewchainarrayVkPipelineCreationFeedbackCreateInfoEXT
@@ -3077,6 +3617,8 @@ VkPipelineCreationFeedbackCreateInfoEXT* znewchainarrayVkPipelineCreationFeedbac
 VkPipelineCreationFeedbackCreateInfoEXT* zcheckVkPipelineCreationFeedbackCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineCreationFeedbackCreateInfoEXT moonvulkan_zcheckarrayVkPipelineCreationFeedbackCreateInfoEXT
 VkPipelineCreationFeedbackCreateInfoEXT* zcheckarrayVkPipelineCreationFeedbackCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineCreationFeedbackCreateInfoEXT moonvulkan_zcheckarraybufVkPipelineCreationFeedbackCreateInfoEXT
+VkPipelineCreationFeedbackCreateInfoEXT* zcheckarraybufVkPipelineCreationFeedbackCreateInfoEXT(lua_State *L, int arg, VkPipelineCreationFeedbackCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineCreationFeedbackCreateInfoEXT moonvulkan_zinitVkPipelineCreationFeedbackCreateInfoEXT
 int zinitVkPipelineCreationFeedbackCreateInfoEXT(lua_State *L, VkPipelineCreationFeedbackCreateInfoEXT* p, int *err);
 #define zfreeVkPipelineCreationFeedbackCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -3086,6 +3628,7 @@ int zpushVkPipelineCreationFeedbackCreateInfoEXT(lua_State *L, const VkPipelineC
 
 #define znewVkRenderPassFragmentDensityMapCreateInfoEXT(L, err) (VkRenderPassFragmentDensityMapCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT, sizeof(VkRenderPassFragmentDensityMapCreateInfoEXT), (err))
 #define znewarrayVkRenderPassFragmentDensityMapCreateInfoEXT(L, count, err) (VkRenderPassFragmentDensityMapCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT, sizeof(VkRenderPassFragmentDensityMapCreateInfoEXT), (count), (err))
+#define zinitarrayVkRenderPassFragmentDensityMapCreateInfoEXT(p, count) (VkRenderPassFragmentDensityMapCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT, sizeof(VkRenderPassFragmentDensityMapCreateInfoEXT), (count))
 #define znewchainVkRenderPassFragmentDensityMapCreateInfoEXT moonvulkan_znewchainVkRenderPassFragmentDensityMapCreateInfoEXT
 VkRenderPassFragmentDensityMapCreateInfoEXT* znewchainVkRenderPassFragmentDensityMapCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkRenderPassFragmentDensityMapCreateInfoEXT moonvulkan_znewchainarrayVkRenderPassFragmentDensityMapCreateInfoEXT
@@ -3094,6 +3637,8 @@ VkRenderPassFragmentDensityMapCreateInfoEXT* znewchainarrayVkRenderPassFragmentD
 VkRenderPassFragmentDensityMapCreateInfoEXT* zcheckVkRenderPassFragmentDensityMapCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRenderPassFragmentDensityMapCreateInfoEXT moonvulkan_zcheckarrayVkRenderPassFragmentDensityMapCreateInfoEXT
 VkRenderPassFragmentDensityMapCreateInfoEXT* zcheckarrayVkRenderPassFragmentDensityMapCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRenderPassFragmentDensityMapCreateInfoEXT moonvulkan_zcheckarraybufVkRenderPassFragmentDensityMapCreateInfoEXT
+VkRenderPassFragmentDensityMapCreateInfoEXT* zcheckarraybufVkRenderPassFragmentDensityMapCreateInfoEXT(lua_State *L, int arg, VkRenderPassFragmentDensityMapCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRenderPassFragmentDensityMapCreateInfoEXT moonvulkan_zinitVkRenderPassFragmentDensityMapCreateInfoEXT
 int zinitVkRenderPassFragmentDensityMapCreateInfoEXT(lua_State *L, VkRenderPassFragmentDensityMapCreateInfoEXT* p, int *err);
 #define zfreeVkRenderPassFragmentDensityMapCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -3103,6 +3648,7 @@ int zpushVkRenderPassFragmentDensityMapCreateInfoEXT(lua_State *L, const VkRende
 
 #define znewVkMemoryPriorityAllocateInfoEXT(L, err) (VkMemoryPriorityAllocateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT, sizeof(VkMemoryPriorityAllocateInfoEXT), (err))
 #define znewarrayVkMemoryPriorityAllocateInfoEXT(L, count, err) (VkMemoryPriorityAllocateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT, sizeof(VkMemoryPriorityAllocateInfoEXT), (count), (err))
+#define zinitarrayVkMemoryPriorityAllocateInfoEXT(p, count) (VkMemoryPriorityAllocateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT, sizeof(VkMemoryPriorityAllocateInfoEXT), (count))
 #define znewchainVkMemoryPriorityAllocateInfoEXT moonvulkan_znewchainVkMemoryPriorityAllocateInfoEXT
 VkMemoryPriorityAllocateInfoEXT* znewchainVkMemoryPriorityAllocateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkMemoryPriorityAllocateInfoEXT moonvulkan_znewchainarrayVkMemoryPriorityAllocateInfoEXT
@@ -3111,6 +3657,8 @@ VkMemoryPriorityAllocateInfoEXT* znewchainarrayVkMemoryPriorityAllocateInfoEXT(l
 VkMemoryPriorityAllocateInfoEXT* zcheckVkMemoryPriorityAllocateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryPriorityAllocateInfoEXT moonvulkan_zcheckarrayVkMemoryPriorityAllocateInfoEXT
 VkMemoryPriorityAllocateInfoEXT* zcheckarrayVkMemoryPriorityAllocateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryPriorityAllocateInfoEXT moonvulkan_zcheckarraybufVkMemoryPriorityAllocateInfoEXT
+VkMemoryPriorityAllocateInfoEXT* zcheckarraybufVkMemoryPriorityAllocateInfoEXT(lua_State *L, int arg, VkMemoryPriorityAllocateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryPriorityAllocateInfoEXT moonvulkan_zinitVkMemoryPriorityAllocateInfoEXT
 int zinitVkMemoryPriorityAllocateInfoEXT(lua_State *L, VkMemoryPriorityAllocateInfoEXT* p, int *err);
 #define zfreeVkMemoryPriorityAllocateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -3120,6 +3668,7 @@ int zpushVkMemoryPriorityAllocateInfoEXT(lua_State *L, const VkMemoryPriorityAll
 
 #define znewVkBufferDeviceAddressInfo(L, err) (VkBufferDeviceAddressInfo*)znew((L), VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, sizeof(VkBufferDeviceAddressInfo), (err))
 #define znewarrayVkBufferDeviceAddressInfo(L, count, err) (VkBufferDeviceAddressInfo*)znewarray((L), VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, sizeof(VkBufferDeviceAddressInfo), (count), (err))
+#define zinitarrayVkBufferDeviceAddressInfo(p, count) (VkBufferDeviceAddressInfo*)zinitarray((p), VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, sizeof(VkBufferDeviceAddressInfo), (count))
 #define znewchainVkBufferDeviceAddressInfo moonvulkan_znewchainVkBufferDeviceAddressInfo
 VkBufferDeviceAddressInfo* znewchainVkBufferDeviceAddressInfo(lua_State *L, int *err);
 #define znewchainarrayVkBufferDeviceAddressInfo moonvulkan_znewchainarrayVkBufferDeviceAddressInfo
@@ -3128,6 +3677,8 @@ VkBufferDeviceAddressInfo* znewchainarrayVkBufferDeviceAddressInfo(lua_State *L,
 VkBufferDeviceAddressInfo* zcheckVkBufferDeviceAddressInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBufferDeviceAddressInfo moonvulkan_zcheckarrayVkBufferDeviceAddressInfo
 VkBufferDeviceAddressInfo* zcheckarrayVkBufferDeviceAddressInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBufferDeviceAddressInfo moonvulkan_zcheckarraybufVkBufferDeviceAddressInfo
+VkBufferDeviceAddressInfo* zcheckarraybufVkBufferDeviceAddressInfo(lua_State *L, int arg, VkBufferDeviceAddressInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBufferDeviceAddressInfo moonvulkan_zinitVkBufferDeviceAddressInfo
 int zinitVkBufferDeviceAddressInfo(lua_State *L, VkBufferDeviceAddressInfo* p, int *err);
 #define zfreeVkBufferDeviceAddressInfo(L, p, base) zfree((L), (p), (base))
@@ -3137,6 +3688,7 @@ int zpushVkBufferDeviceAddressInfo(lua_State *L, const VkBufferDeviceAddressInfo
 
 #define znewVkImageStencilUsageCreateInfo(L, err) (VkImageStencilUsageCreateInfo*)znew((L), VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO, sizeof(VkImageStencilUsageCreateInfo), (err))
 #define znewarrayVkImageStencilUsageCreateInfo(L, count, err) (VkImageStencilUsageCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO, sizeof(VkImageStencilUsageCreateInfo), (count), (err))
+#define zinitarrayVkImageStencilUsageCreateInfo(p, count) (VkImageStencilUsageCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO, sizeof(VkImageStencilUsageCreateInfo), (count))
 #define znewchainVkImageStencilUsageCreateInfo moonvulkan_znewchainVkImageStencilUsageCreateInfo
 VkImageStencilUsageCreateInfo* znewchainVkImageStencilUsageCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkImageStencilUsageCreateInfo moonvulkan_znewchainarrayVkImageStencilUsageCreateInfo
@@ -3145,6 +3697,8 @@ VkImageStencilUsageCreateInfo* znewchainarrayVkImageStencilUsageCreateInfo(lua_S
 VkImageStencilUsageCreateInfo* zcheckVkImageStencilUsageCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageStencilUsageCreateInfo moonvulkan_zcheckarrayVkImageStencilUsageCreateInfo
 VkImageStencilUsageCreateInfo* zcheckarrayVkImageStencilUsageCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageStencilUsageCreateInfo moonvulkan_zcheckarraybufVkImageStencilUsageCreateInfo
+VkImageStencilUsageCreateInfo* zcheckarraybufVkImageStencilUsageCreateInfo(lua_State *L, int arg, VkImageStencilUsageCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageStencilUsageCreateInfo moonvulkan_zinitVkImageStencilUsageCreateInfo
 int zinitVkImageStencilUsageCreateInfo(lua_State *L, VkImageStencilUsageCreateInfo* p, int *err);
 #define zfreeVkImageStencilUsageCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -3154,6 +3708,7 @@ int zpushVkImageStencilUsageCreateInfo(lua_State *L, const VkImageStencilUsageCr
 
 #define znewVkValidationFeaturesEXT(L, err) (VkValidationFeaturesEXT*)znew((L), VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT, sizeof(VkValidationFeaturesEXT), (err))
 #define znewarrayVkValidationFeaturesEXT(L, count, err) (VkValidationFeaturesEXT*)znewarray((L), VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT, sizeof(VkValidationFeaturesEXT), (count), (err))
+#define zinitarrayVkValidationFeaturesEXT(p, count) (VkValidationFeaturesEXT*)zinitarray((p), VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT, sizeof(VkValidationFeaturesEXT), (count))
 #define znewchainVkValidationFeaturesEXT moonvulkan_znewchainVkValidationFeaturesEXT
 VkValidationFeaturesEXT* znewchainVkValidationFeaturesEXT(lua_State *L, int *err);
 #define znewchainarrayVkValidationFeaturesEXT moonvulkan_znewchainarrayVkValidationFeaturesEXT
@@ -3162,6 +3717,8 @@ VkValidationFeaturesEXT* znewchainarrayVkValidationFeaturesEXT(lua_State *L, uin
 VkValidationFeaturesEXT* zcheckVkValidationFeaturesEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkValidationFeaturesEXT moonvulkan_zcheckarrayVkValidationFeaturesEXT
 VkValidationFeaturesEXT* zcheckarrayVkValidationFeaturesEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkValidationFeaturesEXT moonvulkan_zcheckarraybufVkValidationFeaturesEXT
+VkValidationFeaturesEXT* zcheckarraybufVkValidationFeaturesEXT(lua_State *L, int arg, VkValidationFeaturesEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkValidationFeaturesEXT moonvulkan_zinitVkValidationFeaturesEXT
 int zinitVkValidationFeaturesEXT(lua_State *L, VkValidationFeaturesEXT* p, int *err);
 #define zfreeVkValidationFeaturesEXT(L, p, base) zfree((L), (p), (base))
@@ -3171,6 +3728,7 @@ int zpushVkValidationFeaturesEXT(lua_State *L, const VkValidationFeaturesEXT *p)
 
 #define znewVkHeadlessSurfaceCreateInfoEXT(L, err) (VkHeadlessSurfaceCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT, sizeof(VkHeadlessSurfaceCreateInfoEXT), (err))
 #define znewarrayVkHeadlessSurfaceCreateInfoEXT(L, count, err) (VkHeadlessSurfaceCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT, sizeof(VkHeadlessSurfaceCreateInfoEXT), (count), (err))
+#define zinitarrayVkHeadlessSurfaceCreateInfoEXT(p, count) (VkHeadlessSurfaceCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT, sizeof(VkHeadlessSurfaceCreateInfoEXT), (count))
 #define znewchainVkHeadlessSurfaceCreateInfoEXT moonvulkan_znewchainVkHeadlessSurfaceCreateInfoEXT
 VkHeadlessSurfaceCreateInfoEXT* znewchainVkHeadlessSurfaceCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkHeadlessSurfaceCreateInfoEXT moonvulkan_znewchainarrayVkHeadlessSurfaceCreateInfoEXT
@@ -3179,6 +3737,8 @@ VkHeadlessSurfaceCreateInfoEXT* znewchainarrayVkHeadlessSurfaceCreateInfoEXT(lua
 VkHeadlessSurfaceCreateInfoEXT* zcheckVkHeadlessSurfaceCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkHeadlessSurfaceCreateInfoEXT moonvulkan_zcheckarrayVkHeadlessSurfaceCreateInfoEXT
 VkHeadlessSurfaceCreateInfoEXT* zcheckarrayVkHeadlessSurfaceCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkHeadlessSurfaceCreateInfoEXT moonvulkan_zcheckarraybufVkHeadlessSurfaceCreateInfoEXT
+VkHeadlessSurfaceCreateInfoEXT* zcheckarraybufVkHeadlessSurfaceCreateInfoEXT(lua_State *L, int arg, VkHeadlessSurfaceCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkHeadlessSurfaceCreateInfoEXT moonvulkan_zinitVkHeadlessSurfaceCreateInfoEXT
 int zinitVkHeadlessSurfaceCreateInfoEXT(lua_State *L, VkHeadlessSurfaceCreateInfoEXT* p, int *err);
 #define zfreeVkHeadlessSurfaceCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -3188,6 +3748,7 @@ int zpushVkHeadlessSurfaceCreateInfoEXT(lua_State *L, const VkHeadlessSurfaceCre
 
 #define znewVkPerformanceCounterKHR(L, err) (VkPerformanceCounterKHR*)znew((L), VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_KHR, sizeof(VkPerformanceCounterKHR), (err))
 #define znewarrayVkPerformanceCounterKHR(L, count, err) (VkPerformanceCounterKHR*)znewarray((L), VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_KHR, sizeof(VkPerformanceCounterKHR), (count), (err))
+#define zinitarrayVkPerformanceCounterKHR(p, count) (VkPerformanceCounterKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_KHR, sizeof(VkPerformanceCounterKHR), (count))
 #define znewchainVkPerformanceCounterKHR moonvulkan_znewchainVkPerformanceCounterKHR
 VkPerformanceCounterKHR* znewchainVkPerformanceCounterKHR(lua_State *L, int *err);
 #define znewchainarrayVkPerformanceCounterKHR moonvulkan_znewchainarrayVkPerformanceCounterKHR
@@ -3196,6 +3757,8 @@ VkPerformanceCounterKHR* znewchainarrayVkPerformanceCounterKHR(lua_State *L, uin
 VkPerformanceCounterKHR* zcheckVkPerformanceCounterKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPerformanceCounterKHR moonvulkan_zcheckarrayVkPerformanceCounterKHR
 VkPerformanceCounterKHR* zcheckarrayVkPerformanceCounterKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPerformanceCounterKHR moonvulkan_zcheckarraybufVkPerformanceCounterKHR
+VkPerformanceCounterKHR* zcheckarraybufVkPerformanceCounterKHR(lua_State *L, int arg, VkPerformanceCounterKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPerformanceCounterKHR moonvulkan_zinitVkPerformanceCounterKHR
 int zinitVkPerformanceCounterKHR(lua_State *L, VkPerformanceCounterKHR* p, int *err);
 #define zfreeVkPerformanceCounterKHR(L, p, base) zfree((L), (p), (base))
@@ -3205,6 +3768,7 @@ int zpushVkPerformanceCounterKHR(lua_State *L, const VkPerformanceCounterKHR *p)
 
 #define znewVkPerformanceCounterDescriptionKHR(L, err) (VkPerformanceCounterDescriptionKHR*)znew((L), VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_DESCRIPTION_KHR, sizeof(VkPerformanceCounterDescriptionKHR), (err))
 #define znewarrayVkPerformanceCounterDescriptionKHR(L, count, err) (VkPerformanceCounterDescriptionKHR*)znewarray((L), VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_DESCRIPTION_KHR, sizeof(VkPerformanceCounterDescriptionKHR), (count), (err))
+#define zinitarrayVkPerformanceCounterDescriptionKHR(p, count) (VkPerformanceCounterDescriptionKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_DESCRIPTION_KHR, sizeof(VkPerformanceCounterDescriptionKHR), (count))
 #define znewchainVkPerformanceCounterDescriptionKHR moonvulkan_znewchainVkPerformanceCounterDescriptionKHR
 VkPerformanceCounterDescriptionKHR* znewchainVkPerformanceCounterDescriptionKHR(lua_State *L, int *err);
 #define znewchainarrayVkPerformanceCounterDescriptionKHR moonvulkan_znewchainarrayVkPerformanceCounterDescriptionKHR
@@ -3213,6 +3777,8 @@ VkPerformanceCounterDescriptionKHR* znewchainarrayVkPerformanceCounterDescriptio
 VkPerformanceCounterDescriptionKHR* zcheckVkPerformanceCounterDescriptionKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPerformanceCounterDescriptionKHR moonvulkan_zcheckarrayVkPerformanceCounterDescriptionKHR
 VkPerformanceCounterDescriptionKHR* zcheckarrayVkPerformanceCounterDescriptionKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPerformanceCounterDescriptionKHR moonvulkan_zcheckarraybufVkPerformanceCounterDescriptionKHR
+VkPerformanceCounterDescriptionKHR* zcheckarraybufVkPerformanceCounterDescriptionKHR(lua_State *L, int arg, VkPerformanceCounterDescriptionKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPerformanceCounterDescriptionKHR moonvulkan_zinitVkPerformanceCounterDescriptionKHR
 int zinitVkPerformanceCounterDescriptionKHR(lua_State *L, VkPerformanceCounterDescriptionKHR* p, int *err);
 #define zfreeVkPerformanceCounterDescriptionKHR(L, p, base) zfree((L), (p), (base))
@@ -3222,6 +3788,7 @@ int zpushVkPerformanceCounterDescriptionKHR(lua_State *L, const VkPerformanceCou
 
 #define znewVkQueryPoolPerformanceCreateInfoKHR(L, err) (VkQueryPoolPerformanceCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR, sizeof(VkQueryPoolPerformanceCreateInfoKHR), (err))
 #define znewarrayVkQueryPoolPerformanceCreateInfoKHR(L, count, err) (VkQueryPoolPerformanceCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR, sizeof(VkQueryPoolPerformanceCreateInfoKHR), (count), (err))
+#define zinitarrayVkQueryPoolPerformanceCreateInfoKHR(p, count) (VkQueryPoolPerformanceCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR, sizeof(VkQueryPoolPerformanceCreateInfoKHR), (count))
 #define znewchainVkQueryPoolPerformanceCreateInfoKHR moonvulkan_znewchainVkQueryPoolPerformanceCreateInfoKHR
 VkQueryPoolPerformanceCreateInfoKHR* znewchainVkQueryPoolPerformanceCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkQueryPoolPerformanceCreateInfoKHR moonvulkan_znewchainarrayVkQueryPoolPerformanceCreateInfoKHR
@@ -3230,6 +3797,8 @@ VkQueryPoolPerformanceCreateInfoKHR* znewchainarrayVkQueryPoolPerformanceCreateI
 VkQueryPoolPerformanceCreateInfoKHR* zcheckVkQueryPoolPerformanceCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkQueryPoolPerformanceCreateInfoKHR moonvulkan_zcheckarrayVkQueryPoolPerformanceCreateInfoKHR
 VkQueryPoolPerformanceCreateInfoKHR* zcheckarrayVkQueryPoolPerformanceCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkQueryPoolPerformanceCreateInfoKHR moonvulkan_zcheckarraybufVkQueryPoolPerformanceCreateInfoKHR
+VkQueryPoolPerformanceCreateInfoKHR* zcheckarraybufVkQueryPoolPerformanceCreateInfoKHR(lua_State *L, int arg, VkQueryPoolPerformanceCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkQueryPoolPerformanceCreateInfoKHR moonvulkan_zinitVkQueryPoolPerformanceCreateInfoKHR
 int zinitVkQueryPoolPerformanceCreateInfoKHR(lua_State *L, VkQueryPoolPerformanceCreateInfoKHR* p, int *err);
 #define zfreeVkQueryPoolPerformanceCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -3239,6 +3808,7 @@ int zpushVkQueryPoolPerformanceCreateInfoKHR(lua_State *L, const VkQueryPoolPerf
 
 #define znewVkAcquireProfilingLockInfoKHR(L, err) (VkAcquireProfilingLockInfoKHR*)znew((L), VK_STRUCTURE_TYPE_ACQUIRE_PROFILING_LOCK_INFO_KHR, sizeof(VkAcquireProfilingLockInfoKHR), (err))
 #define znewarrayVkAcquireProfilingLockInfoKHR(L, count, err) (VkAcquireProfilingLockInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_ACQUIRE_PROFILING_LOCK_INFO_KHR, sizeof(VkAcquireProfilingLockInfoKHR), (count), (err))
+#define zinitarrayVkAcquireProfilingLockInfoKHR(p, count) (VkAcquireProfilingLockInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_ACQUIRE_PROFILING_LOCK_INFO_KHR, sizeof(VkAcquireProfilingLockInfoKHR), (count))
 #define znewchainVkAcquireProfilingLockInfoKHR moonvulkan_znewchainVkAcquireProfilingLockInfoKHR
 VkAcquireProfilingLockInfoKHR* znewchainVkAcquireProfilingLockInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkAcquireProfilingLockInfoKHR moonvulkan_znewchainarrayVkAcquireProfilingLockInfoKHR
@@ -3247,6 +3817,8 @@ VkAcquireProfilingLockInfoKHR* znewchainarrayVkAcquireProfilingLockInfoKHR(lua_S
 VkAcquireProfilingLockInfoKHR* zcheckVkAcquireProfilingLockInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAcquireProfilingLockInfoKHR moonvulkan_zcheckarrayVkAcquireProfilingLockInfoKHR
 VkAcquireProfilingLockInfoKHR* zcheckarrayVkAcquireProfilingLockInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAcquireProfilingLockInfoKHR moonvulkan_zcheckarraybufVkAcquireProfilingLockInfoKHR
+VkAcquireProfilingLockInfoKHR* zcheckarraybufVkAcquireProfilingLockInfoKHR(lua_State *L, int arg, VkAcquireProfilingLockInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAcquireProfilingLockInfoKHR moonvulkan_zinitVkAcquireProfilingLockInfoKHR
 int zinitVkAcquireProfilingLockInfoKHR(lua_State *L, VkAcquireProfilingLockInfoKHR* p, int *err);
 #define zfreeVkAcquireProfilingLockInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -3256,6 +3828,7 @@ int zpushVkAcquireProfilingLockInfoKHR(lua_State *L, const VkAcquireProfilingLoc
 
 #define znewVkPerformanceQuerySubmitInfoKHR(L, err) (VkPerformanceQuerySubmitInfoKHR*)znew((L), VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR, sizeof(VkPerformanceQuerySubmitInfoKHR), (err))
 #define znewarrayVkPerformanceQuerySubmitInfoKHR(L, count, err) (VkPerformanceQuerySubmitInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR, sizeof(VkPerformanceQuerySubmitInfoKHR), (count), (err))
+#define zinitarrayVkPerformanceQuerySubmitInfoKHR(p, count) (VkPerformanceQuerySubmitInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR, sizeof(VkPerformanceQuerySubmitInfoKHR), (count))
 #define znewchainVkPerformanceQuerySubmitInfoKHR moonvulkan_znewchainVkPerformanceQuerySubmitInfoKHR
 VkPerformanceQuerySubmitInfoKHR* znewchainVkPerformanceQuerySubmitInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkPerformanceQuerySubmitInfoKHR moonvulkan_znewchainarrayVkPerformanceQuerySubmitInfoKHR
@@ -3264,6 +3837,8 @@ VkPerformanceQuerySubmitInfoKHR* znewchainarrayVkPerformanceQuerySubmitInfoKHR(l
 VkPerformanceQuerySubmitInfoKHR* zcheckVkPerformanceQuerySubmitInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPerformanceQuerySubmitInfoKHR moonvulkan_zcheckarrayVkPerformanceQuerySubmitInfoKHR
 VkPerformanceQuerySubmitInfoKHR* zcheckarrayVkPerformanceQuerySubmitInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPerformanceQuerySubmitInfoKHR moonvulkan_zcheckarraybufVkPerformanceQuerySubmitInfoKHR
+VkPerformanceQuerySubmitInfoKHR* zcheckarraybufVkPerformanceQuerySubmitInfoKHR(lua_State *L, int arg, VkPerformanceQuerySubmitInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPerformanceQuerySubmitInfoKHR moonvulkan_zinitVkPerformanceQuerySubmitInfoKHR
 int zinitVkPerformanceQuerySubmitInfoKHR(lua_State *L, VkPerformanceQuerySubmitInfoKHR* p, int *err);
 #define zfreeVkPerformanceQuerySubmitInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -3273,6 +3848,7 @@ int zpushVkPerformanceQuerySubmitInfoKHR(lua_State *L, const VkPerformanceQueryS
 
 #define znewVkSemaphoreTypeCreateInfo(L, err) (VkSemaphoreTypeCreateInfo*)znew((L), VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO, sizeof(VkSemaphoreTypeCreateInfo), (err))
 #define znewarrayVkSemaphoreTypeCreateInfo(L, count, err) (VkSemaphoreTypeCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO, sizeof(VkSemaphoreTypeCreateInfo), (count), (err))
+#define zinitarrayVkSemaphoreTypeCreateInfo(p, count) (VkSemaphoreTypeCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO, sizeof(VkSemaphoreTypeCreateInfo), (count))
 #define znewchainVkSemaphoreTypeCreateInfo moonvulkan_znewchainVkSemaphoreTypeCreateInfo
 VkSemaphoreTypeCreateInfo* znewchainVkSemaphoreTypeCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkSemaphoreTypeCreateInfo moonvulkan_znewchainarrayVkSemaphoreTypeCreateInfo
@@ -3281,6 +3857,8 @@ VkSemaphoreTypeCreateInfo* znewchainarrayVkSemaphoreTypeCreateInfo(lua_State *L,
 VkSemaphoreTypeCreateInfo* zcheckVkSemaphoreTypeCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSemaphoreTypeCreateInfo moonvulkan_zcheckarrayVkSemaphoreTypeCreateInfo
 VkSemaphoreTypeCreateInfo* zcheckarrayVkSemaphoreTypeCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSemaphoreTypeCreateInfo moonvulkan_zcheckarraybufVkSemaphoreTypeCreateInfo
+VkSemaphoreTypeCreateInfo* zcheckarraybufVkSemaphoreTypeCreateInfo(lua_State *L, int arg, VkSemaphoreTypeCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSemaphoreTypeCreateInfo moonvulkan_zinitVkSemaphoreTypeCreateInfo
 int zinitVkSemaphoreTypeCreateInfo(lua_State *L, VkSemaphoreTypeCreateInfo* p, int *err);
 #define zfreeVkSemaphoreTypeCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -3290,6 +3868,7 @@ int zpushVkSemaphoreTypeCreateInfo(lua_State *L, const VkSemaphoreTypeCreateInfo
 
 #define znewVkTimelineSemaphoreSubmitInfo(L, err) (VkTimelineSemaphoreSubmitInfo*)znew((L), VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO, sizeof(VkTimelineSemaphoreSubmitInfo), (err))
 #define znewarrayVkTimelineSemaphoreSubmitInfo(L, count, err) (VkTimelineSemaphoreSubmitInfo*)znewarray((L), VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO, sizeof(VkTimelineSemaphoreSubmitInfo), (count), (err))
+#define zinitarrayVkTimelineSemaphoreSubmitInfo(p, count) (VkTimelineSemaphoreSubmitInfo*)zinitarray((p), VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO, sizeof(VkTimelineSemaphoreSubmitInfo), (count))
 #define znewchainVkTimelineSemaphoreSubmitInfo moonvulkan_znewchainVkTimelineSemaphoreSubmitInfo
 VkTimelineSemaphoreSubmitInfo* znewchainVkTimelineSemaphoreSubmitInfo(lua_State *L, int *err);
 #define znewchainarrayVkTimelineSemaphoreSubmitInfo moonvulkan_znewchainarrayVkTimelineSemaphoreSubmitInfo
@@ -3298,6 +3877,8 @@ VkTimelineSemaphoreSubmitInfo* znewchainarrayVkTimelineSemaphoreSubmitInfo(lua_S
 VkTimelineSemaphoreSubmitInfo* zcheckVkTimelineSemaphoreSubmitInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkTimelineSemaphoreSubmitInfo moonvulkan_zcheckarrayVkTimelineSemaphoreSubmitInfo
 VkTimelineSemaphoreSubmitInfo* zcheckarrayVkTimelineSemaphoreSubmitInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkTimelineSemaphoreSubmitInfo moonvulkan_zcheckarraybufVkTimelineSemaphoreSubmitInfo
+VkTimelineSemaphoreSubmitInfo* zcheckarraybufVkTimelineSemaphoreSubmitInfo(lua_State *L, int arg, VkTimelineSemaphoreSubmitInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkTimelineSemaphoreSubmitInfo moonvulkan_zinitVkTimelineSemaphoreSubmitInfo
 int zinitVkTimelineSemaphoreSubmitInfo(lua_State *L, VkTimelineSemaphoreSubmitInfo* p, int *err);
 #define zfreeVkTimelineSemaphoreSubmitInfo(L, p, base) zfree((L), (p), (base))
@@ -3307,6 +3888,7 @@ int zpushVkTimelineSemaphoreSubmitInfo(lua_State *L, const VkTimelineSemaphoreSu
 
 #define znewVkSemaphoreWaitInfo(L, err) (VkSemaphoreWaitInfo*)znew((L), VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO, sizeof(VkSemaphoreWaitInfo), (err))
 #define znewarrayVkSemaphoreWaitInfo(L, count, err) (VkSemaphoreWaitInfo*)znewarray((L), VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO, sizeof(VkSemaphoreWaitInfo), (count), (err))
+#define zinitarrayVkSemaphoreWaitInfo(p, count) (VkSemaphoreWaitInfo*)zinitarray((p), VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO, sizeof(VkSemaphoreWaitInfo), (count))
 #define znewchainVkSemaphoreWaitInfo moonvulkan_znewchainVkSemaphoreWaitInfo
 VkSemaphoreWaitInfo* znewchainVkSemaphoreWaitInfo(lua_State *L, int *err);
 #define znewchainarrayVkSemaphoreWaitInfo moonvulkan_znewchainarrayVkSemaphoreWaitInfo
@@ -3315,6 +3897,8 @@ VkSemaphoreWaitInfo* znewchainarrayVkSemaphoreWaitInfo(lua_State *L, uint32_t co
 VkSemaphoreWaitInfo* zcheckVkSemaphoreWaitInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSemaphoreWaitInfo moonvulkan_zcheckarrayVkSemaphoreWaitInfo
 VkSemaphoreWaitInfo* zcheckarrayVkSemaphoreWaitInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSemaphoreWaitInfo moonvulkan_zcheckarraybufVkSemaphoreWaitInfo
+VkSemaphoreWaitInfo* zcheckarraybufVkSemaphoreWaitInfo(lua_State *L, int arg, VkSemaphoreWaitInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSemaphoreWaitInfo moonvulkan_zinitVkSemaphoreWaitInfo
 int zinitVkSemaphoreWaitInfo(lua_State *L, VkSemaphoreWaitInfo* p, int *err);
 #define zfreeVkSemaphoreWaitInfo(L, p, base) zfree((L), (p), (base))
@@ -3324,6 +3908,7 @@ int zpushVkSemaphoreWaitInfo(lua_State *L, const VkSemaphoreWaitInfo *p);
 
 #define znewVkSemaphoreSignalInfo(L, err) (VkSemaphoreSignalInfo*)znew((L), VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO, sizeof(VkSemaphoreSignalInfo), (err))
 #define znewarrayVkSemaphoreSignalInfo(L, count, err) (VkSemaphoreSignalInfo*)znewarray((L), VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO, sizeof(VkSemaphoreSignalInfo), (count), (err))
+#define zinitarrayVkSemaphoreSignalInfo(p, count) (VkSemaphoreSignalInfo*)zinitarray((p), VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO, sizeof(VkSemaphoreSignalInfo), (count))
 #define znewchainVkSemaphoreSignalInfo moonvulkan_znewchainVkSemaphoreSignalInfo
 VkSemaphoreSignalInfo* znewchainVkSemaphoreSignalInfo(lua_State *L, int *err);
 #define znewchainarrayVkSemaphoreSignalInfo moonvulkan_znewchainarrayVkSemaphoreSignalInfo
@@ -3332,6 +3917,8 @@ VkSemaphoreSignalInfo* znewchainarrayVkSemaphoreSignalInfo(lua_State *L, uint32_
 VkSemaphoreSignalInfo* zcheckVkSemaphoreSignalInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSemaphoreSignalInfo moonvulkan_zcheckarrayVkSemaphoreSignalInfo
 VkSemaphoreSignalInfo* zcheckarrayVkSemaphoreSignalInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSemaphoreSignalInfo moonvulkan_zcheckarraybufVkSemaphoreSignalInfo
+VkSemaphoreSignalInfo* zcheckarraybufVkSemaphoreSignalInfo(lua_State *L, int arg, VkSemaphoreSignalInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSemaphoreSignalInfo moonvulkan_zinitVkSemaphoreSignalInfo
 int zinitVkSemaphoreSignalInfo(lua_State *L, VkSemaphoreSignalInfo* p, int *err);
 #define zfreeVkSemaphoreSignalInfo(L, p, base) zfree((L), (p), (base))
@@ -3341,6 +3928,7 @@ int zpushVkSemaphoreSignalInfo(lua_State *L, const VkSemaphoreSignalInfo *p);
 
 #define znewVkFragmentShadingRateAttachmentInfoKHR(L, err) (VkFragmentShadingRateAttachmentInfoKHR*)znew((L), VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR, sizeof(VkFragmentShadingRateAttachmentInfoKHR), (err))
 #define znewarrayVkFragmentShadingRateAttachmentInfoKHR(L, count, err) (VkFragmentShadingRateAttachmentInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR, sizeof(VkFragmentShadingRateAttachmentInfoKHR), (count), (err))
+#define zinitarrayVkFragmentShadingRateAttachmentInfoKHR(p, count) (VkFragmentShadingRateAttachmentInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR, sizeof(VkFragmentShadingRateAttachmentInfoKHR), (count))
 #define znewchainVkFragmentShadingRateAttachmentInfoKHR moonvulkan_znewchainVkFragmentShadingRateAttachmentInfoKHR
 VkFragmentShadingRateAttachmentInfoKHR* znewchainVkFragmentShadingRateAttachmentInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkFragmentShadingRateAttachmentInfoKHR moonvulkan_znewchainarrayVkFragmentShadingRateAttachmentInfoKHR
@@ -3349,6 +3937,8 @@ VkFragmentShadingRateAttachmentInfoKHR* znewchainarrayVkFragmentShadingRateAttac
 VkFragmentShadingRateAttachmentInfoKHR* zcheckVkFragmentShadingRateAttachmentInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkFragmentShadingRateAttachmentInfoKHR moonvulkan_zcheckarrayVkFragmentShadingRateAttachmentInfoKHR
 VkFragmentShadingRateAttachmentInfoKHR* zcheckarrayVkFragmentShadingRateAttachmentInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkFragmentShadingRateAttachmentInfoKHR moonvulkan_zcheckarraybufVkFragmentShadingRateAttachmentInfoKHR
+VkFragmentShadingRateAttachmentInfoKHR* zcheckarraybufVkFragmentShadingRateAttachmentInfoKHR(lua_State *L, int arg, VkFragmentShadingRateAttachmentInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkFragmentShadingRateAttachmentInfoKHR moonvulkan_zinitVkFragmentShadingRateAttachmentInfoKHR
 int zinitVkFragmentShadingRateAttachmentInfoKHR(lua_State *L, VkFragmentShadingRateAttachmentInfoKHR* p, int *err);
 #define zfreeVkFragmentShadingRateAttachmentInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -3358,6 +3948,7 @@ int zpushVkFragmentShadingRateAttachmentInfoKHR(lua_State *L, const VkFragmentSh
 
 #define znewVkPipelineFragmentShadingRateStateCreateInfoKHR(L, err) (VkPipelineFragmentShadingRateStateCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR, sizeof(VkPipelineFragmentShadingRateStateCreateInfoKHR), (err))
 #define znewarrayVkPipelineFragmentShadingRateStateCreateInfoKHR(L, count, err) (VkPipelineFragmentShadingRateStateCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR, sizeof(VkPipelineFragmentShadingRateStateCreateInfoKHR), (count), (err))
+#define zinitarrayVkPipelineFragmentShadingRateStateCreateInfoKHR(p, count) (VkPipelineFragmentShadingRateStateCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR, sizeof(VkPipelineFragmentShadingRateStateCreateInfoKHR), (count))
 #define znewchainVkPipelineFragmentShadingRateStateCreateInfoKHR moonvulkan_znewchainVkPipelineFragmentShadingRateStateCreateInfoKHR
 VkPipelineFragmentShadingRateStateCreateInfoKHR* znewchainVkPipelineFragmentShadingRateStateCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkPipelineFragmentShadingRateStateCreateInfoKHR moonvulkan_znewchainarrayVkPipelineFragmentShadingRateStateCreateInfoKHR
@@ -3366,6 +3957,8 @@ VkPipelineFragmentShadingRateStateCreateInfoKHR* znewchainarrayVkPipelineFragmen
 VkPipelineFragmentShadingRateStateCreateInfoKHR* zcheckVkPipelineFragmentShadingRateStateCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineFragmentShadingRateStateCreateInfoKHR moonvulkan_zcheckarrayVkPipelineFragmentShadingRateStateCreateInfoKHR
 VkPipelineFragmentShadingRateStateCreateInfoKHR* zcheckarrayVkPipelineFragmentShadingRateStateCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineFragmentShadingRateStateCreateInfoKHR moonvulkan_zcheckarraybufVkPipelineFragmentShadingRateStateCreateInfoKHR
+VkPipelineFragmentShadingRateStateCreateInfoKHR* zcheckarraybufVkPipelineFragmentShadingRateStateCreateInfoKHR(lua_State *L, int arg, VkPipelineFragmentShadingRateStateCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineFragmentShadingRateStateCreateInfoKHR moonvulkan_zinitVkPipelineFragmentShadingRateStateCreateInfoKHR
 int zinitVkPipelineFragmentShadingRateStateCreateInfoKHR(lua_State *L, VkPipelineFragmentShadingRateStateCreateInfoKHR* p, int *err);
 #define zfreeVkPipelineFragmentShadingRateStateCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -3375,6 +3968,7 @@ int zpushVkPipelineFragmentShadingRateStateCreateInfoKHR(lua_State *L, const VkP
 
 #define znewVkPhysicalDeviceFragmentShadingRateKHR(L, err) (VkPhysicalDeviceFragmentShadingRateKHR*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_KHR, sizeof(VkPhysicalDeviceFragmentShadingRateKHR), (err))
 #define znewarrayVkPhysicalDeviceFragmentShadingRateKHR(L, count, err) (VkPhysicalDeviceFragmentShadingRateKHR*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_KHR, sizeof(VkPhysicalDeviceFragmentShadingRateKHR), (count), (err))
+#define zinitarrayVkPhysicalDeviceFragmentShadingRateKHR(p, count) (VkPhysicalDeviceFragmentShadingRateKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_KHR, sizeof(VkPhysicalDeviceFragmentShadingRateKHR), (count))
 #define znewchainVkPhysicalDeviceFragmentShadingRateKHR moonvulkan_znewchainVkPhysicalDeviceFragmentShadingRateKHR
 VkPhysicalDeviceFragmentShadingRateKHR* znewchainVkPhysicalDeviceFragmentShadingRateKHR(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceFragmentShadingRateKHR moonvulkan_znewchainarrayVkPhysicalDeviceFragmentShadingRateKHR
@@ -3383,6 +3977,8 @@ VkPhysicalDeviceFragmentShadingRateKHR* znewchainarrayVkPhysicalDeviceFragmentSh
 VkPhysicalDeviceFragmentShadingRateKHR* zcheckVkPhysicalDeviceFragmentShadingRateKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceFragmentShadingRateKHR moonvulkan_zcheckarrayVkPhysicalDeviceFragmentShadingRateKHR
 VkPhysicalDeviceFragmentShadingRateKHR* zcheckarrayVkPhysicalDeviceFragmentShadingRateKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceFragmentShadingRateKHR moonvulkan_zcheckarraybufVkPhysicalDeviceFragmentShadingRateKHR
+VkPhysicalDeviceFragmentShadingRateKHR* zcheckarraybufVkPhysicalDeviceFragmentShadingRateKHR(lua_State *L, int arg, VkPhysicalDeviceFragmentShadingRateKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceFragmentShadingRateKHR moonvulkan_zinitVkPhysicalDeviceFragmentShadingRateKHR
 int zinitVkPhysicalDeviceFragmentShadingRateKHR(lua_State *L, VkPhysicalDeviceFragmentShadingRateKHR* p, int *err);
 #define zfreeVkPhysicalDeviceFragmentShadingRateKHR(L, p, base) zfree((L), (p), (base))
@@ -3392,6 +3988,7 @@ int zpushVkPhysicalDeviceFragmentShadingRateKHR(lua_State *L, const VkPhysicalDe
 
 #define znewVkAttachmentReferenceStencilLayout(L, err) (VkAttachmentReferenceStencilLayout*)znew((L), VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT, sizeof(VkAttachmentReferenceStencilLayout), (err))
 #define znewarrayVkAttachmentReferenceStencilLayout(L, count, err) (VkAttachmentReferenceStencilLayout*)znewarray((L), VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT, sizeof(VkAttachmentReferenceStencilLayout), (count), (err))
+#define zinitarrayVkAttachmentReferenceStencilLayout(p, count) (VkAttachmentReferenceStencilLayout*)zinitarray((p), VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT, sizeof(VkAttachmentReferenceStencilLayout), (count))
 #define znewchainVkAttachmentReferenceStencilLayout moonvulkan_znewchainVkAttachmentReferenceStencilLayout
 VkAttachmentReferenceStencilLayout* znewchainVkAttachmentReferenceStencilLayout(lua_State *L, int *err);
 #define znewchainarrayVkAttachmentReferenceStencilLayout moonvulkan_znewchainarrayVkAttachmentReferenceStencilLayout
@@ -3400,6 +3997,8 @@ VkAttachmentReferenceStencilLayout* znewchainarrayVkAttachmentReferenceStencilLa
 VkAttachmentReferenceStencilLayout* zcheckVkAttachmentReferenceStencilLayout(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAttachmentReferenceStencilLayout moonvulkan_zcheckarrayVkAttachmentReferenceStencilLayout
 VkAttachmentReferenceStencilLayout* zcheckarrayVkAttachmentReferenceStencilLayout(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAttachmentReferenceStencilLayout moonvulkan_zcheckarraybufVkAttachmentReferenceStencilLayout
+VkAttachmentReferenceStencilLayout* zcheckarraybufVkAttachmentReferenceStencilLayout(lua_State *L, int arg, VkAttachmentReferenceStencilLayout *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAttachmentReferenceStencilLayout moonvulkan_zinitVkAttachmentReferenceStencilLayout
 int zinitVkAttachmentReferenceStencilLayout(lua_State *L, VkAttachmentReferenceStencilLayout* p, int *err);
 #define zfreeVkAttachmentReferenceStencilLayout(L, p, base) zfree((L), (p), (base))
@@ -3409,6 +4008,7 @@ int zpushVkAttachmentReferenceStencilLayout(lua_State *L, const VkAttachmentRefe
 
 #define znewVkAttachmentDescriptionStencilLayout(L, err) (VkAttachmentDescriptionStencilLayout*)znew((L), VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT, sizeof(VkAttachmentDescriptionStencilLayout), (err))
 #define znewarrayVkAttachmentDescriptionStencilLayout(L, count, err) (VkAttachmentDescriptionStencilLayout*)znewarray((L), VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT, sizeof(VkAttachmentDescriptionStencilLayout), (count), (err))
+#define zinitarrayVkAttachmentDescriptionStencilLayout(p, count) (VkAttachmentDescriptionStencilLayout*)zinitarray((p), VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT, sizeof(VkAttachmentDescriptionStencilLayout), (count))
 #define znewchainVkAttachmentDescriptionStencilLayout moonvulkan_znewchainVkAttachmentDescriptionStencilLayout
 VkAttachmentDescriptionStencilLayout* znewchainVkAttachmentDescriptionStencilLayout(lua_State *L, int *err);
 #define znewchainarrayVkAttachmentDescriptionStencilLayout moonvulkan_znewchainarrayVkAttachmentDescriptionStencilLayout
@@ -3417,6 +4017,8 @@ VkAttachmentDescriptionStencilLayout* znewchainarrayVkAttachmentDescriptionStenc
 VkAttachmentDescriptionStencilLayout* zcheckVkAttachmentDescriptionStencilLayout(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAttachmentDescriptionStencilLayout moonvulkan_zcheckarrayVkAttachmentDescriptionStencilLayout
 VkAttachmentDescriptionStencilLayout* zcheckarrayVkAttachmentDescriptionStencilLayout(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAttachmentDescriptionStencilLayout moonvulkan_zcheckarraybufVkAttachmentDescriptionStencilLayout
+VkAttachmentDescriptionStencilLayout* zcheckarraybufVkAttachmentDescriptionStencilLayout(lua_State *L, int arg, VkAttachmentDescriptionStencilLayout *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAttachmentDescriptionStencilLayout moonvulkan_zinitVkAttachmentDescriptionStencilLayout
 int zinitVkAttachmentDescriptionStencilLayout(lua_State *L, VkAttachmentDescriptionStencilLayout* p, int *err);
 #define zfreeVkAttachmentDescriptionStencilLayout(L, p, base) zfree((L), (p), (base))
@@ -3426,6 +4028,7 @@ int zpushVkAttachmentDescriptionStencilLayout(lua_State *L, const VkAttachmentDe
 
 #define znewVkBufferOpaqueCaptureAddressCreateInfo(L, err) (VkBufferOpaqueCaptureAddressCreateInfo*)znew((L), VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO, sizeof(VkBufferOpaqueCaptureAddressCreateInfo), (err))
 #define znewarrayVkBufferOpaqueCaptureAddressCreateInfo(L, count, err) (VkBufferOpaqueCaptureAddressCreateInfo*)znewarray((L), VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO, sizeof(VkBufferOpaqueCaptureAddressCreateInfo), (count), (err))
+#define zinitarrayVkBufferOpaqueCaptureAddressCreateInfo(p, count) (VkBufferOpaqueCaptureAddressCreateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO, sizeof(VkBufferOpaqueCaptureAddressCreateInfo), (count))
 #define znewchainVkBufferOpaqueCaptureAddressCreateInfo moonvulkan_znewchainVkBufferOpaqueCaptureAddressCreateInfo
 VkBufferOpaqueCaptureAddressCreateInfo* znewchainVkBufferOpaqueCaptureAddressCreateInfo(lua_State *L, int *err);
 #define znewchainarrayVkBufferOpaqueCaptureAddressCreateInfo moonvulkan_znewchainarrayVkBufferOpaqueCaptureAddressCreateInfo
@@ -3434,6 +4037,8 @@ VkBufferOpaqueCaptureAddressCreateInfo* znewchainarrayVkBufferOpaqueCaptureAddre
 VkBufferOpaqueCaptureAddressCreateInfo* zcheckVkBufferOpaqueCaptureAddressCreateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBufferOpaqueCaptureAddressCreateInfo moonvulkan_zcheckarrayVkBufferOpaqueCaptureAddressCreateInfo
 VkBufferOpaqueCaptureAddressCreateInfo* zcheckarrayVkBufferOpaqueCaptureAddressCreateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBufferOpaqueCaptureAddressCreateInfo moonvulkan_zcheckarraybufVkBufferOpaqueCaptureAddressCreateInfo
+VkBufferOpaqueCaptureAddressCreateInfo* zcheckarraybufVkBufferOpaqueCaptureAddressCreateInfo(lua_State *L, int arg, VkBufferOpaqueCaptureAddressCreateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBufferOpaqueCaptureAddressCreateInfo moonvulkan_zinitVkBufferOpaqueCaptureAddressCreateInfo
 int zinitVkBufferOpaqueCaptureAddressCreateInfo(lua_State *L, VkBufferOpaqueCaptureAddressCreateInfo* p, int *err);
 #define zfreeVkBufferOpaqueCaptureAddressCreateInfo(L, p, base) zfree((L), (p), (base))
@@ -3443,6 +4048,7 @@ int zpushVkBufferOpaqueCaptureAddressCreateInfo(lua_State *L, const VkBufferOpaq
 
 #define znewVkMemoryOpaqueCaptureAddressAllocateInfo(L, err) (VkMemoryOpaqueCaptureAddressAllocateInfo*)znew((L), VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO, sizeof(VkMemoryOpaqueCaptureAddressAllocateInfo), (err))
 #define znewarrayVkMemoryOpaqueCaptureAddressAllocateInfo(L, count, err) (VkMemoryOpaqueCaptureAddressAllocateInfo*)znewarray((L), VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO, sizeof(VkMemoryOpaqueCaptureAddressAllocateInfo), (count), (err))
+#define zinitarrayVkMemoryOpaqueCaptureAddressAllocateInfo(p, count) (VkMemoryOpaqueCaptureAddressAllocateInfo*)zinitarray((p), VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO, sizeof(VkMemoryOpaqueCaptureAddressAllocateInfo), (count))
 #define znewchainVkMemoryOpaqueCaptureAddressAllocateInfo moonvulkan_znewchainVkMemoryOpaqueCaptureAddressAllocateInfo
 VkMemoryOpaqueCaptureAddressAllocateInfo* znewchainVkMemoryOpaqueCaptureAddressAllocateInfo(lua_State *L, int *err);
 #define znewchainarrayVkMemoryOpaqueCaptureAddressAllocateInfo moonvulkan_znewchainarrayVkMemoryOpaqueCaptureAddressAllocateInfo
@@ -3451,6 +4057,8 @@ VkMemoryOpaqueCaptureAddressAllocateInfo* znewchainarrayVkMemoryOpaqueCaptureAdd
 VkMemoryOpaqueCaptureAddressAllocateInfo* zcheckVkMemoryOpaqueCaptureAddressAllocateInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryOpaqueCaptureAddressAllocateInfo moonvulkan_zcheckarrayVkMemoryOpaqueCaptureAddressAllocateInfo
 VkMemoryOpaqueCaptureAddressAllocateInfo* zcheckarrayVkMemoryOpaqueCaptureAddressAllocateInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryOpaqueCaptureAddressAllocateInfo moonvulkan_zcheckarraybufVkMemoryOpaqueCaptureAddressAllocateInfo
+VkMemoryOpaqueCaptureAddressAllocateInfo* zcheckarraybufVkMemoryOpaqueCaptureAddressAllocateInfo(lua_State *L, int arg, VkMemoryOpaqueCaptureAddressAllocateInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryOpaqueCaptureAddressAllocateInfo moonvulkan_zinitVkMemoryOpaqueCaptureAddressAllocateInfo
 int zinitVkMemoryOpaqueCaptureAddressAllocateInfo(lua_State *L, VkMemoryOpaqueCaptureAddressAllocateInfo* p, int *err);
 #define zfreeVkMemoryOpaqueCaptureAddressAllocateInfo(L, p, base) zfree((L), (p), (base))
@@ -3460,6 +4068,7 @@ int zpushVkMemoryOpaqueCaptureAddressAllocateInfo(lua_State *L, const VkMemoryOp
 
 #define znewVkDeviceMemoryOpaqueCaptureAddressInfo(L, err) (VkDeviceMemoryOpaqueCaptureAddressInfo*)znew((L), VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO, sizeof(VkDeviceMemoryOpaqueCaptureAddressInfo), (err))
 #define znewarrayVkDeviceMemoryOpaqueCaptureAddressInfo(L, count, err) (VkDeviceMemoryOpaqueCaptureAddressInfo*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO, sizeof(VkDeviceMemoryOpaqueCaptureAddressInfo), (count), (err))
+#define zinitarrayVkDeviceMemoryOpaqueCaptureAddressInfo(p, count) (VkDeviceMemoryOpaqueCaptureAddressInfo*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO, sizeof(VkDeviceMemoryOpaqueCaptureAddressInfo), (count))
 #define znewchainVkDeviceMemoryOpaqueCaptureAddressInfo moonvulkan_znewchainVkDeviceMemoryOpaqueCaptureAddressInfo
 VkDeviceMemoryOpaqueCaptureAddressInfo* znewchainVkDeviceMemoryOpaqueCaptureAddressInfo(lua_State *L, int *err);
 #define znewchainarrayVkDeviceMemoryOpaqueCaptureAddressInfo moonvulkan_znewchainarrayVkDeviceMemoryOpaqueCaptureAddressInfo
@@ -3468,6 +4077,8 @@ VkDeviceMemoryOpaqueCaptureAddressInfo* znewchainarrayVkDeviceMemoryOpaqueCaptur
 VkDeviceMemoryOpaqueCaptureAddressInfo* zcheckVkDeviceMemoryOpaqueCaptureAddressInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceMemoryOpaqueCaptureAddressInfo moonvulkan_zcheckarrayVkDeviceMemoryOpaqueCaptureAddressInfo
 VkDeviceMemoryOpaqueCaptureAddressInfo* zcheckarrayVkDeviceMemoryOpaqueCaptureAddressInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceMemoryOpaqueCaptureAddressInfo moonvulkan_zcheckarraybufVkDeviceMemoryOpaqueCaptureAddressInfo
+VkDeviceMemoryOpaqueCaptureAddressInfo* zcheckarraybufVkDeviceMemoryOpaqueCaptureAddressInfo(lua_State *L, int arg, VkDeviceMemoryOpaqueCaptureAddressInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceMemoryOpaqueCaptureAddressInfo moonvulkan_zinitVkDeviceMemoryOpaqueCaptureAddressInfo
 int zinitVkDeviceMemoryOpaqueCaptureAddressInfo(lua_State *L, VkDeviceMemoryOpaqueCaptureAddressInfo* p, int *err);
 #define zfreeVkDeviceMemoryOpaqueCaptureAddressInfo(L, p, base) zfree((L), (p), (base))
@@ -3477,6 +4088,7 @@ int zpushVkDeviceMemoryOpaqueCaptureAddressInfo(lua_State *L, const VkDeviceMemo
 
 #define znewVkPipelineInfoKHR(L, err) (VkPipelineInfoKHR*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_INFO_KHR, sizeof(VkPipelineInfoKHR), (err))
 #define znewarrayVkPipelineInfoKHR(L, count, err) (VkPipelineInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_INFO_KHR, sizeof(VkPipelineInfoKHR), (count), (err))
+#define zinitarrayVkPipelineInfoKHR(p, count) (VkPipelineInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_INFO_KHR, sizeof(VkPipelineInfoKHR), (count))
 #define znewchainVkPipelineInfoKHR moonvulkan_znewchainVkPipelineInfoKHR
 VkPipelineInfoKHR* znewchainVkPipelineInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkPipelineInfoKHR moonvulkan_znewchainarrayVkPipelineInfoKHR
@@ -3485,6 +4097,8 @@ VkPipelineInfoKHR* znewchainarrayVkPipelineInfoKHR(lua_State *L, uint32_t count,
 VkPipelineInfoKHR* zcheckVkPipelineInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineInfoKHR moonvulkan_zcheckarrayVkPipelineInfoKHR
 VkPipelineInfoKHR* zcheckarrayVkPipelineInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineInfoKHR moonvulkan_zcheckarraybufVkPipelineInfoKHR
+VkPipelineInfoKHR* zcheckarraybufVkPipelineInfoKHR(lua_State *L, int arg, VkPipelineInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineInfoKHR moonvulkan_zinitVkPipelineInfoKHR
 int zinitVkPipelineInfoKHR(lua_State *L, VkPipelineInfoKHR* p, int *err);
 #define zfreeVkPipelineInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -3494,6 +4108,7 @@ int zpushVkPipelineInfoKHR(lua_State *L, const VkPipelineInfoKHR *p);
 
 #define znewVkPipelineExecutablePropertiesKHR(L, err) (VkPipelineExecutablePropertiesKHR*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_PROPERTIES_KHR, sizeof(VkPipelineExecutablePropertiesKHR), (err))
 #define znewarrayVkPipelineExecutablePropertiesKHR(L, count, err) (VkPipelineExecutablePropertiesKHR*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_PROPERTIES_KHR, sizeof(VkPipelineExecutablePropertiesKHR), (count), (err))
+#define zinitarrayVkPipelineExecutablePropertiesKHR(p, count) (VkPipelineExecutablePropertiesKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_PROPERTIES_KHR, sizeof(VkPipelineExecutablePropertiesKHR), (count))
 #define znewchainVkPipelineExecutablePropertiesKHR moonvulkan_znewchainVkPipelineExecutablePropertiesKHR
 VkPipelineExecutablePropertiesKHR* znewchainVkPipelineExecutablePropertiesKHR(lua_State *L, int *err);
 #define znewchainarrayVkPipelineExecutablePropertiesKHR moonvulkan_znewchainarrayVkPipelineExecutablePropertiesKHR
@@ -3502,6 +4117,8 @@ VkPipelineExecutablePropertiesKHR* znewchainarrayVkPipelineExecutablePropertiesK
 VkPipelineExecutablePropertiesKHR* zcheckVkPipelineExecutablePropertiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineExecutablePropertiesKHR moonvulkan_zcheckarrayVkPipelineExecutablePropertiesKHR
 VkPipelineExecutablePropertiesKHR* zcheckarrayVkPipelineExecutablePropertiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineExecutablePropertiesKHR moonvulkan_zcheckarraybufVkPipelineExecutablePropertiesKHR
+VkPipelineExecutablePropertiesKHR* zcheckarraybufVkPipelineExecutablePropertiesKHR(lua_State *L, int arg, VkPipelineExecutablePropertiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineExecutablePropertiesKHR moonvulkan_zinitVkPipelineExecutablePropertiesKHR
 int zinitVkPipelineExecutablePropertiesKHR(lua_State *L, VkPipelineExecutablePropertiesKHR* p, int *err);
 #define zfreeVkPipelineExecutablePropertiesKHR(L, p, base) zfree((L), (p), (base))
@@ -3511,6 +4128,7 @@ int zpushVkPipelineExecutablePropertiesKHR(lua_State *L, const VkPipelineExecuta
 
 #define znewVkPipelineExecutableInfoKHR(L, err) (VkPipelineExecutableInfoKHR*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INFO_KHR, sizeof(VkPipelineExecutableInfoKHR), (err))
 #define znewarrayVkPipelineExecutableInfoKHR(L, count, err) (VkPipelineExecutableInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INFO_KHR, sizeof(VkPipelineExecutableInfoKHR), (count), (err))
+#define zinitarrayVkPipelineExecutableInfoKHR(p, count) (VkPipelineExecutableInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INFO_KHR, sizeof(VkPipelineExecutableInfoKHR), (count))
 #define znewchainVkPipelineExecutableInfoKHR moonvulkan_znewchainVkPipelineExecutableInfoKHR
 VkPipelineExecutableInfoKHR* znewchainVkPipelineExecutableInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkPipelineExecutableInfoKHR moonvulkan_znewchainarrayVkPipelineExecutableInfoKHR
@@ -3519,6 +4137,8 @@ VkPipelineExecutableInfoKHR* znewchainarrayVkPipelineExecutableInfoKHR(lua_State
 VkPipelineExecutableInfoKHR* zcheckVkPipelineExecutableInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineExecutableInfoKHR moonvulkan_zcheckarrayVkPipelineExecutableInfoKHR
 VkPipelineExecutableInfoKHR* zcheckarrayVkPipelineExecutableInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineExecutableInfoKHR moonvulkan_zcheckarraybufVkPipelineExecutableInfoKHR
+VkPipelineExecutableInfoKHR* zcheckarraybufVkPipelineExecutableInfoKHR(lua_State *L, int arg, VkPipelineExecutableInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineExecutableInfoKHR moonvulkan_zinitVkPipelineExecutableInfoKHR
 int zinitVkPipelineExecutableInfoKHR(lua_State *L, VkPipelineExecutableInfoKHR* p, int *err);
 #define zfreeVkPipelineExecutableInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -3528,6 +4148,7 @@ int zpushVkPipelineExecutableInfoKHR(lua_State *L, const VkPipelineExecutableInf
 
 #define znewVkPipelineExecutableStatisticKHR(L, err) (VkPipelineExecutableStatisticKHR*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_STATISTIC_KHR, sizeof(VkPipelineExecutableStatisticKHR), (err))
 #define znewarrayVkPipelineExecutableStatisticKHR(L, count, err) (VkPipelineExecutableStatisticKHR*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_STATISTIC_KHR, sizeof(VkPipelineExecutableStatisticKHR), (count), (err))
+#define zinitarrayVkPipelineExecutableStatisticKHR(p, count) (VkPipelineExecutableStatisticKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_STATISTIC_KHR, sizeof(VkPipelineExecutableStatisticKHR), (count))
 #define znewchainVkPipelineExecutableStatisticKHR moonvulkan_znewchainVkPipelineExecutableStatisticKHR
 VkPipelineExecutableStatisticKHR* znewchainVkPipelineExecutableStatisticKHR(lua_State *L, int *err);
 #define znewchainarrayVkPipelineExecutableStatisticKHR moonvulkan_znewchainarrayVkPipelineExecutableStatisticKHR
@@ -3536,6 +4157,8 @@ VkPipelineExecutableStatisticKHR* znewchainarrayVkPipelineExecutableStatisticKHR
 VkPipelineExecutableStatisticKHR* zcheckVkPipelineExecutableStatisticKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineExecutableStatisticKHR moonvulkan_zcheckarrayVkPipelineExecutableStatisticKHR
 VkPipelineExecutableStatisticKHR* zcheckarrayVkPipelineExecutableStatisticKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineExecutableStatisticKHR moonvulkan_zcheckarraybufVkPipelineExecutableStatisticKHR
+VkPipelineExecutableStatisticKHR* zcheckarraybufVkPipelineExecutableStatisticKHR(lua_State *L, int arg, VkPipelineExecutableStatisticKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineExecutableStatisticKHR moonvulkan_zinitVkPipelineExecutableStatisticKHR
 int zinitVkPipelineExecutableStatisticKHR(lua_State *L, VkPipelineExecutableStatisticKHR* p, int *err);
 #define zfreeVkPipelineExecutableStatisticKHR(L, p, base) zfree((L), (p), (base))
@@ -3545,6 +4168,7 @@ int zpushVkPipelineExecutableStatisticKHR(lua_State *L, const VkPipelineExecutab
 
 #define znewVkPipelineExecutableInternalRepresentationKHR(L, err) (VkPipelineExecutableInternalRepresentationKHR*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INTERNAL_REPRESENTATION_KHR, sizeof(VkPipelineExecutableInternalRepresentationKHR), (err))
 #define znewarrayVkPipelineExecutableInternalRepresentationKHR(L, count, err) (VkPipelineExecutableInternalRepresentationKHR*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INTERNAL_REPRESENTATION_KHR, sizeof(VkPipelineExecutableInternalRepresentationKHR), (count), (err))
+#define zinitarrayVkPipelineExecutableInternalRepresentationKHR(p, count) (VkPipelineExecutableInternalRepresentationKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INTERNAL_REPRESENTATION_KHR, sizeof(VkPipelineExecutableInternalRepresentationKHR), (count))
 #define znewchainVkPipelineExecutableInternalRepresentationKHR moonvulkan_znewchainVkPipelineExecutableInternalRepresentationKHR
 VkPipelineExecutableInternalRepresentationKHR* znewchainVkPipelineExecutableInternalRepresentationKHR(lua_State *L, int *err);
 #define znewchainarrayVkPipelineExecutableInternalRepresentationKHR moonvulkan_znewchainarrayVkPipelineExecutableInternalRepresentationKHR
@@ -3553,6 +4177,8 @@ VkPipelineExecutableInternalRepresentationKHR* znewchainarrayVkPipelineExecutabl
 VkPipelineExecutableInternalRepresentationKHR* zcheckVkPipelineExecutableInternalRepresentationKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineExecutableInternalRepresentationKHR moonvulkan_zcheckarrayVkPipelineExecutableInternalRepresentationKHR
 VkPipelineExecutableInternalRepresentationKHR* zcheckarrayVkPipelineExecutableInternalRepresentationKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineExecutableInternalRepresentationKHR moonvulkan_zcheckarraybufVkPipelineExecutableInternalRepresentationKHR
+VkPipelineExecutableInternalRepresentationKHR* zcheckarraybufVkPipelineExecutableInternalRepresentationKHR(lua_State *L, int arg, VkPipelineExecutableInternalRepresentationKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineExecutableInternalRepresentationKHR moonvulkan_zinitVkPipelineExecutableInternalRepresentationKHR
 int zinitVkPipelineExecutableInternalRepresentationKHR(lua_State *L, VkPipelineExecutableInternalRepresentationKHR* p, int *err);
 #define zfreeVkPipelineExecutableInternalRepresentationKHR(L, p, base) zfree((L), (p), (base))
@@ -3562,6 +4188,7 @@ int zpushVkPipelineExecutableInternalRepresentationKHR(lua_State *L, const VkPip
 
 #define znewVkPipelineLibraryCreateInfoKHR(L, err) (VkPipelineLibraryCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR, sizeof(VkPipelineLibraryCreateInfoKHR), (err))
 #define znewarrayVkPipelineLibraryCreateInfoKHR(L, count, err) (VkPipelineLibraryCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR, sizeof(VkPipelineLibraryCreateInfoKHR), (count), (err))
+#define zinitarrayVkPipelineLibraryCreateInfoKHR(p, count) (VkPipelineLibraryCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR, sizeof(VkPipelineLibraryCreateInfoKHR), (count))
 #define znewchainVkPipelineLibraryCreateInfoKHR moonvulkan_znewchainVkPipelineLibraryCreateInfoKHR
 VkPipelineLibraryCreateInfoKHR* znewchainVkPipelineLibraryCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkPipelineLibraryCreateInfoKHR moonvulkan_znewchainarrayVkPipelineLibraryCreateInfoKHR
@@ -3570,6 +4197,8 @@ VkPipelineLibraryCreateInfoKHR* znewchainarrayVkPipelineLibraryCreateInfoKHR(lua
 VkPipelineLibraryCreateInfoKHR* zcheckVkPipelineLibraryCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineLibraryCreateInfoKHR moonvulkan_zcheckarrayVkPipelineLibraryCreateInfoKHR
 VkPipelineLibraryCreateInfoKHR* zcheckarrayVkPipelineLibraryCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineLibraryCreateInfoKHR moonvulkan_zcheckarraybufVkPipelineLibraryCreateInfoKHR
+VkPipelineLibraryCreateInfoKHR* zcheckarraybufVkPipelineLibraryCreateInfoKHR(lua_State *L, int arg, VkPipelineLibraryCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineLibraryCreateInfoKHR moonvulkan_zinitVkPipelineLibraryCreateInfoKHR
 int zinitVkPipelineLibraryCreateInfoKHR(lua_State *L, VkPipelineLibraryCreateInfoKHR* p, int *err);
 #define zfreeVkPipelineLibraryCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -3579,6 +4208,7 @@ int zpushVkPipelineLibraryCreateInfoKHR(lua_State *L, const VkPipelineLibraryCre
 
 #define znewVkPresentIdKHR(L, err) (VkPresentIdKHR*)znew((L), VK_STRUCTURE_TYPE_PRESENT_ID_KHR, sizeof(VkPresentIdKHR), (err))
 #define znewarrayVkPresentIdKHR(L, count, err) (VkPresentIdKHR*)znewarray((L), VK_STRUCTURE_TYPE_PRESENT_ID_KHR, sizeof(VkPresentIdKHR), (count), (err))
+#define zinitarrayVkPresentIdKHR(p, count) (VkPresentIdKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PRESENT_ID_KHR, sizeof(VkPresentIdKHR), (count))
 #define znewchainVkPresentIdKHR moonvulkan_znewchainVkPresentIdKHR
 VkPresentIdKHR* znewchainVkPresentIdKHR(lua_State *L, int *err);
 #define znewchainarrayVkPresentIdKHR moonvulkan_znewchainarrayVkPresentIdKHR
@@ -3587,6 +4217,8 @@ VkPresentIdKHR* znewchainarrayVkPresentIdKHR(lua_State *L, uint32_t count, int *
 VkPresentIdKHR* zcheckVkPresentIdKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPresentIdKHR moonvulkan_zcheckarrayVkPresentIdKHR
 VkPresentIdKHR* zcheckarrayVkPresentIdKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPresentIdKHR moonvulkan_zcheckarraybufVkPresentIdKHR
+VkPresentIdKHR* zcheckarraybufVkPresentIdKHR(lua_State *L, int arg, VkPresentIdKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPresentIdKHR moonvulkan_zinitVkPresentIdKHR
 int zinitVkPresentIdKHR(lua_State *L, VkPresentIdKHR* p, int *err);
 #define zfreeVkPresentIdKHR(L, p, base) zfree((L), (p), (base))
@@ -3596,6 +4228,7 @@ int zpushVkPresentIdKHR(lua_State *L, const VkPresentIdKHR *p);
 
 #define znewVkMemoryBarrier2KHR(L, err) (VkMemoryBarrier2KHR*)znew((L), VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR, sizeof(VkMemoryBarrier2KHR), (err))
 #define znewarrayVkMemoryBarrier2KHR(L, count, err) (VkMemoryBarrier2KHR*)znewarray((L), VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR, sizeof(VkMemoryBarrier2KHR), (count), (err))
+#define zinitarrayVkMemoryBarrier2KHR(p, count) (VkMemoryBarrier2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR, sizeof(VkMemoryBarrier2KHR), (count))
 #define znewchainVkMemoryBarrier2KHR moonvulkan_znewchainVkMemoryBarrier2KHR
 VkMemoryBarrier2KHR* znewchainVkMemoryBarrier2KHR(lua_State *L, int *err);
 #define znewchainarrayVkMemoryBarrier2KHR moonvulkan_znewchainarrayVkMemoryBarrier2KHR
@@ -3604,6 +4237,8 @@ VkMemoryBarrier2KHR* znewchainarrayVkMemoryBarrier2KHR(lua_State *L, uint32_t co
 VkMemoryBarrier2KHR* zcheckVkMemoryBarrier2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryBarrier2KHR moonvulkan_zcheckarrayVkMemoryBarrier2KHR
 VkMemoryBarrier2KHR* zcheckarrayVkMemoryBarrier2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryBarrier2KHR moonvulkan_zcheckarraybufVkMemoryBarrier2KHR
+VkMemoryBarrier2KHR* zcheckarraybufVkMemoryBarrier2KHR(lua_State *L, int arg, VkMemoryBarrier2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryBarrier2KHR moonvulkan_zinitVkMemoryBarrier2KHR
 int zinitVkMemoryBarrier2KHR(lua_State *L, VkMemoryBarrier2KHR* p, int *err);
 #define zfreeVkMemoryBarrier2KHR(L, p, base) zfree((L), (p), (base))
@@ -3613,6 +4248,7 @@ int zpushVkMemoryBarrier2KHR(lua_State *L, const VkMemoryBarrier2KHR *p);
 
 #define znewVkBufferMemoryBarrier2KHR(L, err) (VkBufferMemoryBarrier2KHR*)znew((L), VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR, sizeof(VkBufferMemoryBarrier2KHR), (err))
 #define znewarrayVkBufferMemoryBarrier2KHR(L, count, err) (VkBufferMemoryBarrier2KHR*)znewarray((L), VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR, sizeof(VkBufferMemoryBarrier2KHR), (count), (err))
+#define zinitarrayVkBufferMemoryBarrier2KHR(p, count) (VkBufferMemoryBarrier2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR, sizeof(VkBufferMemoryBarrier2KHR), (count))
 #define znewchainVkBufferMemoryBarrier2KHR moonvulkan_znewchainVkBufferMemoryBarrier2KHR
 VkBufferMemoryBarrier2KHR* znewchainVkBufferMemoryBarrier2KHR(lua_State *L, int *err);
 #define znewchainarrayVkBufferMemoryBarrier2KHR moonvulkan_znewchainarrayVkBufferMemoryBarrier2KHR
@@ -3621,6 +4257,8 @@ VkBufferMemoryBarrier2KHR* znewchainarrayVkBufferMemoryBarrier2KHR(lua_State *L,
 VkBufferMemoryBarrier2KHR* zcheckVkBufferMemoryBarrier2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBufferMemoryBarrier2KHR moonvulkan_zcheckarrayVkBufferMemoryBarrier2KHR
 VkBufferMemoryBarrier2KHR* zcheckarrayVkBufferMemoryBarrier2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBufferMemoryBarrier2KHR moonvulkan_zcheckarraybufVkBufferMemoryBarrier2KHR
+VkBufferMemoryBarrier2KHR* zcheckarraybufVkBufferMemoryBarrier2KHR(lua_State *L, int arg, VkBufferMemoryBarrier2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBufferMemoryBarrier2KHR moonvulkan_zinitVkBufferMemoryBarrier2KHR
 int zinitVkBufferMemoryBarrier2KHR(lua_State *L, VkBufferMemoryBarrier2KHR* p, int *err);
 #define zfreeVkBufferMemoryBarrier2KHR(L, p, base) zfree((L), (p), (base))
@@ -3630,6 +4268,7 @@ int zpushVkBufferMemoryBarrier2KHR(lua_State *L, const VkBufferMemoryBarrier2KHR
 
 #define znewVkImageMemoryBarrier2KHR(L, err) (VkImageMemoryBarrier2KHR*)znew((L), VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR, sizeof(VkImageMemoryBarrier2KHR), (err))
 #define znewarrayVkImageMemoryBarrier2KHR(L, count, err) (VkImageMemoryBarrier2KHR*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR, sizeof(VkImageMemoryBarrier2KHR), (count), (err))
+#define zinitarrayVkImageMemoryBarrier2KHR(p, count) (VkImageMemoryBarrier2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR, sizeof(VkImageMemoryBarrier2KHR), (count))
 #define znewchainVkImageMemoryBarrier2KHR moonvulkan_znewchainVkImageMemoryBarrier2KHR
 VkImageMemoryBarrier2KHR* znewchainVkImageMemoryBarrier2KHR(lua_State *L, int *err);
 #define znewchainarrayVkImageMemoryBarrier2KHR moonvulkan_znewchainarrayVkImageMemoryBarrier2KHR
@@ -3638,6 +4277,8 @@ VkImageMemoryBarrier2KHR* znewchainarrayVkImageMemoryBarrier2KHR(lua_State *L, u
 VkImageMemoryBarrier2KHR* zcheckVkImageMemoryBarrier2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageMemoryBarrier2KHR moonvulkan_zcheckarrayVkImageMemoryBarrier2KHR
 VkImageMemoryBarrier2KHR* zcheckarrayVkImageMemoryBarrier2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageMemoryBarrier2KHR moonvulkan_zcheckarraybufVkImageMemoryBarrier2KHR
+VkImageMemoryBarrier2KHR* zcheckarraybufVkImageMemoryBarrier2KHR(lua_State *L, int arg, VkImageMemoryBarrier2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageMemoryBarrier2KHR moonvulkan_zinitVkImageMemoryBarrier2KHR
 int zinitVkImageMemoryBarrier2KHR(lua_State *L, VkImageMemoryBarrier2KHR* p, int *err);
 #define zfreeVkImageMemoryBarrier2KHR(L, p, base) zfree((L), (p), (base))
@@ -3647,6 +4288,7 @@ int zpushVkImageMemoryBarrier2KHR(lua_State *L, const VkImageMemoryBarrier2KHR *
 
 #define znewVkDependencyInfoKHR(L, err) (VkDependencyInfoKHR*)znew((L), VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR, sizeof(VkDependencyInfoKHR), (err))
 #define znewarrayVkDependencyInfoKHR(L, count, err) (VkDependencyInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR, sizeof(VkDependencyInfoKHR), (count), (err))
+#define zinitarrayVkDependencyInfoKHR(p, count) (VkDependencyInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR, sizeof(VkDependencyInfoKHR), (count))
 #define znewchainVkDependencyInfoKHR moonvulkan_znewchainVkDependencyInfoKHR
 VkDependencyInfoKHR* znewchainVkDependencyInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkDependencyInfoKHR moonvulkan_znewchainarrayVkDependencyInfoKHR
@@ -3655,6 +4297,8 @@ VkDependencyInfoKHR* znewchainarrayVkDependencyInfoKHR(lua_State *L, uint32_t co
 VkDependencyInfoKHR* zcheckVkDependencyInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDependencyInfoKHR moonvulkan_zcheckarrayVkDependencyInfoKHR
 VkDependencyInfoKHR* zcheckarrayVkDependencyInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDependencyInfoKHR moonvulkan_zcheckarraybufVkDependencyInfoKHR
+VkDependencyInfoKHR* zcheckarraybufVkDependencyInfoKHR(lua_State *L, int arg, VkDependencyInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDependencyInfoKHR moonvulkan_zinitVkDependencyInfoKHR
 int zinitVkDependencyInfoKHR(lua_State *L, VkDependencyInfoKHR* p, int *err);
 #define zfreeVkDependencyInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -3664,6 +4308,7 @@ int zpushVkDependencyInfoKHR(lua_State *L, const VkDependencyInfoKHR *p);
 
 #define znewVkSemaphoreSubmitInfoKHR(L, err) (VkSemaphoreSubmitInfoKHR*)znew((L), VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR, sizeof(VkSemaphoreSubmitInfoKHR), (err))
 #define znewarrayVkSemaphoreSubmitInfoKHR(L, count, err) (VkSemaphoreSubmitInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR, sizeof(VkSemaphoreSubmitInfoKHR), (count), (err))
+#define zinitarrayVkSemaphoreSubmitInfoKHR(p, count) (VkSemaphoreSubmitInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR, sizeof(VkSemaphoreSubmitInfoKHR), (count))
 #define znewchainVkSemaphoreSubmitInfoKHR moonvulkan_znewchainVkSemaphoreSubmitInfoKHR
 VkSemaphoreSubmitInfoKHR* znewchainVkSemaphoreSubmitInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkSemaphoreSubmitInfoKHR moonvulkan_znewchainarrayVkSemaphoreSubmitInfoKHR
@@ -3672,6 +4317,8 @@ VkSemaphoreSubmitInfoKHR* znewchainarrayVkSemaphoreSubmitInfoKHR(lua_State *L, u
 VkSemaphoreSubmitInfoKHR* zcheckVkSemaphoreSubmitInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSemaphoreSubmitInfoKHR moonvulkan_zcheckarrayVkSemaphoreSubmitInfoKHR
 VkSemaphoreSubmitInfoKHR* zcheckarrayVkSemaphoreSubmitInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSemaphoreSubmitInfoKHR moonvulkan_zcheckarraybufVkSemaphoreSubmitInfoKHR
+VkSemaphoreSubmitInfoKHR* zcheckarraybufVkSemaphoreSubmitInfoKHR(lua_State *L, int arg, VkSemaphoreSubmitInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSemaphoreSubmitInfoKHR moonvulkan_zinitVkSemaphoreSubmitInfoKHR
 int zinitVkSemaphoreSubmitInfoKHR(lua_State *L, VkSemaphoreSubmitInfoKHR* p, int *err);
 #define zfreeVkSemaphoreSubmitInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -3681,6 +4328,7 @@ int zpushVkSemaphoreSubmitInfoKHR(lua_State *L, const VkSemaphoreSubmitInfoKHR *
 
 #define znewVkCommandBufferSubmitInfoKHR(L, err) (VkCommandBufferSubmitInfoKHR*)znew((L), VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR, sizeof(VkCommandBufferSubmitInfoKHR), (err))
 #define znewarrayVkCommandBufferSubmitInfoKHR(L, count, err) (VkCommandBufferSubmitInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR, sizeof(VkCommandBufferSubmitInfoKHR), (count), (err))
+#define zinitarrayVkCommandBufferSubmitInfoKHR(p, count) (VkCommandBufferSubmitInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR, sizeof(VkCommandBufferSubmitInfoKHR), (count))
 #define znewchainVkCommandBufferSubmitInfoKHR moonvulkan_znewchainVkCommandBufferSubmitInfoKHR
 VkCommandBufferSubmitInfoKHR* znewchainVkCommandBufferSubmitInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkCommandBufferSubmitInfoKHR moonvulkan_znewchainarrayVkCommandBufferSubmitInfoKHR
@@ -3689,6 +4337,8 @@ VkCommandBufferSubmitInfoKHR* znewchainarrayVkCommandBufferSubmitInfoKHR(lua_Sta
 VkCommandBufferSubmitInfoKHR* zcheckVkCommandBufferSubmitInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCommandBufferSubmitInfoKHR moonvulkan_zcheckarrayVkCommandBufferSubmitInfoKHR
 VkCommandBufferSubmitInfoKHR* zcheckarrayVkCommandBufferSubmitInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCommandBufferSubmitInfoKHR moonvulkan_zcheckarraybufVkCommandBufferSubmitInfoKHR
+VkCommandBufferSubmitInfoKHR* zcheckarraybufVkCommandBufferSubmitInfoKHR(lua_State *L, int arg, VkCommandBufferSubmitInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCommandBufferSubmitInfoKHR moonvulkan_zinitVkCommandBufferSubmitInfoKHR
 int zinitVkCommandBufferSubmitInfoKHR(lua_State *L, VkCommandBufferSubmitInfoKHR* p, int *err);
 #define zfreeVkCommandBufferSubmitInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -3698,6 +4348,7 @@ int zpushVkCommandBufferSubmitInfoKHR(lua_State *L, const VkCommandBufferSubmitI
 
 #define znewVkSubmitInfo2KHR(L, err) (VkSubmitInfo2KHR*)znew((L), VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR, sizeof(VkSubmitInfo2KHR), (err))
 #define znewarrayVkSubmitInfo2KHR(L, count, err) (VkSubmitInfo2KHR*)znewarray((L), VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR, sizeof(VkSubmitInfo2KHR), (count), (err))
+#define zinitarrayVkSubmitInfo2KHR(p, count) (VkSubmitInfo2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR, sizeof(VkSubmitInfo2KHR), (count))
 #define znewchainVkSubmitInfo2KHR moonvulkan_znewchainVkSubmitInfo2KHR
 VkSubmitInfo2KHR* znewchainVkSubmitInfo2KHR(lua_State *L, int *err);
 #define znewchainarrayVkSubmitInfo2KHR moonvulkan_znewchainarrayVkSubmitInfo2KHR
@@ -3706,6 +4357,8 @@ VkSubmitInfo2KHR* znewchainarrayVkSubmitInfo2KHR(lua_State *L, uint32_t count, i
 VkSubmitInfo2KHR* zcheckVkSubmitInfo2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSubmitInfo2KHR moonvulkan_zcheckarrayVkSubmitInfo2KHR
 VkSubmitInfo2KHR* zcheckarrayVkSubmitInfo2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSubmitInfo2KHR moonvulkan_zcheckarraybufVkSubmitInfo2KHR
+VkSubmitInfo2KHR* zcheckarraybufVkSubmitInfo2KHR(lua_State *L, int arg, VkSubmitInfo2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSubmitInfo2KHR moonvulkan_zinitVkSubmitInfo2KHR
 int zinitVkSubmitInfo2KHR(lua_State *L, VkSubmitInfo2KHR* p, int *err);
 #define zfreeVkSubmitInfo2KHR(L, p, base) zfree((L), (p), (base))
@@ -3715,6 +4368,7 @@ int zpushVkSubmitInfo2KHR(lua_State *L, const VkSubmitInfo2KHR *p);
 
 #define znewVkBufferCopy2KHR(L, err) (VkBufferCopy2KHR*)znew((L), VK_STRUCTURE_TYPE_BUFFER_COPY_2_KHR, sizeof(VkBufferCopy2KHR), (err))
 #define znewarrayVkBufferCopy2KHR(L, count, err) (VkBufferCopy2KHR*)znewarray((L), VK_STRUCTURE_TYPE_BUFFER_COPY_2_KHR, sizeof(VkBufferCopy2KHR), (count), (err))
+#define zinitarrayVkBufferCopy2KHR(p, count) (VkBufferCopy2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_BUFFER_COPY_2_KHR, sizeof(VkBufferCopy2KHR), (count))
 #define znewchainVkBufferCopy2KHR moonvulkan_znewchainVkBufferCopy2KHR
 VkBufferCopy2KHR* znewchainVkBufferCopy2KHR(lua_State *L, int *err);
 #define znewchainarrayVkBufferCopy2KHR moonvulkan_znewchainarrayVkBufferCopy2KHR
@@ -3723,6 +4377,8 @@ VkBufferCopy2KHR* znewchainarrayVkBufferCopy2KHR(lua_State *L, uint32_t count, i
 VkBufferCopy2KHR* zcheckVkBufferCopy2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBufferCopy2KHR moonvulkan_zcheckarrayVkBufferCopy2KHR
 VkBufferCopy2KHR* zcheckarrayVkBufferCopy2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBufferCopy2KHR moonvulkan_zcheckarraybufVkBufferCopy2KHR
+VkBufferCopy2KHR* zcheckarraybufVkBufferCopy2KHR(lua_State *L, int arg, VkBufferCopy2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBufferCopy2KHR moonvulkan_zinitVkBufferCopy2KHR
 int zinitVkBufferCopy2KHR(lua_State *L, VkBufferCopy2KHR* p, int *err);
 #define zfreeVkBufferCopy2KHR(L, p, base) zfree((L), (p), (base))
@@ -3732,6 +4388,7 @@ int zpushVkBufferCopy2KHR(lua_State *L, const VkBufferCopy2KHR *p);
 
 #define znewVkCopyBufferInfo2KHR(L, err) (VkCopyBufferInfo2KHR*)znew((L), VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2_KHR, sizeof(VkCopyBufferInfo2KHR), (err))
 #define znewarrayVkCopyBufferInfo2KHR(L, count, err) (VkCopyBufferInfo2KHR*)znewarray((L), VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2_KHR, sizeof(VkCopyBufferInfo2KHR), (count), (err))
+#define zinitarrayVkCopyBufferInfo2KHR(p, count) (VkCopyBufferInfo2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2_KHR, sizeof(VkCopyBufferInfo2KHR), (count))
 #define znewchainVkCopyBufferInfo2KHR moonvulkan_znewchainVkCopyBufferInfo2KHR
 VkCopyBufferInfo2KHR* znewchainVkCopyBufferInfo2KHR(lua_State *L, int *err);
 #define znewchainarrayVkCopyBufferInfo2KHR moonvulkan_znewchainarrayVkCopyBufferInfo2KHR
@@ -3740,6 +4397,8 @@ VkCopyBufferInfo2KHR* znewchainarrayVkCopyBufferInfo2KHR(lua_State *L, uint32_t
 VkCopyBufferInfo2KHR* zcheckVkCopyBufferInfo2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCopyBufferInfo2KHR moonvulkan_zcheckarrayVkCopyBufferInfo2KHR
 VkCopyBufferInfo2KHR* zcheckarrayVkCopyBufferInfo2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCopyBufferInfo2KHR moonvulkan_zcheckarraybufVkCopyBufferInfo2KHR
+VkCopyBufferInfo2KHR* zcheckarraybufVkCopyBufferInfo2KHR(lua_State *L, int arg, VkCopyBufferInfo2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCopyBufferInfo2KHR moonvulkan_zinitVkCopyBufferInfo2KHR
 int zinitVkCopyBufferInfo2KHR(lua_State *L, VkCopyBufferInfo2KHR* p, int *err);
 #define zfreeVkCopyBufferInfo2KHR(L, p, base) zfree((L), (p), (base))
@@ -3749,6 +4408,7 @@ int zpushVkCopyBufferInfo2KHR(lua_State *L, const VkCopyBufferInfo2KHR *p);
 
 #define znewVkImageCopy2KHR(L, err) (VkImageCopy2KHR*)znew((L), VK_STRUCTURE_TYPE_IMAGE_COPY_2_KHR, sizeof(VkImageCopy2KHR), (err))
 #define znewarrayVkImageCopy2KHR(L, count, err) (VkImageCopy2KHR*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_COPY_2_KHR, sizeof(VkImageCopy2KHR), (count), (err))
+#define zinitarrayVkImageCopy2KHR(p, count) (VkImageCopy2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_COPY_2_KHR, sizeof(VkImageCopy2KHR), (count))
 #define znewchainVkImageCopy2KHR moonvulkan_znewchainVkImageCopy2KHR
 VkImageCopy2KHR* znewchainVkImageCopy2KHR(lua_State *L, int *err);
 #define znewchainarrayVkImageCopy2KHR moonvulkan_znewchainarrayVkImageCopy2KHR
@@ -3757,6 +4417,8 @@ VkImageCopy2KHR* znewchainarrayVkImageCopy2KHR(lua_State *L, uint32_t count, int
 VkImageCopy2KHR* zcheckVkImageCopy2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageCopy2KHR moonvulkan_zcheckarrayVkImageCopy2KHR
 VkImageCopy2KHR* zcheckarrayVkImageCopy2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageCopy2KHR moonvulkan_zcheckarraybufVkImageCopy2KHR
+VkImageCopy2KHR* zcheckarraybufVkImageCopy2KHR(lua_State *L, int arg, VkImageCopy2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageCopy2KHR moonvulkan_zinitVkImageCopy2KHR
 int zinitVkImageCopy2KHR(lua_State *L, VkImageCopy2KHR* p, int *err);
 #define zfreeVkImageCopy2KHR(L, p, base) zfree((L), (p), (base))
@@ -3766,6 +4428,7 @@ int zpushVkImageCopy2KHR(lua_State *L, const VkImageCopy2KHR *p);
 
 #define znewVkCopyImageInfo2KHR(L, err) (VkCopyImageInfo2KHR*)znew((L), VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2_KHR, sizeof(VkCopyImageInfo2KHR), (err))
 #define znewarrayVkCopyImageInfo2KHR(L, count, err) (VkCopyImageInfo2KHR*)znewarray((L), VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2_KHR, sizeof(VkCopyImageInfo2KHR), (count), (err))
+#define zinitarrayVkCopyImageInfo2KHR(p, count) (VkCopyImageInfo2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2_KHR, sizeof(VkCopyImageInfo2KHR), (count))
 #define znewchainVkCopyImageInfo2KHR moonvulkan_znewchainVkCopyImageInfo2KHR
 VkCopyImageInfo2KHR* znewchainVkCopyImageInfo2KHR(lua_State *L, int *err);
 #define znewchainarrayVkCopyImageInfo2KHR moonvulkan_znewchainarrayVkCopyImageInfo2KHR
@@ -3774,6 +4437,8 @@ VkCopyImageInfo2KHR* znewchainarrayVkCopyImageInfo2KHR(lua_State *L, uint32_t co
 VkCopyImageInfo2KHR* zcheckVkCopyImageInfo2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCopyImageInfo2KHR moonvulkan_zcheckarrayVkCopyImageInfo2KHR
 VkCopyImageInfo2KHR* zcheckarrayVkCopyImageInfo2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCopyImageInfo2KHR moonvulkan_zcheckarraybufVkCopyImageInfo2KHR
+VkCopyImageInfo2KHR* zcheckarraybufVkCopyImageInfo2KHR(lua_State *L, int arg, VkCopyImageInfo2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCopyImageInfo2KHR moonvulkan_zinitVkCopyImageInfo2KHR
 int zinitVkCopyImageInfo2KHR(lua_State *L, VkCopyImageInfo2KHR* p, int *err);
 #define zfreeVkCopyImageInfo2KHR(L, p, base) zfree((L), (p), (base))
@@ -3783,6 +4448,7 @@ int zpushVkCopyImageInfo2KHR(lua_State *L, const VkCopyImageInfo2KHR *p);
 
 #define znewVkBufferImageCopy2KHR(L, err) (VkBufferImageCopy2KHR*)znew((L), VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2_KHR, sizeof(VkBufferImageCopy2KHR), (err))
 #define znewarrayVkBufferImageCopy2KHR(L, count, err) (VkBufferImageCopy2KHR*)znewarray((L), VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2_KHR, sizeof(VkBufferImageCopy2KHR), (count), (err))
+#define zinitarrayVkBufferImageCopy2KHR(p, count) (VkBufferImageCopy2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2_KHR, sizeof(VkBufferImageCopy2KHR), (count))
 #define znewchainVkBufferImageCopy2KHR moonvulkan_znewchainVkBufferImageCopy2KHR
 VkBufferImageCopy2KHR* znewchainVkBufferImageCopy2KHR(lua_State *L, int *err);
 #define znewchainarrayVkBufferImageCopy2KHR moonvulkan_znewchainarrayVkBufferImageCopy2KHR
@@ -3791,6 +4457,8 @@ VkBufferImageCopy2KHR* znewchainarrayVkBufferImageCopy2KHR(lua_State *L, uint32_
 VkBufferImageCopy2KHR* zcheckVkBufferImageCopy2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBufferImageCopy2KHR moonvulkan_zcheckarrayVkBufferImageCopy2KHR
 VkBufferImageCopy2KHR* zcheckarrayVkBufferImageCopy2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBufferImageCopy2KHR moonvulkan_zcheckarraybufVkBufferImageCopy2KHR
+VkBufferImageCopy2KHR* zcheckarraybufVkBufferImageCopy2KHR(lua_State *L, int arg, VkBufferImageCopy2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBufferImageCopy2KHR moonvulkan_zinitVkBufferImageCopy2KHR
 int zinitVkBufferImageCopy2KHR(lua_State *L, VkBufferImageCopy2KHR* p, int *err);
 #define zfreeVkBufferImageCopy2KHR(L, p, base) zfree((L), (p), (base))
@@ -3800,6 +4468,7 @@ int zpushVkBufferImageCopy2KHR(lua_State *L, const VkBufferImageCopy2KHR *p);
 
 #define znewVkCopyBufferToImageInfo2KHR(L, err) (VkCopyBufferToImageInfo2KHR*)znew((L), VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2_KHR, sizeof(VkCopyBufferToImageInfo2KHR), (err))
 #define znewarrayVkCopyBufferToImageInfo2KHR(L, count, err) (VkCopyBufferToImageInfo2KHR*)znewarray((L), VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2_KHR, sizeof(VkCopyBufferToImageInfo2KHR), (count), (err))
+#define zinitarrayVkCopyBufferToImageInfo2KHR(p, count) (VkCopyBufferToImageInfo2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2_KHR, sizeof(VkCopyBufferToImageInfo2KHR), (count))
 #define znewchainVkCopyBufferToImageInfo2KHR moonvulkan_znewchainVkCopyBufferToImageInfo2KHR
 VkCopyBufferToImageInfo2KHR* znewchainVkCopyBufferToImageInfo2KHR(lua_State *L, int *err);
 #define znewchainarrayVkCopyBufferToImageInfo2KHR moonvulkan_znewchainarrayVkCopyBufferToImageInfo2KHR
@@ -3808,6 +4477,8 @@ VkCopyBufferToImageInfo2KHR* znewchainarrayVkCopyBufferToImageInfo2KHR(lua_State
 VkCopyBufferToImageInfo2KHR* zcheckVkCopyBufferToImageInfo2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCopyBufferToImageInfo2KHR moonvulkan_zcheckarrayVkCopyBufferToImageInfo2KHR
 VkCopyBufferToImageInfo2KHR* zcheckarrayVkCopyBufferToImageInfo2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCopyBufferToImageInfo2KHR moonvulkan_zcheckarraybufVkCopyBufferToImageInfo2KHR
+VkCopyBufferToImageInfo2KHR* zcheckarraybufVkCopyBufferToImageInfo2KHR(lua_State *L, int arg, VkCopyBufferToImageInfo2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCopyBufferToImageInfo2KHR moonvulkan_zinitVkCopyBufferToImageInfo2KHR
 int zinitVkCopyBufferToImageInfo2KHR(lua_State *L, VkCopyBufferToImageInfo2KHR* p, int *err);
 #define zfreeVkCopyBufferToImageInfo2KHR(L, p, base) zfree((L), (p), (base))
@@ -3817,6 +4488,7 @@ int zpushVkCopyBufferToImageInfo2KHR(lua_State *L, const VkCopyBufferToImageInfo
 
 #define znewVkCopyImageToBufferInfo2KHR(L, err) (VkCopyImageToBufferInfo2KHR*)znew((L), VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2_KHR, sizeof(VkCopyImageToBufferInfo2KHR), (err))
 #define znewarrayVkCopyImageToBufferInfo2KHR(L, count, err) (VkCopyImageToBufferInfo2KHR*)znewarray((L), VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2_KHR, sizeof(VkCopyImageToBufferInfo2KHR), (count), (err))
+#define zinitarrayVkCopyImageToBufferInfo2KHR(p, count) (VkCopyImageToBufferInfo2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2_KHR, sizeof(VkCopyImageToBufferInfo2KHR), (count))
 #define znewchainVkCopyImageToBufferInfo2KHR moonvulkan_znewchainVkCopyImageToBufferInfo2KHR
 VkCopyImageToBufferInfo2KHR* znewchainVkCopyImageToBufferInfo2KHR(lua_State *L, int *err);
 #define znewchainarrayVkCopyImageToBufferInfo2KHR moonvulkan_znewchainarrayVkCopyImageToBufferInfo2KHR
@@ -3825,6 +4497,8 @@ VkCopyImageToBufferInfo2KHR* znewchainarrayVkCopyImageToBufferInfo2KHR(lua_State
 VkCopyImageToBufferInfo2KHR* zcheckVkCopyImageToBufferInfo2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCopyImageToBufferInfo2KHR moonvulkan_zcheckarrayVkCopyImageToBufferInfo2KHR
 VkCopyImageToBufferInfo2KHR* zcheckarrayVkCopyImageToBufferInfo2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCopyImageToBufferInfo2KHR moonvulkan_zcheckarraybufVkCopyImageToBufferInfo2KHR
+VkCopyImageToBufferInfo2KHR* zcheckarraybufVkCopyImageToBufferInfo2KHR(lua_State *L, int arg, VkCopyImageToBufferInfo2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCopyImageToBufferInfo2KHR moonvulkan_zinitVkCopyImageToBufferInfo2KHR
 int zinitVkCopyImageToBufferInfo2KHR(lua_State *L, VkCopyImageToBufferInfo2KHR* p, int *err);
 #define zfreeVkCopyImageToBufferInfo2KHR(L, p, base) zfree((L), (p), (base))
@@ -3834,6 +4508,7 @@ int zpushVkCopyImageToBufferInfo2KHR(lua_State *L, const VkCopyImageToBufferInfo
 
 #define znewVkImageBlit2KHR(L, err) (VkImageBlit2KHR*)znew((L), VK_STRUCTURE_TYPE_IMAGE_BLIT_2_KHR, sizeof(VkImageBlit2KHR), (err))
 #define znewarrayVkImageBlit2KHR(L, count, err) (VkImageBlit2KHR*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_BLIT_2_KHR, sizeof(VkImageBlit2KHR), (count), (err))
+#define zinitarrayVkImageBlit2KHR(p, count) (VkImageBlit2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_BLIT_2_KHR, sizeof(VkImageBlit2KHR), (count))
 #define znewchainVkImageBlit2KHR moonvulkan_znewchainVkImageBlit2KHR
 VkImageBlit2KHR* znewchainVkImageBlit2KHR(lua_State *L, int *err);
 #define znewchainarrayVkImageBlit2KHR moonvulkan_znewchainarrayVkImageBlit2KHR
@@ -3842,6 +4517,8 @@ VkImageBlit2KHR* znewchainarrayVkImageBlit2KHR(lua_State *L, uint32_t count, int
 VkImageBlit2KHR* zcheckVkImageBlit2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageBlit2KHR moonvulkan_zcheckarrayVkImageBlit2KHR
 VkImageBlit2KHR* zcheckarrayVkImageBlit2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageBlit2KHR moonvulkan_zcheckarraybufVkImageBlit2KHR
+VkImageBlit2KHR* zcheckarraybufVkImageBlit2KHR(lua_State *L, int arg, VkImageBlit2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageBlit2KHR moonvulkan_zinitVkImageBlit2KHR
 int zinitVkImageBlit2KHR(lua_State *L, VkImageBlit2KHR* p, int *err);
 #define zfreeVkImageBlit2KHR(L, p, base) zfree((L), (p), (base))
@@ -3851,6 +4528,7 @@ int zpushVkImageBlit2KHR(lua_State *L, const VkImageBlit2KHR *p);
 
 #define znewVkBlitImageInfo2KHR(L, err) (VkBlitImageInfo2KHR*)znew((L), VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2_KHR, sizeof(VkBlitImageInfo2KHR), (err))
 #define znewarrayVkBlitImageInfo2KHR(L, count, err) (VkBlitImageInfo2KHR*)znewarray((L), VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2_KHR, sizeof(VkBlitImageInfo2KHR), (count), (err))
+#define zinitarrayVkBlitImageInfo2KHR(p, count) (VkBlitImageInfo2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2_KHR, sizeof(VkBlitImageInfo2KHR), (count))
 #define znewchainVkBlitImageInfo2KHR moonvulkan_znewchainVkBlitImageInfo2KHR
 VkBlitImageInfo2KHR* znewchainVkBlitImageInfo2KHR(lua_State *L, int *err);
 #define znewchainarrayVkBlitImageInfo2KHR moonvulkan_znewchainarrayVkBlitImageInfo2KHR
@@ -3859,6 +4537,8 @@ VkBlitImageInfo2KHR* znewchainarrayVkBlitImageInfo2KHR(lua_State *L, uint32_t co
 VkBlitImageInfo2KHR* zcheckVkBlitImageInfo2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBlitImageInfo2KHR moonvulkan_zcheckarrayVkBlitImageInfo2KHR
 VkBlitImageInfo2KHR* zcheckarrayVkBlitImageInfo2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBlitImageInfo2KHR moonvulkan_zcheckarraybufVkBlitImageInfo2KHR
+VkBlitImageInfo2KHR* zcheckarraybufVkBlitImageInfo2KHR(lua_State *L, int arg, VkBlitImageInfo2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBlitImageInfo2KHR moonvulkan_zinitVkBlitImageInfo2KHR
 int zinitVkBlitImageInfo2KHR(lua_State *L, VkBlitImageInfo2KHR* p, int *err);
 #define zfreeVkBlitImageInfo2KHR(L, p, base) zfree((L), (p), (base))
@@ -3868,6 +4548,7 @@ int zpushVkBlitImageInfo2KHR(lua_State *L, const VkBlitImageInfo2KHR *p);
 
 #define znewVkImageResolve2KHR(L, err) (VkImageResolve2KHR*)znew((L), VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2_KHR, sizeof(VkImageResolve2KHR), (err))
 #define znewarrayVkImageResolve2KHR(L, count, err) (VkImageResolve2KHR*)znewarray((L), VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2_KHR, sizeof(VkImageResolve2KHR), (count), (err))
+#define zinitarrayVkImageResolve2KHR(p, count) (VkImageResolve2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2_KHR, sizeof(VkImageResolve2KHR), (count))
 #define znewchainVkImageResolve2KHR moonvulkan_znewchainVkImageResolve2KHR
 VkImageResolve2KHR* znewchainVkImageResolve2KHR(lua_State *L, int *err);
 #define znewchainarrayVkImageResolve2KHR moonvulkan_znewchainarrayVkImageResolve2KHR
@@ -3876,6 +4557,8 @@ VkImageResolve2KHR* znewchainarrayVkImageResolve2KHR(lua_State *L, uint32_t coun
 VkImageResolve2KHR* zcheckVkImageResolve2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageResolve2KHR moonvulkan_zcheckarrayVkImageResolve2KHR
 VkImageResolve2KHR* zcheckarrayVkImageResolve2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageResolve2KHR moonvulkan_zcheckarraybufVkImageResolve2KHR
+VkImageResolve2KHR* zcheckarraybufVkImageResolve2KHR(lua_State *L, int arg, VkImageResolve2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageResolve2KHR moonvulkan_zinitVkImageResolve2KHR
 int zinitVkImageResolve2KHR(lua_State *L, VkImageResolve2KHR* p, int *err);
 #define zfreeVkImageResolve2KHR(L, p, base) zfree((L), (p), (base))
@@ -3885,6 +4568,7 @@ int zpushVkImageResolve2KHR(lua_State *L, const VkImageResolve2KHR *p);
 
 #define znewVkResolveImageInfo2KHR(L, err) (VkResolveImageInfo2KHR*)znew((L), VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2_KHR, sizeof(VkResolveImageInfo2KHR), (err))
 #define znewarrayVkResolveImageInfo2KHR(L, count, err) (VkResolveImageInfo2KHR*)znewarray((L), VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2_KHR, sizeof(VkResolveImageInfo2KHR), (count), (err))
+#define zinitarrayVkResolveImageInfo2KHR(p, count) (VkResolveImageInfo2KHR*)zinitarray((p), VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2_KHR, sizeof(VkResolveImageInfo2KHR), (count))
 #define znewchainVkResolveImageInfo2KHR moonvulkan_znewchainVkResolveImageInfo2KHR
 VkResolveImageInfo2KHR* znewchainVkResolveImageInfo2KHR(lua_State *L, int *err);
 #define znewchainarrayVkResolveImageInfo2KHR moonvulkan_znewchainarrayVkResolveImageInfo2KHR
@@ -3893,6 +4577,8 @@ VkResolveImageInfo2KHR* znewchainarrayVkResolveImageInfo2KHR(lua_State *L, uint3
 VkResolveImageInfo2KHR* zcheckVkResolveImageInfo2KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkResolveImageInfo2KHR moonvulkan_zcheckarrayVkResolveImageInfo2KHR
 VkResolveImageInfo2KHR* zcheckarrayVkResolveImageInfo2KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkResolveImageInfo2KHR moonvulkan_zcheckarraybufVkResolveImageInfo2KHR
+VkResolveImageInfo2KHR* zcheckarraybufVkResolveImageInfo2KHR(lua_State *L, int arg, VkResolveImageInfo2KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkResolveImageInfo2KHR moonvulkan_zinitVkResolveImageInfo2KHR
 int zinitVkResolveImageInfo2KHR(lua_State *L, VkResolveImageInfo2KHR* p, int *err);
 #define zfreeVkResolveImageInfo2KHR(L, p, base) zfree((L), (p), (base))
@@ -3902,6 +4588,7 @@ int zpushVkResolveImageInfo2KHR(lua_State *L, const VkResolveImageInfo2KHR *p);
 
 #define znewVkAccelerationStructureGeometryTrianglesDataKHR(L, err) (VkAccelerationStructureGeometryTrianglesDataKHR*)znew((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR, sizeof(VkAccelerationStructureGeometryTrianglesDataKHR), (err))
 #define znewarrayVkAccelerationStructureGeometryTrianglesDataKHR(L, count, err) (VkAccelerationStructureGeometryTrianglesDataKHR*)znewarray((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR, sizeof(VkAccelerationStructureGeometryTrianglesDataKHR), (count), (err))
+#define zinitarrayVkAccelerationStructureGeometryTrianglesDataKHR(p, count) (VkAccelerationStructureGeometryTrianglesDataKHR*)zinitarray((p), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR, sizeof(VkAccelerationStructureGeometryTrianglesDataKHR), (count))
 #define znewchainVkAccelerationStructureGeometryTrianglesDataKHR moonvulkan_znewchainVkAccelerationStructureGeometryTrianglesDataKHR
 VkAccelerationStructureGeometryTrianglesDataKHR* znewchainVkAccelerationStructureGeometryTrianglesDataKHR(lua_State *L, int *err);
 #define znewchainarrayVkAccelerationStructureGeometryTrianglesDataKHR moonvulkan_znewchainarrayVkAccelerationStructureGeometryTrianglesDataKHR
@@ -3910,6 +4597,8 @@ VkAccelerationStructureGeometryTrianglesDataKHR* znewchainarrayVkAccelerationStr
 VkAccelerationStructureGeometryTrianglesDataKHR* zcheckVkAccelerationStructureGeometryTrianglesDataKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAccelerationStructureGeometryTrianglesDataKHR moonvulkan_zcheckarrayVkAccelerationStructureGeometryTrianglesDataKHR
 VkAccelerationStructureGeometryTrianglesDataKHR* zcheckarrayVkAccelerationStructureGeometryTrianglesDataKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAccelerationStructureGeometryTrianglesDataKHR moonvulkan_zcheckarraybufVkAccelerationStructureGeometryTrianglesDataKHR
+VkAccelerationStructureGeometryTrianglesDataKHR* zcheckarraybufVkAccelerationStructureGeometryTrianglesDataKHR(lua_State *L, int arg, VkAccelerationStructureGeometryTrianglesDataKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAccelerationStructureGeometryTrianglesDataKHR moonvulkan_zinitVkAccelerationStructureGeometryTrianglesDataKHR
 int zinitVkAccelerationStructureGeometryTrianglesDataKHR(lua_State *L, VkAccelerationStructureGeometryTrianglesDataKHR* p, int *err);
 #define zfreeVkAccelerationStructureGeometryTrianglesDataKHR(L, p, base) zfree((L), (p), (base))
@@ -3919,6 +4608,7 @@ int zpushVkAccelerationStructureGeometryTrianglesDataKHR(lua_State *L, const VkA
 
 #define znewVkAccelerationStructureGeometryAabbsDataKHR(L, err) (VkAccelerationStructureGeometryAabbsDataKHR*)znew((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR, sizeof(VkAccelerationStructureGeometryAabbsDataKHR), (err))
 #define znewarrayVkAccelerationStructureGeometryAabbsDataKHR(L, count, err) (VkAccelerationStructureGeometryAabbsDataKHR*)znewarray((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR, sizeof(VkAccelerationStructureGeometryAabbsDataKHR), (count), (err))
+#define zinitarrayVkAccelerationStructureGeometryAabbsDataKHR(p, count) (VkAccelerationStructureGeometryAabbsDataKHR*)zinitarray((p), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR, sizeof(VkAccelerationStructureGeometryAabbsDataKHR), (count))
 #define znewchainVkAccelerationStructureGeometryAabbsDataKHR moonvulkan_znewchainVkAccelerationStructureGeometryAabbsDataKHR
 VkAccelerationStructureGeometryAabbsDataKHR* znewchainVkAccelerationStructureGeometryAabbsDataKHR(lua_State *L, int *err);
 #define znewchainarrayVkAccelerationStructureGeometryAabbsDataKHR moonvulkan_znewchainarrayVkAccelerationStructureGeometryAabbsDataKHR
@@ -3927,6 +4617,8 @@ VkAccelerationStructureGeometryAabbsDataKHR* znewchainarrayVkAccelerationStructu
 VkAccelerationStructureGeometryAabbsDataKHR* zcheckVkAccelerationStructureGeometryAabbsDataKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAccelerationStructureGeometryAabbsDataKHR moonvulkan_zcheckarrayVkAccelerationStructureGeometryAabbsDataKHR
 VkAccelerationStructureGeometryAabbsDataKHR* zcheckarrayVkAccelerationStructureGeometryAabbsDataKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAccelerationStructureGeometryAabbsDataKHR moonvulkan_zcheckarraybufVkAccelerationStructureGeometryAabbsDataKHR
+VkAccelerationStructureGeometryAabbsDataKHR* zcheckarraybufVkAccelerationStructureGeometryAabbsDataKHR(lua_State *L, int arg, VkAccelerationStructureGeometryAabbsDataKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAccelerationStructureGeometryAabbsDataKHR moonvulkan_zinitVkAccelerationStructureGeometryAabbsDataKHR
 int zinitVkAccelerationStructureGeometryAabbsDataKHR(lua_State *L, VkAccelerationStructureGeometryAabbsDataKHR* p, int *err);
 #define zfreeVkAccelerationStructureGeometryAabbsDataKHR(L, p, base) zfree((L), (p), (base))
@@ -3936,6 +4628,7 @@ int zpushVkAccelerationStructureGeometryAabbsDataKHR(lua_State *L, const VkAccel
 
 #define znewVkAccelerationStructureGeometryInstancesDataKHR(L, err) (VkAccelerationStructureGeometryInstancesDataKHR*)znew((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR, sizeof(VkAccelerationStructureGeometryInstancesDataKHR), (err))
 #define znewarrayVkAccelerationStructureGeometryInstancesDataKHR(L, count, err) (VkAccelerationStructureGeometryInstancesDataKHR*)znewarray((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR, sizeof(VkAccelerationStructureGeometryInstancesDataKHR), (count), (err))
+#define zinitarrayVkAccelerationStructureGeometryInstancesDataKHR(p, count) (VkAccelerationStructureGeometryInstancesDataKHR*)zinitarray((p), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR, sizeof(VkAccelerationStructureGeometryInstancesDataKHR), (count))
 #define znewchainVkAccelerationStructureGeometryInstancesDataKHR moonvulkan_znewchainVkAccelerationStructureGeometryInstancesDataKHR
 VkAccelerationStructureGeometryInstancesDataKHR* znewchainVkAccelerationStructureGeometryInstancesDataKHR(lua_State *L, int *err);
 #define znewchainarrayVkAccelerationStructureGeometryInstancesDataKHR moonvulkan_znewchainarrayVkAccelerationStructureGeometryInstancesDataKHR
@@ -3944,6 +4637,8 @@ VkAccelerationStructureGeometryInstancesDataKHR* znewchainarrayVkAccelerationStr
 VkAccelerationStructureGeometryInstancesDataKHR* zcheckVkAccelerationStructureGeometryInstancesDataKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAccelerationStructureGeometryInstancesDataKHR moonvulkan_zcheckarrayVkAccelerationStructureGeometryInstancesDataKHR
 VkAccelerationStructureGeometryInstancesDataKHR* zcheckarrayVkAccelerationStructureGeometryInstancesDataKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAccelerationStructureGeometryInstancesDataKHR moonvulkan_zcheckarraybufVkAccelerationStructureGeometryInstancesDataKHR
+VkAccelerationStructureGeometryInstancesDataKHR* zcheckarraybufVkAccelerationStructureGeometryInstancesDataKHR(lua_State *L, int arg, VkAccelerationStructureGeometryInstancesDataKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAccelerationStructureGeometryInstancesDataKHR moonvulkan_zinitVkAccelerationStructureGeometryInstancesDataKHR
 int zinitVkAccelerationStructureGeometryInstancesDataKHR(lua_State *L, VkAccelerationStructureGeometryInstancesDataKHR* p, int *err);
 #define zfreeVkAccelerationStructureGeometryInstancesDataKHR(L, p, base) zfree((L), (p), (base))
@@ -3953,6 +4648,7 @@ int zpushVkAccelerationStructureGeometryInstancesDataKHR(lua_State *L, const VkA
 
 #define znewVkAccelerationStructureGeometryKHR(L, err) (VkAccelerationStructureGeometryKHR*)znew((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR, sizeof(VkAccelerationStructureGeometryKHR), (err))
 #define znewarrayVkAccelerationStructureGeometryKHR(L, count, err) (VkAccelerationStructureGeometryKHR*)znewarray((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR, sizeof(VkAccelerationStructureGeometryKHR), (count), (err))
+#define zinitarrayVkAccelerationStructureGeometryKHR(p, count) (VkAccelerationStructureGeometryKHR*)zinitarray((p), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR, sizeof(VkAccelerationStructureGeometryKHR), (count))
 #define znewchainVkAccelerationStructureGeometryKHR moonvulkan_znewchainVkAccelerationStructureGeometryKHR
 VkAccelerationStructureGeometryKHR* znewchainVkAccelerationStructureGeometryKHR(lua_State *L, int *err);
 #define znewchainarrayVkAccelerationStructureGeometryKHR moonvulkan_znewchainarrayVkAccelerationStructureGeometryKHR
@@ -3961,6 +4657,8 @@ VkAccelerationStructureGeometryKHR* znewchainarrayVkAccelerationStructureGeometr
 VkAccelerationStructureGeometryKHR* zcheckVkAccelerationStructureGeometryKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAccelerationStructureGeometryKHR moonvulkan_zcheckarrayVkAccelerationStructureGeometryKHR
 VkAccelerationStructureGeometryKHR* zcheckarrayVkAccelerationStructureGeometryKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAccelerationStructureGeometryKHR moonvulkan_zcheckarraybufVkAccelerationStructureGeometryKHR
+VkAccelerationStructureGeometryKHR* zcheckarraybufVkAccelerationStructureGeometryKHR(lua_State *L, int arg, VkAccelerationStructureGeometryKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAccelerationStructureGeometryKHR moonvulkan_zinitVkAccelerationStructureGeometryKHR
 int zinitVkAccelerationStructureGeometryKHR(lua_State *L, VkAccelerationStructureGeometryKHR* p, int *err);
 #define zfreeVkAccelerationStructureGeometryKHR(L, p, base) zfree((L), (p), (base))
@@ -3970,6 +4668,7 @@ int zpushVkAccelerationStructureGeometryKHR(lua_State *L, const VkAccelerationSt
 
 #define znewVkAccelerationStructureBuildGeometryInfoKHR(L, err) (VkAccelerationStructureBuildGeometryInfoKHR*)znew((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR, sizeof(VkAccelerationStructureBuildGeometryInfoKHR), (err))
 #define znewarrayVkAccelerationStructureBuildGeometryInfoKHR(L, count, err) (VkAccelerationStructureBuildGeometryInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR, sizeof(VkAccelerationStructureBuildGeometryInfoKHR), (count), (err))
+#define zinitarrayVkAccelerationStructureBuildGeometryInfoKHR(p, count) (VkAccelerationStructureBuildGeometryInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR, sizeof(VkAccelerationStructureBuildGeometryInfoKHR), (count))
 #define znewchainVkAccelerationStructureBuildGeometryInfoKHR moonvulkan_znewchainVkAccelerationStructureBuildGeometryInfoKHR
 VkAccelerationStructureBuildGeometryInfoKHR* znewchainVkAccelerationStructureBuildGeometryInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkAccelerationStructureBuildGeometryInfoKHR moonvulkan_znewchainarrayVkAccelerationStructureBuildGeometryInfoKHR
@@ -3978,6 +4677,8 @@ VkAccelerationStructureBuildGeometryInfoKHR* znewchainarrayVkAccelerationStructu
 VkAccelerationStructureBuildGeometryInfoKHR* zcheckVkAccelerationStructureBuildGeometryInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAccelerationStructureBuildGeometryInfoKHR moonvulkan_zcheckarrayVkAccelerationStructureBuildGeometryInfoKHR
 VkAccelerationStructureBuildGeometryInfoKHR* zcheckarrayVkAccelerationStructureBuildGeometryInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAccelerationStructureBuildGeometryInfoKHR moonvulkan_zcheckarraybufVkAccelerationStructureBuildGeometryInfoKHR
+VkAccelerationStructureBuildGeometryInfoKHR* zcheckarraybufVkAccelerationStructureBuildGeometryInfoKHR(lua_State *L, int arg, VkAccelerationStructureBuildGeometryInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAccelerationStructureBuildGeometryInfoKHR moonvulkan_zinitVkAccelerationStructureBuildGeometryInfoKHR
 int zinitVkAccelerationStructureBuildGeometryInfoKHR(lua_State *L, VkAccelerationStructureBuildGeometryInfoKHR* p, int *err);
 #define zfreeVkAccelerationStructureBuildGeometryInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -3987,6 +4688,7 @@ int zpushVkAccelerationStructureBuildGeometryInfoKHR(lua_State *L, const VkAccel
 
 #define znewVkAccelerationStructureCreateInfoKHR(L, err) (VkAccelerationStructureCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR, sizeof(VkAccelerationStructureCreateInfoKHR), (err))
 #define znewarrayVkAccelerationStructureCreateInfoKHR(L, count, err) (VkAccelerationStructureCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR, sizeof(VkAccelerationStructureCreateInfoKHR), (count), (err))
+#define zinitarrayVkAccelerationStructureCreateInfoKHR(p, count) (VkAccelerationStructureCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR, sizeof(VkAccelerationStructureCreateInfoKHR), (count))
 #define znewchainVkAccelerationStructureCreateInfoKHR moonvulkan_znewchainVkAccelerationStructureCreateInfoKHR
 VkAccelerationStructureCreateInfoKHR* znewchainVkAccelerationStructureCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkAccelerationStructureCreateInfoKHR moonvulkan_znewchainarrayVkAccelerationStructureCreateInfoKHR
@@ -3995,6 +4697,8 @@ VkAccelerationStructureCreateInfoKHR* znewchainarrayVkAccelerationStructureCreat
 VkAccelerationStructureCreateInfoKHR* zcheckVkAccelerationStructureCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAccelerationStructureCreateInfoKHR moonvulkan_zcheckarrayVkAccelerationStructureCreateInfoKHR
 VkAccelerationStructureCreateInfoKHR* zcheckarrayVkAccelerationStructureCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAccelerationStructureCreateInfoKHR moonvulkan_zcheckarraybufVkAccelerationStructureCreateInfoKHR
+VkAccelerationStructureCreateInfoKHR* zcheckarraybufVkAccelerationStructureCreateInfoKHR(lua_State *L, int arg, VkAccelerationStructureCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAccelerationStructureCreateInfoKHR moonvulkan_zinitVkAccelerationStructureCreateInfoKHR
 int zinitVkAccelerationStructureCreateInfoKHR(lua_State *L, VkAccelerationStructureCreateInfoKHR* p, int *err);
 #define zfreeVkAccelerationStructureCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4004,6 +4708,7 @@ int zpushVkAccelerationStructureCreateInfoKHR(lua_State *L, const VkAcceleration
 
 #define znewVkWriteDescriptorSetAccelerationStructureKHR(L, err) (VkWriteDescriptorSetAccelerationStructureKHR*)znew((L), VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR, sizeof(VkWriteDescriptorSetAccelerationStructureKHR), (err))
 #define znewarrayVkWriteDescriptorSetAccelerationStructureKHR(L, count, err) (VkWriteDescriptorSetAccelerationStructureKHR*)znewarray((L), VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR, sizeof(VkWriteDescriptorSetAccelerationStructureKHR), (count), (err))
+#define zinitarrayVkWriteDescriptorSetAccelerationStructureKHR(p, count) (VkWriteDescriptorSetAccelerationStructureKHR*)zinitarray((p), VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR, sizeof(VkWriteDescriptorSetAccelerationStructureKHR), (count))
 #define znewchainVkWriteDescriptorSetAccelerationStructureKHR moonvulkan_znewchainVkWriteDescriptorSetAccelerationStructureKHR
 VkWriteDescriptorSetAccelerationStructureKHR* znewchainVkWriteDescriptorSetAccelerationStructureKHR(lua_State *L, int *err);
 #define znewchainarrayVkWriteDescriptorSetAccelerationStructureKHR moonvulkan_znewchainarrayVkWriteDescriptorSetAccelerationStructureKHR
@@ -4012,6 +4717,8 @@ VkWriteDescriptorSetAccelerationStructureKHR* znewchainarrayVkWriteDescriptorSet
 VkWriteDescriptorSetAccelerationStructureKHR* zcheckVkWriteDescriptorSetAccelerationStructureKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkWriteDescriptorSetAccelerationStructureKHR moonvulkan_zcheckarrayVkWriteDescriptorSetAccelerationStructureKHR
 VkWriteDescriptorSetAccelerationStructureKHR* zcheckarrayVkWriteDescriptorSetAccelerationStructureKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkWriteDescriptorSetAccelerationStructureKHR moonvulkan_zcheckarraybufVkWriteDescriptorSetAccelerationStructureKHR
+VkWriteDescriptorSetAccelerationStructureKHR* zcheckarraybufVkWriteDescriptorSetAccelerationStructureKHR(lua_State *L, int arg, VkWriteDescriptorSetAccelerationStructureKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkWriteDescriptorSetAccelerationStructureKHR moonvulkan_zinitVkWriteDescriptorSetAccelerationStructureKHR
 int zinitVkWriteDescriptorSetAccelerationStructureKHR(lua_State *L, VkWriteDescriptorSetAccelerationStructureKHR* p, int *err);
 #define zfreeVkWriteDescriptorSetAccelerationStructureKHR(L, p, base) zfree((L), (p), (base))
@@ -4021,6 +4728,7 @@ int zpushVkWriteDescriptorSetAccelerationStructureKHR(lua_State *L, const VkWrit
 
 #define znewVkAccelerationStructureDeviceAddressInfoKHR(L, err) (VkAccelerationStructureDeviceAddressInfoKHR*)znew((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR, sizeof(VkAccelerationStructureDeviceAddressInfoKHR), (err))
 #define znewarrayVkAccelerationStructureDeviceAddressInfoKHR(L, count, err) (VkAccelerationStructureDeviceAddressInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR, sizeof(VkAccelerationStructureDeviceAddressInfoKHR), (count), (err))
+#define zinitarrayVkAccelerationStructureDeviceAddressInfoKHR(p, count) (VkAccelerationStructureDeviceAddressInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR, sizeof(VkAccelerationStructureDeviceAddressInfoKHR), (count))
 #define znewchainVkAccelerationStructureDeviceAddressInfoKHR moonvulkan_znewchainVkAccelerationStructureDeviceAddressInfoKHR
 VkAccelerationStructureDeviceAddressInfoKHR* znewchainVkAccelerationStructureDeviceAddressInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkAccelerationStructureDeviceAddressInfoKHR moonvulkan_znewchainarrayVkAccelerationStructureDeviceAddressInfoKHR
@@ -4029,6 +4737,8 @@ VkAccelerationStructureDeviceAddressInfoKHR* znewchainarrayVkAccelerationStructu
 VkAccelerationStructureDeviceAddressInfoKHR* zcheckVkAccelerationStructureDeviceAddressInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAccelerationStructureDeviceAddressInfoKHR moonvulkan_zcheckarrayVkAccelerationStructureDeviceAddressInfoKHR
 VkAccelerationStructureDeviceAddressInfoKHR* zcheckarrayVkAccelerationStructureDeviceAddressInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAccelerationStructureDeviceAddressInfoKHR moonvulkan_zcheckarraybufVkAccelerationStructureDeviceAddressInfoKHR
+VkAccelerationStructureDeviceAddressInfoKHR* zcheckarraybufVkAccelerationStructureDeviceAddressInfoKHR(lua_State *L, int arg, VkAccelerationStructureDeviceAddressInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAccelerationStructureDeviceAddressInfoKHR moonvulkan_zinitVkAccelerationStructureDeviceAddressInfoKHR
 int zinitVkAccelerationStructureDeviceAddressInfoKHR(lua_State *L, VkAccelerationStructureDeviceAddressInfoKHR* p, int *err);
 #define zfreeVkAccelerationStructureDeviceAddressInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4038,6 +4748,7 @@ int zpushVkAccelerationStructureDeviceAddressInfoKHR(lua_State *L, const VkAccel
 
 #define znewVkAccelerationStructureVersionInfoKHR(L, err) (VkAccelerationStructureVersionInfoKHR*)znew((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_VERSION_INFO_KHR, sizeof(VkAccelerationStructureVersionInfoKHR), (err))
 #define znewarrayVkAccelerationStructureVersionInfoKHR(L, count, err) (VkAccelerationStructureVersionInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_VERSION_INFO_KHR, sizeof(VkAccelerationStructureVersionInfoKHR), (count), (err))
+#define zinitarrayVkAccelerationStructureVersionInfoKHR(p, count) (VkAccelerationStructureVersionInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_VERSION_INFO_KHR, sizeof(VkAccelerationStructureVersionInfoKHR), (count))
 #define znewchainVkAccelerationStructureVersionInfoKHR moonvulkan_znewchainVkAccelerationStructureVersionInfoKHR
 VkAccelerationStructureVersionInfoKHR* znewchainVkAccelerationStructureVersionInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkAccelerationStructureVersionInfoKHR moonvulkan_znewchainarrayVkAccelerationStructureVersionInfoKHR
@@ -4046,6 +4757,8 @@ VkAccelerationStructureVersionInfoKHR* znewchainarrayVkAccelerationStructureVers
 VkAccelerationStructureVersionInfoKHR* zcheckVkAccelerationStructureVersionInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAccelerationStructureVersionInfoKHR moonvulkan_zcheckarrayVkAccelerationStructureVersionInfoKHR
 VkAccelerationStructureVersionInfoKHR* zcheckarrayVkAccelerationStructureVersionInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAccelerationStructureVersionInfoKHR moonvulkan_zcheckarraybufVkAccelerationStructureVersionInfoKHR
+VkAccelerationStructureVersionInfoKHR* zcheckarraybufVkAccelerationStructureVersionInfoKHR(lua_State *L, int arg, VkAccelerationStructureVersionInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAccelerationStructureVersionInfoKHR moonvulkan_zinitVkAccelerationStructureVersionInfoKHR
 int zinitVkAccelerationStructureVersionInfoKHR(lua_State *L, VkAccelerationStructureVersionInfoKHR* p, int *err);
 #define zfreeVkAccelerationStructureVersionInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4055,6 +4768,7 @@ int zpushVkAccelerationStructureVersionInfoKHR(lua_State *L, const VkAcceleratio
 
 #define znewVkCopyAccelerationStructureToMemoryInfoKHR(L, err) (VkCopyAccelerationStructureToMemoryInfoKHR*)znew((L), VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_TO_MEMORY_INFO_KHR, sizeof(VkCopyAccelerationStructureToMemoryInfoKHR), (err))
 #define znewarrayVkCopyAccelerationStructureToMemoryInfoKHR(L, count, err) (VkCopyAccelerationStructureToMemoryInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_TO_MEMORY_INFO_KHR, sizeof(VkCopyAccelerationStructureToMemoryInfoKHR), (count), (err))
+#define zinitarrayVkCopyAccelerationStructureToMemoryInfoKHR(p, count) (VkCopyAccelerationStructureToMemoryInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_TO_MEMORY_INFO_KHR, sizeof(VkCopyAccelerationStructureToMemoryInfoKHR), (count))
 #define znewchainVkCopyAccelerationStructureToMemoryInfoKHR moonvulkan_znewchainVkCopyAccelerationStructureToMemoryInfoKHR
 VkCopyAccelerationStructureToMemoryInfoKHR* znewchainVkCopyAccelerationStructureToMemoryInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkCopyAccelerationStructureToMemoryInfoKHR moonvulkan_znewchainarrayVkCopyAccelerationStructureToMemoryInfoKHR
@@ -4063,6 +4777,8 @@ VkCopyAccelerationStructureToMemoryInfoKHR* znewchainarrayVkCopyAccelerationStru
 VkCopyAccelerationStructureToMemoryInfoKHR* zcheckVkCopyAccelerationStructureToMemoryInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCopyAccelerationStructureToMemoryInfoKHR moonvulkan_zcheckarrayVkCopyAccelerationStructureToMemoryInfoKHR
 VkCopyAccelerationStructureToMemoryInfoKHR* zcheckarrayVkCopyAccelerationStructureToMemoryInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCopyAccelerationStructureToMemoryInfoKHR moonvulkan_zcheckarraybufVkCopyAccelerationStructureToMemoryInfoKHR
+VkCopyAccelerationStructureToMemoryInfoKHR* zcheckarraybufVkCopyAccelerationStructureToMemoryInfoKHR(lua_State *L, int arg, VkCopyAccelerationStructureToMemoryInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCopyAccelerationStructureToMemoryInfoKHR moonvulkan_zinitVkCopyAccelerationStructureToMemoryInfoKHR
 int zinitVkCopyAccelerationStructureToMemoryInfoKHR(lua_State *L, VkCopyAccelerationStructureToMemoryInfoKHR* p, int *err);
 #define zfreeVkCopyAccelerationStructureToMemoryInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4072,6 +4788,7 @@ int zpushVkCopyAccelerationStructureToMemoryInfoKHR(lua_State *L, const VkCopyAc
 
 #define znewVkCopyMemoryToAccelerationStructureInfoKHR(L, err) (VkCopyMemoryToAccelerationStructureInfoKHR*)znew((L), VK_STRUCTURE_TYPE_COPY_MEMORY_TO_ACCELERATION_STRUCTURE_INFO_KHR, sizeof(VkCopyMemoryToAccelerationStructureInfoKHR), (err))
 #define znewarrayVkCopyMemoryToAccelerationStructureInfoKHR(L, count, err) (VkCopyMemoryToAccelerationStructureInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_COPY_MEMORY_TO_ACCELERATION_STRUCTURE_INFO_KHR, sizeof(VkCopyMemoryToAccelerationStructureInfoKHR), (count), (err))
+#define zinitarrayVkCopyMemoryToAccelerationStructureInfoKHR(p, count) (VkCopyMemoryToAccelerationStructureInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_COPY_MEMORY_TO_ACCELERATION_STRUCTURE_INFO_KHR, sizeof(VkCopyMemoryToAccelerationStructureInfoKHR), (count))
 #define znewchainVkCopyMemoryToAccelerationStructureInfoKHR moonvulkan_znewchainVkCopyMemoryToAccelerationStructureInfoKHR
 VkCopyMemoryToAccelerationStructureInfoKHR* znewchainVkCopyMemoryToAccelerationStructureInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkCopyMemoryToAccelerationStructureInfoKHR moonvulkan_znewchainarrayVkCopyMemoryToAccelerationStructureInfoKHR
@@ -4080,6 +4797,8 @@ VkCopyMemoryToAccelerationStructureInfoKHR* znewchainarrayVkCopyMemoryToAccelera
 VkCopyMemoryToAccelerationStructureInfoKHR* zcheckVkCopyMemoryToAccelerationStructureInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCopyMemoryToAccelerationStructureInfoKHR moonvulkan_zcheckarrayVkCopyMemoryToAccelerationStructureInfoKHR
 VkCopyMemoryToAccelerationStructureInfoKHR* zcheckarrayVkCopyMemoryToAccelerationStructureInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCopyMemoryToAccelerationStructureInfoKHR moonvulkan_zcheckarraybufVkCopyMemoryToAccelerationStructureInfoKHR
+VkCopyMemoryToAccelerationStructureInfoKHR* zcheckarraybufVkCopyMemoryToAccelerationStructureInfoKHR(lua_State *L, int arg, VkCopyMemoryToAccelerationStructureInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCopyMemoryToAccelerationStructureInfoKHR moonvulkan_zinitVkCopyMemoryToAccelerationStructureInfoKHR
 int zinitVkCopyMemoryToAccelerationStructureInfoKHR(lua_State *L, VkCopyMemoryToAccelerationStructureInfoKHR* p, int *err);
 #define zfreeVkCopyMemoryToAccelerationStructureInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4089,6 +4808,7 @@ int zpushVkCopyMemoryToAccelerationStructureInfoKHR(lua_State *L, const VkCopyMe
 
 #define znewVkCopyAccelerationStructureInfoKHR(L, err) (VkCopyAccelerationStructureInfoKHR*)znew((L), VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR, sizeof(VkCopyAccelerationStructureInfoKHR), (err))
 #define znewarrayVkCopyAccelerationStructureInfoKHR(L, count, err) (VkCopyAccelerationStructureInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR, sizeof(VkCopyAccelerationStructureInfoKHR), (count), (err))
+#define zinitarrayVkCopyAccelerationStructureInfoKHR(p, count) (VkCopyAccelerationStructureInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR, sizeof(VkCopyAccelerationStructureInfoKHR), (count))
 #define znewchainVkCopyAccelerationStructureInfoKHR moonvulkan_znewchainVkCopyAccelerationStructureInfoKHR
 VkCopyAccelerationStructureInfoKHR* znewchainVkCopyAccelerationStructureInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkCopyAccelerationStructureInfoKHR moonvulkan_znewchainarrayVkCopyAccelerationStructureInfoKHR
@@ -4097,6 +4817,8 @@ VkCopyAccelerationStructureInfoKHR* znewchainarrayVkCopyAccelerationStructureInf
 VkCopyAccelerationStructureInfoKHR* zcheckVkCopyAccelerationStructureInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCopyAccelerationStructureInfoKHR moonvulkan_zcheckarrayVkCopyAccelerationStructureInfoKHR
 VkCopyAccelerationStructureInfoKHR* zcheckarrayVkCopyAccelerationStructureInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCopyAccelerationStructureInfoKHR moonvulkan_zcheckarraybufVkCopyAccelerationStructureInfoKHR
+VkCopyAccelerationStructureInfoKHR* zcheckarraybufVkCopyAccelerationStructureInfoKHR(lua_State *L, int arg, VkCopyAccelerationStructureInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCopyAccelerationStructureInfoKHR moonvulkan_zinitVkCopyAccelerationStructureInfoKHR
 int zinitVkCopyAccelerationStructureInfoKHR(lua_State *L, VkCopyAccelerationStructureInfoKHR* p, int *err);
 #define zfreeVkCopyAccelerationStructureInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4106,6 +4828,7 @@ int zpushVkCopyAccelerationStructureInfoKHR(lua_State *L, const VkCopyAccelerati
 
 #define znewVkAccelerationStructureBuildSizesInfoKHR(L, err) (VkAccelerationStructureBuildSizesInfoKHR*)znew((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR, sizeof(VkAccelerationStructureBuildSizesInfoKHR), (err))
 #define znewarrayVkAccelerationStructureBuildSizesInfoKHR(L, count, err) (VkAccelerationStructureBuildSizesInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR, sizeof(VkAccelerationStructureBuildSizesInfoKHR), (count), (err))
+#define zinitarrayVkAccelerationStructureBuildSizesInfoKHR(p, count) (VkAccelerationStructureBuildSizesInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR, sizeof(VkAccelerationStructureBuildSizesInfoKHR), (count))
 #define znewchainVkAccelerationStructureBuildSizesInfoKHR moonvulkan_znewchainVkAccelerationStructureBuildSizesInfoKHR
 VkAccelerationStructureBuildSizesInfoKHR* znewchainVkAccelerationStructureBuildSizesInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkAccelerationStructureBuildSizesInfoKHR moonvulkan_znewchainarrayVkAccelerationStructureBuildSizesInfoKHR
@@ -4114,6 +4837,8 @@ VkAccelerationStructureBuildSizesInfoKHR* znewchainarrayVkAccelerationStructureB
 VkAccelerationStructureBuildSizesInfoKHR* zcheckVkAccelerationStructureBuildSizesInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAccelerationStructureBuildSizesInfoKHR moonvulkan_zcheckarrayVkAccelerationStructureBuildSizesInfoKHR
 VkAccelerationStructureBuildSizesInfoKHR* zcheckarrayVkAccelerationStructureBuildSizesInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAccelerationStructureBuildSizesInfoKHR moonvulkan_zcheckarraybufVkAccelerationStructureBuildSizesInfoKHR
+VkAccelerationStructureBuildSizesInfoKHR* zcheckarraybufVkAccelerationStructureBuildSizesInfoKHR(lua_State *L, int arg, VkAccelerationStructureBuildSizesInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAccelerationStructureBuildSizesInfoKHR moonvulkan_zinitVkAccelerationStructureBuildSizesInfoKHR
 int zinitVkAccelerationStructureBuildSizesInfoKHR(lua_State *L, VkAccelerationStructureBuildSizesInfoKHR* p, int *err);
 #define zfreeVkAccelerationStructureBuildSizesInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4123,6 +4848,7 @@ int zpushVkAccelerationStructureBuildSizesInfoKHR(lua_State *L, const VkAccelera
 
 #define znewVkRayTracingShaderGroupCreateInfoKHR(L, err) (VkRayTracingShaderGroupCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_KHR, sizeof(VkRayTracingShaderGroupCreateInfoKHR), (err))
 #define znewarrayVkRayTracingShaderGroupCreateInfoKHR(L, count, err) (VkRayTracingShaderGroupCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_KHR, sizeof(VkRayTracingShaderGroupCreateInfoKHR), (count), (err))
+#define zinitarrayVkRayTracingShaderGroupCreateInfoKHR(p, count) (VkRayTracingShaderGroupCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_KHR, sizeof(VkRayTracingShaderGroupCreateInfoKHR), (count))
 #define znewchainVkRayTracingShaderGroupCreateInfoKHR moonvulkan_znewchainVkRayTracingShaderGroupCreateInfoKHR
 VkRayTracingShaderGroupCreateInfoKHR* znewchainVkRayTracingShaderGroupCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkRayTracingShaderGroupCreateInfoKHR moonvulkan_znewchainarrayVkRayTracingShaderGroupCreateInfoKHR
@@ -4131,6 +4857,8 @@ VkRayTracingShaderGroupCreateInfoKHR* znewchainarrayVkRayTracingShaderGroupCreat
 VkRayTracingShaderGroupCreateInfoKHR* zcheckVkRayTracingShaderGroupCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRayTracingShaderGroupCreateInfoKHR moonvulkan_zcheckarrayVkRayTracingShaderGroupCreateInfoKHR
 VkRayTracingShaderGroupCreateInfoKHR* zcheckarrayVkRayTracingShaderGroupCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRayTracingShaderGroupCreateInfoKHR moonvulkan_zcheckarraybufVkRayTracingShaderGroupCreateInfoKHR
+VkRayTracingShaderGroupCreateInfoKHR* zcheckarraybufVkRayTracingShaderGroupCreateInfoKHR(lua_State *L, int arg, VkRayTracingShaderGroupCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRayTracingShaderGroupCreateInfoKHR moonvulkan_zinitVkRayTracingShaderGroupCreateInfoKHR
 int zinitVkRayTracingShaderGroupCreateInfoKHR(lua_State *L, VkRayTracingShaderGroupCreateInfoKHR* p, int *err);
 #define zfreeVkRayTracingShaderGroupCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4140,6 +4868,7 @@ int zpushVkRayTracingShaderGroupCreateInfoKHR(lua_State *L, const VkRayTracingSh
 
 #define znewVkRayTracingPipelineInterfaceCreateInfoKHR(L, err) (VkRayTracingPipelineInterfaceCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_INTERFACE_CREATE_INFO_KHR, sizeof(VkRayTracingPipelineInterfaceCreateInfoKHR), (err))
 #define znewarrayVkRayTracingPipelineInterfaceCreateInfoKHR(L, count, err) (VkRayTracingPipelineInterfaceCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_INTERFACE_CREATE_INFO_KHR, sizeof(VkRayTracingPipelineInterfaceCreateInfoKHR), (count), (err))
+#define zinitarrayVkRayTracingPipelineInterfaceCreateInfoKHR(p, count) (VkRayTracingPipelineInterfaceCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_INTERFACE_CREATE_INFO_KHR, sizeof(VkRayTracingPipelineInterfaceCreateInfoKHR), (count))
 #define znewchainVkRayTracingPipelineInterfaceCreateInfoKHR moonvulkan_znewchainVkRayTracingPipelineInterfaceCreateInfoKHR
 VkRayTracingPipelineInterfaceCreateInfoKHR* znewchainVkRayTracingPipelineInterfaceCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkRayTracingPipelineInterfaceCreateInfoKHR moonvulkan_znewchainarrayVkRayTracingPipelineInterfaceCreateInfoKHR
@@ -4148,6 +4877,8 @@ VkRayTracingPipelineInterfaceCreateInfoKHR* znewchainarrayVkRayTracingPipelineIn
 VkRayTracingPipelineInterfaceCreateInfoKHR* zcheckVkRayTracingPipelineInterfaceCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRayTracingPipelineInterfaceCreateInfoKHR moonvulkan_zcheckarrayVkRayTracingPipelineInterfaceCreateInfoKHR
 VkRayTracingPipelineInterfaceCreateInfoKHR* zcheckarrayVkRayTracingPipelineInterfaceCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRayTracingPipelineInterfaceCreateInfoKHR moonvulkan_zcheckarraybufVkRayTracingPipelineInterfaceCreateInfoKHR
+VkRayTracingPipelineInterfaceCreateInfoKHR* zcheckarraybufVkRayTracingPipelineInterfaceCreateInfoKHR(lua_State *L, int arg, VkRayTracingPipelineInterfaceCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRayTracingPipelineInterfaceCreateInfoKHR moonvulkan_zinitVkRayTracingPipelineInterfaceCreateInfoKHR
 int zinitVkRayTracingPipelineInterfaceCreateInfoKHR(lua_State *L, VkRayTracingPipelineInterfaceCreateInfoKHR* p, int *err);
 #define zfreeVkRayTracingPipelineInterfaceCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4157,6 +4888,7 @@ int zpushVkRayTracingPipelineInterfaceCreateInfoKHR(lua_State *L, const VkRayTra
 
 #define znewVkRayTracingPipelineCreateInfoKHR(L, err) (VkRayTracingPipelineCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR, sizeof(VkRayTracingPipelineCreateInfoKHR), (err))
 #define znewarrayVkRayTracingPipelineCreateInfoKHR(L, count, err) (VkRayTracingPipelineCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR, sizeof(VkRayTracingPipelineCreateInfoKHR), (count), (err))
+#define zinitarrayVkRayTracingPipelineCreateInfoKHR(p, count) (VkRayTracingPipelineCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR, sizeof(VkRayTracingPipelineCreateInfoKHR), (count))
 #define znewchainVkRayTracingPipelineCreateInfoKHR moonvulkan_znewchainVkRayTracingPipelineCreateInfoKHR
 VkRayTracingPipelineCreateInfoKHR* znewchainVkRayTracingPipelineCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkRayTracingPipelineCreateInfoKHR moonvulkan_znewchainarrayVkRayTracingPipelineCreateInfoKHR
@@ -4165,6 +4897,8 @@ VkRayTracingPipelineCreateInfoKHR* znewchainarrayVkRayTracingPipelineCreateInfoK
 VkRayTracingPipelineCreateInfoKHR* zcheckVkRayTracingPipelineCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRayTracingPipelineCreateInfoKHR moonvulkan_zcheckarrayVkRayTracingPipelineCreateInfoKHR
 VkRayTracingPipelineCreateInfoKHR* zcheckarrayVkRayTracingPipelineCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRayTracingPipelineCreateInfoKHR moonvulkan_zcheckarraybufVkRayTracingPipelineCreateInfoKHR
+VkRayTracingPipelineCreateInfoKHR* zcheckarraybufVkRayTracingPipelineCreateInfoKHR(lua_State *L, int arg, VkRayTracingPipelineCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRayTracingPipelineCreateInfoKHR moonvulkan_zinitVkRayTracingPipelineCreateInfoKHR
 int zinitVkRayTracingPipelineCreateInfoKHR(lua_State *L, VkRayTracingPipelineCreateInfoKHR* p, int *err);
 #define zfreeVkRayTracingPipelineCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4174,6 +4908,7 @@ int zpushVkRayTracingPipelineCreateInfoKHR(lua_State *L, const VkRayTracingPipel
 
 #define znewVkTraceRaysIndirectCommandKHR(L, err) (VkTraceRaysIndirectCommandKHR*)znew((L), VK_STRUCTURE_TYPE_TRACE_RAYS_INDIRECT_COMMAND_KHR, sizeof(VkTraceRaysIndirectCommandKHR), (err))
 #define znewarrayVkTraceRaysIndirectCommandKHR(L, count, err) (VkTraceRaysIndirectCommandKHR*)znewarray((L), VK_STRUCTURE_TYPE_TRACE_RAYS_INDIRECT_COMMAND_KHR, sizeof(VkTraceRaysIndirectCommandKHR), (count), (err))
+#define zinitarrayVkTraceRaysIndirectCommandKHR(p, count) (VkTraceRaysIndirectCommandKHR*)zinitarray((p), VK_STRUCTURE_TYPE_TRACE_RAYS_INDIRECT_COMMAND_KHR, sizeof(VkTraceRaysIndirectCommandKHR), (count))
 #define znewchainVkTraceRaysIndirectCommandKHR moonvulkan_znewchainVkTraceRaysIndirectCommandKHR
 VkTraceRaysIndirectCommandKHR* znewchainVkTraceRaysIndirectCommandKHR(lua_State *L, int *err);
 #define znewchainarrayVkTraceRaysIndirectCommandKHR moonvulkan_znewchainarrayVkTraceRaysIndirectCommandKHR
@@ -4182,6 +4917,8 @@ VkTraceRaysIndirectCommandKHR* znewchainarrayVkTraceRaysIndirectCommandKHR(lua_S
 VkTraceRaysIndirectCommandKHR* zcheckVkTraceRaysIndirectCommandKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkTraceRaysIndirectCommandKHR moonvulkan_zcheckarrayVkTraceRaysIndirectCommandKHR
 VkTraceRaysIndirectCommandKHR* zcheckarrayVkTraceRaysIndirectCommandKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkTraceRaysIndirectCommandKHR moonvulkan_zcheckarraybufVkTraceRaysIndirectCommandKHR
+VkTraceRaysIndirectCommandKHR* zcheckarraybufVkTraceRaysIndirectCommandKHR(lua_State *L, int arg, VkTraceRaysIndirectCommandKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkTraceRaysIndirectCommandKHR moonvulkan_zinitVkTraceRaysIndirectCommandKHR
 int zinitVkTraceRaysIndirectCommandKHR(lua_State *L, VkTraceRaysIndirectCommandKHR* p, int *err);
 #define zfreeVkTraceRaysIndirectCommandKHR(L, p, base) zfree((L), (p), (base))
@@ -4191,6 +4928,7 @@ int zpushVkTraceRaysIndirectCommandKHR(lua_State *L, const VkTraceRaysIndirectCo
 
 #define znewVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT(L, err) (VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO_EXT, sizeof(VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT), (err))
 #define znewarrayVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT(L, count, err) (VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO_EXT, sizeof(VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT), (count), (err))
+#define zinitarrayVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT(p, count) (VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO_EXT, sizeof(VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT), (count))
 #define znewchainVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT moonvulkan_znewchainVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT
 VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT* znewchainVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT moonvulkan_znewchainarrayVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT
@@ -4199,6 +4937,8 @@ VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT* znewchainarrayVkPipeline
 VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT* zcheckVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT moonvulkan_zcheckarrayVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT
 VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT* zcheckarrayVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT moonvulkan_zcheckarraybufVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT
+VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT* zcheckarraybufVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT(lua_State *L, int arg, VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT moonvulkan_zinitVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT
 int zinitVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT(lua_State *L, VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT* p, int *err);
 #define zfreeVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -4208,6 +4948,7 @@ int zpushVkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT(lua_State *L, co
 
 #define znewVkPhysicalDeviceToolPropertiesEXT(L, err) (VkPhysicalDeviceToolPropertiesEXT*)znew((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES_EXT, sizeof(VkPhysicalDeviceToolPropertiesEXT), (err))
 #define znewarrayVkPhysicalDeviceToolPropertiesEXT(L, count, err) (VkPhysicalDeviceToolPropertiesEXT*)znewarray((L), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES_EXT, sizeof(VkPhysicalDeviceToolPropertiesEXT), (count), (err))
+#define zinitarrayVkPhysicalDeviceToolPropertiesEXT(p, count) (VkPhysicalDeviceToolPropertiesEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES_EXT, sizeof(VkPhysicalDeviceToolPropertiesEXT), (count))
 #define znewchainVkPhysicalDeviceToolPropertiesEXT moonvulkan_znewchainVkPhysicalDeviceToolPropertiesEXT
 VkPhysicalDeviceToolPropertiesEXT* znewchainVkPhysicalDeviceToolPropertiesEXT(lua_State *L, int *err);
 #define znewchainarrayVkPhysicalDeviceToolPropertiesEXT moonvulkan_znewchainarrayVkPhysicalDeviceToolPropertiesEXT
@@ -4216,6 +4957,8 @@ VkPhysicalDeviceToolPropertiesEXT* znewchainarrayVkPhysicalDeviceToolPropertiesE
 VkPhysicalDeviceToolPropertiesEXT* zcheckVkPhysicalDeviceToolPropertiesEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceToolPropertiesEXT moonvulkan_zcheckarrayVkPhysicalDeviceToolPropertiesEXT
 VkPhysicalDeviceToolPropertiesEXT* zcheckarrayVkPhysicalDeviceToolPropertiesEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceToolPropertiesEXT moonvulkan_zcheckarraybufVkPhysicalDeviceToolPropertiesEXT
+VkPhysicalDeviceToolPropertiesEXT* zcheckarraybufVkPhysicalDeviceToolPropertiesEXT(lua_State *L, int arg, VkPhysicalDeviceToolPropertiesEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceToolPropertiesEXT moonvulkan_zinitVkPhysicalDeviceToolPropertiesEXT
 int zinitVkPhysicalDeviceToolPropertiesEXT(lua_State *L, VkPhysicalDeviceToolPropertiesEXT* p, int *err);
 #define zfreeVkPhysicalDeviceToolPropertiesEXT(L, p, base) zfree((L), (p), (base))
@@ -4225,6 +4968,7 @@ int zpushVkPhysicalDeviceToolPropertiesEXT(lua_State *L, const VkPhysicalDeviceT
 
 #define znewVkPipelineRasterizationProvokingVertexStateCreateInfoEXT(L, err) (VkPipelineRasterizationProvokingVertexStateCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationProvokingVertexStateCreateInfoEXT), (err))
 #define znewarrayVkPipelineRasterizationProvokingVertexStateCreateInfoEXT(L, count, err) (VkPipelineRasterizationProvokingVertexStateCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationProvokingVertexStateCreateInfoEXT), (count), (err))
+#define zinitarrayVkPipelineRasterizationProvokingVertexStateCreateInfoEXT(p, count) (VkPipelineRasterizationProvokingVertexStateCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationProvokingVertexStateCreateInfoEXT), (count))
 #define znewchainVkPipelineRasterizationProvokingVertexStateCreateInfoEXT moonvulkan_znewchainVkPipelineRasterizationProvokingVertexStateCreateInfoEXT
 VkPipelineRasterizationProvokingVertexStateCreateInfoEXT* znewchainVkPipelineRasterizationProvokingVertexStateCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPipelineRasterizationProvokingVertexStateCreateInfoEXT moonvulkan_znewchainarrayVkPipelineRasterizationProvokingVertexStateCreateInfoEXT
@@ -4233,6 +4977,8 @@ VkPipelineRasterizationProvokingVertexStateCreateInfoEXT* znewchainarrayVkPipeli
 VkPipelineRasterizationProvokingVertexStateCreateInfoEXT* zcheckVkPipelineRasterizationProvokingVertexStateCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineRasterizationProvokingVertexStateCreateInfoEXT moonvulkan_zcheckarrayVkPipelineRasterizationProvokingVertexStateCreateInfoEXT
 VkPipelineRasterizationProvokingVertexStateCreateInfoEXT* zcheckarrayVkPipelineRasterizationProvokingVertexStateCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineRasterizationProvokingVertexStateCreateInfoEXT moonvulkan_zcheckarraybufVkPipelineRasterizationProvokingVertexStateCreateInfoEXT
+VkPipelineRasterizationProvokingVertexStateCreateInfoEXT* zcheckarraybufVkPipelineRasterizationProvokingVertexStateCreateInfoEXT(lua_State *L, int arg, VkPipelineRasterizationProvokingVertexStateCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineRasterizationProvokingVertexStateCreateInfoEXT moonvulkan_zinitVkPipelineRasterizationProvokingVertexStateCreateInfoEXT
 int zinitVkPipelineRasterizationProvokingVertexStateCreateInfoEXT(lua_State *L, VkPipelineRasterizationProvokingVertexStateCreateInfoEXT* p, int *err);
 #define zfreeVkPipelineRasterizationProvokingVertexStateCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -4242,6 +4988,7 @@ int zpushVkPipelineRasterizationProvokingVertexStateCreateInfoEXT(lua_State *L,
 
 #define znewVkPipelineRasterizationLineStateCreateInfoEXT(L, err) (VkPipelineRasterizationLineStateCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationLineStateCreateInfoEXT), (err))
 #define znewarrayVkPipelineRasterizationLineStateCreateInfoEXT(L, count, err) (VkPipelineRasterizationLineStateCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationLineStateCreateInfoEXT), (count), (err))
+#define zinitarrayVkPipelineRasterizationLineStateCreateInfoEXT(p, count) (VkPipelineRasterizationLineStateCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT, sizeof(VkPipelineRasterizationLineStateCreateInfoEXT), (count))
 #define znewchainVkPipelineRasterizationLineStateCreateInfoEXT moonvulkan_znewchainVkPipelineRasterizationLineStateCreateInfoEXT
 VkPipelineRasterizationLineStateCreateInfoEXT* znewchainVkPipelineRasterizationLineStateCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPipelineRasterizationLineStateCreateInfoEXT moonvulkan_znewchainarrayVkPipelineRasterizationLineStateCreateInfoEXT
@@ -4250,6 +4997,8 @@ VkPipelineRasterizationLineStateCreateInfoEXT* znewchainarrayVkPipelineRasteriza
 VkPipelineRasterizationLineStateCreateInfoEXT* zcheckVkPipelineRasterizationLineStateCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineRasterizationLineStateCreateInfoEXT moonvulkan_zcheckarrayVkPipelineRasterizationLineStateCreateInfoEXT
 VkPipelineRasterizationLineStateCreateInfoEXT* zcheckarrayVkPipelineRasterizationLineStateCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineRasterizationLineStateCreateInfoEXT moonvulkan_zcheckarraybufVkPipelineRasterizationLineStateCreateInfoEXT
+VkPipelineRasterizationLineStateCreateInfoEXT* zcheckarraybufVkPipelineRasterizationLineStateCreateInfoEXT(lua_State *L, int arg, VkPipelineRasterizationLineStateCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineRasterizationLineStateCreateInfoEXT moonvulkan_zinitVkPipelineRasterizationLineStateCreateInfoEXT
 int zinitVkPipelineRasterizationLineStateCreateInfoEXT(lua_State *L, VkPipelineRasterizationLineStateCreateInfoEXT* p, int *err);
 #define zfreeVkPipelineRasterizationLineStateCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -4259,6 +5008,7 @@ int zpushVkPipelineRasterizationLineStateCreateInfoEXT(lua_State *L, const VkPip
 
 #define znewVkDeviceMemoryReportCallbackDataEXT(L, err) (VkDeviceMemoryReportCallbackDataEXT*)znew((L), VK_STRUCTURE_TYPE_DEVICE_MEMORY_REPORT_CALLBACK_DATA_EXT, sizeof(VkDeviceMemoryReportCallbackDataEXT), (err))
 #define znewarrayVkDeviceMemoryReportCallbackDataEXT(L, count, err) (VkDeviceMemoryReportCallbackDataEXT*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_MEMORY_REPORT_CALLBACK_DATA_EXT, sizeof(VkDeviceMemoryReportCallbackDataEXT), (count), (err))
+#define zinitarrayVkDeviceMemoryReportCallbackDataEXT(p, count) (VkDeviceMemoryReportCallbackDataEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_MEMORY_REPORT_CALLBACK_DATA_EXT, sizeof(VkDeviceMemoryReportCallbackDataEXT), (count))
 #define znewchainVkDeviceMemoryReportCallbackDataEXT moonvulkan_znewchainVkDeviceMemoryReportCallbackDataEXT
 VkDeviceMemoryReportCallbackDataEXT* znewchainVkDeviceMemoryReportCallbackDataEXT(lua_State *L, int *err);
 #define znewchainarrayVkDeviceMemoryReportCallbackDataEXT moonvulkan_znewchainarrayVkDeviceMemoryReportCallbackDataEXT
@@ -4267,6 +5017,8 @@ VkDeviceMemoryReportCallbackDataEXT* znewchainarrayVkDeviceMemoryReportCallbackD
 VkDeviceMemoryReportCallbackDataEXT* zcheckVkDeviceMemoryReportCallbackDataEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceMemoryReportCallbackDataEXT moonvulkan_zcheckarrayVkDeviceMemoryReportCallbackDataEXT
 VkDeviceMemoryReportCallbackDataEXT* zcheckarrayVkDeviceMemoryReportCallbackDataEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceMemoryReportCallbackDataEXT moonvulkan_zcheckarraybufVkDeviceMemoryReportCallbackDataEXT
+VkDeviceMemoryReportCallbackDataEXT* zcheckarraybufVkDeviceMemoryReportCallbackDataEXT(lua_State *L, int arg, VkDeviceMemoryReportCallbackDataEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceMemoryReportCallbackDataEXT moonvulkan_zinitVkDeviceMemoryReportCallbackDataEXT
 int zinitVkDeviceMemoryReportCallbackDataEXT(lua_State *L, VkDeviceMemoryReportCallbackDataEXT* p, int *err);
 #define zfreeVkDeviceMemoryReportCallbackDataEXT(L, p, base) zfree((L), (p), (base))
@@ -4276,6 +5028,7 @@ int zpushVkDeviceMemoryReportCallbackDataEXT(lua_State *L, const VkDeviceMemoryR
 
 #define znewVkDeviceDeviceMemoryReportCreateInfoEXT(L, err) (VkDeviceDeviceMemoryReportCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT, sizeof(VkDeviceDeviceMemoryReportCreateInfoEXT), (err))
 #define znewarrayVkDeviceDeviceMemoryReportCreateInfoEXT(L, count, err) (VkDeviceDeviceMemoryReportCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT, sizeof(VkDeviceDeviceMemoryReportCreateInfoEXT), (count), (err))
+#define zinitarrayVkDeviceDeviceMemoryReportCreateInfoEXT(p, count) (VkDeviceDeviceMemoryReportCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT, sizeof(VkDeviceDeviceMemoryReportCreateInfoEXT), (count))
 #define znewchainVkDeviceDeviceMemoryReportCreateInfoEXT moonvulkan_znewchainVkDeviceDeviceMemoryReportCreateInfoEXT
 VkDeviceDeviceMemoryReportCreateInfoEXT* znewchainVkDeviceDeviceMemoryReportCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkDeviceDeviceMemoryReportCreateInfoEXT moonvulkan_znewchainarrayVkDeviceDeviceMemoryReportCreateInfoEXT
@@ -4284,6 +5037,8 @@ VkDeviceDeviceMemoryReportCreateInfoEXT* znewchainarrayVkDeviceDeviceMemoryRepor
 VkDeviceDeviceMemoryReportCreateInfoEXT* zcheckVkDeviceDeviceMemoryReportCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceDeviceMemoryReportCreateInfoEXT moonvulkan_zcheckarrayVkDeviceDeviceMemoryReportCreateInfoEXT
 VkDeviceDeviceMemoryReportCreateInfoEXT* zcheckarrayVkDeviceDeviceMemoryReportCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceDeviceMemoryReportCreateInfoEXT moonvulkan_zcheckarraybufVkDeviceDeviceMemoryReportCreateInfoEXT
+VkDeviceDeviceMemoryReportCreateInfoEXT* zcheckarraybufVkDeviceDeviceMemoryReportCreateInfoEXT(lua_State *L, int arg, VkDeviceDeviceMemoryReportCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceDeviceMemoryReportCreateInfoEXT moonvulkan_zinitVkDeviceDeviceMemoryReportCreateInfoEXT
 int zinitVkDeviceDeviceMemoryReportCreateInfoEXT(lua_State *L, VkDeviceDeviceMemoryReportCreateInfoEXT* p, int *err);
 #define zfreeVkDeviceDeviceMemoryReportCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -4293,6 +5048,7 @@ int zpushVkDeviceDeviceMemoryReportCreateInfoEXT(lua_State *L, const VkDeviceDev
 
 #define znewVkSamplerCustomBorderColorCreateInfoEXT(L, err) (VkSamplerCustomBorderColorCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT, sizeof(VkSamplerCustomBorderColorCreateInfoEXT), (err))
 #define znewarrayVkSamplerCustomBorderColorCreateInfoEXT(L, count, err) (VkSamplerCustomBorderColorCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT, sizeof(VkSamplerCustomBorderColorCreateInfoEXT), (count), (err))
+#define zinitarrayVkSamplerCustomBorderColorCreateInfoEXT(p, count) (VkSamplerCustomBorderColorCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT, sizeof(VkSamplerCustomBorderColorCreateInfoEXT), (count))
 #define znewchainVkSamplerCustomBorderColorCreateInfoEXT moonvulkan_znewchainVkSamplerCustomBorderColorCreateInfoEXT
 VkSamplerCustomBorderColorCreateInfoEXT* znewchainVkSamplerCustomBorderColorCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkSamplerCustomBorderColorCreateInfoEXT moonvulkan_znewchainarrayVkSamplerCustomBorderColorCreateInfoEXT
@@ -4301,6 +5057,8 @@ VkSamplerCustomBorderColorCreateInfoEXT* znewchainarrayVkSamplerCustomBorderColo
 VkSamplerCustomBorderColorCreateInfoEXT* zcheckVkSamplerCustomBorderColorCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSamplerCustomBorderColorCreateInfoEXT moonvulkan_zcheckarrayVkSamplerCustomBorderColorCreateInfoEXT
 VkSamplerCustomBorderColorCreateInfoEXT* zcheckarrayVkSamplerCustomBorderColorCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSamplerCustomBorderColorCreateInfoEXT moonvulkan_zcheckarraybufVkSamplerCustomBorderColorCreateInfoEXT
+VkSamplerCustomBorderColorCreateInfoEXT* zcheckarraybufVkSamplerCustomBorderColorCreateInfoEXT(lua_State *L, int arg, VkSamplerCustomBorderColorCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSamplerCustomBorderColorCreateInfoEXT moonvulkan_zinitVkSamplerCustomBorderColorCreateInfoEXT
 int zinitVkSamplerCustomBorderColorCreateInfoEXT(lua_State *L, VkSamplerCustomBorderColorCreateInfoEXT* p, int *err);
 #define zfreeVkSamplerCustomBorderColorCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -4310,6 +5068,7 @@ int zpushVkSamplerCustomBorderColorCreateInfoEXT(lua_State *L, const VkSamplerCu
 
 #define znewVkDevicePrivateDataCreateInfoEXT(L, err) (VkDevicePrivateDataCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO_EXT, sizeof(VkDevicePrivateDataCreateInfoEXT), (err))
 #define znewarrayVkDevicePrivateDataCreateInfoEXT(L, count, err) (VkDevicePrivateDataCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO_EXT, sizeof(VkDevicePrivateDataCreateInfoEXT), (count), (err))
+#define zinitarrayVkDevicePrivateDataCreateInfoEXT(p, count) (VkDevicePrivateDataCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO_EXT, sizeof(VkDevicePrivateDataCreateInfoEXT), (count))
 #define znewchainVkDevicePrivateDataCreateInfoEXT moonvulkan_znewchainVkDevicePrivateDataCreateInfoEXT
 VkDevicePrivateDataCreateInfoEXT* znewchainVkDevicePrivateDataCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkDevicePrivateDataCreateInfoEXT moonvulkan_znewchainarrayVkDevicePrivateDataCreateInfoEXT
@@ -4318,6 +5077,8 @@ VkDevicePrivateDataCreateInfoEXT* znewchainarrayVkDevicePrivateDataCreateInfoEXT
 VkDevicePrivateDataCreateInfoEXT* zcheckVkDevicePrivateDataCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDevicePrivateDataCreateInfoEXT moonvulkan_zcheckarrayVkDevicePrivateDataCreateInfoEXT
 VkDevicePrivateDataCreateInfoEXT* zcheckarrayVkDevicePrivateDataCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDevicePrivateDataCreateInfoEXT moonvulkan_zcheckarraybufVkDevicePrivateDataCreateInfoEXT
+VkDevicePrivateDataCreateInfoEXT* zcheckarraybufVkDevicePrivateDataCreateInfoEXT(lua_State *L, int arg, VkDevicePrivateDataCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDevicePrivateDataCreateInfoEXT moonvulkan_zinitVkDevicePrivateDataCreateInfoEXT
 int zinitVkDevicePrivateDataCreateInfoEXT(lua_State *L, VkDevicePrivateDataCreateInfoEXT* p, int *err);
 #define zfreeVkDevicePrivateDataCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -4327,6 +5088,7 @@ int zpushVkDevicePrivateDataCreateInfoEXT(lua_State *L, const VkDevicePrivateDat
 
 #define znewVkPrivateDataSlotCreateInfoEXT(L, err) (VkPrivateDataSlotCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO_EXT, sizeof(VkPrivateDataSlotCreateInfoEXT), (err))
 #define znewarrayVkPrivateDataSlotCreateInfoEXT(L, count, err) (VkPrivateDataSlotCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO_EXT, sizeof(VkPrivateDataSlotCreateInfoEXT), (count), (err))
+#define zinitarrayVkPrivateDataSlotCreateInfoEXT(p, count) (VkPrivateDataSlotCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO_EXT, sizeof(VkPrivateDataSlotCreateInfoEXT), (count))
 #define znewchainVkPrivateDataSlotCreateInfoEXT moonvulkan_znewchainVkPrivateDataSlotCreateInfoEXT
 VkPrivateDataSlotCreateInfoEXT* znewchainVkPrivateDataSlotCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPrivateDataSlotCreateInfoEXT moonvulkan_znewchainarrayVkPrivateDataSlotCreateInfoEXT
@@ -4335,6 +5097,8 @@ VkPrivateDataSlotCreateInfoEXT* znewchainarrayVkPrivateDataSlotCreateInfoEXT(lua
 VkPrivateDataSlotCreateInfoEXT* zcheckVkPrivateDataSlotCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPrivateDataSlotCreateInfoEXT moonvulkan_zcheckarrayVkPrivateDataSlotCreateInfoEXT
 VkPrivateDataSlotCreateInfoEXT* zcheckarrayVkPrivateDataSlotCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPrivateDataSlotCreateInfoEXT moonvulkan_zcheckarraybufVkPrivateDataSlotCreateInfoEXT
+VkPrivateDataSlotCreateInfoEXT* zcheckarraybufVkPrivateDataSlotCreateInfoEXT(lua_State *L, int arg, VkPrivateDataSlotCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPrivateDataSlotCreateInfoEXT moonvulkan_zinitVkPrivateDataSlotCreateInfoEXT
 int zinitVkPrivateDataSlotCreateInfoEXT(lua_State *L, VkPrivateDataSlotCreateInfoEXT* p, int *err);
 #define zfreeVkPrivateDataSlotCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -4344,6 +5108,7 @@ int zpushVkPrivateDataSlotCreateInfoEXT(lua_State *L, const VkPrivateDataSlotCre
 
 #define znewVkVertexInputBindingDescription2EXT(L, err) (VkVertexInputBindingDescription2EXT*)znew((L), VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT, sizeof(VkVertexInputBindingDescription2EXT), (err))
 #define znewarrayVkVertexInputBindingDescription2EXT(L, count, err) (VkVertexInputBindingDescription2EXT*)znewarray((L), VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT, sizeof(VkVertexInputBindingDescription2EXT), (count), (err))
+#define zinitarrayVkVertexInputBindingDescription2EXT(p, count) (VkVertexInputBindingDescription2EXT*)zinitarray((p), VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT, sizeof(VkVertexInputBindingDescription2EXT), (count))
 #define znewchainVkVertexInputBindingDescription2EXT moonvulkan_znewchainVkVertexInputBindingDescription2EXT
 VkVertexInputBindingDescription2EXT* znewchainVkVertexInputBindingDescription2EXT(lua_State *L, int *err);
 #define znewchainarrayVkVertexInputBindingDescription2EXT moonvulkan_znewchainarrayVkVertexInputBindingDescription2EXT
@@ -4352,6 +5117,8 @@ VkVertexInputBindingDescription2EXT* znewchainarrayVkVertexInputBindingDescripti
 VkVertexInputBindingDescription2EXT* zcheckVkVertexInputBindingDescription2EXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkVertexInputBindingDescription2EXT moonvulkan_zcheckarrayVkVertexInputBindingDescription2EXT
 VkVertexInputBindingDescription2EXT* zcheckarrayVkVertexInputBindingDescription2EXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkVertexInputBindingDescription2EXT moonvulkan_zcheckarraybufVkVertexInputBindingDescription2EXT
+VkVertexInputBindingDescription2EXT* zcheckarraybufVkVertexInputBindingDescription2EXT(lua_State *L, int arg, VkVertexInputBindingDescription2EXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkVertexInputBindingDescription2EXT moonvulkan_zinitVkVertexInputBindingDescription2EXT
 int zinitVkVertexInputBindingDescription2EXT(lua_State *L, VkVertexInputBindingDescription2EXT* p, int *err);
 #define zfreeVkVertexInputBindingDescription2EXT(L, p, base) zfree((L), (p), (base))
@@ -4361,6 +5128,7 @@ int zpushVkVertexInputBindingDescription2EXT(lua_State *L, const VkVertexInputBi
 
 #define znewVkVertexInputAttributeDescription2EXT(L, err) (VkVertexInputAttributeDescription2EXT*)znew((L), VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT, sizeof(VkVertexInputAttributeDescription2EXT), (err))
 #define znewarrayVkVertexInputAttributeDescription2EXT(L, count, err) (VkVertexInputAttributeDescription2EXT*)znewarray((L), VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT, sizeof(VkVertexInputAttributeDescription2EXT), (count), (err))
+#define zinitarrayVkVertexInputAttributeDescription2EXT(p, count) (VkVertexInputAttributeDescription2EXT*)zinitarray((p), VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT, sizeof(VkVertexInputAttributeDescription2EXT), (count))
 #define znewchainVkVertexInputAttributeDescription2EXT moonvulkan_znewchainVkVertexInputAttributeDescription2EXT
 VkVertexInputAttributeDescription2EXT* znewchainVkVertexInputAttributeDescription2EXT(lua_State *L, int *err);
 #define znewchainarrayVkVertexInputAttributeDescription2EXT moonvulkan_znewchainarrayVkVertexInputAttributeDescription2EXT
@@ -4369,6 +5137,8 @@ VkVertexInputAttributeDescription2EXT* znewchainarrayVkVertexInputAttributeDescr
 VkVertexInputAttributeDescription2EXT* zcheckVkVertexInputAttributeDescription2EXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkVertexInputAttributeDescription2EXT moonvulkan_zcheckarrayVkVertexInputAttributeDescription2EXT
 VkVertexInputAttributeDescription2EXT* zcheckarrayVkVertexInputAttributeDescription2EXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkVertexInputAttributeDescription2EXT moonvulkan_zcheckarraybufVkVertexInputAttributeDescription2EXT
+VkVertexInputAttributeDescription2EXT* zcheckarraybufVkVertexInputAttributeDescription2EXT(lua_State *L, int arg, VkVertexInputAttributeDescription2EXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkVertexInputAttributeDescription2EXT moonvulkan_zinitVkVertexInputAttributeDescription2EXT
 int zinitVkVertexInputAttributeDescription2EXT(lua_State *L, VkVertexInputAttributeDescription2EXT* p, int *err);
 #define zfreeVkVertexInputAttributeDescription2EXT(L, p, base) zfree((L), (p), (base))
@@ -4378,6 +5148,7 @@ int zpushVkVertexInputAttributeDescription2EXT(lua_State *L, const VkVertexInput
 
 #define znewVkPipelineColorWriteCreateInfoEXT(L, err) (VkPipelineColorWriteCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT, sizeof(VkPipelineColorWriteCreateInfoEXT), (err))
 #define znewarrayVkPipelineColorWriteCreateInfoEXT(L, count, err) (VkPipelineColorWriteCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT, sizeof(VkPipelineColorWriteCreateInfoEXT), (count), (err))
+#define zinitarrayVkPipelineColorWriteCreateInfoEXT(p, count) (VkPipelineColorWriteCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT, sizeof(VkPipelineColorWriteCreateInfoEXT), (count))
 #define znewchainVkPipelineColorWriteCreateInfoEXT moonvulkan_znewchainVkPipelineColorWriteCreateInfoEXT
 VkPipelineColorWriteCreateInfoEXT* znewchainVkPipelineColorWriteCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkPipelineColorWriteCreateInfoEXT moonvulkan_znewchainarrayVkPipelineColorWriteCreateInfoEXT
@@ -4386,6 +5157,8 @@ VkPipelineColorWriteCreateInfoEXT* znewchainarrayVkPipelineColorWriteCreateInfoE
 VkPipelineColorWriteCreateInfoEXT* zcheckVkPipelineColorWriteCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineColorWriteCreateInfoEXT moonvulkan_zcheckarrayVkPipelineColorWriteCreateInfoEXT
 VkPipelineColorWriteCreateInfoEXT* zcheckarrayVkPipelineColorWriteCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineColorWriteCreateInfoEXT moonvulkan_zcheckarraybufVkPipelineColorWriteCreateInfoEXT
+VkPipelineColorWriteCreateInfoEXT* zcheckarraybufVkPipelineColorWriteCreateInfoEXT(lua_State *L, int arg, VkPipelineColorWriteCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineColorWriteCreateInfoEXT moonvulkan_zinitVkPipelineColorWriteCreateInfoEXT
 int zinitVkPipelineColorWriteCreateInfoEXT(lua_State *L, VkPipelineColorWriteCreateInfoEXT* p, int *err);
 #define zfreeVkPipelineColorWriteCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -4395,6 +5168,7 @@ int zpushVkPipelineColorWriteCreateInfoEXT(lua_State *L, const VkPipelineColorWr
 
 #define znewVkQueueFamilyGlobalPriorityPropertiesEXT(L, err) (VkQueueFamilyGlobalPriorityPropertiesEXT*)znew((L), VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_EXT, sizeof(VkQueueFamilyGlobalPriorityPropertiesEXT), (err))
 #define znewarrayVkQueueFamilyGlobalPriorityPropertiesEXT(L, count, err) (VkQueueFamilyGlobalPriorityPropertiesEXT*)znewarray((L), VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_EXT, sizeof(VkQueueFamilyGlobalPriorityPropertiesEXT), (count), (err))
+#define zinitarrayVkQueueFamilyGlobalPriorityPropertiesEXT(p, count) (VkQueueFamilyGlobalPriorityPropertiesEXT*)zinitarray((p), VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_EXT, sizeof(VkQueueFamilyGlobalPriorityPropertiesEXT), (count))
 #define znewchainVkQueueFamilyGlobalPriorityPropertiesEXT moonvulkan_znewchainVkQueueFamilyGlobalPriorityPropertiesEXT
 VkQueueFamilyGlobalPriorityPropertiesEXT* znewchainVkQueueFamilyGlobalPriorityPropertiesEXT(lua_State *L, int *err);
 #define znewchainarrayVkQueueFamilyGlobalPriorityPropertiesEXT moonvulkan_znewchainarrayVkQueueFamilyGlobalPriorityPropertiesEXT
@@ -4403,6 +5177,8 @@ VkQueueFamilyGlobalPriorityPropertiesEXT* znewchainarrayVkQueueFamilyGlobalPrior
 VkQueueFamilyGlobalPriorityPropertiesEXT* zcheckVkQueueFamilyGlobalPriorityPropertiesEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkQueueFamilyGlobalPriorityPropertiesEXT moonvulkan_zcheckarrayVkQueueFamilyGlobalPriorityPropertiesEXT
 VkQueueFamilyGlobalPriorityPropertiesEXT* zcheckarrayVkQueueFamilyGlobalPriorityPropertiesEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkQueueFamilyGlobalPriorityPropertiesEXT moonvulkan_zcheckarraybufVkQueueFamilyGlobalPriorityPropertiesEXT
+VkQueueFamilyGlobalPriorityPropertiesEXT* zcheckarraybufVkQueueFamilyGlobalPriorityPropertiesEXT(lua_State *L, int arg, VkQueueFamilyGlobalPriorityPropertiesEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkQueueFamilyGlobalPriorityPropertiesEXT moonvulkan_zinitVkQueueFamilyGlobalPriorityPropertiesEXT
 int zinitVkQueueFamilyGlobalPriorityPropertiesEXT(lua_State *L, VkQueueFamilyGlobalPriorityPropertiesEXT* p, int *err);
 #define zfreeVkQueueFamilyGlobalPriorityPropertiesEXT(L, p, base) zfree((L), (p), (base))
@@ -4412,6 +5188,7 @@ int zpushVkQueueFamilyGlobalPriorityPropertiesEXT(lua_State *L, const VkQueueFam
 
 #define znewVkSamplerBorderColorComponentMappingCreateInfoEXT(L, err) (VkSamplerBorderColorComponentMappingCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT, sizeof(VkSamplerBorderColorComponentMappingCreateInfoEXT), (err))
 #define znewarrayVkSamplerBorderColorComponentMappingCreateInfoEXT(L, count, err) (VkSamplerBorderColorComponentMappingCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT, sizeof(VkSamplerBorderColorComponentMappingCreateInfoEXT), (count), (err))
+#define zinitarrayVkSamplerBorderColorComponentMappingCreateInfoEXT(p, count) (VkSamplerBorderColorComponentMappingCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT, sizeof(VkSamplerBorderColorComponentMappingCreateInfoEXT), (count))
 #define znewchainVkSamplerBorderColorComponentMappingCreateInfoEXT moonvulkan_znewchainVkSamplerBorderColorComponentMappingCreateInfoEXT
 VkSamplerBorderColorComponentMappingCreateInfoEXT* znewchainVkSamplerBorderColorComponentMappingCreateInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkSamplerBorderColorComponentMappingCreateInfoEXT moonvulkan_znewchainarrayVkSamplerBorderColorComponentMappingCreateInfoEXT
@@ -4420,6 +5197,8 @@ VkSamplerBorderColorComponentMappingCreateInfoEXT* znewchainarrayVkSamplerBorder
 VkSamplerBorderColorComponentMappingCreateInfoEXT* zcheckVkSamplerBorderColorComponentMappingCreateInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSamplerBorderColorComponentMappingCreateInfoEXT moonvulkan_zcheckarrayVkSamplerBorderColorComponentMappingCreateInfoEXT
 VkSamplerBorderColorComponentMappingCreateInfoEXT* zcheckarrayVkSamplerBorderColorComponentMappingCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSamplerBorderColorComponentMappingCreateInfoEXT moonvulkan_zcheckarraybufVkSamplerBorderColorComponentMappingCreateInfoEXT
+VkSamplerBorderColorComponentMappingCreateInfoEXT* zcheckarraybufVkSamplerBorderColorComponentMappingCreateInfoEXT(lua_State *L, int arg, VkSamplerBorderColorComponentMappingCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSamplerBorderColorComponentMappingCreateInfoEXT moonvulkan_zinitVkSamplerBorderColorComponentMappingCreateInfoEXT
 int zinitVkSamplerBorderColorComponentMappingCreateInfoEXT(lua_State *L, VkSamplerBorderColorComponentMappingCreateInfoEXT* p, int *err);
 #define zfreeVkSamplerBorderColorComponentMappingCreateInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -4429,6 +5208,7 @@ int zpushVkSamplerBorderColorComponentMappingCreateInfoEXT(lua_State *L, const V
 
 #define znewVkDeviceBufferMemoryRequirementsKHR(L, err) (VkDeviceBufferMemoryRequirementsKHR*)znew((L), VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS_KHR, sizeof(VkDeviceBufferMemoryRequirementsKHR), (err))
 #define znewarrayVkDeviceBufferMemoryRequirementsKHR(L, count, err) (VkDeviceBufferMemoryRequirementsKHR*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS_KHR, sizeof(VkDeviceBufferMemoryRequirementsKHR), (count), (err))
+#define zinitarrayVkDeviceBufferMemoryRequirementsKHR(p, count) (VkDeviceBufferMemoryRequirementsKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS_KHR, sizeof(VkDeviceBufferMemoryRequirementsKHR), (count))
 #define znewchainVkDeviceBufferMemoryRequirementsKHR moonvulkan_znewchainVkDeviceBufferMemoryRequirementsKHR
 VkDeviceBufferMemoryRequirementsKHR* znewchainVkDeviceBufferMemoryRequirementsKHR(lua_State *L, int *err);
 #define znewchainarrayVkDeviceBufferMemoryRequirementsKHR moonvulkan_znewchainarrayVkDeviceBufferMemoryRequirementsKHR
@@ -4437,6 +5217,8 @@ VkDeviceBufferMemoryRequirementsKHR* znewchainarrayVkDeviceBufferMemoryRequireme
 VkDeviceBufferMemoryRequirementsKHR* zcheckVkDeviceBufferMemoryRequirementsKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceBufferMemoryRequirementsKHR moonvulkan_zcheckarrayVkDeviceBufferMemoryRequirementsKHR
 VkDeviceBufferMemoryRequirementsKHR* zcheckarrayVkDeviceBufferMemoryRequirementsKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceBufferMemoryRequirementsKHR moonvulkan_zcheckarraybufVkDeviceBufferMemoryRequirementsKHR
+VkDeviceBufferMemoryRequirementsKHR* zcheckarraybufVkDeviceBufferMemoryRequirementsKHR(lua_State *L, int arg, VkDeviceBufferMemoryRequirementsKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceBufferMemoryRequirementsKHR moonvulkan_zinitVkDeviceBufferMemoryRequirementsKHR
 int zinitVkDeviceBufferMemoryRequirementsKHR(lua_State *L, VkDeviceBufferMemoryRequirementsKHR* p, int *err);
 #define zfreeVkDeviceBufferMemoryRequirementsKHR(L, p, base) zfree((L), (p), (base))
@@ -4446,6 +5228,7 @@ int zpushVkDeviceBufferMemoryRequirementsKHR(lua_State *L, const VkDeviceBufferM
 
 #define znewVkDeviceImageMemoryRequirementsKHR(L, err) (VkDeviceImageMemoryRequirementsKHR*)znew((L), VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS_KHR, sizeof(VkDeviceImageMemoryRequirementsKHR), (err))
 #define znewarrayVkDeviceImageMemoryRequirementsKHR(L, count, err) (VkDeviceImageMemoryRequirementsKHR*)znewarray((L), VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS_KHR, sizeof(VkDeviceImageMemoryRequirementsKHR), (count), (err))
+#define zinitarrayVkDeviceImageMemoryRequirementsKHR(p, count) (VkDeviceImageMemoryRequirementsKHR*)zinitarray((p), VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS_KHR, sizeof(VkDeviceImageMemoryRequirementsKHR), (count))
 #define znewchainVkDeviceImageMemoryRequirementsKHR moonvulkan_znewchainVkDeviceImageMemoryRequirementsKHR
 VkDeviceImageMemoryRequirementsKHR* znewchainVkDeviceImageMemoryRequirementsKHR(lua_State *L, int *err);
 #define znewchainarrayVkDeviceImageMemoryRequirementsKHR moonvulkan_znewchainarrayVkDeviceImageMemoryRequirementsKHR
@@ -4454,6 +5237,8 @@ VkDeviceImageMemoryRequirementsKHR* znewchainarrayVkDeviceImageMemoryRequirement
 VkDeviceImageMemoryRequirementsKHR* zcheckVkDeviceImageMemoryRequirementsKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceImageMemoryRequirementsKHR moonvulkan_zcheckarrayVkDeviceImageMemoryRequirementsKHR
 VkDeviceImageMemoryRequirementsKHR* zcheckarrayVkDeviceImageMemoryRequirementsKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceImageMemoryRequirementsKHR moonvulkan_zcheckarraybufVkDeviceImageMemoryRequirementsKHR
+VkDeviceImageMemoryRequirementsKHR* zcheckarraybufVkDeviceImageMemoryRequirementsKHR(lua_State *L, int arg, VkDeviceImageMemoryRequirementsKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceImageMemoryRequirementsKHR moonvulkan_zinitVkDeviceImageMemoryRequirementsKHR
 int zinitVkDeviceImageMemoryRequirementsKHR(lua_State *L, VkDeviceImageMemoryRequirementsKHR* p, int *err);
 #define zfreeVkDeviceImageMemoryRequirementsKHR(L, p, base) zfree((L), (p), (base))
@@ -4463,6 +5248,7 @@ int zpushVkDeviceImageMemoryRequirementsKHR(lua_State *L, const VkDeviceImageMem
 
 #define znewVkDrmFormatModifierProperties2EXT(L, err) (VkDrmFormatModifierProperties2EXT*)znew((L), VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_2_EXT, sizeof(VkDrmFormatModifierProperties2EXT), (err))
 #define znewarrayVkDrmFormatModifierProperties2EXT(L, count, err) (VkDrmFormatModifierProperties2EXT*)znewarray((L), VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_2_EXT, sizeof(VkDrmFormatModifierProperties2EXT), (count), (err))
+#define zinitarrayVkDrmFormatModifierProperties2EXT(p, count) (VkDrmFormatModifierProperties2EXT*)zinitarray((p), VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_2_EXT, sizeof(VkDrmFormatModifierProperties2EXT), (count))
 #define znewchainVkDrmFormatModifierProperties2EXT moonvulkan_znewchainVkDrmFormatModifierProperties2EXT
 VkDrmFormatModifierProperties2EXT* znewchainVkDrmFormatModifierProperties2EXT(lua_State *L, int *err);
 #define znewchainarrayVkDrmFormatModifierProperties2EXT moonvulkan_znewchainarrayVkDrmFormatModifierProperties2EXT
@@ -4471,6 +5257,8 @@ VkDrmFormatModifierProperties2EXT* znewchainarrayVkDrmFormatModifierProperties2E
 VkDrmFormatModifierProperties2EXT* zcheckVkDrmFormatModifierProperties2EXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDrmFormatModifierProperties2EXT moonvulkan_zcheckarrayVkDrmFormatModifierProperties2EXT
 VkDrmFormatModifierProperties2EXT* zcheckarrayVkDrmFormatModifierProperties2EXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDrmFormatModifierProperties2EXT moonvulkan_zcheckarraybufVkDrmFormatModifierProperties2EXT
+VkDrmFormatModifierProperties2EXT* zcheckarraybufVkDrmFormatModifierProperties2EXT(lua_State *L, int arg, VkDrmFormatModifierProperties2EXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDrmFormatModifierProperties2EXT moonvulkan_zinitVkDrmFormatModifierProperties2EXT
 int zinitVkDrmFormatModifierProperties2EXT(lua_State *L, VkDrmFormatModifierProperties2EXT* p, int *err);
 #define zfreeVkDrmFormatModifierProperties2EXT(L, p, base) zfree((L), (p), (base))
@@ -4480,6 +5268,7 @@ int zpushVkDrmFormatModifierProperties2EXT(lua_State *L, const VkDrmFormatModifi
 
 #define znewVkDrmFormatModifierPropertiesList2EXT(L, err) (VkDrmFormatModifierPropertiesList2EXT*)znew((L), VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_2_EXT, sizeof(VkDrmFormatModifierPropertiesList2EXT), (err))
 #define znewarrayVkDrmFormatModifierPropertiesList2EXT(L, count, err) (VkDrmFormatModifierPropertiesList2EXT*)znewarray((L), VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_2_EXT, sizeof(VkDrmFormatModifierPropertiesList2EXT), (count), (err))
+#define zinitarrayVkDrmFormatModifierPropertiesList2EXT(p, count) (VkDrmFormatModifierPropertiesList2EXT*)zinitarray((p), VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_2_EXT, sizeof(VkDrmFormatModifierPropertiesList2EXT), (count))
 #define znewchainVkDrmFormatModifierPropertiesList2EXT moonvulkan_znewchainVkDrmFormatModifierPropertiesList2EXT
 VkDrmFormatModifierPropertiesList2EXT* znewchainVkDrmFormatModifierPropertiesList2EXT(lua_State *L, int *err);
 #define znewchainarrayVkDrmFormatModifierPropertiesList2EXT moonvulkan_znewchainarrayVkDrmFormatModifierPropertiesList2EXT
@@ -4488,6 +5277,8 @@ VkDrmFormatModifierPropertiesList2EXT* znewchainarrayVkDrmFormatModifierProperti
 VkDrmFormatModifierPropertiesList2EXT* zcheckVkDrmFormatModifierPropertiesList2EXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDrmFormatModifierPropertiesList2EXT moonvulkan_zcheckarrayVkDrmFormatModifierPropertiesList2EXT
 VkDrmFormatModifierPropertiesList2EXT* zcheckarrayVkDrmFormatModifierPropertiesList2EXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDrmFormatModifierPropertiesList2EXT moonvulkan_zcheckarraybufVkDrmFormatModifierPropertiesList2EXT
+VkDrmFormatModifierPropertiesList2EXT* zcheckarraybufVkDrmFormatModifierPropertiesList2EXT(lua_State *L, int arg, VkDrmFormatModifierPropertiesList2EXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDrmFormatModifierPropertiesList2EXT moonvulkan_zinitVkDrmFormatModifierPropertiesList2EXT
 int zinitVkDrmFormatModifierPropertiesList2EXT(lua_State *L, VkDrmFormatModifierPropertiesList2EXT* p, int *err);
 #define zfreeVkDrmFormatModifierPropertiesList2EXT(L, p, base) zfree((L), (p), (base))
@@ -4497,6 +5288,7 @@ int zpushVkDrmFormatModifierPropertiesList2EXT(lua_State *L, const VkDrmFormatMo
 
 #define znewVkRenderingAttachmentInfoKHR(L, err) (VkRenderingAttachmentInfoKHR*)znew((L), VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR, sizeof(VkRenderingAttachmentInfoKHR), (err))
 #define znewarrayVkRenderingAttachmentInfoKHR(L, count, err) (VkRenderingAttachmentInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR, sizeof(VkRenderingAttachmentInfoKHR), (count), (err))
+#define zinitarrayVkRenderingAttachmentInfoKHR(p, count) (VkRenderingAttachmentInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR, sizeof(VkRenderingAttachmentInfoKHR), (count))
 #define znewchainVkRenderingAttachmentInfoKHR moonvulkan_znewchainVkRenderingAttachmentInfoKHR
 VkRenderingAttachmentInfoKHR* znewchainVkRenderingAttachmentInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkRenderingAttachmentInfoKHR moonvulkan_znewchainarrayVkRenderingAttachmentInfoKHR
@@ -4505,6 +5297,8 @@ VkRenderingAttachmentInfoKHR* znewchainarrayVkRenderingAttachmentInfoKHR(lua_Sta
 VkRenderingAttachmentInfoKHR* zcheckVkRenderingAttachmentInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRenderingAttachmentInfoKHR moonvulkan_zcheckarrayVkRenderingAttachmentInfoKHR
 VkRenderingAttachmentInfoKHR* zcheckarrayVkRenderingAttachmentInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRenderingAttachmentInfoKHR moonvulkan_zcheckarraybufVkRenderingAttachmentInfoKHR
+VkRenderingAttachmentInfoKHR* zcheckarraybufVkRenderingAttachmentInfoKHR(lua_State *L, int arg, VkRenderingAttachmentInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRenderingAttachmentInfoKHR moonvulkan_zinitVkRenderingAttachmentInfoKHR
 int zinitVkRenderingAttachmentInfoKHR(lua_State *L, VkRenderingAttachmentInfoKHR* p, int *err);
 #define zfreeVkRenderingAttachmentInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4514,6 +5308,7 @@ int zpushVkRenderingAttachmentInfoKHR(lua_State *L, const VkRenderingAttachmentI
 
 #define znewVkRenderingInfoKHR(L, err) (VkRenderingInfoKHR*)znew((L), VK_STRUCTURE_TYPE_RENDERING_INFO_KHR, sizeof(VkRenderingInfoKHR), (err))
 #define znewarrayVkRenderingInfoKHR(L, count, err) (VkRenderingInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_RENDERING_INFO_KHR, sizeof(VkRenderingInfoKHR), (count), (err))
+#define zinitarrayVkRenderingInfoKHR(p, count) (VkRenderingInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_RENDERING_INFO_KHR, sizeof(VkRenderingInfoKHR), (count))
 #define znewchainVkRenderingInfoKHR moonvulkan_znewchainVkRenderingInfoKHR
 VkRenderingInfoKHR* znewchainVkRenderingInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkRenderingInfoKHR moonvulkan_znewchainarrayVkRenderingInfoKHR
@@ -4522,6 +5317,8 @@ VkRenderingInfoKHR* znewchainarrayVkRenderingInfoKHR(lua_State *L, uint32_t coun
 VkRenderingInfoKHR* zcheckVkRenderingInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRenderingInfoKHR moonvulkan_zcheckarrayVkRenderingInfoKHR
 VkRenderingInfoKHR* zcheckarrayVkRenderingInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRenderingInfoKHR moonvulkan_zcheckarraybufVkRenderingInfoKHR
+VkRenderingInfoKHR* zcheckarraybufVkRenderingInfoKHR(lua_State *L, int arg, VkRenderingInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRenderingInfoKHR moonvulkan_zinitVkRenderingInfoKHR
 int zinitVkRenderingInfoKHR(lua_State *L, VkRenderingInfoKHR* p, int *err);
 #define zfreeVkRenderingInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4531,6 +5328,7 @@ int zpushVkRenderingInfoKHR(lua_State *L, const VkRenderingInfoKHR *p);
 
 #define znewVkPipelineRenderingCreateInfoKHR(L, err) (VkPipelineRenderingCreateInfoKHR*)znew((L), VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR, sizeof(VkPipelineRenderingCreateInfoKHR), (err))
 #define znewarrayVkPipelineRenderingCreateInfoKHR(L, count, err) (VkPipelineRenderingCreateInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR, sizeof(VkPipelineRenderingCreateInfoKHR), (count), (err))
+#define zinitarrayVkPipelineRenderingCreateInfoKHR(p, count) (VkPipelineRenderingCreateInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR, sizeof(VkPipelineRenderingCreateInfoKHR), (count))
 #define znewchainVkPipelineRenderingCreateInfoKHR moonvulkan_znewchainVkPipelineRenderingCreateInfoKHR
 VkPipelineRenderingCreateInfoKHR* znewchainVkPipelineRenderingCreateInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkPipelineRenderingCreateInfoKHR moonvulkan_znewchainarrayVkPipelineRenderingCreateInfoKHR
@@ -4539,6 +5337,8 @@ VkPipelineRenderingCreateInfoKHR* znewchainarrayVkPipelineRenderingCreateInfoKHR
 VkPipelineRenderingCreateInfoKHR* zcheckVkPipelineRenderingCreateInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineRenderingCreateInfoKHR moonvulkan_zcheckarrayVkPipelineRenderingCreateInfoKHR
 VkPipelineRenderingCreateInfoKHR* zcheckarrayVkPipelineRenderingCreateInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineRenderingCreateInfoKHR moonvulkan_zcheckarraybufVkPipelineRenderingCreateInfoKHR
+VkPipelineRenderingCreateInfoKHR* zcheckarraybufVkPipelineRenderingCreateInfoKHR(lua_State *L, int arg, VkPipelineRenderingCreateInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineRenderingCreateInfoKHR moonvulkan_zinitVkPipelineRenderingCreateInfoKHR
 int zinitVkPipelineRenderingCreateInfoKHR(lua_State *L, VkPipelineRenderingCreateInfoKHR* p, int *err);
 #define zfreeVkPipelineRenderingCreateInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4548,6 +5348,7 @@ int zpushVkPipelineRenderingCreateInfoKHR(lua_State *L, const VkPipelineRenderin
 
 #define znewVkCommandBufferInheritanceRenderingInfoKHR(L, err) (VkCommandBufferInheritanceRenderingInfoKHR*)znew((L), VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR, sizeof(VkCommandBufferInheritanceRenderingInfoKHR), (err))
 #define znewarrayVkCommandBufferInheritanceRenderingInfoKHR(L, count, err) (VkCommandBufferInheritanceRenderingInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR, sizeof(VkCommandBufferInheritanceRenderingInfoKHR), (count), (err))
+#define zinitarrayVkCommandBufferInheritanceRenderingInfoKHR(p, count) (VkCommandBufferInheritanceRenderingInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR, sizeof(VkCommandBufferInheritanceRenderingInfoKHR), (count))
 #define znewchainVkCommandBufferInheritanceRenderingInfoKHR moonvulkan_znewchainVkCommandBufferInheritanceRenderingInfoKHR
 VkCommandBufferInheritanceRenderingInfoKHR* znewchainVkCommandBufferInheritanceRenderingInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkCommandBufferInheritanceRenderingInfoKHR moonvulkan_znewchainarrayVkCommandBufferInheritanceRenderingInfoKHR
@@ -4556,6 +5357,8 @@ VkCommandBufferInheritanceRenderingInfoKHR* znewchainarrayVkCommandBufferInherit
 VkCommandBufferInheritanceRenderingInfoKHR* zcheckVkCommandBufferInheritanceRenderingInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkCommandBufferInheritanceRenderingInfoKHR moonvulkan_zcheckarrayVkCommandBufferInheritanceRenderingInfoKHR
 VkCommandBufferInheritanceRenderingInfoKHR* zcheckarrayVkCommandBufferInheritanceRenderingInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkCommandBufferInheritanceRenderingInfoKHR moonvulkan_zcheckarraybufVkCommandBufferInheritanceRenderingInfoKHR
+VkCommandBufferInheritanceRenderingInfoKHR* zcheckarraybufVkCommandBufferInheritanceRenderingInfoKHR(lua_State *L, int arg, VkCommandBufferInheritanceRenderingInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkCommandBufferInheritanceRenderingInfoKHR moonvulkan_zinitVkCommandBufferInheritanceRenderingInfoKHR
 int zinitVkCommandBufferInheritanceRenderingInfoKHR(lua_State *L, VkCommandBufferInheritanceRenderingInfoKHR* p, int *err);
 #define zfreeVkCommandBufferInheritanceRenderingInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4565,6 +5368,7 @@ int zpushVkCommandBufferInheritanceRenderingInfoKHR(lua_State *L, const VkComman
 
 #define znewVkRenderingFragmentShadingRateAttachmentInfoKHR(L, err) (VkRenderingFragmentShadingRateAttachmentInfoKHR*)znew((L), VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR, sizeof(VkRenderingFragmentShadingRateAttachmentInfoKHR), (err))
 #define znewarrayVkRenderingFragmentShadingRateAttachmentInfoKHR(L, count, err) (VkRenderingFragmentShadingRateAttachmentInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR, sizeof(VkRenderingFragmentShadingRateAttachmentInfoKHR), (count), (err))
+#define zinitarrayVkRenderingFragmentShadingRateAttachmentInfoKHR(p, count) (VkRenderingFragmentShadingRateAttachmentInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR, sizeof(VkRenderingFragmentShadingRateAttachmentInfoKHR), (count))
 #define znewchainVkRenderingFragmentShadingRateAttachmentInfoKHR moonvulkan_znewchainVkRenderingFragmentShadingRateAttachmentInfoKHR
 VkRenderingFragmentShadingRateAttachmentInfoKHR* znewchainVkRenderingFragmentShadingRateAttachmentInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkRenderingFragmentShadingRateAttachmentInfoKHR moonvulkan_znewchainarrayVkRenderingFragmentShadingRateAttachmentInfoKHR
@@ -4573,6 +5377,8 @@ VkRenderingFragmentShadingRateAttachmentInfoKHR* znewchainarrayVkRenderingFragme
 VkRenderingFragmentShadingRateAttachmentInfoKHR* zcheckVkRenderingFragmentShadingRateAttachmentInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRenderingFragmentShadingRateAttachmentInfoKHR moonvulkan_zcheckarrayVkRenderingFragmentShadingRateAttachmentInfoKHR
 VkRenderingFragmentShadingRateAttachmentInfoKHR* zcheckarrayVkRenderingFragmentShadingRateAttachmentInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRenderingFragmentShadingRateAttachmentInfoKHR moonvulkan_zcheckarraybufVkRenderingFragmentShadingRateAttachmentInfoKHR
+VkRenderingFragmentShadingRateAttachmentInfoKHR* zcheckarraybufVkRenderingFragmentShadingRateAttachmentInfoKHR(lua_State *L, int arg, VkRenderingFragmentShadingRateAttachmentInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRenderingFragmentShadingRateAttachmentInfoKHR moonvulkan_zinitVkRenderingFragmentShadingRateAttachmentInfoKHR
 int zinitVkRenderingFragmentShadingRateAttachmentInfoKHR(lua_State *L, VkRenderingFragmentShadingRateAttachmentInfoKHR* p, int *err);
 #define zfreeVkRenderingFragmentShadingRateAttachmentInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4582,6 +5388,7 @@ int zpushVkRenderingFragmentShadingRateAttachmentInfoKHR(lua_State *L, const VkR
 
 #define znewVkRenderingFragmentDensityMapAttachmentInfoEXT(L, err) (VkRenderingFragmentDensityMapAttachmentInfoEXT*)znew((L), VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT, sizeof(VkRenderingFragmentDensityMapAttachmentInfoEXT), (err))
 #define znewarrayVkRenderingFragmentDensityMapAttachmentInfoEXT(L, count, err) (VkRenderingFragmentDensityMapAttachmentInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT, sizeof(VkRenderingFragmentDensityMapAttachmentInfoEXT), (count), (err))
+#define zinitarrayVkRenderingFragmentDensityMapAttachmentInfoEXT(p, count) (VkRenderingFragmentDensityMapAttachmentInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT, sizeof(VkRenderingFragmentDensityMapAttachmentInfoEXT), (count))
 #define znewchainVkRenderingFragmentDensityMapAttachmentInfoEXT moonvulkan_znewchainVkRenderingFragmentDensityMapAttachmentInfoEXT
 VkRenderingFragmentDensityMapAttachmentInfoEXT* znewchainVkRenderingFragmentDensityMapAttachmentInfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkRenderingFragmentDensityMapAttachmentInfoEXT moonvulkan_znewchainarrayVkRenderingFragmentDensityMapAttachmentInfoEXT
@@ -4590,6 +5397,8 @@ VkRenderingFragmentDensityMapAttachmentInfoEXT* znewchainarrayVkRenderingFragmen
 VkRenderingFragmentDensityMapAttachmentInfoEXT* zcheckVkRenderingFragmentDensityMapAttachmentInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRenderingFragmentDensityMapAttachmentInfoEXT moonvulkan_zcheckarrayVkRenderingFragmentDensityMapAttachmentInfoEXT
 VkRenderingFragmentDensityMapAttachmentInfoEXT* zcheckarrayVkRenderingFragmentDensityMapAttachmentInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRenderingFragmentDensityMapAttachmentInfoEXT moonvulkan_zcheckarraybufVkRenderingFragmentDensityMapAttachmentInfoEXT
+VkRenderingFragmentDensityMapAttachmentInfoEXT* zcheckarraybufVkRenderingFragmentDensityMapAttachmentInfoEXT(lua_State *L, int arg, VkRenderingFragmentDensityMapAttachmentInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRenderingFragmentDensityMapAttachmentInfoEXT moonvulkan_zinitVkRenderingFragmentDensityMapAttachmentInfoEXT
 int zinitVkRenderingFragmentDensityMapAttachmentInfoEXT(lua_State *L, VkRenderingFragmentDensityMapAttachmentInfoEXT* p, int *err);
 #define zfreeVkRenderingFragmentDensityMapAttachmentInfoEXT(L, p, base) zfree((L), (p), (base))
@@ -4602,6 +5411,7 @@ int zpushVkRenderingFragmentDensityMapAttachmentInfoEXT(lua_State *L, const VkRe
 
 #define znewVkImportSemaphoreWin32HandleInfoKHR(L, err) (VkImportSemaphoreWin32HandleInfoKHR*)znew((L), VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR, sizeof(VkImportSemaphoreWin32HandleInfoKHR), (err))
 #define znewarrayVkImportSemaphoreWin32HandleInfoKHR(L, count, err) (VkImportSemaphoreWin32HandleInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR, sizeof(VkImportSemaphoreWin32HandleInfoKHR), (count), (err))
+#define zinitarrayVkImportSemaphoreWin32HandleInfoKHR(p, count) (VkImportSemaphoreWin32HandleInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR, sizeof(VkImportSemaphoreWin32HandleInfoKHR), (count))
 #define znewchainVkImportSemaphoreWin32HandleInfoKHR moonvulkan_znewchainVkImportSemaphoreWin32HandleInfoKHR
 VkImportSemaphoreWin32HandleInfoKHR* znewchainVkImportSemaphoreWin32HandleInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkImportSemaphoreWin32HandleInfoKHR moonvulkan_znewchainarrayVkImportSemaphoreWin32HandleInfoKHR
@@ -4610,6 +5420,8 @@ VkImportSemaphoreWin32HandleInfoKHR* znewchainarrayVkImportSemaphoreWin32HandleI
 VkImportSemaphoreWin32HandleInfoKHR* zcheckVkImportSemaphoreWin32HandleInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImportSemaphoreWin32HandleInfoKHR moonvulkan_zcheckarrayVkImportSemaphoreWin32HandleInfoKHR
 VkImportSemaphoreWin32HandleInfoKHR* zcheckarrayVkImportSemaphoreWin32HandleInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImportSemaphoreWin32HandleInfoKHR moonvulkan_zcheckarraybufVkImportSemaphoreWin32HandleInfoKHR
+VkImportSemaphoreWin32HandleInfoKHR* zcheckarraybufVkImportSemaphoreWin32HandleInfoKHR(lua_State *L, int arg, VkImportSemaphoreWin32HandleInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImportSemaphoreWin32HandleInfoKHR moonvulkan_zinitVkImportSemaphoreWin32HandleInfoKHR
 int zinitVkImportSemaphoreWin32HandleInfoKHR(lua_State *L, VkImportSemaphoreWin32HandleInfoKHR* p, int *err);
 #define zfreeVkImportSemaphoreWin32HandleInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4619,6 +5431,7 @@ int zpushVkImportSemaphoreWin32HandleInfoKHR(lua_State *L, const VkImportSemapho
 
 #define znewVkSemaphoreGetWin32HandleInfoKHR(L, err) (VkSemaphoreGetWin32HandleInfoKHR*)znew((L), VK_STRUCTURE_TYPE_SEMAPHORE_GET_WIN32_HANDLE_INFO_KHR, sizeof(VkSemaphoreGetWin32HandleInfoKHR), (err))
 #define znewarrayVkSemaphoreGetWin32HandleInfoKHR(L, count, err) (VkSemaphoreGetWin32HandleInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_SEMAPHORE_GET_WIN32_HANDLE_INFO_KHR, sizeof(VkSemaphoreGetWin32HandleInfoKHR), (count), (err))
+#define zinitarrayVkSemaphoreGetWin32HandleInfoKHR(p, count) (VkSemaphoreGetWin32HandleInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_SEMAPHORE_GET_WIN32_HANDLE_INFO_KHR, sizeof(VkSemaphoreGetWin32HandleInfoKHR), (count))
 #define znewchainVkSemaphoreGetWin32HandleInfoKHR moonvulkan_znewchainVkSemaphoreGetWin32HandleInfoKHR
 VkSemaphoreGetWin32HandleInfoKHR* znewchainVkSemaphoreGetWin32HandleInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkSemaphoreGetWin32HandleInfoKHR moonvulkan_znewchainarrayVkSemaphoreGetWin32HandleInfoKHR
@@ -4627,6 +5440,8 @@ VkSemaphoreGetWin32HandleInfoKHR* znewchainarrayVkSemaphoreGetWin32HandleInfoKHR
 VkSemaphoreGetWin32HandleInfoKHR* zcheckVkSemaphoreGetWin32HandleInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSemaphoreGetWin32HandleInfoKHR moonvulkan_zcheckarrayVkSemaphoreGetWin32HandleInfoKHR
 VkSemaphoreGetWin32HandleInfoKHR* zcheckarrayVkSemaphoreGetWin32HandleInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSemaphoreGetWin32HandleInfoKHR moonvulkan_zcheckarraybufVkSemaphoreGetWin32HandleInfoKHR
+VkSemaphoreGetWin32HandleInfoKHR* zcheckarraybufVkSemaphoreGetWin32HandleInfoKHR(lua_State *L, int arg, VkSemaphoreGetWin32HandleInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSemaphoreGetWin32HandleInfoKHR moonvulkan_zinitVkSemaphoreGetWin32HandleInfoKHR
 int zinitVkSemaphoreGetWin32HandleInfoKHR(lua_State *L, VkSemaphoreGetWin32HandleInfoKHR* p, int *err);
 #define zfreeVkSemaphoreGetWin32HandleInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4636,6 +5451,7 @@ int zpushVkSemaphoreGetWin32HandleInfoKHR(lua_State *L, const VkSemaphoreGetWin3
 
 #define znewVkImportFenceWin32HandleInfoKHR(L, err) (VkImportFenceWin32HandleInfoKHR*)znew((L), VK_STRUCTURE_TYPE_IMPORT_FENCE_WIN32_HANDLE_INFO_KHR, sizeof(VkImportFenceWin32HandleInfoKHR), (err))
 #define znewarrayVkImportFenceWin32HandleInfoKHR(L, count, err) (VkImportFenceWin32HandleInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_IMPORT_FENCE_WIN32_HANDLE_INFO_KHR, sizeof(VkImportFenceWin32HandleInfoKHR), (count), (err))
+#define zinitarrayVkImportFenceWin32HandleInfoKHR(p, count) (VkImportFenceWin32HandleInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMPORT_FENCE_WIN32_HANDLE_INFO_KHR, sizeof(VkImportFenceWin32HandleInfoKHR), (count))
 #define znewchainVkImportFenceWin32HandleInfoKHR moonvulkan_znewchainVkImportFenceWin32HandleInfoKHR
 VkImportFenceWin32HandleInfoKHR* znewchainVkImportFenceWin32HandleInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkImportFenceWin32HandleInfoKHR moonvulkan_znewchainarrayVkImportFenceWin32HandleInfoKHR
@@ -4644,6 +5460,8 @@ VkImportFenceWin32HandleInfoKHR* znewchainarrayVkImportFenceWin32HandleInfoKHR(l
 VkImportFenceWin32HandleInfoKHR* zcheckVkImportFenceWin32HandleInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImportFenceWin32HandleInfoKHR moonvulkan_zcheckarrayVkImportFenceWin32HandleInfoKHR
 VkImportFenceWin32HandleInfoKHR* zcheckarrayVkImportFenceWin32HandleInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImportFenceWin32HandleInfoKHR moonvulkan_zcheckarraybufVkImportFenceWin32HandleInfoKHR
+VkImportFenceWin32HandleInfoKHR* zcheckarraybufVkImportFenceWin32HandleInfoKHR(lua_State *L, int arg, VkImportFenceWin32HandleInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImportFenceWin32HandleInfoKHR moonvulkan_zinitVkImportFenceWin32HandleInfoKHR
 int zinitVkImportFenceWin32HandleInfoKHR(lua_State *L, VkImportFenceWin32HandleInfoKHR* p, int *err);
 #define zfreeVkImportFenceWin32HandleInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4653,6 +5471,7 @@ int zpushVkImportFenceWin32HandleInfoKHR(lua_State *L, const VkImportFenceWin32H
 
 #define znewVkExportFenceWin32HandleInfoKHR(L, err) (VkExportFenceWin32HandleInfoKHR*)znew((L), VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR, sizeof(VkExportFenceWin32HandleInfoKHR), (err))
 #define znewarrayVkExportFenceWin32HandleInfoKHR(L, count, err) (VkExportFenceWin32HandleInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR, sizeof(VkExportFenceWin32HandleInfoKHR), (count), (err))
+#define zinitarrayVkExportFenceWin32HandleInfoKHR(p, count) (VkExportFenceWin32HandleInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR, sizeof(VkExportFenceWin32HandleInfoKHR), (count))
 #define znewchainVkExportFenceWin32HandleInfoKHR moonvulkan_znewchainVkExportFenceWin32HandleInfoKHR
 VkExportFenceWin32HandleInfoKHR* znewchainVkExportFenceWin32HandleInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkExportFenceWin32HandleInfoKHR moonvulkan_znewchainarrayVkExportFenceWin32HandleInfoKHR
@@ -4661,6 +5480,8 @@ VkExportFenceWin32HandleInfoKHR* znewchainarrayVkExportFenceWin32HandleInfoKHR(l
 VkExportFenceWin32HandleInfoKHR* zcheckVkExportFenceWin32HandleInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExportFenceWin32HandleInfoKHR moonvulkan_zcheckarrayVkExportFenceWin32HandleInfoKHR
 VkExportFenceWin32HandleInfoKHR* zcheckarrayVkExportFenceWin32HandleInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExportFenceWin32HandleInfoKHR moonvulkan_zcheckarraybufVkExportFenceWin32HandleInfoKHR
+VkExportFenceWin32HandleInfoKHR* zcheckarraybufVkExportFenceWin32HandleInfoKHR(lua_State *L, int arg, VkExportFenceWin32HandleInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExportFenceWin32HandleInfoKHR moonvulkan_zinitVkExportFenceWin32HandleInfoKHR
 int zinitVkExportFenceWin32HandleInfoKHR(lua_State *L, VkExportFenceWin32HandleInfoKHR* p, int *err);
 #define zfreeVkExportFenceWin32HandleInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4670,6 +5491,7 @@ int zpushVkExportFenceWin32HandleInfoKHR(lua_State *L, const VkExportFenceWin32H
 
 #define znewVkFenceGetWin32HandleInfoKHR(L, err) (VkFenceGetWin32HandleInfoKHR*)znew((L), VK_STRUCTURE_TYPE_FENCE_GET_WIN32_HANDLE_INFO_KHR, sizeof(VkFenceGetWin32HandleInfoKHR), (err))
 #define znewarrayVkFenceGetWin32HandleInfoKHR(L, count, err) (VkFenceGetWin32HandleInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_FENCE_GET_WIN32_HANDLE_INFO_KHR, sizeof(VkFenceGetWin32HandleInfoKHR), (count), (err))
+#define zinitarrayVkFenceGetWin32HandleInfoKHR(p, count) (VkFenceGetWin32HandleInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_FENCE_GET_WIN32_HANDLE_INFO_KHR, sizeof(VkFenceGetWin32HandleInfoKHR), (count))
 #define znewchainVkFenceGetWin32HandleInfoKHR moonvulkan_znewchainVkFenceGetWin32HandleInfoKHR
 VkFenceGetWin32HandleInfoKHR* znewchainVkFenceGetWin32HandleInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkFenceGetWin32HandleInfoKHR moonvulkan_znewchainarrayVkFenceGetWin32HandleInfoKHR
@@ -4678,6 +5500,8 @@ VkFenceGetWin32HandleInfoKHR* znewchainarrayVkFenceGetWin32HandleInfoKHR(lua_Sta
 VkFenceGetWin32HandleInfoKHR* zcheckVkFenceGetWin32HandleInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkFenceGetWin32HandleInfoKHR moonvulkan_zcheckarrayVkFenceGetWin32HandleInfoKHR
 VkFenceGetWin32HandleInfoKHR* zcheckarrayVkFenceGetWin32HandleInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkFenceGetWin32HandleInfoKHR moonvulkan_zcheckarraybufVkFenceGetWin32HandleInfoKHR
+VkFenceGetWin32HandleInfoKHR* zcheckarraybufVkFenceGetWin32HandleInfoKHR(lua_State *L, int arg, VkFenceGetWin32HandleInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkFenceGetWin32HandleInfoKHR moonvulkan_zinitVkFenceGetWin32HandleInfoKHR
 int zinitVkFenceGetWin32HandleInfoKHR(lua_State *L, VkFenceGetWin32HandleInfoKHR* p, int *err);
 #define zfreeVkFenceGetWin32HandleInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4687,6 +5511,7 @@ int zpushVkFenceGetWin32HandleInfoKHR(lua_State *L, const VkFenceGetWin32HandleI
 
 #define znewVkImportMemoryWin32HandleInfoKHR(L, err) (VkImportMemoryWin32HandleInfoKHR*)znew((L), VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR, sizeof(VkImportMemoryWin32HandleInfoKHR), (err))
 #define znewarrayVkImportMemoryWin32HandleInfoKHR(L, count, err) (VkImportMemoryWin32HandleInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR, sizeof(VkImportMemoryWin32HandleInfoKHR), (count), (err))
+#define zinitarrayVkImportMemoryWin32HandleInfoKHR(p, count) (VkImportMemoryWin32HandleInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR, sizeof(VkImportMemoryWin32HandleInfoKHR), (count))
 #define znewchainVkImportMemoryWin32HandleInfoKHR moonvulkan_znewchainVkImportMemoryWin32HandleInfoKHR
 VkImportMemoryWin32HandleInfoKHR* znewchainVkImportMemoryWin32HandleInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkImportMemoryWin32HandleInfoKHR moonvulkan_znewchainarrayVkImportMemoryWin32HandleInfoKHR
@@ -4695,6 +5520,8 @@ VkImportMemoryWin32HandleInfoKHR* znewchainarrayVkImportMemoryWin32HandleInfoKHR
 VkImportMemoryWin32HandleInfoKHR* zcheckVkImportMemoryWin32HandleInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImportMemoryWin32HandleInfoKHR moonvulkan_zcheckarrayVkImportMemoryWin32HandleInfoKHR
 VkImportMemoryWin32HandleInfoKHR* zcheckarrayVkImportMemoryWin32HandleInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImportMemoryWin32HandleInfoKHR moonvulkan_zcheckarraybufVkImportMemoryWin32HandleInfoKHR
+VkImportMemoryWin32HandleInfoKHR* zcheckarraybufVkImportMemoryWin32HandleInfoKHR(lua_State *L, int arg, VkImportMemoryWin32HandleInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImportMemoryWin32HandleInfoKHR moonvulkan_zinitVkImportMemoryWin32HandleInfoKHR
 int zinitVkImportMemoryWin32HandleInfoKHR(lua_State *L, VkImportMemoryWin32HandleInfoKHR* p, int *err);
 #define zfreeVkImportMemoryWin32HandleInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4704,6 +5531,7 @@ int zpushVkImportMemoryWin32HandleInfoKHR(lua_State *L, const VkImportMemoryWin3
 
 #define znewVkExportMemoryWin32HandleInfoKHR(L, err) (VkExportMemoryWin32HandleInfoKHR*)znew((L), VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR, sizeof(VkExportMemoryWin32HandleInfoKHR), (err))
 #define znewarrayVkExportMemoryWin32HandleInfoKHR(L, count, err) (VkExportMemoryWin32HandleInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR, sizeof(VkExportMemoryWin32HandleInfoKHR), (count), (err))
+#define zinitarrayVkExportMemoryWin32HandleInfoKHR(p, count) (VkExportMemoryWin32HandleInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR, sizeof(VkExportMemoryWin32HandleInfoKHR), (count))
 #define znewchainVkExportMemoryWin32HandleInfoKHR moonvulkan_znewchainVkExportMemoryWin32HandleInfoKHR
 VkExportMemoryWin32HandleInfoKHR* znewchainVkExportMemoryWin32HandleInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkExportMemoryWin32HandleInfoKHR moonvulkan_znewchainarrayVkExportMemoryWin32HandleInfoKHR
@@ -4712,6 +5540,8 @@ VkExportMemoryWin32HandleInfoKHR* znewchainarrayVkExportMemoryWin32HandleInfoKHR
 VkExportMemoryWin32HandleInfoKHR* zcheckVkExportMemoryWin32HandleInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExportMemoryWin32HandleInfoKHR moonvulkan_zcheckarrayVkExportMemoryWin32HandleInfoKHR
 VkExportMemoryWin32HandleInfoKHR* zcheckarrayVkExportMemoryWin32HandleInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExportMemoryWin32HandleInfoKHR moonvulkan_zcheckarraybufVkExportMemoryWin32HandleInfoKHR
+VkExportMemoryWin32HandleInfoKHR* zcheckarraybufVkExportMemoryWin32HandleInfoKHR(lua_State *L, int arg, VkExportMemoryWin32HandleInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExportMemoryWin32HandleInfoKHR moonvulkan_zinitVkExportMemoryWin32HandleInfoKHR
 int zinitVkExportMemoryWin32HandleInfoKHR(lua_State *L, VkExportMemoryWin32HandleInfoKHR* p, int *err);
 #define zfreeVkExportMemoryWin32HandleInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4721,6 +5551,7 @@ int zpushVkExportMemoryWin32HandleInfoKHR(lua_State *L, const VkExportMemoryWin3
 
 #define znewVkMemoryWin32HandlePropertiesKHR(L, err) (VkMemoryWin32HandlePropertiesKHR*)znew((L), VK_STRUCTURE_TYPE_MEMORY_WIN32_HANDLE_PROPERTIES_KHR, sizeof(VkMemoryWin32HandlePropertiesKHR), (err))
 #define znewarrayVkMemoryWin32HandlePropertiesKHR(L, count, err) (VkMemoryWin32HandlePropertiesKHR*)znewarray((L), VK_STRUCTURE_TYPE_MEMORY_WIN32_HANDLE_PROPERTIES_KHR, sizeof(VkMemoryWin32HandlePropertiesKHR), (count), (err))
+#define zinitarrayVkMemoryWin32HandlePropertiesKHR(p, count) (VkMemoryWin32HandlePropertiesKHR*)zinitarray((p), VK_STRUCTURE_TYPE_MEMORY_WIN32_HANDLE_PROPERTIES_KHR, sizeof(VkMemoryWin32HandlePropertiesKHR), (count))
 #define znewchainVkMemoryWin32HandlePropertiesKHR moonvulkan_znewchainVkMemoryWin32HandlePropertiesKHR
 VkMemoryWin32HandlePropertiesKHR* znewchainVkMemoryWin32HandlePropertiesKHR(lua_State *L, int *err);
 #define znewchainarrayVkMemoryWin32HandlePropertiesKHR moonvulkan_znewchainarrayVkMemoryWin32HandlePropertiesKHR
@@ -4729,6 +5560,8 @@ VkMemoryWin32HandlePropertiesKHR* znewchainarrayVkMemoryWin32HandlePropertiesKHR
 VkMemoryWin32HandlePropertiesKHR* zcheckVkMemoryWin32HandlePropertiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryWin32HandlePropertiesKHR moonvulkan_zcheckarrayVkMemoryWin32HandlePropertiesKHR
 VkMemoryWin32HandlePropertiesKHR* zcheckarrayVkMemoryWin32HandlePropertiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryWin32HandlePropertiesKHR moonvulkan_zcheckarraybufVkMemoryWin32HandlePropertiesKHR
+VkMemoryWin32HandlePropertiesKHR* zcheckarraybufVkMemoryWin32HandlePropertiesKHR(lua_State *L, int arg, VkMemoryWin32HandlePropertiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryWin32HandlePropertiesKHR moonvulkan_zinitVkMemoryWin32HandlePropertiesKHR
 int zinitVkMemoryWin32HandlePropertiesKHR(lua_State *L, VkMemoryWin32HandlePropertiesKHR* p, int *err);
 #define zfreeVkMemoryWin32HandlePropertiesKHR(L, p, base) zfree((L), (p), (base))
@@ -4738,6 +5571,7 @@ int zpushVkMemoryWin32HandlePropertiesKHR(lua_State *L, const VkMemoryWin32Handl
 
 #define znewVkMemoryGetWin32HandleInfoKHR(L, err) (VkMemoryGetWin32HandleInfoKHR*)znew((L), VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR, sizeof(VkMemoryGetWin32HandleInfoKHR), (err))
 #define znewarrayVkMemoryGetWin32HandleInfoKHR(L, count, err) (VkMemoryGetWin32HandleInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR, sizeof(VkMemoryGetWin32HandleInfoKHR), (count), (err))
+#define zinitarrayVkMemoryGetWin32HandleInfoKHR(p, count) (VkMemoryGetWin32HandleInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR, sizeof(VkMemoryGetWin32HandleInfoKHR), (count))
 #define znewchainVkMemoryGetWin32HandleInfoKHR moonvulkan_znewchainVkMemoryGetWin32HandleInfoKHR
 VkMemoryGetWin32HandleInfoKHR* znewchainVkMemoryGetWin32HandleInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkMemoryGetWin32HandleInfoKHR moonvulkan_znewchainarrayVkMemoryGetWin32HandleInfoKHR
@@ -4746,6 +5580,8 @@ VkMemoryGetWin32HandleInfoKHR* znewchainarrayVkMemoryGetWin32HandleInfoKHR(lua_S
 VkMemoryGetWin32HandleInfoKHR* zcheckVkMemoryGetWin32HandleInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryGetWin32HandleInfoKHR moonvulkan_zcheckarrayVkMemoryGetWin32HandleInfoKHR
 VkMemoryGetWin32HandleInfoKHR* zcheckarrayVkMemoryGetWin32HandleInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryGetWin32HandleInfoKHR moonvulkan_zcheckarraybufVkMemoryGetWin32HandleInfoKHR
+VkMemoryGetWin32HandleInfoKHR* zcheckarraybufVkMemoryGetWin32HandleInfoKHR(lua_State *L, int arg, VkMemoryGetWin32HandleInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryGetWin32HandleInfoKHR moonvulkan_zinitVkMemoryGetWin32HandleInfoKHR
 int zinitVkMemoryGetWin32HandleInfoKHR(lua_State *L, VkMemoryGetWin32HandleInfoKHR* p, int *err);
 #define zfreeVkMemoryGetWin32HandleInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4755,6 +5591,7 @@ int zpushVkMemoryGetWin32HandleInfoKHR(lua_State *L, const VkMemoryGetWin32Handl
 
 #define znewVkWin32KeyedMutexAcquireReleaseInfoKHR(L, err) (VkWin32KeyedMutexAcquireReleaseInfoKHR*)znew((L), VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR, sizeof(VkWin32KeyedMutexAcquireReleaseInfoKHR), (err))
 #define znewarrayVkWin32KeyedMutexAcquireReleaseInfoKHR(L, count, err) (VkWin32KeyedMutexAcquireReleaseInfoKHR*)znewarray((L), VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR, sizeof(VkWin32KeyedMutexAcquireReleaseInfoKHR), (count), (err))
+#define zinitarrayVkWin32KeyedMutexAcquireReleaseInfoKHR(p, count) (VkWin32KeyedMutexAcquireReleaseInfoKHR*)zinitarray((p), VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR, sizeof(VkWin32KeyedMutexAcquireReleaseInfoKHR), (count))
 #define znewchainVkWin32KeyedMutexAcquireReleaseInfoKHR moonvulkan_znewchainVkWin32KeyedMutexAcquireReleaseInfoKHR
 VkWin32KeyedMutexAcquireReleaseInfoKHR* znewchainVkWin32KeyedMutexAcquireReleaseInfoKHR(lua_State *L, int *err);
 #define znewchainarrayVkWin32KeyedMutexAcquireReleaseInfoKHR moonvulkan_znewchainarrayVkWin32KeyedMutexAcquireReleaseInfoKHR
@@ -4763,6 +5600,8 @@ VkWin32KeyedMutexAcquireReleaseInfoKHR* znewchainarrayVkWin32KeyedMutexAcquireRe
 VkWin32KeyedMutexAcquireReleaseInfoKHR* zcheckVkWin32KeyedMutexAcquireReleaseInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkWin32KeyedMutexAcquireReleaseInfoKHR moonvulkan_zcheckarrayVkWin32KeyedMutexAcquireReleaseInfoKHR
 VkWin32KeyedMutexAcquireReleaseInfoKHR* zcheckarrayVkWin32KeyedMutexAcquireReleaseInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkWin32KeyedMutexAcquireReleaseInfoKHR moonvulkan_zcheckarraybufVkWin32KeyedMutexAcquireReleaseInfoKHR
+VkWin32KeyedMutexAcquireReleaseInfoKHR* zcheckarraybufVkWin32KeyedMutexAcquireReleaseInfoKHR(lua_State *L, int arg, VkWin32KeyedMutexAcquireReleaseInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkWin32KeyedMutexAcquireReleaseInfoKHR moonvulkan_zinitVkWin32KeyedMutexAcquireReleaseInfoKHR
 int zinitVkWin32KeyedMutexAcquireReleaseInfoKHR(lua_State *L, VkWin32KeyedMutexAcquireReleaseInfoKHR* p, int *err);
 #define zfreeVkWin32KeyedMutexAcquireReleaseInfoKHR(L, p, base) zfree((L), (p), (base))
@@ -4772,6 +5611,7 @@ int zpushVkWin32KeyedMutexAcquireReleaseInfoKHR(lua_State *L, const VkWin32Keyed
 
 #define znewVkSurfaceFullScreenExclusiveWin32InfoEXT(L, err) (VkSurfaceFullScreenExclusiveWin32InfoEXT*)znew((L), VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT, sizeof(VkSurfaceFullScreenExclusiveWin32InfoEXT), (err))
 #define znewarrayVkSurfaceFullScreenExclusiveWin32InfoEXT(L, count, err) (VkSurfaceFullScreenExclusiveWin32InfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT, sizeof(VkSurfaceFullScreenExclusiveWin32InfoEXT), (count), (err))
+#define zinitarrayVkSurfaceFullScreenExclusiveWin32InfoEXT(p, count) (VkSurfaceFullScreenExclusiveWin32InfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT, sizeof(VkSurfaceFullScreenExclusiveWin32InfoEXT), (count))
 #define znewchainVkSurfaceFullScreenExclusiveWin32InfoEXT moonvulkan_znewchainVkSurfaceFullScreenExclusiveWin32InfoEXT
 VkSurfaceFullScreenExclusiveWin32InfoEXT* znewchainVkSurfaceFullScreenExclusiveWin32InfoEXT(lua_State *L, int *err);
 #define znewchainarrayVkSurfaceFullScreenExclusiveWin32InfoEXT moonvulkan_znewchainarrayVkSurfaceFullScreenExclusiveWin32InfoEXT
@@ -4780,6 +5620,8 @@ VkSurfaceFullScreenExclusiveWin32InfoEXT* znewchainarrayVkSurfaceFullScreenExclu
 VkSurfaceFullScreenExclusiveWin32InfoEXT* zcheckVkSurfaceFullScreenExclusiveWin32InfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSurfaceFullScreenExclusiveWin32InfoEXT moonvulkan_zcheckarrayVkSurfaceFullScreenExclusiveWin32InfoEXT
 VkSurfaceFullScreenExclusiveWin32InfoEXT* zcheckarrayVkSurfaceFullScreenExclusiveWin32InfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSurfaceFullScreenExclusiveWin32InfoEXT moonvulkan_zcheckarraybufVkSurfaceFullScreenExclusiveWin32InfoEXT
+VkSurfaceFullScreenExclusiveWin32InfoEXT* zcheckarraybufVkSurfaceFullScreenExclusiveWin32InfoEXT(lua_State *L, int arg, VkSurfaceFullScreenExclusiveWin32InfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSurfaceFullScreenExclusiveWin32InfoEXT moonvulkan_zinitVkSurfaceFullScreenExclusiveWin32InfoEXT
 int zinitVkSurfaceFullScreenExclusiveWin32InfoEXT(lua_State *L, VkSurfaceFullScreenExclusiveWin32InfoEXT* p, int *err);
 #define zfreeVkSurfaceFullScreenExclusiveWin32InfoEXT(L, p, base) zfree((L), (p), (base))
@@ -4789,6 +5631,7 @@ int zpushVkSurfaceFullScreenExclusiveWin32InfoEXT(lua_State *L, const VkSurfaceF
 
 #define znewVkFormatProperties3KHR(L, err) (VkFormatProperties3KHR*)znew((L), VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3_KHR, sizeof(VkFormatProperties3KHR), (err))
 #define znewarrayVkFormatProperties3KHR(L, count, err) (VkFormatProperties3KHR*)znewarray((L), VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3_KHR, sizeof(VkFormatProperties3KHR), (count), (err))
+#define zinitarrayVkFormatProperties3KHR(p, count) (VkFormatProperties3KHR*)zinitarray((p), VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3_KHR, sizeof(VkFormatProperties3KHR), (count))
 #define znewchainVkFormatProperties3KHR moonvulkan_znewchainVkFormatProperties3KHR
 VkFormatProperties3KHR* znewchainVkFormatProperties3KHR(lua_State *L, int *err);
 #define znewchainarrayVkFormatProperties3KHR moonvulkan_znewchainarrayVkFormatProperties3KHR
@@ -4797,6 +5640,8 @@ VkFormatProperties3KHR* znewchainarrayVkFormatProperties3KHR(lua_State *L, uint3
 VkFormatProperties3KHR* zcheckVkFormatProperties3KHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkFormatProperties3KHR moonvulkan_zcheckarrayVkFormatProperties3KHR
 VkFormatProperties3KHR* zcheckarrayVkFormatProperties3KHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkFormatProperties3KHR moonvulkan_zcheckarraybufVkFormatProperties3KHR
+VkFormatProperties3KHR* zcheckarraybufVkFormatProperties3KHR(lua_State *L, int arg, VkFormatProperties3KHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkFormatProperties3KHR moonvulkan_zinitVkFormatProperties3KHR
 int zinitVkFormatProperties3KHR(lua_State *L, VkFormatProperties3KHR* p, int *err);
 #define zfreeVkFormatProperties3KHR(L, p, base) zfree((L), (p), (base))
@@ -4807,6 +5652,32 @@ int zpushVkFormatProperties3KHR(lua_State *L, const VkFormatProperties3KHR *p);
 
 #endif /* VK_USE_PLATFORM_WIN32_KHR */
 
+
+#ifdef VK_EXT_shader_object
+
+#define znewVkShaderCreateInfoEXT(L, err) (VkShaderCreateInfoEXT*)znew((L), VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT, sizeof(VkShaderCreateInfoEXT), (err))
+#define znewarrayVkShaderCreateInfoEXT(L, count, err) (VkShaderCreateInfoEXT*)znewarray((L), VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT, sizeof(VkShaderCreateInfoEXT), (count), (err))
+#define zinitarrayVkShaderCreateInfoEXT(p, count) (VkShaderCreateInfoEXT*)zinitarray((p), VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT, sizeof(VkShaderCreateInfoEXT), (count))
+#define znewchainVkShaderCreateInfoEXT moonvulkan_znewchainVkShaderCreateInfoEXT
+VkShaderCreateInfoEXT* znewchainVkShaderCreateInfoEXT(lua_State *L, int *err);
+#define znewchainarrayVkShaderCreateInfoEXT moonvulkan_znewchainarrayVkShaderCreateInfoEXT
+VkShaderCreateInfoEXT* znewchainarrayVkShaderCreateInfoEXT(lua_State *L, uint32_t count, int *err);
+#define zcheckVkShaderCreateInfoEXT moonvulkan_zcheckVkShaderCreateInfoEXT
+VkShaderCreateInfoEXT* zcheckVkShaderCreateInfoEXT(lua_State *L, int arg, int *err);
+#define zcheckarrayVkShaderCreateInfoEXT moonvulkan_zcheckarrayVkShaderCreateInfoEXT
+VkShaderCreateInfoEXT* zcheckarrayVkShaderCreateInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkShaderCreateInfoEXT moonvulkan_zcheckarraybufVkShaderCreateInfoEXT
+VkShaderCreateInfoEXT* zcheckarraybufVkShaderCreateInfoEXT(lua_State *L, int arg, VkShaderCreateInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
+#define zinitVkShaderCreateInfoEXT moonvulkan_zinitVkShaderCreateInfoEXT
+int zinitVkShaderCreateInfoEXT(lua_State *L, VkShaderCreateInfoEXT* p, int *err);
+#define zfreeVkShaderCreateInfoEXT(L, p, base) zfree((L), (p), (base))
+#define zfreearrayVkShaderCreateInfoEXT(L, p, count, base) zfreearray((L), (p), sizeof(VkShaderCreateInfoEXT), (count), (base))
+#define zpushVkShaderCreateInfoEXT moonvulkan_zpushVkShaderCreateInfoEXT
+int zpushVkShaderCreateInfoEXT(lua_State *L, const VkShaderCreateInfoEXT *p);
+
+
+#endif /* VK_EXT_shader_object */
+
 /*------------------------------------------------------------------------------*
  | Untyped structs                                                              |
  *------------------------------------------------------------------------------*/
@@ -4814,10 +5685,13 @@ int zpushVkFormatProperties3KHR(lua_State *L, const VkFormatProperties3KHR *p);
 #define zclearVkViewport NULL
 #define znewVkViewport(L, err) (VkViewport*)znew((L), -1, sizeof(VkViewport),(err))
 #define znewarrayVkViewport(L, count, err) (VkViewport*)znewarray((L),-1, sizeof(VkViewport), (count), (err))
+#define zinitarrayVkViewport(p, count) (VkViewport*)zinitarray((p),-1, sizeof(VkViewport), (count))
 #define zcheckVkViewport moonvulkan_zcheckVkViewport
 VkViewport* zcheckVkViewport(lua_State *L, int arg, int *err);
 #define zcheckarrayVkViewport moonvulkan_zcheckarrayVkViewport
 VkViewport* zcheckarrayVkViewport(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkViewport moonvulkan_zcheckarraybufVkViewport
+VkViewport* zcheckarraybufVkViewport(lua_State *L, int arg, VkViewport *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkViewport moonvulkan_zinitVkViewport
 int zinitVkViewport(lua_State *L, VkViewport* p, int *err);
 #define zfreeVkViewport(L, p, base) zfree_untyped((L), (p), (base), zclearVkViewport)
@@ -4828,10 +5702,13 @@ int zpushVkViewport(lua_State *L, const VkViewport *p);
 #define zclearVkOffset2D NULL
 #define znewVkOffset2D(L, err) (VkOffset2D*)znew((L), -1, sizeof(VkOffset2D),(err))
 #define znewarrayVkOffset2D(L, count, err) (VkOffset2D*)znewarray((L),-1, sizeof(VkOffset2D), (count), (err))
+#define zinitarrayVkOffset2D(p, count) (VkOffset2D*)zinitarray((p),-1, sizeof(VkOffset2D), (count))
 #define zcheckVkOffset2D moonvulkan_zcheckVkOffset2D
 VkOffset2D* zcheckVkOffset2D(lua_State *L, int arg, int *err);
 #define zcheckarrayVkOffset2D moonvulkan_zcheckarrayVkOffset2D
 VkOffset2D* zcheckarrayVkOffset2D(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkOffset2D moonvulkan_zcheckarraybufVkOffset2D
+VkOffset2D* zcheckarraybufVkOffset2D(lua_State *L, int arg, VkOffset2D *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkOffset2D moonvulkan_zinitVkOffset2D
 int zinitVkOffset2D(lua_State *L, VkOffset2D* p, int *err);
 #define zfreeVkOffset2D(L, p, base) zfree_untyped((L), (p), (base), zclearVkOffset2D)
@@ -4842,10 +5719,13 @@ int zpushVkOffset2D(lua_State *L, const VkOffset2D *p);
 #define zclearVkOffset3D NULL
 #define znewVkOffset3D(L, err) (VkOffset3D*)znew((L), -1, sizeof(VkOffset3D),(err))
 #define znewarrayVkOffset3D(L, count, err) (VkOffset3D*)znewarray((L),-1, sizeof(VkOffset3D), (count), (err))
+#define zinitarrayVkOffset3D(p, count) (VkOffset3D*)zinitarray((p),-1, sizeof(VkOffset3D), (count))
 #define zcheckVkOffset3D moonvulkan_zcheckVkOffset3D
 VkOffset3D* zcheckVkOffset3D(lua_State *L, int arg, int *err);
 #define zcheckarrayVkOffset3D moonvulkan_zcheckarrayVkOffset3D
 VkOffset3D* zcheckarrayVkOffset3D(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkOffset3D moonvulkan_zcheckarraybufVkOffset3D
+VkOffset3D* zcheckarraybufVkOffset3D(lua_State *L, int arg, VkOffset3D *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkOffset3D moonvulkan_zinitVkOffset3D
 int zinitVkOffset3D(lua_State *L, VkOffset3D* p, int *err);
 #define zfreeVkOffset3D(L, p, base) zfree_untyped((L), (p), (base), zclearVkOffset3D)
@@ -4856,10 +5736,13 @@ int zpushVkOffset3D(lua_State *L, const VkOffset3D *p);
 #define zclearVkExtent2D NULL
 #define znewVkExtent2D(L, err) (VkExtent2D*)znew((L), -1, sizeof(VkExtent2D),(err))
 #define znewarrayVkExtent2D(L, count, err) (VkExtent2D*)znewarray((L),-1, sizeof(VkExtent2D), (count), (err))
+#define zinitarrayVkExtent2D(p, count) (VkExtent2D*)zinitarray((p),-1, sizeof(VkExtent2D), (count))
 #define zcheckVkExtent2D moonvulkan_zcheckVkExtent2D
 VkExtent2D* zcheckVkExtent2D(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExtent2D moonvulkan_zcheckarrayVkExtent2D
 VkExtent2D* zcheckarrayVkExtent2D(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExtent2D moonvulkan_zcheckarraybufVkExtent2D
+VkExtent2D* zcheckarraybufVkExtent2D(lua_State *L, int arg, VkExtent2D *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExtent2D moonvulkan_zinitVkExtent2D
 int zinitVkExtent2D(lua_State *L, VkExtent2D* p, int *err);
 #define zfreeVkExtent2D(L, p, base) zfree_untyped((L), (p), (base), zclearVkExtent2D)
@@ -4870,10 +5753,13 @@ int zpushVkExtent2D(lua_State *L, const VkExtent2D *p);
 #define zclearVkExtent3D NULL
 #define znewVkExtent3D(L, err) (VkExtent3D*)znew((L), -1, sizeof(VkExtent3D),(err))
 #define znewarrayVkExtent3D(L, count, err) (VkExtent3D*)znewarray((L),-1, sizeof(VkExtent3D), (count), (err))
+#define zinitarrayVkExtent3D(p, count) (VkExtent3D*)zinitarray((p),-1, sizeof(VkExtent3D), (count))
 #define zcheckVkExtent3D moonvulkan_zcheckVkExtent3D
 VkExtent3D* zcheckVkExtent3D(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExtent3D moonvulkan_zcheckarrayVkExtent3D
 VkExtent3D* zcheckarrayVkExtent3D(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExtent3D moonvulkan_zcheckarraybufVkExtent3D
+VkExtent3D* zcheckarraybufVkExtent3D(lua_State *L, int arg, VkExtent3D *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExtent3D moonvulkan_zinitVkExtent3D
 int zinitVkExtent3D(lua_State *L, VkExtent3D* p, int *err);
 #define zfreeVkExtent3D(L, p, base) zfree_untyped((L), (p), (base), zclearVkExtent3D)
@@ -4884,10 +5770,13 @@ int zpushVkExtent3D(lua_State *L, const VkExtent3D *p);
 #define zclearVkRect2D NULL
 #define znewVkRect2D(L, err) (VkRect2D*)znew((L), -1, sizeof(VkRect2D),(err))
 #define znewarrayVkRect2D(L, count, err) (VkRect2D*)znewarray((L),-1, sizeof(VkRect2D), (count), (err))
+#define zinitarrayVkRect2D(p, count) (VkRect2D*)zinitarray((p),-1, sizeof(VkRect2D), (count))
 #define zcheckVkRect2D moonvulkan_zcheckVkRect2D
 VkRect2D* zcheckVkRect2D(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRect2D moonvulkan_zcheckarrayVkRect2D
 VkRect2D* zcheckarrayVkRect2D(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRect2D moonvulkan_zcheckarraybufVkRect2D
+VkRect2D* zcheckarraybufVkRect2D(lua_State *L, int arg, VkRect2D *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRect2D moonvulkan_zinitVkRect2D
 int zinitVkRect2D(lua_State *L, VkRect2D* p, int *err);
 #define zfreeVkRect2D(L, p, base) zfree_untyped((L), (p), (base), zclearVkRect2D)
@@ -4898,10 +5787,13 @@ int zpushVkRect2D(lua_State *L, const VkRect2D *p);
 #define zclearVkXYColorEXT NULL
 #define znewVkXYColorEXT(L, err) (VkXYColorEXT*)znew((L), -1, sizeof(VkXYColorEXT),(err))
 #define znewarrayVkXYColorEXT(L, count, err) (VkXYColorEXT*)znewarray((L),-1, sizeof(VkXYColorEXT), (count), (err))
+#define zinitarrayVkXYColorEXT(p, count) (VkXYColorEXT*)zinitarray((p),-1, sizeof(VkXYColorEXT), (count))
 #define zcheckVkXYColorEXT moonvulkan_zcheckVkXYColorEXT
 VkXYColorEXT* zcheckVkXYColorEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkXYColorEXT moonvulkan_zcheckarrayVkXYColorEXT
 VkXYColorEXT* zcheckarrayVkXYColorEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkXYColorEXT moonvulkan_zcheckarraybufVkXYColorEXT
+VkXYColorEXT* zcheckarraybufVkXYColorEXT(lua_State *L, int arg, VkXYColorEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkXYColorEXT moonvulkan_zinitVkXYColorEXT
 int zinitVkXYColorEXT(lua_State *L, VkXYColorEXT* p, int *err);
 #define zfreeVkXYColorEXT(L, p, base) zfree_untyped((L), (p), (base), zclearVkXYColorEXT)
@@ -4912,10 +5804,13 @@ int zpushVkXYColorEXT(lua_State *L, const VkXYColorEXT *p);
 #define zclearVkComponentMapping NULL
 #define znewVkComponentMapping(L, err) (VkComponentMapping*)znew((L), -1, sizeof(VkComponentMapping),(err))
 #define znewarrayVkComponentMapping(L, count, err) (VkComponentMapping*)znewarray((L),-1, sizeof(VkComponentMapping), (count), (err))
+#define zinitarrayVkComponentMapping(p, count) (VkComponentMapping*)zinitarray((p),-1, sizeof(VkComponentMapping), (count))
 #define zcheckVkComponentMapping moonvulkan_zcheckVkComponentMapping
 VkComponentMapping* zcheckVkComponentMapping(lua_State *L, int arg, int *err);
 #define zcheckarrayVkComponentMapping moonvulkan_zcheckarrayVkComponentMapping
 VkComponentMapping* zcheckarrayVkComponentMapping(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkComponentMapping moonvulkan_zcheckarraybufVkComponentMapping
+VkComponentMapping* zcheckarraybufVkComponentMapping(lua_State *L, int arg, VkComponentMapping *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkComponentMapping moonvulkan_zinitVkComponentMapping
 int zinitVkComponentMapping(lua_State *L, VkComponentMapping* p, int *err);
 #define zfreeVkComponentMapping(L, p, base) zfree_untyped((L), (p), (base), zclearVkComponentMapping)
@@ -4926,10 +5821,13 @@ int zpushVkComponentMapping(lua_State *L, const VkComponentMapping *p);
 #define zclearVkSampleLocationEXT NULL
 #define znewVkSampleLocationEXT(L, err) (VkSampleLocationEXT*)znew((L), -1, sizeof(VkSampleLocationEXT),(err))
 #define znewarrayVkSampleLocationEXT(L, count, err) (VkSampleLocationEXT*)znewarray((L),-1, sizeof(VkSampleLocationEXT), (count), (err))
+#define zinitarrayVkSampleLocationEXT(p, count) (VkSampleLocationEXT*)zinitarray((p),-1, sizeof(VkSampleLocationEXT), (count))
 #define zcheckVkSampleLocationEXT moonvulkan_zcheckVkSampleLocationEXT
 VkSampleLocationEXT* zcheckVkSampleLocationEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSampleLocationEXT moonvulkan_zcheckarrayVkSampleLocationEXT
 VkSampleLocationEXT* zcheckarrayVkSampleLocationEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSampleLocationEXT moonvulkan_zcheckarraybufVkSampleLocationEXT
+VkSampleLocationEXT* zcheckarraybufVkSampleLocationEXT(lua_State *L, int arg, VkSampleLocationEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSampleLocationEXT moonvulkan_zinitVkSampleLocationEXT
 int zinitVkSampleLocationEXT(lua_State *L, VkSampleLocationEXT* p, int *err);
 #define zfreeVkSampleLocationEXT(L, p, base) zfree_untyped((L), (p), (base), zclearVkSampleLocationEXT)
@@ -4940,10 +5838,13 @@ int zpushVkSampleLocationEXT(lua_State *L, const VkSampleLocationEXT *p);
 #define zclearVkImageSubresourceRange NULL
 #define znewVkImageSubresourceRange(L, err) (VkImageSubresourceRange*)znew((L), -1, sizeof(VkImageSubresourceRange),(err))
 #define znewarrayVkImageSubresourceRange(L, count, err) (VkImageSubresourceRange*)znewarray((L),-1, sizeof(VkImageSubresourceRange), (count), (err))
+#define zinitarrayVkImageSubresourceRange(p, count) (VkImageSubresourceRange*)zinitarray((p),-1, sizeof(VkImageSubresourceRange), (count))
 #define zcheckVkImageSubresourceRange moonvulkan_zcheckVkImageSubresourceRange
 VkImageSubresourceRange* zcheckVkImageSubresourceRange(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageSubresourceRange moonvulkan_zcheckarrayVkImageSubresourceRange
 VkImageSubresourceRange* zcheckarrayVkImageSubresourceRange(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageSubresourceRange moonvulkan_zcheckarraybufVkImageSubresourceRange
+VkImageSubresourceRange* zcheckarraybufVkImageSubresourceRange(lua_State *L, int arg, VkImageSubresourceRange *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageSubresourceRange moonvulkan_zinitVkImageSubresourceRange
 int zinitVkImageSubresourceRange(lua_State *L, VkImageSubresourceRange* p, int *err);
 #define zfreeVkImageSubresourceRange(L, p, base) zfree_untyped((L), (p), (base), zclearVkImageSubresourceRange)
@@ -4954,10 +5855,13 @@ int zpushVkImageSubresourceRange(lua_State *L, const VkImageSubresourceRange *p)
 #define zclearVkImageSubresourceRange NULL
 #define znewVkImageSubresourceRange(L, err) (VkImageSubresourceRange*)znew((L), -1, sizeof(VkImageSubresourceRange),(err))
 #define znewarrayVkImageSubresourceRange(L, count, err) (VkImageSubresourceRange*)znewarray((L),-1, sizeof(VkImageSubresourceRange), (count), (err))
+#define zinitarrayVkImageSubresourceRange(p, count) (VkImageSubresourceRange*)zinitarray((p),-1, sizeof(VkImageSubresourceRange), (count))
 #define zcheckVkImageSubresourceRange moonvulkan_zcheckVkImageSubresourceRange
 VkImageSubresourceRange* zcheckVkImageSubresourceRange(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageSubresourceRange moonvulkan_zcheckarrayVkImageSubresourceRange
 VkImageSubresourceRange* zcheckarrayVkImageSubresourceRange(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageSubresourceRange moonvulkan_zcheckarraybufVkImageSubresourceRange
+VkImageSubresourceRange* zcheckarraybufVkImageSubresourceRange(lua_State *L, int arg, VkImageSubresourceRange *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageSubresourceRange moonvulkan_zinitVkImageSubresourceRange
 int zinitVkImageSubresourceRange(lua_State *L, VkImageSubresourceRange* p, int *err);
 #define zfreeVkImageSubresourceRange(L, p, base) zfree_untyped((L), (p), (base), zclearVkImageSubresourceRange)
@@ -4968,10 +5872,13 @@ int zpushVkImageSubresourceRange(lua_State *L, const VkImageSubresourceRange *p)
 #define zclearVkExtensionProperties NULL
 #define znewVkExtensionProperties(L, err) (VkExtensionProperties*)znew((L), -1, sizeof(VkExtensionProperties),(err))
 #define znewarrayVkExtensionProperties(L, count, err) (VkExtensionProperties*)znewarray((L),-1, sizeof(VkExtensionProperties), (count), (err))
+#define zinitarrayVkExtensionProperties(p, count) (VkExtensionProperties*)zinitarray((p),-1, sizeof(VkExtensionProperties), (count))
 #define zcheckVkExtensionProperties moonvulkan_zcheckVkExtensionProperties
 VkExtensionProperties* zcheckVkExtensionProperties(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExtensionProperties moonvulkan_zcheckarrayVkExtensionProperties
 VkExtensionProperties* zcheckarrayVkExtensionProperties(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExtensionProperties moonvulkan_zcheckarraybufVkExtensionProperties
+VkExtensionProperties* zcheckarraybufVkExtensionProperties(lua_State *L, int arg, VkExtensionProperties *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExtensionProperties moonvulkan_zinitVkExtensionProperties
 int zinitVkExtensionProperties(lua_State *L, VkExtensionProperties* p, int *err);
 #define zfreeVkExtensionProperties(L, p, base) zfree_untyped((L), (p), (base), zclearVkExtensionProperties)
@@ -4982,10 +5889,13 @@ int zpushVkExtensionProperties(lua_State *L, const VkExtensionProperties *p);
 #define zclearVkLayerProperties NULL
 #define znewVkLayerProperties(L, err) (VkLayerProperties*)znew((L), -1, sizeof(VkLayerProperties),(err))
 #define znewarrayVkLayerProperties(L, count, err) (VkLayerProperties*)znewarray((L),-1, sizeof(VkLayerProperties), (count), (err))
+#define zinitarrayVkLayerProperties(p, count) (VkLayerProperties*)zinitarray((p),-1, sizeof(VkLayerProperties), (count))
 #define zcheckVkLayerProperties moonvulkan_zcheckVkLayerProperties
 VkLayerProperties* zcheckVkLayerProperties(lua_State *L, int arg, int *err);
 #define zcheckarrayVkLayerProperties moonvulkan_zcheckarrayVkLayerProperties
 VkLayerProperties* zcheckarrayVkLayerProperties(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkLayerProperties moonvulkan_zcheckarraybufVkLayerProperties
+VkLayerProperties* zcheckarraybufVkLayerProperties(lua_State *L, int arg, VkLayerProperties *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkLayerProperties moonvulkan_zinitVkLayerProperties
 int zinitVkLayerProperties(lua_State *L, VkLayerProperties* p, int *err);
 #define zfreeVkLayerProperties(L, p, base) zfree_untyped((L), (p), (base), zclearVkLayerProperties)
@@ -4996,10 +5906,13 @@ int zpushVkLayerProperties(lua_State *L, const VkLayerProperties *p);
 #define zclearVkClearColorValue NULL
 #define znewVkClearColorValue(L, err) (VkClearColorValue*)znew((L), -1, sizeof(VkClearColorValue),(err))
 #define znewarrayVkClearColorValue(L, count, err) (VkClearColorValue*)znewarray((L),-1, sizeof(VkClearColorValue), (count), (err))
+#define zinitarrayVkClearColorValue(p, count) (VkClearColorValue*)zinitarray((p),-1, sizeof(VkClearColorValue), (count))
 #define zcheckVkClearColorValue moonvulkan_zcheckVkClearColorValue
 VkClearColorValue* zcheckVkClearColorValue(lua_State *L, int arg, int *err);
 #define zcheckarrayVkClearColorValue moonvulkan_zcheckarrayVkClearColorValue
 VkClearColorValue* zcheckarrayVkClearColorValue(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkClearColorValue moonvulkan_zcheckarraybufVkClearColorValue
+VkClearColorValue* zcheckarraybufVkClearColorValue(lua_State *L, int arg, VkClearColorValue *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkClearColorValue moonvulkan_zinitVkClearColorValue
 int zinitVkClearColorValue(lua_State *L, VkClearColorValue* p, int *err);
 #define zfreeVkClearColorValue(L, p, base) zfree_untyped((L), (p), (base), zclearVkClearColorValue)
@@ -5010,10 +5923,13 @@ int zpushVkClearColorValue(lua_State *L, const VkClearColorValue *p);
 #define zclearVkClearValue NULL
 #define znewVkClearValue(L, err) (VkClearValue*)znew((L), -1, sizeof(VkClearValue),(err))
 #define znewarrayVkClearValue(L, count, err) (VkClearValue*)znewarray((L),-1, sizeof(VkClearValue), (count), (err))
+#define zinitarrayVkClearValue(p, count) (VkClearValue*)zinitarray((p),-1, sizeof(VkClearValue), (count))
 #define zcheckVkClearValue moonvulkan_zcheckVkClearValue
 VkClearValue* zcheckVkClearValue(lua_State *L, int arg, int *err);
 #define zcheckarrayVkClearValue moonvulkan_zcheckarrayVkClearValue
 VkClearValue* zcheckarrayVkClearValue(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkClearValue moonvulkan_zcheckarraybufVkClearValue
+VkClearValue* zcheckarraybufVkClearValue(lua_State *L, int arg, VkClearValue *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkClearValue moonvulkan_zinitVkClearValue
 int zinitVkClearValue(lua_State *L, VkClearValue* p, int *err);
 #define zfreeVkClearValue(L, p, base) zfree_untyped((L), (p), (base), zclearVkClearValue)
@@ -5024,10 +5940,13 @@ int zpushVkClearValue(lua_State *L, const VkClearValue *p);
 #define zclearVkClearAttachment NULL
 #define znewVkClearAttachment(L, err) (VkClearAttachment*)znew((L), -1, sizeof(VkClearAttachment),(err))
 #define znewarrayVkClearAttachment(L, count, err) (VkClearAttachment*)znewarray((L),-1, sizeof(VkClearAttachment), (count), (err))
+#define zinitarrayVkClearAttachment(p, count) (VkClearAttachment*)zinitarray((p),-1, sizeof(VkClearAttachment), (count))
 #define zcheckVkClearAttachment moonvulkan_zcheckVkClearAttachment
 VkClearAttachment* zcheckVkClearAttachment(lua_State *L, int arg, int *err);
 #define zcheckarrayVkClearAttachment moonvulkan_zcheckarrayVkClearAttachment
 VkClearAttachment* zcheckarrayVkClearAttachment(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkClearAttachment moonvulkan_zcheckarraybufVkClearAttachment
+VkClearAttachment* zcheckarraybufVkClearAttachment(lua_State *L, int arg, VkClearAttachment *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkClearAttachment moonvulkan_zinitVkClearAttachment
 int zinitVkClearAttachment(lua_State *L, VkClearAttachment* p, int *err);
 #define zfreeVkClearAttachment(L, p, base) zfree_untyped((L), (p), (base), zclearVkClearAttachment)
@@ -5038,10 +5957,13 @@ int zpushVkClearAttachment(lua_State *L, const VkClearAttachment *p);
 #define zclearVkClearRect NULL
 #define znewVkClearRect(L, err) (VkClearRect*)znew((L), -1, sizeof(VkClearRect),(err))
 #define znewarrayVkClearRect(L, count, err) (VkClearRect*)znewarray((L),-1, sizeof(VkClearRect), (count), (err))
+#define zinitarrayVkClearRect(p, count) (VkClearRect*)zinitarray((p),-1, sizeof(VkClearRect), (count))
 #define zcheckVkClearRect moonvulkan_zcheckVkClearRect
 VkClearRect* zcheckVkClearRect(lua_State *L, int arg, int *err);
 #define zcheckarrayVkClearRect moonvulkan_zcheckarrayVkClearRect
 VkClearRect* zcheckarrayVkClearRect(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkClearRect moonvulkan_zcheckarraybufVkClearRect
+VkClearRect* zcheckarraybufVkClearRect(lua_State *L, int arg, VkClearRect *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkClearRect moonvulkan_zinitVkClearRect
 int zinitVkClearRect(lua_State *L, VkClearRect* p, int *err);
 #define zfreeVkClearRect(L, p, base) zfree_untyped((L), (p), (base), zclearVkClearRect)
@@ -5052,10 +5974,13 @@ int zpushVkClearRect(lua_State *L, const VkClearRect *p);
 #define zclearVkImageSubresourceLayers NULL
 #define znewVkImageSubresourceLayers(L, err) (VkImageSubresourceLayers*)znew((L), -1, sizeof(VkImageSubresourceLayers),(err))
 #define znewarrayVkImageSubresourceLayers(L, count, err) (VkImageSubresourceLayers*)znewarray((L),-1, sizeof(VkImageSubresourceLayers), (count), (err))
+#define zinitarrayVkImageSubresourceLayers(p, count) (VkImageSubresourceLayers*)zinitarray((p),-1, sizeof(VkImageSubresourceLayers), (count))
 #define zcheckVkImageSubresourceLayers moonvulkan_zcheckVkImageSubresourceLayers
 VkImageSubresourceLayers* zcheckVkImageSubresourceLayers(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageSubresourceLayers moonvulkan_zcheckarrayVkImageSubresourceLayers
 VkImageSubresourceLayers* zcheckarrayVkImageSubresourceLayers(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageSubresourceLayers moonvulkan_zcheckarraybufVkImageSubresourceLayers
+VkImageSubresourceLayers* zcheckarraybufVkImageSubresourceLayers(lua_State *L, int arg, VkImageSubresourceLayers *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageSubresourceLayers moonvulkan_zinitVkImageSubresourceLayers
 int zinitVkImageSubresourceLayers(lua_State *L, VkImageSubresourceLayers* p, int *err);
 #define zfreeVkImageSubresourceLayers(L, p, base) zfree_untyped((L), (p), (base), zclearVkImageSubresourceLayers)
@@ -5066,10 +5991,13 @@ int zpushVkImageSubresourceLayers(lua_State *L, const VkImageSubresourceLayers *
 #define zclearVkImageCopy NULL
 #define znewVkImageCopy(L, err) (VkImageCopy*)znew((L), -1, sizeof(VkImageCopy),(err))
 #define znewarrayVkImageCopy(L, count, err) (VkImageCopy*)znewarray((L),-1, sizeof(VkImageCopy), (count), (err))
+#define zinitarrayVkImageCopy(p, count) (VkImageCopy*)zinitarray((p),-1, sizeof(VkImageCopy), (count))
 #define zcheckVkImageCopy moonvulkan_zcheckVkImageCopy
 VkImageCopy* zcheckVkImageCopy(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageCopy moonvulkan_zcheckarrayVkImageCopy
 VkImageCopy* zcheckarrayVkImageCopy(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageCopy moonvulkan_zcheckarraybufVkImageCopy
+VkImageCopy* zcheckarraybufVkImageCopy(lua_State *L, int arg, VkImageCopy *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageCopy moonvulkan_zinitVkImageCopy
 int zinitVkImageCopy(lua_State *L, VkImageCopy* p, int *err);
 #define zfreeVkImageCopy(L, p, base) zfree_untyped((L), (p), (base), zclearVkImageCopy)
@@ -5080,10 +6008,13 @@ int zpushVkImageCopy(lua_State *L, const VkImageCopy *p);
 #define zclearVkImageBlit NULL
 #define znewVkImageBlit(L, err) (VkImageBlit*)znew((L), -1, sizeof(VkImageBlit),(err))
 #define znewarrayVkImageBlit(L, count, err) (VkImageBlit*)znewarray((L),-1, sizeof(VkImageBlit), (count), (err))
+#define zinitarrayVkImageBlit(p, count) (VkImageBlit*)zinitarray((p),-1, sizeof(VkImageBlit), (count))
 #define zcheckVkImageBlit moonvulkan_zcheckVkImageBlit
 VkImageBlit* zcheckVkImageBlit(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageBlit moonvulkan_zcheckarrayVkImageBlit
 VkImageBlit* zcheckarrayVkImageBlit(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageBlit moonvulkan_zcheckarraybufVkImageBlit
+VkImageBlit* zcheckarraybufVkImageBlit(lua_State *L, int arg, VkImageBlit *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageBlit moonvulkan_zinitVkImageBlit
 int zinitVkImageBlit(lua_State *L, VkImageBlit* p, int *err);
 #define zfreeVkImageBlit(L, p, base) zfree_untyped((L), (p), (base), zclearVkImageBlit)
@@ -5094,10 +6025,13 @@ int zpushVkImageBlit(lua_State *L, const VkImageBlit *p);
 #define zclearVkBufferImageCopy NULL
 #define znewVkBufferImageCopy(L, err) (VkBufferImageCopy*)znew((L), -1, sizeof(VkBufferImageCopy),(err))
 #define znewarrayVkBufferImageCopy(L, count, err) (VkBufferImageCopy*)znewarray((L),-1, sizeof(VkBufferImageCopy), (count), (err))
+#define zinitarrayVkBufferImageCopy(p, count) (VkBufferImageCopy*)zinitarray((p),-1, sizeof(VkBufferImageCopy), (count))
 #define zcheckVkBufferImageCopy moonvulkan_zcheckVkBufferImageCopy
 VkBufferImageCopy* zcheckVkBufferImageCopy(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBufferImageCopy moonvulkan_zcheckarrayVkBufferImageCopy
 VkBufferImageCopy* zcheckarrayVkBufferImageCopy(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBufferImageCopy moonvulkan_zcheckarraybufVkBufferImageCopy
+VkBufferImageCopy* zcheckarraybufVkBufferImageCopy(lua_State *L, int arg, VkBufferImageCopy *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBufferImageCopy moonvulkan_zinitVkBufferImageCopy
 int zinitVkBufferImageCopy(lua_State *L, VkBufferImageCopy* p, int *err);
 #define zfreeVkBufferImageCopy(L, p, base) zfree_untyped((L), (p), (base), zclearVkBufferImageCopy)
@@ -5108,10 +6042,13 @@ int zpushVkBufferImageCopy(lua_State *L, const VkBufferImageCopy *p);
 #define zclearVkImageResolve NULL
 #define znewVkImageResolve(L, err) (VkImageResolve*)znew((L), -1, sizeof(VkImageResolve),(err))
 #define znewarrayVkImageResolve(L, count, err) (VkImageResolve*)znewarray((L),-1, sizeof(VkImageResolve), (count), (err))
+#define zinitarrayVkImageResolve(p, count) (VkImageResolve*)zinitarray((p),-1, sizeof(VkImageResolve), (count))
 #define zcheckVkImageResolve moonvulkan_zcheckVkImageResolve
 VkImageResolve* zcheckVkImageResolve(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageResolve moonvulkan_zcheckarrayVkImageResolve
 VkImageResolve* zcheckarrayVkImageResolve(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageResolve moonvulkan_zcheckarraybufVkImageResolve
+VkImageResolve* zcheckarraybufVkImageResolve(lua_State *L, int arg, VkImageResolve *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageResolve moonvulkan_zinitVkImageResolve
 int zinitVkImageResolve(lua_State *L, VkImageResolve* p, int *err);
 #define zfreeVkImageResolve(L, p, base) zfree_untyped((L), (p), (base), zclearVkImageResolve)
@@ -5122,10 +6059,13 @@ int zpushVkImageResolve(lua_State *L, const VkImageResolve *p);
 #define zclearVkBufferCopy NULL
 #define znewVkBufferCopy(L, err) (VkBufferCopy*)znew((L), -1, sizeof(VkBufferCopy),(err))
 #define znewarrayVkBufferCopy(L, count, err) (VkBufferCopy*)znewarray((L),-1, sizeof(VkBufferCopy), (count), (err))
+#define zinitarrayVkBufferCopy(p, count) (VkBufferCopy*)zinitarray((p),-1, sizeof(VkBufferCopy), (count))
 #define zcheckVkBufferCopy moonvulkan_zcheckVkBufferCopy
 VkBufferCopy* zcheckVkBufferCopy(lua_State *L, int arg, int *err);
 #define zcheckarrayVkBufferCopy moonvulkan_zcheckarrayVkBufferCopy
 VkBufferCopy* zcheckarrayVkBufferCopy(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkBufferCopy moonvulkan_zcheckarraybufVkBufferCopy
+VkBufferCopy* zcheckarraybufVkBufferCopy(lua_State *L, int arg, VkBufferCopy *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkBufferCopy moonvulkan_zinitVkBufferCopy
 int zinitVkBufferCopy(lua_State *L, VkBufferCopy* p, int *err);
 #define zfreeVkBufferCopy(L, p, base) zfree_untyped((L), (p), (base), zclearVkBufferCopy)
@@ -5136,10 +6076,13 @@ int zpushVkBufferCopy(lua_State *L, const VkBufferCopy *p);
 #define zclearVkSparseMemoryBind NULL
 #define znewVkSparseMemoryBind(L, err) (VkSparseMemoryBind*)znew((L), -1, sizeof(VkSparseMemoryBind),(err))
 #define znewarrayVkSparseMemoryBind(L, count, err) (VkSparseMemoryBind*)znewarray((L),-1, sizeof(VkSparseMemoryBind), (count), (err))
+#define zinitarrayVkSparseMemoryBind(p, count) (VkSparseMemoryBind*)zinitarray((p),-1, sizeof(VkSparseMemoryBind), (count))
 #define zcheckVkSparseMemoryBind moonvulkan_zcheckVkSparseMemoryBind
 VkSparseMemoryBind* zcheckVkSparseMemoryBind(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSparseMemoryBind moonvulkan_zcheckarrayVkSparseMemoryBind
 VkSparseMemoryBind* zcheckarrayVkSparseMemoryBind(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSparseMemoryBind moonvulkan_zcheckarraybufVkSparseMemoryBind
+VkSparseMemoryBind* zcheckarraybufVkSparseMemoryBind(lua_State *L, int arg, VkSparseMemoryBind *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSparseMemoryBind moonvulkan_zinitVkSparseMemoryBind
 int zinitVkSparseMemoryBind(lua_State *L, VkSparseMemoryBind* p, int *err);
 #define zfreeVkSparseMemoryBind(L, p, base) zfree_untyped((L), (p), (base), zclearVkSparseMemoryBind)
@@ -5150,10 +6093,13 @@ int zpushVkSparseMemoryBind(lua_State *L, const VkSparseMemoryBind *p);
 #define zclearVkImageSubresource NULL
 #define znewVkImageSubresource(L, err) (VkImageSubresource*)znew((L), -1, sizeof(VkImageSubresource),(err))
 #define znewarrayVkImageSubresource(L, count, err) (VkImageSubresource*)znewarray((L),-1, sizeof(VkImageSubresource), (count), (err))
+#define zinitarrayVkImageSubresource(p, count) (VkImageSubresource*)zinitarray((p),-1, sizeof(VkImageSubresource), (count))
 #define zcheckVkImageSubresource moonvulkan_zcheckVkImageSubresource
 VkImageSubresource* zcheckVkImageSubresource(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageSubresource moonvulkan_zcheckarrayVkImageSubresource
 VkImageSubresource* zcheckarrayVkImageSubresource(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageSubresource moonvulkan_zcheckarraybufVkImageSubresource
+VkImageSubresource* zcheckarraybufVkImageSubresource(lua_State *L, int arg, VkImageSubresource *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageSubresource moonvulkan_zinitVkImageSubresource
 int zinitVkImageSubresource(lua_State *L, VkImageSubresource* p, int *err);
 #define zfreeVkImageSubresource(L, p, base) zfree_untyped((L), (p), (base), zclearVkImageSubresource)
@@ -5164,10 +6110,13 @@ int zpushVkImageSubresource(lua_State *L, const VkImageSubresource *p);
 #define zclearVkSparseImageMemoryBind NULL
 #define znewVkSparseImageMemoryBind(L, err) (VkSparseImageMemoryBind*)znew((L), -1, sizeof(VkSparseImageMemoryBind),(err))
 #define znewarrayVkSparseImageMemoryBind(L, count, err) (VkSparseImageMemoryBind*)znewarray((L),-1, sizeof(VkSparseImageMemoryBind), (count), (err))
+#define zinitarrayVkSparseImageMemoryBind(p, count) (VkSparseImageMemoryBind*)zinitarray((p),-1, sizeof(VkSparseImageMemoryBind), (count))
 #define zcheckVkSparseImageMemoryBind moonvulkan_zcheckVkSparseImageMemoryBind
 VkSparseImageMemoryBind* zcheckVkSparseImageMemoryBind(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSparseImageMemoryBind moonvulkan_zcheckarrayVkSparseImageMemoryBind
 VkSparseImageMemoryBind* zcheckarrayVkSparseImageMemoryBind(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSparseImageMemoryBind moonvulkan_zcheckarraybufVkSparseImageMemoryBind
+VkSparseImageMemoryBind* zcheckarraybufVkSparseImageMemoryBind(lua_State *L, int arg, VkSparseImageMemoryBind *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSparseImageMemoryBind moonvulkan_zinitVkSparseImageMemoryBind
 int zinitVkSparseImageMemoryBind(lua_State *L, VkSparseImageMemoryBind* p, int *err);
 #define zfreeVkSparseImageMemoryBind(L, p, base) zfree_untyped((L), (p), (base), zclearVkSparseImageMemoryBind)
@@ -5179,10 +6128,13 @@ int zpushVkSparseImageMemoryBind(lua_State *L, const VkSparseImageMemoryBind *p)
 void zclearVkSparseBufferMemoryBindInfo(lua_State *L, const void *p);
 #define znewVkSparseBufferMemoryBindInfo(L, err) (VkSparseBufferMemoryBindInfo*)znew((L), -1, sizeof(VkSparseBufferMemoryBindInfo),(err))
 #define znewarrayVkSparseBufferMemoryBindInfo(L, count, err) (VkSparseBufferMemoryBindInfo*)znewarray((L),-1, sizeof(VkSparseBufferMemoryBindInfo), (count), (err))
+#define zinitarrayVkSparseBufferMemoryBindInfo(p, count) (VkSparseBufferMemoryBindInfo*)zinitarray((p),-1, sizeof(VkSparseBufferMemoryBindInfo), (count))
 #define zcheckVkSparseBufferMemoryBindInfo moonvulkan_zcheckVkSparseBufferMemoryBindInfo
 VkSparseBufferMemoryBindInfo* zcheckVkSparseBufferMemoryBindInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSparseBufferMemoryBindInfo moonvulkan_zcheckarrayVkSparseBufferMemoryBindInfo
 VkSparseBufferMemoryBindInfo* zcheckarrayVkSparseBufferMemoryBindInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSparseBufferMemoryBindInfo moonvulkan_zcheckarraybufVkSparseBufferMemoryBindInfo
+VkSparseBufferMemoryBindInfo* zcheckarraybufVkSparseBufferMemoryBindInfo(lua_State *L, int arg, VkSparseBufferMemoryBindInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSparseBufferMemoryBindInfo moonvulkan_zinitVkSparseBufferMemoryBindInfo
 int zinitVkSparseBufferMemoryBindInfo(lua_State *L, VkSparseBufferMemoryBindInfo* p, int *err);
 #define zfreeVkSparseBufferMemoryBindInfo(L, p, base) zfree_untyped((L), (p), (base), zclearVkSparseBufferMemoryBindInfo)
@@ -5194,10 +6146,13 @@ int zpushVkSparseBufferMemoryBindInfo(lua_State *L, const VkSparseBufferMemoryBi
 void zclearVkSparseImageOpaqueMemoryBindInfo(lua_State *L, const void *p);
 #define znewVkSparseImageOpaqueMemoryBindInfo(L, err) (VkSparseImageOpaqueMemoryBindInfo*)znew((L), -1, sizeof(VkSparseImageOpaqueMemoryBindInfo),(err))
 #define znewarrayVkSparseImageOpaqueMemoryBindInfo(L, count, err) (VkSparseImageOpaqueMemoryBindInfo*)znewarray((L),-1, sizeof(VkSparseImageOpaqueMemoryBindInfo), (count), (err))
+#define zinitarrayVkSparseImageOpaqueMemoryBindInfo(p, count) (VkSparseImageOpaqueMemoryBindInfo*)zinitarray((p),-1, sizeof(VkSparseImageOpaqueMemoryBindInfo), (count))
 #define zcheckVkSparseImageOpaqueMemoryBindInfo moonvulkan_zcheckVkSparseImageOpaqueMemoryBindInfo
 VkSparseImageOpaqueMemoryBindInfo* zcheckVkSparseImageOpaqueMemoryBindInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSparseImageOpaqueMemoryBindInfo moonvulkan_zcheckarrayVkSparseImageOpaqueMemoryBindInfo
 VkSparseImageOpaqueMemoryBindInfo* zcheckarrayVkSparseImageOpaqueMemoryBindInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSparseImageOpaqueMemoryBindInfo moonvulkan_zcheckarraybufVkSparseImageOpaqueMemoryBindInfo
+VkSparseImageOpaqueMemoryBindInfo* zcheckarraybufVkSparseImageOpaqueMemoryBindInfo(lua_State *L, int arg, VkSparseImageOpaqueMemoryBindInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSparseImageOpaqueMemoryBindInfo moonvulkan_zinitVkSparseImageOpaqueMemoryBindInfo
 int zinitVkSparseImageOpaqueMemoryBindInfo(lua_State *L, VkSparseImageOpaqueMemoryBindInfo* p, int *err);
 #define zfreeVkSparseImageOpaqueMemoryBindInfo(L, p, base) zfree_untyped((L), (p), (base), zclearVkSparseImageOpaqueMemoryBindInfo)
@@ -5209,10 +6164,13 @@ int zpushVkSparseImageOpaqueMemoryBindInfo(lua_State *L, const VkSparseImageOpaq
 void zclearVkSparseImageMemoryBindInfo(lua_State *L, const void *p);
 #define znewVkSparseImageMemoryBindInfo(L, err) (VkSparseImageMemoryBindInfo*)znew((L), -1, sizeof(VkSparseImageMemoryBindInfo),(err))
 #define znewarrayVkSparseImageMemoryBindInfo(L, count, err) (VkSparseImageMemoryBindInfo*)znewarray((L),-1, sizeof(VkSparseImageMemoryBindInfo), (count), (err))
+#define zinitarrayVkSparseImageMemoryBindInfo(p, count) (VkSparseImageMemoryBindInfo*)zinitarray((p),-1, sizeof(VkSparseImageMemoryBindInfo), (count))
 #define zcheckVkSparseImageMemoryBindInfo moonvulkan_zcheckVkSparseImageMemoryBindInfo
 VkSparseImageMemoryBindInfo* zcheckVkSparseImageMemoryBindInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSparseImageMemoryBindInfo moonvulkan_zcheckarrayVkSparseImageMemoryBindInfo
 VkSparseImageMemoryBindInfo* zcheckarrayVkSparseImageMemoryBindInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSparseImageMemoryBindInfo moonvulkan_zcheckarraybufVkSparseImageMemoryBindInfo
+VkSparseImageMemoryBindInfo* zcheckarraybufVkSparseImageMemoryBindInfo(lua_State *L, int arg, VkSparseImageMemoryBindInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSparseImageMemoryBindInfo moonvulkan_zinitVkSparseImageMemoryBindInfo
 int zinitVkSparseImageMemoryBindInfo(lua_State *L, VkSparseImageMemoryBindInfo* p, int *err);
 #define zfreeVkSparseImageMemoryBindInfo(L, p, base) zfree_untyped((L), (p), (base), zclearVkSparseImageMemoryBindInfo)
@@ -5223,10 +6181,13 @@ int zpushVkSparseImageMemoryBindInfo(lua_State *L, const VkSparseImageMemoryBind
 #define zclearVkSubresourceLayout NULL
 #define znewVkSubresourceLayout(L, err) (VkSubresourceLayout*)znew((L), -1, sizeof(VkSubresourceLayout),(err))
 #define znewarrayVkSubresourceLayout(L, count, err) (VkSubresourceLayout*)znewarray((L),-1, sizeof(VkSubresourceLayout), (count), (err))
+#define zinitarrayVkSubresourceLayout(p, count) (VkSubresourceLayout*)zinitarray((p),-1, sizeof(VkSubresourceLayout), (count))
 #define zcheckVkSubresourceLayout moonvulkan_zcheckVkSubresourceLayout
 VkSubresourceLayout* zcheckVkSubresourceLayout(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSubresourceLayout moonvulkan_zcheckarrayVkSubresourceLayout
 VkSubresourceLayout* zcheckarrayVkSubresourceLayout(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSubresourceLayout moonvulkan_zcheckarraybufVkSubresourceLayout
+VkSubresourceLayout* zcheckarraybufVkSubresourceLayout(lua_State *L, int arg, VkSubresourceLayout *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSubresourceLayout moonvulkan_zinitVkSubresourceLayout
 int zinitVkSubresourceLayout(lua_State *L, VkSubresourceLayout* p, int *err);
 #define zfreeVkSubresourceLayout(L, p, base) zfree_untyped((L), (p), (base), zclearVkSubresourceLayout)
@@ -5237,10 +6198,13 @@ int zpushVkSubresourceLayout(lua_State *L, const VkSubresourceLayout *p);
 #define zclearVkSpecializationMapEntry NULL
 #define znewVkSpecializationMapEntry(L, err) (VkSpecializationMapEntry*)znew((L), -1, sizeof(VkSpecializationMapEntry),(err))
 #define znewarrayVkSpecializationMapEntry(L, count, err) (VkSpecializationMapEntry*)znewarray((L),-1, sizeof(VkSpecializationMapEntry), (count), (err))
+#define zinitarrayVkSpecializationMapEntry(p, count) (VkSpecializationMapEntry*)zinitarray((p),-1, sizeof(VkSpecializationMapEntry), (count))
 #define zcheckVkSpecializationMapEntry moonvulkan_zcheckVkSpecializationMapEntry
 VkSpecializationMapEntry* zcheckVkSpecializationMapEntry(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSpecializationMapEntry moonvulkan_zcheckarrayVkSpecializationMapEntry
 VkSpecializationMapEntry* zcheckarrayVkSpecializationMapEntry(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSpecializationMapEntry moonvulkan_zcheckarraybufVkSpecializationMapEntry
+VkSpecializationMapEntry* zcheckarraybufVkSpecializationMapEntry(lua_State *L, int arg, VkSpecializationMapEntry *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSpecializationMapEntry moonvulkan_zinitVkSpecializationMapEntry
 int zinitVkSpecializationMapEntry(lua_State *L, VkSpecializationMapEntry* p, int *err);
 #define zfreeVkSpecializationMapEntry(L, p, base) zfree_untyped((L), (p), (base), zclearVkSpecializationMapEntry)
@@ -5252,10 +6216,13 @@ int zpushVkSpecializationMapEntry(lua_State *L, const VkSpecializationMapEntry *
 void zclearVkSpecializationInfo(lua_State *L, const void *p);
 #define znewVkSpecializationInfo(L, err) (VkSpecializationInfo*)znew((L), -1, sizeof(VkSpecializationInfo),(err))
 #define znewarrayVkSpecializationInfo(L, count, err) (VkSpecializationInfo*)znewarray((L),-1, sizeof(VkSpecializationInfo), (count), (err))
+#define zinitarrayVkSpecializationInfo(p, count) (VkSpecializationInfo*)zinitarray((p),-1, sizeof(VkSpecializationInfo), (count))
 #define zcheckVkSpecializationInfo moonvulkan_zcheckVkSpecializationInfo
 VkSpecializationInfo* zcheckVkSpecializationInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSpecializationInfo moonvulkan_zcheckarrayVkSpecializationInfo
 VkSpecializationInfo* zcheckarrayVkSpecializationInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSpecializationInfo moonvulkan_zcheckarraybufVkSpecializationInfo
+VkSpecializationInfo* zcheckarraybufVkSpecializationInfo(lua_State *L, int arg, VkSpecializationInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSpecializationInfo moonvulkan_zinitVkSpecializationInfo
 int zinitVkSpecializationInfo(lua_State *L, VkSpecializationInfo* p, int *err);
 #define zfreeVkSpecializationInfo(L, p, base) zfree_untyped((L), (p), (base), zclearVkSpecializationInfo)
@@ -5266,10 +6233,13 @@ int zpushVkSpecializationInfo(lua_State *L, const VkSpecializationInfo *p);
 #define zclearVkVertexInputBindingDescription NULL
 #define znewVkVertexInputBindingDescription(L, err) (VkVertexInputBindingDescription*)znew((L), -1, sizeof(VkVertexInputBindingDescription),(err))
 #define znewarrayVkVertexInputBindingDescription(L, count, err) (VkVertexInputBindingDescription*)znewarray((L),-1, sizeof(VkVertexInputBindingDescription), (count), (err))
+#define zinitarrayVkVertexInputBindingDescription(p, count) (VkVertexInputBindingDescription*)zinitarray((p),-1, sizeof(VkVertexInputBindingDescription), (count))
 #define zcheckVkVertexInputBindingDescription moonvulkan_zcheckVkVertexInputBindingDescription
 VkVertexInputBindingDescription* zcheckVkVertexInputBindingDescription(lua_State *L, int arg, int *err);
 #define zcheckarrayVkVertexInputBindingDescription moonvulkan_zcheckarrayVkVertexInputBindingDescription
 VkVertexInputBindingDescription* zcheckarrayVkVertexInputBindingDescription(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkVertexInputBindingDescription moonvulkan_zcheckarraybufVkVertexInputBindingDescription
+VkVertexInputBindingDescription* zcheckarraybufVkVertexInputBindingDescription(lua_State *L, int arg, VkVertexInputBindingDescription *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkVertexInputBindingDescription moonvulkan_zinitVkVertexInputBindingDescription
 int zinitVkVertexInputBindingDescription(lua_State *L, VkVertexInputBindingDescription* p, int *err);
 #define zfreeVkVertexInputBindingDescription(L, p, base) zfree_untyped((L), (p), (base), zclearVkVertexInputBindingDescription)
@@ -5280,10 +6250,13 @@ int zpushVkVertexInputBindingDescription(lua_State *L, const VkVertexInputBindin
 #define zclearVkVertexInputAttributeDescription NULL
 #define znewVkVertexInputAttributeDescription(L, err) (VkVertexInputAttributeDescription*)znew((L), -1, sizeof(VkVertexInputAttributeDescription),(err))
 #define znewarrayVkVertexInputAttributeDescription(L, count, err) (VkVertexInputAttributeDescription*)znewarray((L),-1, sizeof(VkVertexInputAttributeDescription), (count), (err))
+#define zinitarrayVkVertexInputAttributeDescription(p, count) (VkVertexInputAttributeDescription*)zinitarray((p),-1, sizeof(VkVertexInputAttributeDescription), (count))
 #define zcheckVkVertexInputAttributeDescription moonvulkan_zcheckVkVertexInputAttributeDescription
 VkVertexInputAttributeDescription* zcheckVkVertexInputAttributeDescription(lua_State *L, int arg, int *err);
 #define zcheckarrayVkVertexInputAttributeDescription moonvulkan_zcheckarrayVkVertexInputAttributeDescription
 VkVertexInputAttributeDescription* zcheckarrayVkVertexInputAttributeDescription(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkVertexInputAttributeDescription moonvulkan_zcheckarraybufVkVertexInputAttributeDescription
+VkVertexInputAttributeDescription* zcheckarraybufVkVertexInputAttributeDescription(lua_State *L, int arg, VkVertexInputAttributeDescription *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkVertexInputAttributeDescription moonvulkan_zinitVkVertexInputAttributeDescription
 int zinitVkVertexInputAttributeDescription(lua_State *L, VkVertexInputAttributeDescription* p, int *err);
 #define zfreeVkVertexInputAttributeDescription(L, p, base) zfree_untyped((L), (p), (base), zclearVkVertexInputAttributeDescription)
@@ -5294,10 +6267,13 @@ int zpushVkVertexInputAttributeDescription(lua_State *L, const VkVertexInputAttr
 #define zclearVkStencilOpState NULL
 #define znewVkStencilOpState(L, err) (VkStencilOpState*)znew((L), -1, sizeof(VkStencilOpState),(err))
 #define znewarrayVkStencilOpState(L, count, err) (VkStencilOpState*)znewarray((L),-1, sizeof(VkStencilOpState), (count), (err))
+#define zinitarrayVkStencilOpState(p, count) (VkStencilOpState*)zinitarray((p),-1, sizeof(VkStencilOpState), (count))
 #define zcheckVkStencilOpState moonvulkan_zcheckVkStencilOpState
 VkStencilOpState* zcheckVkStencilOpState(lua_State *L, int arg, int *err);
 #define zcheckarrayVkStencilOpState moonvulkan_zcheckarrayVkStencilOpState
 VkStencilOpState* zcheckarrayVkStencilOpState(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkStencilOpState moonvulkan_zcheckarraybufVkStencilOpState
+VkStencilOpState* zcheckarraybufVkStencilOpState(lua_State *L, int arg, VkStencilOpState *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkStencilOpState moonvulkan_zinitVkStencilOpState
 int zinitVkStencilOpState(lua_State *L, VkStencilOpState* p, int *err);
 #define zfreeVkStencilOpState(L, p, base) zfree_untyped((L), (p), (base), zclearVkStencilOpState)
@@ -5308,10 +6284,13 @@ int zpushVkStencilOpState(lua_State *L, const VkStencilOpState *p);
 #define zclearVkPipelineColorBlendAttachmentState NULL
 #define znewVkPipelineColorBlendAttachmentState(L, err) (VkPipelineColorBlendAttachmentState*)znew((L), -1, sizeof(VkPipelineColorBlendAttachmentState),(err))
 #define znewarrayVkPipelineColorBlendAttachmentState(L, count, err) (VkPipelineColorBlendAttachmentState*)znewarray((L),-1, sizeof(VkPipelineColorBlendAttachmentState), (count), (err))
+#define zinitarrayVkPipelineColorBlendAttachmentState(p, count) (VkPipelineColorBlendAttachmentState*)zinitarray((p),-1, sizeof(VkPipelineColorBlendAttachmentState), (count))
 #define zcheckVkPipelineColorBlendAttachmentState moonvulkan_zcheckVkPipelineColorBlendAttachmentState
 VkPipelineColorBlendAttachmentState* zcheckVkPipelineColorBlendAttachmentState(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineColorBlendAttachmentState moonvulkan_zcheckarrayVkPipelineColorBlendAttachmentState
 VkPipelineColorBlendAttachmentState* zcheckarrayVkPipelineColorBlendAttachmentState(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineColorBlendAttachmentState moonvulkan_zcheckarraybufVkPipelineColorBlendAttachmentState
+VkPipelineColorBlendAttachmentState* zcheckarraybufVkPipelineColorBlendAttachmentState(lua_State *L, int arg, VkPipelineColorBlendAttachmentState *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineColorBlendAttachmentState moonvulkan_zinitVkPipelineColorBlendAttachmentState
 int zinitVkPipelineColorBlendAttachmentState(lua_State *L, VkPipelineColorBlendAttachmentState* p, int *err);
 #define zfreeVkPipelineColorBlendAttachmentState(L, p, base) zfree_untyped((L), (p), (base), zclearVkPipelineColorBlendAttachmentState)
@@ -5322,10 +6301,13 @@ int zpushVkPipelineColorBlendAttachmentState(lua_State *L, const VkPipelineColor
 #define zclearVkRectLayerKHR NULL
 #define znewVkRectLayerKHR(L, err) (VkRectLayerKHR*)znew((L), -1, sizeof(VkRectLayerKHR),(err))
 #define znewarrayVkRectLayerKHR(L, count, err) (VkRectLayerKHR*)znewarray((L),-1, sizeof(VkRectLayerKHR), (count), (err))
+#define zinitarrayVkRectLayerKHR(p, count) (VkRectLayerKHR*)zinitarray((p),-1, sizeof(VkRectLayerKHR), (count))
 #define zcheckVkRectLayerKHR moonvulkan_zcheckVkRectLayerKHR
 VkRectLayerKHR* zcheckVkRectLayerKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkRectLayerKHR moonvulkan_zcheckarrayVkRectLayerKHR
 VkRectLayerKHR* zcheckarrayVkRectLayerKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkRectLayerKHR moonvulkan_zcheckarraybufVkRectLayerKHR
+VkRectLayerKHR* zcheckarraybufVkRectLayerKHR(lua_State *L, int arg, VkRectLayerKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkRectLayerKHR moonvulkan_zinitVkRectLayerKHR
 int zinitVkRectLayerKHR(lua_State *L, VkRectLayerKHR* p, int *err);
 #define zfreeVkRectLayerKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkRectLayerKHR)
@@ -5337,10 +6319,13 @@ int zpushVkRectLayerKHR(lua_State *L, const VkRectLayerKHR *p);
 void zclearVkPresentRegionKHR(lua_State *L, const void *p);
 #define znewVkPresentRegionKHR(L, err) (VkPresentRegionKHR*)znew((L), -1, sizeof(VkPresentRegionKHR),(err))
 #define znewarrayVkPresentRegionKHR(L, count, err) (VkPresentRegionKHR*)znewarray((L),-1, sizeof(VkPresentRegionKHR), (count), (err))
+#define zinitarrayVkPresentRegionKHR(p, count) (VkPresentRegionKHR*)zinitarray((p),-1, sizeof(VkPresentRegionKHR), (count))
 #define zcheckVkPresentRegionKHR moonvulkan_zcheckVkPresentRegionKHR
 VkPresentRegionKHR* zcheckVkPresentRegionKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPresentRegionKHR moonvulkan_zcheckarrayVkPresentRegionKHR
 VkPresentRegionKHR* zcheckarrayVkPresentRegionKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPresentRegionKHR moonvulkan_zcheckarraybufVkPresentRegionKHR
+VkPresentRegionKHR* zcheckarraybufVkPresentRegionKHR(lua_State *L, int arg, VkPresentRegionKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPresentRegionKHR moonvulkan_zinitVkPresentRegionKHR
 int zinitVkPresentRegionKHR(lua_State *L, VkPresentRegionKHR* p, int *err);
 #define zfreeVkPresentRegionKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkPresentRegionKHR)
@@ -5351,10 +6336,13 @@ int zpushVkPresentRegionKHR(lua_State *L, const VkPresentRegionKHR *p);
 #define zclearVkDescriptorImageInfo NULL
 #define znewVkDescriptorImageInfo(L, err) (VkDescriptorImageInfo*)znew((L), -1, sizeof(VkDescriptorImageInfo),(err))
 #define znewarrayVkDescriptorImageInfo(L, count, err) (VkDescriptorImageInfo*)znewarray((L),-1, sizeof(VkDescriptorImageInfo), (count), (err))
+#define zinitarrayVkDescriptorImageInfo(p, count) (VkDescriptorImageInfo*)zinitarray((p),-1, sizeof(VkDescriptorImageInfo), (count))
 #define zcheckVkDescriptorImageInfo moonvulkan_zcheckVkDescriptorImageInfo
 VkDescriptorImageInfo* zcheckVkDescriptorImageInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDescriptorImageInfo moonvulkan_zcheckarrayVkDescriptorImageInfo
 VkDescriptorImageInfo* zcheckarrayVkDescriptorImageInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDescriptorImageInfo moonvulkan_zcheckarraybufVkDescriptorImageInfo
+VkDescriptorImageInfo* zcheckarraybufVkDescriptorImageInfo(lua_State *L, int arg, VkDescriptorImageInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDescriptorImageInfo moonvulkan_zinitVkDescriptorImageInfo
 int zinitVkDescriptorImageInfo(lua_State *L, VkDescriptorImageInfo* p, int *err);
 #define zfreeVkDescriptorImageInfo(L, p, base) zfree_untyped((L), (p), (base), zclearVkDescriptorImageInfo)
@@ -5365,10 +6353,13 @@ int zpushVkDescriptorImageInfo(lua_State *L, const VkDescriptorImageInfo *p);
 #define zclearVkDescriptorBufferInfo NULL
 #define znewVkDescriptorBufferInfo(L, err) (VkDescriptorBufferInfo*)znew((L), -1, sizeof(VkDescriptorBufferInfo),(err))
 #define znewarrayVkDescriptorBufferInfo(L, count, err) (VkDescriptorBufferInfo*)znewarray((L),-1, sizeof(VkDescriptorBufferInfo), (count), (err))
+#define zinitarrayVkDescriptorBufferInfo(p, count) (VkDescriptorBufferInfo*)zinitarray((p),-1, sizeof(VkDescriptorBufferInfo), (count))
 #define zcheckVkDescriptorBufferInfo moonvulkan_zcheckVkDescriptorBufferInfo
 VkDescriptorBufferInfo* zcheckVkDescriptorBufferInfo(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDescriptorBufferInfo moonvulkan_zcheckarrayVkDescriptorBufferInfo
 VkDescriptorBufferInfo* zcheckarrayVkDescriptorBufferInfo(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDescriptorBufferInfo moonvulkan_zcheckarraybufVkDescriptorBufferInfo
+VkDescriptorBufferInfo* zcheckarraybufVkDescriptorBufferInfo(lua_State *L, int arg, VkDescriptorBufferInfo *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDescriptorBufferInfo moonvulkan_zinitVkDescriptorBufferInfo
 int zinitVkDescriptorBufferInfo(lua_State *L, VkDescriptorBufferInfo* p, int *err);
 #define zfreeVkDescriptorBufferInfo(L, p, base) zfree_untyped((L), (p), (base), zclearVkDescriptorBufferInfo)
@@ -5379,10 +6370,13 @@ int zpushVkDescriptorBufferInfo(lua_State *L, const VkDescriptorBufferInfo *p);
 #define zclearVkDisplayModeParametersKHR NULL
 #define znewVkDisplayModeParametersKHR(L, err) (VkDisplayModeParametersKHR*)znew((L), -1, sizeof(VkDisplayModeParametersKHR),(err))
 #define znewarrayVkDisplayModeParametersKHR(L, count, err) (VkDisplayModeParametersKHR*)znewarray((L),-1, sizeof(VkDisplayModeParametersKHR), (count), (err))
+#define zinitarrayVkDisplayModeParametersKHR(p, count) (VkDisplayModeParametersKHR*)zinitarray((p),-1, sizeof(VkDisplayModeParametersKHR), (count))
 #define zcheckVkDisplayModeParametersKHR moonvulkan_zcheckVkDisplayModeParametersKHR
 VkDisplayModeParametersKHR* zcheckVkDisplayModeParametersKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayModeParametersKHR moonvulkan_zcheckarrayVkDisplayModeParametersKHR
 VkDisplayModeParametersKHR* zcheckarrayVkDisplayModeParametersKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayModeParametersKHR moonvulkan_zcheckarraybufVkDisplayModeParametersKHR
+VkDisplayModeParametersKHR* zcheckarraybufVkDisplayModeParametersKHR(lua_State *L, int arg, VkDisplayModeParametersKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayModeParametersKHR moonvulkan_zinitVkDisplayModeParametersKHR
 int zinitVkDisplayModeParametersKHR(lua_State *L, VkDisplayModeParametersKHR* p, int *err);
 #define zfreeVkDisplayModeParametersKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkDisplayModeParametersKHR)
@@ -5393,10 +6387,13 @@ int zpushVkDisplayModeParametersKHR(lua_State *L, const VkDisplayModeParametersK
 #define zclearVkDisplayModePropertiesKHR NULL
 #define znewVkDisplayModePropertiesKHR(L, err) (VkDisplayModePropertiesKHR*)znew((L), -1, sizeof(VkDisplayModePropertiesKHR),(err))
 #define znewarrayVkDisplayModePropertiesKHR(L, count, err) (VkDisplayModePropertiesKHR*)znewarray((L),-1, sizeof(VkDisplayModePropertiesKHR), (count), (err))
+#define zinitarrayVkDisplayModePropertiesKHR(p, count) (VkDisplayModePropertiesKHR*)zinitarray((p),-1, sizeof(VkDisplayModePropertiesKHR), (count))
 #define zcheckVkDisplayModePropertiesKHR moonvulkan_zcheckVkDisplayModePropertiesKHR
 VkDisplayModePropertiesKHR* zcheckVkDisplayModePropertiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayModePropertiesKHR moonvulkan_zcheckarrayVkDisplayModePropertiesKHR
 VkDisplayModePropertiesKHR* zcheckarrayVkDisplayModePropertiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayModePropertiesKHR moonvulkan_zcheckarraybufVkDisplayModePropertiesKHR
+VkDisplayModePropertiesKHR* zcheckarraybufVkDisplayModePropertiesKHR(lua_State *L, int arg, VkDisplayModePropertiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayModePropertiesKHR moonvulkan_zinitVkDisplayModePropertiesKHR
 int zinitVkDisplayModePropertiesKHR(lua_State *L, VkDisplayModePropertiesKHR* p, int *err);
 #define zfreeVkDisplayModePropertiesKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkDisplayModePropertiesKHR)
@@ -5407,10 +6404,13 @@ int zpushVkDisplayModePropertiesKHR(lua_State *L, const VkDisplayModePropertiesK
 #define zclearVkDisplayPlaneCapabilitiesKHR NULL
 #define znewVkDisplayPlaneCapabilitiesKHR(L, err) (VkDisplayPlaneCapabilitiesKHR*)znew((L), -1, sizeof(VkDisplayPlaneCapabilitiesKHR),(err))
 #define znewarrayVkDisplayPlaneCapabilitiesKHR(L, count, err) (VkDisplayPlaneCapabilitiesKHR*)znewarray((L),-1, sizeof(VkDisplayPlaneCapabilitiesKHR), (count), (err))
+#define zinitarrayVkDisplayPlaneCapabilitiesKHR(p, count) (VkDisplayPlaneCapabilitiesKHR*)zinitarray((p),-1, sizeof(VkDisplayPlaneCapabilitiesKHR), (count))
 #define zcheckVkDisplayPlaneCapabilitiesKHR moonvulkan_zcheckVkDisplayPlaneCapabilitiesKHR
 VkDisplayPlaneCapabilitiesKHR* zcheckVkDisplayPlaneCapabilitiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayPlaneCapabilitiesKHR moonvulkan_zcheckarrayVkDisplayPlaneCapabilitiesKHR
 VkDisplayPlaneCapabilitiesKHR* zcheckarrayVkDisplayPlaneCapabilitiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayPlaneCapabilitiesKHR moonvulkan_zcheckarraybufVkDisplayPlaneCapabilitiesKHR
+VkDisplayPlaneCapabilitiesKHR* zcheckarraybufVkDisplayPlaneCapabilitiesKHR(lua_State *L, int arg, VkDisplayPlaneCapabilitiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayPlaneCapabilitiesKHR moonvulkan_zinitVkDisplayPlaneCapabilitiesKHR
 int zinitVkDisplayPlaneCapabilitiesKHR(lua_State *L, VkDisplayPlaneCapabilitiesKHR* p, int *err);
 #define zfreeVkDisplayPlaneCapabilitiesKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkDisplayPlaneCapabilitiesKHR)
@@ -5421,10 +6421,13 @@ int zpushVkDisplayPlaneCapabilitiesKHR(lua_State *L, const VkDisplayPlaneCapabil
 #define zclearVkDescriptorUpdateTemplateEntry NULL
 #define znewVkDescriptorUpdateTemplateEntry(L, err) (VkDescriptorUpdateTemplateEntry*)znew((L), -1, sizeof(VkDescriptorUpdateTemplateEntry),(err))
 #define znewarrayVkDescriptorUpdateTemplateEntry(L, count, err) (VkDescriptorUpdateTemplateEntry*)znewarray((L),-1, sizeof(VkDescriptorUpdateTemplateEntry), (count), (err))
+#define zinitarrayVkDescriptorUpdateTemplateEntry(p, count) (VkDescriptorUpdateTemplateEntry*)zinitarray((p),-1, sizeof(VkDescriptorUpdateTemplateEntry), (count))
 #define zcheckVkDescriptorUpdateTemplateEntry moonvulkan_zcheckVkDescriptorUpdateTemplateEntry
 VkDescriptorUpdateTemplateEntry* zcheckVkDescriptorUpdateTemplateEntry(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDescriptorUpdateTemplateEntry moonvulkan_zcheckarrayVkDescriptorUpdateTemplateEntry
 VkDescriptorUpdateTemplateEntry* zcheckarrayVkDescriptorUpdateTemplateEntry(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDescriptorUpdateTemplateEntry moonvulkan_zcheckarraybufVkDescriptorUpdateTemplateEntry
+VkDescriptorUpdateTemplateEntry* zcheckarraybufVkDescriptorUpdateTemplateEntry(lua_State *L, int arg, VkDescriptorUpdateTemplateEntry *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDescriptorUpdateTemplateEntry moonvulkan_zinitVkDescriptorUpdateTemplateEntry
 int zinitVkDescriptorUpdateTemplateEntry(lua_State *L, VkDescriptorUpdateTemplateEntry* p, int *err);
 #define zfreeVkDescriptorUpdateTemplateEntry(L, p, base) zfree_untyped((L), (p), (base), zclearVkDescriptorUpdateTemplateEntry)
@@ -5435,10 +6438,13 @@ int zpushVkDescriptorUpdateTemplateEntry(lua_State *L, const VkDescriptorUpdateT
 #define zclearVkAttachmentDescription NULL
 #define znewVkAttachmentDescription(L, err) (VkAttachmentDescription*)znew((L), -1, sizeof(VkAttachmentDescription),(err))
 #define znewarrayVkAttachmentDescription(L, count, err) (VkAttachmentDescription*)znewarray((L),-1, sizeof(VkAttachmentDescription), (count), (err))
+#define zinitarrayVkAttachmentDescription(p, count) (VkAttachmentDescription*)zinitarray((p),-1, sizeof(VkAttachmentDescription), (count))
 #define zcheckVkAttachmentDescription moonvulkan_zcheckVkAttachmentDescription
 VkAttachmentDescription* zcheckVkAttachmentDescription(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAttachmentDescription moonvulkan_zcheckarrayVkAttachmentDescription
 VkAttachmentDescription* zcheckarrayVkAttachmentDescription(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAttachmentDescription moonvulkan_zcheckarraybufVkAttachmentDescription
+VkAttachmentDescription* zcheckarraybufVkAttachmentDescription(lua_State *L, int arg, VkAttachmentDescription *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAttachmentDescription moonvulkan_zinitVkAttachmentDescription
 int zinitVkAttachmentDescription(lua_State *L, VkAttachmentDescription* p, int *err);
 #define zfreeVkAttachmentDescription(L, p, base) zfree_untyped((L), (p), (base), zclearVkAttachmentDescription)
@@ -5449,10 +6455,13 @@ int zpushVkAttachmentDescription(lua_State *L, const VkAttachmentDescription *p)
 #define zclearVkSubpassDependency NULL
 #define znewVkSubpassDependency(L, err) (VkSubpassDependency*)znew((L), -1, sizeof(VkSubpassDependency),(err))
 #define znewarrayVkSubpassDependency(L, count, err) (VkSubpassDependency*)znewarray((L),-1, sizeof(VkSubpassDependency), (count), (err))
+#define zinitarrayVkSubpassDependency(p, count) (VkSubpassDependency*)zinitarray((p),-1, sizeof(VkSubpassDependency), (count))
 #define zcheckVkSubpassDependency moonvulkan_zcheckVkSubpassDependency
 VkSubpassDependency* zcheckVkSubpassDependency(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSubpassDependency moonvulkan_zcheckarrayVkSubpassDependency
 VkSubpassDependency* zcheckarrayVkSubpassDependency(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSubpassDependency moonvulkan_zcheckarraybufVkSubpassDependency
+VkSubpassDependency* zcheckarraybufVkSubpassDependency(lua_State *L, int arg, VkSubpassDependency *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSubpassDependency moonvulkan_zinitVkSubpassDependency
 int zinitVkSubpassDependency(lua_State *L, VkSubpassDependency* p, int *err);
 #define zfreeVkSubpassDependency(L, p, base) zfree_untyped((L), (p), (base), zclearVkSubpassDependency)
@@ -5463,10 +6472,13 @@ int zpushVkSubpassDependency(lua_State *L, const VkSubpassDependency *p);
 #define zclearVkAttachmentReference NULL
 #define znewVkAttachmentReference(L, err) (VkAttachmentReference*)znew((L), -1, sizeof(VkAttachmentReference),(err))
 #define znewarrayVkAttachmentReference(L, count, err) (VkAttachmentReference*)znewarray((L),-1, sizeof(VkAttachmentReference), (count), (err))
+#define zinitarrayVkAttachmentReference(p, count) (VkAttachmentReference*)zinitarray((p),-1, sizeof(VkAttachmentReference), (count))
 #define zcheckVkAttachmentReference moonvulkan_zcheckVkAttachmentReference
 VkAttachmentReference* zcheckVkAttachmentReference(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAttachmentReference moonvulkan_zcheckarrayVkAttachmentReference
 VkAttachmentReference* zcheckarrayVkAttachmentReference(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAttachmentReference moonvulkan_zcheckarraybufVkAttachmentReference
+VkAttachmentReference* zcheckarraybufVkAttachmentReference(lua_State *L, int arg, VkAttachmentReference *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAttachmentReference moonvulkan_zinitVkAttachmentReference
 int zinitVkAttachmentReference(lua_State *L, VkAttachmentReference* p, int *err);
 #define zfreeVkAttachmentReference(L, p, base) zfree_untyped((L), (p), (base), zclearVkAttachmentReference)
@@ -5477,10 +6489,13 @@ int zpushVkAttachmentReference(lua_State *L, const VkAttachmentReference *p);
 #define zclearVkDescriptorPoolSize NULL
 #define znewVkDescriptorPoolSize(L, err) (VkDescriptorPoolSize*)znew((L), -1, sizeof(VkDescriptorPoolSize),(err))
 #define znewarrayVkDescriptorPoolSize(L, count, err) (VkDescriptorPoolSize*)znewarray((L),-1, sizeof(VkDescriptorPoolSize), (count), (err))
+#define zinitarrayVkDescriptorPoolSize(p, count) (VkDescriptorPoolSize*)zinitarray((p),-1, sizeof(VkDescriptorPoolSize), (count))
 #define zcheckVkDescriptorPoolSize moonvulkan_zcheckVkDescriptorPoolSize
 VkDescriptorPoolSize* zcheckVkDescriptorPoolSize(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDescriptorPoolSize moonvulkan_zcheckarrayVkDescriptorPoolSize
 VkDescriptorPoolSize* zcheckarrayVkDescriptorPoolSize(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDescriptorPoolSize moonvulkan_zcheckarraybufVkDescriptorPoolSize
+VkDescriptorPoolSize* zcheckarraybufVkDescriptorPoolSize(lua_State *L, int arg, VkDescriptorPoolSize *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDescriptorPoolSize moonvulkan_zinitVkDescriptorPoolSize
 int zinitVkDescriptorPoolSize(lua_State *L, VkDescriptorPoolSize* p, int *err);
 #define zfreeVkDescriptorPoolSize(L, p, base) zfree_untyped((L), (p), (base), zclearVkDescriptorPoolSize)
@@ -5491,10 +6506,13 @@ int zpushVkDescriptorPoolSize(lua_State *L, const VkDescriptorPoolSize *p);
 #define zclearVkPushConstantRange NULL
 #define znewVkPushConstantRange(L, err) (VkPushConstantRange*)znew((L), -1, sizeof(VkPushConstantRange),(err))
 #define znewarrayVkPushConstantRange(L, count, err) (VkPushConstantRange*)znewarray((L),-1, sizeof(VkPushConstantRange), (count), (err))
+#define zinitarrayVkPushConstantRange(p, count) (VkPushConstantRange*)zinitarray((p),-1, sizeof(VkPushConstantRange), (count))
 #define zcheckVkPushConstantRange moonvulkan_zcheckVkPushConstantRange
 VkPushConstantRange* zcheckVkPushConstantRange(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPushConstantRange moonvulkan_zcheckarrayVkPushConstantRange
 VkPushConstantRange* zcheckarrayVkPushConstantRange(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPushConstantRange moonvulkan_zcheckarraybufVkPushConstantRange
+VkPushConstantRange* zcheckarraybufVkPushConstantRange(lua_State *L, int arg, VkPushConstantRange *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPushConstantRange moonvulkan_zinitVkPushConstantRange
 int zinitVkPushConstantRange(lua_State *L, VkPushConstantRange* p, int *err);
 #define zfreeVkPushConstantRange(L, p, base) zfree_untyped((L), (p), (base), zclearVkPushConstantRange)
@@ -5506,10 +6524,13 @@ int zpushVkPushConstantRange(lua_State *L, const VkPushConstantRange *p);
 void zclearVkSubpassDescription(lua_State *L, const void *p);
 #define znewVkSubpassDescription(L, err) (VkSubpassDescription*)znew((L), -1, sizeof(VkSubpassDescription),(err))
 #define znewarrayVkSubpassDescription(L, count, err) (VkSubpassDescription*)znewarray((L),-1, sizeof(VkSubpassDescription), (count), (err))
+#define zinitarrayVkSubpassDescription(p, count) (VkSubpassDescription*)zinitarray((p),-1, sizeof(VkSubpassDescription), (count))
 #define zcheckVkSubpassDescription moonvulkan_zcheckVkSubpassDescription
 VkSubpassDescription* zcheckVkSubpassDescription(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSubpassDescription moonvulkan_zcheckarrayVkSubpassDescription
 VkSubpassDescription* zcheckarrayVkSubpassDescription(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSubpassDescription moonvulkan_zcheckarraybufVkSubpassDescription
+VkSubpassDescription* zcheckarraybufVkSubpassDescription(lua_State *L, int arg, VkSubpassDescription *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSubpassDescription moonvulkan_zinitVkSubpassDescription
 int zinitVkSubpassDescription(lua_State *L, VkSubpassDescription* p, int *err);
 #define zfreeVkSubpassDescription(L, p, base) zfree_untyped((L), (p), (base), zclearVkSubpassDescription)
@@ -5520,10 +6541,13 @@ int zpushVkSubpassDescription(lua_State *L, const VkSubpassDescription *p);
 #define zclearVkPhysicalDeviceFeatures NULL
 #define znewVkPhysicalDeviceFeatures(L, err) (VkPhysicalDeviceFeatures*)znew((L), -1, sizeof(VkPhysicalDeviceFeatures),(err))
 #define znewarrayVkPhysicalDeviceFeatures(L, count, err) (VkPhysicalDeviceFeatures*)znewarray((L),-1, sizeof(VkPhysicalDeviceFeatures), (count), (err))
+#define zinitarrayVkPhysicalDeviceFeatures(p, count) (VkPhysicalDeviceFeatures*)zinitarray((p),-1, sizeof(VkPhysicalDeviceFeatures), (count))
 #define zcheckVkPhysicalDeviceFeatures moonvulkan_zcheckVkPhysicalDeviceFeatures
 VkPhysicalDeviceFeatures* zcheckVkPhysicalDeviceFeatures(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceFeatures moonvulkan_zcheckarrayVkPhysicalDeviceFeatures
 VkPhysicalDeviceFeatures* zcheckarrayVkPhysicalDeviceFeatures(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceFeatures moonvulkan_zcheckarraybufVkPhysicalDeviceFeatures
+VkPhysicalDeviceFeatures* zcheckarraybufVkPhysicalDeviceFeatures(lua_State *L, int arg, VkPhysicalDeviceFeatures *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceFeatures moonvulkan_zinitVkPhysicalDeviceFeatures
 int zinitVkPhysicalDeviceFeatures(lua_State *L, VkPhysicalDeviceFeatures* p, int *err);
 #define zfreeVkPhysicalDeviceFeatures(L, p, base) zfree_untyped((L), (p), (base), zclearVkPhysicalDeviceFeatures)
@@ -5534,10 +6558,13 @@ int zpushVkPhysicalDeviceFeatures(lua_State *L, const VkPhysicalDeviceFeatures *
 #define zclearVkPhysicalDeviceLimits NULL
 #define znewVkPhysicalDeviceLimits(L, err) (VkPhysicalDeviceLimits*)znew((L), -1, sizeof(VkPhysicalDeviceLimits),(err))
 #define znewarrayVkPhysicalDeviceLimits(L, count, err) (VkPhysicalDeviceLimits*)znewarray((L),-1, sizeof(VkPhysicalDeviceLimits), (count), (err))
+#define zinitarrayVkPhysicalDeviceLimits(p, count) (VkPhysicalDeviceLimits*)zinitarray((p),-1, sizeof(VkPhysicalDeviceLimits), (count))
 #define zcheckVkPhysicalDeviceLimits moonvulkan_zcheckVkPhysicalDeviceLimits
 VkPhysicalDeviceLimits* zcheckVkPhysicalDeviceLimits(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceLimits moonvulkan_zcheckarrayVkPhysicalDeviceLimits
 VkPhysicalDeviceLimits* zcheckarrayVkPhysicalDeviceLimits(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceLimits moonvulkan_zcheckarraybufVkPhysicalDeviceLimits
+VkPhysicalDeviceLimits* zcheckarraybufVkPhysicalDeviceLimits(lua_State *L, int arg, VkPhysicalDeviceLimits *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceLimits moonvulkan_zinitVkPhysicalDeviceLimits
 int zinitVkPhysicalDeviceLimits(lua_State *L, VkPhysicalDeviceLimits* p, int *err);
 #define zfreeVkPhysicalDeviceLimits(L, p, base) zfree_untyped((L), (p), (base), zclearVkPhysicalDeviceLimits)
@@ -5548,10 +6575,13 @@ int zpushVkPhysicalDeviceLimits(lua_State *L, const VkPhysicalDeviceLimits *p);
 #define zclearVkPhysicalDeviceSparseProperties NULL
 #define znewVkPhysicalDeviceSparseProperties(L, err) (VkPhysicalDeviceSparseProperties*)znew((L), -1, sizeof(VkPhysicalDeviceSparseProperties),(err))
 #define znewarrayVkPhysicalDeviceSparseProperties(L, count, err) (VkPhysicalDeviceSparseProperties*)znewarray((L),-1, sizeof(VkPhysicalDeviceSparseProperties), (count), (err))
+#define zinitarrayVkPhysicalDeviceSparseProperties(p, count) (VkPhysicalDeviceSparseProperties*)zinitarray((p),-1, sizeof(VkPhysicalDeviceSparseProperties), (count))
 #define zcheckVkPhysicalDeviceSparseProperties moonvulkan_zcheckVkPhysicalDeviceSparseProperties
 VkPhysicalDeviceSparseProperties* zcheckVkPhysicalDeviceSparseProperties(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceSparseProperties moonvulkan_zcheckarrayVkPhysicalDeviceSparseProperties
 VkPhysicalDeviceSparseProperties* zcheckarrayVkPhysicalDeviceSparseProperties(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceSparseProperties moonvulkan_zcheckarraybufVkPhysicalDeviceSparseProperties
+VkPhysicalDeviceSparseProperties* zcheckarraybufVkPhysicalDeviceSparseProperties(lua_State *L, int arg, VkPhysicalDeviceSparseProperties *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceSparseProperties moonvulkan_zinitVkPhysicalDeviceSparseProperties
 int zinitVkPhysicalDeviceSparseProperties(lua_State *L, VkPhysicalDeviceSparseProperties* p, int *err);
 #define zfreeVkPhysicalDeviceSparseProperties(L, p, base) zfree_untyped((L), (p), (base), zclearVkPhysicalDeviceSparseProperties)
@@ -5562,10 +6592,13 @@ int zpushVkPhysicalDeviceSparseProperties(lua_State *L, const VkPhysicalDeviceSp
 #define zclearVkPhysicalDeviceProperties NULL
 #define znewVkPhysicalDeviceProperties(L, err) (VkPhysicalDeviceProperties*)znew((L), -1, sizeof(VkPhysicalDeviceProperties),(err))
 #define znewarrayVkPhysicalDeviceProperties(L, count, err) (VkPhysicalDeviceProperties*)znewarray((L),-1, sizeof(VkPhysicalDeviceProperties), (count), (err))
+#define zinitarrayVkPhysicalDeviceProperties(p, count) (VkPhysicalDeviceProperties*)zinitarray((p),-1, sizeof(VkPhysicalDeviceProperties), (count))
 #define zcheckVkPhysicalDeviceProperties moonvulkan_zcheckVkPhysicalDeviceProperties
 VkPhysicalDeviceProperties* zcheckVkPhysicalDeviceProperties(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceProperties moonvulkan_zcheckarrayVkPhysicalDeviceProperties
 VkPhysicalDeviceProperties* zcheckarrayVkPhysicalDeviceProperties(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceProperties moonvulkan_zcheckarraybufVkPhysicalDeviceProperties
+VkPhysicalDeviceProperties* zcheckarraybufVkPhysicalDeviceProperties(lua_State *L, int arg, VkPhysicalDeviceProperties *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceProperties moonvulkan_zinitVkPhysicalDeviceProperties
 int zinitVkPhysicalDeviceProperties(lua_State *L, VkPhysicalDeviceProperties* p, int *err);
 #define zfreeVkPhysicalDeviceProperties(L, p, base) zfree_untyped((L), (p), (base), zclearVkPhysicalDeviceProperties)
@@ -5576,10 +6609,13 @@ int zpushVkPhysicalDeviceProperties(lua_State *L, const VkPhysicalDeviceProperti
 #define zclearVkInputAttachmentAspectReference NULL
 #define znewVkInputAttachmentAspectReference(L, err) (VkInputAttachmentAspectReference*)znew((L), -1, sizeof(VkInputAttachmentAspectReference),(err))
 #define znewarrayVkInputAttachmentAspectReference(L, count, err) (VkInputAttachmentAspectReference*)znewarray((L),-1, sizeof(VkInputAttachmentAspectReference), (count), (err))
+#define zinitarrayVkInputAttachmentAspectReference(p, count) (VkInputAttachmentAspectReference*)zinitarray((p),-1, sizeof(VkInputAttachmentAspectReference), (count))
 #define zcheckVkInputAttachmentAspectReference moonvulkan_zcheckVkInputAttachmentAspectReference
 VkInputAttachmentAspectReference* zcheckVkInputAttachmentAspectReference(lua_State *L, int arg, int *err);
 #define zcheckarrayVkInputAttachmentAspectReference moonvulkan_zcheckarrayVkInputAttachmentAspectReference
 VkInputAttachmentAspectReference* zcheckarrayVkInputAttachmentAspectReference(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkInputAttachmentAspectReference moonvulkan_zcheckarraybufVkInputAttachmentAspectReference
+VkInputAttachmentAspectReference* zcheckarraybufVkInputAttachmentAspectReference(lua_State *L, int arg, VkInputAttachmentAspectReference *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkInputAttachmentAspectReference moonvulkan_zinitVkInputAttachmentAspectReference
 int zinitVkInputAttachmentAspectReference(lua_State *L, VkInputAttachmentAspectReference* p, int *err);
 #define zfreeVkInputAttachmentAspectReference(L, p, base) zfree_untyped((L), (p), (base), zclearVkInputAttachmentAspectReference)
@@ -5591,10 +6627,13 @@ int zpushVkInputAttachmentAspectReference(lua_State *L, const VkInputAttachmentA
 void zclearVkAttachmentSampleLocationsEXT(lua_State *L, const void *p);
 #define znewVkAttachmentSampleLocationsEXT(L, err) (VkAttachmentSampleLocationsEXT*)znew((L), -1, sizeof(VkAttachmentSampleLocationsEXT),(err))
 #define znewarrayVkAttachmentSampleLocationsEXT(L, count, err) (VkAttachmentSampleLocationsEXT*)znewarray((L),-1, sizeof(VkAttachmentSampleLocationsEXT), (count), (err))
+#define zinitarrayVkAttachmentSampleLocationsEXT(p, count) (VkAttachmentSampleLocationsEXT*)zinitarray((p),-1, sizeof(VkAttachmentSampleLocationsEXT), (count))
 #define zcheckVkAttachmentSampleLocationsEXT moonvulkan_zcheckVkAttachmentSampleLocationsEXT
 VkAttachmentSampleLocationsEXT* zcheckVkAttachmentSampleLocationsEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAttachmentSampleLocationsEXT moonvulkan_zcheckarrayVkAttachmentSampleLocationsEXT
 VkAttachmentSampleLocationsEXT* zcheckarrayVkAttachmentSampleLocationsEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAttachmentSampleLocationsEXT moonvulkan_zcheckarraybufVkAttachmentSampleLocationsEXT
+VkAttachmentSampleLocationsEXT* zcheckarraybufVkAttachmentSampleLocationsEXT(lua_State *L, int arg, VkAttachmentSampleLocationsEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAttachmentSampleLocationsEXT moonvulkan_zinitVkAttachmentSampleLocationsEXT
 int zinitVkAttachmentSampleLocationsEXT(lua_State *L, VkAttachmentSampleLocationsEXT* p, int *err);
 #define zfreeVkAttachmentSampleLocationsEXT(L, p, base) zfree_untyped((L), (p), (base), zclearVkAttachmentSampleLocationsEXT)
@@ -5606,10 +6645,13 @@ int zpushVkAttachmentSampleLocationsEXT(lua_State *L, const VkAttachmentSampleLo
 void zclearVkSubpassSampleLocationsEXT(lua_State *L, const void *p);
 #define znewVkSubpassSampleLocationsEXT(L, err) (VkSubpassSampleLocationsEXT*)znew((L), -1, sizeof(VkSubpassSampleLocationsEXT),(err))
 #define znewarrayVkSubpassSampleLocationsEXT(L, count, err) (VkSubpassSampleLocationsEXT*)znewarray((L),-1, sizeof(VkSubpassSampleLocationsEXT), (count), (err))
+#define zinitarrayVkSubpassSampleLocationsEXT(p, count) (VkSubpassSampleLocationsEXT*)zinitarray((p),-1, sizeof(VkSubpassSampleLocationsEXT), (count))
 #define zcheckVkSubpassSampleLocationsEXT moonvulkan_zcheckVkSubpassSampleLocationsEXT
 VkSubpassSampleLocationsEXT* zcheckVkSubpassSampleLocationsEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSubpassSampleLocationsEXT moonvulkan_zcheckarrayVkSubpassSampleLocationsEXT
 VkSubpassSampleLocationsEXT* zcheckarrayVkSubpassSampleLocationsEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSubpassSampleLocationsEXT moonvulkan_zcheckarraybufVkSubpassSampleLocationsEXT
+VkSubpassSampleLocationsEXT* zcheckarraybufVkSubpassSampleLocationsEXT(lua_State *L, int arg, VkSubpassSampleLocationsEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSubpassSampleLocationsEXT moonvulkan_zinitVkSubpassSampleLocationsEXT
 int zinitVkSubpassSampleLocationsEXT(lua_State *L, VkSubpassSampleLocationsEXT* p, int *err);
 #define zfreeVkSubpassSampleLocationsEXT(L, p, base) zfree_untyped((L), (p), (base), zclearVkSubpassSampleLocationsEXT)
@@ -5620,10 +6662,13 @@ int zpushVkSubpassSampleLocationsEXT(lua_State *L, const VkSubpassSampleLocation
 #define zclearVkFormatProperties NULL
 #define znewVkFormatProperties(L, err) (VkFormatProperties*)znew((L), -1, sizeof(VkFormatProperties),(err))
 #define znewarrayVkFormatProperties(L, count, err) (VkFormatProperties*)znewarray((L),-1, sizeof(VkFormatProperties), (count), (err))
+#define zinitarrayVkFormatProperties(p, count) (VkFormatProperties*)zinitarray((p),-1, sizeof(VkFormatProperties), (count))
 #define zcheckVkFormatProperties moonvulkan_zcheckVkFormatProperties
 VkFormatProperties* zcheckVkFormatProperties(lua_State *L, int arg, int *err);
 #define zcheckarrayVkFormatProperties moonvulkan_zcheckarrayVkFormatProperties
 VkFormatProperties* zcheckarrayVkFormatProperties(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkFormatProperties moonvulkan_zcheckarraybufVkFormatProperties
+VkFormatProperties* zcheckarraybufVkFormatProperties(lua_State *L, int arg, VkFormatProperties *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkFormatProperties moonvulkan_zinitVkFormatProperties
 int zinitVkFormatProperties(lua_State *L, VkFormatProperties* p, int *err);
 #define zfreeVkFormatProperties(L, p, base) zfree_untyped((L), (p), (base), zclearVkFormatProperties)
@@ -5634,10 +6679,13 @@ int zpushVkFormatProperties(lua_State *L, const VkFormatProperties *p);
 #define zclearVkImageFormatProperties NULL
 #define znewVkImageFormatProperties(L, err) (VkImageFormatProperties*)znew((L), -1, sizeof(VkImageFormatProperties),(err))
 #define znewarrayVkImageFormatProperties(L, count, err) (VkImageFormatProperties*)znewarray((L),-1, sizeof(VkImageFormatProperties), (count), (err))
+#define zinitarrayVkImageFormatProperties(p, count) (VkImageFormatProperties*)zinitarray((p),-1, sizeof(VkImageFormatProperties), (count))
 #define zcheckVkImageFormatProperties moonvulkan_zcheckVkImageFormatProperties
 VkImageFormatProperties* zcheckVkImageFormatProperties(lua_State *L, int arg, int *err);
 #define zcheckarrayVkImageFormatProperties moonvulkan_zcheckarrayVkImageFormatProperties
 VkImageFormatProperties* zcheckarrayVkImageFormatProperties(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkImageFormatProperties moonvulkan_zcheckarraybufVkImageFormatProperties
+VkImageFormatProperties* zcheckarraybufVkImageFormatProperties(lua_State *L, int arg, VkImageFormatProperties *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkImageFormatProperties moonvulkan_zinitVkImageFormatProperties
 int zinitVkImageFormatProperties(lua_State *L, VkImageFormatProperties* p, int *err);
 #define zfreeVkImageFormatProperties(L, p, base) zfree_untyped((L), (p), (base), zclearVkImageFormatProperties)
@@ -5648,10 +6696,13 @@ int zpushVkImageFormatProperties(lua_State *L, const VkImageFormatProperties *p)
 #define zclearVkSparseImageFormatProperties NULL
 #define znewVkSparseImageFormatProperties(L, err) (VkSparseImageFormatProperties*)znew((L), -1, sizeof(VkSparseImageFormatProperties),(err))
 #define znewarrayVkSparseImageFormatProperties(L, count, err) (VkSparseImageFormatProperties*)znewarray((L),-1, sizeof(VkSparseImageFormatProperties), (count), (err))
+#define zinitarrayVkSparseImageFormatProperties(p, count) (VkSparseImageFormatProperties*)zinitarray((p),-1, sizeof(VkSparseImageFormatProperties), (count))
 #define zcheckVkSparseImageFormatProperties moonvulkan_zcheckVkSparseImageFormatProperties
 VkSparseImageFormatProperties* zcheckVkSparseImageFormatProperties(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSparseImageFormatProperties moonvulkan_zcheckarrayVkSparseImageFormatProperties
 VkSparseImageFormatProperties* zcheckarrayVkSparseImageFormatProperties(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSparseImageFormatProperties moonvulkan_zcheckarraybufVkSparseImageFormatProperties
+VkSparseImageFormatProperties* zcheckarraybufVkSparseImageFormatProperties(lua_State *L, int arg, VkSparseImageFormatProperties *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSparseImageFormatProperties moonvulkan_zinitVkSparseImageFormatProperties
 int zinitVkSparseImageFormatProperties(lua_State *L, VkSparseImageFormatProperties* p, int *err);
 #define zfreeVkSparseImageFormatProperties(L, p, base) zfree_untyped((L), (p), (base), zclearVkSparseImageFormatProperties)
@@ -5662,10 +6713,13 @@ int zpushVkSparseImageFormatProperties(lua_State *L, const VkSparseImageFormatPr
 #define zclearVkExternalMemoryProperties NULL
 #define znewVkExternalMemoryProperties(L, err) (VkExternalMemoryProperties*)znew((L), -1, sizeof(VkExternalMemoryProperties),(err))
 #define znewarrayVkExternalMemoryProperties(L, count, err) (VkExternalMemoryProperties*)znewarray((L),-1, sizeof(VkExternalMemoryProperties), (count), (err))
+#define zinitarrayVkExternalMemoryProperties(p, count) (VkExternalMemoryProperties*)zinitarray((p),-1, sizeof(VkExternalMemoryProperties), (count))
 #define zcheckVkExternalMemoryProperties moonvulkan_zcheckVkExternalMemoryProperties
 VkExternalMemoryProperties* zcheckVkExternalMemoryProperties(lua_State *L, int arg, int *err);
 #define zcheckarrayVkExternalMemoryProperties moonvulkan_zcheckarrayVkExternalMemoryProperties
 VkExternalMemoryProperties* zcheckarrayVkExternalMemoryProperties(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkExternalMemoryProperties moonvulkan_zcheckarraybufVkExternalMemoryProperties
+VkExternalMemoryProperties* zcheckarraybufVkExternalMemoryProperties(lua_State *L, int arg, VkExternalMemoryProperties *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkExternalMemoryProperties moonvulkan_zinitVkExternalMemoryProperties
 int zinitVkExternalMemoryProperties(lua_State *L, VkExternalMemoryProperties* p, int *err);
 #define zfreeVkExternalMemoryProperties(L, p, base) zfree_untyped((L), (p), (base), zclearVkExternalMemoryProperties)
@@ -5676,10 +6730,13 @@ int zpushVkExternalMemoryProperties(lua_State *L, const VkExternalMemoryProperti
 #define zclearVkPhysicalDeviceMemoryProperties NULL
 #define znewVkPhysicalDeviceMemoryProperties(L, err) (VkPhysicalDeviceMemoryProperties*)znew((L), -1, sizeof(VkPhysicalDeviceMemoryProperties),(err))
 #define znewarrayVkPhysicalDeviceMemoryProperties(L, count, err) (VkPhysicalDeviceMemoryProperties*)znewarray((L),-1, sizeof(VkPhysicalDeviceMemoryProperties), (count), (err))
+#define zinitarrayVkPhysicalDeviceMemoryProperties(p, count) (VkPhysicalDeviceMemoryProperties*)zinitarray((p),-1, sizeof(VkPhysicalDeviceMemoryProperties), (count))
 #define zcheckVkPhysicalDeviceMemoryProperties moonvulkan_zcheckVkPhysicalDeviceMemoryProperties
 VkPhysicalDeviceMemoryProperties* zcheckVkPhysicalDeviceMemoryProperties(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPhysicalDeviceMemoryProperties moonvulkan_zcheckarrayVkPhysicalDeviceMemoryProperties
 VkPhysicalDeviceMemoryProperties* zcheckarrayVkPhysicalDeviceMemoryProperties(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPhysicalDeviceMemoryProperties moonvulkan_zcheckarraybufVkPhysicalDeviceMemoryProperties
+VkPhysicalDeviceMemoryProperties* zcheckarraybufVkPhysicalDeviceMemoryProperties(lua_State *L, int arg, VkPhysicalDeviceMemoryProperties *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPhysicalDeviceMemoryProperties moonvulkan_zinitVkPhysicalDeviceMemoryProperties
 int zinitVkPhysicalDeviceMemoryProperties(lua_State *L, VkPhysicalDeviceMemoryProperties* p, int *err);
 #define zfreeVkPhysicalDeviceMemoryProperties(L, p, base) zfree_untyped((L), (p), (base), zclearVkPhysicalDeviceMemoryProperties)
@@ -5690,10 +6747,13 @@ int zpushVkPhysicalDeviceMemoryProperties(lua_State *L, const VkPhysicalDeviceMe
 #define zclearVkMemoryRequirements NULL
 #define znewVkMemoryRequirements(L, err) (VkMemoryRequirements*)znew((L), -1, sizeof(VkMemoryRequirements),(err))
 #define znewarrayVkMemoryRequirements(L, count, err) (VkMemoryRequirements*)znewarray((L),-1, sizeof(VkMemoryRequirements), (count), (err))
+#define zinitarrayVkMemoryRequirements(p, count) (VkMemoryRequirements*)zinitarray((p),-1, sizeof(VkMemoryRequirements), (count))
 #define zcheckVkMemoryRequirements moonvulkan_zcheckVkMemoryRequirements
 VkMemoryRequirements* zcheckVkMemoryRequirements(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMemoryRequirements moonvulkan_zcheckarrayVkMemoryRequirements
 VkMemoryRequirements* zcheckarrayVkMemoryRequirements(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMemoryRequirements moonvulkan_zcheckarraybufVkMemoryRequirements
+VkMemoryRequirements* zcheckarraybufVkMemoryRequirements(lua_State *L, int arg, VkMemoryRequirements *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMemoryRequirements moonvulkan_zinitVkMemoryRequirements
 int zinitVkMemoryRequirements(lua_State *L, VkMemoryRequirements* p, int *err);
 #define zfreeVkMemoryRequirements(L, p, base) zfree_untyped((L), (p), (base), zclearVkMemoryRequirements)
@@ -5704,10 +6764,13 @@ int zpushVkMemoryRequirements(lua_State *L, const VkMemoryRequirements *p);
 #define zclearVkSparseImageMemoryRequirements NULL
 #define znewVkSparseImageMemoryRequirements(L, err) (VkSparseImageMemoryRequirements*)znew((L), -1, sizeof(VkSparseImageMemoryRequirements),(err))
 #define znewarrayVkSparseImageMemoryRequirements(L, count, err) (VkSparseImageMemoryRequirements*)znewarray((L),-1, sizeof(VkSparseImageMemoryRequirements), (count), (err))
+#define zinitarrayVkSparseImageMemoryRequirements(p, count) (VkSparseImageMemoryRequirements*)zinitarray((p),-1, sizeof(VkSparseImageMemoryRequirements), (count))
 #define zcheckVkSparseImageMemoryRequirements moonvulkan_zcheckVkSparseImageMemoryRequirements
 VkSparseImageMemoryRequirements* zcheckVkSparseImageMemoryRequirements(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSparseImageMemoryRequirements moonvulkan_zcheckarrayVkSparseImageMemoryRequirements
 VkSparseImageMemoryRequirements* zcheckarrayVkSparseImageMemoryRequirements(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSparseImageMemoryRequirements moonvulkan_zcheckarraybufVkSparseImageMemoryRequirements
+VkSparseImageMemoryRequirements* zcheckarraybufVkSparseImageMemoryRequirements(lua_State *L, int arg, VkSparseImageMemoryRequirements *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSparseImageMemoryRequirements moonvulkan_zinitVkSparseImageMemoryRequirements
 int zinitVkSparseImageMemoryRequirements(lua_State *L, VkSparseImageMemoryRequirements* p, int *err);
 #define zfreeVkSparseImageMemoryRequirements(L, p, base) zfree_untyped((L), (p), (base), zclearVkSparseImageMemoryRequirements)
@@ -5718,10 +6781,13 @@ int zpushVkSparseImageMemoryRequirements(lua_State *L, const VkSparseImageMemory
 #define zclearVkSurfaceCapabilitiesKHR NULL
 #define znewVkSurfaceCapabilitiesKHR(L, err) (VkSurfaceCapabilitiesKHR*)znew((L), -1, sizeof(VkSurfaceCapabilitiesKHR),(err))
 #define znewarrayVkSurfaceCapabilitiesKHR(L, count, err) (VkSurfaceCapabilitiesKHR*)znewarray((L),-1, sizeof(VkSurfaceCapabilitiesKHR), (count), (err))
+#define zinitarrayVkSurfaceCapabilitiesKHR(p, count) (VkSurfaceCapabilitiesKHR*)zinitarray((p),-1, sizeof(VkSurfaceCapabilitiesKHR), (count))
 #define zcheckVkSurfaceCapabilitiesKHR moonvulkan_zcheckVkSurfaceCapabilitiesKHR
 VkSurfaceCapabilitiesKHR* zcheckVkSurfaceCapabilitiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSurfaceCapabilitiesKHR moonvulkan_zcheckarrayVkSurfaceCapabilitiesKHR
 VkSurfaceCapabilitiesKHR* zcheckarrayVkSurfaceCapabilitiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSurfaceCapabilitiesKHR moonvulkan_zcheckarraybufVkSurfaceCapabilitiesKHR
+VkSurfaceCapabilitiesKHR* zcheckarraybufVkSurfaceCapabilitiesKHR(lua_State *L, int arg, VkSurfaceCapabilitiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSurfaceCapabilitiesKHR moonvulkan_zinitVkSurfaceCapabilitiesKHR
 int zinitVkSurfaceCapabilitiesKHR(lua_State *L, VkSurfaceCapabilitiesKHR* p, int *err);
 #define zfreeVkSurfaceCapabilitiesKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkSurfaceCapabilitiesKHR)
@@ -5732,10 +6798,13 @@ int zpushVkSurfaceCapabilitiesKHR(lua_State *L, const VkSurfaceCapabilitiesKHR *
 #define zclearVkSurfaceFormatKHR NULL
 #define znewVkSurfaceFormatKHR(L, err) (VkSurfaceFormatKHR*)znew((L), -1, sizeof(VkSurfaceFormatKHR),(err))
 #define znewarrayVkSurfaceFormatKHR(L, count, err) (VkSurfaceFormatKHR*)znewarray((L),-1, sizeof(VkSurfaceFormatKHR), (count), (err))
+#define zinitarrayVkSurfaceFormatKHR(p, count) (VkSurfaceFormatKHR*)zinitarray((p),-1, sizeof(VkSurfaceFormatKHR), (count))
 #define zcheckVkSurfaceFormatKHR moonvulkan_zcheckVkSurfaceFormatKHR
 VkSurfaceFormatKHR* zcheckVkSurfaceFormatKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkSurfaceFormatKHR moonvulkan_zcheckarrayVkSurfaceFormatKHR
 VkSurfaceFormatKHR* zcheckarrayVkSurfaceFormatKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkSurfaceFormatKHR moonvulkan_zcheckarraybufVkSurfaceFormatKHR
+VkSurfaceFormatKHR* zcheckarraybufVkSurfaceFormatKHR(lua_State *L, int arg, VkSurfaceFormatKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkSurfaceFormatKHR moonvulkan_zinitVkSurfaceFormatKHR
 int zinitVkSurfaceFormatKHR(lua_State *L, VkSurfaceFormatKHR* p, int *err);
 #define zfreeVkSurfaceFormatKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkSurfaceFormatKHR)
@@ -5746,10 +6815,13 @@ int zpushVkSurfaceFormatKHR(lua_State *L, const VkSurfaceFormatKHR *p);
 #define zclearVkQueueFamilyProperties NULL
 #define znewVkQueueFamilyProperties(L, err) (VkQueueFamilyProperties*)znew((L), -1, sizeof(VkQueueFamilyProperties),(err))
 #define znewarrayVkQueueFamilyProperties(L, count, err) (VkQueueFamilyProperties*)znewarray((L),-1, sizeof(VkQueueFamilyProperties), (count), (err))
+#define zinitarrayVkQueueFamilyProperties(p, count) (VkQueueFamilyProperties*)zinitarray((p),-1, sizeof(VkQueueFamilyProperties), (count))
 #define zcheckVkQueueFamilyProperties moonvulkan_zcheckVkQueueFamilyProperties
 VkQueueFamilyProperties* zcheckVkQueueFamilyProperties(lua_State *L, int arg, int *err);
 #define zcheckarrayVkQueueFamilyProperties moonvulkan_zcheckarrayVkQueueFamilyProperties
 VkQueueFamilyProperties* zcheckarrayVkQueueFamilyProperties(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkQueueFamilyProperties moonvulkan_zcheckarraybufVkQueueFamilyProperties
+VkQueueFamilyProperties* zcheckarraybufVkQueueFamilyProperties(lua_State *L, int arg, VkQueueFamilyProperties *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkQueueFamilyProperties moonvulkan_zinitVkQueueFamilyProperties
 int zinitVkQueueFamilyProperties(lua_State *L, VkQueueFamilyProperties* p, int *err);
 #define zfreeVkQueueFamilyProperties(L, p, base) zfree_untyped((L), (p), (base), zclearVkQueueFamilyProperties)
@@ -5760,10 +6832,13 @@ int zpushVkQueueFamilyProperties(lua_State *L, const VkQueueFamilyProperties *p,
 #define zclearVkDisplayPropertiesKHR NULL
 #define znewVkDisplayPropertiesKHR(L, err) (VkDisplayPropertiesKHR*)znew((L), -1, sizeof(VkDisplayPropertiesKHR),(err))
 #define znewarrayVkDisplayPropertiesKHR(L, count, err) (VkDisplayPropertiesKHR*)znewarray((L),-1, sizeof(VkDisplayPropertiesKHR), (count), (err))
+#define zinitarrayVkDisplayPropertiesKHR(p, count) (VkDisplayPropertiesKHR*)zinitarray((p),-1, sizeof(VkDisplayPropertiesKHR), (count))
 #define zcheckVkDisplayPropertiesKHR moonvulkan_zcheckVkDisplayPropertiesKHR
 VkDisplayPropertiesKHR* zcheckVkDisplayPropertiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayPropertiesKHR moonvulkan_zcheckarrayVkDisplayPropertiesKHR
 VkDisplayPropertiesKHR* zcheckarrayVkDisplayPropertiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayPropertiesKHR moonvulkan_zcheckarraybufVkDisplayPropertiesKHR
+VkDisplayPropertiesKHR* zcheckarraybufVkDisplayPropertiesKHR(lua_State *L, int arg, VkDisplayPropertiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayPropertiesKHR moonvulkan_zinitVkDisplayPropertiesKHR
 int zinitVkDisplayPropertiesKHR(lua_State *L, VkDisplayPropertiesKHR* p, int *err);
 #define zfreeVkDisplayPropertiesKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkDisplayPropertiesKHR)
@@ -5774,10 +6849,13 @@ int zpushVkDisplayPropertiesKHR(lua_State *L, const VkDisplayPropertiesKHR *p);
 #define zclearVkDisplayPlanePropertiesKHR NULL
 #define znewVkDisplayPlanePropertiesKHR(L, err) (VkDisplayPlanePropertiesKHR*)znew((L), -1, sizeof(VkDisplayPlanePropertiesKHR),(err))
 #define znewarrayVkDisplayPlanePropertiesKHR(L, count, err) (VkDisplayPlanePropertiesKHR*)znewarray((L),-1, sizeof(VkDisplayPlanePropertiesKHR), (count), (err))
+#define zinitarrayVkDisplayPlanePropertiesKHR(p, count) (VkDisplayPlanePropertiesKHR*)zinitarray((p),-1, sizeof(VkDisplayPlanePropertiesKHR), (count))
 #define zcheckVkDisplayPlanePropertiesKHR moonvulkan_zcheckVkDisplayPlanePropertiesKHR
 VkDisplayPlanePropertiesKHR* zcheckVkDisplayPlanePropertiesKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDisplayPlanePropertiesKHR moonvulkan_zcheckarrayVkDisplayPlanePropertiesKHR
 VkDisplayPlanePropertiesKHR* zcheckarrayVkDisplayPlanePropertiesKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDisplayPlanePropertiesKHR moonvulkan_zcheckarraybufVkDisplayPlanePropertiesKHR
+VkDisplayPlanePropertiesKHR* zcheckarraybufVkDisplayPlanePropertiesKHR(lua_State *L, int arg, VkDisplayPlanePropertiesKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDisplayPlanePropertiesKHR moonvulkan_zinitVkDisplayPlanePropertiesKHR
 int zinitVkDisplayPlanePropertiesKHR(lua_State *L, VkDisplayPlanePropertiesKHR* p, int *err);
 #define zfreeVkDisplayPlanePropertiesKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkDisplayPlanePropertiesKHR)
@@ -5789,10 +6867,13 @@ int zpushVkDisplayPlanePropertiesKHR(lua_State *L, const VkDisplayPlanePropertie
 void zclearVkDescriptorSetLayoutBinding(lua_State *L, const void *p);
 #define znewVkDescriptorSetLayoutBinding(L, err) (VkDescriptorSetLayoutBinding*)znew((L), -1, sizeof(VkDescriptorSetLayoutBinding),(err))
 #define znewarrayVkDescriptorSetLayoutBinding(L, count, err) (VkDescriptorSetLayoutBinding*)znewarray((L),-1, sizeof(VkDescriptorSetLayoutBinding), (count), (err))
+#define zinitarrayVkDescriptorSetLayoutBinding(p, count) (VkDescriptorSetLayoutBinding*)zinitarray((p),-1, sizeof(VkDescriptorSetLayoutBinding), (count))
 #define zcheckVkDescriptorSetLayoutBinding moonvulkan_zcheckVkDescriptorSetLayoutBinding
 VkDescriptorSetLayoutBinding* zcheckVkDescriptorSetLayoutBinding(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDescriptorSetLayoutBinding moonvulkan_zcheckarrayVkDescriptorSetLayoutBinding
 VkDescriptorSetLayoutBinding* zcheckarrayVkDescriptorSetLayoutBinding(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDescriptorSetLayoutBinding moonvulkan_zcheckarraybufVkDescriptorSetLayoutBinding
+VkDescriptorSetLayoutBinding* zcheckarraybufVkDescriptorSetLayoutBinding(lua_State *L, int arg, VkDescriptorSetLayoutBinding *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDescriptorSetLayoutBinding moonvulkan_zinitVkDescriptorSetLayoutBinding
 int zinitVkDescriptorSetLayoutBinding(lua_State *L, VkDescriptorSetLayoutBinding* p, int *err);
 #define zfreeVkDescriptorSetLayoutBinding(L, p, base) zfree_untyped((L), (p), (base), zclearVkDescriptorSetLayoutBinding)
@@ -5803,10 +6884,13 @@ int zpushVkDescriptorSetLayoutBinding(lua_State *L, const VkDescriptorSetLayoutB
 #define zclearVkVertexInputBindingDivisorDescriptionEXT NULL
 #define znewVkVertexInputBindingDivisorDescriptionEXT(L, err) (VkVertexInputBindingDivisorDescriptionEXT*)znew((L), -1, sizeof(VkVertexInputBindingDivisorDescriptionEXT),(err))
 #define znewarrayVkVertexInputBindingDivisorDescriptionEXT(L, count, err) (VkVertexInputBindingDivisorDescriptionEXT*)znewarray((L),-1, sizeof(VkVertexInputBindingDivisorDescriptionEXT), (count), (err))
+#define zinitarrayVkVertexInputBindingDivisorDescriptionEXT(p, count) (VkVertexInputBindingDivisorDescriptionEXT*)zinitarray((p),-1, sizeof(VkVertexInputBindingDivisorDescriptionEXT), (count))
 #define zcheckVkVertexInputBindingDivisorDescriptionEXT moonvulkan_zcheckVkVertexInputBindingDivisorDescriptionEXT
 VkVertexInputBindingDivisorDescriptionEXT* zcheckVkVertexInputBindingDivisorDescriptionEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkVertexInputBindingDivisorDescriptionEXT moonvulkan_zcheckarrayVkVertexInputBindingDivisorDescriptionEXT
 VkVertexInputBindingDivisorDescriptionEXT* zcheckarrayVkVertexInputBindingDivisorDescriptionEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkVertexInputBindingDivisorDescriptionEXT moonvulkan_zcheckarraybufVkVertexInputBindingDivisorDescriptionEXT
+VkVertexInputBindingDivisorDescriptionEXT* zcheckarraybufVkVertexInputBindingDivisorDescriptionEXT(lua_State *L, int arg, VkVertexInputBindingDivisorDescriptionEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkVertexInputBindingDivisorDescriptionEXT moonvulkan_zinitVkVertexInputBindingDivisorDescriptionEXT
 int zinitVkVertexInputBindingDivisorDescriptionEXT(lua_State *L, VkVertexInputBindingDivisorDescriptionEXT* p, int *err);
 #define zfreeVkVertexInputBindingDivisorDescriptionEXT(L, p, base) zfree_untyped((L), (p), (base), zclearVkVertexInputBindingDivisorDescriptionEXT)
@@ -5817,10 +6901,13 @@ int zpushVkVertexInputBindingDivisorDescriptionEXT(lua_State *L, const VkVertexI
 #define zclearVkDrmFormatModifierPropertiesEXT NULL
 #define znewVkDrmFormatModifierPropertiesEXT(L, err) (VkDrmFormatModifierPropertiesEXT*)znew((L), -1, sizeof(VkDrmFormatModifierPropertiesEXT),(err))
 #define znewarrayVkDrmFormatModifierPropertiesEXT(L, count, err) (VkDrmFormatModifierPropertiesEXT*)znewarray((L),-1, sizeof(VkDrmFormatModifierPropertiesEXT), (count), (err))
+#define zinitarrayVkDrmFormatModifierPropertiesEXT(p, count) (VkDrmFormatModifierPropertiesEXT*)zinitarray((p),-1, sizeof(VkDrmFormatModifierPropertiesEXT), (count))
 #define zcheckVkDrmFormatModifierPropertiesEXT moonvulkan_zcheckVkDrmFormatModifierPropertiesEXT
 VkDrmFormatModifierPropertiesEXT* zcheckVkDrmFormatModifierPropertiesEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDrmFormatModifierPropertiesEXT moonvulkan_zcheckarrayVkDrmFormatModifierPropertiesEXT
 VkDrmFormatModifierPropertiesEXT* zcheckarrayVkDrmFormatModifierPropertiesEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDrmFormatModifierPropertiesEXT moonvulkan_zcheckarraybufVkDrmFormatModifierPropertiesEXT
+VkDrmFormatModifierPropertiesEXT* zcheckarraybufVkDrmFormatModifierPropertiesEXT(lua_State *L, int arg, VkDrmFormatModifierPropertiesEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDrmFormatModifierPropertiesEXT moonvulkan_zinitVkDrmFormatModifierPropertiesEXT
 int zinitVkDrmFormatModifierPropertiesEXT(lua_State *L, VkDrmFormatModifierPropertiesEXT* p, int *err);
 #define zfreeVkDrmFormatModifierPropertiesEXT(L, p, base) zfree_untyped((L), (p), (base), zclearVkDrmFormatModifierPropertiesEXT)
@@ -5831,10 +6918,13 @@ int zpushVkDrmFormatModifierPropertiesEXT(lua_State *L, const VkDrmFormatModifie
 #define zclearVkPipelineCreationFeedbackEXT NULL
 #define znewVkPipelineCreationFeedbackEXT(L, err) (VkPipelineCreationFeedbackEXT*)znew((L), -1, sizeof(VkPipelineCreationFeedbackEXT),(err))
 #define znewarrayVkPipelineCreationFeedbackEXT(L, count, err) (VkPipelineCreationFeedbackEXT*)znewarray((L),-1, sizeof(VkPipelineCreationFeedbackEXT), (count), (err))
+#define zinitarrayVkPipelineCreationFeedbackEXT(p, count) (VkPipelineCreationFeedbackEXT*)zinitarray((p),-1, sizeof(VkPipelineCreationFeedbackEXT), (count))
 #define zcheckVkPipelineCreationFeedbackEXT moonvulkan_zcheckVkPipelineCreationFeedbackEXT
 VkPipelineCreationFeedbackEXT* zcheckVkPipelineCreationFeedbackEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineCreationFeedbackEXT moonvulkan_zcheckarrayVkPipelineCreationFeedbackEXT
 VkPipelineCreationFeedbackEXT* zcheckarrayVkPipelineCreationFeedbackEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineCreationFeedbackEXT moonvulkan_zcheckarraybufVkPipelineCreationFeedbackEXT
+VkPipelineCreationFeedbackEXT* zcheckarraybufVkPipelineCreationFeedbackEXT(lua_State *L, int arg, VkPipelineCreationFeedbackEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineCreationFeedbackEXT moonvulkan_zinitVkPipelineCreationFeedbackEXT
 int zinitVkPipelineCreationFeedbackEXT(lua_State *L, VkPipelineCreationFeedbackEXT* p, int *err);
 #define zfreeVkPipelineCreationFeedbackEXT(L, p, base) zfree_untyped((L), (p), (base), zclearVkPipelineCreationFeedbackEXT)
@@ -5845,10 +6935,13 @@ int zpushVkPipelineCreationFeedbackEXT(lua_State *L, const VkPipelineCreationFee
 #define zclearVkAccelerationStructureBuildRangeInfoKHR NULL
 #define znewVkAccelerationStructureBuildRangeInfoKHR(L, err) (VkAccelerationStructureBuildRangeInfoKHR*)znew((L), -1, sizeof(VkAccelerationStructureBuildRangeInfoKHR),(err))
 #define znewarrayVkAccelerationStructureBuildRangeInfoKHR(L, count, err) (VkAccelerationStructureBuildRangeInfoKHR*)znewarray((L),-1, sizeof(VkAccelerationStructureBuildRangeInfoKHR), (count), (err))
+#define zinitarrayVkAccelerationStructureBuildRangeInfoKHR(p, count) (VkAccelerationStructureBuildRangeInfoKHR*)zinitarray((p),-1, sizeof(VkAccelerationStructureBuildRangeInfoKHR), (count))
 #define zcheckVkAccelerationStructureBuildRangeInfoKHR moonvulkan_zcheckVkAccelerationStructureBuildRangeInfoKHR
 VkAccelerationStructureBuildRangeInfoKHR* zcheckVkAccelerationStructureBuildRangeInfoKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAccelerationStructureBuildRangeInfoKHR moonvulkan_zcheckarrayVkAccelerationStructureBuildRangeInfoKHR
 VkAccelerationStructureBuildRangeInfoKHR* zcheckarrayVkAccelerationStructureBuildRangeInfoKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAccelerationStructureBuildRangeInfoKHR moonvulkan_zcheckarraybufVkAccelerationStructureBuildRangeInfoKHR
+VkAccelerationStructureBuildRangeInfoKHR* zcheckarraybufVkAccelerationStructureBuildRangeInfoKHR(lua_State *L, int arg, VkAccelerationStructureBuildRangeInfoKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAccelerationStructureBuildRangeInfoKHR moonvulkan_zinitVkAccelerationStructureBuildRangeInfoKHR
 int zinitVkAccelerationStructureBuildRangeInfoKHR(lua_State *L, VkAccelerationStructureBuildRangeInfoKHR* p, int *err);
 #define zfreeVkAccelerationStructureBuildRangeInfoKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkAccelerationStructureBuildRangeInfoKHR)
@@ -5859,10 +6952,13 @@ int zpushVkAccelerationStructureBuildRangeInfoKHR(lua_State *L, const VkAccelera
 #define zclearVkStridedDeviceAddressRegionKHR NULL
 #define znewVkStridedDeviceAddressRegionKHR(L, err) (VkStridedDeviceAddressRegionKHR*)znew((L), -1, sizeof(VkStridedDeviceAddressRegionKHR),(err))
 #define znewarrayVkStridedDeviceAddressRegionKHR(L, count, err) (VkStridedDeviceAddressRegionKHR*)znewarray((L),-1, sizeof(VkStridedDeviceAddressRegionKHR), (count), (err))
+#define zinitarrayVkStridedDeviceAddressRegionKHR(p, count) (VkStridedDeviceAddressRegionKHR*)zinitarray((p),-1, sizeof(VkStridedDeviceAddressRegionKHR), (count))
 #define zcheckVkStridedDeviceAddressRegionKHR moonvulkan_zcheckVkStridedDeviceAddressRegionKHR
 VkStridedDeviceAddressRegionKHR* zcheckVkStridedDeviceAddressRegionKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkStridedDeviceAddressRegionKHR moonvulkan_zcheckarrayVkStridedDeviceAddressRegionKHR
 VkStridedDeviceAddressRegionKHR* zcheckarrayVkStridedDeviceAddressRegionKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkStridedDeviceAddressRegionKHR moonvulkan_zcheckarraybufVkStridedDeviceAddressRegionKHR
+VkStridedDeviceAddressRegionKHR* zcheckarraybufVkStridedDeviceAddressRegionKHR(lua_State *L, int arg, VkStridedDeviceAddressRegionKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkStridedDeviceAddressRegionKHR moonvulkan_zinitVkStridedDeviceAddressRegionKHR
 int zinitVkStridedDeviceAddressRegionKHR(lua_State *L, VkStridedDeviceAddressRegionKHR* p, int *err);
 #define zfreeVkStridedDeviceAddressRegionKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkStridedDeviceAddressRegionKHR)
@@ -5873,10 +6969,13 @@ int zpushVkStridedDeviceAddressRegionKHR(lua_State *L, const VkStridedDeviceAddr
 #define zclearVkMultiDrawInfoEXT NULL
 #define znewVkMultiDrawInfoEXT(L, err) (VkMultiDrawInfoEXT*)znew((L), -1, sizeof(VkMultiDrawInfoEXT),(err))
 #define znewarrayVkMultiDrawInfoEXT(L, count, err) (VkMultiDrawInfoEXT*)znewarray((L),-1, sizeof(VkMultiDrawInfoEXT), (count), (err))
+#define zinitarrayVkMultiDrawInfoEXT(p, count) (VkMultiDrawInfoEXT*)zinitarray((p),-1, sizeof(VkMultiDrawInfoEXT), (count))
 #define zcheckVkMultiDrawInfoEXT moonvulkan_zcheckVkMultiDrawInfoEXT
 VkMultiDrawInfoEXT* zcheckVkMultiDrawInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMultiDrawInfoEXT moonvulkan_zcheckarrayVkMultiDrawInfoEXT
 VkMultiDrawInfoEXT* zcheckarrayVkMultiDrawInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMultiDrawInfoEXT moonvulkan_zcheckarraybufVkMultiDrawInfoEXT
+VkMultiDrawInfoEXT* zcheckarraybufVkMultiDrawInfoEXT(lua_State *L, int arg, VkMultiDrawInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMultiDrawInfoEXT moonvulkan_zinitVkMultiDrawInfoEXT
 int zinitVkMultiDrawInfoEXT(lua_State *L, VkMultiDrawInfoEXT* p, int *err);
 #define zfreeVkMultiDrawInfoEXT(L, p, base) zfree_untyped((L), (p), (base), zclearVkMultiDrawInfoEXT)
@@ -5887,10 +6986,13 @@ int zpushVkMultiDrawInfoEXT(lua_State *L, const VkMultiDrawInfoEXT *p);
 #define zclearVkMultiDrawIndexedInfoEXT NULL
 #define znewVkMultiDrawIndexedInfoEXT(L, err) (VkMultiDrawIndexedInfoEXT*)znew((L), -1, sizeof(VkMultiDrawIndexedInfoEXT),(err))
 #define znewarrayVkMultiDrawIndexedInfoEXT(L, count, err) (VkMultiDrawIndexedInfoEXT*)znewarray((L),-1, sizeof(VkMultiDrawIndexedInfoEXT), (count), (err))
+#define zinitarrayVkMultiDrawIndexedInfoEXT(p, count) (VkMultiDrawIndexedInfoEXT*)zinitarray((p),-1, sizeof(VkMultiDrawIndexedInfoEXT), (count))
 #define zcheckVkMultiDrawIndexedInfoEXT moonvulkan_zcheckVkMultiDrawIndexedInfoEXT
 VkMultiDrawIndexedInfoEXT* zcheckVkMultiDrawIndexedInfoEXT(lua_State *L, int arg, int *err);
 #define zcheckarrayVkMultiDrawIndexedInfoEXT moonvulkan_zcheckarrayVkMultiDrawIndexedInfoEXT
 VkMultiDrawIndexedInfoEXT* zcheckarrayVkMultiDrawIndexedInfoEXT(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkMultiDrawIndexedInfoEXT moonvulkan_zcheckarraybufVkMultiDrawIndexedInfoEXT
+VkMultiDrawIndexedInfoEXT* zcheckarraybufVkMultiDrawIndexedInfoEXT(lua_State *L, int arg, VkMultiDrawIndexedInfoEXT *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkMultiDrawIndexedInfoEXT moonvulkan_zinitVkMultiDrawIndexedInfoEXT
 int zinitVkMultiDrawIndexedInfoEXT(lua_State *L, VkMultiDrawIndexedInfoEXT* p, int *err);
 #define zfreeVkMultiDrawIndexedInfoEXT(L, p, base) zfree_untyped((L), (p), (base), zclearVkMultiDrawIndexedInfoEXT)
@@ -5901,10 +7003,13 @@ int zpushVkMultiDrawIndexedInfoEXT(lua_State *L, const VkMultiDrawIndexedInfoEXT
 #define zclearVkPerformanceCounterResultKHR NULL
 #define znewVkPerformanceCounterResultKHR(L, err) (VkPerformanceCounterResultKHR*)znew((L), -1, sizeof(VkPerformanceCounterResultKHR),(err))
 #define znewarrayVkPerformanceCounterResultKHR(L, count, err) (VkPerformanceCounterResultKHR*)znewarray((L),-1, sizeof(VkPerformanceCounterResultKHR), (count), (err))
+#define zinitarrayVkPerformanceCounterResultKHR(p, count) (VkPerformanceCounterResultKHR*)zinitarray((p),-1, sizeof(VkPerformanceCounterResultKHR), (count))
 #define zcheckVkPerformanceCounterResultKHR moonvulkan_zcheckVkPerformanceCounterResultKHR
 VkPerformanceCounterResultKHR* zcheckVkPerformanceCounterResultKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPerformanceCounterResultKHR moonvulkan_zcheckarrayVkPerformanceCounterResultKHR
 VkPerformanceCounterResultKHR* zcheckarrayVkPerformanceCounterResultKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPerformanceCounterResultKHR moonvulkan_zcheckarraybufVkPerformanceCounterResultKHR
+VkPerformanceCounterResultKHR* zcheckarraybufVkPerformanceCounterResultKHR(lua_State *L, int arg, VkPerformanceCounterResultKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPerformanceCounterResultKHR moonvulkan_zinitVkPerformanceCounterResultKHR
 int zinitVkPerformanceCounterResultKHR(lua_State *L, VkPerformanceCounterResultKHR* p, int *err);
 #define zfreeVkPerformanceCounterResultKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkPerformanceCounterResultKHR)
@@ -5915,10 +7020,13 @@ int zpushVkPerformanceCounterResultKHR(lua_State *L, const VkPerformanceCounterR
 #define zclearVkPipelineExecutableStatisticValueKHR NULL
 #define znewVkPipelineExecutableStatisticValueKHR(L, err) (VkPipelineExecutableStatisticValueKHR*)znew((L), -1, sizeof(VkPipelineExecutableStatisticValueKHR),(err))
 #define znewarrayVkPipelineExecutableStatisticValueKHR(L, count, err) (VkPipelineExecutableStatisticValueKHR*)znewarray((L),-1, sizeof(VkPipelineExecutableStatisticValueKHR), (count), (err))
+#define zinitarrayVkPipelineExecutableStatisticValueKHR(p, count) (VkPipelineExecutableStatisticValueKHR*)zinitarray((p),-1, sizeof(VkPipelineExecutableStatisticValueKHR), (count))
 #define zcheckVkPipelineExecutableStatisticValueKHR moonvulkan_zcheckVkPipelineExecutableStatisticValueKHR
 VkPipelineExecutableStatisticValueKHR* zcheckVkPipelineExecutableStatisticValueKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkPipelineExecutableStatisticValueKHR moonvulkan_zcheckarrayVkPipelineExecutableStatisticValueKHR
 VkPipelineExecutableStatisticValueKHR* zcheckarrayVkPipelineExecutableStatisticValueKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkPipelineExecutableStatisticValueKHR moonvulkan_zcheckarraybufVkPipelineExecutableStatisticValueKHR
+VkPipelineExecutableStatisticValueKHR* zcheckarraybufVkPipelineExecutableStatisticValueKHR(lua_State *L, int arg, VkPipelineExecutableStatisticValueKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkPipelineExecutableStatisticValueKHR moonvulkan_zinitVkPipelineExecutableStatisticValueKHR
 int zinitVkPipelineExecutableStatisticValueKHR(lua_State *L, VkPipelineExecutableStatisticValueKHR* p, int *err);
 #define zfreeVkPipelineExecutableStatisticValueKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkPipelineExecutableStatisticValueKHR)
@@ -5929,10 +7037,13 @@ int zpushVkPipelineExecutableStatisticValueKHR(lua_State *L, const VkPipelineExe
 #define zclearVkDeviceOrHostAddressKHR NULL
 #define znewVkDeviceOrHostAddressKHR(L, err) (VkDeviceOrHostAddressKHR*)znew((L), -1, sizeof(VkDeviceOrHostAddressKHR),(err))
 #define znewarrayVkDeviceOrHostAddressKHR(L, count, err) (VkDeviceOrHostAddressKHR*)znewarray((L),-1, sizeof(VkDeviceOrHostAddressKHR), (count), (err))
+#define zinitarrayVkDeviceOrHostAddressKHR(p, count) (VkDeviceOrHostAddressKHR*)zinitarray((p),-1, sizeof(VkDeviceOrHostAddressKHR), (count))
 #define zcheckVkDeviceOrHostAddressKHR moonvulkan_zcheckVkDeviceOrHostAddressKHR
 VkDeviceOrHostAddressKHR* zcheckVkDeviceOrHostAddressKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkDeviceOrHostAddressKHR moonvulkan_zcheckarrayVkDeviceOrHostAddressKHR
 VkDeviceOrHostAddressKHR* zcheckarrayVkDeviceOrHostAddressKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkDeviceOrHostAddressKHR moonvulkan_zcheckarraybufVkDeviceOrHostAddressKHR
+VkDeviceOrHostAddressKHR* zcheckarraybufVkDeviceOrHostAddressKHR(lua_State *L, int arg, VkDeviceOrHostAddressKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkDeviceOrHostAddressKHR moonvulkan_zinitVkDeviceOrHostAddressKHR
 int zinitVkDeviceOrHostAddressKHR(lua_State *L, VkDeviceOrHostAddressKHR* p, int *err);
 #define zfreeVkDeviceOrHostAddressKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkDeviceOrHostAddressKHR)
@@ -5943,10 +7054,13 @@ int zpushVkDeviceOrHostAddressKHR(lua_State *L, const VkDeviceOrHostAddressKHR *
 #define zclearVkAccelerationStructureGeometryDataKHR NULL
 #define znewVkAccelerationStructureGeometryDataKHR(L, err) (VkAccelerationStructureGeometryDataKHR*)znew((L), -1, sizeof(VkAccelerationStructureGeometryDataKHR),(err))
 #define znewarrayVkAccelerationStructureGeometryDataKHR(L, count, err) (VkAccelerationStructureGeometryDataKHR*)znewarray((L),-1, sizeof(VkAccelerationStructureGeometryDataKHR), (count), (err))
+#define zinitarrayVkAccelerationStructureGeometryDataKHR(p, count) (VkAccelerationStructureGeometryDataKHR*)zinitarray((p),-1, sizeof(VkAccelerationStructureGeometryDataKHR), (count))
 #define zcheckVkAccelerationStructureGeometryDataKHR moonvulkan_zcheckVkAccelerationStructureGeometryDataKHR
 VkAccelerationStructureGeometryDataKHR* zcheckVkAccelerationStructureGeometryDataKHR(lua_State *L, int arg, int *err);
 #define zcheckarrayVkAccelerationStructureGeometryDataKHR moonvulkan_zcheckarrayVkAccelerationStructureGeometryDataKHR
 VkAccelerationStructureGeometryDataKHR* zcheckarrayVkAccelerationStructureGeometryDataKHR(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufVkAccelerationStructureGeometryDataKHR moonvulkan_zcheckarraybufVkAccelerationStructureGeometryDataKHR
+VkAccelerationStructureGeometryDataKHR* zcheckarraybufVkAccelerationStructureGeometryDataKHR(lua_State *L, int arg, VkAccelerationStructureGeometryDataKHR *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitVkAccelerationStructureGeometryDataKHR moonvulkan_zinitVkAccelerationStructureGeometryDataKHR
 int zinitVkAccelerationStructureGeometryDataKHR(lua_State *L, VkAccelerationStructureGeometryDataKHR* p, int *err);
 #define zfreeVkAccelerationStructureGeometryDataKHR(L, p, base) zfree_untyped((L), (p), (base), zclearVkAccelerationStructureGeometryDataKHR)
@@ -51,6 +51,8 @@ int zpushVkPhysicalDeviceGroupPropertiesKHR(lua_State *L, const VkPhysicalDevice
 void* znew(lua_State *L, VkStructureType sType /* or -1 */, size_t sz, int *err);
 #define znewarray moonvulkan_znewarray
 void* znewarray(lua_State *L, VkStructureType sType /* or -1 */, size_t sz, uint32_t count, int *err);
+#define zinitarray moonvulkan_zinitarray
+void* zinitarray(void *p, VkStructureType sType /* or -1 */, size_t sz, uint32_t count);
 
 /* Untyped structs only: */
 #define zfree_untyped moonvulkan_zfree_untyped
@@ -449,10 +451,15 @@ local TYPED_WIN32 = {
    { "VkFormatProperties3KHR", "FORMAT_PROPERTIES_3_KHR" },
 } ;
 
+local TYPED_SHADER_OBJECT = {
+   { "VkShaderCreateInfoEXT", "SHADER_CREATE_INFO_EXT" },
+}
+
 -----------------------------------------------------------------------------
 local template_typed =[[
 #define znewXxx(L, err) (Xxx*)znew((L), VK_STRUCTURE_TYPE_XXX, sizeof(Xxx), (err))
 #define znewarrayXxx(L, count, err) (Xxx*)znewarray((L), VK_STRUCTURE_TYPE_XXX, sizeof(Xxx), (count), (err))
+#define zinitarrayXxx(p, count) (Xxx*)zinitarray((p), VK_STRUCTURE_TYPE_XXX, sizeof(Xxx), (count))
 #define znewchainXxx moonvulkan_znewchainXxx
 Xxx* znewchainXxx(lua_State *L, int *err);
 #define znewchainarrayXxx moonvulkan_znewchainarrayXxx
@@ -461,6 +468,8 @@ Xxx* znewchainarrayXxx(lua_State *L, uint32_t count, int *err);
 Xxx* zcheckXxx(lua_State *L, int arg, int *err);
 #define zcheckarrayXxx moonvulkan_zcheckarrayXxx
 Xxx* zcheckarrayXxx(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufXxx moonvulkan_zcheckarraybufXxx
+Xxx* zcheckarraybufXxx(lua_State *L, int arg, Xxx *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitXxx moonvulkan_zinitXxx
 int zinitXxx(lua_State *L, Xxx* p, int *err);
 #define zfreeXxx(L, p, base) zfree((L), (p), (base))
@@ -479,10 +488,13 @@ end
 local template_untyped =[[
 #define znewXxx(L, err) (Xxx*)znew((L), -1, sizeof(Xxx),(err))
 #define znewarrayXxx(L, count, err) (Xxx*)znewarray((L),-1, sizeof(Xxx), (count), (err))
+#define zinitarrayXxx(p, count) (Xxx*)zinitarray((p),-1, sizeof(Xxx), (count))
 #define zcheckXxx moonvulkan_zcheckXxx
 Xxx* zcheckXxx(lua_State *L, int arg, int *err);
 #define zcheckarrayXxx moonvulkan_zcheckarrayXxx
 Xxx* zcheckarrayXxx(lua_State *L, int arg, uint32_t *count, int *err);
+#define zcheckarraybufXxx moonvulkan_zcheckarraybufXxx
+Xxx* zcheckarraybufXxx(lua_State *L, int arg, Xxx *buf, uint32_t bufcount, uint32_t *count, int *err);
 #define zinitXxx moonvulkan_zinitXxx
 int zinitXxx(lua_State *L, Xxx* p, int *err);
 #define zfreeXxx(L, p, base) zfree_untyped((L), (p), (base), zclearXxx)
@@ -520,6 +532,9 @@ for i, t in ipairs(TYPED) do print(create_decl_typed(t[1], t[2])) end
 print("\n#ifdef VK_USE_PLATFORM_WIN32_KHR\n")
 for i, t in ipairs(TYPED_WIN32) do print(create_decl_typed(t[1], t[2])) end
 print("\n#endif /* VK_USE_PLATFORM_WIN32_KHR */\n")
+print("\n#ifdef VK_EXT_shader_object\n")
+for i, t in ipairs(TYPED_SHADER_OBJECT) do print(create_decl_typed(t[1], t[2])) end
+print("\n#endif /* VK_EXT_shader_object */\n")
 
 print([[
 /*------------------------------------------------------------------------------*